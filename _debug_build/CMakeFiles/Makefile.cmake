@@ -0,0 +1,287 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeCPack.cmake"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/PackageConfig.cmake.in"
+  "/root/repo/PkgConfig.pc.in"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/cmake/Modules/CUnit.cmake"
+  "/root/repo/cmake/Modules/CUnit/src/main.c.in"
+  "/root/repo/cmake/Modules/FindCUnit.cmake"
+  "/root/repo/cmake/Modules/FindOpenSSL.cmake"
+  "/root/repo/cmake/Modules/Findcodecov.cmake"
+  "/root/repo/cmake/Modules/Generate.cmake"
+  "/root/repo/cmake/Modules/GenerateExportHeader.cmake"
+  "/root/repo/cmake/Modules/HashUtilities.cmake"
+  "/root/repo/compat/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/core/CMakeLists.txt"
+  "/root/repo/src/core/cdr/CMakeLists.txt"
+  "/root/repo/src/core/ddsc/CMakeLists.txt"
+  "/root/repo/src/core/ddsc/tests/CMakeLists.txt"
+  "/root/repo/src/core/ddsc/tests/config_env.h.in"
+  "/root/repo/src/core/ddsi/CMakeLists.txt"
+  "/root/repo/src/core/ddsi/defconfig.c"
+  "/root/repo/src/core/ddsi/tests/CMakeLists.txt"
+  "/root/repo/src/core/xtests/CMakeLists.txt"
+  "/root/repo/src/core/xtests/filterbench/CMakeLists.txt"
+  "/root/repo/src/core/xtests/initsampledeliv/CMakeLists.txt"
+  "/root/repo/src/core/xtests/rhc_torture/CMakeLists.txt"
+  "/root/repo/src/core/xtests/symbol_export/CMakeLists.txt"
+  "/root/repo/src/core/xtests/xpackbench/CMakeLists.txt"
+  "/root/repo/src/ddsrt/CMakeLists.txt"
+  "/root/repo/src/ddsrt/include/dds/config.h.in"
+  "/root/repo/src/ddsrt/include/dds/features.h.in"
+  "/root/repo/src/ddsrt/include/dds/version.h.in"
+  "/root/repo/src/ddsrt/tests/CMakeLists.txt"
+  "/root/repo/src/idl/CMakeLists.txt"
+  "/root/repo/src/idl/include/idl/version.h.in"
+  "/root/repo/src/idl/src/parser.c"
+  "/root/repo/src/idl/src/parser.h"
+  "/root/repo/src/idl/src/parser.y"
+  "/root/repo/src/idl/tests/CMakeLists.txt"
+  "/root/repo/src/security/CMakeLists.txt"
+  "/root/repo/src/security/api/CMakeLists.txt"
+  "/root/repo/src/security/builtin_plugins/CMakeLists.txt"
+  "/root/repo/src/security/builtin_plugins/access_control/CMakeLists.txt"
+  "/root/repo/src/security/builtin_plugins/authentication/CMakeLists.txt"
+  "/root/repo/src/security/builtin_plugins/cryptographic/CMakeLists.txt"
+  "/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt"
+  "/root/repo/src/security/builtin_plugins/tests/config_env.h.in"
+  "/root/repo/src/security/core/CMakeLists.txt"
+  "/root/repo/src/security/core/tests/CMakeLists.txt"
+  "/root/repo/src/security/core/tests/common/config_env.h.in"
+  "/root/repo/src/security/openssl/CMakeLists.txt"
+  "/root/repo/src/tools/CMakeLists.txt"
+  "/root/repo/src/tools/_confgen/../../core/ddsi/include/dds/ddsi/ddsi_config.h"
+  "/root/repo/src/tools/_confgen/../../core/ddsi/src/ddsi__cfgelems.h"
+  "/root/repo/src/tools/_confgen/../../core/ddsi/src/ddsi__cfgunits.h"
+  "/root/repo/src/tools/_confgen/../../core/ddsi/src/ddsi_config.c"
+  "/root/repo/src/tools/_confgen/CMakeLists.txt"
+  "/root/repo/src/tools/_confgen/_confgen.c"
+  "/root/repo/src/tools/_confgen/_confgen.h"
+  "/root/repo/src/tools/_confgen/generate_defconfig.c"
+  "/root/repo/src/tools/_confgen/generate_md.c"
+  "/root/repo/src/tools/_confgen/generate_rnc.c"
+  "/root/repo/src/tools/_confgen/generate_rst.c"
+  "/root/repo/src/tools/_confgen/generate_xsd.c"
+  "/root/repo/src/tools/ddsperf/CMakeLists.txt"
+  "/root/repo/src/tools/idlc/CMakeLists.txt"
+  "/root/repo/src/tools/idlc/src/config.h.in"
+  "/root/repo/src/tools/idlc/tests/CMakeLists.txt"
+  "/root/repo/src/tools/idlpp/CMakeLists.txt"
+  "/root/repo/src/tools/idlpp/src/configed.H.in"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-SameMajorVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/CMakeLists-C.txt.in"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/foo.c"
+  "/usr/share/cmake-3.25/Modules/CheckIPOSupported/main.c"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindOpenSSL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GenerateExportHeader.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Modules/exportheader.cmake.in"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "CycloneDDSConfig.cmake"
+  "CycloneDDSConfigVersion.cmake"
+  "CycloneDDS.pc"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "compat/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tools/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tools/_confgen/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tools/idlpp/src/configed.H"
+  "src/tools/idlpp/src/mcpp_export.h"
+  "src/tools/idlpp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tools/idlc/config.h"
+  "src/tools/idlc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tools/idlc/tests/cunit_idlc.c"
+  "src/tools/idlc/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tools/ddsperf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ddsrt/include/dds/config.h"
+  "src/ddsrt/include/dds/features.h"
+  "src/ddsrt/include/dds/version.h"
+  "src/ddsrt/ddsrt-internal/include/dds/export.h"
+  "src/ddsrt/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ddsrt/tests/cunit_ddsrt.c"
+  "src/ddsrt/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/idl/include/idl/version.h"
+  "src/idl/include/idl/export.h"
+  "src/idl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/idl/tests/cunit_idl.c"
+  "src/idl/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/security/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/security/api/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/security/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/security/core/tests/include/dds/security/access_control_wrapper_export.h"
+  "src/security/core/tests/include/dds/security/authentication_wrapper_export.h"
+  "src/security/core/tests/include/dds/security/cryptography_wrapper_export.h"
+  "src/security/core/tests/cunit_security_core.c"
+  "src/security/core/tests/common/config_env.h"
+  "src/security/core/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/security/openssl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/security/builtin_plugins/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/security/builtin_plugins/access_control/include/dds/security/export.h"
+  "src/security/builtin_plugins/access_control/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/security/builtin_plugins/authentication/include/dds/security/export.h"
+  "src/security/builtin_plugins/authentication/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/security/builtin_plugins/cryptographic/include/dds/security/export.h"
+  "src/security/builtin_plugins/cryptographic/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/security/builtin_plugins/tests/cunit_security_plugins.c"
+  "src/security/builtin_plugins/tests/config_env.h"
+  "src/security/builtin_plugins/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/CMakeFiles/_CMakeLTOTest-C/src/CMakeLists.txt"
+  "src/core/CMakeFiles/_CMakeLTOTest-C/src/foo.c"
+  "src/core/CMakeFiles/_CMakeLTOTest-C/src/main.c"
+  "src/core/include/dds/export.h"
+  "src/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/ddsi/tests/cunit_ddsi.c"
+  "src/core/ddsi/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/ddsc/tests/cunit_ddsc.c"
+  "src/core/ddsc/tests/config_env.h"
+  "src/core/ddsc/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/xtests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/xtests/rhc_torture/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/xtests/initsampledeliv/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/xtests/xpackbench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/xtests/filterbench/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/xtests/symbol_export/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "src/tools/_confgen/CMakeFiles/_confgen.dir/DependInfo.cmake"
+  "src/tools/idlpp/CMakeFiles/idlpp.dir/DependInfo.cmake"
+  "src/tools/idlc/CMakeFiles/idlc.dir/DependInfo.cmake"
+  "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/DependInfo.cmake"
+  "src/tools/ddsperf/CMakeFiles/ddsperf_types_generate.dir/DependInfo.cmake"
+  "src/tools/ddsperf/CMakeFiles/ddsperf.dir/DependInfo.cmake"
+  "src/ddsrt/CMakeFiles/ddsrt-internal.dir/DependInfo.cmake"
+  "src/ddsrt/tests/CMakeFiles/cunit_ddsrt.dir/DependInfo.cmake"
+  "src/idl/CMakeFiles/idl.dir/DependInfo.cmake"
+  "src/idl/tests/CMakeFiles/cunit_idl.dir/DependInfo.cmake"
+  "src/security/core/tests/CMakeFiles/SecurityCoreTests_generate.dir/DependInfo.cmake"
+  "src/security/core/tests/CMakeFiles/dds_security_access_control_wrapper.dir/DependInfo.cmake"
+  "src/security/core/tests/CMakeFiles/dds_security_authentication_wrapper.dir/DependInfo.cmake"
+  "src/security/core/tests/CMakeFiles/dds_security_cryptography_wrapper.dir/DependInfo.cmake"
+  "src/security/core/tests/CMakeFiles/cunit_security_core.dir/DependInfo.cmake"
+  "src/security/builtin_plugins/access_control/CMakeFiles/dds_security_ac.dir/DependInfo.cmake"
+  "src/security/builtin_plugins/authentication/CMakeFiles/dds_security_auth.dir/DependInfo.cmake"
+  "src/security/builtin_plugins/cryptographic/CMakeFiles/dds_security_crypto.dir/DependInfo.cmake"
+  "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/DependInfo.cmake"
+  "src/core/CMakeFiles/ddsc.dir/DependInfo.cmake"
+  "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/DependInfo.cmake"
+  "src/core/ddsc/tests/CMakeFiles/RoundTrip_generate.dir/DependInfo.cmake"
+  "src/core/ddsc/tests/CMakeFiles/Space_generate.dir/DependInfo.cmake"
+  "src/core/ddsc/tests/CMakeFiles/TypesArrayKey_generate.dir/DependInfo.cmake"
+  "src/core/ddsc/tests/CMakeFiles/WriteTypes_generate.dir/DependInfo.cmake"
+  "src/core/ddsc/tests/CMakeFiles/InstanceHandleTypes_generate.dir/DependInfo.cmake"
+  "src/core/ddsc/tests/CMakeFiles/RWData_generate.dir/DependInfo.cmake"
+  "src/core/ddsc/tests/CMakeFiles/CreateWriter_generate.dir/DependInfo.cmake"
+  "src/core/ddsc/tests/CMakeFiles/DataRepresentationTypes_generate.dir/DependInfo.cmake"
+  "src/core/ddsc/tests/CMakeFiles/MinXcdrVersion_generate.dir/DependInfo.cmake"
+  "src/core/ddsc/tests/CMakeFiles/CdrStreamOptimize_generate.dir/DependInfo.cmake"
+  "src/core/ddsc/tests/CMakeFiles/Serializers_generate.dir/DependInfo.cmake"
+  "src/core/ddsc/tests/CMakeFiles/XSpace_generate.dir/DependInfo.cmake"
+  "src/core/ddsc/tests/CMakeFiles/XSpaceNoTypeInfo_generate.dir/DependInfo.cmake"
+  "src/core/ddsc/tests/CMakeFiles/TypeBuilderTypes_generate.dir/DependInfo.cmake"
+  "src/core/ddsc/tests/CMakeFiles/FilterExprTypes_generate.dir/DependInfo.cmake"
+  "src/core/ddsc/tests/CMakeFiles/cunit_ddsc.dir/DependInfo.cmake"
+  "src/core/ddsc/tests/CMakeFiles/oneliner.dir/DependInfo.cmake"
+  "src/core/xtests/rhc_torture/CMakeFiles/RhcTypes_generate.dir/DependInfo.cmake"
+  "src/core/xtests/rhc_torture/CMakeFiles/rhc_torture.dir/DependInfo.cmake"
+  "src/core/xtests/initsampledeliv/CMakeFiles/InitSampleDeliv_lib_generate.dir/DependInfo.cmake"
+  "src/core/xtests/initsampledeliv/CMakeFiles/InitSampleDelivPub.dir/DependInfo.cmake"
+  "src/core/xtests/initsampledeliv/CMakeFiles/InitSampleDelivSub.dir/DependInfo.cmake"
+  "src/core/xtests/xpackbench/CMakeFiles/xpackbench.dir/DependInfo.cmake"
+  "src/core/xtests/filterbench/CMakeFiles/FilterBenchTypes_generate.dir/DependInfo.cmake"
+  "src/core/xtests/filterbench/CMakeFiles/filterbench.dir/DependInfo.cmake"
+  "src/core/xtests/symbol_export/CMakeFiles/symbol_export_test.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,194 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/ddsrt/src/atomics.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/atomics.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/atomics.c.o.d"
+  "/root/repo/src/ddsrt/src/avl.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/avl.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/avl.c.o.d"
+  "/root/repo/src/ddsrt/src/bits.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/bits.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/bits.c.o.d"
+  "/root/repo/src/ddsrt/src/bswap.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/bswap.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/bswap.c.o.d"
+  "/root/repo/src/ddsrt/src/cdtors.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/cdtors.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/cdtors.c.o.d"
+  "/root/repo/src/ddsrt/src/circlist.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/circlist.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/circlist.c.o.d"
+  "/root/repo/src/ddsrt/src/dynlib/posix/dynlib.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/dynlib/posix/dynlib.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/dynlib/posix/dynlib.c.o.d"
+  "/root/repo/src/ddsrt/src/environ.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/environ.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/environ.c.o.d"
+  "/root/repo/src/ddsrt/src/environ/posix/environ.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/environ/posix/environ.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/environ/posix/environ.c.o.d"
+  "/root/repo/src/ddsrt/src/expand_vars.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/expand_vars.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/expand_vars.c.o.d"
+  "/root/repo/src/ddsrt/src/fibheap.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/fibheap.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/fibheap.c.o.d"
+  "/root/repo/src/ddsrt/src/filesystem/posix/filesystem.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/filesystem/posix/filesystem.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/filesystem/posix/filesystem.c.o.d"
+  "/root/repo/src/ddsrt/src/heap/posix/heap.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/heap/posix/heap.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/heap/posix/heap.c.o.d"
+  "/root/repo/src/ddsrt/src/hopscotch.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/hopscotch.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/hopscotch.c.o.d"
+  "/root/repo/src/ddsrt/src/ifaddrs.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/ifaddrs.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/ifaddrs.c.o.d"
+  "/root/repo/src/ddsrt/src/ifaddrs/posix/ifaddrs.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/ifaddrs/posix/ifaddrs.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/ifaddrs/posix/ifaddrs.c.o.d"
+  "/root/repo/src/ddsrt/src/io.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/io.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/io.c.o.d"
+  "/root/repo/src/ddsrt/src/log.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/log.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/log.c.o.d"
+  "/root/repo/src/ddsrt/src/md5.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/md5.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/md5.c.o.d"
+  "/root/repo/src/ddsrt/src/mh3.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/mh3.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/mh3.c.o.d"
+  "/root/repo/src/ddsrt/src/netstat/linux/netstat.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/netstat/linux/netstat.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/netstat/linux/netstat.c.o.d"
+  "/root/repo/src/ddsrt/src/process/posix/process.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/process/posix/process.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/process/posix/process.c.o.d"
+  "/root/repo/src/ddsrt/src/random.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/random.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/random.c.o.d"
+  "/root/repo/src/ddsrt/src/random/posix/random.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/random/posix/random.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/random/posix/random.c.o.d"
+  "/root/repo/src/ddsrt/src/retcode.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/retcode.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/retcode.c.o.d"
+  "/root/repo/src/ddsrt/src/rusage/posix/rusage.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/rusage/posix/rusage.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/rusage/posix/rusage.c.o.d"
+  "/root/repo/src/ddsrt/src/sockets.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/sockets.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/sockets.c.o.d"
+  "/root/repo/src/ddsrt/src/sockets/posix/gethostname.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/sockets/posix/gethostname.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/sockets/posix/gethostname.c.o.d"
+  "/root/repo/src/ddsrt/src/sockets/posix/socket.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/sockets/posix/socket.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/sockets/posix/socket.c.o.d"
+  "/root/repo/src/ddsrt/src/string.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/string.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/string.c.o.d"
+  "/root/repo/src/ddsrt/src/strtod.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/strtod.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/strtod.c.o.d"
+  "/root/repo/src/ddsrt/src/strtol.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/strtol.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/strtol.c.o.d"
+  "/root/repo/src/ddsrt/src/sync/posix/sync.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/sync/posix/sync.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/sync/posix/sync.c.o.d"
+  "/root/repo/src/ddsrt/src/threads.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/threads.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/threads.c.o.d"
+  "/root/repo/src/ddsrt/src/threads/posix/threads.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/threads/posix/threads.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/threads/posix/threads.c.o.d"
+  "/root/repo/src/ddsrt/src/time.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/time.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/time.c.o.d"
+  "/root/repo/src/ddsrt/src/time/posix/time.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/time/posix/time.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/time/posix/time.c.o.d"
+  "/root/repo/src/ddsrt/src/xmlparser.c" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/xmlparser.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/ddsrt/src/xmlparser.c.o.d"
+  "/root/repo/src/security/core/src/dds_security_fsm.c" "src/core/CMakeFiles/ddsc.dir/__/security/core/src/dds_security_fsm.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/security/core/src/dds_security_fsm.c.o.d"
+  "/root/repo/src/security/core/src/dds_security_plugins.c" "src/core/CMakeFiles/ddsc.dir/__/security/core/src/dds_security_plugins.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/security/core/src/dds_security_plugins.c.o.d"
+  "/root/repo/src/security/core/src/dds_security_serialize.c" "src/core/CMakeFiles/ddsc.dir/__/security/core/src/dds_security_serialize.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/security/core/src/dds_security_serialize.c.o.d"
+  "/root/repo/src/security/core/src/dds_security_shared_secret.c" "src/core/CMakeFiles/ddsc.dir/__/security/core/src/dds_security_shared_secret.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/security/core/src/dds_security_shared_secret.c.o.d"
+  "/root/repo/src/security/core/src/dds_security_timed_cb.c" "src/core/CMakeFiles/ddsc.dir/__/security/core/src/dds_security_timed_cb.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/security/core/src/dds_security_timed_cb.c.o.d"
+  "/root/repo/src/security/core/src/dds_security_utils.c" "src/core/CMakeFiles/ddsc.dir/__/security/core/src/dds_security_utils.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/__/security/core/src/dds_security_utils.c.o.d"
+  "/root/repo/src/core/cdr/src/dds_cdrstream.c" "src/core/CMakeFiles/ddsc.dir/cdr/src/dds_cdrstream.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/cdr/src/dds_cdrstream.c.o.d"
+  "/root/repo/src/core/cdr/src/dds_cdrstream_simd.c" "src/core/CMakeFiles/ddsc.dir/cdr/src/dds_cdrstream_simd.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/cdr/src/dds_cdrstream_simd.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_alloc.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_alloc.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_alloc.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_builtin.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_builtin.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_builtin.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_coherent.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_coherent.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_coherent.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_data_allocator.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_data_allocator.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_data_allocator.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_domain.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_domain.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_domain.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_entity.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_entity.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_entity.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_filter_expr.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_filter_expr.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_filter_expr.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_guardcond.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_guardcond.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_guardcond.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_handles.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_handles.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_handles.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_init.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_init.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_init.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_instance.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_instance.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_instance.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_listener.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_listener.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_listener.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_loan.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_loan.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_loan.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_matched.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_matched.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_matched.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_participant.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_participant.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_participant.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_publisher.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_publisher.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_publisher.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_qos.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_qos.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_qos.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_querycond.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_querycond.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_querycond.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_read.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_read.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_read.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_readcond.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_readcond.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_readcond.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_reader.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_reader.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_reader.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_rhc.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_rhc.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_rhc.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_rhc_default.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_rhc_default.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_rhc_default.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_rhc_stream.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_rhc_stream.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_rhc_stream.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_sample_arena.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_sample_arena.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_sample_arena.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_serdata_builtintopic.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_serdata_builtintopic.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_serdata_builtintopic.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_serdata_default.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_serdata_default.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_serdata_default.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_sertype_builtintopic.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_sertype_builtintopic.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_sertype_builtintopic.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_sertype_default.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_sertype_default.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_sertype_default.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_statistics.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_statistics.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_statistics.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_subscriber.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_subscriber.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_subscriber.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_topic.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_topic.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_topic.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_view.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_view.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_view.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_waitset.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_waitset.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_waitset.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_whc.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_whc.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_whc.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_whc_builtintopic.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_whc_builtintopic.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_whc_builtintopic.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_whc_persistent.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_whc_persistent.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_whc_persistent.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_whc_ring.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_whc_ring.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_whc_ring.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_whc_spill.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_whc_spill.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_whc_spill.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_write.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_write.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_write.c.o.d"
+  "/root/repo/src/core/ddsc/src/dds_writer.c" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_writer.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsc/src/dds_writer.c.o.d"
+  "/root/repo/src/core/ddsi/defconfig.c" "src/core/CMakeFiles/ddsc.dir/ddsi/defconfig.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/defconfig.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_acknack.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_acknack.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_acknack.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_addrset.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_addrset.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_addrset.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_bitset.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_bitset.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_bitset.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_bswap.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_bswap.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_bswap.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_compress.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_compress.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_compress.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_config.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_config.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_config.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_deadline.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_deadline.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_deadline.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_debmon.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_debmon.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_debmon.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_deliver_locally.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_deliver_locally.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_deliver_locally.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_discovery.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_discovery.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_discovery.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_endpoint.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_endpoint.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_endpoint.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_endpoint_match.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_endpoint_match.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_endpoint_match.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_entity.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_entity.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_entity.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_entity_index.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_entity_index.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_entity_index.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_eth.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_eth.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_eth.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_freelist.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_freelist.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_freelist.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_gc.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_gc.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_gc.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_guid.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_guid.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_guid.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_handshake.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_handshake.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_handshake.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_iid.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_iid.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_iid.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_init.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_init.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_init.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_inverse_uint32_set.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_inverse_uint32_set.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_inverse_uint32_set.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_ipaddr.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_ipaddr.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_ipaddr.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_lat_estim.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_lat_estim.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_lat_estim.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_lease.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_lease.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_lease.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_lifespan.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_lifespan.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_lifespan.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_list_genptr.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_list_genptr.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_list_genptr.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_mcgroup.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_mcgroup.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_mcgroup.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_misc.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_misc.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_misc.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_nwpart.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_nwpart.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_nwpart.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_ownip.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_ownip.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_ownip.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_participant.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_participant.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_participant.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_pcap.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_pcap.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_pcap.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_plist.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_plist.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_plist.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_pmd.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_pmd.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_pmd.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_portmapping.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_portmapping.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_portmapping.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_proxy_endpoint.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_proxy_endpoint.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_proxy_endpoint.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_proxy_participant.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_proxy_participant.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_proxy_participant.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_qosmatch.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_qosmatch.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_qosmatch.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_radmin.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_radmin.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_radmin.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_raweth.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_raweth.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_raweth.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_receive.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_receive.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_receive.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_rhc.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_rhc.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_rhc.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_security_exchange.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_security_exchange.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_security_exchange.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_security_msg.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_security_msg.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_security_msg.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_security_omg.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_security_omg.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_security_omg.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_security_util.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_security_util.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_security_util.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_serdata.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_serdata.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_serdata.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_serdata_cdr.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_serdata_cdr.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_serdata_cdr.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_serdata_plist.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_serdata_plist.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_serdata_plist.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_serdata_pserop.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_serdata_pserop.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_serdata_pserop.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_sertype.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_sertype.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_sertype.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_sertype_cdr.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_sertype_cdr.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_sertype_cdr.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_sertype_plist.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_sertype_plist.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_sertype_plist.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_sertype_pserop.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_sertype_pserop.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_sertype_pserop.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_sockwaitset.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_sockwaitset.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_sockwaitset.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_ssl.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_ssl.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_ssl.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_statistics.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_statistics.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_statistics.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_sysdeps.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_sysdeps.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_sysdeps.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_tcp.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_tcp.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_tcp.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_thread.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_thread.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_thread.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_threadmon.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_threadmon.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_threadmon.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_time.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_time.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_time.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_tkmap.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_tkmap.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_tkmap.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_topic.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_topic.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_topic.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_tran.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_tran.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_tran.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_transmit.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_transmit.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_transmit.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_typebuilder.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_typebuilder.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_typebuilder.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_typelib.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_typelib.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_typelib.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_typelookup.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_typelookup.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_typelookup.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_typewrap.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_typewrap.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_typewrap.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_udp.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_udp.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_udp.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_vendor.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_vendor.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_vendor.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_vnet.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_vnet.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_vnet.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_whc.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_whc.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_whc.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_wraddrset.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_wraddrset.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_wraddrset.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_xevent.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_xevent.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_xevent.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_xmsg.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_xmsg.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_xmsg.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_xt_typeinfo.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_xt_typeinfo.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_xt_typeinfo.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_xt_typelookup.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_xt_typelookup.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_xt_typelookup.c.o.d"
+  "/root/repo/src/core/ddsi/src/ddsi_xt_typemap.c" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_xt_typemap.c.o" "gcc" "src/core/CMakeFiles/ddsc.dir/ddsi/src/ddsi_xt_typemap.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_debug_build/lib/libddsc.so" "/root/repo/_debug_build/lib/libddsc.so.0.11.0"
+  "/root/repo/_debug_build/lib/libddsc.so.0" "/root/repo/_debug_build/lib/libddsc.so.0.11.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
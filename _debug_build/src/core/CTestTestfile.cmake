@@ -0,0 +1,9 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/core
+# Build directory: /root/repo/_debug_build/src/core
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("ddsi/tests")
+subdirs("ddsc/tests")
+subdirs("xtests")
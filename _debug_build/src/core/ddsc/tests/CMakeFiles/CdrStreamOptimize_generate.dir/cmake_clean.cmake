@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/CdrStreamOptimize_generate"
+  "CdrStreamOptimize.c"
+  "CdrStreamOptimize.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/CdrStreamOptimize_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
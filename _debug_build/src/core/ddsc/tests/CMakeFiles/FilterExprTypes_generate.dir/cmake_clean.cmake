@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FilterExprTypes_generate"
+  "FilterExprTypes.c"
+  "FilterExprTypes.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/FilterExprTypes_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
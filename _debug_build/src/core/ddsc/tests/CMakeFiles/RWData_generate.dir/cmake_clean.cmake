@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RWData_generate"
+  "RWData.c"
+  "RWData.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/RWData_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
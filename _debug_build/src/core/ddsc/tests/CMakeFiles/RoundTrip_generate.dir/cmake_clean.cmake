@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/RoundTrip_generate"
+  "RoundTrip.c"
+  "RoundTrip.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/RoundTrip_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
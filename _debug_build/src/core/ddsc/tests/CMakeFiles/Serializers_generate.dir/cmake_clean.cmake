@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Serializers_generate"
+  "Serializers.c"
+  "Serializers.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/Serializers_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/TypeBuilderTypes_generate"
+  "TypeBuilderTypes.c"
+  "TypeBuilderTypes.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/TypeBuilderTypes_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_debug_build/src/core/ddsc/tests/XSpace.h" "/root/repo/_debug_build/src/core/ddsc/tests/XSpace.c"
+  "/root/repo/_debug_build/src/core/ddsc/tests/XSpaceEnum.h" "/root/repo/_debug_build/src/core/ddsc/tests/XSpaceEnum.c"
+  "/root/repo/_debug_build/src/core/ddsc/tests/XSpaceMustUnderstand.h" "/root/repo/_debug_build/src/core/ddsc/tests/XSpaceMustUnderstand.c"
+  "/root/repo/_debug_build/src/core/ddsc/tests/XSpaceTypeConsistencyEnforcement.h" "/root/repo/_debug_build/src/core/ddsc/tests/XSpaceTypeConsistencyEnforcement.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
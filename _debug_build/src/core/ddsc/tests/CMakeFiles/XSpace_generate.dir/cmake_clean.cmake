@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/XSpace_generate"
+  "XSpace.c"
+  "XSpace.h"
+  "XSpaceEnum.c"
+  "XSpaceEnum.h"
+  "XSpaceMustUnderstand.c"
+  "XSpaceMustUnderstand.h"
+  "XSpaceTypeConsistencyEnforcement.c"
+  "XSpaceTypeConsistencyEnforcement.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/XSpace_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../../../bin/oneliner"
+  "../../../../bin/oneliner.pdb"
+  "CMakeFiles/oneliner.dir/RoundTrip.c.o"
+  "CMakeFiles/oneliner.dir/RoundTrip.c.o.d"
+  "CMakeFiles/oneliner.dir/Space.c.o"
+  "CMakeFiles/oneliner.dir/Space.c.o.d"
+  "CMakeFiles/oneliner.dir/oneliner.c.o"
+  "CMakeFiles/oneliner.dir/oneliner.c.o.d"
+  "CMakeFiles/oneliner.dir/test_oneliner.c.o"
+  "CMakeFiles/oneliner.dir/test_oneliner.c.o.d"
+  "CMakeFiles/oneliner.dir/test_util.c.o"
+  "CMakeFiles/oneliner.dir/test_util.c.o.d"
+  "RoundTrip.c"
+  "RoundTrip.h"
+  "Space.c"
+  "Space.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/oneliner.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
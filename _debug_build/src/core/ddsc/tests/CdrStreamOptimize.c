@@ -0,0 +1,2249 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_debug_build/src/core/ddsc/tests/CdrStreamOptimize.c
+  Source: /root/repo/src/core/ddsc/tests/CdrStreamOptimize.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "CdrStreamOptimize.h"
+
+static const uint32_t CdrStreamOptimize_t1_ops [] =
+{
+  /* t1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_t1, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL f54b392e7940752e2b87b56816eb] (#deps: 0)
+  [COMPLETE 2494734bb959ee7cf2bedfdc3e25] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t1 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, \
+  0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x24, 0x94, 0x73, 0x4b, 0xb9, 0x59, 0xee, 0x7c, 0xf2, 0xbe, 0xdf, \
+  0xdc, 0x3e, 0x25, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t1 100u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t1 (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x24, 0x94, 0x73, 0x4b, 0xb9, 0x59, 0xee, \
+  0x7c, 0xf2, 0xbe, 0xdf, 0xdc, 0x3e, 0x25, 0x00, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, \
+  0x31, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x24, 0x94, 0x73, \
+  0x4b, 0xb9, 0x59, 0xee, 0x7c, 0xf2, 0xbe, 0xdf, 0xdc, 0x3e, 0x25, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, \
+  0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t1 202u
+const dds_topic_descriptor_t CdrStreamOptimize_t1_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t1),
+  .m_align = dds_alignof (CdrStreamOptimize_t1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t1",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamOptimize_t1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t1, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t1, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t1 }
+};
+
+static const uint32_t CdrStreamOptimize_t1_a_ops [] =
+{
+  /* t1_a */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_t1_a, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 5472d80f8549173aaed47a3f5dd3] (#deps: 0)
+  [COMPLETE 28b96739b96a7504492a162d8bfa] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t1_a (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, 0x3a, 0xae, 0xd4, 0x7a, \
+  0x3f, 0x5d, 0xd3, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x28, 0xb9, 0x67, 0x39, 0xb9, 0x6a, 0x75, 0x04, 0x49, 0x2a, 0x16, \
+  0x2d, 0x8b, 0xfa, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t1_a 100u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t1_a (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, \
+  0x3a, 0xae, 0xd4, 0x7a, 0x3f, 0x5d, 0xd3, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x28, 0xb9, 0x67, 0x39, 0xb9, 0x6a, 0x75, \
+  0x04, 0x49, 0x2a, 0x16, 0x2d, 0x8b, 0xfa, 0x00, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, \
+  0x31, 0x5f, 0x61, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x28, 0xb9, 0x67, \
+  0x39, 0xb9, 0x6a, 0x75, 0x04, 0x49, 0x2a, 0x16, 0x2d, 0x8b, 0xfa, 0xf1, 0x54, 0x72, 0xd8, 0x0f, \
+  0x85, 0x49, 0x17, 0x3a, 0xae, 0xd4, 0x7a, 0x3f, 0x5d, 0xd3\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t1_a 202u
+const dds_topic_descriptor_t CdrStreamOptimize_t1_a_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t1_a),
+  .m_align = dds_alignof (CdrStreamOptimize_t1_a),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t1_a",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = CdrStreamOptimize_t1_a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t1_a, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t1_a },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t1_a, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t1_a }
+};
+
+static const uint32_t CdrStreamOptimize_t1_m_ops [] =
+{
+  /* t1_m */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_t1_m, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 0c8c1cb4eb9257eae428f4c36641] (#deps: 0)
+  [COMPLETE 272a8d8854fbf35125a5d89c8f14] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t1_m (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, 0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, \
+  0xc3, 0x66, 0x41, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x27, 0x2a, 0x8d, 0x88, 0x54, 0xfb, 0xf3, 0x51, 0x25, 0xa5, 0xd8, \
+  0x9c, 0x8f, 0x14, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t1_m 100u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t1_m (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, 0x92, 0x57, \
+  0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x27, 0x2a, 0x8d, 0x88, 0x54, 0xfb, 0xf3, \
+  0x51, 0x25, 0xa5, 0xd8, 0x9c, 0x8f, 0x14, 0x00, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, \
+  0x31, 0x5f, 0x6d, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x27, 0x2a, 0x8d, \
+  0x88, 0x54, 0xfb, 0xf3, 0x51, 0x25, 0xa5, 0xd8, 0x9c, 0x8f, 0x14, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, \
+  0xeb, 0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t1_m 202u
+const dds_topic_descriptor_t CdrStreamOptimize_t1_m_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t1_m),
+  .m_align = dds_alignof (CdrStreamOptimize_t1_m),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t1_m",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = CdrStreamOptimize_t1_m_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t1_m, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t1_m },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t1_m, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t1_m }
+};
+
+static const uint32_t CdrStreamOptimize_t2_ops [] =
+{
+  /* t2 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (CdrStreamOptimize_t2, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_t2, f2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL bd4d70ef745f30fc229174127be0] (#deps: 0)
+  [COMPLETE 3b43cd4ec053f1c390ec61f318ea] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t2 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xbd, 0x4d, 0x70, 0xef, 0x74, 0x5f, 0x30, 0xfc, 0x22, 0x91, 0x74, \
+  0x12, 0x7b, 0xe0, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x43, 0xcd, 0x4e, 0xc0, 0x53, 0xf1, 0xc3, 0x90, 0xec, 0x61, \
+  0xf3, 0x18, 0xea, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t2 100u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t2 (unsigned char []){ \
+  0x4b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xbd, 0x4d, 0x70, 0xef, 0x74, 0x5f, 0x30, \
+  0xfc, 0x22, 0x91, 0x74, 0x12, 0x7b, 0xe0, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x36, 0x67, 0xf6, 0xa0, 0x00, \
+  0x75, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x43, 0xcd, 0x4e, 0xc0, 0x53, 0xf1, \
+  0xc3, 0x90, 0xec, 0x61, 0xf3, 0x18, 0xea, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, \
+  0x32, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x43, 0xcd, 0x4e, 0xc0, 0x53, 0xf1, 0xc3, 0x90, 0xec, 0x61, \
+  0xf3, 0x18, 0xea, 0xf1, 0xbd, 0x4d, 0x70, 0xef, 0x74, 0x5f, 0x30, 0xfc, 0x22, 0x91, 0x74, 0x12, \
+  0x7b, 0xe0\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t2 242u
+const dds_topic_descriptor_t CdrStreamOptimize_t2_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t2),
+  .m_align = dds_alignof (CdrStreamOptimize_t2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t2",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = CdrStreamOptimize_t2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t2, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t2, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t2 }
+};
+
+static const uint32_t CdrStreamOptimize_t3_ops [] =
+{
+  /* t3 */
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_1BY, offsetof (CdrStreamOptimize_t3, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 040e030d9481725a1f92421d8182] (#deps: 0)
+  [COMPLETE 2ea209f4de6cea816d32760793e4] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t3 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x04, 0x0e, 0x03, 0x0d, 0x94, 0x81, 0x72, 0x5a, 0x1f, 0x92, 0x42, \
+  0x1d, 0x81, 0x82, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x2e, 0xa2, 0x09, 0xf4, 0xde, 0x6c, 0xea, 0x81, 0x6d, 0x32, 0x76, \
+  0x07, 0x93, 0xe4, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t3 100u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t3 (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x04, 0x0e, 0x03, 0x0d, 0x94, 0x81, 0x72, \
+  0x5a, 0x1f, 0x92, 0x42, 0x1d, 0x81, 0x82, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x2e, 0xa2, 0x09, 0xf4, 0xde, 0x6c, 0xea, \
+  0x81, 0x6d, 0x32, 0x76, 0x07, 0x93, 0xe4, 0x00, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, \
+  0x33, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x2e, 0xa2, 0x09, \
+  0xf4, 0xde, 0x6c, 0xea, 0x81, 0x6d, 0x32, 0x76, 0x07, 0x93, 0xe4, 0xf1, 0x04, 0x0e, 0x03, 0x0d, \
+  0x94, 0x81, 0x72, 0x5a, 0x1f, 0x92, 0x42, 0x1d, 0x81, 0x82\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t3 202u
+const dds_topic_descriptor_t CdrStreamOptimize_t3_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t3),
+  .m_align = dds_alignof (CdrStreamOptimize_t3),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t3",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamOptimize_t3_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t3, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t3 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t3, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t3 }
+};
+
+static const uint32_t CdrStreamOptimize_t4_ops [] =
+{
+  /* t4 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamOptimize_t4, f1), (3u << 16u) + 4u /* n4 */,
+  DDS_OP_RTS,
+
+  /* n4 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_n4, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (CdrStreamOptimize_n4, f2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL bfb4cad585bb1bd11b45ffe8a2bb] (#deps: 1)
+   - [MINIMAL b9fc410ddc15b2a89d3fc51ffbec]
+  [COMPLETE 1fcbd3cd4e60e1c54f262f860f2d] (#deps: 1)
+   - [COMPLETE 3f99e347aa9afb9bbdd30f7e205c]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t4 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xbf, 0xb4, 0xca, 0xd5, 0x85, 0xbb, 0x1b, 0xd1, 0x1b, 0x45, 0xff, \
+  0xe8, 0xa2, 0xbb, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xb9, 0xfc, 0x41, 0x0d, 0xdc, 0x15, 0xb2, \
+  0xa8, 0x9d, 0x3f, 0xc5, 0x1f, 0xfb, 0xec, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x1f, 0xcb, 0xd3, \
+  0xcd, 0x4e, 0x60, 0xe1, 0xc5, 0x4f, 0x26, 0x2f, 0x86, 0x0f, 0x2d, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x3f, 0x99, 0xe3, 0x47, 0xaa, 0x9a, 0xfb, 0x9b, 0xbd, 0xd3, 0x0f, 0x7e, 0x20, 0x5c, 0x00, \
+  0x61, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t4 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t4 (unsigned char []){ \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xbf, 0xb4, 0xca, 0xd5, 0x85, 0xbb, 0x1b, \
+  0xd1, 0x1b, 0x45, 0xff, 0xe8, 0xa2, 0xbb, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xb9, 0xfc, 0x41, 0x0d, 0xdc, \
+  0x15, 0xb2, 0xa8, 0x9d, 0x3f, 0xc5, 0x1f, 0xfb, 0xec, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xb9, 0xfc, \
+  0x41, 0x0d, 0xdc, 0x15, 0xb2, 0xa8, 0x9d, 0x3f, 0xc5, 0x1f, 0xfb, 0xec, 0x33, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x36, \
+  0x67, 0xf6, 0xa0, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x1f, 0xcb, 0xd3, \
+  0xcd, 0x4e, 0x60, 0xe1, 0xc5, 0x4f, 0x26, 0x2f, 0x86, 0x0f, 0x2d, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x74, 0x34, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x3f, 0x99, 0xe3, 0x47, 0xaa, \
+  0x9a, 0xfb, 0x9b, 0xbd, 0xd3, 0x0f, 0x7e, 0x20, 0x5c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x99, 0xe3, 0x47, 0xaa, 0x9a, 0xfb, 0x9b, 0xbd, 0xd3, \
+  0x0f, 0x7e, 0x20, 0x5c, 0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, 0x34, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x1f, 0xcb, 0xd3, 0xcd, 0x4e, 0x60, 0xe1, 0xc5, 0x4f, 0x26, 0x2f, 0x86, 0x0f, 0x2d, 0xf1, \
+  0xbf, 0xb4, 0xca, 0xd5, 0x85, 0xbb, 0x1b, 0xd1, 0x1b, 0x45, 0xff, 0xe8, 0xa2, 0xbb, 0xf2, 0x3f, \
+  0x99, 0xe3, 0x47, 0xaa, 0x9a, 0xfb, 0x9b, 0xbd, 0xd3, 0x0f, 0x7e, 0x20, 0x5c, 0xf1, 0xb9, 0xfc, \
+  0x41, 0x0d, 0xdc, 0x15, 0xb2, 0xa8, 0x9d, 0x3f, 0xc5, 0x1f, 0xfb, 0xec\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t4 444u
+const dds_topic_descriptor_t CdrStreamOptimize_t4_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t4),
+  .m_align = dds_alignof (CdrStreamOptimize_t4),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t4",
+  .m_keys = NULL,
+  .m_nops = 5,
+  .m_ops = CdrStreamOptimize_t4_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t4, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t4 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t4, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t4 }
+};
+
+static const uint32_t CdrStreamOptimize_t4a_ops [] =
+{
+  /* t4a */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamOptimize_t4a, f1), (3u << 16u) + 7u /* n4 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamOptimize_t4a, f2), (3u << 16u) + 4u /* n4 */,
+  DDS_OP_RTS,
+
+  /* n4 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_n4, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (CdrStreamOptimize_n4, f2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 755e54f903b21d2c83128e36bd52] (#deps: 1)
+   - [MINIMAL b9fc410ddc15b2a89d3fc51ffbec]
+  [COMPLETE 7c48a4cdbd0b44219000ea73dd33] (#deps: 1)
+   - [COMPLETE 3f99e347aa9afb9bbdd30f7e205c]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t4a (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x75, 0x5e, 0x54, 0xf9, 0x03, 0xb2, 0x1d, 0x2c, 0x83, 0x12, 0x8e, \
+  0x36, 0xbd, 0x52, 0x00, 0x55, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xb9, 0xfc, 0x41, 0x0d, 0xdc, 0x15, 0xb2, \
+  0xa8, 0x9d, 0x3f, 0xc5, 0x1f, 0xfb, 0xec, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x7c, 0x48, 0xa4, \
+  0xcd, 0xbd, 0x0b, 0x44, 0x21, 0x90, 0x00, 0xea, 0x73, 0xdd, 0x33, 0x00, 0x81, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x3f, 0x99, 0xe3, 0x47, 0xaa, 0x9a, 0xfb, 0x9b, 0xbd, 0xd3, 0x0f, 0x7e, 0x20, 0x5c, 0x00, \
+  0x61, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t4a 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t4a (unsigned char []){ \
+  0xaf, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x75, 0x5e, 0x54, 0xf9, 0x03, 0xb2, 0x1d, \
+  0x2c, 0x83, 0x12, 0x8e, 0x36, 0xbd, 0x52, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xb9, 0xfc, 0x41, 0x0d, 0xdc, \
+  0x15, 0xb2, 0xa8, 0x9d, 0x3f, 0xc5, 0x1f, 0xfb, 0xec, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xb9, 0xfc, 0x41, 0x0d, 0xdc, \
+  0x15, 0xb2, 0xa8, 0x9d, 0x3f, 0xc5, 0x1f, 0xfb, 0xec, 0x36, 0x67, 0xf6, 0xa0, 0xf1, 0xb9, 0xfc, \
+  0x41, 0x0d, 0xdc, 0x15, 0xb2, 0xa8, 0x9d, 0x3f, 0xc5, 0x1f, 0xfb, 0xec, 0x33, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x36, \
+  0x67, 0xf6, 0xa0, 0x00, 0x05, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x7c, 0x48, 0xa4, \
+  0xcd, 0xbd, 0x0b, 0x44, 0x21, 0x90, 0x00, 0xea, 0x73, 0xdd, 0x33, 0x00, 0x7d, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x74, 0x34, 0x61, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x3f, 0x99, 0xe3, 0x47, 0xaa, \
+  0x9a, 0xfb, 0x9b, 0xbd, 0xd3, 0x0f, 0x7e, 0x20, 0x5c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x3f, 0x99, 0xe3, 0x47, 0xaa, 0x9a, 0xfb, 0x9b, 0xbd, 0xd3, 0x0f, 0x7e, 0x20, \
+  0x5c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x99, \
+  0xe3, 0x47, 0xaa, 0x9a, 0xfb, 0x9b, 0xbd, 0xd3, 0x0f, 0x7e, 0x20, 0x5c, 0x5d, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x09, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x6e, 0x34, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x7c, 0x48, 0xa4, 0xcd, 0xbd, 0x0b, 0x44, \
+  0x21, 0x90, 0x00, 0xea, 0x73, 0xdd, 0x33, 0xf1, 0x75, 0x5e, 0x54, 0xf9, 0x03, 0xb2, 0x1d, 0x2c, \
+  0x83, 0x12, 0x8e, 0x36, 0xbd, 0x52, 0xf2, 0x3f, 0x99, 0xe3, 0x47, 0xaa, 0x9a, 0xfb, 0x9b, 0xbd, \
+  0xd3, 0x0f, 0x7e, 0x20, 0x5c, 0xf1, 0xb9, 0xfc, 0x41, 0x0d, 0xdc, 0x15, 0xb2, 0xa8, 0x9d, 0x3f, \
+  0xc5, 0x1f, 0xfb, 0xec\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t4a 516u
+const dds_topic_descriptor_t CdrStreamOptimize_t4a_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t4a),
+  .m_align = dds_alignof (CdrStreamOptimize_t4a),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t4a",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = CdrStreamOptimize_t4a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t4a, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t4a },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t4a, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t4a }
+};
+
+static const uint32_t CdrStreamOptimize_t4b_ops [] =
+{
+  /* t4b */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamOptimize_t4b, f1), (3u << 16u) + 7u /* t4a */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamOptimize_t4b, f2), (3u << 16u) + 4u /* t4a */,
+  DDS_OP_RTS,
+
+  /* t4a */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamOptimize_t4a, f1), (3u << 16u) + 7u /* n4 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamOptimize_t4a, f2), (3u << 16u) + 4u /* n4 */,
+  DDS_OP_RTS,
+
+  /* n4 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_n4, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (CdrStreamOptimize_n4, f2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 0faafa29c0f174100a36e8546e6a] (#deps: 2)
+   - [MINIMAL 755e54f903b21d2c83128e36bd52]
+   - [MINIMAL b9fc410ddc15b2a89d3fc51ffbec]
+  [COMPLETE 0e3b1ca526a35333e2ed1232683c] (#deps: 2)
+   - [COMPLETE 7c48a4cdbd0b44219000ea73dd33]
+   - [COMPLETE 3f99e347aa9afb9bbdd30f7e205c]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t4b (unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x0f, 0xaa, 0xfa, 0x29, 0xc0, 0xf1, 0x74, 0x10, 0x0a, 0x36, 0xe8, \
+  0x54, 0x6e, 0x6a, 0x00, 0x55, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x75, 0x5e, 0x54, 0xf9, 0x03, 0xb2, 0x1d, \
+  0x2c, 0x83, 0x12, 0x8e, 0x36, 0xbd, 0x52, 0x00, 0x55, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xb9, 0xfc, 0x41, 0x0d, 0xdc, 0x15, 0xb2, 0xa8, 0x9d, 0x3f, 0xc5, 0x1f, 0xfb, 0xec, 0x00, \
+  0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x0e, 0x3b, 0x1c, 0xa5, 0x26, 0xa3, 0x53, 0x33, 0xe2, 0xed, 0x12, \
+  0x32, 0x68, 0x3c, 0x00, 0x81, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x7c, 0x48, 0xa4, 0xcd, 0xbd, 0x0b, 0x44, \
+  0x21, 0x90, 0x00, 0xea, 0x73, 0xdd, 0x33, 0x00, 0x81, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x3f, 0x99, 0xe3, 0x47, 0xaa, 0x9a, 0xfb, 0x9b, 0xbd, 0xd3, 0x0f, 0x7e, 0x20, 0x5c, 0x00, \
+  0x61, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t4b 196u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t4b (unsigned char []){ \
+  0x13, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x0f, 0xaa, 0xfa, 0x29, 0xc0, 0xf1, 0x74, \
+  0x10, 0x0a, 0x36, 0xe8, 0x54, 0x6e, 0x6a, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x75, 0x5e, 0x54, 0xf9, 0x03, \
+  0xb2, 0x1d, 0x2c, 0x83, 0x12, 0x8e, 0x36, 0xbd, 0x52, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x75, 0x5e, 0x54, 0xf9, 0x03, \
+  0xb2, 0x1d, 0x2c, 0x83, 0x12, 0x8e, 0x36, 0xbd, 0x52, 0x36, 0x67, 0xf6, 0xa0, 0xf1, 0x75, 0x5e, \
+  0x54, 0xf9, 0x03, 0xb2, 0x1d, 0x2c, 0x83, 0x12, 0x8e, 0x36, 0xbd, 0x52, 0x51, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xb9, \
+  0xfc, 0x41, 0x0d, 0xdc, 0x15, 0xb2, 0xa8, 0x9d, 0x3f, 0xc5, 0x1f, 0xfb, 0xec, 0xbd, 0x19, 0x83, \
+  0x6d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xb9, \
+  0xfc, 0x41, 0x0d, 0xdc, 0x15, 0xb2, 0xa8, 0x9d, 0x3f, 0xc5, 0x1f, 0xfb, 0xec, 0x36, 0x67, 0xf6, \
+  0xa0, 0xf1, 0xb9, 0xfc, 0x41, 0x0d, 0xdc, 0x15, 0xb2, 0xa8, 0x9d, 0x3f, 0xc5, 0x1f, 0xfb, 0xec, \
+  0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x95, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0xf2, 0x0e, 0x3b, 0x1c, 0xa5, 0x26, 0xa3, 0x53, 0x33, 0xe2, 0xed, 0x12, 0x32, 0x68, 0x3c, 0x00, \
+  0x7d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, \
+  0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x34, 0x62, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x7c, \
+  0x48, 0xa4, 0xcd, 0xbd, 0x0b, 0x44, 0x21, 0x90, 0x00, 0xea, 0x73, 0xdd, 0x33, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x7c, 0x48, 0xa4, 0xcd, 0xbd, 0x0b, 0x44, 0x21, 0x90, \
+  0x00, 0xea, 0x73, 0xdd, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, \
+  0x00, 0xf2, 0x7c, 0x48, 0xa4, 0xcd, 0xbd, 0x0b, 0x44, 0x21, 0x90, 0x00, 0xea, 0x73, 0xdd, 0x33, \
+  0x7d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, \
+  0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x34, 0x61, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x3f, \
+  0x99, 0xe3, 0x47, 0xaa, 0x9a, 0xfb, 0x9b, 0xbd, 0xd3, 0x0f, 0x7e, 0x20, 0x5c, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x3f, 0x99, 0xe3, 0x47, 0xaa, 0x9a, 0xfb, 0x9b, 0xbd, \
+  0xd3, 0x0f, 0x7e, 0x20, 0x5c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, \
+  0x00, 0xf2, 0x3f, 0x99, 0xe3, 0x47, 0xaa, 0x9a, 0xfb, 0x9b, 0xbd, 0xd3, 0x0f, 0x7e, 0x20, 0x5c, \
+  0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, \
+  0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, 0x34, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0x0e, 0x3b, 0x1c, \
+  0xa5, 0x26, 0xa3, 0x53, 0x33, 0xe2, 0xed, 0x12, 0x32, 0x68, 0x3c, 0xf1, 0x0f, 0xaa, 0xfa, 0x29, \
+  0xc0, 0xf1, 0x74, 0x10, 0x0a, 0x36, 0xe8, 0x54, 0x6e, 0x6a, 0xf2, 0x7c, 0x48, 0xa4, 0xcd, 0xbd, \
+  0x0b, 0x44, 0x21, 0x90, 0x00, 0xea, 0x73, 0xdd, 0x33, 0xf1, 0x75, 0x5e, 0x54, 0xf9, 0x03, 0xb2, \
+  0x1d, 0x2c, 0x83, 0x12, 0x8e, 0x36, 0xbd, 0x52, 0xf2, 0x3f, 0x99, 0xe3, 0x47, 0xaa, 0x9a, 0xfb, \
+  0x9b, 0xbd, 0xd3, 0x0f, 0x7e, 0x20, 0x5c, 0xf1, 0xb9, 0xfc, 0x41, 0x0d, 0xdc, 0x15, 0xb2, 0xa8, \
+  0x9d, 0x3f, 0xc5, 0x1f, 0xfb, 0xec\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t4b 790u
+const dds_topic_descriptor_t CdrStreamOptimize_t4b_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t4b),
+  .m_align = dds_alignof (CdrStreamOptimize_t4b),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t4b",
+  .m_keys = NULL,
+  .m_nops = 9,
+  .m_ops = CdrStreamOptimize_t4b_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t4b, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t4b },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t4b, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t4b }
+};
+
+static const uint32_t CdrStreamOptimize_t5_ops [] =
+{
+  /* t5 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamOptimize_t5, f1), (3u << 16u) + 4u /* n5 */,
+  DDS_OP_RTS,
+
+  /* n5 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (CdrStreamOptimize_n5, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_n5, f2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 58c00f5089f9658c638d9f8aa2e8] (#deps: 1)
+   - [MINIMAL d4ddcf12126025ec682dc9158587]
+  [COMPLETE 1945fdf48e5b2dc57d3e4f502a7a] (#deps: 1)
+   - [COMPLETE 3f4ede8d2fd13dc2070df6b49610]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t5 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x58, 0xc0, 0x0f, 0x50, 0x89, 0xf9, 0x65, 0x8c, 0x63, 0x8d, 0x9f, \
+  0x8a, 0xa2, 0xe8, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xd4, 0xdd, 0xcf, 0x12, 0x12, 0x60, 0x25, \
+  0xec, 0x68, 0x2d, 0xc9, 0x15, 0x85, 0x87, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x19, 0x45, 0xfd, \
+  0xf4, 0x8e, 0x5b, 0x2d, 0xc5, 0x7d, 0x3e, 0x4f, 0x50, 0x2a, 0x7a, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x3f, 0x4e, 0xde, 0x8d, 0x2f, 0xd1, 0x3d, 0xc2, 0x07, 0x0d, 0xf6, 0xb4, 0x96, 0x10, 0x00, \
+  0x61, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t5 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t5 (unsigned char []){ \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x58, 0xc0, 0x0f, 0x50, 0x89, 0xf9, 0x65, \
+  0x8c, 0x63, 0x8d, 0x9f, 0x8a, 0xa2, 0xe8, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xd4, 0xdd, 0xcf, 0x12, 0x12, \
+  0x60, 0x25, 0xec, 0x68, 0x2d, 0xc9, 0x15, 0x85, 0x87, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xd4, 0xdd, \
+  0xcf, 0x12, 0x12, 0x60, 0x25, 0xec, 0x68, 0x2d, 0xc9, 0x15, 0x85, 0x87, 0x33, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xbd, \
+  0x19, 0x83, 0x6d, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x36, \
+  0x67, 0xf6, 0xa0, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x19, 0x45, 0xfd, \
+  0xf4, 0x8e, 0x5b, 0x2d, 0xc5, 0x7d, 0x3e, 0x4f, 0x50, 0x2a, 0x7a, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x74, 0x35, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x3f, 0x4e, 0xde, 0x8d, 0x2f, \
+  0xd1, 0x3d, 0xc2, 0x07, 0x0d, 0xf6, 0xb4, 0x96, 0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x4e, 0xde, 0x8d, 0x2f, 0xd1, 0x3d, 0xc2, 0x07, 0x0d, \
+  0xf6, 0xb4, 0x96, 0x10, 0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, 0x35, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x19, 0x45, 0xfd, 0xf4, 0x8e, 0x5b, 0x2d, 0xc5, 0x7d, 0x3e, 0x4f, 0x50, 0x2a, 0x7a, 0xf1, \
+  0x58, 0xc0, 0x0f, 0x50, 0x89, 0xf9, 0x65, 0x8c, 0x63, 0x8d, 0x9f, 0x8a, 0xa2, 0xe8, 0xf2, 0x3f, \
+  0x4e, 0xde, 0x8d, 0x2f, 0xd1, 0x3d, 0xc2, 0x07, 0x0d, 0xf6, 0xb4, 0x96, 0x10, 0xf1, 0xd4, 0xdd, \
+  0xcf, 0x12, 0x12, 0x60, 0x25, 0xec, 0x68, 0x2d, 0xc9, 0x15, 0x85, 0x87\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t5 444u
+const dds_topic_descriptor_t CdrStreamOptimize_t5_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t5),
+  .m_align = dds_alignof (CdrStreamOptimize_t5),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t5",
+  .m_keys = NULL,
+  .m_nops = 5,
+  .m_ops = CdrStreamOptimize_t5_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t5, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t5 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t5, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t5 }
+};
+
+static const uint32_t CdrStreamOptimize_t5a_ops [] =
+{
+  /* t5a */
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_STU, offsetof (CdrStreamOptimize_t5a, f1), 3u, (5u << 16u) + 6u /* n5 */, sizeof (CdrStreamOptimize_n5),
+  DDS_OP_RTS,
+
+  /* n5 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (CdrStreamOptimize_n5, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_n5, f2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 462c1c3c67cfb362ab68bd91f92b] (#deps: 1)
+   - [MINIMAL d4ddcf12126025ec682dc9158587]
+  [COMPLETE 22f7471c556482fa21c684e742cb] (#deps: 1)
+   - [COMPLETE 3f4ede8d2fd13dc2070df6b49610]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t5a (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x46, 0x2c, 0x1c, 0x3c, 0x67, 0xcf, 0xb3, 0x62, 0xab, 0x68, 0xbd, \
+  0x91, 0xf9, 0x2b, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xd4, 0xdd, 0xcf, 0x12, 0x12, 0x60, 0x25, \
+  0xec, 0x68, 0x2d, 0xc9, 0x15, 0x85, 0x87, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x22, 0xf7, 0x47, \
+  0x1c, 0x55, 0x64, 0x82, 0xfa, 0x21, 0xc6, 0x84, 0xe7, 0x42, 0xcb, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x3f, 0x4e, 0xde, 0x8d, 0x2f, 0xd1, 0x3d, 0xc2, 0x07, 0x0d, 0xf6, 0xb4, 0x96, 0x10, 0x00, \
+  0x61, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t5a 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t5a (unsigned char []){ \
+  0x9b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x46, 0x2c, 0x1c, 0x3c, 0x67, 0xcf, 0xb3, \
+  0x62, 0xab, 0x68, 0xbd, 0x91, 0xf9, 0x2b, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0xf1, 0xd4, 0xdd, 0xcf, 0x12, 0x12, 0x60, 0x25, 0xec, 0x68, 0x2d, \
+  0xc9, 0x15, 0x85, 0x87, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xd4, 0xdd, 0xcf, 0x12, 0x12, 0x60, 0x25, \
+  0xec, 0x68, 0x2d, 0xc9, 0x15, 0x85, 0x87, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x36, 0x67, 0xf6, 0xa0, 0x00, \
+  0xe5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x22, 0xf7, 0x47, 0x1c, 0x55, 0x64, 0x82, \
+  0xfa, 0x21, 0xc6, 0x84, 0xe7, 0x42, 0xcb, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, \
+  0x35, 0x61, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x03, 0xf2, 0x3f, 0x4e, 0xde, 0x8d, 0x2f, 0xd1, 0x3d, 0xc2, 0x07, 0x0d, 0xf6, 0xb4, 0x96, 0x10, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x3f, 0x4e, 0xde, 0x8d, 0x2f, 0xd1, \
+  0x3d, 0xc2, 0x07, 0x0d, 0xf6, 0xb4, 0x96, 0x10, 0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, \
+  0x35, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x22, 0xf7, 0x47, 0x1c, 0x55, 0x64, 0x82, 0xfa, 0x21, 0xc6, 0x84, \
+  0xe7, 0x42, 0xcb, 0xf1, 0x46, 0x2c, 0x1c, 0x3c, 0x67, 0xcf, 0xb3, 0x62, 0xab, 0x68, 0xbd, 0x91, \
+  0xf9, 0x2b, 0xf2, 0x3f, 0x4e, 0xde, 0x8d, 0x2f, 0xd1, 0x3d, 0xc2, 0x07, 0x0d, 0xf6, 0xb4, 0x96, \
+  0x10, 0xf1, 0xd4, 0xdd, 0xcf, 0x12, 0x12, 0x60, 0x25, 0xec, 0x68, 0x2d, 0xc9, 0x15, 0x85, 0x87\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t5a 464u
+const dds_topic_descriptor_t CdrStreamOptimize_t5a_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t5a),
+  .m_align = dds_alignof (CdrStreamOptimize_t5a),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t5a",
+  .m_keys = NULL,
+  .m_nops = 5,
+  .m_ops = CdrStreamOptimize_t5a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t5a, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t5a },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t5a, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t5a }
+};
+
+static const uint32_t CdrStreamOptimize_t6_ops [] =
+{
+  /* t6 */
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (CdrStreamOptimize_t6, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamOptimize_t6, f2), 1u,
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (CdrStreamOptimize_t6, f3),
+  DDS_OP_ADR | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_t6, f5),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_t6, f6),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL b091ff11aa649c73e31474b2f3cf] (#deps: 1)
+   - [MINIMAL 22dd3359d8da53b0e65744209d33]
+  [COMPLETE b59a5b8a27d3936f0183a6ccd5f3] (#deps: 1)
+   - [COMPLETE 1341eccf9e85413fc4c3ef71a562]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t6 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xb0, 0x91, 0xff, 0x11, 0xaa, 0x64, 0x9c, 0x73, 0xe3, 0x14, 0x74, \
+  0xb2, 0xf3, 0xcf, 0x00, 0x77, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x22, 0xdd, 0x33, 0x59, 0xd8, 0xda, 0x53, \
+  0xb0, 0xe6, 0x57, 0x44, 0x20, 0x9d, 0x33, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xb5, 0x9a, 0x5b, \
+  0x8a, 0x27, 0xd3, 0x93, 0x6f, 0x01, 0x83, 0xa6, 0xcc, 0xd5, 0xf3, 0x00, 0xb9, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x13, 0x41, 0xec, 0xcf, 0x9e, 0x85, 0x41, 0x3f, 0xc4, 0xc3, 0xef, 0x71, 0xa5, 0x62, 0x00, \
+  0x6b, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t6 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t6 (unsigned char []){ \
+  0xda, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xb0, 0x91, 0xff, 0x11, 0xaa, 0x64, 0x9c, \
+  0x73, 0xe3, 0x14, 0x74, 0xb2, 0xf3, 0xcf, 0x00, 0x73, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x22, 0xdd, 0x33, 0x59, 0xd8, \
+  0xda, 0x53, 0xb0, 0xe6, 0x57, 0x44, 0x20, 0x9d, 0x33, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x17, 0x79, 0xcf, 0x3a, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x74, 0xce, 0x2e, 0x1a, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x64, 0xe4, 0xcd, 0xa1, 0xf1, \
+  0x22, 0xdd, 0x33, 0x59, 0xd8, 0xda, 0x53, 0xb0, 0xe6, 0x57, 0x44, 0x20, 0x9d, 0x33, 0x00, 0x00, \
+  0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x42, 0xe6, 0xf8, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x1f, 0x3f, 0x37, 0x00, 0x00, \
+  0x47, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xb5, 0x9a, 0x5b, 0x8a, 0x27, 0xd3, 0x93, \
+  0x6f, 0x01, 0x83, 0xa6, 0xcc, 0xd5, 0xf3, 0x00, 0xb5, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, \
+  0x36, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x13, \
+  0x41, 0xec, 0xcf, 0x9e, 0x85, 0x41, 0x3f, 0xc4, 0xc3, 0xef, 0x71, 0xa5, 0x62, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x36, 0x00, 0x00, \
+  0x00, 0xf2, 0x13, 0x41, 0xec, 0xcf, 0x9e, 0x85, 0x41, 0x3f, 0xc4, 0xc3, 0xef, 0x71, 0xa5, 0x62, \
+  0x67, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, \
+  0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x65, 0x6e, 0x36, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x45, 0x36, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x45, 0x36, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0xb5, 0x9a, 0x5b, 0x8a, 0x27, 0xd3, 0x93, 0x6f, 0x01, 0x83, 0xa6, \
+  0xcc, 0xd5, 0xf3, 0xf1, 0xb0, 0x91, 0xff, 0x11, 0xaa, 0x64, 0x9c, 0x73, 0xe3, 0x14, 0x74, 0xb2, \
+  0xf3, 0xcf, 0xf2, 0x13, 0x41, 0xec, 0xcf, 0x9e, 0x85, 0x41, 0x3f, 0xc4, 0xc3, 0xef, 0x71, 0xa5, \
+  0x62, 0xf1, 0x22, 0xdd, 0x33, 0x59, 0xd8, 0xda, 0x53, 0xb0, 0xe6, 0x57, 0x44, 0x20, 0x9d, 0x33\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t6 624u
+const dds_topic_descriptor_t CdrStreamOptimize_t6_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t6),
+  .m_align = dds_alignof (CdrStreamOptimize_t6),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t6",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = CdrStreamOptimize_t6_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t6, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t6 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t6, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t6 }
+};
+
+static const uint32_t CdrStreamOptimize_t7_ops [] =
+{
+  /* t7 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (CdrStreamOptimize_t7, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamOptimize_t7, f2), (3u << 16u) + 6u /* n7 */,
+  DDS_OP_ADR | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_t7, f3),
+  DDS_OP_RTS,
+
+  /* n7 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (CdrStreamOptimize_n7, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_n7, f2),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 866f9acb306f126cfb7eca655607] (#deps: 1)
+   - [MINIMAL 65ebb50754eea637dadfa3f64161]
+  [COMPLETE 21e458c5cc95f57a2abe0822175b] (#deps: 1)
+   - [COMPLETE 1284572e6b0f99e07a2f2808c881]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t7 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x86, 0x6f, 0x9a, 0xcb, 0x30, 0x6f, 0x12, 0x6c, 0xfb, 0x7e, 0xca, \
+  0x65, 0x56, 0x07, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x65, 0xeb, 0xb5, 0x07, 0x54, 0xee, 0xa6, \
+  0x37, 0xda, 0xdf, 0xa3, 0xf6, 0x41, 0x61, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x21, 0xe4, 0x58, \
+  0xc5, 0xcc, 0x95, 0xf5, 0x7a, 0x2a, 0xbe, 0x08, 0x22, 0x17, 0x5b, 0x00, 0x89, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x12, 0x84, 0x57, 0x2e, 0x6b, 0x0f, 0x99, 0xe0, 0x7a, 0x2f, 0x28, 0x08, 0xc8, 0x81, 0x00, \
+  0x61, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t7 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t7 (unsigned char []){ \
+  0xb3, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x86, 0x6f, 0x9a, 0xcb, 0x30, 0x6f, 0x12, \
+  0x6c, 0xfb, 0x7e, 0xca, 0x65, 0x56, 0x07, 0x00, 0x53, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x65, 0xeb, 0xb5, 0x07, 0x54, \
+  0xee, 0xa6, 0x37, 0xda, 0xdf, 0xa3, 0xf6, 0x41, 0x61, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x17, 0x79, 0xcf, 0x3a, 0xf1, \
+  0x65, 0xeb, 0xb5, 0x07, 0x54, 0xee, 0xa6, 0x37, 0xda, 0xdf, 0xa3, 0xf6, 0x41, 0x61, 0x00, 0x00, \
+  0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x03, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x21, 0xe4, 0x58, 0xc5, 0xcc, 0x95, 0xf5, 0x7a, 0x2a, 0xbe, 0x08, 0x22, 0x17, 0x5b, 0x00, \
+  0x85, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, \
+  0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x37, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x12, 0x84, 0x57, 0x2e, 0x6b, 0x0f, 0x99, 0xe0, 0x7a, \
+  0x2f, 0x28, 0x08, 0xc8, 0x81, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, 0x00, 0xf2, 0x12, 0x84, 0x57, 0x2e, 0x6b, 0x0f, \
+  0x99, 0xe0, 0x7a, 0x2f, 0x28, 0x08, 0xc8, 0x81, 0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, \
+  0x37, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x21, 0xe4, 0x58, 0xc5, 0xcc, 0x95, 0xf5, 0x7a, 0x2a, 0xbe, 0x08, \
+  0x22, 0x17, 0x5b, 0xf1, 0x86, 0x6f, 0x9a, 0xcb, 0x30, 0x6f, 0x12, 0x6c, 0xfb, 0x7e, 0xca, 0x65, \
+  0x56, 0x07, 0xf2, 0x12, 0x84, 0x57, 0x2e, 0x6b, 0x0f, 0x99, 0xe0, 0x7a, 0x2f, 0x28, 0x08, 0xc8, \
+  0x81, 0xf1, 0x65, 0xeb, 0xb5, 0x07, 0x54, 0xee, 0xa6, 0x37, 0xda, 0xdf, 0xa3, 0xf6, 0x41, 0x61\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t7 528u
+const dds_topic_descriptor_t CdrStreamOptimize_t7_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t7),
+  .m_align = dds_alignof (CdrStreamOptimize_t7),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t7",
+  .m_keys = NULL,
+  .m_nops = 7,
+  .m_ops = CdrStreamOptimize_t7_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t7, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t7 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t7, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t7 }
+};
+
+static const uint32_t CdrStreamOptimize_t8_ops [] =
+{
+  /* t8 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_t8, f1),
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamOptimize_t8, f2), (3u << 16u) + 4u /* n8 */,
+  DDS_OP_RTS,
+
+  /* n8 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_n8, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 66e7f816c1555150fcb60967f7ae] (#deps: 1)
+   - [MINIMAL b855136ea3827541c1d3c120d191]
+  [COMPLETE 6a3847bee719cdf6ec3aee4dbc02] (#deps: 1)
+   - [COMPLETE 074f7465e2161f7a7cf0257ba925]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t8 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x66, 0xe7, 0xf8, 0x16, 0xc1, 0x55, 0x51, 0x50, 0xfc, 0xb6, 0x09, \
+  0x67, 0xf7, 0xae, 0x00, 0x45, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xb8, 0x55, 0x13, 0x6e, 0xa3, 0x82, 0x75, \
+  0x41, 0xc1, 0xd3, 0xc1, 0x20, 0xd1, 0x91, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x6a, 0x38, 0x47, \
+  0xbe, 0xe7, 0x19, 0xcd, 0xf6, 0xec, 0x3a, 0xee, 0x4d, 0xbc, 0x02, 0x00, 0x71, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x07, 0x4f, 0x74, 0x65, 0xe2, 0x16, 0x1f, 0x7a, 0x7c, 0xf0, 0x25, 0x7b, 0xa9, 0x25, 0x00, \
+  0x49, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t8 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t8 (unsigned char []){ \
+  0x8f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x66, 0xe7, 0xf8, 0x16, 0xc1, 0x55, 0x51, \
+  0x50, 0xfc, 0xb6, 0x09, 0x67, 0xf7, 0xae, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xb8, 0x55, 0x13, 0x6e, 0xa3, \
+  0x82, 0x75, 0x41, 0xc1, 0xd3, 0xc1, 0x20, 0xd1, 0x91, 0x36, 0x67, 0xf6, 0xa0, 0xf1, 0xb8, 0x55, \
+  0x13, 0x6e, 0xa3, 0x82, 0x75, 0x41, 0xc1, 0xd3, 0xc1, 0x20, 0xd1, 0x91, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x6a, 0x38, 0x47, \
+  0xbe, 0xe7, 0x19, 0xcd, 0xf6, 0xec, 0x3a, 0xee, 0x4d, 0xbc, 0x02, 0x00, 0x6d, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x74, 0x38, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x07, 0x4f, 0x74, 0x65, 0xe2, 0x16, 0x1f, 0x7a, 0x7c, 0xf0, 0x25, 0x7b, 0xa9, \
+  0x25, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x07, 0x4f, \
+  0x74, 0x65, 0xe2, 0x16, 0x1f, 0x7a, 0x7c, 0xf0, 0x25, 0x7b, 0xa9, 0x25, 0x45, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x0a, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x6e, 0x38, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x6a, 0x38, 0x47, 0xbe, 0xe7, 0x19, 0xcd, 0xf6, 0xec, 0x3a, 0xee, 0x4d, 0xbc, 0x02, 0xf1, \
+  0x66, 0xe7, 0xf8, 0x16, 0xc1, 0x55, 0x51, 0x50, 0xfc, 0xb6, 0x09, 0x67, 0xf7, 0xae, 0xf2, 0x07, \
+  0x4f, 0x74, 0x65, 0xe2, 0x16, 0x1f, 0x7a, 0x7c, 0xf0, 0x25, 0x7b, 0xa9, 0x25, 0xf1, 0xb8, 0x55, \
+  0x13, 0x6e, 0xa3, 0x82, 0x75, 0x41, 0xc1, 0xd3, 0xc1, 0x20, 0xd1, 0x91\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t8 444u
+const dds_topic_descriptor_t CdrStreamOptimize_t8_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t8),
+  .m_align = dds_alignof (CdrStreamOptimize_t8),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t8",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = CdrStreamOptimize_t8_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t8, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t8 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t8, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t8 }
+};
+
+static const uint32_t CdrStreamOptimize_t9_ops [] =
+{
+  /* t9 */
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BMK | (0 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamOptimize_t9, f1), 3u, 0u, 7u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 7795c1599873a80a46a9cfb9bd95] (#deps: 1)
+   - [MINIMAL 2be3738261da6186e46fc0f4f151]
+  [COMPLETE 2af0dc54e964354f6caa59633954] (#deps: 1)
+   - [COMPLETE 5858a587d9e1f491971fda7a3887]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t9 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x77, 0x95, 0xc1, 0x59, 0x98, 0x73, 0xa8, 0x0a, 0x46, 0xa9, 0xcf, \
+  0xb9, 0xbd, 0x95, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x2b, 0xe3, 0x73, 0x82, 0x61, 0xda, 0x61, \
+  0x86, 0xe4, 0x6f, 0xc0, 0xf4, 0xf1, 0x51, 0x00, 0x44, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x2a, 0xf0, 0xdc, \
+  0x54, 0xe9, 0x64, 0x35, 0x4f, 0x6c, 0xaa, 0x59, 0x63, 0x39, 0x54, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x58, 0x58, 0xa5, 0x87, 0xd9, 0xe1, 0xf4, 0x91, 0x97, 0x1f, 0xda, 0x7a, 0x38, 0x87, 0x00, \
+  0x77, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t9 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t9 (unsigned char []){ \
+  0xa8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x77, 0x95, 0xc1, 0x59, 0x98, 0x73, 0xa8, \
+  0x0a, 0x46, 0xa9, 0xcf, 0xb9, 0xbd, 0x95, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0xf1, 0x2b, 0xe3, 0x73, 0x82, 0x61, 0xda, 0x61, 0x86, 0xe4, 0x6f, \
+  0xc0, 0xf4, 0xf1, 0x51, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x2b, 0xe3, 0x73, 0x82, 0x61, 0xda, 0x61, \
+  0x86, 0xe4, 0x6f, 0xc0, 0xf4, 0xf1, 0x51, 0x00, 0x40, 0x00, 0x00, 0x00, 0xf1, 0x41, 0x00, 0x00, \
+  0x38, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0xc9, 0x04, 0x9c, 0xba, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa8, 0xe9, 0x9c, 0x99, \
+  0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x56, 0x4a, 0x9e, 0xee, 0xfb, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x2a, 0xf0, 0xdc, 0x54, 0xe9, 0x64, 0x35, 0x4f, 0x6c, 0xaa, 0x59, \
+  0x63, 0x39, 0x54, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x39, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xf2, 0x58, 0x58, \
+  0xa5, 0x87, 0xd9, 0xe1, 0xf4, 0x91, 0x97, 0x1f, 0xda, 0x7a, 0x38, 0x87, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x58, 0x58, 0xa5, 0x87, 0xd9, 0xe1, 0xf4, 0x91, 0x97, 0x1f, \
+  0xda, 0x7a, 0x38, 0x87, 0x73, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x62, 0x6d, 0x39, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x42, 0x39, 0x5f, 0x31, \
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x42, 0x39, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x42, 0x39, 0x5f, 0x33, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x2a, 0xf0, 0xdc, 0x54, 0xe9, 0x64, 0x35, 0x4f, 0x6c, 0xaa, 0x59, \
+  0x63, 0x39, 0x54, 0xf1, 0x77, 0x95, 0xc1, 0x59, 0x98, 0x73, 0xa8, 0x0a, 0x46, 0xa9, 0xcf, 0xb9, \
+  0xbd, 0x95, 0xf2, 0x58, 0x58, 0xa5, 0x87, 0xd9, 0xe1, 0xf4, 0x91, 0x97, 0x1f, 0xda, 0x7a, 0x38, \
+  0x87, 0xf1, 0x2b, 0xe3, 0x73, 0x82, 0x61, 0xda, 0x61, 0x86, 0xe4, 0x6f, 0xc0, 0xf4, 0xf1, 0x51\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t9 496u
+const dds_topic_descriptor_t CdrStreamOptimize_t9_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t9),
+  .m_align = dds_alignof (CdrStreamOptimize_t9),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t9",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamOptimize_t9_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t9, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t9 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t9, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t9 }
+};
+
+static const uint32_t CdrStreamOptimize_t10_ops [] =
+{
+  /* t10 */
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamOptimize_t10, f1), 3u, 1u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 85dd830d28ec7098714a06ccfecf] (#deps: 1)
+   - [MINIMAL 4e3f36517263ba7d4f868d9a6c6b]
+  [COMPLETE fbfd3c964e69948caef49755d958] (#deps: 1)
+   - [COMPLETE 8c733b0ec70cffb528ef4733b74e]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t10 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x85, 0xdd, 0x83, 0x0d, 0x28, 0xec, 0x70, 0x98, 0x71, 0x4a, 0x06, \
+  0xcc, 0xfe, 0xcf, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x4e, 0x3f, 0x36, 0x51, 0x72, 0x63, 0xba, \
+  0x7d, 0x4f, 0x86, 0x8d, 0x9a, 0x6c, 0x6b, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xfb, 0xfd, 0x3c, \
+  0x96, 0x4e, 0x69, 0x94, 0x8c, 0xae, 0xf4, 0x97, 0x55, 0xd9, 0x58, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x8c, 0x73, 0x3b, 0x0e, 0xc7, 0x0c, 0xff, 0xb5, 0x28, 0xef, 0x47, 0x33, 0xb7, 0x4e, 0x00, \
+  0x6c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t10 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t10 (unsigned char []){ \
+  0xa2, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x85, 0xdd, 0x83, 0x0d, 0x28, 0xec, 0x70, \
+  0x98, 0x71, 0x4a, 0x06, 0xcc, 0xfe, 0xcf, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0xf1, 0x4e, 0x3f, 0x36, 0x51, 0x72, 0x63, 0xba, 0x7d, 0x4f, 0x86, \
+  0x8d, 0x9a, 0x6c, 0x6b, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x4e, 0x3f, 0x36, 0x51, 0x72, 0x63, 0xba, \
+  0x7d, 0x4f, 0x86, 0x8d, 0x9a, 0x6c, 0x6b, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x7d, \
+  0x3a, 0x3f, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x2c, 0x1d, 0x4f, 0x55, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0xfb, 0xfd, 0x3c, 0x96, 0x4e, 0x69, 0x94, 0x8c, 0xae, 0xf4, 0x97, 0x55, 0xd9, 0x58, 0x00, \
+  0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, \
+  0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x31, 0x30, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0xf2, 0x8c, 0x73, 0x3b, 0x0e, 0xc7, 0x0c, \
+  0xff, 0xb5, 0x28, 0xef, 0x47, 0x33, 0xb7, 0x4e, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0xf2, 0x8c, 0x73, 0x3b, 0x0e, 0xc7, 0x0c, 0xff, 0xb5, 0x28, 0xef, 0x47, 0x33, 0xb7, 0x4e, \
+  0x68, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, \
+  0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x65, 0x6e, 0x31, 0x30, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x45, 0x31, 0x30, 0x5f, 0x31, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x45, 0x31, 0x30, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0xfb, 0xfd, 0x3c, 0x96, 0x4e, 0x69, 0x94, 0x8c, 0xae, 0xf4, 0x97, \
+  0x55, 0xd9, 0x58, 0xf1, 0x85, 0xdd, 0x83, 0x0d, 0x28, 0xec, 0x70, 0x98, 0x71, 0x4a, 0x06, 0xcc, \
+  0xfe, 0xcf, 0xf2, 0x8c, 0x73, 0x3b, 0x0e, 0xc7, 0x0c, 0xff, 0xb5, 0x28, 0xef, 0x47, 0x33, 0xb7, \
+  0x4e, 0xf1, 0x4e, 0x3f, 0x36, 0x51, 0x72, 0x63, 0xba, 0x7d, 0x4f, 0x86, 0x8d, 0x9a, 0x6c, 0x6b\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t10 480u
+const dds_topic_descriptor_t CdrStreamOptimize_t10_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t10),
+  .m_align = dds_alignof (CdrStreamOptimize_t10),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t10",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamOptimize_t10_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t10, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t10 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t10, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t10 }
+};
+
+static const uint32_t CdrStreamOptimize_t11_ops [] =
+{
+  /* t11 */
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_t11, f1), 100u,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_t11, f2),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_FP, offsetof (CdrStreamOptimize_t11, f3),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_t11, f4),
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (CdrStreamOptimize_t11, f5),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 929c48f2c1a9969ee643242e61e4] (#deps: 0)
+  [COMPLETE efda8f8491a88978afa3c2a3b38b] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t11 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x92, 0x9c, 0x48, 0xf2, 0xc1, 0xa9, 0x96, 0x9e, 0xe6, 0x43, 0x24, \
+  0x2e, 0x61, 0xe4, 0x00, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xef, 0xda, 0x8f, 0x84, 0x91, 0xa8, 0x89, 0x78, 0xaf, 0xa3, 0xc2, \
+  0xa3, 0xb3, 0x8b, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t11 100u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t11 (unsigned char []){ \
+  0x87, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x92, 0x9c, 0x48, 0xf2, 0xc1, 0xa9, 0x96, \
+  0x9e, 0xe6, 0x43, 0x24, 0x2e, 0x61, 0xe4, 0x00, 0x6f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x64, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x36, 0x67, 0xf6, 0xa0, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x17, 0x79, 0xcf, 0x3a, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x6e, 0x1f, 0xcd, 0x70, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x74, 0xce, 0x2e, 0x1a, 0x00, 0xc9, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xef, 0xda, 0x8f, 0x84, 0x91, 0xa8, 0x89, 0x78, 0xaf, 0xa3, 0xc2, \
+  0xa3, 0xb3, 0x8b, 0x00, 0xb1, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x31, 0x31, 0x00, 0x00, \
+  0x85, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x64, 0x04, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x34, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xef, 0xda, 0x8f, 0x84, 0x91, 0xa8, 0x89, 0x78, 0xaf, 0xa3, 0xc2, \
+  0xa3, 0xb3, 0x8b, 0xf1, 0x92, 0x9c, 0x48, 0xf2, 0xc1, 0xa9, 0x96, 0x9e, 0xe6, 0x43, 0x24, 0x2e, \
+  0x61, 0xe4\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t11 386u
+const dds_topic_descriptor_t CdrStreamOptimize_t11_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t11),
+  .m_align = dds_alignof (CdrStreamOptimize_t11),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t11",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = CdrStreamOptimize_t11_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t11, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t11 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t11, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t11 }
+};
+
+static const uint32_t CdrStreamOptimize_t12_ops [] =
+{
+  /* t12 */
+  DDS_OP_ADR | DDS_OP_TYPE_BMK | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamOptimize_t12, f1), 0u, 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 8b52e59bd5cf8a23ac034255abf1] (#deps: 1)
+   - [MINIMAL 6c342bdb444fe1dbc5969a2e0e18]
+  [COMPLETE e2c63d7ab26c3c4bef971be88a7d] (#deps: 1)
+   - [COMPLETE a495b792fd94ac711c94752b2fe9]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t12 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8b, 0x52, 0xe5, 0x9b, 0xd5, 0xcf, 0x8a, 0x23, 0xac, 0x03, 0x42, \
+  0x55, 0xab, 0xf1, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x6c, 0x34, 0x2b, 0xdb, 0x44, 0x4f, 0xe1, \
+  0xdb, 0xc5, 0x96, 0x9a, 0x2e, 0x0e, 0x18, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xe2, 0xc6, 0x3d, \
+  0x7a, 0xb2, 0x6c, 0x3c, 0x4b, 0xef, 0x97, 0x1b, 0xe8, 0x8a, 0x7d, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xa4, 0x95, 0xb7, 0x92, 0xfd, 0x94, 0xac, 0x71, 0x1c, 0x94, 0x75, 0x2b, 0x2f, 0xe9, 0x00, \
+  0x69, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t12 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t12 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x8b, 0x52, 0xe5, 0x9b, 0xd5, 0xcf, 0x8a, \
+  0x23, 0xac, 0x03, 0x42, 0x55, 0xab, 0xf1, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x6c, 0x34, 0x2b, 0xdb, 0x44, \
+  0x4f, 0xe1, 0xdb, 0xc5, 0x96, 0x9a, 0x2e, 0x0e, 0x18, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x6c, 0x34, \
+  0x2b, 0xdb, 0x44, 0x4f, 0xe1, 0xdb, 0xc5, 0x96, 0x9a, 0x2e, 0x0e, 0x18, 0x34, 0x00, 0x00, 0x00, \
+  0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0xf6, 0x7d, 0xce, 0x74, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x40, 0x35, 0xfa, 0x2e, 0xe5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xe2, 0xc6, 0x3d, \
+  0x7a, 0xb2, 0x6c, 0x3c, 0x4b, 0xef, 0x97, 0x1b, 0xe8, 0x8a, 0x7d, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x74, 0x31, 0x32, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xa4, 0x95, 0xb7, 0x92, 0xfd, \
+  0x94, 0xac, 0x71, 0x1c, 0x94, 0x75, 0x2b, 0x2f, 0xe9, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xa4, 0x95, 0xb7, 0x92, 0xfd, 0x94, 0xac, 0x71, 0x1c, 0x94, \
+  0x75, 0x2b, 0x2f, 0xe9, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x62, 0x6d, 0x31, 0x32, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x32, \
+  0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x32, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xe2, 0xc6, 0x3d, 0x7a, 0xb2, 0x6c, 0x3c, \
+  0x4b, 0xef, 0x97, 0x1b, 0xe8, 0x8a, 0x7d, 0xf1, 0x8b, 0x52, 0xe5, 0x9b, 0xd5, 0xcf, 0x8a, 0x23, \
+  0xac, 0x03, 0x42, 0x55, 0xab, 0xf1, 0xf2, 0xa4, 0x95, 0xb7, 0x92, 0xfd, 0x94, 0xac, 0x71, 0x1c, \
+  0x94, 0x75, 0x2b, 0x2f, 0xe9, 0xf1, 0x6c, 0x34, 0x2b, 0xdb, 0x44, 0x4f, 0xe1, 0xdb, 0xc5, 0x96, \
+  0x9a, 0x2e, 0x0e, 0x18\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t12 452u
+const dds_topic_descriptor_t CdrStreamOptimize_t12_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t12),
+  .m_align = dds_alignof (CdrStreamOptimize_t12),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t12",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamOptimize_t12_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t12, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t12 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t12, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t12 }
+};
+
+static const uint32_t CdrStreamOptimize_t13_ops [] =
+{
+  /* t13 */
+  DDS_OP_ADR | DDS_OP_TYPE_BMK | (0 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamOptimize_t13, f1), 0u, 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 16e3ab17764ea0b40f75a895c078] (#deps: 1)
+   - [MINIMAL 8c50634390091b206c022e4410ec]
+  [COMPLETE d19975fda13d008e5627a0106ff3] (#deps: 1)
+   - [COMPLETE 2350d88d387628ff651243661901]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t13 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x16, 0xe3, 0xab, 0x17, 0x76, 0x4e, 0xa0, 0xb4, 0x0f, 0x75, 0xa8, \
+  0x95, 0xc0, 0x78, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x8c, 0x50, 0x63, 0x43, 0x90, 0x09, 0x1b, \
+  0x20, 0x6c, 0x02, 0x2e, 0x44, 0x10, 0xec, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xd1, 0x99, 0x75, \
+  0xfd, 0xa1, 0x3d, 0x00, 0x8e, 0x56, 0x27, 0xa0, 0x10, 0x6f, 0xf3, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x23, 0x50, 0xd8, 0x8d, 0x38, 0x76, 0x28, 0xff, 0x65, 0x12, 0x43, 0x66, 0x19, 0x01, 0x00, \
+  0x69, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t13 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t13 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x16, 0xe3, 0xab, 0x17, 0x76, 0x4e, 0xa0, \
+  0xb4, 0x0f, 0x75, 0xa8, 0x95, 0xc0, 0x78, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x8c, 0x50, 0x63, 0x43, 0x90, \
+  0x09, 0x1b, 0x20, 0x6c, 0x02, 0x2e, 0x44, 0x10, 0xec, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x8c, 0x50, \
+  0x63, 0x43, 0x90, 0x09, 0x1b, 0x20, 0x6c, 0x02, 0x2e, 0x44, 0x10, 0xec, 0x34, 0x00, 0x00, 0x00, \
+  0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x71, 0x02, 0xf2, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x55, 0x25, 0xc6, 0x4c, 0xe5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xd1, 0x99, 0x75, \
+  0xfd, 0xa1, 0x3d, 0x00, 0x8e, 0x56, 0x27, 0xa0, 0x10, 0x6f, 0xf3, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x74, 0x31, 0x33, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x23, 0x50, 0xd8, 0x8d, 0x38, \
+  0x76, 0x28, 0xff, 0x65, 0x12, 0x43, 0x66, 0x19, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x23, 0x50, 0xd8, 0x8d, 0x38, 0x76, 0x28, 0xff, 0x65, 0x12, \
+  0x43, 0x66, 0x19, 0x01, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x62, 0x6d, 0x31, 0x33, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x33, \
+  0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x33, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xd1, 0x99, 0x75, 0xfd, 0xa1, 0x3d, 0x00, \
+  0x8e, 0x56, 0x27, 0xa0, 0x10, 0x6f, 0xf3, 0xf1, 0x16, 0xe3, 0xab, 0x17, 0x76, 0x4e, 0xa0, 0xb4, \
+  0x0f, 0x75, 0xa8, 0x95, 0xc0, 0x78, 0xf2, 0x23, 0x50, 0xd8, 0x8d, 0x38, 0x76, 0x28, 0xff, 0x65, \
+  0x12, 0x43, 0x66, 0x19, 0x01, 0xf1, 0x8c, 0x50, 0x63, 0x43, 0x90, 0x09, 0x1b, 0x20, 0x6c, 0x02, \
+  0x2e, 0x44, 0x10, 0xec\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t13 452u
+const dds_topic_descriptor_t CdrStreamOptimize_t13_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t13),
+  .m_align = dds_alignof (CdrStreamOptimize_t13),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t13",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamOptimize_t13_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t13, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t13 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t13, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t13 }
+};
+
+static const uint32_t CdrStreamOptimize_t14_ops [] =
+{
+  /* t14 */
+  DDS_OP_ADR | DDS_OP_TYPE_BMK | (3 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamOptimize_t14, f1), 0u, 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL dd23c5944ec73c06c0da07258dc8] (#deps: 1)
+   - [MINIMAL 91b68849f47ebfaada46f58be1b3]
+  [COMPLETE 7ed91df749451ab6c89b29b58ecf] (#deps: 1)
+   - [COMPLETE 6374eab4dc8beca00311f7140a75]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t14 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xdd, 0x23, 0xc5, 0x94, 0x4e, 0xc7, 0x3c, 0x06, 0xc0, 0xda, 0x07, \
+  0x25, 0x8d, 0xc8, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x91, 0xb6, 0x88, 0x49, 0xf4, 0x7e, 0xbf, \
+  0xaa, 0xda, 0x46, 0xf5, 0x8b, 0xe1, 0xb3, 0x00, 0x38, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x7e, 0xd9, 0x1d, \
+  0xf7, 0x49, 0x45, 0x1a, 0xb6, 0xc8, 0x9b, 0x29, 0xb5, 0x8e, 0xcf, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x63, 0x74, 0xea, 0xb4, 0xdc, 0x8b, 0xec, 0xa0, 0x03, 0x11, 0xf7, 0x14, 0x0a, 0x75, 0x00, \
+  0x69, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t14 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t14 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xdd, 0x23, 0xc5, 0x94, 0x4e, 0xc7, 0x3c, \
+  0x06, 0xc0, 0xda, 0x07, 0x25, 0x8d, 0xc8, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x91, 0xb6, 0x88, 0x49, 0xf4, \
+  0x7e, 0xbf, 0xaa, 0xda, 0x46, 0xf5, 0x8b, 0xe1, 0xb3, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x91, 0xb6, \
+  0x88, 0x49, 0xf4, 0x7e, 0xbf, 0xaa, 0xda, 0x46, 0xf5, 0x8b, 0xe1, 0xb3, 0x34, 0x00, 0x00, 0x00, \
+  0xf1, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0xe2, 0x60, 0x31, 0x2d, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x9f, 0xf3, 0xae, 0x0e, 0xe5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x7e, 0xd9, 0x1d, \
+  0xf7, 0x49, 0x45, 0x1a, 0xb6, 0xc8, 0x9b, 0x29, 0xb5, 0x8e, 0xcf, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x74, 0x31, 0x34, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x63, 0x74, 0xea, 0xb4, 0xdc, \
+  0x8b, 0xec, 0xa0, 0x03, 0x11, 0xf7, 0x14, 0x0a, 0x75, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x63, 0x74, 0xea, 0xb4, 0xdc, 0x8b, 0xec, 0xa0, 0x03, 0x11, \
+  0xf7, 0x14, 0x0a, 0x75, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x41, 0x00, 0x00, 0x5d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x62, 0x6d, 0x31, 0x34, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x34, \
+  0x5f, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x42, 0x4d, 0x31, 0x34, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x7e, 0xd9, 0x1d, 0xf7, 0x49, 0x45, 0x1a, \
+  0xb6, 0xc8, 0x9b, 0x29, 0xb5, 0x8e, 0xcf, 0xf1, 0xdd, 0x23, 0xc5, 0x94, 0x4e, 0xc7, 0x3c, 0x06, \
+  0xc0, 0xda, 0x07, 0x25, 0x8d, 0xc8, 0xf2, 0x63, 0x74, 0xea, 0xb4, 0xdc, 0x8b, 0xec, 0xa0, 0x03, \
+  0x11, 0xf7, 0x14, 0x0a, 0x75, 0xf1, 0x91, 0xb6, 0x88, 0x49, 0xf4, 0x7e, 0xbf, 0xaa, 0xda, 0x46, \
+  0xf5, 0x8b, 0xe1, 0xb3\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t14 452u
+const dds_topic_descriptor_t CdrStreamOptimize_t14_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t14),
+  .m_align = dds_alignof (CdrStreamOptimize_t14),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t14",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamOptimize_t14_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t14, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t14 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t14, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t14 }
+};
+
+static const uint32_t CdrStreamOptimize_t15_ops [] =
+{
+  /* t15 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamOptimize_t15, f1), (3u << 16u) + 4u /* n15_2 */,
+  DDS_OP_RTS,
+
+  /* n15_2 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamOptimize_n15_2, f2), (3u << 16u) + 4u /* n15_1 */,
+  DDS_OP_RTS,
+
+  /* n15_1 */
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_n15_1, f3), 100u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 3245c957de5288e3d035aa75d2d7] (#deps: 2)
+   - [MINIMAL cddf22845c59f550f1d3ad1d8cff]
+   - [MINIMAL 51bb64ed5483b2c971f10d79d557]
+  [COMPLETE 891396c704e4a7bc56c370cb9bc4] (#deps: 2)
+   - [COMPLETE 0ee3cf94a3bc237f447b15f74d8a]
+   - [COMPLETE 9fa278951cf3debfe2eff9f78420]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t15 (unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x32, 0x45, 0xc9, 0x57, 0xde, 0x52, 0x88, 0xe3, 0xd0, 0x35, 0xaa, \
+  0x75, 0xd2, 0xd7, 0x00, 0x35, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xcd, 0xdf, 0x22, 0x84, 0x5c, 0x59, 0xf5, \
+  0x50, 0xf1, 0xd3, 0xad, 0x1d, 0x8c, 0xff, 0x00, 0x35, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0xbb, 0x64, 0xed, 0x54, 0x83, 0xb2, 0xc9, 0x71, 0xf1, 0x0d, 0x79, 0xd5, 0x57, 0x00, \
+  0x32, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x89, 0x13, 0x96, 0xc7, 0x04, 0xe4, 0xa7, 0xbc, 0x56, 0xc3, 0x70, \
+  0xcb, 0x9b, 0xc4, 0x00, 0x59, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x0e, 0xe3, 0xcf, 0x94, 0xa3, 0xbc, 0x23, \
+  0x7f, 0x44, 0x7b, 0x15, 0xf7, 0x4d, 0x8a, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x9f, 0xa2, 0x78, 0x95, 0x1c, 0xf3, 0xde, 0xbf, 0xe2, 0xef, 0xf9, 0xf7, 0x84, 0x20, 0x00, \
+  0x59, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t15 196u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t15 (unsigned char []){ \
+  0xce, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x32, 0x45, 0xc9, 0x57, 0xde, 0x52, 0x88, \
+  0xe3, 0xd0, 0x35, 0xaa, 0x75, 0xd2, 0xd7, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xcd, 0xdf, 0x22, 0x84, 0x5c, \
+  0x59, 0xf5, 0x50, 0xf1, 0xd3, 0xad, 0x1d, 0x8c, 0xff, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xcd, 0xdf, \
+  0x22, 0x84, 0x5c, 0x59, 0xf5, 0x50, 0xf1, 0xd3, 0xad, 0x1d, 0x8c, 0xff, 0x31, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x51, \
+  0xbb, 0x64, 0xed, 0x54, 0x83, 0xb2, 0xc9, 0x71, 0xf1, 0x0d, 0x79, 0xd5, 0x57, 0x36, 0x67, 0xf6, \
+  0xa0, 0xf1, 0x51, 0xbb, 0x64, 0xed, 0x54, 0x83, 0xb2, 0xc9, 0x71, 0xf1, 0x0d, 0x79, 0xd5, 0x57, \
+  0x2e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x64, 0x10, 0x17, 0x79, \
+  0xcf, 0x3a, 0x00, 0x00, 0x41, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0x89, 0x13, 0x96, \
+  0xc7, 0x04, 0xe4, 0xa7, 0xbc, 0x56, 0xc3, 0x70, 0xcb, 0x9b, 0xc4, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x74, 0x31, 0x35, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x0e, 0xe3, 0xcf, 0x94, 0xa3, \
+  0xbc, 0x23, 0x7f, 0x44, 0x7b, 0x15, 0xf7, 0x4d, 0x8a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x0e, 0xe3, 0xcf, 0x94, 0xa3, 0xbc, 0x23, 0x7f, 0x44, 0x7b, \
+  0x15, 0xf7, 0x4d, 0x8a, 0x59, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, 0x31, 0x35, 0x5f, 0x32, \
+  0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x9f, 0xa2, 0x78, 0x95, 0x1c, 0xf3, 0xde, 0xbf, 0xe2, \
+  0xef, 0xf9, 0xf7, 0x84, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, \
+  0x00, 0xf2, 0x9f, 0xa2, 0x78, 0x95, 0x1c, 0xf3, 0xde, 0xbf, 0xe2, 0xef, 0xf9, 0xf7, 0x84, 0x20, \
+  0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, \
+  0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, 0x31, 0x35, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, \
+  0x25, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x64, 0x10, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0x89, 0x13, 0x96, 0xc7, 0x04, 0xe4, 0xa7, 0xbc, 0x56, 0xc3, 0x70, \
+  0xcb, 0x9b, 0xc4, 0xf1, 0x32, 0x45, 0xc9, 0x57, 0xde, 0x52, 0x88, 0xe3, 0xd0, 0x35, 0xaa, 0x75, \
+  0xd2, 0xd7, 0xf2, 0x0e, 0xe3, 0xcf, 0x94, 0xa3, 0xbc, 0x23, 0x7f, 0x44, 0x7b, 0x15, 0xf7, 0x4d, \
+  0x8a, 0xf1, 0xcd, 0xdf, 0x22, 0x84, 0x5c, 0x59, 0xf5, 0x50, 0xf1, 0xd3, 0xad, 0x1d, 0x8c, 0xff, \
+  0xf2, 0x9f, 0xa2, 0x78, 0x95, 0x1c, 0xf3, 0xde, 0xbf, 0xe2, 0xef, 0xf9, 0xf7, 0x84, 0x20, 0xf1, \
+  0x51, 0xbb, 0x64, 0xed, 0x54, 0x83, 0xb2, 0xc9, 0x71, 0xf1, 0x0d, 0x79, 0xd5, 0x57\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t15 638u
+const dds_topic_descriptor_t CdrStreamOptimize_t15_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t15),
+  .m_align = dds_alignof (CdrStreamOptimize_t15),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t15",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = CdrStreamOptimize_t15_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t15, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t15 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t15, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t15 }
+};
+
+static const uint32_t CdrStreamOptimize_t16_ops [] =
+{
+  /* t16 */
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (CdrStreamOptimize_t16, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL d312da0775747bc77f062064d85c] (#deps: 0)
+  [COMPLETE e91bf17a4fa359171106208210eb] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t16 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xd3, 0x12, 0xda, 0x07, 0x75, 0x74, 0x7b, 0xc7, 0x7f, 0x06, 0x20, \
+  0x64, 0xd8, 0x5c, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xe9, 0x1b, 0xf1, 0x7a, 0x4f, 0xa3, 0x59, 0x17, 0x11, 0x06, 0x20, \
+  0x82, 0x10, 0xeb, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t16 100u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t16 (unsigned char []){ \
+  0x3c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xd3, 0x12, 0xda, 0x07, 0x75, 0x74, 0x7b, \
+  0xc7, 0x7f, 0x06, 0x20, 0x64, 0xd8, 0x5c, 0x00, 0x24, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0xbd, 0x19, 0x83, 0x6d, \
+  0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xe9, 0x1b, 0xf1, 0x7a, 0x4f, 0xa3, 0x59, \
+  0x17, 0x11, 0x06, 0x20, 0x82, 0x10, 0xeb, 0x00, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, \
+  0x31, 0x36, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xe9, 0x1b, 0xf1, \
+  0x7a, 0x4f, 0xa3, 0x59, 0x17, 0x11, 0x06, 0x20, 0x82, 0x10, 0xeb, 0xf1, 0xd3, 0x12, 0xda, 0x07, \
+  0x75, 0x74, 0x7b, 0xc7, 0x7f, 0x06, 0x20, 0x64, 0xd8, 0x5c\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t16 202u
+const dds_topic_descriptor_t CdrStreamOptimize_t16_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t16),
+  .m_align = dds_alignof (CdrStreamOptimize_t16),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t16",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamOptimize_t16_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t16, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t16 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t16, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t16 }
+};
+
+static const uint32_t CdrStreamOptimize_t17_ops [] =
+{
+  /* t17 */
+  DDS_OP_ADR | DDS_OP_TYPE_BST, offsetof (CdrStreamOptimize_t17, f1), 101u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 6a209f06d150906cea015696d6e5] (#deps: 0)
+  [COMPLETE 2701e676c2df663d62a261f90077] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t17 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x6a, 0x20, 0x9f, 0x06, 0xd1, 0x50, 0x90, 0x6c, 0xea, 0x01, 0x56, \
+  0x96, 0xd6, 0xe5, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x27, 0x01, 0xe6, 0x76, 0xc2, 0xdf, 0x66, 0x3d, 0x62, 0xa2, 0x61, \
+  0xf9, 0x00, 0x77, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t17 100u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t17 (unsigned char []){ \
+  0x3c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x6a, 0x20, 0x9f, 0x06, 0xd1, 0x50, 0x90, \
+  0x6c, 0xea, 0x01, 0x56, 0x96, 0xd6, 0xe5, 0x00, 0x24, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x64, 0xbd, 0x19, 0x83, 0x6d, \
+  0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x27, 0x01, 0xe6, 0x76, 0xc2, 0xdf, 0x66, \
+  0x3d, 0x62, 0xa2, 0x61, 0xf9, 0x00, 0x77, 0x00, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, \
+  0x31, 0x37, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x64, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x27, 0x01, 0xe6, \
+  0x76, 0xc2, 0xdf, 0x66, 0x3d, 0x62, 0xa2, 0x61, 0xf9, 0x00, 0x77, 0xf1, 0x6a, 0x20, 0x9f, 0x06, \
+  0xd1, 0x50, 0x90, 0x6c, 0xea, 0x01, 0x56, 0x96, 0xd6, 0xe5\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t17 202u
+const dds_topic_descriptor_t CdrStreamOptimize_t17_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t17),
+  .m_align = dds_alignof (CdrStreamOptimize_t17),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t17",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamOptimize_t17_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t17, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t17 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t17, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t17 }
+};
+
+static const uint32_t CdrStreamOptimize_t18_ops [] =
+{
+  /* t18 */
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_t18, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 496bd415ff7e9c8371a9e454906a] (#deps: 0)
+  [COMPLETE 35e50d07490a4b1259f9e859a9bf] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t18 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x49, 0x6b, 0xd4, 0x15, 0xff, 0x7e, 0x9c, 0x83, 0x71, 0xa9, 0xe4, \
+  0x54, 0x90, 0x6a, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x35, 0xe5, 0x0d, 0x07, 0x49, 0x0a, 0x4b, 0x12, 0x59, 0xf9, 0xe8, \
+  0x59, 0xa9, 0xbf, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t18 100u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t18 (unsigned char []){ \
+  0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x49, 0x6b, 0xd4, 0x15, 0xff, 0x7e, 0x9c, \
+  0x83, 0x71, 0xa9, 0xe4, 0x54, 0x90, 0x6a, 0x00, 0x28, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, \
+  0xbd, 0x19, 0x83, 0x6d, 0x61, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x35, 0xe5, 0x0d, \
+  0x07, 0x49, 0x0a, 0x4b, 0x12, 0x59, 0xf9, 0xe8, 0x59, 0xa9, 0xbf, 0x00, 0x49, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x74, 0x31, 0x38, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x35, 0xe5, 0x0d, 0x07, 0x49, 0x0a, 0x4b, 0x12, 0x59, 0xf9, 0xe8, \
+  0x59, 0xa9, 0xbf, 0xf1, 0x49, 0x6b, 0xd4, 0x15, 0xff, 0x7e, 0x9c, 0x83, 0x71, 0xa9, 0xe4, 0x54, \
+  0x90, 0x6a\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t18 210u
+const dds_topic_descriptor_t CdrStreamOptimize_t18_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t18),
+  .m_align = dds_alignof (CdrStreamOptimize_t18),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t18",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamOptimize_t18_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t18, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t18 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t18, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t18 }
+};
+
+static const uint32_t CdrStreamOptimize_t19_ops [] =
+{
+  /* t19 */
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_t19, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 7c842a9f6488c0b49fad299b4c3b] (#deps: 0)
+  [COMPLETE eb4832034389b7db82901366f101] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t19 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x7c, 0x84, 0x2a, 0x9f, 0x64, 0x88, 0xc0, 0xb4, 0x9f, 0xad, 0x29, \
+  0x9b, 0x4c, 0x3b, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xeb, 0x48, 0x32, 0x03, 0x43, 0x89, 0xb7, 0xdb, 0x82, 0x90, 0x13, \
+  0x66, 0xf1, 0x01, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t19 100u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t19 (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x7c, 0x84, 0x2a, 0x9f, 0x64, 0x88, 0xc0, \
+  0xb4, 0x9f, 0xad, 0x29, 0x9b, 0x4c, 0x3b, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xeb, 0x48, 0x32, 0x03, 0x43, 0x89, 0xb7, \
+  0xdb, 0x82, 0x90, 0x13, 0x66, 0xf1, 0x01, 0x00, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, \
+  0x31, 0x39, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xeb, 0x48, 0x32, \
+  0x03, 0x43, 0x89, 0xb7, 0xdb, 0x82, 0x90, 0x13, 0x66, 0xf1, 0x01, 0xf1, 0x7c, 0x84, 0x2a, 0x9f, \
+  0x64, 0x88, 0xc0, 0xb4, 0x9f, 0xad, 0x29, 0x9b, 0x4c, 0x3b\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t19 202u
+const dds_topic_descriptor_t CdrStreamOptimize_t19_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t19),
+  .m_align = dds_alignof (CdrStreamOptimize_t19),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t19",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamOptimize_t19_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t19, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t19 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t19, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t19 }
+};
+
+static const uint32_t CdrStreamOptimize_t20_ops [] =
+{
+  /* t20 */
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_t20, f1), 100u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 7f90218e9a076d36e524b77773bc] (#deps: 0)
+  [COMPLETE 40bc1f04e9ea6d2922749c4cbf64] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t20 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x7f, 0x90, 0x21, 0x8e, 0x9a, 0x07, 0x6d, 0x36, 0xe5, 0x24, 0xb7, \
+  0x77, 0x73, 0xbc, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x40, 0xbc, 0x1f, 0x04, 0xe9, 0xea, 0x6d, 0x29, 0x22, 0x74, 0x9c, \
+  0x4c, 0xbf, 0x64, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t20 100u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t20 (unsigned char []){ \
+  0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x7f, 0x90, 0x21, 0x8e, 0x9a, 0x07, 0x6d, \
+  0x36, 0xe5, 0x24, 0xb7, 0x77, 0x73, 0xbc, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x64, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x40, 0xbc, 0x1f, 0x04, 0xe9, 0xea, 0x6d, 0x29, 0x22, 0x74, 0x9c, \
+  0x4c, 0xbf, 0x64, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x32, 0x30, 0x00, 0x00, \
+  0x25, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x64, 0x04, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x40, 0xbc, 0x1f, 0x04, 0xe9, 0xea, 0x6d, 0x29, 0x22, 0x74, 0x9c, \
+  0x4c, 0xbf, 0x64, 0xf1, 0x7f, 0x90, 0x21, 0x8e, 0x9a, 0x07, 0x6d, 0x36, 0xe5, 0x24, 0xb7, 0x77, \
+  0x73, 0xbc\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t20 226u
+const dds_topic_descriptor_t CdrStreamOptimize_t20_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t20),
+  .m_align = dds_alignof (CdrStreamOptimize_t20),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t20",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamOptimize_t20_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t20, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t20 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t20, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t20 }
+};
+
+static const uint32_t CdrStreamOptimize_t21_ops [] =
+{
+  /* t21 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (0 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamOptimize_t21, f1), 1u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 00dec80175d8938962612881c961] (#deps: 1)
+   - [MINIMAL 2823404a2197ebafe49eedc7e536]
+  [COMPLETE 68c576e526ef5689ab123971ab3f] (#deps: 1)
+   - [COMPLETE 19fdcddb8bc84def49a543d2caf1]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t21 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x00, 0xde, 0xc8, 0x01, 0x75, 0xd8, 0x93, 0x89, 0x62, 0x61, 0x28, \
+  0x81, 0xc9, 0x61, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x28, 0x23, 0x40, 0x4a, 0x21, 0x97, 0xeb, \
+  0xaf, 0xe4, 0x9e, 0xed, 0xc7, 0xe5, 0x36, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x68, 0xc5, 0x76, \
+  0xe5, 0x26, 0xef, 0x56, 0x89, 0xab, 0x12, 0x39, 0x71, 0xab, 0x3f, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x19, 0xfd, 0xcd, 0xdb, 0x8b, 0xc8, 0x4d, 0xef, 0x49, 0xa5, 0x43, 0xd2, 0xca, 0xf1, 0x00, \
+  0x6c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t21 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t21 (unsigned char []){ \
+  0x96, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x00, 0xde, 0xc8, 0x01, 0x75, 0xd8, 0x93, \
+  0x89, 0x62, 0x61, 0x28, 0x81, 0xc9, 0x61, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x28, 0x23, 0x40, 0x4a, 0x21, \
+  0x97, 0xeb, 0xaf, 0xe4, 0x9e, 0xed, 0xc7, 0xe5, 0x36, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x28, 0x23, \
+  0x40, 0x4a, 0x21, 0x97, 0xeb, 0xaf, 0xe4, 0x9e, 0xed, 0xc7, 0xe5, 0x36, 0x3a, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x3d, 0x7b, 0x30, 0x48, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x26, 0xca, 0xd8, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x68, 0xc5, 0x76, 0xe5, 0x26, 0xef, 0x56, 0x89, 0xab, 0x12, 0x39, \
+  0x71, 0xab, 0x3f, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x32, 0x31, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x19, 0xfd, 0xcd, 0xdb, 0x8b, 0xc8, 0x4d, 0xef, 0x49, 0xa5, 0x43, 0xd2, 0xca, \
+  0xf1, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x19, 0xfd, \
+  0xcd, 0xdb, 0x8b, 0xc8, 0x4d, 0xef, 0x49, 0xa5, 0x43, 0xd2, 0xca, 0xf1, 0x68, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x65, 0x6e, 0x32, 0x31, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x45, 0x32, 0x31, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x45, 0x32, 0x31, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x68, 0xc5, 0x76, 0xe5, 0x26, 0xef, 0x56, 0x89, 0xab, 0x12, 0x39, 0x71, 0xab, 0x3f, 0xf1, \
+  0x00, 0xde, 0xc8, 0x01, 0x75, 0xd8, 0x93, 0x89, 0x62, 0x61, 0x28, 0x81, 0xc9, 0x61, 0xf2, 0x19, \
+  0xfd, 0xcd, 0xdb, 0x8b, 0xc8, 0x4d, 0xef, 0x49, 0xa5, 0x43, 0xd2, 0xca, 0xf1, 0xf1, 0x28, 0x23, \
+  0x40, 0x4a, 0x21, 0x97, 0xeb, 0xaf, 0xe4, 0x9e, 0xed, 0xc7, 0xe5, 0x36\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t21 460u
+const dds_topic_descriptor_t CdrStreamOptimize_t21_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t21),
+  .m_align = dds_alignof (CdrStreamOptimize_t21),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t21",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamOptimize_t21_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t21, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t21 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t21, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t21 }
+};
+
+static const uint32_t CdrStreamOptimize_t22_ops [] =
+{
+  /* t22 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (1 << DDS_OP_FLAG_SZ_SHIFT), offsetof (CdrStreamOptimize_t22, f1), 1u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 8f107052165da4232f4853b7af5a] (#deps: 1)
+   - [MINIMAL afa8291fe505be961082d35f80a6]
+  [COMPLETE 81f0e83d373260292848e000e621] (#deps: 1)
+   - [COMPLETE 7dd1b41162bf88eff0138bbe32d0]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t22 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8f, 0x10, 0x70, 0x52, 0x16, 0x5d, 0xa4, 0x23, 0x2f, 0x48, 0x53, \
+  0xb7, 0xaf, 0x5a, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xaf, 0xa8, 0x29, 0x1f, 0xe5, 0x05, 0xbe, \
+  0x96, 0x10, 0x82, 0xd3, 0x5f, 0x80, 0xa6, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x81, 0xf0, 0xe8, \
+  0x3d, 0x37, 0x32, 0x60, 0x29, 0x28, 0x48, 0xe0, 0x00, 0xe6, 0x21, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x7d, 0xd1, 0xb4, 0x11, 0x62, 0xbf, 0x88, 0xef, 0xf0, 0x13, 0x8b, 0xbe, 0x32, 0xd0, 0x00, \
+  0x6c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t22 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t22 (unsigned char []){ \
+  0x96, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x8f, 0x10, 0x70, 0x52, 0x16, 0x5d, 0xa4, \
+  0x23, 0x2f, 0x48, 0x53, 0xb7, 0xaf, 0x5a, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xaf, 0xa8, 0x29, 0x1f, 0xe5, \
+  0x05, 0xbe, 0x96, 0x10, 0x82, 0xd3, 0x5f, 0x80, 0xa6, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xaf, 0xa8, \
+  0x29, 0x1f, 0xe5, 0x05, 0xbe, 0x96, 0x10, 0x82, 0xd3, 0x5f, 0x80, 0xa6, 0x3a, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x82, 0xef, 0xc6, 0x8b, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x7c, 0x00, 0x00, 0xe8, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x81, 0xf0, 0xe8, 0x3d, 0x37, 0x32, 0x60, 0x29, 0x28, 0x48, 0xe0, \
+  0x00, 0xe6, 0x21, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x32, 0x32, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x7d, 0xd1, 0xb4, 0x11, 0x62, 0xbf, 0x88, 0xef, 0xf0, 0x13, 0x8b, 0xbe, 0x32, \
+  0xd0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x7d, 0xd1, \
+  0xb4, 0x11, 0x62, 0xbf, 0x88, 0xef, 0xf0, 0x13, 0x8b, 0xbe, 0x32, 0xd0, 0x68, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x01, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x65, 0x6e, 0x32, 0x32, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x45, 0x32, 0x32, 0x5f, 0x30, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x45, 0x32, 0x32, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x81, 0xf0, 0xe8, 0x3d, 0x37, 0x32, 0x60, 0x29, 0x28, 0x48, 0xe0, 0x00, 0xe6, 0x21, 0xf1, \
+  0x8f, 0x10, 0x70, 0x52, 0x16, 0x5d, 0xa4, 0x23, 0x2f, 0x48, 0x53, 0xb7, 0xaf, 0x5a, 0xf2, 0x7d, \
+  0xd1, 0xb4, 0x11, 0x62, 0xbf, 0x88, 0xef, 0xf0, 0x13, 0x8b, 0xbe, 0x32, 0xd0, 0xf1, 0xaf, 0xa8, \
+  0x29, 0x1f, 0xe5, 0x05, 0xbe, 0x96, 0x10, 0x82, 0xd3, 0x5f, 0x80, 0xa6\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t22 460u
+const dds_topic_descriptor_t CdrStreamOptimize_t22_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t22),
+  .m_align = dds_alignof (CdrStreamOptimize_t22),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t22",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = CdrStreamOptimize_t22_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t22, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t22 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t22, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t22 }
+};
+
+static const uint32_t CdrStreamOptimize_t23_ops [] =
+{
+  /* t23 */
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_EXT, offsetof (CdrStreamOptimize_t23, f1), (4u << 16u) + 5u /* n23 */, sizeof (CdrStreamOptimize_n23),
+  DDS_OP_RTS,
+
+  /* n23 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_n23, s1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 63feebe72f82091c23487f51e29b] (#deps: 1)
+   - [MINIMAL 9585cfce53e75f6b25330449f3f0]
+  [COMPLETE ea5aa7d6f660c8a366b14751120a] (#deps: 1)
+   - [COMPLETE 9bae0708051ce86b91955608f09a]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t23 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x63, 0xfe, 0xeb, 0xe7, 0x2f, 0x82, 0x09, 0x1c, 0x23, 0x48, 0x7f, \
+  0x51, 0xe2, 0x9b, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x95, 0x85, 0xcf, 0xce, 0x53, 0xe7, 0x5f, \
+  0x6b, 0x25, 0x33, 0x04, 0x49, 0xf3, 0xf0, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xea, 0x5a, 0xa7, \
+  0xd6, 0xf6, 0x60, 0xc8, 0xa3, 0x66, 0xb1, 0x47, 0x51, 0x12, 0x0a, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x9b, 0xae, 0x07, 0x08, 0x05, 0x1c, 0xe8, 0x6b, 0x91, 0x95, 0x56, 0x08, 0xf0, 0x9a, 0x00, \
+  0x49, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t23 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t23 (unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x63, 0xfe, 0xeb, 0xe7, 0x2f, 0x82, 0x09, \
+  0x1c, 0x23, 0x48, 0x7f, 0x51, 0xe2, 0x9b, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf1, 0x95, 0x85, 0xcf, 0xce, 0x53, \
+  0xe7, 0x5f, 0x6b, 0x25, 0x33, 0x04, 0x49, 0xf3, 0xf0, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x95, 0x85, \
+  0xcf, 0xce, 0x53, 0xe7, 0x5f, 0x6b, 0x25, 0x33, 0x04, 0x49, 0xf3, 0xf0, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x8d, \
+  0xdf, 0x87, 0x80, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xea, 0x5a, 0xa7, \
+  0xd6, 0xf6, 0x60, 0xc8, 0xa3, 0x66, 0xb1, 0x47, 0x51, 0x12, 0x0a, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x74, 0x32, 0x33, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xf2, 0x9b, 0xae, 0x07, 0x08, 0x05, \
+  0x1c, 0xe8, 0x6b, 0x91, 0x95, 0x56, 0x08, 0xf0, 0x9a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x9b, 0xae, 0x07, 0x08, 0x05, 0x1c, 0xe8, 0x6b, 0x91, 0x95, \
+  0x56, 0x08, 0xf0, 0x9a, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, 0x32, 0x33, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xea, 0x5a, 0xa7, 0xd6, 0xf6, 0x60, 0xc8, \
+  0xa3, 0x66, 0xb1, 0x47, 0x51, 0x12, 0x0a, 0xf1, 0x63, 0xfe, 0xeb, 0xe7, 0x2f, 0x82, 0x09, 0x1c, \
+  0x23, 0x48, 0x7f, 0x51, 0xe2, 0x9b, 0xf2, 0x9b, 0xae, 0x07, 0x08, 0x05, 0x1c, 0xe8, 0x6b, 0x91, \
+  0x95, 0x56, 0x08, 0xf0, 0x9a, 0xf1, 0x95, 0x85, 0xcf, 0xce, 0x53, 0xe7, 0x5f, 0x6b, 0x25, 0x33, \
+  0x04, 0x49, 0xf3, 0xf0\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t23 404u
+const dds_topic_descriptor_t CdrStreamOptimize_t23_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t23),
+  .m_align = dds_alignof (CdrStreamOptimize_t23),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t23",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = CdrStreamOptimize_t23_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t23, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t23 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t23, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t23 }
+};
+
+static const uint32_t CdrStreamOptimize_t24_ops [] =
+{
+  /* t24 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamOptimize_t24, f1), (3u << 16u) + 4u /* n24 */,
+  DDS_OP_RTS,
+
+  /* n24 */
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_n24, s1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 59d6e941926766bfecedefe7f05d] (#deps: 1)
+   - [MINIMAL 8565fcb3e120eef2c479d05bb424]
+  [COMPLETE e2331ca2726feaef0b36c32f9e0b] (#deps: 1)
+   - [COMPLETE 8a35df56ae4f0d0a532b53a8e4b6]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t24 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x59, 0xd6, 0xe9, 0x41, 0x92, 0x67, 0x66, 0xbf, 0xec, 0xed, 0xef, \
+  0xe7, 0xf0, 0x5d, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x85, 0x65, 0xfc, 0xb3, 0xe1, 0x20, 0xee, \
+  0xf2, 0xc4, 0x79, 0xd0, 0x5b, 0xb4, 0x24, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xe2, 0x33, 0x1c, \
+  0xa2, 0x72, 0x6f, 0xea, 0xef, 0x0b, 0x36, 0xc3, 0x2f, 0x9e, 0x0b, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x8a, 0x35, 0xdf, 0x56, 0xae, 0x4f, 0x0d, 0x0a, 0x53, 0x2b, 0x53, 0xa8, 0xe4, 0xb6, 0x00, \
+  0x49, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t24 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t24 (unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x59, 0xd6, 0xe9, 0x41, 0x92, 0x67, 0x66, \
+  0xbf, 0xec, 0xed, 0xef, 0xe7, 0xf0, 0x5d, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x85, 0x65, 0xfc, 0xb3, 0xe1, \
+  0x20, 0xee, 0xf2, 0xc4, 0x79, 0xd0, 0x5b, 0xb4, 0x24, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x85, 0x65, \
+  0xfc, 0xb3, 0xe1, 0x20, 0xee, 0xf2, 0xc4, 0x79, 0xd0, 0x5b, 0xb4, 0x24, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x8d, \
+  0xdf, 0x87, 0x80, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xe2, 0x33, 0x1c, \
+  0xa2, 0x72, 0x6f, 0xea, 0xef, 0x0b, 0x36, 0xc3, 0x2f, 0x9e, 0x0b, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x74, 0x32, 0x34, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8a, 0x35, 0xdf, 0x56, 0xae, \
+  0x4f, 0x0d, 0x0a, 0x53, 0x2b, 0x53, 0xa8, 0xe4, 0xb6, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x8a, 0x35, 0xdf, 0x56, 0xae, 0x4f, 0x0d, 0x0a, 0x53, 0x2b, \
+  0x53, 0xa8, 0xe4, 0xb6, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x6e, 0x32, 0x34, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xe2, 0x33, 0x1c, 0xa2, 0x72, 0x6f, 0xea, \
+  0xef, 0x0b, 0x36, 0xc3, 0x2f, 0x9e, 0x0b, 0xf1, 0x59, 0xd6, 0xe9, 0x41, 0x92, 0x67, 0x66, 0xbf, \
+  0xec, 0xed, 0xef, 0xe7, 0xf0, 0x5d, 0xf2, 0x8a, 0x35, 0xdf, 0x56, 0xae, 0x4f, 0x0d, 0x0a, 0x53, \
+  0x2b, 0x53, 0xa8, 0xe4, 0xb6, 0xf1, 0x85, 0x65, 0xfc, 0xb3, 0xe1, 0x20, 0xee, 0xf2, 0xc4, 0x79, \
+  0xd0, 0x5b, 0xb4, 0x24\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t24 404u
+const dds_topic_descriptor_t CdrStreamOptimize_t24_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t24),
+  .m_align = dds_alignof (CdrStreamOptimize_t24),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t24",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = CdrStreamOptimize_t24_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t24, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t24 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t24, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t24 }
+};
+
+static const uint32_t CdrStreamOptimize_t25_ops [] =
+{
+  /* t25 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_2BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_t25, _d), 1u, (8u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 1, offsetof (CdrStreamOptimize_t25, _u.f1), 0u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL c6498fad0c2ed28b4f96783ee1f6] (#deps: 0)
+  [COMPLETE 13736ae43229da4b02dc2fb93b23] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t25 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xc6, 0x49, 0x8f, 0xad, 0x0c, 0x2e, 0xd2, 0x8b, 0x4f, 0x96, 0x78, \
+  0x3e, 0xe1, 0xf6, 0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x13, 0x73, 0x6a, 0xe4, 0x32, 0x29, 0xda, 0x4b, 0x02, 0xdc, 0x2f, \
+  0xb9, 0x3b, 0x23, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t25 100u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t25 (unsigned char []){ \
+  0x48, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xc6, 0x49, 0x8f, 0xad, 0x0c, 0x2e, 0xd2, \
+  0x8b, 0x4f, 0x96, 0x78, 0x3e, 0xe1, 0xf6, 0x00, 0x30, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x03, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xbd, 0x19, 0x83, 0x6d, 0x71, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x13, 0x73, 0x6a, 0xe4, 0x32, 0x29, 0xda, 0x4b, 0x02, 0xdc, 0x2f, \
+  0xb9, 0x3b, 0x23, 0x00, 0x59, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, 0x32, 0x35, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x13, 0x73, 0x6a, \
+  0xe4, 0x32, 0x29, 0xda, 0x4b, 0x02, 0xdc, 0x2f, 0xb9, 0x3b, 0x23, 0xf1, 0xc6, 0x49, 0x8f, 0xad, \
+  0x0c, 0x2e, 0xd2, 0x8b, 0x4f, 0x96, 0x78, 0x3e, 0xe1, 0xf6\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t25 234u
+const dds_topic_descriptor_t CdrStreamOptimize_t25_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t25),
+  .m_align = dds_alignof (CdrStreamOptimize_t25),
+  .m_flagset = DDS_TOPIC_CONTAINS_UNION | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t25",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = CdrStreamOptimize_t25_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t25, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t25 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t25, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t25 }
+};
+
+static const uint32_t CdrStreamOptimize_t26_ops [] =
+{
+  /* t26 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (CdrStreamOptimize_t26, f1), (3u << 16u) + 4u /* u26 */,
+  DDS_OP_RTS,
+
+  /* u26 */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_2BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_u26, _d), 1u, (8u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 1, offsetof (CdrStreamOptimize_u26, _u.u1), 0u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 948aaeb4ee281ffcd7ceb3038346] (#deps: 1)
+   - [MINIMAL 3f5003f90b1d0b1d694faf49489e]
+  [COMPLETE de971e9174ff12a87af6144b003e] (#deps: 1)
+   - [COMPLETE 50c1f5962007aebdd71e05da6c13]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t26 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x94, 0x8a, 0xae, 0xb4, 0xee, 0x28, 0x1f, 0xfc, 0xd7, 0xce, 0xb3, \
+  0x03, 0x83, 0x46, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x3f, 0x50, 0x03, 0xf9, 0x0b, 0x1d, 0x0b, \
+  0x1d, 0x69, 0x4f, 0xaf, 0x49, 0x48, 0x9e, 0x00, 0x34, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xde, 0x97, 0x1e, \
+  0x91, 0x74, 0xff, 0x12, 0xa8, 0x7a, 0xf6, 0x14, 0x4b, 0x00, 0x3e, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x50, 0xc1, 0xf5, 0x96, 0x20, 0x07, 0xae, 0xbd, 0xd7, 0x1e, 0x05, 0xda, 0x6c, 0x13, 0x00, \
+  0x5d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t26 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t26 (unsigned char []){ \
+  0x8c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x94, 0x8a, 0xae, 0xb4, 0xee, 0x28, 0x1f, \
+  0xfc, 0xd7, 0xce, 0xb3, 0x03, 0x83, 0x46, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x3f, 0x50, 0x03, 0xf9, 0x0b, \
+  0x1d, 0x0b, 0x1d, 0x69, 0x4f, 0xaf, 0x49, 0x48, 0x9e, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x3f, 0x50, \
+  0x03, 0xf9, 0x0b, 0x1d, 0x0b, 0x1d, 0x69, 0x4f, 0xaf, 0x49, 0x48, 0x9e, 0x30, 0x00, 0x00, 0x00, \
+  0xf1, 0x52, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x03, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe4, 0x77, 0x4c, 0xdd, \
+  0xd9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xde, 0x97, 0x1e, 0x91, 0x74, 0xff, 0x12, \
+  0xa8, 0x7a, 0xf6, 0x14, 0x4b, 0x00, 0x3e, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, \
+  0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x74, \
+  0x32, 0x36, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x50, 0xc1, 0xf5, 0x96, 0x20, 0x07, 0xae, 0xbd, 0xd7, \
+  0x1e, 0x05, 0xda, 0x6c, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0xf2, 0x50, 0xc1, 0xf5, 0x96, 0x20, 0x07, 0xae, 0xbd, 0xd7, 0x1e, 0x05, 0xda, 0x6c, 0x13, \
+  0x59, 0x00, 0x00, 0x00, 0xf2, 0x52, 0x09, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, \
+  0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x75, 0x32, 0x36, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xde, 0x97, 0x1e, 0x91, 0x74, 0xff, 0x12, \
+  0xa8, 0x7a, 0xf6, 0x14, 0x4b, 0x00, 0x3e, 0xf1, 0x94, 0x8a, 0xae, 0xb4, 0xee, 0x28, 0x1f, 0xfc, \
+  0xd7, 0xce, 0xb3, 0x03, 0x83, 0x46, 0xf2, 0x50, 0xc1, 0xf5, 0x96, 0x20, 0x07, 0xae, 0xbd, 0xd7, \
+  0x1e, 0x05, 0xda, 0x6c, 0x13, 0xf1, 0x3f, 0x50, 0x03, 0xf9, 0x0b, 0x1d, 0x0b, 0x1d, 0x69, 0x4f, \
+  0xaf, 0x49, 0x48, 0x9e\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t26 436u
+const dds_topic_descriptor_t CdrStreamOptimize_t26_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t26),
+  .m_align = dds_alignof (CdrStreamOptimize_t26),
+  .m_flagset = DDS_TOPIC_CONTAINS_UNION | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t26",
+  .m_keys = NULL,
+  .m_nops = 5,
+  .m_ops = CdrStreamOptimize_t26_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t26, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t26 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t26, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t26 }
+};
+
+static const uint32_t CdrStreamOptimize_t27_ops [] =
+{
+  /* t27 */
+  DDS_OP_ADR | DDS_OP_FLAG_BASE | DDS_OP_TYPE_EXT, offsetof (CdrStreamOptimize_t27, parent), (3u << 16u) + 6u /* b27 */,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_t27, f1),
+  DDS_OP_RTS,
+
+  /* b27 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CdrStreamOptimize_b27, b1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL b60ce7aa1b360249b250c78e5456] (#deps: 1)
+   - [MINIMAL dd67a6ccf9d17964b77c0efc0d99]
+  [COMPLETE 151475b2905ef492dfecb8e6d85b] (#deps: 1)
+   - [COMPLETE 57e65420a62237bee109792fe5bc]
+*/
+#define TYPE_INFO_CDR_CdrStreamOptimize_t27 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xb6, 0x0c, 0xe7, 0xaa, 0x1b, 0x36, 0x02, 0x49, 0xb2, 0x50, 0xc7, \
+  0x8e, 0x54, 0x56, 0x00, 0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xdd, 0x67, 0xa6, 0xcc, 0xf9, 0xd1, 0x79, \
+  0x64, 0xb7, 0x7c, 0x0e, 0xfc, 0x0d, 0x99, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x15, 0x14, 0x75, \
+  0xb2, 0x90, 0x5e, 0xf4, 0x92, 0xdf, 0xec, 0xb8, 0xe6, 0xd8, 0x5b, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x57, 0xe6, 0x54, 0x20, 0xa6, 0x22, 0x37, 0xbe, 0xe1, 0x09, 0x79, 0x2f, 0xe5, 0xbc, 0x00, \
+  0x49, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CdrStreamOptimize_t27 148u
+#define TYPE_MAP_CDR_CdrStreamOptimize_t27 (unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xb6, 0x0c, 0xe7, 0xaa, 0x1b, 0x36, 0x02, \
+  0x49, 0xb2, 0x50, 0xc7, 0x8e, 0x54, 0x56, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0xf1, 0xdd, 0x67, 0xa6, 0xcc, 0xf9, 0xd1, 0x79, 0x64, 0xb7, 0x7c, 0x0e, \
+  0xfc, 0x0d, 0x99, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xdd, 0x67, 0xa6, 0xcc, \
+  0xf9, 0xd1, 0x79, 0x64, 0xb7, 0x7c, 0x0e, 0xfc, 0x0d, 0x99, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xed, \
+  0xba, 0xb4, 0x55, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x15, 0x14, 0x75, \
+  0xb2, 0x90, 0x5e, 0xf4, 0x92, 0xdf, 0xec, 0xb8, 0xe6, 0xd8, 0x5b, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xf2, 0x57, 0xe6, 0x54, 0x20, 0xa6, 0x22, 0x37, \
+  0xbe, 0xe1, 0x09, 0x79, 0x2f, 0xe5, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, \
+  0x65, 0x3a, 0x3a, 0x74, 0x32, 0x37, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x57, 0xe6, 0x54, 0x20, 0xa6, 0x22, 0x37, 0xbe, 0xe1, 0x09, \
+  0x79, 0x2f, 0xe5, 0xbc, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x43, 0x64, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, \
+  0x6d, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69, 0x7a, 0x65, 0x3a, 0x3a, 0x62, 0x32, 0x37, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x62, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x15, 0x14, 0x75, 0xb2, 0x90, 0x5e, 0xf4, \
+  0x92, 0xdf, 0xec, 0xb8, 0xe6, 0xd8, 0x5b, 0xf1, 0xb6, 0x0c, 0xe7, 0xaa, 0x1b, 0x36, 0x02, 0x49, \
+  0xb2, 0x50, 0xc7, 0x8e, 0x54, 0x56, 0xf2, 0x57, 0xe6, 0x54, 0x20, 0xa6, 0x22, 0x37, 0xbe, 0xe1, \
+  0x09, 0x79, 0x2f, 0xe5, 0xbc, 0xf1, 0xdd, 0x67, 0xa6, 0xcc, 0xf9, 0xd1, 0x79, 0x64, 0xb7, 0x7c, \
+  0x0e, 0xfc, 0x0d, 0x99\
+}
+#define TYPE_MAP_CDR_SZ_CdrStreamOptimize_t27 404u
+const dds_topic_descriptor_t CdrStreamOptimize_t27_desc =
+{
+  .m_size = sizeof (CdrStreamOptimize_t27),
+  .m_align = dds_alignof (CdrStreamOptimize_t27),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "CdrStreamOptimize::t27",
+  .m_keys = NULL,
+  .m_nops = 5,
+  .m_ops = CdrStreamOptimize_t27_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CdrStreamOptimize_t27, .sz = TYPE_INFO_CDR_SZ_CdrStreamOptimize_t27 },
+  .type_mapping = { .data = TYPE_MAP_CDR_CdrStreamOptimize_t27, .sz = TYPE_MAP_CDR_SZ_CdrStreamOptimize_t27 }
+};
+
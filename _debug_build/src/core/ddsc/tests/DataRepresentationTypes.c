@@ -0,0 +1,1276 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_debug_build/src/core/ddsc/tests/DataRepresentationTypes.c
+  Source: /root/repo/src/core/ddsc/tests/DataRepresentationTypes.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "DataRepresentationTypes.h"
+
+static const uint32_t DataRepresentationTypes_Type1_ops [] =
+{
+  /* Type1 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (DataRepresentationTypes_Type1, t1), (3u << 16u) + 8u /* Subtype1 */,
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (DataRepresentationTypes_Type1, t3),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_Type1, t2),
+  DDS_OP_RTS,
+
+  /* Subtype1 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_Subtype1, s1),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_Subtype1, s2),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_Subtype1, s3),
+  DDS_OP_RTS,
+  
+  /* key: t1.s2 */
+  DDS_OP_KOF | 2, 0u /* order: 10 */, 2u /* order: 2 */,
+  
+  /* key: t1.s3 */
+  DDS_OP_KOF | 2, 0u /* order: 10 */, 4u /* order: 1 */,
+  
+  /* key: t2 */
+  DDS_OP_KOF | 1, 5u /* order: 5 */
+};
+
+static const dds_key_descriptor_t DataRepresentationTypes_Type1_keys[3] =
+{
+  { "t2", 21, 2 },
+  { "t1.s3", 18, 1 },
+  { "t1.s2", 15, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 977d253587262ab93ce006241deb] (#deps: 1)
+   - [MINIMAL d9942c772f811b643c5b0400d20d]
+  [COMPLETE ae47762797d2a986557024df005b] (#deps: 1)
+   - [COMPLETE ec8682614a59eed2766dec3d464e]
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_Type1 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x97, 0x7d, 0x25, 0x35, 0x87, 0x26, 0x2a, 0xb9, 0x3c, 0xe0, 0x06, \
+  0x24, 0x1d, 0xeb, 0x00, 0x57, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xd9, 0x94, 0x2c, 0x77, 0x2f, 0x81, 0x1b, \
+  0x64, 0x3c, 0x5b, 0x04, 0x00, 0xd2, 0x0d, 0x00, 0x47, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xae, 0x47, 0x76, \
+  0x27, 0x97, 0xd2, 0xa9, 0x86, 0x55, 0x70, 0x24, 0xdf, 0x00, 0x5b, 0x00, 0x91, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xec, 0x86, 0x82, 0x61, 0x4a, 0x59, 0xee, 0xd2, 0x76, 0x6d, 0xec, 0x3d, 0x46, 0x4e, 0x00, \
+  0x85, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_Type1 148u
+#define TYPE_MAP_CDR_DataRepresentationTypes_Type1 (unsigned char []){ \
+  0xc3, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x97, 0x7d, 0x25, 0x35, 0x87, 0x26, 0x2a, \
+  0xb9, 0x3c, 0xe0, 0x06, 0x24, 0x1d, 0xeb, 0x00, 0x53, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0xd9, 0x94, 0x2c, 0x77, 0x2f, \
+  0x81, 0x1b, 0x64, 0x3c, 0x5b, 0x04, 0x00, 0xd2, 0x0d, 0x83, 0xf1, 0x53, 0x5f, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x0b, 0x88, 0x54, 0xad, \
+  0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x0f, 0x82, 0x6a, 0x89, 0xf1, \
+  0xd9, 0x94, 0x2c, 0x77, 0x2f, 0x81, 0x1b, 0x64, 0x3c, 0x5b, 0x04, 0x00, 0xd2, 0x0d, 0x00, 0x00, \
+  0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x10, 0x8d, 0xdf, 0x87, 0x80, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x05, 0xfa, 0xc9, 0x89, 0x44, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x10, 0xc0, 0x82, 0x8e, 0x03, 0x00, 0x39, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0xae, 0x47, 0x76, 0x27, 0x97, 0xd2, 0xa9, 0x86, 0x55, 0x70, 0x24, 0xdf, 0x00, 0x5b, 0x00, \
+  0x8d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, \
+  0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, \
+  0x65, 0x31, 0x00, 0x00, 0x59, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0xec, 0x86, 0x82, 0x61, 0x4a, 0x59, 0xee, 0xd2, 0x76, \
+  0x6d, 0xec, 0x3d, 0x46, 0x4e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x74, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x74, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, 0x74, 0x32, 0x00, 0x00, \
+  0x00, 0xf2, 0xec, 0x86, 0x82, 0x61, 0x4a, 0x59, 0xee, 0xd2, 0x76, 0x6d, 0xec, 0x3d, 0x46, 0x4e, \
+  0x81, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, \
+  0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x53, 0x75, 0x62, \
+  0x74, 0x79, 0x70, 0x65, 0x31, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x73, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x73, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x73, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0xae, 0x47, 0x76, 0x27, 0x97, 0xd2, 0xa9, 0x86, 0x55, 0x70, 0x24, 0xdf, 0x00, 0x5b, 0xf1, \
+  0x97, 0x7d, 0x25, 0x35, 0x87, 0x26, 0x2a, 0xb9, 0x3c, 0xe0, 0x06, 0x24, 0x1d, 0xeb, 0xf2, 0xec, \
+  0x86, 0x82, 0x61, 0x4a, 0x59, 0xee, 0xd2, 0x76, 0x6d, 0xec, 0x3d, 0x46, 0x4e, 0xf1, 0xd9, 0x94, \
+  0x2c, 0x77, 0x2f, 0x81, 0x1b, 0x64, 0x3c, 0x5b, 0x04, 0x00, 0xd2, 0x0d\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_Type1 588u
+const dds_topic_descriptor_t DataRepresentationTypes_Type1_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_Type1),
+  .m_align = dds_alignof (DataRepresentationTypes_Type1),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "DataRepresentationTypes::Type1",
+  .m_keys = DataRepresentationTypes_Type1_keys,
+  .m_nops = 8,
+  .m_ops = DataRepresentationTypes_Type1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_Type1, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_Type1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_Type1, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_Type1 }
+};
+
+static const uint32_t DataRepresentationTypes_Type2_ops [] =
+{
+  /* Type2 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_Type2, t1), 64u,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_Type2, t2),
+  DDS_OP_RTS,
+  
+  /* key: t1 */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t DataRepresentationTypes_Type2_keys[1] =
+{
+  { "t1", 6, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 3398de141ae76c89945a44f7e646] (#deps: 0)
+  [COMPLETE 9543997f133fef5c04275a57a240] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_Type2 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x33, 0x98, 0xde, 0x14, 0x1a, 0xe7, 0x6c, 0x89, 0x94, 0x5a, 0x44, \
+  0xf7, 0xe6, 0x46, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x95, 0x43, 0x99, 0x7f, 0x13, 0x3f, 0xef, 0x5c, 0x04, 0x27, 0x5a, \
+  0x57, 0xa2, 0x40, 0x00, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_Type2 100u
+#define TYPE_MAP_CDR_DataRepresentationTypes_Type2 (unsigned char []){ \
+  0x57, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x33, 0x98, 0xde, 0x14, 0x1a, 0xe7, 0x6c, \
+  0x89, 0x94, 0x5a, 0x44, 0xf7, 0xe6, 0x46, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x10, 0x83, 0xf1, 0x53, 0x5f, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0f, 0x82, 0x6a, 0x89, 0x00, 0x89, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x95, 0x43, 0x99, 0x7f, 0x13, 0x3f, 0xef, 0x5c, 0x04, 0x27, 0x5a, \
+  0x57, 0xa2, 0x40, 0x00, 0x71, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x27, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x70, 0x72, \
+  0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, \
+  0x3a, 0x54, 0x79, 0x70, 0x65, 0x32, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x40, 0x10, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x74, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x74, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x95, 0x43, 0x99, 0x7f, 0x13, 0x3f, 0xef, 0x5c, 0x04, 0x27, 0x5a, \
+  0x57, 0xa2, 0x40, 0xf1, 0x33, 0x98, 0xde, 0x14, 0x1a, 0xe7, 0x6c, 0x89, 0x94, 0x5a, 0x44, 0xf7, \
+  0xe6, 0x46\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_Type2 274u
+const dds_topic_descriptor_t DataRepresentationTypes_Type2_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_Type2),
+  .m_align = dds_alignof (DataRepresentationTypes_Type2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "DataRepresentationTypes::Type2",
+  .m_keys = DataRepresentationTypes_Type2_keys,
+  .m_nops = 3,
+  .m_ops = DataRepresentationTypes_Type2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_Type2, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_Type2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_Type2, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_Type2 }
+};
+
+static const uint32_t DataRepresentationTypes_Type3_ops [] =
+{
+  /* Type3 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_Type3, t1),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_8BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_Type3, t2), 10u,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_Type3, t3),
+  DDS_OP_RTS,
+  
+  /* key: t2 */
+  DDS_OP_KOF | 1, 2u /* order: 1 */
+};
+
+static const dds_key_descriptor_t DataRepresentationTypes_Type3_keys[1] =
+{
+  { "t2", 8, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 84e1779f0d537e73ab00c0b1c879] (#deps: 0)
+  [COMPLETE f5464146b8d7098a5f287c93e3bd] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_Type3 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x84, 0xe1, 0x77, 0x9f, 0x0d, 0x53, 0x7e, 0x73, 0xab, 0x00, 0xc0, \
+  0xb1, 0xc8, 0x79, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xf5, 0x46, 0x41, 0x46, 0xb8, 0xd7, 0x09, 0x8a, 0x5f, 0x28, 0x7c, \
+  0x93, 0xe3, 0xbd, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_Type3 100u
+#define TYPE_MAP_CDR_DataRepresentationTypes_Type3 (unsigned char []){ \
+  0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x84, 0xe1, 0x77, 0x9f, 0x0d, 0x53, 0x7e, \
+  0x73, 0xab, 0x00, 0xc0, 0xb1, 0xc8, 0x79, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x83, 0xf1, 0x53, 0x5f, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0a, 0x05, 0x0f, 0x82, 0x6a, 0x89, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0b, 0x88, 0x54, 0xad, 0x00, 0xa1, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xf5, 0x46, 0x41, 0x46, 0xb8, 0xd7, 0x09, 0x8a, 0x5f, 0x28, 0x7c, \
+  0x93, 0xe3, 0xbd, 0x00, 0x89, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x27, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x70, 0x72, \
+  0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, \
+  0x3a, 0x54, 0x79, 0x70, 0x65, 0x33, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x74, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0a, 0x05, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x74, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x74, 0x33, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xf5, 0x46, 0x41, \
+  0x46, 0xb8, 0xd7, 0x09, 0x8a, 0x5f, 0x28, 0x7c, 0x93, 0xe3, 0xbd, 0xf1, 0x84, 0xe1, 0x77, 0x9f, \
+  0x0d, 0x53, 0x7e, 0x73, 0xab, 0x00, 0xc0, 0xb1, 0xc8, 0x79\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_Type3 314u
+const dds_topic_descriptor_t DataRepresentationTypes_Type3_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_Type3),
+  .m_align = dds_alignof (DataRepresentationTypes_Type3),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "DataRepresentationTypes::Type3",
+  .m_keys = DataRepresentationTypes_Type3_keys,
+  .m_nops = 4,
+  .m_ops = DataRepresentationTypes_Type3_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_Type3, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_Type3 },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_Type3, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_Type3 }
+};
+
+static const uint32_t DataRepresentationTypes_TypeFinal_ops [] =
+{
+  /* TypeFinal */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_TypeFinal, a),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL e3d371df3e7321ee634d3f49e9b4] (#deps: 0)
+  [COMPLETE 697e7da26291d6f646db1540231c] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_TypeFinal (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xe3, 0xd3, 0x71, 0xdf, 0x3e, 0x73, 0x21, 0xee, 0x63, 0x4d, 0x3f, \
+  0x49, 0xe9, 0xb4, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x69, 0x7e, 0x7d, 0xa2, 0x62, 0x91, 0xd6, 0xf6, 0x46, 0xdb, 0x15, \
+  0x40, 0x23, 0x1c, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeFinal 100u
+#define TYPE_MAP_CDR_DataRepresentationTypes_TypeFinal (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xe3, 0xd3, 0x71, 0xdf, 0x3e, 0x73, 0x21, \
+  0xee, 0x63, 0x4d, 0x3f, 0x49, 0xe9, 0xb4, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x68, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x69, 0x7e, 0x7d, 0xa2, 0x62, 0x91, 0xd6, \
+  0xf6, 0x46, 0xdb, 0x15, 0x40, 0x23, 0x1c, 0x00, 0x50, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, \
+  0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, \
+  0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x46, 0x69, 0x6e, 0x61, 0x6c, 0x00, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x69, 0x7e, 0x7d, 0xa2, 0x62, 0x91, 0xd6, 0xf6, 0x46, 0xdb, 0x15, \
+  0x40, 0x23, 0x1c, 0xf1, 0xe3, 0xd3, 0x71, 0xdf, 0x3e, 0x73, 0x21, 0xee, 0x63, 0x4d, 0x3f, 0x49, \
+  0xe9, 0xb4\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeFinal 210u
+const dds_topic_descriptor_t DataRepresentationTypes_TypeFinal_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_TypeFinal),
+  .m_align = dds_alignof (DataRepresentationTypes_TypeFinal),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "DataRepresentationTypes::TypeFinal",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = DataRepresentationTypes_TypeFinal_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_TypeFinal, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeFinal },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_TypeFinal, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeFinal }
+};
+
+static const uint32_t DataRepresentationTypes_TypeAppendable_ops [] =
+{
+  /* TypeAppendable */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_TypeAppendable, a),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL a44a43efce1eca96e18936f7d24d] (#deps: 0)
+  [COMPLETE 604bbfbc98defb9daedb26bbba20] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_TypeAppendable (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xa4, 0x4a, 0x43, 0xef, 0xce, 0x1e, 0xca, 0x96, 0xe1, 0x89, 0x36, \
+  0xf7, 0xd2, 0x4d, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x60, 0x4b, 0xbf, 0xbc, 0x98, 0xde, 0xfb, 0x9d, 0xae, 0xdb, 0x26, \
+  0xbb, 0xba, 0x20, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeAppendable 100u
+#define TYPE_MAP_CDR_DataRepresentationTypes_TypeAppendable (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xa4, 0x4a, 0x43, 0xef, 0xce, 0x1e, 0xca, \
+  0x96, 0xe1, 0x89, 0x36, 0xf7, 0xd2, 0x4d, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x6c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x60, 0x4b, 0xbf, 0xbc, 0x98, 0xde, 0xfb, \
+  0x9d, 0xae, 0xdb, 0x26, 0xbb, 0xba, 0x20, 0x00, 0x54, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, \
+  0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, \
+  0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x41, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x61, \
+  0x62, 0x6c, 0x65, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x60, 0x4b, 0xbf, 0xbc, 0x98, 0xde, 0xfb, \
+  0x9d, 0xae, 0xdb, 0x26, 0xbb, 0xba, 0x20, 0xf1, 0xa4, 0x4a, 0x43, 0xef, 0xce, 0x1e, 0xca, 0x96, \
+  0xe1, 0x89, 0x36, 0xf7, 0xd2, 0x4d\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeAppendable 214u
+const dds_topic_descriptor_t DataRepresentationTypes_TypeAppendable_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_TypeAppendable),
+  .m_align = dds_alignof (DataRepresentationTypes_TypeAppendable),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "DataRepresentationTypes::TypeAppendable",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = DataRepresentationTypes_TypeAppendable_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_TypeAppendable, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeAppendable },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_TypeAppendable, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeAppendable }
+};
+
+static const uint32_t DataRepresentationTypes_TypeMutable_ops [] =
+{
+  /* TypeMutable */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_TypeMutable, a),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL bb960921dcd5df8752701b8433d1] (#deps: 0)
+  [COMPLETE 587bd316612c83e8048a854fd0d7] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_TypeMutable (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, \
+  0x84, 0x33, 0xd1, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x58, 0x7b, 0xd3, 0x16, 0x61, 0x2c, 0x83, 0xe8, 0x04, 0x8a, 0x85, \
+  0x4f, 0xd0, 0xd7, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeMutable 100u
+#define TYPE_MAP_CDR_DataRepresentationTypes_TypeMutable (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, \
+  0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x6c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x58, 0x7b, 0xd3, 0x16, 0x61, 0x2c, 0x83, \
+  0xe8, 0x04, 0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0x00, 0x54, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, \
+  0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, \
+  0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x4d, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, \
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x58, 0x7b, 0xd3, 0x16, 0x61, 0x2c, 0x83, \
+  0xe8, 0x04, 0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, 0x87, \
+  0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeMutable 214u
+const dds_topic_descriptor_t DataRepresentationTypes_TypeMutable_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_TypeMutable),
+  .m_align = dds_alignof (DataRepresentationTypes_TypeMutable),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "DataRepresentationTypes::TypeMutable",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = DataRepresentationTypes_TypeMutable_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_TypeMutable, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeMutable },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_TypeMutable, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeMutable }
+};
+
+static const uint32_t DataRepresentationTypes_TypeNestedAppendable_ops [] =
+{
+  /* TypeNestedAppendable */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (DataRepresentationTypes_TypeNestedAppendable, a), (3u << 16u) + 4u /* TypeAppendable */,
+  DDS_OP_RTS,
+
+  /* TypeAppendable */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_TypeAppendable, a),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 2a7a402b4830736314a16045e1f7] (#deps: 1)
+   - [MINIMAL a44a43efce1eca96e18936f7d24d]
+  [COMPLETE 9879d0e904b7c75f9dd36ed22819] (#deps: 1)
+   - [COMPLETE 604bbfbc98defb9daedb26bbba20]
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_TypeNestedAppendable (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x2a, 0x7a, 0x40, 0x2b, 0x48, 0x30, 0x73, 0x63, 0x14, 0xa1, 0x60, \
+  0x45, 0xe1, 0xf7, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xa4, 0x4a, 0x43, 0xef, 0xce, 0x1e, 0xca, \
+  0x96, 0xe1, 0x89, 0x36, 0xf7, 0xd2, 0x4d, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x98, 0x79, 0xd0, \
+  0xe9, 0x04, 0xb7, 0xc7, 0x5f, 0x9d, 0xd3, 0x6e, 0xd2, 0x28, 0x19, 0x00, 0x70, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x60, 0x4b, 0xbf, 0xbc, 0x98, 0xde, 0xfb, 0x9d, 0xae, 0xdb, 0x26, 0xbb, 0xba, 0x20, 0x00, \
+  0x58, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeNestedAppendable 148u
+#define TYPE_MAP_CDR_DataRepresentationTypes_TypeNestedAppendable (unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x2a, 0x7a, 0x40, 0x2b, 0x48, 0x30, 0x73, \
+  0x63, 0x14, 0xa1, 0x60, 0x45, 0xe1, 0xf7, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xa4, 0x4a, 0x43, 0xef, 0xce, \
+  0x1e, 0xca, 0x96, 0xe1, 0x89, 0x36, 0xf7, 0xd2, 0x4d, 0x0c, 0xc1, 0x75, 0xb9, 0xf1, 0xa4, 0x4a, \
+  0x43, 0xef, 0xce, 0x1e, 0xca, 0x96, 0xe1, 0x89, 0x36, 0xf7, 0xd2, 0x4d, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0xec, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x98, 0x79, 0xd0, \
+  0xe9, 0x04, 0xb7, 0xc7, 0x5f, 0x9d, 0xd3, 0x6e, 0xd2, 0x28, 0x19, 0x00, 0x6c, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, \
+  0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, \
+  0x6f, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x4e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x41, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x60, 0x4b, 0xbf, 0xbc, 0x98, 0xde, 0xfb, 0x9d, 0xae, 0xdb, 0x26, 0xbb, 0xba, \
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xf2, 0x60, 0x4b, 0xbf, \
+  0xbc, 0x98, 0xde, 0xfb, 0x9d, 0xae, 0xdb, 0x26, 0xbb, 0xba, 0x20, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x02, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, \
+  0x6f, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x41, 0x70, 0x70, \
+  0x65, 0x6e, 0x64, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x98, 0x79, 0xd0, \
+  0xe9, 0x04, 0xb7, 0xc7, 0x5f, 0x9d, 0xd3, 0x6e, 0xd2, 0x28, 0x19, 0xf1, 0x2a, 0x7a, 0x40, 0x2b, \
+  0x48, 0x30, 0x73, 0x63, 0x14, 0xa1, 0x60, 0x45, 0xe1, 0xf7, 0xf2, 0x60, 0x4b, 0xbf, 0xbc, 0x98, \
+  0xde, 0xfb, 0x9d, 0xae, 0xdb, 0x26, 0xbb, 0xba, 0x20, 0xf1, 0xa4, 0x4a, 0x43, 0xef, 0xce, 0x1e, \
+  0xca, 0x96, 0xe1, 0x89, 0x36, 0xf7, 0xd2, 0x4d\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeNestedAppendable 440u
+const dds_topic_descriptor_t DataRepresentationTypes_TypeNestedAppendable_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_TypeNestedAppendable),
+  .m_align = dds_alignof (DataRepresentationTypes_TypeNestedAppendable),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "DataRepresentationTypes::TypeNestedAppendable",
+  .m_keys = NULL,
+  .m_nops = 5,
+  .m_ops = DataRepresentationTypes_TypeNestedAppendable_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_TypeNestedAppendable, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeNestedAppendable },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_TypeNestedAppendable, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeNestedAppendable }
+};
+
+static const uint32_t DataRepresentationTypes_TypeNestedMutable_ops [] =
+{
+  /* TypeNestedMutable */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (DataRepresentationTypes_TypeNestedMutable, a), (3u << 16u) + 4u /* TypeMutable */,
+  DDS_OP_RTS,
+
+  /* TypeMutable */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_TypeMutable, a),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 249bde281a1fb5203542c072ee2f] (#deps: 1)
+   - [MINIMAL bb960921dcd5df8752701b8433d1]
+  [COMPLETE 79195afbaf41acc47d17af9a2b8d] (#deps: 1)
+   - [COMPLETE 587bd316612c83e8048a854fd0d7]
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_TypeNestedMutable (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x24, 0x9b, 0xde, 0x28, 0x1a, 0x1f, 0xb5, 0x20, 0x35, 0x42, 0xc0, \
+  0x72, 0xee, 0x2f, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, \
+  0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x79, 0x19, 0x5a, \
+  0xfb, 0xaf, 0x41, 0xac, 0xc4, 0x7d, 0x17, 0xaf, 0x9a, 0x2b, 0x8d, 0x00, 0x6c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x58, 0x7b, 0xd3, 0x16, 0x61, 0x2c, 0x83, 0xe8, 0x04, 0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0x00, \
+  0x58, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeNestedMutable 148u
+#define TYPE_MAP_CDR_DataRepresentationTypes_TypeNestedMutable (unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x24, 0x9b, 0xde, 0x28, 0x1a, 0x1f, 0xb5, \
+  0x20, 0x35, 0x42, 0xc0, 0x72, 0xee, 0x2f, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, \
+  0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x0c, 0xc1, 0x75, 0xb9, 0xf1, 0xbb, 0x96, \
+  0x09, 0x21, 0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x79, 0x19, 0x5a, \
+  0xfb, 0xaf, 0x41, 0xac, 0xc4, 0x7d, 0x17, 0xaf, 0x9a, 0x2b, 0x8d, 0x00, 0x68, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, \
+  0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, \
+  0x6f, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x4e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x4d, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x58, \
+  0x7b, 0xd3, 0x16, 0x61, 0x2c, 0x83, 0xe8, 0x04, 0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xf2, 0x58, 0x7b, 0xd3, 0x16, 0x61, 0x2c, 0x83, \
+  0xe8, 0x04, 0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0x00, 0x54, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, \
+  0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, \
+  0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x4d, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, \
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x79, 0x19, 0x5a, 0xfb, 0xaf, 0x41, 0xac, \
+  0xc4, 0x7d, 0x17, 0xaf, 0x9a, 0x2b, 0x8d, 0xf1, 0x24, 0x9b, 0xde, 0x28, 0x1a, 0x1f, 0xb5, 0x20, \
+  0x35, 0x42, 0xc0, 0x72, 0xee, 0x2f, 0xf2, 0x58, 0x7b, 0xd3, 0x16, 0x61, 0x2c, 0x83, 0xe8, 0x04, \
+  0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, \
+  0x1b, 0x84, 0x33, 0xd1\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeNestedMutable 436u
+const dds_topic_descriptor_t DataRepresentationTypes_TypeNestedMutable_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_TypeNestedMutable),
+  .m_align = dds_alignof (DataRepresentationTypes_TypeNestedMutable),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "DataRepresentationTypes::TypeNestedMutable",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = DataRepresentationTypes_TypeNestedMutable_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_TypeNestedMutable, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeNestedMutable },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_TypeNestedMutable, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeNestedMutable }
+};
+
+static const uint32_t DataRepresentationTypes_TypeNestedMutableArr_ops [] =
+{
+  /* TypeNestedMutableArr */
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_STU, offsetof (DataRepresentationTypes_TypeNestedMutableArr, a), 5u, (5u << 16u) + 6u /* TypeMutable */, sizeof (DataRepresentationTypes_TypeMutable),
+  DDS_OP_RTS,
+
+  /* TypeMutable */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_TypeMutable, a),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 2a77044afbfab14d3ab6ed5a379c] (#deps: 1)
+   - [MINIMAL bb960921dcd5df8752701b8433d1]
+  [COMPLETE 28712293c7d3f6317923cd02f52d] (#deps: 1)
+   - [COMPLETE 587bd316612c83e8048a854fd0d7]
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_TypeNestedMutableArr (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x2a, 0x77, 0x04, 0x4a, 0xfb, 0xfa, 0xb1, 0x4d, 0x3a, 0xb6, 0xed, \
+  0x5a, 0x37, 0x9c, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, \
+  0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x28, 0x71, 0x22, \
+  0x93, 0xc7, 0xd3, 0xf6, 0x31, 0x79, 0x23, 0xcd, 0x02, 0xf5, 0x2d, 0x00, 0x78, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x58, 0x7b, 0xd3, 0x16, 0x61, 0x2c, 0x83, 0xe8, 0x04, 0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0x00, \
+  0x58, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeNestedMutableArr 148u
+#define TYPE_MAP_CDR_DataRepresentationTypes_TypeNestedMutableArr (unsigned char []){ \
+  0x8b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x2a, 0x77, 0x04, 0x4a, 0xfb, 0xfa, 0xb1, \
+  0x4d, 0x3a, 0xb6, 0xed, 0x5a, 0x37, 0x9c, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x05, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, \
+  0x1b, 0x84, 0x33, 0xd1, 0x0c, 0xc1, 0x75, 0xb9, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, \
+  0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0xf4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x28, 0x71, 0x22, 0x93, 0xc7, 0xd3, 0xf6, \
+  0x31, 0x79, 0x23, 0xcd, 0x02, 0xf5, 0x2d, 0x00, 0x74, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, \
+  0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, \
+  0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x4e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x4d, \
+  0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x41, 0x72, 0x72, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0xf2, 0x58, 0x7b, 0xd3, 0x16, 0x61, 0x2c, \
+  0x83, 0xe8, 0x04, 0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0xf2, 0x58, 0x7b, 0xd3, 0x16, 0x61, 0x2c, 0x83, 0xe8, 0x04, 0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0x00, \
+  0x54, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x25, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, \
+  0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, \
+  0x65, 0x4d, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x28, 0x71, 0x22, 0x93, 0xc7, 0xd3, 0xf6, 0x31, 0x79, 0x23, 0xcd, 0x02, 0xf5, 0x2d, 0xf1, \
+  0x2a, 0x77, 0x04, 0x4a, 0xfb, 0xfa, 0xb1, 0x4d, 0x3a, 0xb6, 0xed, 0x5a, 0x37, 0x9c, 0xf2, 0x58, \
+  0x7b, 0xd3, 0x16, 0x61, 0x2c, 0x83, 0xe8, 0x04, 0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0xf1, 0xbb, 0x96, \
+  0x09, 0x21, 0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeNestedMutableArr 460u
+const dds_topic_descriptor_t DataRepresentationTypes_TypeNestedMutableArr_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_TypeNestedMutableArr),
+  .m_align = dds_alignof (DataRepresentationTypes_TypeNestedMutableArr),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "DataRepresentationTypes::TypeNestedMutableArr",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = DataRepresentationTypes_TypeNestedMutableArr_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_TypeNestedMutableArr, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeNestedMutableArr },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_TypeNestedMutableArr, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeNestedMutableArr }
+};
+
+static const uint32_t DataRepresentationTypes_TypeNestedMutableSeq_ops [] =
+{
+  /* TypeNestedMutableSeq */
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STU, offsetof (DataRepresentationTypes_TypeNestedMutableSeq, a), sizeof (DataRepresentationTypes_TypeMutable), (4u << 16u) + 5u /* TypeMutable */,
+  DDS_OP_RTS,
+
+  /* TypeMutable */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_TypeMutable, a),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 5e67c55e371f88cb3f66ea3810c4] (#deps: 1)
+   - [MINIMAL bb960921dcd5df8752701b8433d1]
+  [COMPLETE ec902e8ea68bc55e4efb66aaecec] (#deps: 1)
+   - [COMPLETE 587bd316612c83e8048a854fd0d7]
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_TypeNestedMutableSeq (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x5e, 0x67, 0xc5, 0x5e, 0x37, 0x1f, 0x88, 0xcb, 0x3f, 0x66, 0xea, \
+  0x38, 0x10, 0xc4, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, \
+  0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xec, 0x90, 0x2e, \
+  0x8e, 0xa6, 0x8b, 0xc5, 0x5e, 0x4e, 0xfb, 0x66, 0xaa, 0xec, 0xec, 0x00, 0x74, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x58, 0x7b, 0xd3, 0x16, 0x61, 0x2c, 0x83, 0xe8, 0x04, 0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0x00, \
+  0x58, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeNestedMutableSeq 148u
+#define TYPE_MAP_CDR_DataRepresentationTypes_TypeNestedMutableSeq (unsigned char []){ \
+  0x87, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x5e, 0x67, 0xc5, 0x5e, 0x37, 0x1f, 0x88, \
+  0xcb, 0x3f, 0x66, 0xea, 0x38, 0x10, 0xc4, 0x00, 0x36, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x00, 0xf1, \
+  0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x0c, 0xc1, \
+  0x75, 0xb9, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, \
+  0xd1, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, 0xf0, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0xec, 0x90, 0x2e, 0x8e, 0xa6, 0x8b, 0xc5, 0x5e, 0x4e, 0xfb, 0x66, \
+  0xaa, 0xec, 0xec, 0x00, 0x70, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x36, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x70, 0x72, \
+  0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, \
+  0x3a, 0x54, 0x79, 0x70, 0x65, 0x4e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x4d, 0x75, 0x74, 0x61, 0x62, \
+  0x6c, 0x65, 0x53, 0x65, 0x71, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, \
+  0x58, 0x7b, 0xd3, 0x16, 0x61, 0x2c, 0x83, 0xe8, 0x04, 0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0xf2, 0x58, 0x7b, 0xd3, 0x16, 0x61, 0x2c, 0x83, \
+  0xe8, 0x04, 0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0x00, 0x54, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, \
+  0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, \
+  0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x4d, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, \
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xec, 0x90, 0x2e, 0x8e, 0xa6, 0x8b, 0xc5, \
+  0x5e, 0x4e, 0xfb, 0x66, 0xaa, 0xec, 0xec, 0xf1, 0x5e, 0x67, 0xc5, 0x5e, 0x37, 0x1f, 0x88, 0xcb, \
+  0x3f, 0x66, 0xea, 0x38, 0x10, 0xc4, 0xf2, 0x58, 0x7b, 0xd3, 0x16, 0x61, 0x2c, 0x83, 0xe8, 0x04, \
+  0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, \
+  0x1b, 0x84, 0x33, 0xd1\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeNestedMutableSeq 452u
+const dds_topic_descriptor_t DataRepresentationTypes_TypeNestedMutableSeq_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_TypeNestedMutableSeq),
+  .m_align = dds_alignof (DataRepresentationTypes_TypeNestedMutableSeq),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "DataRepresentationTypes::TypeNestedMutableSeq",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = DataRepresentationTypes_TypeNestedMutableSeq_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_TypeNestedMutableSeq, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeNestedMutableSeq },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_TypeNestedMutableSeq, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeNestedMutableSeq }
+};
+
+static const uint32_t DataRepresentationTypes_TypeNestedMutableUni_ops [] =
+{
+  /* TypeNestedMutableUni */
+  DDS_OP_ADR | DDS_OP_FLAG_MU | DDS_OP_TYPE_UNI | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_DEF | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_TypeNestedMutableUni, _d), 3u, (16u << 16u) + 4u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_1BY, 1, offsetof (DataRepresentationTypes_TypeNestedMutableUni, _u.a), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_STU | 9 /* TypeNestedMutable */, 2, offsetof (DataRepresentationTypes_TypeNestedMutableUni, _u.b), 0u,
+  DDS_OP_JEQ4 | DDS_OP_TYPE_4BY, 0, offsetof (DataRepresentationTypes_TypeNestedMutableUni, _u.c), 0u,
+  DDS_OP_RTS,
+
+  /* TypeNestedMutable */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (DataRepresentationTypes_TypeNestedMutable, a), (3u << 16u) + 4u /* TypeMutable */,
+  DDS_OP_RTS,
+
+  /* TypeMutable */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_TypeMutable, a),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 1d75e5aeab565d1bbd3882ff08e5] (#deps: 2)
+   - [MINIMAL 249bde281a1fb5203542c072ee2f]
+   - [MINIMAL bb960921dcd5df8752701b8433d1]
+  [COMPLETE d053a63eee536bbf743bbff6a78d] (#deps: 2)
+   - [COMPLETE 79195afbaf41acc47d17af9a2b8d]
+   - [COMPLETE 587bd316612c83e8048a854fd0d7]
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_TypeNestedMutableUni (unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x1d, 0x75, 0xe5, 0xae, 0xab, 0x56, 0x5d, 0x1b, 0xbd, 0x38, 0x82, \
+  0xff, 0x08, 0xe5, 0x00, 0x70, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x24, 0x9b, 0xde, 0x28, 0x1a, 0x1f, 0xb5, \
+  0x20, 0x35, 0x42, 0xc0, 0x72, 0xee, 0x2f, 0x00, 0x35, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x00, \
+  0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xd0, 0x53, 0xa6, 0x3e, 0xee, 0x53, 0x6b, 0xbf, 0x74, 0x3b, 0xbf, \
+  0xf6, 0xa7, 0x8d, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x79, 0x19, 0x5a, 0xfb, 0xaf, 0x41, 0xac, \
+  0xc4, 0x7d, 0x17, 0xaf, 0x9a, 0x2b, 0x8d, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x58, 0x7b, 0xd3, 0x16, 0x61, 0x2c, 0x83, 0xe8, 0x04, 0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0x00, \
+  0x58, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeNestedMutableUni 196u
+#define TYPE_MAP_CDR_DataRepresentationTypes_TypeNestedMutableUni (unsigned char []){ \
+  0xff, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x1d, 0x75, 0xe5, 0xae, 0xab, 0x56, 0x5d, \
+  0x1b, 0xbd, 0x38, 0x82, 0xff, 0x08, 0xe5, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x01, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x58, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0xc1, 0x75, 0xb9, 0x24, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x24, 0x9b, 0xde, 0x28, 0x1a, 0x1f, 0xb5, 0x20, 0x35, \
+  0x42, 0xc0, 0x72, 0xee, 0x2f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x92, 0xeb, 0x5f, 0xfe, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x41, 0x00, 0x04, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x4a, 0x8a, 0x08, 0xf0, 0xf1, 0x24, 0x9b, 0xde, 0x28, 0x1a, 0x1f, 0xb5, \
+  0x20, 0x35, 0x42, 0xc0, 0x72, 0xee, 0x2f, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xbb, 0x96, 0x09, 0x21, 0xdc, \
+  0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x0c, 0xc1, 0x75, 0xb9, 0xf1, 0xbb, 0x96, \
+  0x09, 0x21, 0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, \
+  0xc1, 0x75, 0xb9, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0xd0, 0x53, 0xa6, \
+  0x3e, 0xee, 0x53, 0x6b, 0xbf, 0x74, 0x3b, 0xbf, 0xf6, 0xa7, 0x8d, 0x00, 0xb4, 0x00, 0x00, 0x00, \
+  0xf2, 0x52, 0x01, 0x00, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, \
+  0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, \
+  0x6f, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x4e, 0x65, 0x73, \
+  0x74, 0x65, 0x64, 0x4d, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x55, 0x6e, 0x69, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x79, 0x19, 0x5a, 0xfb, 0xaf, \
+  0x41, 0xac, 0xc4, 0x7d, 0x17, 0xaf, 0x9a, 0x2b, 0x8d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x41, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x63, 0x00, 0x00, 0x00, 0xf2, 0x79, 0x19, 0x5a, 0xfb, 0xaf, 0x41, 0xac, 0xc4, 0x7d, 0x17, 0xaf, \
+  0x9a, 0x2b, 0x8d, 0x00, 0x68, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x33, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x70, 0x72, \
+  0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, \
+  0x3a, 0x54, 0x79, 0x70, 0x65, 0x4e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x4d, 0x75, 0x74, 0x61, 0x62, \
+  0x6c, 0x65, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x58, 0x7b, 0xd3, 0x16, 0x61, 0x2c, 0x83, 0xe8, 0x04, \
+  0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0xf2, 0x58, 0x7b, 0xd3, 0x16, 0x61, 0x2c, 0x83, 0xe8, 0x04, 0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0x00, \
+  0x54, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x25, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, 0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, \
+  0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, \
+  0x65, 0x4d, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0xf2, 0xd0, 0x53, 0xa6, 0x3e, 0xee, 0x53, 0x6b, 0xbf, 0x74, 0x3b, 0xbf, 0xf6, 0xa7, 0x8d, 0xf1, \
+  0x1d, 0x75, 0xe5, 0xae, 0xab, 0x56, 0x5d, 0x1b, 0xbd, 0x38, 0x82, 0xff, 0x08, 0xe5, 0xf2, 0x79, \
+  0x19, 0x5a, 0xfb, 0xaf, 0x41, 0xac, 0xc4, 0x7d, 0x17, 0xaf, 0x9a, 0x2b, 0x8d, 0xf1, 0x24, 0x9b, \
+  0xde, 0x28, 0x1a, 0x1f, 0xb5, 0x20, 0x35, 0x42, 0xc0, 0x72, 0xee, 0x2f, 0xf2, 0x58, 0x7b, 0xd3, \
+  0x16, 0x61, 0x2c, 0x83, 0xe8, 0x04, 0x8a, 0x85, 0x4f, 0xd0, 0xd7, 0xf1, 0xbb, 0x96, 0x09, 0x21, \
+  0xdc, 0xd5, 0xdf, 0x87, 0x52, 0x70, 0x1b, 0x84, 0x33, 0xd1\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeNestedMutableUni 794u
+const dds_topic_descriptor_t DataRepresentationTypes_TypeNestedMutableUni_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_TypeNestedMutableUni),
+  .m_align = dds_alignof (DataRepresentationTypes_TypeNestedMutableUni),
+  .m_flagset = DDS_TOPIC_CONTAINS_UNION | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "DataRepresentationTypes::TypeNestedMutableUni",
+  .m_keys = NULL,
+  .m_nops = 11,
+  .m_ops = DataRepresentationTypes_TypeNestedMutableUni_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_TypeNestedMutableUni, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeNestedMutableUni },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_TypeNestedMutableUni, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeNestedMutableUni }
+};
+
+static const uint32_t DataRepresentationTypes_TypeXcdr1_ops [] =
+{
+  /* TypeXcdr1 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_TypeXcdr1, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL f54b392e7940752e2b87b56816eb] (#deps: 0)
+  [COMPLETE 442d90d4e49dde022591989380a9] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_TypeXcdr1 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, \
+  0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x44, 0x2d, 0x90, 0xd4, 0xe4, 0x9d, 0xde, 0x02, 0x25, 0x91, 0x98, \
+  0x93, 0x80, 0xa9, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeXcdr1 100u
+#define TYPE_MAP_CDR_DataRepresentationTypes_TypeXcdr1 (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x69, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x44, 0x2d, 0x90, 0xd4, 0xe4, 0x9d, 0xde, \
+  0x02, 0x25, 0x91, 0x98, 0x93, 0x80, 0xa9, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, \
+  0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, \
+  0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x58, 0x63, 0x64, 0x72, 0x31, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x44, 0x2d, 0x90, 0xd4, 0xe4, 0x9d, 0xde, \
+  0x02, 0x25, 0x91, 0x98, 0x93, 0x80, 0xa9, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, \
+  0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeXcdr1 214u
+const dds_topic_descriptor_t DataRepresentationTypes_TypeXcdr1_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_TypeXcdr1),
+  .m_align = dds_alignof (DataRepresentationTypes_TypeXcdr1),
+  .m_flagset = DDS_TOPIC_RESTRICT_DATA_REPRESENTATION | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "DataRepresentationTypes::TypeXcdr1",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = DataRepresentationTypes_TypeXcdr1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_TypeXcdr1, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeXcdr1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_TypeXcdr1, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeXcdr1 },
+  .restrict_data_representation = (1u << DDS_DATA_REPRESENTATION_XCDR1)
+};
+
+static const uint32_t DataRepresentationTypes_TypeXcdr2_ops [] =
+{
+  /* TypeXcdr2 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_TypeXcdr2, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL f54b392e7940752e2b87b56816eb] (#deps: 0)
+  [COMPLETE 3d789ad95c86496cb98dfec4c104] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_TypeXcdr2 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, \
+  0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x3d, 0x78, 0x9a, 0xd9, 0x5c, 0x86, 0x49, 0x6c, 0xb9, 0x8d, 0xfe, \
+  0xc4, 0xc1, 0x04, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeXcdr2 100u
+#define TYPE_MAP_CDR_DataRepresentationTypes_TypeXcdr2 (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x69, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x3d, 0x78, 0x9a, 0xd9, 0x5c, 0x86, 0x49, \
+  0x6c, 0xb9, 0x8d, 0xfe, 0xc4, 0xc1, 0x04, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, \
+  0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, \
+  0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x58, 0x63, 0x64, 0x72, 0x32, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x3d, 0x78, 0x9a, 0xd9, 0x5c, 0x86, 0x49, \
+  0x6c, 0xb9, 0x8d, 0xfe, 0xc4, 0xc1, 0x04, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, \
+  0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeXcdr2 214u
+const dds_topic_descriptor_t DataRepresentationTypes_TypeXcdr2_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_TypeXcdr2),
+  .m_align = dds_alignof (DataRepresentationTypes_TypeXcdr2),
+  .m_flagset = DDS_TOPIC_RESTRICT_DATA_REPRESENTATION | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "DataRepresentationTypes::TypeXcdr2",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = DataRepresentationTypes_TypeXcdr2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_TypeXcdr2, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeXcdr2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_TypeXcdr2, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeXcdr2 },
+  .restrict_data_representation = (1u << DDS_DATA_REPRESENTATION_XCDR2)
+};
+
+static const uint32_t DataRepresentationTypes_TypeXcdr1_2_ops [] =
+{
+  /* TypeXcdr1_2 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_TypeXcdr1_2, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL f54b392e7940752e2b87b56816eb] (#deps: 0)
+  [COMPLETE 77aaac0f717d5a528ba38a5ef321] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_TypeXcdr1_2 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, \
+  0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x77, 0xaa, 0xac, 0x0f, 0x71, 0x7d, 0x5a, 0x52, 0x8b, 0xa3, 0x8a, \
+  0x5e, 0xf3, 0x21, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeXcdr1_2 100u
+#define TYPE_MAP_CDR_DataRepresentationTypes_TypeXcdr1_2 (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x6d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x77, 0xaa, 0xac, 0x0f, 0x71, 0x7d, 0x5a, \
+  0x52, 0x8b, 0xa3, 0x8a, 0x5e, 0xf3, 0x21, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, \
+  0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, \
+  0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x58, 0x63, 0x64, 0x72, 0x31, 0x5f, 0x32, \
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x77, 0xaa, 0xac, \
+  0x0f, 0x71, 0x7d, 0x5a, 0x52, 0x8b, 0xa3, 0x8a, 0x5e, 0xf3, 0x21, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, \
+  0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeXcdr1_2 218u
+const dds_topic_descriptor_t DataRepresentationTypes_TypeXcdr1_2_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_TypeXcdr1_2),
+  .m_align = dds_alignof (DataRepresentationTypes_TypeXcdr1_2),
+  .m_flagset = DDS_TOPIC_RESTRICT_DATA_REPRESENTATION | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "DataRepresentationTypes::TypeXcdr1_2",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = DataRepresentationTypes_TypeXcdr1_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_TypeXcdr1_2, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeXcdr1_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_TypeXcdr1_2, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeXcdr1_2 },
+  .restrict_data_representation = (1u << DDS_DATA_REPRESENTATION_XCDR1) | (1u << DDS_DATA_REPRESENTATION_XCDR2)
+};
+
+static const uint32_t DataRepresentationTypes_TypeXcdr1_xml_2_ops [] =
+{
+  /* TypeXcdr1_xml_2 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_TypeXcdr1_xml_2, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL f54b392e7940752e2b87b56816eb] (#deps: 0)
+  [COMPLETE a1da1e5a9d370d83e00ad2d543af] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_TypeXcdr1_xml_2 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, \
+  0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xa1, 0xda, 0x1e, 0x5a, 0x9d, 0x37, 0x0d, 0x83, 0xe0, 0x0a, 0xd2, \
+  0xd5, 0x43, 0xaf, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeXcdr1_xml_2 100u
+#define TYPE_MAP_CDR_DataRepresentationTypes_TypeXcdr1_xml_2 (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x71, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xa1, 0xda, 0x1e, 0x5a, 0x9d, 0x37, 0x0d, \
+  0x83, 0xe0, 0x0a, 0xd2, 0xd5, 0x43, 0xaf, 0x00, 0x59, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, \
+  0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, \
+  0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x58, 0x63, 0x64, 0x72, 0x31, 0x5f, 0x78, \
+  0x6d, 0x6c, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xa1, 0xda, 0x1e, 0x5a, 0x9d, 0x37, 0x0d, 0x83, 0xe0, 0x0a, 0xd2, 0xd5, 0x43, 0xaf, 0xf1, \
+  0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeXcdr1_xml_2 222u
+const dds_topic_descriptor_t DataRepresentationTypes_TypeXcdr1_xml_2_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_TypeXcdr1_xml_2),
+  .m_align = dds_alignof (DataRepresentationTypes_TypeXcdr1_xml_2),
+  .m_flagset = DDS_TOPIC_RESTRICT_DATA_REPRESENTATION | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "DataRepresentationTypes::TypeXcdr1_xml_2",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = DataRepresentationTypes_TypeXcdr1_xml_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_TypeXcdr1_xml_2, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeXcdr1_xml_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_TypeXcdr1_xml_2, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeXcdr1_xml_2 },
+  .restrict_data_representation = (1u << DDS_DATA_REPRESENTATION_XCDR1) | (1u << DDS_DATA_REPRESENTATION_XCDR2)
+};
+
+static const uint32_t DataRepresentationTypes_TypeXcdr1_other_ops [] =
+{
+  /* TypeXcdr1_other */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_TypeXcdr1_other, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL f54b392e7940752e2b87b56816eb] (#deps: 0)
+  [COMPLETE b109224a449a6f0970ad7ddd854c] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_TypeXcdr1_other (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, \
+  0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xb1, 0x09, 0x22, 0x4a, 0x44, 0x9a, 0x6f, 0x09, 0x70, 0xad, 0x7d, \
+  0xdd, 0x85, 0x4c, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeXcdr1_other 100u
+#define TYPE_MAP_CDR_DataRepresentationTypes_TypeXcdr1_other (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x71, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xb1, 0x09, 0x22, 0x4a, 0x44, 0x9a, 0x6f, \
+  0x09, 0x70, 0xad, 0x7d, 0xdd, 0x85, 0x4c, 0x00, 0x59, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, \
+  0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, \
+  0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x58, 0x63, 0x64, 0x72, 0x31, 0x5f, 0x6f, \
+  0x74, 0x68, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xb1, 0x09, 0x22, 0x4a, 0x44, 0x9a, 0x6f, 0x09, 0x70, 0xad, 0x7d, 0xdd, 0x85, 0x4c, 0xf1, \
+  0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeXcdr1_other 222u
+const dds_topic_descriptor_t DataRepresentationTypes_TypeXcdr1_other_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_TypeXcdr1_other),
+  .m_align = dds_alignof (DataRepresentationTypes_TypeXcdr1_other),
+  .m_flagset = DDS_TOPIC_RESTRICT_DATA_REPRESENTATION | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "DataRepresentationTypes::TypeXcdr1_other",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = DataRepresentationTypes_TypeXcdr1_other_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_TypeXcdr1_other, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeXcdr1_other },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_TypeXcdr1_other, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeXcdr1_other },
+  .restrict_data_representation = (1u << DDS_DATA_REPRESENTATION_XCDR1)
+};
+
+static const uint32_t DataRepresentationTypes_TypeXcdr2_other_ops [] =
+{
+  /* TypeXcdr2_other */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_TypeXcdr2_other, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL f54b392e7940752e2b87b56816eb] (#deps: 0)
+  [COMPLETE a908fc2346beb3415355e05924e9] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_TypeXcdr2_other (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, \
+  0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xa9, 0x08, 0xfc, 0x23, 0x46, 0xbe, 0xb3, 0x41, 0x53, 0x55, 0xe0, \
+  0x59, 0x24, 0xe9, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeXcdr2_other 100u
+#define TYPE_MAP_CDR_DataRepresentationTypes_TypeXcdr2_other (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x71, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xa9, 0x08, 0xfc, 0x23, 0x46, 0xbe, 0xb3, \
+  0x41, 0x53, 0x55, 0xe0, 0x59, 0x24, 0xe9, 0x00, 0x59, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, \
+  0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, \
+  0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x58, 0x63, 0x64, 0x72, 0x32, 0x5f, 0x6f, \
+  0x74, 0x68, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xa9, 0x08, 0xfc, 0x23, 0x46, 0xbe, 0xb3, 0x41, 0x53, 0x55, 0xe0, 0x59, 0x24, 0xe9, 0xf1, \
+  0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeXcdr2_other 222u
+const dds_topic_descriptor_t DataRepresentationTypes_TypeXcdr2_other_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_TypeXcdr2_other),
+  .m_align = dds_alignof (DataRepresentationTypes_TypeXcdr2_other),
+  .m_flagset = DDS_TOPIC_RESTRICT_DATA_REPRESENTATION | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "DataRepresentationTypes::TypeXcdr2_other",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = DataRepresentationTypes_TypeXcdr2_other_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_TypeXcdr2_other, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeXcdr2_other },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_TypeXcdr2_other, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeXcdr2_other },
+  .restrict_data_representation = (1u << DDS_DATA_REPRESENTATION_XCDR2)
+};
+
+static const uint32_t DataRepresentationTypes_TypeXcdrA2_ops [] =
+{
+  /* TypeXcdrA2 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_TypeXcdrA2, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 5472d80f8549173aaed47a3f5dd3] (#deps: 0)
+  [COMPLETE 460bca88c8c6d2c0474cd67c13c3] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_TypeXcdrA2 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, 0x3a, 0xae, 0xd4, 0x7a, \
+  0x3f, 0x5d, 0xd3, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x46, 0x0b, 0xca, 0x88, 0xc8, 0xc6, 0xd2, 0xc0, 0x47, 0x4c, 0xd6, \
+  0x7c, 0x13, 0xc3, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeXcdrA2 100u
+#define TYPE_MAP_CDR_DataRepresentationTypes_TypeXcdrA2 (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, \
+  0x3a, 0xae, 0xd4, 0x7a, 0x3f, 0x5d, 0xd3, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x69, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x46, 0x0b, 0xca, 0x88, 0xc8, 0xc6, 0xd2, \
+  0xc0, 0x47, 0x4c, 0xd6, 0x7c, 0x13, 0xc3, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, \
+  0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, \
+  0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x58, 0x63, 0x64, 0x72, 0x41, 0x32, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x46, 0x0b, 0xca, 0x88, 0xc8, 0xc6, 0xd2, \
+  0xc0, 0x47, 0x4c, 0xd6, 0x7c, 0x13, 0xc3, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, 0x3a, \
+  0xae, 0xd4, 0x7a, 0x3f, 0x5d, 0xd3\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeXcdrA2 214u
+const dds_topic_descriptor_t DataRepresentationTypes_TypeXcdrA2_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_TypeXcdrA2),
+  .m_align = dds_alignof (DataRepresentationTypes_TypeXcdrA2),
+  .m_flagset = DDS_TOPIC_RESTRICT_DATA_REPRESENTATION | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "DataRepresentationTypes::TypeXcdrA2",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = DataRepresentationTypes_TypeXcdrA2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_TypeXcdrA2, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeXcdrA2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_TypeXcdrA2, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeXcdrA2 },
+  .restrict_data_representation = (1u << DDS_DATA_REPRESENTATION_XCDR2)
+};
+
+static const uint32_t DataRepresentationTypes_TypeXcdrA1_2_ops [] =
+{
+  /* TypeXcdrA1_2 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (DataRepresentationTypes_TypeXcdrA1_2, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 5472d80f8549173aaed47a3f5dd3] (#deps: 0)
+  [COMPLETE b0df2483b89e4f13b5247fd26353] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_DataRepresentationTypes_TypeXcdrA1_2 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, 0x3a, 0xae, 0xd4, 0x7a, \
+  0x3f, 0x5d, 0xd3, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xb0, 0xdf, 0x24, 0x83, 0xb8, 0x9e, 0x4f, 0x13, 0xb5, 0x24, 0x7f, \
+  0xd2, 0x63, 0x53, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeXcdrA1_2 100u
+#define TYPE_MAP_CDR_DataRepresentationTypes_TypeXcdrA1_2 (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, \
+  0x3a, 0xae, 0xd4, 0x7a, 0x3f, 0x5d, 0xd3, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x6d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xb0, 0xdf, 0x24, 0x83, 0xb8, 0x9e, 0x4f, \
+  0x13, 0xb5, 0x24, 0x7f, 0xd2, 0x63, 0x53, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x44, 0x61, 0x74, 0x61, \
+  0x52, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x54, 0x79, \
+  0x70, 0x65, 0x73, 0x3a, 0x3a, 0x54, 0x79, 0x70, 0x65, 0x58, 0x63, 0x64, 0x72, 0x41, 0x31, 0x5f, \
+  0x32, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xb0, 0xdf, 0x24, \
+  0x83, 0xb8, 0x9e, 0x4f, 0x13, 0xb5, 0x24, 0x7f, 0xd2, 0x63, 0x53, 0xf1, 0x54, 0x72, 0xd8, 0x0f, \
+  0x85, 0x49, 0x17, 0x3a, 0xae, 0xd4, 0x7a, 0x3f, 0x5d, 0xd3\
+}
+#define TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeXcdrA1_2 218u
+const dds_topic_descriptor_t DataRepresentationTypes_TypeXcdrA1_2_desc =
+{
+  .m_size = sizeof (DataRepresentationTypes_TypeXcdrA1_2),
+  .m_align = dds_alignof (DataRepresentationTypes_TypeXcdrA1_2),
+  .m_flagset = DDS_TOPIC_RESTRICT_DATA_REPRESENTATION | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "DataRepresentationTypes::TypeXcdrA1_2",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = DataRepresentationTypes_TypeXcdrA1_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_DataRepresentationTypes_TypeXcdrA1_2, .sz = TYPE_INFO_CDR_SZ_DataRepresentationTypes_TypeXcdrA1_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_DataRepresentationTypes_TypeXcdrA1_2, .sz = TYPE_MAP_CDR_SZ_DataRepresentationTypes_TypeXcdrA1_2 },
+  .restrict_data_representation = (1u << DDS_DATA_REPRESENTATION_XCDR1) | (1u << DDS_DATA_REPRESENTATION_XCDR2)
+};
+
@@ -0,0 +1,484 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_debug_build/src/core/ddsc/tests/FilterExprTypes.c
+  Source: /root/repo/src/core/ddsc/tests/FilterExprTypes.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "FilterExprTypes.h"
+
+static const uint32_t FilterExprTypes_coord_ops [] =
+{
+  /* coord */
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (FilterExprTypes_coord, x),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (FilterExprTypes_coord, y),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL eaebffeba577e613f97b2084b26c] (#deps: 0)
+  [COMPLETE dffd597e5a3cf39babc35f8b3398] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_FilterExprTypes_coord (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xea, 0xeb, 0xff, 0xeb, 0xa5, 0x77, 0xe6, 0x13, 0xf9, 0x7b, 0x20, \
+  0x84, 0xb2, 0x6c, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xdf, 0xfd, 0x59, 0x7e, 0x5a, 0x3c, 0xf3, 0x9b, 0xab, 0xc3, 0x5f, \
+  0x8b, 0x33, 0x98, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_FilterExprTypes_coord 100u
+#define TYPE_MAP_CDR_FilterExprTypes_coord (unsigned char []){ \
+  0x4b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xea, 0xeb, 0xff, 0xeb, 0xa5, 0x77, 0xe6, \
+  0x13, 0xf9, 0x7b, 0x20, 0x84, 0xb2, 0x6c, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x9d, 0xd4, 0xe4, 0x61, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x41, 0x52, 0x90, 0x76, 0x00, \
+  0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xdf, 0xfd, 0x59, 0x7e, 0x5a, 0x3c, 0xf3, \
+  0x9b, 0xab, 0xc3, 0x5f, 0x8b, 0x33, 0x98, 0x00, 0x58, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x46, 0x69, 0x6c, 0x74, \
+  0x65, 0x72, 0x45, 0x78, 0x70, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x63, 0x6f, 0x6f, \
+  0x72, 0x64, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x79, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xdf, 0xfd, 0x59, \
+  0x7e, 0x5a, 0x3c, 0xf3, 0x9b, 0xab, 0xc3, 0x5f, 0x8b, 0x33, 0x98, 0xf1, 0xea, 0xeb, 0xff, 0xeb, \
+  0xa5, 0x77, 0xe6, 0x13, 0xf9, 0x7b, 0x20, 0x84, 0xb2, 0x6c\
+}
+#define TYPE_MAP_CDR_SZ_FilterExprTypes_coord 234u
+const dds_topic_descriptor_t FilterExprTypes_coord_desc =
+{
+  .m_size = sizeof (FilterExprTypes_coord),
+  .m_align = dds_alignof (FilterExprTypes_coord),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "FilterExprTypes::coord",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = FilterExprTypes_coord_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_FilterExprTypes_coord, .sz = TYPE_INFO_CDR_SZ_FilterExprTypes_coord },
+  .type_mapping = { .data = TYPE_MAP_CDR_FilterExprTypes_coord, .sz = TYPE_MAP_CDR_SZ_FilterExprTypes_coord }
+};
+
+static const uint32_t FilterExprTypes_fixed_type_ops [] =
+{
+  /* fixed_type */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (FilterExprTypes_fixed_type, id),
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (FilterExprTypes_fixed_type, c), 2u,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (FilterExprTypes_fixed_type, pos), (3u << 16u) + 14u /* coord */,
+  DDS_OP_ADR | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (FilterExprTypes_fixed_type, level),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY, offsetof (FilterExprTypes_fixed_type, count),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (FilterExprTypes_fixed_type, flag),
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (FilterExprTypes_fixed_type, on),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_FP, offsetof (FilterExprTypes_fixed_type, ratio),
+  DDS_OP_RTS,
+
+  /* coord */
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (FilterExprTypes_coord, x),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (FilterExprTypes_coord, y),
+  DDS_OP_RTS,
+  
+  /* key: id */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t FilterExprTypes_fixed_type_keys[1] =
+{
+  { "id", 24, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 609f202389b181ca3592373a62df] (#deps: 2)
+   - [MINIMAL 75669210362875edafa63f866d05]
+   - [MINIMAL eaebffeba577e613f97b2084b26c]
+  [COMPLETE 4e158e9a6ccdc699e4017332a858] (#deps: 2)
+   - [COMPLETE 1d0f4f8aa042aec9b590787a069d]
+   - [COMPLETE dffd597e5a3cf39babc35f8b3398]
+*/
+#define TYPE_INFO_CDR_FilterExprTypes_fixed_type (unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x60, 0x9f, 0x20, 0x23, 0x89, 0xb1, 0x81, 0xca, 0x35, 0x92, 0x37, \
+  0x3a, 0x62, 0xdf, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x75, 0x66, 0x92, 0x10, 0x36, 0x28, 0x75, \
+  0xed, 0xaf, 0xa6, 0x3f, 0x86, 0x6d, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xea, 0xeb, 0xff, 0xeb, 0xa5, 0x77, 0xe6, 0x13, 0xf9, 0x7b, 0x20, 0x84, 0xb2, 0x6c, 0x00, \
+  0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x4e, 0x15, 0x8e, 0x9a, 0x6c, 0xcd, 0xc6, 0x99, 0xe4, 0x01, 0x73, \
+  0x32, 0xa8, 0x58, 0x00, 0x14, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x1d, 0x0f, 0x4f, 0x8a, 0xa0, 0x42, 0xae, \
+  0xc9, 0xb5, 0x90, 0x78, 0x7a, 0x06, 0x9d, 0x00, 0x87, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xdf, 0xfd, 0x59, 0x7e, 0x5a, 0x3c, 0xf3, 0x9b, 0xab, 0xc3, 0x5f, 0x8b, 0x33, 0x98, 0x00, \
+  0x5c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_FilterExprTypes_fixed_type 196u
+#define TYPE_MAP_CDR_FilterExprTypes_fixed_type (unsigned char []){ \
+  0x77, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x60, 0x9f, 0x20, 0x23, 0x89, 0xb1, 0x81, \
+  0xca, 0x35, 0x92, 0x37, 0x3a, 0x62, 0xdf, 0x00, 0xb3, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0xb8, 0x0b, 0xb7, 0x74, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x75, 0x66, 0x92, 0x10, 0x36, \
+  0x28, 0x75, 0xed, 0xaf, 0xa6, 0x3f, 0x86, 0x6d, 0x05, 0x4a, 0x8a, 0x08, 0xf0, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xea, 0xeb, 0xff, 0xeb, 0xa5, \
+  0x77, 0xe6, 0x13, 0xf9, 0x7b, 0x20, 0x84, 0xb2, 0x6c, 0x5e, 0x0b, 0xdc, 0xbd, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0xc9, 0xe9, 0xa8, 0x48, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0xe2, 0x94, 0x2a, 0x04, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x32, 0x7a, 0x6c, 0x43, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0xed, 0x2b, 0x5c, 0x01, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x82, 0x83, 0x01, 0x4e, 0xf1, \
+  0x75, 0x66, 0x92, 0x10, 0x36, 0x28, 0x75, 0xed, 0xaf, 0xa6, 0x3f, 0x86, 0x6d, 0x05, 0x00, 0x00, \
+  0x4e, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x3e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xd9, 0x54, 0x7b, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xe0, 0xe5, 0xdd, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x3e, \
+  0x1e, 0xe9, 0xf1, 0xea, 0xeb, 0xff, 0xeb, 0xa5, 0x77, 0xe6, 0x13, 0xf9, 0x7b, 0x20, 0x84, 0xb2, \
+  0x6c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x9d, 0xd4, 0xe4, 0x61, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x41, 0x52, 0x90, 0x76, 0x00, 0x2c, 0x02, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0x4e, 0x15, 0x8e, 0x9a, 0x6c, 0xcd, 0xc6, 0x99, 0xe4, 0x01, 0x73, \
+  0x32, 0xa8, 0x58, 0x00, 0x10, 0x01, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x46, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x45, 0x78, \
+  0x70, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x66, 0x69, 0x78, 0x65, 0x64, 0x5f, 0x74, \
+  0x79, 0x70, 0x65, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x69, 0x64, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x1d, \
+  0x0f, 0x4f, 0x8a, 0xa0, 0x42, 0xae, 0xc9, 0xb5, 0x90, 0x78, 0x7a, 0x06, 0x9d, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xdf, 0xfd, 0x59, 0x7e, 0x5a, 0x3c, 0xf3, 0x9b, 0xab, 0xc3, 0x5f, 0x8b, 0x33, \
+  0x98, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x70, 0x6f, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x6c, 0x65, 0x76, 0x65, 0x6c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x00, 0x00, 0x00, \
+  0x13, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x66, 0x6c, 0x61, 0x67, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x6f, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x72, 0x61, 0x74, 0x69, 0x6f, 0x00, 0x00, 0x00, 0xf2, 0x1d, 0x0f, 0x4f, 0x8a, 0xa0, 0x42, 0xae, \
+  0xc9, 0xb5, 0x90, 0x78, 0x7a, 0x06, 0x9d, 0x00, 0x83, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x46, 0x69, 0x6c, 0x74, \
+  0x65, 0x72, 0x45, 0x78, 0x70, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x63, 0x6f, 0x6c, \
+  0x6f, 0x72, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x52, 0x45, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x47, 0x52, 0x45, 0x45, \
+  0x4e, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x42, 0x4c, 0x55, 0x45, 0x00, 0x00, 0x00, 0xf2, \
+  0xdf, 0xfd, 0x59, 0x7e, 0x5a, 0x3c, 0xf3, 0x9b, 0xab, 0xc3, 0x5f, 0x8b, 0x33, 0x98, 0x00, 0x00, \
+  0x58, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x46, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x45, 0x78, 0x70, 0x72, 0x54, 0x79, \
+  0x70, 0x65, 0x73, 0x3a, 0x3a, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0x4e, 0x15, 0x8e, 0x9a, 0x6c, 0xcd, 0xc6, 0x99, 0xe4, 0x01, 0x73, \
+  0x32, 0xa8, 0x58, 0xf1, 0x60, 0x9f, 0x20, 0x23, 0x89, 0xb1, 0x81, 0xca, 0x35, 0x92, 0x37, 0x3a, \
+  0x62, 0xdf, 0xf2, 0x1d, 0x0f, 0x4f, 0x8a, 0xa0, 0x42, 0xae, 0xc9, 0xb5, 0x90, 0x78, 0x7a, 0x06, \
+  0x9d, 0xf1, 0x75, 0x66, 0x92, 0x10, 0x36, 0x28, 0x75, 0xed, 0xaf, 0xa6, 0x3f, 0x86, 0x6d, 0x05, \
+  0xf2, 0xdf, 0xfd, 0x59, 0x7e, 0x5a, 0x3c, 0xf3, 0x9b, 0xab, 0xc3, 0x5f, 0x8b, 0x33, 0x98, 0xf1, \
+  0xea, 0xeb, 0xff, 0xeb, 0xa5, 0x77, 0xe6, 0x13, 0xf9, 0x7b, 0x20, 0x84, 0xb2, 0x6c\
+}
+#define TYPE_MAP_CDR_SZ_FilterExprTypes_fixed_type 1038u
+const dds_topic_descriptor_t FilterExprTypes_fixed_type_desc =
+{
+  .m_size = sizeof (FilterExprTypes_fixed_type),
+  .m_align = dds_alignof (FilterExprTypes_fixed_type),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "FilterExprTypes::fixed_type",
+  .m_keys = FilterExprTypes_fixed_type_keys,
+  .m_nops = 12,
+  .m_ops = FilterExprTypes_fixed_type_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_FilterExprTypes_fixed_type, .sz = TYPE_INFO_CDR_SZ_FilterExprTypes_fixed_type },
+  .type_mapping = { .data = TYPE_MAP_CDR_FilterExprTypes_fixed_type, .sz = TYPE_MAP_CDR_SZ_FilterExprTypes_fixed_type }
+};
+
+static const uint32_t FilterExprTypes_strings_type_ops [] =
+{
+  /* strings_type */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (FilterExprTypes_strings_type, id),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (FilterExprTypes_strings_type, name),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (FilterExprTypes_strings_type, values),
+  DDS_OP_ADR | DDS_OP_TYPE_BST, offsetof (FilterExprTypes_strings_type, label), 9u,
+  DDS_OP_ADR | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (FilterExprTypes_strings_type, after),
+  DDS_OP_RTS,
+  
+  /* key: id */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t FilterExprTypes_strings_type_keys[1] =
+{
+  { "id", 12, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 1b12c0db210bec5ac31dfcbfbd67] (#deps: 0)
+  [COMPLETE 5e604f56da4875adea6e56d8f21c] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_FilterExprTypes_strings_type (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x1b, 0x12, 0xc0, 0xdb, 0x21, 0x0b, 0xec, 0x5a, 0xc3, 0x1d, 0xfc, \
+  0xbf, 0xbd, 0x67, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x5e, 0x60, 0x4f, 0x56, 0xda, 0x48, 0x75, 0xad, 0xea, 0x6e, 0x56, \
+  0xd8, 0xf2, 0x1c, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_FilterExprTypes_strings_type 100u
+#define TYPE_MAP_CDR_FilterExprTypes_strings_type (unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x1b, 0x12, 0xc0, 0xdb, 0x21, 0x0b, 0xec, \
+  0x5a, 0xc3, 0x1d, 0xfc, 0xbf, 0xbd, 0x67, 0x00, 0x67, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0xb8, 0x0b, 0xb7, 0x74, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0xb0, 0x68, 0x93, 0x1c, \
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, \
+  0xf0, 0x9c, 0xc7, 0xee, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x08, \
+  0xd3, 0x04, 0xba, 0x20, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x63, \
+  0x2a, 0x24, 0x06, 0x00, 0xd0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x5e, 0x60, 0x4f, \
+  0x56, 0xda, 0x48, 0x75, 0xad, 0xea, 0x6e, 0x56, 0xd8, 0xf2, 0x1c, 0x00, 0xb8, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x46, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x45, 0x78, 0x70, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, \
+  0x3a, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x73, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, \
+  0x84, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x07, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75, \
+  0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x08, 0x06, 0x00, 0x00, 0x00, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x61, 0x66, 0x74, 0x65, 0x72, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x5e, 0x60, 0x4f, 0x56, 0xda, 0x48, 0x75, 0xad, 0xea, 0x6e, 0x56, 0xd8, 0xf2, 0x1c, 0xf1, \
+  0x1b, 0x12, 0xc0, 0xdb, 0x21, 0x0b, 0xec, 0x5a, 0xc3, 0x1d, 0xfc, 0xbf, 0xbd, 0x67\
+}
+#define TYPE_MAP_CDR_SZ_FilterExprTypes_strings_type 382u
+const dds_topic_descriptor_t FilterExprTypes_strings_type_desc =
+{
+  .m_size = sizeof (FilterExprTypes_strings_type),
+  .m_align = dds_alignof (FilterExprTypes_strings_type),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "FilterExprTypes::strings_type",
+  .m_keys = FilterExprTypes_strings_type_keys,
+  .m_nops = 6,
+  .m_ops = FilterExprTypes_strings_type_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_FilterExprTypes_strings_type, .sz = TYPE_INFO_CDR_SZ_FilterExprTypes_strings_type },
+  .type_mapping = { .data = TYPE_MAP_CDR_FilterExprTypes_strings_type, .sz = TYPE_MAP_CDR_SZ_FilterExprTypes_strings_type }
+};
+
+static const uint32_t FilterExprTypes_variable_type_ops [] =
+{
+  /* variable_type */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (FilterExprTypes_variable_type, id),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (FilterExprTypes_variable_type, name),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (FilterExprTypes_variable_type, values),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (FilterExprTypes_variable_type, opt),
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (FilterExprTypes_variable_type, c), 2u,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (FilterExprTypes_variable_type, pos), (3u << 16u) + 4u /* coord */,
+  DDS_OP_RTS,
+
+  /* coord */
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (FilterExprTypes_coord, x),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (FilterExprTypes_coord, y),
+  DDS_OP_RTS,
+  
+  /* key: id */
+  DDS_OP_KOF | 1, 1u /* order: 0 */
+};
+
+static const dds_key_descriptor_t FilterExprTypes_variable_type_keys[1] =
+{
+  { "id", 21, 0 }
+};
+
+/* Type Information:
+  [MINIMAL a3284cca5986248392639e8656ae] (#deps: 2)
+   - [MINIMAL 75669210362875edafa63f866d05]
+   - [MINIMAL eaebffeba577e613f97b2084b26c]
+  [COMPLETE 0a6c0a008bde767997f841faad0b] (#deps: 2)
+   - [COMPLETE 1d0f4f8aa042aec9b590787a069d]
+   - [COMPLETE dffd597e5a3cf39babc35f8b3398]
+*/
+#define TYPE_INFO_CDR_FilterExprTypes_variable_type (unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xa3, 0x28, 0x4c, 0xca, 0x59, 0x86, 0x24, 0x83, 0x92, 0x63, 0x9e, \
+  0x86, 0x56, 0xae, 0x00, 0x99, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x75, 0x66, 0x92, 0x10, 0x36, 0x28, 0x75, \
+  0xed, 0xaf, 0xa6, 0x3f, 0x86, 0x6d, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xea, 0xeb, 0xff, 0xeb, 0xa5, 0x77, 0xe6, 0x13, 0xf9, 0x7b, 0x20, 0x84, 0xb2, 0x6c, 0x00, \
+  0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x0a, 0x6c, 0x0a, 0x00, 0x8b, 0xde, 0x76, 0x79, 0x97, 0xf8, 0x41, \
+  0xfa, 0xad, 0x0b, 0x00, 0xee, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x1d, 0x0f, 0x4f, 0x8a, 0xa0, 0x42, 0xae, \
+  0xc9, 0xb5, 0x90, 0x78, 0x7a, 0x06, 0x9d, 0x00, 0x87, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xdf, 0xfd, 0x59, 0x7e, 0x5a, 0x3c, 0xf3, 0x9b, 0xab, 0xc3, 0x5f, 0x8b, 0x33, 0x98, 0x00, \
+  0x5c, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_FilterExprTypes_variable_type 196u
+#define TYPE_MAP_CDR_FilterExprTypes_variable_type (unsigned char []){ \
+  0x57, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0xa3, 0x28, 0x4c, 0xca, 0x59, 0x86, 0x24, \
+  0x83, 0x92, 0x63, 0x9e, 0x86, 0x56, 0xae, 0x00, 0x95, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0xb8, 0x0b, 0xb7, 0x74, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0xb0, 0x68, 0x93, 0x1c, \
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, \
+  0xf0, 0x9c, 0xc7, 0xee, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x04, 0x4d, \
+  0x29, 0xea, 0x5f, 0x00, 0x19, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x75, \
+  0x66, 0x92, 0x10, 0x36, 0x28, 0x75, 0xed, 0xaf, 0xa6, 0x3f, 0x86, 0x6d, 0x05, 0x4a, 0x8a, 0x08, \
+  0xf0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xea, \
+  0xeb, 0xff, 0xeb, 0xa5, 0x77, 0xe6, 0x13, 0xf9, 0x7b, 0x20, 0x84, 0xb2, 0x6c, 0x5e, 0x0b, 0xdc, \
+  0xbd, 0xf1, 0x75, 0x66, 0x92, 0x10, 0x36, 0x28, 0x75, 0xed, 0xaf, 0xa6, 0x3f, 0x86, 0x6d, 0x05, \
+  0x4e, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x3e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xd9, 0x54, 0x7b, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xe0, 0xe5, 0xdd, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x3e, \
+  0x1e, 0xe9, 0xf1, 0xea, 0xeb, 0xff, 0xeb, 0xa5, 0x77, 0xe6, 0x13, 0xf9, 0x7b, 0x20, 0x84, 0xb2, \
+  0x6c, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x9d, 0xd4, 0xe4, 0x61, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x41, 0x52, 0x90, 0x76, 0x00, 0x08, 0x02, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0x0a, 0x6c, 0x0a, 0x00, 0x8b, 0xde, 0x76, 0x79, 0x97, 0xf8, 0x41, \
+  0xfa, 0xad, 0x0b, 0x00, 0xea, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, 0x27, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x46, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x45, 0x78, \
+  0x70, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, \
+  0x65, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x00, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, \
+  0x07, 0x00, 0x00, 0x00, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x6f, 0x70, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x1d, 0x0f, 0x4f, 0x8a, 0xa0, 0x42, 0xae, 0xc9, 0xb5, 0x90, 0x78, 0x7a, 0x06, \
+  0x9d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xdf, 0xfd, 0x59, 0x7e, 0x5a, 0x3c, 0xf3, 0x9b, 0xab, \
+  0xc3, 0x5f, 0x8b, 0x33, 0x98, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x70, 0x6f, 0x73, 0x00, \
+  0x00, 0x00, 0xf2, 0x1d, 0x0f, 0x4f, 0x8a, 0xa0, 0x42, 0xae, 0xc9, 0xb5, 0x90, 0x78, 0x7a, 0x06, \
+  0x9d, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x46, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x45, 0x78, \
+  0x70, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x00, 0x00, \
+  0x57, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x52, 0x45, 0x44, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x47, 0x52, 0x45, 0x45, 0x4e, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x42, 0x4c, 0x55, 0x45, 0x00, 0x00, 0x00, 0xf2, 0xdf, 0xfd, 0x59, 0x7e, \
+  0x5a, 0x3c, 0xf3, 0x9b, 0xab, 0xc3, 0x5f, 0x8b, 0x33, 0x98, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x46, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x45, 0x78, 0x70, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, \
+  0x3a, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x78, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0xf2, 0x0a, 0x6c, 0x0a, 0x00, 0x8b, 0xde, 0x76, 0x79, 0x97, 0xf8, 0x41, 0xfa, 0xad, 0x0b, 0xf1, \
+  0xa3, 0x28, 0x4c, 0xca, 0x59, 0x86, 0x24, 0x83, 0x92, 0x63, 0x9e, 0x86, 0x56, 0xae, 0xf2, 0x1d, \
+  0x0f, 0x4f, 0x8a, 0xa0, 0x42, 0xae, 0xc9, 0xb5, 0x90, 0x78, 0x7a, 0x06, 0x9d, 0xf1, 0x75, 0x66, \
+  0x92, 0x10, 0x36, 0x28, 0x75, 0xed, 0xaf, 0xa6, 0x3f, 0x86, 0x6d, 0x05, 0xf2, 0xdf, 0xfd, 0x59, \
+  0x7e, 0x5a, 0x3c, 0xf3, 0x9b, 0xab, 0xc3, 0x5f, 0x8b, 0x33, 0x98, 0xf1, 0xea, 0xeb, 0xff, 0xeb, \
+  0xa5, 0x77, 0xe6, 0x13, 0xf9, 0x7b, 0x20, 0x84, 0xb2, 0x6c\
+}
+#define TYPE_MAP_CDR_SZ_FilterExprTypes_variable_type 970u
+const dds_topic_descriptor_t FilterExprTypes_variable_type_desc =
+{
+  .m_size = sizeof (FilterExprTypes_variable_type),
+  .m_align = dds_alignof (FilterExprTypes_variable_type),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "FilterExprTypes::variable_type",
+  .m_keys = FilterExprTypes_variable_type_keys,
+  .m_nops = 11,
+  .m_ops = FilterExprTypes_variable_type_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_FilterExprTypes_variable_type, .sz = TYPE_INFO_CDR_SZ_FilterExprTypes_variable_type },
+  .type_mapping = { .data = TYPE_MAP_CDR_FilterExprTypes_variable_type, .sz = TYPE_MAP_CDR_SZ_FilterExprTypes_variable_type }
+};
+
+static const uint32_t FilterExprTypes_mutable_type_ops [] =
+{
+  /* mutable_type */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 9, 0u,
+  DDS_OP_PLM | 10, 1u,
+  DDS_OP_PLM | 11, 2u,
+  DDS_OP_PLM | 12, 3u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (FilterExprTypes_mutable_type, id),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_1BY, offsetof (FilterExprTypes_mutable_type, blob),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (FilterExprTypes_mutable_type, name),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (FilterExprTypes_mutable_type, big),
+  DDS_OP_RTS,
+  
+  /* key: id */
+  DDS_OP_KOF | 1, 10u /* order: 0 */
+};
+
+static const dds_key_descriptor_t FilterExprTypes_mutable_type_keys[1] =
+{
+  { "id", 22, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 5bf0ba804b875f74cf2d6260c016] (#deps: 0)
+  [COMPLETE 0b8a0c22268b130047037d1c6632] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_FilterExprTypes_mutable_type (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x5b, 0xf0, 0xba, 0x80, 0x4b, 0x87, 0x5f, 0x74, 0xcf, 0x2d, 0x62, \
+  0x60, 0xc0, 0x16, 0x00, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x0b, 0x8a, 0x0c, 0x22, 0x26, 0x8b, 0x13, 0x00, 0x47, 0x03, 0x7d, \
+  0x1c, 0x66, 0x32, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_FilterExprTypes_mutable_type 100u
+#define TYPE_MAP_CDR_FilterExprTypes_mutable_type (unsigned char []){ \
+  0x6f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x5b, 0xf0, 0xba, 0x80, 0x4b, 0x87, 0x5f, \
+  0x74, 0xcf, 0x2d, 0x62, 0x60, 0xc0, 0x16, 0x00, 0x57, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0xb8, 0x0b, 0xb7, 0x74, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x02, \
+  0xee, 0x26, 0x90, 0x8b, 0x0c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, \
+  0xb0, 0x68, 0x93, 0x1c, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x05, 0xd8, \
+  0x61, 0x87, 0x7d, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x0b, 0x8a, 0x0c, \
+  0x22, 0x26, 0x8b, 0x13, 0x00, 0x47, 0x03, 0x7d, 0x1c, 0x66, 0x32, 0x00, 0x9a, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x04, 0x00, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, \
+  0x46, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x45, 0x78, 0x70, 0x72, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, \
+  0x3a, 0x6d, 0x75, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x00, 0x00, 0x00, \
+  0x66, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x02, \
+  0x05, 0x00, 0x00, 0x00, 0x62, 0x6c, 0x6f, 0x62, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x05, 0x00, 0x00, 0x00, 0x6e, 0x61, 0x6d, 0x65, \
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x09, 0x00, 0x05, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x62, 0x69, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x0b, 0x8a, 0x0c, 0x22, 0x26, 0x8b, 0x13, 0x00, 0x47, 0x03, 0x7d, \
+  0x1c, 0x66, 0x32, 0xf1, 0x5b, 0xf0, 0xba, 0x80, 0x4b, 0x87, 0x5f, 0x74, 0xcf, 0x2d, 0x62, 0x60, \
+  0xc0, 0x16\
+}
+#define TYPE_MAP_CDR_SZ_FilterExprTypes_mutable_type 338u
+const dds_topic_descriptor_t FilterExprTypes_mutable_type_desc =
+{
+  .m_size = sizeof (FilterExprTypes_mutable_type),
+  .m_align = dds_alignof (FilterExprTypes_mutable_type),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "FilterExprTypes::mutable_type",
+  .m_keys = FilterExprTypes_mutable_type_keys,
+  .m_nops = 10,
+  .m_ops = FilterExprTypes_mutable_type_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_FilterExprTypes_mutable_type, .sz = TYPE_INFO_CDR_SZ_FilterExprTypes_mutable_type },
+  .type_mapping = { .data = TYPE_MAP_CDR_FilterExprTypes_mutable_type, .sz = TYPE_MAP_CDR_SZ_FilterExprTypes_mutable_type }
+};
+
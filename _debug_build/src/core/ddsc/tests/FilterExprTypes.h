@@ -0,0 +1,168 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_debug_build/src/core/ddsc/tests/FilterExprTypes.h
+  Source: /root/repo/src/core/ddsc/tests/FilterExprTypes.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#ifndef DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_DDSC_TESTS_FILTEREXPRTYPES_H
+#define DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_DDSC_TESTS_FILTEREXPRTYPES_H
+
+#include "dds/ddsc/dds_public_impl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum FilterExprTypes_color
+{
+  FilterExprTypes_RED,
+  FilterExprTypes_GREEN,
+  FilterExprTypes_BLUE
+} FilterExprTypes_color;
+
+#define FilterExprTypes_color__alloc() \
+((FilterExprTypes_color*) dds_alloc (sizeof (FilterExprTypes_color)));
+
+typedef struct FilterExprTypes_coord
+{
+  double x;
+  double y;
+} FilterExprTypes_coord;
+
+extern const dds_topic_descriptor_t FilterExprTypes_coord_desc;
+
+#define FilterExprTypes_coord__alloc() \
+((FilterExprTypes_coord*) dds_alloc (sizeof (FilterExprTypes_coord)));
+
+#define FilterExprTypes_coord_free(d,o) \
+dds_sample_free ((d), &FilterExprTypes_coord_desc, (o))
+
+typedef struct FilterExprTypes_fixed_type
+{
+  int32_t id;
+  FilterExprTypes_color c;
+  struct FilterExprTypes_coord pos;
+  int16_t level;
+  uint64_t count;
+  char flag;
+  bool on;
+  float ratio;
+} FilterExprTypes_fixed_type;
+
+extern const dds_topic_descriptor_t FilterExprTypes_fixed_type_desc;
+
+#define FilterExprTypes_fixed_type__alloc() \
+((FilterExprTypes_fixed_type*) dds_alloc (sizeof (FilterExprTypes_fixed_type)));
+
+#define FilterExprTypes_fixed_type_free(d,o) \
+dds_sample_free ((d), &FilterExprTypes_fixed_type_desc, (o))
+
+#ifndef DDS_SEQUENCE_LONG_DEFINED
+#define DDS_SEQUENCE_LONG_DEFINED
+typedef struct dds_sequence_long
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  int32_t *_buffer;
+  bool _release;
+} dds_sequence_long;
+
+#define dds_sequence_long__alloc() \
+((dds_sequence_long*) dds_alloc (sizeof (dds_sequence_long)));
+
+#define dds_sequence_long_allocbuf(l) \
+((int32_t *) dds_alloc ((l) * sizeof (int32_t)))
+#endif /* DDS_SEQUENCE_LONG_DEFINED */
+
+typedef struct FilterExprTypes_strings_type
+{
+  int32_t id;
+  char * name;
+  dds_sequence_long values;
+  char label[9];
+  int16_t after;
+} FilterExprTypes_strings_type;
+
+extern const dds_topic_descriptor_t FilterExprTypes_strings_type_desc;
+
+#define FilterExprTypes_strings_type__alloc() \
+((FilterExprTypes_strings_type*) dds_alloc (sizeof (FilterExprTypes_strings_type)));
+
+#define FilterExprTypes_strings_type_free(d,o) \
+dds_sample_free ((d), &FilterExprTypes_strings_type_desc, (o))
+
+#ifndef DDS_SEQUENCE_LONG_DEFINED
+#define DDS_SEQUENCE_LONG_DEFINED
+typedef struct dds_sequence_long
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  int32_t *_buffer;
+  bool _release;
+} dds_sequence_long;
+
+#define dds_sequence_long__alloc() \
+((dds_sequence_long*) dds_alloc (sizeof (dds_sequence_long)));
+
+#define dds_sequence_long_allocbuf(l) \
+((int32_t *) dds_alloc ((l) * sizeof (int32_t)))
+#endif /* DDS_SEQUENCE_LONG_DEFINED */
+
+typedef struct FilterExprTypes_variable_type
+{
+  int32_t id;
+  char * name;
+  dds_sequence_long values;
+  int32_t * opt;
+  FilterExprTypes_color c;
+  struct FilterExprTypes_coord pos;
+} FilterExprTypes_variable_type;
+
+extern const dds_topic_descriptor_t FilterExprTypes_variable_type_desc;
+
+#define FilterExprTypes_variable_type__alloc() \
+((FilterExprTypes_variable_type*) dds_alloc (sizeof (FilterExprTypes_variable_type)));
+
+#define FilterExprTypes_variable_type_free(d,o) \
+dds_sample_free ((d), &FilterExprTypes_variable_type_desc, (o))
+
+#ifndef DDS_SEQUENCE_OCTET_DEFINED
+#define DDS_SEQUENCE_OCTET_DEFINED
+typedef struct dds_sequence_octet
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  uint8_t *_buffer;
+  bool _release;
+} dds_sequence_octet;
+
+#define dds_sequence_octet__alloc() \
+((dds_sequence_octet*) dds_alloc (sizeof (dds_sequence_octet)));
+
+#define dds_sequence_octet_allocbuf(l) \
+((uint8_t *) dds_alloc ((l) * sizeof (uint8_t)))
+#endif /* DDS_SEQUENCE_OCTET_DEFINED */
+
+typedef struct FilterExprTypes_mutable_type
+{
+  int32_t id;
+  dds_sequence_octet blob;
+  char * name;
+  int64_t * big;
+} FilterExprTypes_mutable_type;
+
+extern const dds_topic_descriptor_t FilterExprTypes_mutable_type_desc;
+
+#define FilterExprTypes_mutable_type__alloc() \
+((FilterExprTypes_mutable_type*) dds_alloc (sizeof (FilterExprTypes_mutable_type)));
+
+#define FilterExprTypes_mutable_type_free(d,o) \
+dds_sample_free ((d), &FilterExprTypes_mutable_type_desc, (o))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_DDSC_TESTS_FILTEREXPRTYPES_H */
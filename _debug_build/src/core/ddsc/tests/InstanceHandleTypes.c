@@ -0,0 +1,198 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_debug_build/src/core/ddsc/tests/InstanceHandleTypes.c
+  Source: /root/repo/src/core/ddsc/tests/InstanceHandleTypes.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "InstanceHandleTypes.h"
+
+static const uint32_t InstanceHandleTypes_A_ops [] =
+{
+  /* A */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (InstanceHandleTypes_A, k),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (InstanceHandleTypes_A, v),
+  DDS_OP_RTS,
+  
+  /* key: k */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t InstanceHandleTypes_A_keys[1] =
+{
+  { "k", 5, 0 }
+};
+
+/* Type Information:
+  [MINIMAL f06c1729204c81b58142546a43aa] (#deps: 0)
+  [COMPLETE cc0cc98e23bf859a00339948f3c5] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_InstanceHandleTypes_A (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xf0, 0x6c, 0x17, 0x29, 0x20, 0x4c, 0x81, 0xb5, 0x81, 0x42, 0x54, \
+  0x6a, 0x43, 0xaa, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xcc, 0x0c, 0xc9, 0x8e, 0x23, 0xbf, 0x85, 0x9a, 0x00, 0x33, 0x99, \
+  0x48, 0xf3, 0xc5, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_InstanceHandleTypes_A 100u
+#define TYPE_MAP_CDR_InstanceHandleTypes_A (unsigned char []){ \
+  0x4b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xf0, 0x6c, 0x17, 0x29, 0x20, 0x4c, 0x81, \
+  0xb5, 0x81, 0x42, 0x54, 0x6a, 0x43, 0xaa, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x8c, 0xe4, 0xb1, 0x6b, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x9e, 0x36, 0x69, 0xd1, 0x00, \
+  0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xcc, 0x0c, 0xc9, 0x8e, 0x23, 0xbf, 0x85, \
+  0x9a, 0x00, 0x33, 0x99, 0x48, 0xf3, 0xc5, 0x00, 0x58, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x73, 0x74, \
+  0x61, 0x6e, 0x63, 0x65, 0x48, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, \
+  0x3a, 0x41, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x76, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xcc, 0x0c, 0xc9, \
+  0x8e, 0x23, 0xbf, 0x85, 0x9a, 0x00, 0x33, 0x99, 0x48, 0xf3, 0xc5, 0xf1, 0xf0, 0x6c, 0x17, 0x29, \
+  0x20, 0x4c, 0x81, 0xb5, 0x81, 0x42, 0x54, 0x6a, 0x43, 0xaa\
+}
+#define TYPE_MAP_CDR_SZ_InstanceHandleTypes_A 234u
+const dds_topic_descriptor_t InstanceHandleTypes_A_desc =
+{
+  .m_size = sizeof (InstanceHandleTypes_A),
+  .m_align = dds_alignof (InstanceHandleTypes_A),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "InstanceHandleTypes::A",
+  .m_keys = InstanceHandleTypes_A_keys,
+  .m_nops = 3,
+  .m_ops = InstanceHandleTypes_A_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_InstanceHandleTypes_A, .sz = TYPE_INFO_CDR_SZ_InstanceHandleTypes_A },
+  .type_mapping = { .data = TYPE_MAP_CDR_InstanceHandleTypes_A, .sz = TYPE_MAP_CDR_SZ_InstanceHandleTypes_A }
+};
+
+static const uint32_t InstanceHandleTypes_C_ops [] =
+{
+  /* C */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (InstanceHandleTypes_C, k),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (InstanceHandleTypes_C, v),
+  DDS_OP_RTS,
+  
+  /* key: k */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t InstanceHandleTypes_C_keys[1] =
+{
+  { "k", 5, 0 }
+};
+
+/* Type Information:
+  [MINIMAL f06c1729204c81b58142546a43aa] (#deps: 0)
+  [COMPLETE 801e7bfab0367b3de1cb726f4a02] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_InstanceHandleTypes_C (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xf0, 0x6c, 0x17, 0x29, 0x20, 0x4c, 0x81, 0xb5, 0x81, 0x42, 0x54, \
+  0x6a, 0x43, 0xaa, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x80, 0x1e, 0x7b, 0xfa, 0xb0, 0x36, 0x7b, 0x3d, 0xe1, 0xcb, 0x72, \
+  0x6f, 0x4a, 0x02, 0x00, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_InstanceHandleTypes_C 100u
+#define TYPE_MAP_CDR_InstanceHandleTypes_C (unsigned char []){ \
+  0x4b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xf0, 0x6c, 0x17, 0x29, 0x20, 0x4c, 0x81, \
+  0xb5, 0x81, 0x42, 0x54, 0x6a, 0x43, 0xaa, 0x00, 0x33, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x8c, 0xe4, 0xb1, 0x6b, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x9e, 0x36, 0x69, 0xd1, 0x00, \
+  0x70, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x80, 0x1e, 0x7b, 0xfa, 0xb0, 0x36, 0x7b, \
+  0x3d, 0xe1, 0xcb, 0x72, 0x6f, 0x4a, 0x02, 0x00, 0x58, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x73, 0x74, \
+  0x61, 0x6e, 0x63, 0x65, 0x48, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, \
+  0x3a, 0x43, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x76, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x80, 0x1e, 0x7b, \
+  0xfa, 0xb0, 0x36, 0x7b, 0x3d, 0xe1, 0xcb, 0x72, 0x6f, 0x4a, 0x02, 0xf1, 0xf0, 0x6c, 0x17, 0x29, \
+  0x20, 0x4c, 0x81, 0xb5, 0x81, 0x42, 0x54, 0x6a, 0x43, 0xaa\
+}
+#define TYPE_MAP_CDR_SZ_InstanceHandleTypes_C 234u
+const dds_topic_descriptor_t InstanceHandleTypes_C_desc =
+{
+  .m_size = sizeof (InstanceHandleTypes_C),
+  .m_align = dds_alignof (InstanceHandleTypes_C),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "InstanceHandleTypes::C",
+  .m_keys = InstanceHandleTypes_C_keys,
+  .m_nops = 3,
+  .m_ops = InstanceHandleTypes_C_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_InstanceHandleTypes_C, .sz = TYPE_INFO_CDR_SZ_InstanceHandleTypes_C },
+  .type_mapping = { .data = TYPE_MAP_CDR_InstanceHandleTypes_C, .sz = TYPE_MAP_CDR_SZ_InstanceHandleTypes_C }
+};
+
+static const uint32_t InstanceHandleTypes_MD5_ops [] =
+{
+  /* MD5 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY, offsetof (InstanceHandleTypes_MD5, k), 128u,
+  DDS_OP_RTS,
+  
+  /* key: k */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t InstanceHandleTypes_MD5_keys[1] =
+{
+  { "k", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 1c52d37ad16a346d68696e3ac4ac] (#deps: 0)
+  [COMPLETE 8388c1fe9dbe2fddb7af369d3445] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_InstanceHandleTypes_MD5 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x1c, 0x52, 0xd3, 0x7a, 0xd1, 0x6a, 0x34, 0x6d, 0x68, 0x69, 0x6e, \
+  0x3a, 0xc4, 0xac, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x83, 0x88, 0xc1, 0xfe, 0x9d, 0xbe, 0x2f, 0xdd, 0xb7, 0xaf, 0x36, \
+  0x9d, 0x34, 0x45, 0x00, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_InstanceHandleTypes_MD5 100u
+#define TYPE_MAP_CDR_InstanceHandleTypes_MD5 (unsigned char []){ \
+  0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x1c, 0x52, 0xd3, 0x7a, 0xd1, 0x6a, 0x34, \
+  0x6d, 0x68, 0x69, 0x6e, 0x3a, 0xc4, 0xac, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x02, 0x8c, 0xe4, 0xb1, 0x6b, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x83, 0x88, 0xc1, 0xfe, 0x9d, 0xbe, 0x2f, 0xdd, 0xb7, 0xaf, 0x36, \
+  0x9d, 0x34, 0x45, 0x00, 0x54, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, \
+  0x48, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x4d, 0x44, 0x35, \
+  0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x80, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x83, 0x88, 0xc1, 0xfe, 0x9d, 0xbe, 0x2f, 0xdd, 0xb7, 0xaf, 0x36, \
+  0x9d, 0x34, 0x45, 0xf1, 0x1c, 0x52, 0xd3, 0x7a, 0xd1, 0x6a, 0x34, 0x6d, 0x68, 0x69, 0x6e, 0x3a, \
+  0xc4, 0xac\
+}
+#define TYPE_MAP_CDR_SZ_InstanceHandleTypes_MD5 226u
+const dds_topic_descriptor_t InstanceHandleTypes_MD5_desc =
+{
+  .m_size = sizeof (InstanceHandleTypes_MD5),
+  .m_align = dds_alignof (InstanceHandleTypes_MD5),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "InstanceHandleTypes::MD5",
+  .m_keys = InstanceHandleTypes_MD5_keys,
+  .m_nops = 2,
+  .m_ops = InstanceHandleTypes_MD5_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_InstanceHandleTypes_MD5, .sz = TYPE_INFO_CDR_SZ_InstanceHandleTypes_MD5 },
+  .type_mapping = { .data = TYPE_MAP_CDR_InstanceHandleTypes_MD5, .sz = TYPE_MAP_CDR_SZ_InstanceHandleTypes_MD5 }
+};
+
@@ -0,0 +1,577 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_debug_build/src/core/ddsc/tests/MinXcdrVersion.c
+  Source: /root/repo/src/core/ddsc/tests/MinXcdrVersion.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "MinXcdrVersion.h"
+
+static const uint32_t MinXcdrVersion_t_ops [] =
+{
+  /* t */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (MinXcdrVersion_t, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL f54b392e7940752e2b87b56816eb] (#deps: 0)
+  [COMPLETE eff7c90e7ce6f077cf93cc445eaf] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_MinXcdrVersion_t (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, \
+  0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xef, 0xf7, 0xc9, 0x0e, 0x7c, 0xe6, 0xf0, 0x77, 0xcf, 0x93, 0xcc, \
+  0x44, 0x5e, 0xaf, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_MinXcdrVersion_t 100u
+#define TYPE_MAP_CDR_MinXcdrVersion_t (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x59, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xef, 0xf7, 0xc9, 0x0e, 0x7c, 0xe6, 0xf0, \
+  0x77, 0xcf, 0x93, 0xcc, 0x44, 0x5e, 0xaf, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x4d, 0x69, 0x6e, 0x58, \
+  0x63, 0x64, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x3a, 0x74, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xef, 0xf7, 0xc9, 0x0e, 0x7c, 0xe6, 0xf0, \
+  0x77, 0xcf, 0x93, 0xcc, 0x44, 0x5e, 0xaf, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, \
+  0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_MinXcdrVersion_t 198u
+const dds_topic_descriptor_t MinXcdrVersion_t_desc =
+{
+  .m_size = sizeof (MinXcdrVersion_t),
+  .m_align = dds_alignof (MinXcdrVersion_t),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "MinXcdrVersion::t",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = MinXcdrVersion_t_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_MinXcdrVersion_t, .sz = TYPE_INFO_CDR_SZ_MinXcdrVersion_t },
+  .type_mapping = { .data = TYPE_MAP_CDR_MinXcdrVersion_t, .sz = TYPE_MAP_CDR_SZ_MinXcdrVersion_t }
+};
+
+static const uint32_t MinXcdrVersion_t_nested_ops [] =
+{
+  /* t_nested */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (MinXcdrVersion_t_nested, f1), (3u << 16u) + 4u /* t */,
+  DDS_OP_RTS,
+
+  /* t */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (MinXcdrVersion_t, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 54839ce2a1acc84ba4b7c102c4e6] (#deps: 1)
+   - [MINIMAL f54b392e7940752e2b87b56816eb]
+  [COMPLETE ae8be1017e276523e6fa510d818d] (#deps: 1)
+   - [COMPLETE eff7c90e7ce6f077cf93cc445eaf]
+*/
+#define TYPE_INFO_CDR_MinXcdrVersion_t_nested (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x83, 0x9c, 0xe2, 0xa1, 0xac, 0xc8, 0x4b, 0xa4, 0xb7, 0xc1, \
+  0x02, 0xc4, 0xe6, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xae, 0x8b, 0xe1, \
+  0x01, 0x7e, 0x27, 0x65, 0x23, 0xe6, 0xfa, 0x51, 0x0d, 0x81, 0x8d, 0x00, 0x5d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xef, 0xf7, 0xc9, 0x0e, 0x7c, 0xe6, 0xf0, 0x77, 0xcf, 0x93, 0xcc, 0x44, 0x5e, 0xaf, 0x00, \
+  0x45, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_MinXcdrVersion_t_nested 148u
+#define TYPE_MAP_CDR_MinXcdrVersion_t_nested (unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x83, 0x9c, 0xe2, 0xa1, 0xac, 0xc8, \
+  0x4b, 0xa4, 0xb7, 0xc1, 0x02, 0xc4, 0xe6, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, \
+  0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xf5, 0x4b, \
+  0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xae, 0x8b, 0xe1, \
+  0x01, 0x7e, 0x27, 0x65, 0x23, 0xe6, 0xfa, 0x51, 0x0d, 0x81, 0x8d, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x4d, 0x69, 0x6e, 0x58, 0x63, 0x64, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x3a, \
+  0x74, 0x5f, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xef, \
+  0xf7, 0xc9, 0x0e, 0x7c, 0xe6, 0xf0, 0x77, 0xcf, 0x93, 0xcc, 0x44, 0x5e, 0xaf, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xef, 0xf7, 0xc9, 0x0e, 0x7c, 0xe6, \
+  0xf0, 0x77, 0xcf, 0x93, 0xcc, 0x44, 0x5e, 0xaf, 0x41, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x4d, 0x69, 0x6e, 0x58, \
+  0x63, 0x64, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x3a, 0x74, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xae, 0x8b, 0xe1, 0x01, 0x7e, 0x27, 0x65, \
+  0x23, 0xe6, 0xfa, 0x51, 0x0d, 0x81, 0x8d, 0xf1, 0x54, 0x83, 0x9c, 0xe2, 0xa1, 0xac, 0xc8, 0x4b, \
+  0xa4, 0xb7, 0xc1, 0x02, 0xc4, 0xe6, 0xf2, 0xef, 0xf7, 0xc9, 0x0e, 0x7c, 0xe6, 0xf0, 0x77, 0xcf, \
+  0x93, 0xcc, 0x44, 0x5e, 0xaf, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, \
+  0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_MinXcdrVersion_t_nested 404u
+const dds_topic_descriptor_t MinXcdrVersion_t_nested_desc =
+{
+  .m_size = sizeof (MinXcdrVersion_t_nested),
+  .m_align = dds_alignof (MinXcdrVersion_t_nested),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "MinXcdrVersion::t_nested",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = MinXcdrVersion_t_nested_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_MinXcdrVersion_t_nested, .sz = TYPE_INFO_CDR_SZ_MinXcdrVersion_t_nested },
+  .type_mapping = { .data = TYPE_MAP_CDR_MinXcdrVersion_t_nested, .sz = TYPE_MAP_CDR_SZ_MinXcdrVersion_t_nested }
+};
+
+static const uint32_t MinXcdrVersion_t_inherit_ops [] =
+{
+  /* t_inherit */
+  DDS_OP_ADR | DDS_OP_FLAG_BASE | DDS_OP_TYPE_EXT, offsetof (MinXcdrVersion_t_inherit, parent), (3u << 16u) + 6u /* t */,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (MinXcdrVersion_t_inherit, f2),
+  DDS_OP_RTS,
+
+  /* t */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (MinXcdrVersion_t, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 3d9069690f29cca64aa5668cf60f] (#deps: 1)
+   - [MINIMAL f54b392e7940752e2b87b56816eb]
+  [COMPLETE f93d896e0f101d84941e4150d77b] (#deps: 1)
+   - [COMPLETE eff7c90e7ce6f077cf93cc445eaf]
+*/
+#define TYPE_INFO_CDR_MinXcdrVersion_t_inherit (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x3d, 0x90, 0x69, 0x69, 0x0f, 0x29, 0xcc, 0xa6, 0x4a, 0xa5, 0x66, \
+  0x8c, 0xf6, 0x0f, 0x00, 0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, \
+  0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xf9, 0x3d, 0x89, \
+  0x6e, 0x0f, 0x10, 0x1d, 0x84, 0x94, 0x1e, 0x41, 0x50, 0xd7, 0x7b, 0x00, 0x5d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xef, 0xf7, 0xc9, 0x0e, 0x7c, 0xe6, 0xf0, 0x77, 0xcf, 0x93, 0xcc, 0x44, 0x5e, 0xaf, 0x00, \
+  0x45, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_MinXcdrVersion_t_inherit 148u
+#define TYPE_MAP_CDR_MinXcdrVersion_t_inherit (unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x3d, 0x90, 0x69, 0x69, 0x0f, 0x29, 0xcc, \
+  0xa6, 0x4a, 0xa5, 0x66, 0x8c, 0xf6, 0x0f, 0x00, 0x2f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, \
+  0x68, 0x16, 0xeb, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x36, 0x67, 0xf6, 0xa0, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, \
+  0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, 0xb5, 0x68, 0x16, 0xeb, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xf9, 0x3d, 0x89, \
+  0x6e, 0x0f, 0x10, 0x1d, 0x84, 0x94, 0x1e, 0x41, 0x50, 0xd7, 0x7b, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x32, 0x00, 0x00, 0x00, 0xf2, 0xef, 0xf7, 0xc9, 0x0e, 0x7c, 0xe6, 0xf0, \
+  0x77, 0xcf, 0x93, 0xcc, 0x44, 0x5e, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, \
+  0x4d, 0x69, 0x6e, 0x58, 0x63, 0x64, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x3a, \
+  0x74, 0x5f, 0x69, 0x6e, 0x68, 0x65, 0x72, 0x69, 0x74, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x32, 0x00, 0x00, 0x00, 0xf2, 0xef, 0xf7, 0xc9, 0x0e, 0x7c, 0xe6, \
+  0xf0, 0x77, 0xcf, 0x93, 0xcc, 0x44, 0x5e, 0xaf, 0x41, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x4d, 0x69, 0x6e, 0x58, \
+  0x63, 0x64, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x3a, 0x74, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xf9, 0x3d, 0x89, 0x6e, 0x0f, 0x10, 0x1d, \
+  0x84, 0x94, 0x1e, 0x41, 0x50, 0xd7, 0x7b, 0xf1, 0x3d, 0x90, 0x69, 0x69, 0x0f, 0x29, 0xcc, 0xa6, \
+  0x4a, 0xa5, 0x66, 0x8c, 0xf6, 0x0f, 0xf2, 0xef, 0xf7, 0xc9, 0x0e, 0x7c, 0xe6, 0xf0, 0x77, 0xcf, \
+  0x93, 0xcc, 0x44, 0x5e, 0xaf, 0xf1, 0xf5, 0x4b, 0x39, 0x2e, 0x79, 0x40, 0x75, 0x2e, 0x2b, 0x87, \
+  0xb5, 0x68, 0x16, 0xeb\
+}
+#define TYPE_MAP_CDR_SZ_MinXcdrVersion_t_inherit 404u
+const dds_topic_descriptor_t MinXcdrVersion_t_inherit_desc =
+{
+  .m_size = sizeof (MinXcdrVersion_t_inherit),
+  .m_align = dds_alignof (MinXcdrVersion_t_inherit),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "MinXcdrVersion::t_inherit",
+  .m_keys = NULL,
+  .m_nops = 5,
+  .m_ops = MinXcdrVersion_t_inherit_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_MinXcdrVersion_t_inherit, .sz = TYPE_INFO_CDR_SZ_MinXcdrVersion_t_inherit },
+  .type_mapping = { .data = TYPE_MAP_CDR_MinXcdrVersion_t_inherit, .sz = TYPE_MAP_CDR_SZ_MinXcdrVersion_t_inherit }
+};
+
+static const uint32_t MinXcdrVersion_t_opt_ops [] =
+{
+  /* t_opt */
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (MinXcdrVersion_t_opt, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 840c3a0b79ee76e4f99e2b04bb06] (#deps: 0)
+  [COMPLETE 319a15b72b18bd6d4ea84ac75cc0] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_MinXcdrVersion_t_opt (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x84, 0x0c, 0x3a, 0x0b, 0x79, 0xee, 0x76, 0xe4, 0xf9, 0x9e, 0x2b, \
+  0x04, 0xbb, 0x06, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x31, 0x9a, 0x15, 0xb7, 0x2b, 0x18, 0xbd, 0x6d, 0x4e, 0xa8, 0x4a, \
+  0xc7, 0x5c, 0xc0, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_MinXcdrVersion_t_opt 100u
+#define TYPE_MAP_CDR_MinXcdrVersion_t_opt (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x84, 0x0c, 0x3a, 0x0b, 0x79, 0xee, 0x76, \
+  0xe4, 0xf9, 0x9e, 0x2b, 0x04, 0xbb, 0x06, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x31, 0x9a, 0x15, 0xb7, 0x2b, 0x18, 0xbd, \
+  0x6d, 0x4e, 0xa8, 0x4a, 0xc7, 0x5c, 0xc0, 0x00, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x4d, 0x69, 0x6e, 0x58, \
+  0x63, 0x64, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x3a, 0x74, 0x5f, 0x6f, 0x70, \
+  0x74, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x31, 0x9a, 0x15, \
+  0xb7, 0x2b, 0x18, 0xbd, 0x6d, 0x4e, 0xa8, 0x4a, 0xc7, 0x5c, 0xc0, 0xf1, 0x84, 0x0c, 0x3a, 0x0b, \
+  0x79, 0xee, 0x76, 0xe4, 0xf9, 0x9e, 0x2b, 0x04, 0xbb, 0x06\
+}
+#define TYPE_MAP_CDR_SZ_MinXcdrVersion_t_opt 202u
+const dds_topic_descriptor_t MinXcdrVersion_t_opt_desc =
+{
+  .m_size = sizeof (MinXcdrVersion_t_opt),
+  .m_align = dds_alignof (MinXcdrVersion_t_opt),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "MinXcdrVersion::t_opt",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = MinXcdrVersion_t_opt_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_MinXcdrVersion_t_opt, .sz = TYPE_INFO_CDR_SZ_MinXcdrVersion_t_opt },
+  .type_mapping = { .data = TYPE_MAP_CDR_MinXcdrVersion_t_opt, .sz = TYPE_MAP_CDR_SZ_MinXcdrVersion_t_opt }
+};
+
+static const uint32_t MinXcdrVersion_t_ext_ops [] =
+{
+  /* t_ext */
+  DDS_OP_ADR | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (MinXcdrVersion_t_ext, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 7c842a9f6488c0b49fad299b4c3b] (#deps: 0)
+  [COMPLETE edb30b371dd7b40e68e5b599659a] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_MinXcdrVersion_t_ext (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x7c, 0x84, 0x2a, 0x9f, 0x64, 0x88, 0xc0, 0xb4, 0x9f, 0xad, 0x29, \
+  0x9b, 0x4c, 0x3b, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xed, 0xb3, 0x0b, 0x37, 0x1d, 0xd7, 0xb4, 0x0e, 0x68, 0xe5, 0xb5, \
+  0x99, 0x65, 0x9a, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_MinXcdrVersion_t_ext 100u
+#define TYPE_MAP_CDR_MinXcdrVersion_t_ext (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x7c, 0x84, 0x2a, 0x9f, 0x64, 0x88, 0xc0, \
+  0xb4, 0x9f, 0xad, 0x29, 0x9b, 0x4c, 0x3b, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xed, 0xb3, 0x0b, 0x37, 0x1d, 0xd7, 0xb4, \
+  0x0e, 0x68, 0xe5, 0xb5, 0x99, 0x65, 0x9a, 0x00, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x4d, 0x69, 0x6e, 0x58, \
+  0x63, 0x64, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x3a, 0x74, 0x5f, 0x65, 0x78, \
+  0x74, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xed, 0xb3, 0x0b, \
+  0x37, 0x1d, 0xd7, 0xb4, 0x0e, 0x68, 0xe5, 0xb5, 0x99, 0x65, 0x9a, 0xf1, 0x7c, 0x84, 0x2a, 0x9f, \
+  0x64, 0x88, 0xc0, 0xb4, 0x9f, 0xad, 0x29, 0x9b, 0x4c, 0x3b\
+}
+#define TYPE_MAP_CDR_SZ_MinXcdrVersion_t_ext 202u
+const dds_topic_descriptor_t MinXcdrVersion_t_ext_desc =
+{
+  .m_size = sizeof (MinXcdrVersion_t_ext),
+  .m_align = dds_alignof (MinXcdrVersion_t_ext),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "MinXcdrVersion::t_ext",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = MinXcdrVersion_t_ext_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_MinXcdrVersion_t_ext, .sz = TYPE_INFO_CDR_SZ_MinXcdrVersion_t_ext },
+  .type_mapping = { .data = TYPE_MAP_CDR_MinXcdrVersion_t_ext, .sz = TYPE_MAP_CDR_SZ_MinXcdrVersion_t_ext }
+};
+
+static const uint32_t MinXcdrVersion_t_append_ops [] =
+{
+  /* t_append */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (MinXcdrVersion_t_append, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 5472d80f8549173aaed47a3f5dd3] (#deps: 0)
+  [COMPLETE fa9b7d0ee250f9e8c8638e96d106] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_MinXcdrVersion_t_append (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, 0x3a, 0xae, 0xd4, 0x7a, \
+  0x3f, 0x5d, 0xd3, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xfa, 0x9b, 0x7d, 0x0e, 0xe2, 0x50, 0xf9, 0xe8, 0xc8, 0x63, 0x8e, \
+  0x96, 0xd1, 0x06, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_MinXcdrVersion_t_append 100u
+#define TYPE_MAP_CDR_MinXcdrVersion_t_append (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, \
+  0x3a, 0xae, 0xd4, 0x7a, 0x3f, 0x5d, 0xd3, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x61, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xfa, 0x9b, 0x7d, 0x0e, 0xe2, 0x50, 0xf9, \
+  0xe8, 0xc8, 0x63, 0x8e, 0x96, 0xd1, 0x06, 0x00, 0x49, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x4d, 0x69, 0x6e, 0x58, \
+  0x63, 0x64, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x3a, 0x74, 0x5f, 0x61, 0x70, \
+  0x70, 0x65, 0x6e, 0x64, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xfa, 0x9b, 0x7d, 0x0e, 0xe2, 0x50, 0xf9, 0xe8, 0xc8, 0x63, 0x8e, 0x96, 0xd1, 0x06, 0xf1, \
+  0x54, 0x72, 0xd8, 0x0f, 0x85, 0x49, 0x17, 0x3a, 0xae, 0xd4, 0x7a, 0x3f, 0x5d, 0xd3\
+}
+#define TYPE_MAP_CDR_SZ_MinXcdrVersion_t_append 206u
+const dds_topic_descriptor_t MinXcdrVersion_t_append_desc =
+{
+  .m_size = sizeof (MinXcdrVersion_t_append),
+  .m_align = dds_alignof (MinXcdrVersion_t_append),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "MinXcdrVersion::t_append",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = MinXcdrVersion_t_append_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_MinXcdrVersion_t_append, .sz = TYPE_INFO_CDR_SZ_MinXcdrVersion_t_append },
+  .type_mapping = { .data = TYPE_MAP_CDR_MinXcdrVersion_t_append, .sz = TYPE_MAP_CDR_SZ_MinXcdrVersion_t_append }
+};
+
+static const uint32_t MinXcdrVersion_t_mut_ops [] =
+{
+  /* t_mut */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (MinXcdrVersion_t_mut, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 0c8c1cb4eb9257eae428f4c36641] (#deps: 0)
+  [COMPLETE ebb57b68106bcc9b640b50deb25c] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_MinXcdrVersion_t_mut (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, 0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, \
+  0xc3, 0x66, 0x41, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xeb, 0xb5, 0x7b, 0x68, 0x10, 0x6b, 0xcc, 0x9b, 0x64, 0x0b, 0x50, \
+  0xde, 0xb2, 0x5c, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_MinXcdrVersion_t_mut 100u
+#define TYPE_MAP_CDR_MinXcdrVersion_t_mut (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, 0x92, 0x57, \
+  0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, 0x19, 0x83, 0x6d, 0x00, \
+  0x5d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xeb, 0xb5, 0x7b, 0x68, 0x10, 0x6b, 0xcc, \
+  0x9b, 0x64, 0x0b, 0x50, 0xde, 0xb2, 0x5c, 0x00, 0x45, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x4d, 0x69, 0x6e, 0x58, \
+  0x63, 0x64, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x3a, 0x74, 0x5f, 0x6d, 0x75, \
+  0x74, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xeb, 0xb5, 0x7b, \
+  0x68, 0x10, 0x6b, 0xcc, 0x9b, 0x64, 0x0b, 0x50, 0xde, 0xb2, 0x5c, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, \
+  0xeb, 0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41\
+}
+#define TYPE_MAP_CDR_SZ_MinXcdrVersion_t_mut 202u
+const dds_topic_descriptor_t MinXcdrVersion_t_mut_desc =
+{
+  .m_size = sizeof (MinXcdrVersion_t_mut),
+  .m_align = dds_alignof (MinXcdrVersion_t_mut),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "MinXcdrVersion::t_mut",
+  .m_keys = NULL,
+  .m_nops = 4,
+  .m_ops = MinXcdrVersion_t_mut_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_MinXcdrVersion_t_mut, .sz = TYPE_INFO_CDR_SZ_MinXcdrVersion_t_mut },
+  .type_mapping = { .data = TYPE_MAP_CDR_MinXcdrVersion_t_mut, .sz = TYPE_MAP_CDR_SZ_MinXcdrVersion_t_mut }
+};
+
+static const uint32_t MinXcdrVersion_t_nested_mut_ops [] =
+{
+  /* t_nested_mut */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (MinXcdrVersion_t_nested_mut, f1), (3u << 16u) + 4u /* t_mut */,
+  DDS_OP_RTS,
+
+  /* t_mut */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (MinXcdrVersion_t_mut, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 66ba181d41945d1b16bf54fea0e3] (#deps: 1)
+   - [MINIMAL 0c8c1cb4eb9257eae428f4c36641]
+  [COMPLETE 97353bf52ae63572a1579ff81289] (#deps: 1)
+   - [COMPLETE ebb57b68106bcc9b640b50deb25c]
+*/
+#define TYPE_INFO_CDR_MinXcdrVersion_t_nested_mut (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x66, 0xba, 0x18, 0x1d, 0x41, 0x94, 0x5d, 0x1b, 0x16, 0xbf, 0x54, \
+  0xfe, 0xa0, 0xe3, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, 0x92, 0x57, \
+  0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x97, 0x35, 0x3b, \
+  0xf5, 0x2a, 0xe6, 0x35, 0x72, 0xa1, 0x57, 0x9f, 0xf8, 0x12, 0x89, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xeb, 0xb5, 0x7b, 0x68, 0x10, 0x6b, 0xcc, 0x9b, 0x64, 0x0b, 0x50, 0xde, 0xb2, 0x5c, 0x00, \
+  0x49, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_MinXcdrVersion_t_nested_mut 148u
+#define TYPE_MAP_CDR_MinXcdrVersion_t_nested_mut (unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x66, 0xba, 0x18, 0x1d, 0x41, 0x94, 0x5d, \
+  0x1b, 0x16, 0xbf, 0x54, 0xfe, 0xa0, 0xe3, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, \
+  0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x0c, 0x8c, \
+  0x1c, 0xb4, 0xeb, 0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x97, 0x35, 0x3b, \
+  0xf5, 0x2a, 0xe6, 0x35, 0x72, 0xa1, 0x57, 0x9f, 0xf8, 0x12, 0x89, 0x00, 0x5d, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x4d, 0x69, 0x6e, 0x58, 0x63, 0x64, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x3a, \
+  0x74, 0x5f, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x5f, 0x6d, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xeb, 0xb5, 0x7b, 0x68, 0x10, 0x6b, 0xcc, 0x9b, 0x64, 0x0b, 0x50, 0xde, 0xb2, \
+  0x5c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xeb, 0xb5, \
+  0x7b, 0x68, 0x10, 0x6b, 0xcc, 0x9b, 0x64, 0x0b, 0x50, 0xde, 0xb2, 0x5c, 0x45, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x4d, 0x69, 0x6e, 0x58, 0x63, 0x64, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x3a, \
+  0x74, 0x5f, 0x6d, 0x75, 0x74, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x97, 0x35, 0x3b, 0xf5, 0x2a, 0xe6, 0x35, 0x72, 0xa1, 0x57, 0x9f, 0xf8, 0x12, 0x89, 0xf1, \
+  0x66, 0xba, 0x18, 0x1d, 0x41, 0x94, 0x5d, 0x1b, 0x16, 0xbf, 0x54, 0xfe, 0xa0, 0xe3, 0xf2, 0xeb, \
+  0xb5, 0x7b, 0x68, 0x10, 0x6b, 0xcc, 0x9b, 0x64, 0x0b, 0x50, 0xde, 0xb2, 0x5c, 0xf1, 0x0c, 0x8c, \
+  0x1c, 0xb4, 0xeb, 0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41\
+}
+#define TYPE_MAP_CDR_SZ_MinXcdrVersion_t_nested_mut 412u
+const dds_topic_descriptor_t MinXcdrVersion_t_nested_mut_desc =
+{
+  .m_size = sizeof (MinXcdrVersion_t_nested_mut),
+  .m_align = dds_alignof (MinXcdrVersion_t_nested_mut),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "MinXcdrVersion::t_nested_mut",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = MinXcdrVersion_t_nested_mut_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_MinXcdrVersion_t_nested_mut, .sz = TYPE_INFO_CDR_SZ_MinXcdrVersion_t_nested_mut },
+  .type_mapping = { .data = TYPE_MAP_CDR_MinXcdrVersion_t_nested_mut, .sz = TYPE_MAP_CDR_SZ_MinXcdrVersion_t_nested_mut }
+};
+
+static const uint32_t MinXcdrVersion_t_nested_opt_ops [] =
+{
+  /* t_nested_opt */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (MinXcdrVersion_t_nested_opt, f1), (3u << 16u) + 4u /* t_mut */,
+  DDS_OP_RTS,
+
+  /* t_mut */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 3, 0u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (MinXcdrVersion_t_mut, f1),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 66ba181d41945d1b16bf54fea0e3] (#deps: 1)
+   - [MINIMAL 0c8c1cb4eb9257eae428f4c36641]
+  [COMPLETE d15ab0e5674252024b29ed67cc35] (#deps: 1)
+   - [COMPLETE ebb57b68106bcc9b640b50deb25c]
+*/
+#define TYPE_INFO_CDR_MinXcdrVersion_t_nested_opt (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x66, 0xba, 0x18, 0x1d, 0x41, 0x94, 0x5d, 0x1b, 0x16, 0xbf, 0x54, \
+  0xfe, 0xa0, 0xe3, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, 0x92, 0x57, \
+  0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41, 0x00, 0x27, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xd1, 0x5a, 0xb0, \
+  0xe5, 0x67, 0x42, 0x52, 0x02, 0x4b, 0x29, 0xed, 0x67, 0xcc, 0x35, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xeb, 0xb5, 0x7b, 0x68, 0x10, 0x6b, 0xcc, 0x9b, 0x64, 0x0b, 0x50, 0xde, 0xb2, 0x5c, 0x00, \
+  0x49, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_MinXcdrVersion_t_nested_opt 148u
+#define TYPE_MAP_CDR_MinXcdrVersion_t_nested_opt (unsigned char []){ \
+  0x7f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x66, 0xba, 0x18, 0x1d, 0x41, 0x94, 0x5d, \
+  0x1b, 0x16, 0xbf, 0x54, 0xfe, 0xa0, 0xe3, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x0c, 0x8c, 0x1c, 0xb4, 0xeb, \
+  0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x0c, 0x8c, \
+  0x1c, 0xb4, 0xeb, 0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41, 0x23, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0xbd, \
+  0x19, 0x83, 0x6d, 0x00, 0xcd, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xd1, 0x5a, 0xb0, \
+  0xe5, 0x67, 0x42, 0x52, 0x02, 0x4b, 0x29, 0xed, 0x67, 0xcc, 0x35, 0x00, 0x5d, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x4d, 0x69, 0x6e, 0x58, 0x63, 0x64, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x3a, \
+  0x74, 0x5f, 0x6e, 0x65, 0x73, 0x74, 0x65, 0x64, 0x5f, 0x6f, 0x70, 0x74, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xeb, 0xb5, 0x7b, 0x68, 0x10, 0x6b, 0xcc, 0x9b, 0x64, 0x0b, 0x50, 0xde, 0xb2, \
+  0x5c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xeb, 0xb5, \
+  0x7b, 0x68, 0x10, 0x6b, 0xcc, 0x9b, 0x64, 0x0b, 0x50, 0xde, 0xb2, 0x5c, 0x45, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x04, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x4d, 0x69, 0x6e, 0x58, 0x63, 0x64, 0x72, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x3a, \
+  0x74, 0x5f, 0x6d, 0x75, 0x74, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0xd1, 0x5a, 0xb0, 0xe5, 0x67, 0x42, 0x52, 0x02, 0x4b, 0x29, 0xed, 0x67, 0xcc, 0x35, 0xf1, \
+  0x66, 0xba, 0x18, 0x1d, 0x41, 0x94, 0x5d, 0x1b, 0x16, 0xbf, 0x54, 0xfe, 0xa0, 0xe3, 0xf2, 0xeb, \
+  0xb5, 0x7b, 0x68, 0x10, 0x6b, 0xcc, 0x9b, 0x64, 0x0b, 0x50, 0xde, 0xb2, 0x5c, 0xf1, 0x0c, 0x8c, \
+  0x1c, 0xb4, 0xeb, 0x92, 0x57, 0xea, 0xe4, 0x28, 0xf4, 0xc3, 0x66, 0x41\
+}
+#define TYPE_MAP_CDR_SZ_MinXcdrVersion_t_nested_opt 412u
+const dds_topic_descriptor_t MinXcdrVersion_t_nested_opt_desc =
+{
+  .m_size = sizeof (MinXcdrVersion_t_nested_opt),
+  .m_align = dds_alignof (MinXcdrVersion_t_nested_opt),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "MinXcdrVersion::t_nested_opt",
+  .m_keys = NULL,
+  .m_nops = 6,
+  .m_ops = MinXcdrVersion_t_nested_opt_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_MinXcdrVersion_t_nested_opt, .sz = TYPE_INFO_CDR_SZ_MinXcdrVersion_t_nested_opt },
+  .type_mapping = { .data = TYPE_MAP_CDR_MinXcdrVersion_t_nested_opt, .sz = TYPE_MAP_CDR_SZ_MinXcdrVersion_t_nested_opt }
+};
+
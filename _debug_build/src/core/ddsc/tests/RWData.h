@@ -0,0 +1,35 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_debug_build/src/core/ddsc/tests/RWData.h
+  Source: /root/repo/src/core/ddsc/tests/RWData.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#ifndef DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_DDSC_TESTS_RWDATA_H
+#define DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_DDSC_TESTS_RWDATA_H
+
+#include "dds/ddsc/dds_public_impl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct RWData_Msg
+{
+  int32_t k;
+} RWData_Msg;
+
+extern const dds_topic_descriptor_t RWData_Msg_desc;
+
+#define RWData_Msg__alloc() \
+((RWData_Msg*) dds_alloc (sizeof (RWData_Msg)));
+
+#define RWData_Msg_free(d,o) \
+dds_sample_free ((d), &RWData_Msg_desc, (o))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_DDSC_TESTS_RWDATA_H */
@@ -0,0 +1,2695 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_debug_build/src/core/ddsc/tests/Serializers.c
+  Source: /root/repo/src/core/ddsc/tests/Serializers.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "Serializers.h"
+#include "dds/cdr/dds_cdrstream_gen.h"
+#include <string.h>
+
+static const uint32_t Serializers_t1_ops [] =
+{
+  /* t1 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t1, id),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t1, c),
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (Serializers_t1, b),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (Serializers_t1, d),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_STR, offsetof (Serializers_t1, name),
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (Serializers_t1, e), 2u,
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (1 << DDS_OP_FLAG_SZ_SHIFT), offsetof (Serializers_t1, em), 3u,
+  DDS_OP_ADR | DDS_OP_TYPE_BST, offsetof (Serializers_t1, bstr), 6u,
+  DDS_OP_ADR | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t1, sh),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ENU | (0 << DDS_OP_FLAG_SZ_SHIFT), offsetof (Serializers_t1, ek), 1u,
+  DDS_OP_RTS,
+  
+  /* key: id */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: name */
+  DDS_OP_KOF | 1, 8u /* order: 4 */,
+  
+  /* key: ek */
+  DDS_OP_KOF | 1, 21u /* order: 9 */
+};
+
+static const dds_key_descriptor_t Serializers_t1_keys[3] =
+{
+  { "id", 25, 0 },
+  { "name", 27, 1 },
+  { "ek", 29, 2 }
+};
+
+static bool Serializers_t1_cdr_write_Serializers_t1 (dds_ostream_t *os, const void *sample);
+static void Serializers_t1_cdr_read_Serializers_t1 (dds_istream_t *is, void *sample);
+static bool Serializers_t1_cdr_normalize_Serializers_t1 (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version);
+
+static bool Serializers_t1_cdr_write_Serializers_t1 (dds_ostream_t *os, const void *sample)
+{
+  const char *data = sample;
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t1, id), 4, 4);
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t1, c), 1, 1);
+  if (*(const uint8_t *) (data + offsetof (Serializers_t1, b)) > 1)
+    return false;
+  dds_stream_gen_put1 (os, *(const uint8_t *) (data + offsetof (Serializers_t1, b)));
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t1, d), dds_stream_gen_align (os->m_xcdr_version, 8), 8);
+  dds_stream_gen_put_string (os, *(const char * const *) (data + offsetof (Serializers_t1, name)));
+  if (*(const uint32_t *) (data + offsetof (Serializers_t1, e)) > 2)
+    return false;
+  dds_stream_gen_put4 (os, *(const uint32_t *) (data + offsetof (Serializers_t1, e)));
+  if (*(const uint32_t *) (data + offsetof (Serializers_t1, em)) > 3)
+    return false;
+  dds_stream_gen_put2 (os, (uint16_t) *(const uint32_t *) (data + offsetof (Serializers_t1, em)));
+  dds_stream_gen_put_string (os, (const char *) (data + offsetof (Serializers_t1, bstr)));
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t1, sh), 2, 2);
+  if (*(const uint32_t *) (data + offsetof (Serializers_t1, ek)) > 1)
+    return false;
+  dds_stream_gen_put1 (os, (uint8_t) *(const uint32_t *) (data + offsetof (Serializers_t1, ek)));
+  return true;
+}
+
+static void Serializers_t1_cdr_read_Serializers_t1 (dds_istream_t *is, void *sample)
+{
+  char *data = sample;
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_t1, id), 4, 4);
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_t1, c), 1, 1);
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_t1, b), 1, 1);
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_t1, d), dds_stream_gen_align (is->m_xcdr_version, 8), 8);
+  *(char **) (data + offsetof (Serializers_t1, name)) = dds_stream_gen_read_string (is, *(char **) (data + offsetof (Serializers_t1, name)));
+  *(uint32_t *) (data + offsetof (Serializers_t1, e)) = dds_stream_gen_get4 (is);
+  *(uint32_t *) (data + offsetof (Serializers_t1, em)) = dds_stream_gen_get2 (is);
+  dds_stream_gen_read_bstring (is, data + offsetof (Serializers_t1, bstr), 6);
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_t1, sh), 2, 2);
+  *(uint32_t *) (data + offsetof (Serializers_t1, ek)) = dds_stream_gen_get1 (is);
+}
+
+static bool Serializers_t1_cdr_normalize_Serializers_t1 (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version)
+{
+  if (!dds_stream_gen_normalize_prim (data, off, size, bswap, 4, xcdr_version))
+    return false;
+  if (!dds_stream_gen_normalize_prim (data, off, size, bswap, 1, xcdr_version))
+    return false;
+  if (!dds_stream_gen_normalize_enumarray (data, off, size, bswap, 1, 1, 1))
+    return false;
+  if (!dds_stream_gen_normalize_prim (data, off, size, bswap, 8, xcdr_version))
+    return false;
+  if (!dds_stream_gen_normalize_string (data, off, size, bswap, SIZE_MAX))
+    return false;
+  if (!dds_stream_gen_normalize_enumarray (data, off, size, bswap, 4, 1, 2))
+    return false;
+  if (!dds_stream_gen_normalize_enumarray (data, off, size, bswap, 2, 1, 3))
+    return false;
+  if (!dds_stream_gen_normalize_string (data, off, size, bswap, 6))
+    return false;
+  if (!dds_stream_gen_normalize_prim (data, off, size, bswap, 2, xcdr_version))
+    return false;
+  if (!dds_stream_gen_normalize_enumarray (data, off, size, bswap, 1, 1, 1))
+    return false;
+  return true;
+}
+
+static void Serializers_t1_cdr_write_key (dds_ostream_t *os, const void *sample)
+{
+  const char *data = sample;
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t1, id), 4, 4);
+  dds_stream_gen_put_string (os, *(const char * const *) (data + offsetof (Serializers_t1, name)));
+  if (*(const uint32_t *) (data + offsetof (Serializers_t1, ek)) <= 1)
+    dds_stream_gen_put1 (os, (uint8_t) *(const uint32_t *) (data + offsetof (Serializers_t1, ek)));
+}
+
+static bool Serializers_t1_cdr_extract_key (dds_istream_t *is, dds_ostream_t *os)
+{
+  uint32_t k[3];
+  k[0] = is->m_index;
+  dds_stream_gen_skip (is, 4, 4);
+  dds_stream_gen_skip (is, 1, 1);
+  dds_stream_gen_skip (is, 1, 1);
+  dds_stream_gen_skip (is, dds_stream_gen_align (is->m_xcdr_version, 8), 8);
+  k[1] = is->m_index;
+  dds_stream_gen_skip_string (is);
+  dds_stream_gen_skip (is, 4, 4);
+  dds_stream_gen_skip (is, 2, 2);
+  dds_stream_gen_skip_string (is);
+  dds_stream_gen_skip (is, 2, 2);
+  k[2] = is->m_index;
+  is->m_index = k[0];
+  {
+    uint64_t v;
+    dds_stream_gen_get_bytes (is, &v, 4, 4);
+    dds_stream_gen_put_bytes (os, &v, 4, 4);
+  }
+  is->m_index = k[1];
+  {
+    const uint32_t sz = dds_stream_gen_get4 (is);
+    dds_stream_gen_put4 (os, sz);
+    dds_stream_gen_put_bytes (os, is->m_buffer + is->m_index, 1, sz);
+    is->m_index += sz;
+  }
+  is->m_index = k[2];
+  {
+    uint64_t v;
+    dds_stream_gen_get_bytes (is, &v, 1, 1);
+    dds_stream_gen_put_bytes (os, &v, 1, 1);
+  }
+  return true;
+}
+
+static const dds_topic_serializers_t Serializers_t1_serializers =
+{
+  .write = Serializers_t1_cdr_write_Serializers_t1,
+  .read = Serializers_t1_cdr_read_Serializers_t1,
+  .normalize = Serializers_t1_cdr_normalize_Serializers_t1,
+  .write_key = Serializers_t1_cdr_write_key,
+  .extract_key_from_data = Serializers_t1_cdr_extract_key
+};
+
+/* Type Information:
+  [MINIMAL 72496cebbbd504fba3d04800bd9a] (#deps: 3)
+   - [MINIMAL d7376d9d9d6d890ee0e0cd490818]
+   - [MINIMAL 6c25ef2ad8405383143fd8d14cfb]
+   - [MINIMAL 7f300db53105c1916a0e2aa7667b]
+  [COMPLETE 7b8b5fc99fd06bd014fd6f8d75a9] (#deps: 3)
+   - [COMPLETE f60b2157679e87ca3389cadeeefd]
+   - [COMPLETE 03ef571a8dae15aac75060e38aef]
+   - [COMPLETE c56138cfb353e0bcc99fe7632b05]
+*/
+#define TYPE_INFO_CDR_Serializers_t1 (unsigned char []){ \
+  0xf0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x70, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x72, 0x49, 0x6c, 0xeb, 0xbb, 0xd5, 0x04, 0xfb, 0xa3, 0xd0, 0x48, \
+  0x00, 0xbd, 0x9a, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xd7, 0x37, 0x6d, 0x9d, 0x9d, 0x6d, 0x89, \
+  0x0e, 0xe0, 0xe0, 0xcd, 0x49, 0x08, 0x18, 0x00, 0x52, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x6c, 0x25, 0xef, 0x2a, 0xd8, 0x40, 0x53, 0x83, 0x14, 0x3f, 0xd8, 0xd1, 0x4c, 0xfb, 0x00, \
+  0x66, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x7f, 0x30, 0x0d, 0xb5, 0x31, 0x05, 0xc1, \
+  0x91, 0x6a, 0x0e, 0x2a, 0xa7, 0x66, 0x7b, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x70, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x7b, 0x8b, 0x5f, \
+  0xc9, 0x9f, 0xd0, 0x6b, 0xd0, 0x14, 0xfd, 0x6f, 0x8d, 0x75, 0xa9, 0x00, 0x39, 0x01, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xf6, 0x0b, 0x21, 0x57, 0x67, 0x9e, 0x87, 0xca, 0x33, 0x89, 0xca, 0xde, 0xee, 0xfd, 0x00, \
+  0x7e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x03, 0xef, 0x57, 0x1a, 0x8d, 0xae, 0x15, \
+  0xaa, 0xc7, 0x50, 0x60, 0xe3, 0x8a, 0xef, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xc5, 0x61, 0x38, 0xcf, 0xb3, 0x53, 0xe0, 0xbc, 0xc9, 0x9f, 0xe7, 0x63, 0x2b, 0x05, 0x00, \
+  0x6b, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Serializers_t1 244u
+#define TYPE_MAP_CDR_Serializers_t1 (unsigned char []){ \
+  0x22, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf1, 0x72, 0x49, 0x6c, 0xeb, 0xbb, 0xd5, 0x04, \
+  0xfb, 0xa3, 0xd0, 0x48, 0x00, 0xbd, 0x9a, 0x00, 0xe1, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0xb8, 0x0b, 0xb7, 0x74, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x4a, 0x8a, 0x08, 0xf0, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x92, 0xeb, 0x5f, 0xfe, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x82, 0x77, 0xe0, 0x91, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0xb0, 0x68, 0x93, 0x1c, \
+  0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xd7, 0x37, 0x6d, 0x9d, 0x9d, \
+  0x6d, 0x89, 0x0e, 0xe0, 0xe0, 0xcd, 0x49, 0x08, 0x18, 0xe1, 0x67, 0x17, 0x97, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x6c, 0x25, 0xef, 0x2a, 0xd8, \
+  0x40, 0x53, 0x83, 0x14, 0x3f, 0xd8, 0xd1, 0x4c, 0xfb, 0x47, 0xe2, 0xe8, 0xc3, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x05, 0x4c, 0xab, 0x53, 0xff, \
+  0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x77, 0xcb, 0xc2, 0x57, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x7f, 0x30, 0x0d, 0xb5, 0x31, \
+  0x05, 0xc1, 0x91, 0x6a, 0x0e, 0x2a, 0xa7, 0x66, 0x7b, 0x22, 0x94, 0x88, 0x62, 0xf1, 0xd7, 0x37, \
+  0x6d, 0x9d, 0x9d, 0x6d, 0x89, 0x0e, 0xe0, 0xe0, 0xcd, 0x49, 0x08, 0x18, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x69, 0x6d, 0xe7, 0x24, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x3b, 0x51, 0x2c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xe8, 0x54, 0x8c, 0xf1, 0x6c, \
+  0x25, 0xef, 0x2a, 0xd8, 0x40, 0x53, 0x83, 0x14, 0x3f, 0xd8, 0xd1, 0x4c, 0xfb, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x52, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xa3, 0x7d, 0xb4, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xba, 0x35, 0x8d, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xc4, \
+  0x6b, 0x22, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0xe6, 0xb8, 0x26, 0xef, 0xf1, 0x7f, 0x30, 0x0d, 0xb5, 0x31, 0x05, 0xc1, 0x91, 0x6a, \
+  0x0e, 0x2a, 0xa7, 0x66, 0x7b, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x2c, \
+  0x54, 0xc9, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x1b, 0x45, 0x56, 0xfd, 0x00, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0xf2, 0x7b, 0x8b, 0x5f, 0xc9, 0x9f, 0xd0, 0x6b, 0xd0, 0x14, 0xfd, 0x6f, 0x8d, 0x75, 0xa9, 0x00, \
+  0x35, 0x01, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, \
+  0x3a, 0x74, 0x31, 0x00, 0x11, 0x01, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x69, 0x64, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, \
+  0x13, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xf6, 0x0b, 0x21, 0x57, 0x67, 0x9e, 0x87, 0xca, 0x33, 0x89, 0xca, 0xde, 0xee, \
+  0xfd, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x03, 0xef, 0x57, 0x1a, 0x8d, 0xae, 0x15, 0xaa, 0xc7, \
+  0x50, 0x60, 0xe3, 0x8a, 0xef, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x65, 0x6d, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x05, \
+  0x05, 0x00, 0x00, 0x00, 0x62, 0x73, 0x74, 0x72, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x73, 0x68, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0xc5, \
+  0x61, 0x38, 0xcf, 0xb3, 0x53, 0xe0, 0xbc, 0xc9, 0x9f, 0xe7, 0x63, 0x2b, 0x05, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x65, 0x6b, 0x00, 0x00, 0x00, 0xf2, 0xf6, 0x0b, 0x21, 0x57, 0x67, 0x9e, \
+  0x87, 0xca, 0x33, 0x89, 0xca, 0xde, 0xee, 0xfd, 0x7a, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x69, \
+  0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, 0x3a, 0x65, 0x6e, 0x00, 0x56, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x45, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x45, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x45, 0x5f, 0x33, 0x00, 0x00, 0x00, 0xf2, 0x03, 0xef, 0x57, 0x1a, 0x8d, 0xae, 0x15, 0xaa, 0xc7, \
+  0x50, 0x60, 0xe3, 0x8a, 0xef, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x69, \
+  0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, 0x3a, 0x65, 0x6e, 0x5f, 0x6d, 0x65, 0x64, 0x69, \
+  0x75, 0x6d, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x45, 0x4d, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x45, 0x4d, 0x5f, 0x32, \
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x45, 0x4d, 0x5f, 0x33, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x45, 0x4d, 0x5f, 0x34, 0x00, 0x00, 0x00, 0xf2, 0xc5, 0x61, 0x38, 0xcf, \
+  0xb3, 0x53, 0xe0, 0xbc, 0xc9, 0x9f, 0xe7, 0x63, 0x2b, 0x05, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, 0x3a, 0x65, 0x6e, 0x5f, \
+  0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x45, 0x53, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x45, 0x53, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0xf2, 0x7b, 0x8b, 0x5f, 0xc9, 0x9f, 0xd0, 0x6b, 0xd0, 0x14, 0xfd, 0x6f, 0x8d, 0x75, 0xa9, 0xf1, \
+  0x72, 0x49, 0x6c, 0xeb, 0xbb, 0xd5, 0x04, 0xfb, 0xa3, 0xd0, 0x48, 0x00, 0xbd, 0x9a, 0xf2, 0xf6, \
+  0x0b, 0x21, 0x57, 0x67, 0x9e, 0x87, 0xca, 0x33, 0x89, 0xca, 0xde, 0xee, 0xfd, 0xf1, 0xd7, 0x37, \
+  0x6d, 0x9d, 0x9d, 0x6d, 0x89, 0x0e, 0xe0, 0xe0, 0xcd, 0x49, 0x08, 0x18, 0xf2, 0x03, 0xef, 0x57, \
+  0x1a, 0x8d, 0xae, 0x15, 0xaa, 0xc7, 0x50, 0x60, 0xe3, 0x8a, 0xef, 0xf1, 0x6c, 0x25, 0xef, 0x2a, \
+  0xd8, 0x40, 0x53, 0x83, 0x14, 0x3f, 0xd8, 0xd1, 0x4c, 0xfb, 0xf2, 0xc5, 0x61, 0x38, 0xcf, 0xb3, \
+  0x53, 0xe0, 0xbc, 0xc9, 0x9f, 0xe7, 0x63, 0x2b, 0x05, 0xf1, 0x7f, 0x30, 0x0d, 0xb5, 0x31, 0x05, \
+  0xc1, 0x91, 0x6a, 0x0e, 0x2a, 0xa7, 0x66, 0x7b\
+}
+#define TYPE_MAP_CDR_SZ_Serializers_t1 1464u
+const dds_topic_descriptor_t Serializers_t1_desc =
+{
+  .m_size = sizeof (Serializers_t1),
+  .m_align = dds_alignof (Serializers_t1),
+  .m_flagset = DDS_TOPIC_SERIALIZERS | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "Serializers::t1",
+  .m_keys = Serializers_t1_keys,
+  .m_nops = 11,
+  .m_ops = Serializers_t1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Serializers_t1, .sz = TYPE_INFO_CDR_SZ_Serializers_t1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Serializers_t1, .sz = TYPE_MAP_CDR_SZ_Serializers_t1 },
+  .serializers = &Serializers_t1_serializers
+};
+
+static const uint32_t Serializers_t1_view_index[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+static const uint32_t Serializers_t1_view_member_id[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+static const dds_view_member_t Serializers_t1_view_members[] =
+{
+  { 1, &Serializers_t1_view_index[0], &Serializers_t1_view_member_id[0] },
+  { 1, &Serializers_t1_view_index[1], &Serializers_t1_view_member_id[1] },
+  { 1, &Serializers_t1_view_index[2], &Serializers_t1_view_member_id[2] },
+  { 1, &Serializers_t1_view_index[3], &Serializers_t1_view_member_id[3] },
+  { 1, &Serializers_t1_view_index[4], &Serializers_t1_view_member_id[4] },
+  { 1, &Serializers_t1_view_index[5], &Serializers_t1_view_member_id[5] },
+  { 1, &Serializers_t1_view_index[6], &Serializers_t1_view_member_id[6] },
+  { 1, &Serializers_t1_view_index[7], &Serializers_t1_view_member_id[7] },
+  { 1, &Serializers_t1_view_index[8], &Serializers_t1_view_member_id[8] },
+  { 1, &Serializers_t1_view_index[9], &Serializers_t1_view_member_id[9] }
+};
+
+static dds_view_desc_t Serializers_t1_view_desc = { &Serializers_t1_desc, 10, Serializers_t1_view_members, DDSRT_ATOMIC_VOIDP_INIT (NULL) };
+
+dds_return_t Serializers_t1_view_init (Serializers_t1_view *view, struct ddsi_serdata *serdata)
+{
+  return dds_view_init (&view->v, &Serializers_t1_view_desc, view->offs, serdata);
+}
+
+void Serializers_t1_view_fini (Serializers_t1_view *view)
+{
+  dds_view_fini (&view->v);
+}
+
+bool Serializers_t1_view_id (Serializers_t1_view *view, int32_t *value)
+{
+  const void *p = dds_view_member (&view->v, 0, 4);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t1_view_c (Serializers_t1_view *view, char *value)
+{
+  const void *p = dds_view_member (&view->v, 1, 1);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t1_view_b (Serializers_t1_view *view, bool *value)
+{
+  const unsigned char *p = dds_view_member (&view->v, 2, 1);
+  if (p == NULL)
+    return false;
+  *value = (*p != 0);
+  return true;
+}
+
+bool Serializers_t1_view_d (Serializers_t1_view *view, double *value)
+{
+  const void *p = dds_view_member (&view->v, 3, 8);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t1_view_name (Serializers_t1_view *view, const char **value)
+{
+  return (*value = dds_view_string (&view->v, 4)) != NULL;
+}
+
+bool Serializers_t1_view_e (Serializers_t1_view *view, Serializers_en *value)
+{
+  const void *p = dds_view_member (&view->v, 5, 4);
+  uint32_t x;
+  if (p == NULL)
+    return false;
+  memcpy (&x, p, sizeof (x));
+  *value = (Serializers_en) x;
+  return true;
+}
+
+bool Serializers_t1_view_em (Serializers_t1_view *view, Serializers_en_medium *value)
+{
+  const void *p = dds_view_member (&view->v, 6, 2);
+  uint16_t x;
+  if (p == NULL)
+    return false;
+  memcpy (&x, p, sizeof (x));
+  *value = (Serializers_en_medium) x;
+  return true;
+}
+
+bool Serializers_t1_view_bstr (Serializers_t1_view *view, const char **value)
+{
+  return (*value = dds_view_string (&view->v, 7)) != NULL;
+}
+
+bool Serializers_t1_view_sh (Serializers_t1_view *view, int16_t *value)
+{
+  const void *p = dds_view_member (&view->v, 8, 2);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t1_view_ek (Serializers_t1_view *view, Serializers_en_small *value)
+{
+  const void *p = dds_view_member (&view->v, 9, 1);
+  uint8_t x;
+  if (p == NULL)
+    return false;
+  memcpy (&x, p, sizeof (x));
+  *value = (Serializers_en_small) x;
+  return true;
+}
+
+static const uint32_t Serializers_t2_ops [] =
+{
+  /* t2 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Serializers_t2, o),
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Serializers_t2, n), (3u << 16u) + 61u /* n2 */,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t2, k1),
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t2, l), 3u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t2, la), 6u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BLN, offsetof (Serializers_t2, ba), 3u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (Serializers_t2, ea), 2u, 2u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_STR, offsetof (Serializers_t2, sa), 2u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BST, offsetof (Serializers_t2, bsa), 2u, 0u, 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_STU, offsetof (Serializers_t2, na), 2u, (5u << 16u) + 49u /* n1 */, sizeof (Serializers_n1),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_1BY, offsetof (Serializers_t2, so),
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_8BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t2, sll), 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_2BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t2, ss),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_BLN, offsetof (Serializers_t2, sb),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_ENU | (1 << DDS_OP_FLAG_SZ_SHIFT), offsetof (Serializers_t2, se), 3u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STR, offsetof (Serializers_t2, sstr),
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_BST, offsetof (Serializers_t2, sbstr), 2u, 5u,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STU, offsetof (Serializers_t2, sn), sizeof (Serializers_n1), (4u << 16u) + 26u /* n1 */,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STU, offsetof (Serializers_t2, sn2), sizeof (Serializers_n2), (4u << 16u) + 8u /* n2 */,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_BST, offsetof (Serializers_t2, k2), 9u,
+  DDS_OP_RTS,
+
+  /* n2 */
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_STU, offsetof (Serializers_n2, a), 2u, (5u << 16u) + 14u /* n1 */, sizeof (Serializers_n1),
+  DDS_OP_ADR | DDS_OP_TYPE_BSQ | DDS_OP_SUBTYPE_STU, offsetof (Serializers_n2, bs), 3u, sizeof (Serializers_n1), (5u << 16u) + 9u /* n1 */,
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (0 << DDS_OP_FLAG_SZ_SHIFT), offsetof (Serializers_n2, es), 1u,
+  DDS_OP_RTS,
+
+  /* n1 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Serializers_n1, o),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (Serializers_n1, s),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (Serializers_n1, ll),
+  DDS_OP_RTS,
+  
+  /* key: k1 */
+  DDS_OP_KOF | 1, 5u /* order: 2 */,
+  
+  /* key: k2 */
+  DDS_OP_KOF | 1, 59u /* order: 19 */
+};
+
+static const dds_key_descriptor_t Serializers_t2_keys[2] =
+{
+  { "k1", 84, 0 },
+  { "k2", 86, 1 }
+};
+
+static bool Serializers_t2_cdr_write_Serializers_t2 (dds_ostream_t *os, const void *sample);
+static void Serializers_t2_cdr_read_Serializers_t2 (dds_istream_t *is, void *sample);
+static bool Serializers_t2_cdr_normalize_Serializers_t2 (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version);
+static bool Serializers_t2_cdr_write_Serializers_n2 (dds_ostream_t *os, const void *sample);
+static void Serializers_t2_cdr_read_Serializers_n2 (dds_istream_t *is, void *sample);
+static bool Serializers_t2_cdr_normalize_Serializers_n2 (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version);
+static void Serializers_t2_cdr_skip_Serializers_n2 (dds_istream_t *is);
+static bool Serializers_t2_cdr_write_Serializers_n1 (dds_ostream_t *os, const void *sample);
+static void Serializers_t2_cdr_read_Serializers_n1 (dds_istream_t *is, void *sample);
+static bool Serializers_t2_cdr_normalize_Serializers_n1 (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version);
+static void Serializers_t2_cdr_skip_Serializers_n1 (dds_istream_t *is);
+
+static bool Serializers_t2_cdr_write_Serializers_t2 (dds_ostream_t *os, const void *sample)
+{
+  const char *data = sample;
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t2, o), 1, 1);
+  if (!Serializers_t2_cdr_write_Serializers_n2 (os, data + offsetof (Serializers_t2, n)))
+    return false;
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t2, k1), dds_stream_gen_align (os->m_xcdr_version, 8), 8);
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t2, l), 4, 12);
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t2, la), 4, 24);
+  for (uint32_t i = 0; i < 3; i++)
+    if (((const uint8_t *) (data + offsetof (Serializers_t2, ba)))[i] > 1)
+      return false;
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t2, ba), 1, 3);
+  {
+    const char *a = data + offsetof (Serializers_t2, ea);
+    const uint32_t dh = (os->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2) ? dds_stream_gen_reserve_dheader (os) : 0;
+    for (uint32_t i = 0; i < 2; i++)
+    {
+      if (*(const uint32_t *) (a + i * sizeof (uint32_t)) > 2)
+        return false;
+      dds_stream_gen_put4 (os, *(const uint32_t *) (a + i * sizeof (uint32_t)));
+    }
+    if (dh > 0)
+      dds_stream_gen_patch_dheader (os, dh);
+  }
+  {
+    const char *a = data + offsetof (Serializers_t2, sa);
+    const uint32_t dh = (os->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2) ? dds_stream_gen_reserve_dheader (os) : 0;
+    for (uint32_t i = 0; i < 2; i++)
+    {
+      dds_stream_gen_put_string (os, *(const char * const *) (a + i * sizeof (char *)));
+    }
+    if (dh > 0)
+      dds_stream_gen_patch_dheader (os, dh);
+  }
+  {
+    const char *a = data + offsetof (Serializers_t2, bsa);
+    const uint32_t dh = (os->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2) ? dds_stream_gen_reserve_dheader (os) : 0;
+    for (uint32_t i = 0; i < 2; i++)
+    {
+      dds_stream_gen_put_string (os, (const char *) (a + i * 4));
+    }
+    if (dh > 0)
+      dds_stream_gen_patch_dheader (os, dh);
+  }
+  {
+    const char *a = data + offsetof (Serializers_t2, na);
+    const uint32_t dh = (os->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2) ? dds_stream_gen_reserve_dheader (os) : 0;
+    for (uint32_t i = 0; i < 2; i++)
+    {
+      if (!Serializers_t2_cdr_write_Serializers_n1 (os, a + i * sizeof (Serializers_n1)))
+        return false;
+    }
+    if (dh > 0)
+      dds_stream_gen_patch_dheader (os, dh);
+  }
+  {
+    const dds_sequence_t *seq = (const dds_sequence_t *) (data + offsetof (Serializers_t2, so));
+    dds_stream_gen_put4 (os, seq->_length);
+    if (seq->_length > 0)
+      dds_stream_gen_put_bytes (os, seq->_buffer, 1, seq->_length * 1);
+  }
+  {
+    const dds_sequence_t *seq = (const dds_sequence_t *) (data + offsetof (Serializers_t2, sll));
+    if (seq->_length > 4)
+      return false;
+    dds_stream_gen_put4 (os, seq->_length);
+    if (seq->_length > 0)
+      dds_stream_gen_put_bytes (os, seq->_buffer, dds_stream_gen_align (os->m_xcdr_version, 8), seq->_length * 8);
+  }
+  {
+    const dds_sequence_t *seq = (const dds_sequence_t *) (data + offsetof (Serializers_t2, ss));
+    dds_stream_gen_put4 (os, seq->_length);
+    if (seq->_length > 0)
+      dds_stream_gen_put_bytes (os, seq->_buffer, 2, seq->_length * 2);
+  }
+  {
+    const dds_sequence_t *seq = (const dds_sequence_t *) (data + offsetof (Serializers_t2, sb));
+    dds_stream_gen_put4 (os, seq->_length);
+    for (uint32_t i = 0; i < seq->_length; i++)
+      if (seq->_buffer[i] > 1)
+        return false;
+    if (seq->_length > 0)
+      dds_stream_gen_put_bytes (os, seq->_buffer, 1, seq->_length);
+  }
+  {
+    const dds_sequence_t *seq = (const dds_sequence_t *) (data + offsetof (Serializers_t2, se));
+    const uint32_t dh = (os->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2) ? dds_stream_gen_reserve_dheader (os) : 0;
+    dds_stream_gen_put4 (os, seq->_length);
+    for (uint32_t i = 0; i < seq->_length; i++)
+    {
+      if (*(const uint32_t *) ((const char *) seq->_buffer + i * sizeof (uint32_t)) > 3)
+        return false;
+      dds_stream_gen_put2 (os, (uint16_t) *(const uint32_t *) ((const char *) seq->_buffer + i * sizeof (uint32_t)));
+    }
+    if (dh > 0)
+      dds_stream_gen_patch_dheader (os, dh);
+  }
+  {
+    const dds_sequence_t *seq = (const dds_sequence_t *) (data + offsetof (Serializers_t2, sstr));
+    const uint32_t dh = (os->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2) ? dds_stream_gen_reserve_dheader (os) : 0;
+    dds_stream_gen_put4 (os, seq->_length);
+    for (uint32_t i = 0; i < seq->_length; i++)
+    {
+      dds_stream_gen_put_string (os, *(const char * const *) ((const char *) seq->_buffer + i * sizeof (char *)));
+    }
+    if (dh > 0)
+      dds_stream_gen_patch_dheader (os, dh);
+  }
+  {
+    const dds_sequence_t *seq = (const dds_sequence_t *) (data + offsetof (Serializers_t2, sbstr));
+    if (seq->_length > 2)
+      return false;
+    const uint32_t dh = (os->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2) ? dds_stream_gen_reserve_dheader (os) : 0;
+    dds_stream_gen_put4 (os, seq->_length);
+    for (uint32_t i = 0; i < seq->_length; i++)
+    {
+      dds_stream_gen_put_string (os, (const char *) ((const char *) seq->_buffer + i * 5));
+    }
+    if (dh > 0)
+      dds_stream_gen_patch_dheader (os, dh);
+  }
+  {
+    const dds_sequence_t *seq = (const dds_sequence_t *) (data + offsetof (Serializers_t2, sn));
+    const uint32_t dh = (os->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2) ? dds_stream_gen_reserve_dheader (os) : 0;
+    dds_stream_gen_put4 (os, seq->_length);
+    for (uint32_t i = 0; i < seq->_length; i++)
+    {
+      if (!Serializers_t2_cdr_write_Serializers_n1 (os, (const char *) seq->_buffer + i * sizeof (Serializers_n1)))
+        return false;
+    }
+    if (dh > 0)
+      dds_stream_gen_patch_dheader (os, dh);
+  }
+  {
+    const dds_sequence_t *seq = (const dds_sequence_t *) (data + offsetof (Serializers_t2, sn2));
+    const uint32_t dh = (os->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2) ? dds_stream_gen_reserve_dheader (os) : 0;
+    dds_stream_gen_put4 (os, seq->_length);
+    for (uint32_t i = 0; i < seq->_length; i++)
+    {
+      if (!Serializers_t2_cdr_write_Serializers_n2 (os, (const char *) seq->_buffer + i * sizeof (Serializers_n2)))
+        return false;
+    }
+    if (dh > 0)
+      dds_stream_gen_patch_dheader (os, dh);
+  }
+  dds_stream_gen_put_string (os, (const char *) (data + offsetof (Serializers_t2, k2)));
+  return true;
+}
+
+static void Serializers_t2_cdr_read_Serializers_t2 (dds_istream_t *is, void *sample)
+{
+  char *data = sample;
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_t2, o), 1, 1);
+  Serializers_t2_cdr_read_Serializers_n2 (is, data + offsetof (Serializers_t2, n));
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_t2, k1), dds_stream_gen_align (is->m_xcdr_version, 8), 8);
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_t2, l), 4, 12);
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_t2, la), 4, 24);
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_t2, ba), 1, 3);
+  {
+    char *a = data + offsetof (Serializers_t2, ea);
+    if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+      dds_stream_gen_skip (is, 4, 4);
+    for (uint32_t i = 0; i < 2; i++)
+      *(uint32_t *) (a + i * sizeof (uint32_t)) = dds_stream_gen_get4 (is);
+  }
+  {
+    char *a = data + offsetof (Serializers_t2, sa);
+    if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+      dds_stream_gen_skip (is, 4, 4);
+    for (uint32_t i = 0; i < 2; i++)
+      *(char **) (a + i * sizeof (char *)) = dds_stream_gen_read_string (is, *(char **) (a + i * sizeof (char *)));
+  }
+  {
+    char *a = data + offsetof (Serializers_t2, bsa);
+    if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+      dds_stream_gen_skip (is, 4, 4);
+    for (uint32_t i = 0; i < 2; i++)
+      dds_stream_gen_read_bstring (is, a + i * 4, 4);
+  }
+  {
+    char *a = data + offsetof (Serializers_t2, na);
+    if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+      dds_stream_gen_skip (is, 4, 4);
+    for (uint32_t i = 0; i < 2; i++)
+      Serializers_t2_cdr_read_Serializers_n1 (is, a + i * sizeof (Serializers_n1));
+  }
+  {
+    dds_sequence_t *seq = (dds_sequence_t *) (data + offsetof (Serializers_t2, so));
+    const uint32_t num = dds_stream_gen_get4 (is);
+    if (num == 0)
+      seq->_length = 0;
+    else
+    {
+      dds_stream_gen_realloc_sequence (is, seq, num, 1, false);
+      dds_stream_gen_get_bytes (is, seq->_buffer, 1, seq->_length * 1);
+      if (seq->_length < num)
+        dds_stream_gen_skip (is, 1, (num - seq->_length) * 1);
+    }
+  }
+  {
+    dds_sequence_t *seq = (dds_sequence_t *) (data + offsetof (Serializers_t2, sll));
+    const uint32_t num = dds_stream_gen_get4 (is);
+    if (num == 0)
+      seq->_length = 0;
+    else
+    {
+      dds_stream_gen_realloc_sequence (is, seq, num, 8, false);
+      dds_stream_gen_get_bytes (is, seq->_buffer, dds_stream_gen_align (is->m_xcdr_version, 8), seq->_length * 8);
+      if (seq->_length < num)
+        dds_stream_gen_skip (is, 1, (num - seq->_length) * 8);
+    }
+  }
+  {
+    dds_sequence_t *seq = (dds_sequence_t *) (data + offsetof (Serializers_t2, ss));
+    const uint32_t num = dds_stream_gen_get4 (is);
+    if (num == 0)
+      seq->_length = 0;
+    else
+    {
+      dds_stream_gen_realloc_sequence (is, seq, num, 2, false);
+      dds_stream_gen_get_bytes (is, seq->_buffer, 2, seq->_length * 2);
+      if (seq->_length < num)
+        dds_stream_gen_skip (is, 1, (num - seq->_length) * 2);
+    }
+  }
+  {
+    dds_sequence_t *seq = (dds_sequence_t *) (data + offsetof (Serializers_t2, sb));
+    const uint32_t num = dds_stream_gen_get4 (is);
+    if (num == 0)
+      seq->_length = 0;
+    else
+    {
+      dds_stream_gen_realloc_sequence (is, seq, num, 1, false);
+      dds_stream_gen_get_bytes (is, seq->_buffer, 1, seq->_length * 1);
+      if (seq->_length < num)
+        dds_stream_gen_skip (is, 1, (num - seq->_length) * 1);
+    }
+  }
+  {
+    dds_sequence_t *seq = (dds_sequence_t *) (data + offsetof (Serializers_t2, se));
+    if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+      dds_stream_gen_skip (is, 4, 4);
+    const uint32_t num = dds_stream_gen_get4 (is);
+    if (num == 0)
+      seq->_length = 0;
+    else
+    {
+      dds_stream_gen_realloc_sequence (is, seq, num, sizeof (uint32_t), false);
+      for (uint32_t i = 0; i < seq->_length; i++)
+        *(uint32_t *) ((char *) seq->_buffer + i * sizeof (uint32_t)) = dds_stream_gen_get2 (is);
+      if (seq->_length < num)
+        dds_stream_gen_skip (is, 1, (num - seq->_length) * 2);
+    }
+  }
+  {
+    dds_sequence_t *seq = (dds_sequence_t *) (data + offsetof (Serializers_t2, sstr));
+    if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+      dds_stream_gen_skip (is, 4, 4);
+    const uint32_t num = dds_stream_gen_get4 (is);
+    if (num == 0)
+      seq->_length = 0;
+    else
+    {
+      dds_stream_gen_realloc_sequence (is, seq, num, sizeof (char *), true);
+      for (uint32_t i = 0; i < seq->_length; i++)
+        *(char **) ((char *) seq->_buffer + i * sizeof (char *)) = dds_stream_gen_read_string (is, *(char **) ((char *) seq->_buffer + i * sizeof (char *)));
+      for (uint32_t i = seq->_length; i < num; i++)
+        dds_stream_gen_skip_string (is);
+    }
+  }
+  {
+    dds_sequence_t *seq = (dds_sequence_t *) (data + offsetof (Serializers_t2, sbstr));
+    if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+      dds_stream_gen_skip (is, 4, 4);
+    const uint32_t num = dds_stream_gen_get4 (is);
+    if (num == 0)
+      seq->_length = 0;
+    else
+    {
+      dds_stream_gen_realloc_sequence (is, seq, num, 5, false);
+      for (uint32_t i = 0; i < seq->_length; i++)
+        dds_stream_gen_read_bstring (is, (char *) seq->_buffer + i * 5, 5);
+      for (uint32_t i = seq->_length; i < num; i++)
+        dds_stream_gen_skip_string (is);
+    }
+  }
+  {
+    dds_sequence_t *seq = (dds_sequence_t *) (data + offsetof (Serializers_t2, sn));
+    if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+      dds_stream_gen_skip (is, 4, 4);
+    const uint32_t num = dds_stream_gen_get4 (is);
+    if (num == 0)
+      seq->_length = 0;
+    else
+    {
+      dds_stream_gen_realloc_sequence (is, seq, num, sizeof (Serializers_n1), true);
+      for (uint32_t i = 0; i < seq->_length; i++)
+        Serializers_t2_cdr_read_Serializers_n1 (is, (char *) seq->_buffer + i * sizeof (Serializers_n1));
+      for (uint32_t i = seq->_length; i < num; i++)
+        Serializers_t2_cdr_skip_Serializers_n1 (is);
+    }
+  }
+  {
+    dds_sequence_t *seq = (dds_sequence_t *) (data + offsetof (Serializers_t2, sn2));
+    if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+      dds_stream_gen_skip (is, 4, 4);
+    const uint32_t num = dds_stream_gen_get4 (is);
+    if (num == 0)
+      seq->_length = 0;
+    else
+    {
+      dds_stream_gen_realloc_sequence (is, seq, num, sizeof (Serializers_n2), true);
+      for (uint32_t i = 0; i < seq->_length; i++)
+        Serializers_t2_cdr_read_Serializers_n2 (is, (char *) seq->_buffer + i * sizeof (Serializers_n2));
+      for (uint32_t i = seq->_length; i < num; i++)
+        Serializers_t2_cdr_skip_Serializers_n2 (is);
+    }
+  }
+  dds_stream_gen_read_bstring (is, data + offsetof (Serializers_t2, k2), 9);
+}
+
+static bool Serializers_t2_cdr_normalize_Serializers_t2 (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version)
+{
+  if (!dds_stream_gen_normalize_prim (data, off, size, bswap, 1, xcdr_version))
+    return false;
+  if (!Serializers_t2_cdr_normalize_Serializers_n2 (data, off, size, bswap, xcdr_version))
+    return false;
+  if (!dds_stream_gen_normalize_prim (data, off, size, bswap, 8, xcdr_version))
+    return false;
+  {
+    const uint32_t num = 3;
+    if (num > 0 && !dds_stream_gen_normalize_primarray (data, off, size, bswap, num, 4, xcdr_version))
+      return false;
+  }
+  {
+    const uint32_t num = 6;
+    if (num > 0 && !dds_stream_gen_normalize_primarray (data, off, size, bswap, num, 4, xcdr_version))
+      return false;
+  }
+  {
+    const uint32_t num = 3;
+    if (num > 0 && !dds_stream_gen_normalize_enumarray (data, off, size, bswap, 1, num, 1))
+      return false;
+  }
+  {
+    uint32_t size1 = size;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && !dds_stream_gen_normalize_dheader (&size1, data, off, size, bswap))
+      return false;
+    const uint32_t num = 2;
+    if (num > 0 && !dds_stream_gen_normalize_enumarray (data, off, size1, bswap, 4, num, 2))
+      return false;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && *off != size1)
+      return dds_stream_gen_normalize_error ();
+  }
+  {
+    uint32_t size1 = size;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && !dds_stream_gen_normalize_dheader (&size1, data, off, size, bswap))
+      return false;
+    const uint32_t num = 2;
+    for (uint32_t i = 0; i < num; i++)
+      if (!dds_stream_gen_normalize_string (data, off, size1, bswap, SIZE_MAX))
+        return false;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && *off != size1)
+      return dds_stream_gen_normalize_error ();
+  }
+  {
+    uint32_t size1 = size;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && !dds_stream_gen_normalize_dheader (&size1, data, off, size, bswap))
+      return false;
+    const uint32_t num = 2;
+    for (uint32_t i = 0; i < num; i++)
+      if (!dds_stream_gen_normalize_string (data, off, size1, bswap, 4))
+        return false;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && *off != size1)
+      return dds_stream_gen_normalize_error ();
+  }
+  {
+    uint32_t size1 = size;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && !dds_stream_gen_normalize_dheader (&size1, data, off, size, bswap))
+      return false;
+    const uint32_t num = 2;
+    for (uint32_t i = 0; i < num; i++)
+      if (!Serializers_t2_cdr_normalize_Serializers_n1 (data, off, size1, bswap, xcdr_version))
+        return false;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && *off != size1)
+      return dds_stream_gen_normalize_error ();
+  }
+  {
+    uint32_t num;
+    if (!dds_stream_gen_normalize_uint32 (&num, data, off, size, bswap))
+      return false;
+    if (num > 0 && !dds_stream_gen_normalize_primarray (data, off, size, bswap, num, 1, xcdr_version))
+      return false;
+  }
+  {
+    uint32_t num;
+    if (!dds_stream_gen_normalize_uint32 (&num, data, off, size, bswap))
+      return false;
+    if (num > 4)
+      return dds_stream_gen_normalize_error ();
+    if (num > 0 && !dds_stream_gen_normalize_primarray (data, off, size, bswap, num, 8, xcdr_version))
+      return false;
+  }
+  {
+    uint32_t num;
+    if (!dds_stream_gen_normalize_uint32 (&num, data, off, size, bswap))
+      return false;
+    if (num > 0 && !dds_stream_gen_normalize_primarray (data, off, size, bswap, num, 2, xcdr_version))
+      return false;
+  }
+  {
+    uint32_t num;
+    if (!dds_stream_gen_normalize_uint32 (&num, data, off, size, bswap))
+      return false;
+    if (num > 0 && !dds_stream_gen_normalize_enumarray (data, off, size, bswap, 1, num, 1))
+      return false;
+  }
+  {
+    uint32_t size1 = size;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && !dds_stream_gen_normalize_dheader (&size1, data, off, size, bswap))
+      return false;
+    uint32_t num;
+    if (!dds_stream_gen_normalize_uint32 (&num, data, off, size1, bswap))
+      return false;
+    if (num > 0 && !dds_stream_gen_normalize_enumarray (data, off, size1, bswap, 2, num, 3))
+      return false;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && *off != size1)
+      return dds_stream_gen_normalize_error ();
+  }
+  {
+    uint32_t size1 = size;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && !dds_stream_gen_normalize_dheader (&size1, data, off, size, bswap))
+      return false;
+    uint32_t num;
+    if (!dds_stream_gen_normalize_uint32 (&num, data, off, size1, bswap))
+      return false;
+    for (uint32_t i = 0; i < num; i++)
+      if (!dds_stream_gen_normalize_string (data, off, size1, bswap, SIZE_MAX))
+        return false;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && *off != size1)
+      return dds_stream_gen_normalize_error ();
+  }
+  {
+    uint32_t size1 = size;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && !dds_stream_gen_normalize_dheader (&size1, data, off, size, bswap))
+      return false;
+    uint32_t num;
+    if (!dds_stream_gen_normalize_uint32 (&num, data, off, size1, bswap))
+      return false;
+    if (num > 2)
+      return dds_stream_gen_normalize_error ();
+    for (uint32_t i = 0; i < num; i++)
+      if (!dds_stream_gen_normalize_string (data, off, size1, bswap, 5))
+        return false;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && *off != size1)
+      return dds_stream_gen_normalize_error ();
+  }
+  {
+    uint32_t size1 = size;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && !dds_stream_gen_normalize_dheader (&size1, data, off, size, bswap))
+      return false;
+    uint32_t num;
+    if (!dds_stream_gen_normalize_uint32 (&num, data, off, size1, bswap))
+      return false;
+    for (uint32_t i = 0; i < num; i++)
+      if (!Serializers_t2_cdr_normalize_Serializers_n1 (data, off, size1, bswap, xcdr_version))
+        return false;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && *off != size1)
+      return dds_stream_gen_normalize_error ();
+  }
+  {
+    uint32_t size1 = size;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && !dds_stream_gen_normalize_dheader (&size1, data, off, size, bswap))
+      return false;
+    uint32_t num;
+    if (!dds_stream_gen_normalize_uint32 (&num, data, off, size1, bswap))
+      return false;
+    for (uint32_t i = 0; i < num; i++)
+      if (!Serializers_t2_cdr_normalize_Serializers_n2 (data, off, size1, bswap, xcdr_version))
+        return false;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && *off != size1)
+      return dds_stream_gen_normalize_error ();
+  }
+  if (!dds_stream_gen_normalize_string (data, off, size, bswap, 9))
+    return false;
+  return true;
+}
+
+static bool Serializers_t2_cdr_write_Serializers_n2 (dds_ostream_t *os, const void *sample)
+{
+  const char *data = sample;
+  {
+    const char *a = data + offsetof (Serializers_n2, a);
+    const uint32_t dh = (os->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2) ? dds_stream_gen_reserve_dheader (os) : 0;
+    for (uint32_t i = 0; i < 2; i++)
+    {
+      if (!Serializers_t2_cdr_write_Serializers_n1 (os, a + i * sizeof (Serializers_n1)))
+        return false;
+    }
+    if (dh > 0)
+      dds_stream_gen_patch_dheader (os, dh);
+  }
+  {
+    const dds_sequence_t *seq = (const dds_sequence_t *) (data + offsetof (Serializers_n2, bs));
+    if (seq->_length > 3)
+      return false;
+    const uint32_t dh = (os->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2) ? dds_stream_gen_reserve_dheader (os) : 0;
+    dds_stream_gen_put4 (os, seq->_length);
+    for (uint32_t i = 0; i < seq->_length; i++)
+    {
+      if (!Serializers_t2_cdr_write_Serializers_n1 (os, (const char *) seq->_buffer + i * sizeof (Serializers_n1)))
+        return false;
+    }
+    if (dh > 0)
+      dds_stream_gen_patch_dheader (os, dh);
+  }
+  if (*(const uint32_t *) (data + offsetof (Serializers_n2, es)) > 1)
+    return false;
+  dds_stream_gen_put1 (os, (uint8_t) *(const uint32_t *) (data + offsetof (Serializers_n2, es)));
+  return true;
+}
+
+static void Serializers_t2_cdr_read_Serializers_n2 (dds_istream_t *is, void *sample)
+{
+  char *data = sample;
+  {
+    char *a = data + offsetof (Serializers_n2, a);
+    if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+      dds_stream_gen_skip (is, 4, 4);
+    for (uint32_t i = 0; i < 2; i++)
+      Serializers_t2_cdr_read_Serializers_n1 (is, a + i * sizeof (Serializers_n1));
+  }
+  {
+    dds_sequence_t *seq = (dds_sequence_t *) (data + offsetof (Serializers_n2, bs));
+    if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+      dds_stream_gen_skip (is, 4, 4);
+    const uint32_t num = dds_stream_gen_get4 (is);
+    if (num == 0)
+      seq->_length = 0;
+    else
+    {
+      dds_stream_gen_realloc_sequence (is, seq, num, sizeof (Serializers_n1), true);
+      for (uint32_t i = 0; i < seq->_length; i++)
+        Serializers_t2_cdr_read_Serializers_n1 (is, (char *) seq->_buffer + i * sizeof (Serializers_n1));
+      for (uint32_t i = seq->_length; i < num; i++)
+        Serializers_t2_cdr_skip_Serializers_n1 (is);
+    }
+  }
+  *(uint32_t *) (data + offsetof (Serializers_n2, es)) = dds_stream_gen_get1 (is);
+}
+
+static bool Serializers_t2_cdr_normalize_Serializers_n2 (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version)
+{
+  {
+    uint32_t size1 = size;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && !dds_stream_gen_normalize_dheader (&size1, data, off, size, bswap))
+      return false;
+    const uint32_t num = 2;
+    for (uint32_t i = 0; i < num; i++)
+      if (!Serializers_t2_cdr_normalize_Serializers_n1 (data, off, size1, bswap, xcdr_version))
+        return false;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && *off != size1)
+      return dds_stream_gen_normalize_error ();
+  }
+  {
+    uint32_t size1 = size;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && !dds_stream_gen_normalize_dheader (&size1, data, off, size, bswap))
+      return false;
+    uint32_t num;
+    if (!dds_stream_gen_normalize_uint32 (&num, data, off, size1, bswap))
+      return false;
+    if (num > 3)
+      return dds_stream_gen_normalize_error ();
+    for (uint32_t i = 0; i < num; i++)
+      if (!Serializers_t2_cdr_normalize_Serializers_n1 (data, off, size1, bswap, xcdr_version))
+        return false;
+    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && *off != size1)
+      return dds_stream_gen_normalize_error ();
+  }
+  if (!dds_stream_gen_normalize_enumarray (data, off, size, bswap, 1, 1, 1))
+    return false;
+  return true;
+}
+
+static void Serializers_t2_cdr_skip_Serializers_n2 (dds_istream_t *is)
+{
+  if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+    dds_stream_gen_skip (is, 1, dds_stream_gen_get4 (is));
+  else
+  {
+    const uint32_t num = 2;
+    for (uint32_t i = 0; i < num; i++)
+      Serializers_t2_cdr_skip_Serializers_n1 (is);
+  }
+  if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+    dds_stream_gen_skip (is, 1, dds_stream_gen_get4 (is));
+  else
+  {
+    const uint32_t num = dds_stream_gen_get4 (is);
+    for (uint32_t i = 0; i < num; i++)
+      Serializers_t2_cdr_skip_Serializers_n1 (is);
+  }
+  dds_stream_gen_skip (is, 1, 1);
+}
+
+static bool Serializers_t2_cdr_write_Serializers_n1 (dds_ostream_t *os, const void *sample)
+{
+  const char *data = sample;
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_n1, o), 1, 1);
+  dds_stream_gen_put_string (os, *(const char * const *) (data + offsetof (Serializers_n1, s)));
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_n1, ll), dds_stream_gen_align (os->m_xcdr_version, 8), 8);
+  return true;
+}
+
+static void Serializers_t2_cdr_read_Serializers_n1 (dds_istream_t *is, void *sample)
+{
+  char *data = sample;
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_n1, o), 1, 1);
+  *(char **) (data + offsetof (Serializers_n1, s)) = dds_stream_gen_read_string (is, *(char **) (data + offsetof (Serializers_n1, s)));
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_n1, ll), dds_stream_gen_align (is->m_xcdr_version, 8), 8);
+}
+
+static bool Serializers_t2_cdr_normalize_Serializers_n1 (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version)
+{
+  if (!dds_stream_gen_normalize_prim (data, off, size, bswap, 1, xcdr_version))
+    return false;
+  if (!dds_stream_gen_normalize_string (data, off, size, bswap, SIZE_MAX))
+    return false;
+  if (!dds_stream_gen_normalize_prim (data, off, size, bswap, 8, xcdr_version))
+    return false;
+  return true;
+}
+
+static void Serializers_t2_cdr_skip_Serializers_n1 (dds_istream_t *is)
+{
+  dds_stream_gen_skip (is, 1, 1);
+  dds_stream_gen_skip_string (is);
+  dds_stream_gen_skip (is, dds_stream_gen_align (is->m_xcdr_version, 8), 8);
+}
+
+static void Serializers_t2_cdr_write_key (dds_ostream_t *os, const void *sample)
+{
+  const char *data = sample;
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t2, k1), dds_stream_gen_align (os->m_xcdr_version, 8), 8);
+  dds_stream_gen_put_string (os, (const char *) (data + offsetof (Serializers_t2, k2)));
+}
+
+static bool Serializers_t2_cdr_extract_key (dds_istream_t *is, dds_ostream_t *os)
+{
+  uint32_t k[2];
+  dds_stream_gen_skip (is, 1, 1);
+  Serializers_t2_cdr_skip_Serializers_n2 (is);
+  k[0] = is->m_index;
+  dds_stream_gen_skip (is, dds_stream_gen_align (is->m_xcdr_version, 8), 8);
+  {
+    const uint32_t num = 3;
+    if (num > 0)
+      dds_stream_gen_skip (is, 4, num * 4);
+  }
+  {
+    const uint32_t num = 6;
+    if (num > 0)
+      dds_stream_gen_skip (is, 4, num * 4);
+  }
+  {
+    const uint32_t num = 3;
+    if (num > 0)
+      dds_stream_gen_skip (is, 1, num * 1);
+  }
+  if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+    dds_stream_gen_skip (is, 1, dds_stream_gen_get4 (is));
+  else
+  {
+    const uint32_t num = 2;
+    if (num > 0)
+      dds_stream_gen_skip (is, 4, num * 4);
+  }
+  if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+    dds_stream_gen_skip (is, 1, dds_stream_gen_get4 (is));
+  else
+  {
+    const uint32_t num = 2;
+    for (uint32_t i = 0; i < num; i++)
+      dds_stream_gen_skip_string (is);
+  }
+  if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+    dds_stream_gen_skip (is, 1, dds_stream_gen_get4 (is));
+  else
+  {
+    const uint32_t num = 2;
+    for (uint32_t i = 0; i < num; i++)
+      dds_stream_gen_skip_string (is);
+  }
+  if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+    dds_stream_gen_skip (is, 1, dds_stream_gen_get4 (is));
+  else
+  {
+    const uint32_t num = 2;
+    for (uint32_t i = 0; i < num; i++)
+      Serializers_t2_cdr_skip_Serializers_n1 (is);
+  }
+  {
+    const uint32_t num = dds_stream_gen_get4 (is);
+    if (num > 0)
+      dds_stream_gen_skip (is, 1, num * 1);
+  }
+  {
+    const uint32_t num = dds_stream_gen_get4 (is);
+    if (num > 0)
+      dds_stream_gen_skip (is, dds_stream_gen_align (is->m_xcdr_version, 8), num * 8);
+  }
+  {
+    const uint32_t num = dds_stream_gen_get4 (is);
+    if (num > 0)
+      dds_stream_gen_skip (is, 2, num * 2);
+  }
+  {
+    const uint32_t num = dds_stream_gen_get4 (is);
+    if (num > 0)
+      dds_stream_gen_skip (is, 1, num * 1);
+  }
+  if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+    dds_stream_gen_skip (is, 1, dds_stream_gen_get4 (is));
+  else
+  {
+    const uint32_t num = dds_stream_gen_get4 (is);
+    if (num > 0)
+      dds_stream_gen_skip (is, 2, num * 2);
+  }
+  if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+    dds_stream_gen_skip (is, 1, dds_stream_gen_get4 (is));
+  else
+  {
+    const uint32_t num = dds_stream_gen_get4 (is);
+    for (uint32_t i = 0; i < num; i++)
+      dds_stream_gen_skip_string (is);
+  }
+  if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+    dds_stream_gen_skip (is, 1, dds_stream_gen_get4 (is));
+  else
+  {
+    const uint32_t num = dds_stream_gen_get4 (is);
+    for (uint32_t i = 0; i < num; i++)
+      dds_stream_gen_skip_string (is);
+  }
+  if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+    dds_stream_gen_skip (is, 1, dds_stream_gen_get4 (is));
+  else
+  {
+    const uint32_t num = dds_stream_gen_get4 (is);
+    for (uint32_t i = 0; i < num; i++)
+      Serializers_t2_cdr_skip_Serializers_n1 (is);
+  }
+  if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+    dds_stream_gen_skip (is, 1, dds_stream_gen_get4 (is));
+  else
+  {
+    const uint32_t num = dds_stream_gen_get4 (is);
+    for (uint32_t i = 0; i < num; i++)
+      Serializers_t2_cdr_skip_Serializers_n2 (is);
+  }
+  k[1] = is->m_index;
+  is->m_index = k[0];
+  {
+    uint64_t v;
+    dds_stream_gen_get_bytes (is, &v, dds_stream_gen_align (is->m_xcdr_version, 8), 8);
+    dds_stream_gen_put_bytes (os, &v, dds_stream_gen_align (os->m_xcdr_version, 8), 8);
+  }
+  is->m_index = k[1];
+  {
+    const uint32_t sz = dds_stream_gen_get4 (is);
+    dds_stream_gen_put4 (os, sz);
+    dds_stream_gen_put_bytes (os, is->m_buffer + is->m_index, 1, sz);
+    is->m_index += sz;
+  }
+  return true;
+}
+
+static const dds_topic_serializers_t Serializers_t2_serializers =
+{
+  .write = Serializers_t2_cdr_write_Serializers_t2,
+  .read = Serializers_t2_cdr_read_Serializers_t2,
+  .normalize = Serializers_t2_cdr_normalize_Serializers_t2,
+  .write_key = Serializers_t2_cdr_write_key,
+  .extract_key_from_data = Serializers_t2_cdr_extract_key
+};
+
+/* Type Information:
+  [MINIMAL 9205db43661bab0bd090e8b90ff3] (#deps: 7)
+   - [MINIMAL e9ea83005e57a6ef8bf5dfc9cb00]
+   - [MINIMAL 9a52f69b066c95499dde2c2a1037]
+   - [MINIMAL 7f300db53105c1916a0e2aa7667b]
+   - [MINIMAL f9632b5f316fa479cac36c0fd803]
+   - [MINIMAL d7376d9d9d6d890ee0e0cd490818]
+   - [MINIMAL 3d5d8abc74a7f2c32db115286744]
+   - [MINIMAL 6c25ef2ad8405383143fd8d14cfb]
+  [COMPLETE df1c8a17a68177ab6447b1e9e014] (#deps: 7)
+   - [COMPLETE d8575d5291ba66744468b8f84e43]
+   - [COMPLETE 82b85dfe5c59fb6d69158be7837a]
+   - [COMPLETE c56138cfb353e0bcc99fe7632b05]
+   - [COMPLETE b26e30498fe22bd21bfe466cb2c9]
+   - [COMPLETE f60b2157679e87ca3389cadeeefd]
+   - [COMPLETE 30c530aed05de0f6a325e04d7d22]
+   - [COMPLETE 03ef571a8dae15aac75060e38aef]
+*/
+#define TYPE_INFO_CDR_Serializers_t2 (unsigned char []){ \
+  0xb0, 0x01, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0xd0, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x92, 0x05, 0xdb, 0x43, 0x66, 0x1b, 0xab, 0x0b, 0xd0, 0x90, 0xe8, \
+  0xb9, 0x0f, 0xf3, 0x00, 0x40, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xe9, 0xea, 0x83, 0x00, 0x5e, 0x57, 0xa6, \
+  0xef, 0x8b, 0xf5, 0xdf, 0xc9, 0xcb, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x9a, 0x52, 0xf6, 0x9b, 0x06, 0x6c, 0x95, 0x49, 0x9d, 0xde, 0x2c, 0x2a, 0x10, 0x37, 0x00, \
+  0x47, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x7f, 0x30, 0x0d, 0xb5, 0x31, 0x05, 0xc1, \
+  0x91, 0x6a, 0x0e, 0x2a, 0xa7, 0x66, 0x7b, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xf9, 0x63, 0x2b, 0x5f, 0x31, 0x6f, 0xa4, 0x79, 0xca, 0xc3, 0x6c, 0x0f, 0xd8, 0x03, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xd7, 0x37, 0x6d, 0x9d, 0x9d, 0x6d, 0x89, \
+  0x0e, 0xe0, 0xe0, 0xcd, 0x49, 0x08, 0x18, 0x00, 0x52, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x3d, 0x5d, 0x8a, 0xbc, 0x74, 0xa7, 0xf2, 0xc3, 0x2d, 0xb1, 0x15, 0x28, 0x67, 0x44, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x6c, 0x25, 0xef, 0x2a, 0xd8, 0x40, 0x53, \
+  0x83, 0x14, 0x3f, 0xd8, 0xd1, 0x4c, 0xfb, 0x00, 0x66, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0xd0, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xdf, 0x1c, 0x8a, \
+  0x17, 0xa6, 0x81, 0x77, 0xab, 0x64, 0x47, 0xb1, 0xe9, 0xe0, 0x14, 0x00, 0xe5, 0x02, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xd8, 0x57, 0x5d, 0x52, 0x91, 0xba, 0x66, 0x74, 0x44, 0x68, 0xb8, 0xf8, 0x4e, 0x43, 0x00, \
+  0xa9, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x82, 0xb8, 0x5d, 0xfe, 0x5c, 0x59, 0xfb, \
+  0x6d, 0x69, 0x15, 0x8b, 0xe7, 0x83, 0x7a, 0x00, 0x69, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xc5, 0x61, 0x38, 0xcf, 0xb3, 0x53, 0xe0, 0xbc, 0xc9, 0x9f, 0xe7, 0x63, 0x2b, 0x05, 0x00, \
+  0x6b, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xb2, 0x6e, 0x30, 0x49, 0x8f, 0xe2, 0x2b, \
+  0xd2, 0x1b, 0xfe, 0x46, 0x6c, 0xb2, 0xc9, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xf6, 0x0b, 0x21, 0x57, 0x67, 0x9e, 0x87, 0xca, 0x33, 0x89, 0xca, 0xde, 0xee, 0xfd, 0x00, \
+  0x7e, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x30, 0xc5, 0x30, 0xae, 0xd0, 0x5d, 0xe0, \
+  0xf6, 0xa3, 0x25, 0xe0, 0x4d, 0x7d, 0x22, 0x00, 0x36, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x03, 0xef, 0x57, 0x1a, 0x8d, 0xae, 0x15, 0xaa, 0xc7, 0x50, 0x60, 0xe3, 0x8a, 0xef, 0x00, \
+  0xa3, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Serializers_t2 436u
+#define TYPE_MAP_CDR_Serializers_t2 (unsigned char []){ \
+  0xbe, 0x04, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xf1, 0x92, 0x05, 0xdb, 0x43, 0x66, 0x1b, 0xab, \
+  0x0b, 0xd0, 0x90, 0xe8, 0xb9, 0x0f, 0xf3, 0x00, 0x3c, 0x02, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xd9, 0x56, 0x79, 0x75, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xe9, 0xea, 0x83, 0x00, 0x5e, \
+  0x57, 0xa6, 0xef, 0x8b, 0xf5, 0xdf, 0xc9, 0xcb, 0x00, 0x7b, 0x8b, 0x96, 0x5a, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0xb6, 0x37, 0xb1, 0x7a, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x04, 0x2d, 0xb9, 0x5e, 0x8e, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xf9, 0x63, 0x2b, 0x5f, 0x31, 0x6f, 0xa4, 0x79, 0xca, \
+  0xc3, 0x6c, 0x0f, 0xd8, 0x03, 0xc9, 0x08, 0x9f, 0x3c, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x03, 0x01, 0x07, 0x15, 0x9c, 0x47, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0xf1, 0xd7, 0x37, \
+  0x6d, 0x9d, 0x9d, 0x6d, 0x89, 0x0e, 0xe0, 0xe0, 0xcd, 0x49, 0x08, 0x18, 0x5b, 0x34, 0x4a, 0xc5, \
+  0x17, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0x70, 0x00, 0xc1, 0x2e, 0x01, 0xf2, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x70, 0x03, 0xdd, 0x43, 0xbc, 0x43, 0x00, 0x24, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0xf1, 0x9a, 0x52, \
+  0xf6, 0x9b, 0x06, 0x6c, 0x95, 0x49, 0x9d, 0xde, 0x2c, 0x2a, 0x10, 0x37, 0x6e, 0xc6, 0x6e, 0x12, \
+  0x10, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x02, \
+  0xb8, 0x07, 0x02, 0x3f, 0x10, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x04, 0x05, 0xca, 0xd3, 0xe4, 0x44, 0x19, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x3d, 0x5d, 0x8a, 0xbc, 0x74, 0xa7, 0xf2, 0xc3, 0x2d, 0xb1, 0x15, 0x28, 0x67, \
+  0x44, 0x36, 0x91, 0x30, 0x8f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x01, 0x26, 0x14, 0x8d, 0x62, 0x1e, 0x00, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x00, 0xf1, 0x6c, 0x25, 0xef, 0x2a, \
+  0xd8, 0x40, 0x53, 0x83, 0x14, 0x3f, 0xd8, 0xd1, 0x4c, 0xfb, 0xef, 0xad, 0x7a, 0xbb, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x70, \
+  0x00, 0xcc, 0xb9, 0xf4, 0xdf, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x02, 0x70, 0x04, 0x3e, 0xb0, 0xa1, 0x70, 0x00, 0x00, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x00, 0xf1, \
+  0x9a, 0x52, 0xf6, 0x9b, 0x06, 0x6c, 0x95, 0x49, 0x9d, 0xde, 0x2c, 0x2a, 0x10, 0x37, 0xaf, 0xbe, \
+  0x94, 0xcd, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf1, \
+  0x01, 0x00, 0x00, 0xf1, 0xe9, 0xea, 0x83, 0x00, 0x5e, 0x57, 0xa6, 0xef, 0x8b, 0xf5, 0xdf, 0xc9, \
+  0xcb, 0x00, 0x58, 0xd7, 0x29, 0xb7, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x70, 0x08, 0x61, 0x62, 0x09, 0x57, 0xf1, 0xe9, 0xea, 0x83, 0x00, 0x5e, 0x57, 0xa6, \
+  0xef, 0x8b, 0xf5, 0xdf, 0xc9, 0xcb, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x02, 0xf1, 0x9a, 0x52, 0xf6, 0x9b, 0x06, 0x6c, 0x95, 0x49, 0x9d, 0xde, \
+  0x2c, 0x2a, 0x10, 0x37, 0x0c, 0xc1, 0x75, 0xb9, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x03, 0xf1, 0x9a, 0x52, 0xf6, 0x9b, 0x06, 0x6c, 0x95, 0x49, \
+  0x9d, 0xde, 0x2c, 0x2a, 0x10, 0x37, 0x7c, 0x9d, 0xf8, 0x01, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x7f, 0x30, 0x0d, 0xb5, 0x31, 0x05, 0xc1, 0x91, 0x6a, \
+  0x0e, 0x2a, 0xa7, 0x66, 0x7b, 0x12, 0x47, 0x0f, 0xe4, 0xf1, 0x9a, 0x52, 0xf6, 0x9b, 0x06, 0x6c, \
+  0x95, 0x49, 0x9d, 0xde, 0x2c, 0x2a, 0x10, 0x37, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xd9, 0x56, 0x79, 0x75, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x03, 0xc7, 0xc0, 0xac, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x5b, 0x54, 0xc0, 0xa0, 0xf1, \
+  0x7f, 0x30, 0x0d, 0xb5, 0x31, 0x05, 0xc1, 0x91, 0x6a, 0x0e, 0x2a, 0xa7, 0x66, 0x7b, 0x00, 0x00, \
+  0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x2c, 0x54, 0xc9, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x45, 0x56, 0xfd, 0xf1, 0xf9, \
+  0x63, 0x2b, 0x5f, 0x31, 0x6f, 0xa4, 0x79, 0xca, 0xc3, 0x6c, 0x0f, 0xd8, 0x03, 0x00, 0x00, 0x00, \
+  0x1b, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0xf1, \
+  0xd7, 0x37, 0x6d, 0x9d, 0x9d, 0x6d, 0x89, 0x0e, 0xe0, 0xe0, 0xcd, 0x49, 0x08, 0x18, 0x00, 0x00, \
+  0x4e, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x3e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6d, 0xe7, 0x24, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x3b, 0x51, 0x2c, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xe8, \
+  0x54, 0x8c, 0xf1, 0x3d, 0x5d, 0x8a, 0xbc, 0x74, 0xa7, 0xf2, 0xc3, 0x2d, 0xb1, 0x15, 0x28, 0x67, \
+  0x44, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x03, 0xf1, 0x6c, 0x25, 0xef, \
+  0x2a, 0xd8, 0x40, 0x53, 0x83, 0x14, 0x3f, 0xd8, 0xd1, 0x4c, 0xfb, 0x00, 0x62, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x3e, 0xa3, 0x7d, 0xb4, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xba, 0x35, 0x8d, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xc4, 0x6b, 0x22, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xb8, \
+  0x26, 0xef, 0x00, 0x00, 0x7b, 0x06, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xf2, 0xdf, 0x1c, 0x8a, \
+  0x17, 0xa6, 0x81, 0x77, 0xab, 0x64, 0x47, 0xb1, 0xe9, 0xe0, 0x14, 0x00, 0xe1, 0x02, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, 0x3a, 0x74, 0x32, 0x00, \
+  0xbd, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xd8, 0x57, 0x5d, 0x52, 0x91, 0xba, 0x66, 0x74, 0x44, \
+  0x68, 0xb8, 0xf8, 0x4e, 0x43, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x6b, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xb2, 0x6e, 0x30, 0x49, 0x8f, 0xe2, 0x2b, 0xd2, 0x1b, 0xfe, 0x46, 0x6c, 0xb2, \
+  0xc9, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x62, 0x61, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0xf2, 0xf6, 0x0b, 0x21, 0x57, 0x67, 0x9e, \
+  0x87, 0xca, 0x33, 0x89, 0xca, 0xde, 0xee, 0xfd, 0x03, 0x00, 0x00, 0x00, 0x65, 0x61, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x70, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x73, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x70, 0x03, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x62, 0x73, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0xf2, 0x82, 0xb8, 0x5d, 0xfe, 0x5c, 0x59, 0xfb, 0x6d, 0x69, 0x15, 0x8b, 0xe7, 0x83, 0x7a, \
+  0x03, 0x00, 0x00, 0x00, 0x6e, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0x00, \
+  0x73, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x04, 0x05, 0x04, 0x00, 0x00, 0x00, 0x73, 0x6c, 0x6c, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x30, \
+  0xc5, 0x30, 0xae, 0xd0, 0x5d, 0xe0, 0xf6, 0xa3, 0x25, 0xe0, 0x4d, 0x7d, 0x22, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x73, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, \
+  0x73, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, 0x03, 0xef, 0x57, 0x1a, 0x8d, 0xae, 0x15, 0xaa, \
+  0xc7, 0x50, 0x60, 0xe3, 0x8a, 0xef, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x73, 0x65, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x73, 0x73, 0x74, 0x72, \
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, \
+  0x01, 0x00, 0x02, 0x70, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x73, 0x62, 0x73, 0x74, \
+  0x72, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, \
+  0x01, 0x00, 0x00, 0xf2, 0x82, 0xb8, 0x5d, 0xfe, 0x5c, 0x59, 0xfb, 0x6d, 0x69, 0x15, 0x8b, 0xe7, \
+  0x83, 0x7a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x73, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x26, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, \
+  0xd8, 0x57, 0x5d, 0x52, 0x91, 0xba, 0x66, 0x74, 0x44, 0x68, 0xb8, 0xf8, 0x4e, 0x43, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x73, 0x6e, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x13, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x08, 0x03, 0x00, 0x00, 0x00, 0x6b, 0x32, 0x00, 0x00, \
+  0x00, 0xf2, 0xd8, 0x57, 0x5d, 0x52, 0x91, 0xba, 0x66, 0x74, 0x44, 0x68, 0xb8, 0xf8, 0x4e, 0x43, \
+  0xa5, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, \
+  0x3a, 0x6e, 0x32, 0x00, 0x81, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0xf2, 0x82, 0xb8, 0x5d, 0xfe, 0x5c, 0x59, 0xfb, 0x6d, 0x69, 0x15, 0x8b, 0xe7, 0x83, 0x7a, \
+  0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x03, 0xf2, 0x82, 0xb8, 0x5d, 0xfe, 0x5c, 0x59, 0xfb, 0x6d, \
+  0x69, 0x15, 0x8b, 0xe7, 0x83, 0x7a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x62, 0x73, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xc5, \
+  0x61, 0x38, 0xcf, 0xb3, 0x53, 0xe0, 0xbc, 0xc9, 0x9f, 0xe7, 0x63, 0x2b, 0x05, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x65, 0x73, 0x00, 0x00, 0x00, 0xf2, 0x82, 0xb8, 0x5d, 0xfe, 0x5c, 0x59, \
+  0xfb, 0x6d, 0x69, 0x15, 0x8b, 0xe7, 0x83, 0x7a, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x69, \
+  0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, 0x3a, 0x6e, 0x31, 0x00, 0x41, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x6c, 0x00, 0x00, \
+  0x00, 0xf2, 0xc5, 0x61, 0x38, 0xcf, 0xb3, 0x53, 0xe0, 0xbc, 0xc9, 0x9f, 0xe7, 0x63, 0x2b, 0x05, \
+  0x67, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, \
+  0x3a, 0x65, 0x6e, 0x5f, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x45, 0x53, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x45, 0x53, 0x5f, 0x32, 0x00, 0x00, 0x00, 0xf2, 0xb2, 0x6e, 0x30, 0x49, \
+  0x8f, 0xe2, 0x2b, 0xd2, 0x1b, 0xfe, 0x46, 0x6c, 0xb2, 0xc9, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, \
+  0xf2, 0x30, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, 0x3a, 0x61, 0x72, 0x72, \
+  0x5f, 0x74, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0x00, 0x00, 0xf2, 0xf6, 0x0b, 0x21, 0x57, 0x67, 0x9e, \
+  0x87, 0xca, 0x33, 0x89, 0xca, 0xde, 0xee, 0xfd, 0x7a, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x69, \
+  0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, 0x3a, 0x65, 0x6e, 0x00, 0x56, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x45, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x45, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x45, 0x5f, 0x33, 0x00, 0x00, 0x00, 0xf2, 0x30, 0xc5, 0x30, 0xae, 0xd0, 0x5d, 0xe0, 0xf6, 0xa3, \
+  0x25, 0xe0, 0x4d, 0x7d, 0x22, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, \
+  0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x69, \
+  0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, 0x3a, 0x73, 0x65, 0x71, 0x5f, 0x74, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0xf2, 0x03, \
+  0xef, 0x57, 0x1a, 0x8d, 0xae, 0x15, 0xaa, 0xc7, 0x50, 0x60, 0xe3, 0x8a, 0xef, 0x00, 0x00, 0x00, \
+  0x9f, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, \
+  0x3a, 0x65, 0x6e, 0x5f, 0x6d, 0x65, 0x64, 0x69, 0x75, 0x6d, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x45, 0x4d, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x45, 0x4d, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x45, 0x4d, 0x5f, 0x33, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x45, 0x4d, 0x5f, 0x34, \
+  0x00, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xf2, 0xdf, 0x1c, 0x8a, \
+  0x17, 0xa6, 0x81, 0x77, 0xab, 0x64, 0x47, 0xb1, 0xe9, 0xe0, 0x14, 0xf1, 0x92, 0x05, 0xdb, 0x43, \
+  0x66, 0x1b, 0xab, 0x0b, 0xd0, 0x90, 0xe8, 0xb9, 0x0f, 0xf3, 0xf2, 0xd8, 0x57, 0x5d, 0x52, 0x91, \
+  0xba, 0x66, 0x74, 0x44, 0x68, 0xb8, 0xf8, 0x4e, 0x43, 0xf1, 0xe9, 0xea, 0x83, 0x00, 0x5e, 0x57, \
+  0xa6, 0xef, 0x8b, 0xf5, 0xdf, 0xc9, 0xcb, 0x00, 0xf2, 0x82, 0xb8, 0x5d, 0xfe, 0x5c, 0x59, 0xfb, \
+  0x6d, 0x69, 0x15, 0x8b, 0xe7, 0x83, 0x7a, 0xf1, 0x9a, 0x52, 0xf6, 0x9b, 0x06, 0x6c, 0x95, 0x49, \
+  0x9d, 0xde, 0x2c, 0x2a, 0x10, 0x37, 0xf2, 0xc5, 0x61, 0x38, 0xcf, 0xb3, 0x53, 0xe0, 0xbc, 0xc9, \
+  0x9f, 0xe7, 0x63, 0x2b, 0x05, 0xf1, 0x7f, 0x30, 0x0d, 0xb5, 0x31, 0x05, 0xc1, 0x91, 0x6a, 0x0e, \
+  0x2a, 0xa7, 0x66, 0x7b, 0xf2, 0xb2, 0x6e, 0x30, 0x49, 0x8f, 0xe2, 0x2b, 0xd2, 0x1b, 0xfe, 0x46, \
+  0x6c, 0xb2, 0xc9, 0xf1, 0xf9, 0x63, 0x2b, 0x5f, 0x31, 0x6f, 0xa4, 0x79, 0xca, 0xc3, 0x6c, 0x0f, \
+  0xd8, 0x03, 0xf2, 0xf6, 0x0b, 0x21, 0x57, 0x67, 0x9e, 0x87, 0xca, 0x33, 0x89, 0xca, 0xde, 0xee, \
+  0xfd, 0xf1, 0xd7, 0x37, 0x6d, 0x9d, 0x9d, 0x6d, 0x89, 0x0e, 0xe0, 0xe0, 0xcd, 0x49, 0x08, 0x18, \
+  0xf2, 0x30, 0xc5, 0x30, 0xae, 0xd0, 0x5d, 0xe0, 0xf6, 0xa3, 0x25, 0xe0, 0x4d, 0x7d, 0x22, 0xf1, \
+  0x3d, 0x5d, 0x8a, 0xbc, 0x74, 0xa7, 0xf2, 0xc3, 0x2d, 0xb1, 0x15, 0x28, 0x67, 0x44, 0xf2, 0x03, \
+  0xef, 0x57, 0x1a, 0x8d, 0xae, 0x15, 0xaa, 0xc7, 0x50, 0x60, 0xe3, 0x8a, 0xef, 0xf1, 0x6c, 0x25, \
+  0xef, 0x2a, 0xd8, 0x40, 0x53, 0x83, 0x14, 0x3f, 0xd8, 0xd1, 0x4c, 0xfb\
+}
+#define TYPE_MAP_CDR_SZ_Serializers_t2 3132u
+const dds_topic_descriptor_t Serializers_t2_desc =
+{
+  .m_size = sizeof (Serializers_t2),
+  .m_align = dds_alignof (Serializers_t2),
+  .m_flagset = DDS_TOPIC_SERIALIZERS | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "Serializers::t2",
+  .m_keys = Serializers_t2_keys,
+  .m_nops = 29,
+  .m_ops = Serializers_t2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Serializers_t2, .sz = TYPE_INFO_CDR_SZ_Serializers_t2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Serializers_t2, .sz = TYPE_MAP_CDR_SZ_Serializers_t2 },
+  .serializers = &Serializers_t2_serializers
+};
+
+static const uint32_t Serializers_t2_view_index[] = { 0, 1, 2, 2, 19 };
+static const uint32_t Serializers_t2_view_member_id[] = { 0, 1, 2, 2, 19 };
+static const dds_view_member_t Serializers_t2_view_members[] =
+{
+  { 1, &Serializers_t2_view_index[0], &Serializers_t2_view_member_id[0] },
+  { 2, &Serializers_t2_view_index[1], &Serializers_t2_view_member_id[1] },
+  { 1, &Serializers_t2_view_index[3], &Serializers_t2_view_member_id[3] },
+  { 1, &Serializers_t2_view_index[4], &Serializers_t2_view_member_id[4] }
+};
+
+static dds_view_desc_t Serializers_t2_view_desc = { &Serializers_t2_desc, 4, Serializers_t2_view_members, DDSRT_ATOMIC_VOIDP_INIT (NULL) };
+
+dds_return_t Serializers_t2_view_init (Serializers_t2_view *view, struct ddsi_serdata *serdata)
+{
+  return dds_view_init (&view->v, &Serializers_t2_view_desc, view->offs, serdata);
+}
+
+void Serializers_t2_view_fini (Serializers_t2_view *view)
+{
+  dds_view_fini (&view->v);
+}
+
+bool Serializers_t2_view_o (Serializers_t2_view *view, uint8_t *value)
+{
+  const void *p = dds_view_member (&view->v, 0, 1);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t2_view_n_es (Serializers_t2_view *view, Serializers_en_small *value)
+{
+  const void *p = dds_view_member (&view->v, 1, 1);
+  uint8_t x;
+  if (p == NULL)
+    return false;
+  memcpy (&x, p, sizeof (x));
+  *value = (Serializers_en_small) x;
+  return true;
+}
+
+bool Serializers_t2_view_k1 (Serializers_t2_view *view, int64_t *value)
+{
+  const void *p = dds_view_member (&view->v, 2, 8);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t2_view_k2 (Serializers_t2_view *view, const char **value)
+{
+  return (*value = dds_view_string (&view->v, 3)) != NULL;
+}
+
+static const uint32_t Serializers_t3_ops [] =
+{
+  /* t3 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t3, l),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_8BY | DDS_OP_FLAG_FP, offsetof (Serializers_t3, sd),
+  DDS_OP_RTS
+};
+
+static bool Serializers_t3_cdr_write_Serializers_t3 (dds_ostream_t *os, const void *sample);
+static void Serializers_t3_cdr_read_Serializers_t3 (dds_istream_t *is, void *sample);
+static bool Serializers_t3_cdr_normalize_Serializers_t3 (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version);
+
+static bool Serializers_t3_cdr_write_Serializers_t3 (dds_ostream_t *os, const void *sample)
+{
+  const char *data = sample;
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t3, l), 4, 4);
+  {
+    const dds_sequence_t *seq = (const dds_sequence_t *) (data + offsetof (Serializers_t3, sd));
+    dds_stream_gen_put4 (os, seq->_length);
+    if (seq->_length > 0)
+      dds_stream_gen_put_bytes (os, seq->_buffer, dds_stream_gen_align (os->m_xcdr_version, 8), seq->_length * 8);
+  }
+  return true;
+}
+
+static void Serializers_t3_cdr_read_Serializers_t3 (dds_istream_t *is, void *sample)
+{
+  char *data = sample;
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_t3, l), 4, 4);
+  {
+    dds_sequence_t *seq = (dds_sequence_t *) (data + offsetof (Serializers_t3, sd));
+    const uint32_t num = dds_stream_gen_get4 (is);
+    if (num == 0)
+      seq->_length = 0;
+    else
+    {
+      dds_stream_gen_realloc_sequence (is, seq, num, 8, false);
+      dds_stream_gen_get_bytes (is, seq->_buffer, dds_stream_gen_align (is->m_xcdr_version, 8), seq->_length * 8);
+      if (seq->_length < num)
+        dds_stream_gen_skip (is, 1, (num - seq->_length) * 8);
+    }
+  }
+}
+
+static bool Serializers_t3_cdr_normalize_Serializers_t3 (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version)
+{
+  if (!dds_stream_gen_normalize_prim (data, off, size, bswap, 4, xcdr_version))
+    return false;
+  {
+    uint32_t num;
+    if (!dds_stream_gen_normalize_uint32 (&num, data, off, size, bswap))
+      return false;
+    if (num > 0 && !dds_stream_gen_normalize_primarray (data, off, size, bswap, num, 8, xcdr_version))
+      return false;
+  }
+  return true;
+}
+
+static const dds_topic_serializers_t Serializers_t3_serializers =
+{
+  .write = Serializers_t3_cdr_write_Serializers_t3,
+  .read = Serializers_t3_cdr_read_Serializers_t3,
+  .normalize = Serializers_t3_cdr_normalize_Serializers_t3,
+  .write_key = NULL,
+  .extract_key_from_data = NULL
+};
+
+/* Type Information:
+  [MINIMAL 21716839a2fbf4a798b35702dc84] (#deps: 0)
+  [COMPLETE 5c1a26422f090316446a69148416] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_Serializers_t3 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x21, 0x71, 0x68, 0x39, 0xa2, 0xfb, 0xf4, 0xa7, 0x98, 0xb3, 0x57, \
+  0x02, 0xdc, 0x84, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x5c, 0x1a, 0x26, 0x42, 0x2f, 0x09, 0x03, 0x16, 0x44, 0x6a, 0x69, \
+  0x14, 0x84, 0x16, 0x00, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Serializers_t3 100u
+#define TYPE_MAP_CDR_Serializers_t3 (unsigned char []){ \
+  0x50, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x21, 0x71, 0x68, 0x39, 0xa2, 0xfb, 0xf4, \
+  0xa7, 0x98, 0xb3, 0x57, 0x02, 0xdc, 0x84, 0x00, 0x38, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x2d, 0xb9, 0x5e, 0x8e, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x0a, \
+  0x62, 0x26, 0xf7, 0xcb, 0x6d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x5c, 0x1a, 0x26, \
+  0x42, 0x2f, 0x09, 0x03, 0x16, 0x44, 0x6a, 0x69, 0x14, 0x84, 0x16, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, 0x3a, 0x74, 0x33, 0x00, \
+  0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x0a, 0x03, 0x00, 0x00, 0x00, \
+  0x73, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x5c, 0x1a, 0x26, 0x42, 0x2f, 0x09, 0x03, 0x16, 0x44, 0x6a, 0x69, 0x14, 0x84, 0x16, 0xf1, \
+  0x21, 0x71, 0x68, 0x39, 0xa2, 0xfb, 0xf4, 0xa7, 0x98, 0xb3, 0x57, 0x02, 0xdc, 0x84\
+}
+#define TYPE_MAP_CDR_SZ_Serializers_t3 238u
+const dds_topic_descriptor_t Serializers_t3_desc =
+{
+  .m_size = sizeof (Serializers_t3),
+  .m_align = dds_alignof (Serializers_t3),
+  .m_flagset = DDS_TOPIC_SERIALIZERS | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "Serializers::t3",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = Serializers_t3_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Serializers_t3, .sz = TYPE_INFO_CDR_SZ_Serializers_t3 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Serializers_t3, .sz = TYPE_MAP_CDR_SZ_Serializers_t3 },
+  .serializers = &Serializers_t3_serializers
+};
+
+static const uint32_t Serializers_t3_view_index[] = { 0 };
+static const uint32_t Serializers_t3_view_member_id[] = { 0 };
+static const dds_view_member_t Serializers_t3_view_members[] =
+{
+  { 1, &Serializers_t3_view_index[0], &Serializers_t3_view_member_id[0] }
+};
+
+static dds_view_desc_t Serializers_t3_view_desc = { &Serializers_t3_desc, 1, Serializers_t3_view_members, DDSRT_ATOMIC_VOIDP_INIT (NULL) };
+
+dds_return_t Serializers_t3_view_init (Serializers_t3_view *view, struct ddsi_serdata *serdata)
+{
+  return dds_view_init (&view->v, &Serializers_t3_view_desc, view->offs, serdata);
+}
+
+void Serializers_t3_view_fini (Serializers_t3_view *view)
+{
+  dds_view_fini (&view->v);
+}
+
+bool Serializers_t3_view_l (Serializers_t3_view *view, int32_t *value)
+{
+  const void *p = dds_view_member (&view->v, 0, 4);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+static const uint32_t Serializers_t4_ops [] =
+{
+  /* t4 */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t4, l),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL a13e75104732b0266a612e295831] (#deps: 0)
+  [COMPLETE 46d5bb5b40bc72f75c649180c416] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_Serializers_t4 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xa1, 0x3e, 0x75, 0x10, 0x47, 0x32, 0xb0, 0x26, 0x6a, 0x61, 0x2e, \
+  0x29, 0x58, 0x31, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x46, 0xd5, 0xbb, 0x5b, 0x40, 0xbc, 0x72, 0xf7, 0x5c, 0x64, 0x91, \
+  0x80, 0xc4, 0x16, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Serializers_t4 100u
+#define TYPE_MAP_CDR_Serializers_t4 (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xa1, 0x3e, 0x75, 0x10, 0x47, 0x32, 0xb0, \
+  0x26, 0x6a, 0x61, 0x2e, 0x29, 0x58, 0x31, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x2d, 0xb9, 0x5e, 0x8e, 0x00, \
+  0x54, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x46, 0xd5, 0xbb, 0x5b, 0x40, 0xbc, 0x72, \
+  0xf7, 0x5c, 0x64, 0x91, 0x80, 0xc4, 0x16, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x02, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x69, \
+  0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, 0x3a, 0x74, 0x34, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x46, 0xd5, 0xbb, 0x5b, 0x40, 0xbc, 0x72, 0xf7, 0x5c, 0x64, 0x91, 0x80, 0xc4, 0x16, 0xf1, \
+  0xa1, 0x3e, 0x75, 0x10, 0x47, 0x32, 0xb0, 0x26, 0x6a, 0x61, 0x2e, 0x29, 0x58, 0x31\
+}
+#define TYPE_MAP_CDR_SZ_Serializers_t4 190u
+const dds_topic_descriptor_t Serializers_t4_desc =
+{
+  .m_size = sizeof (Serializers_t4),
+  .m_align = dds_alignof (Serializers_t4),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "Serializers::t4",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = Serializers_t4_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Serializers_t4, .sz = TYPE_INFO_CDR_SZ_Serializers_t4 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Serializers_t4, .sz = TYPE_MAP_CDR_SZ_Serializers_t4 }
+};
+
+static const uint32_t Serializers_t4_view_index[] = { 0 };
+static const uint32_t Serializers_t4_view_member_id[] = { 0 };
+static const dds_view_member_t Serializers_t4_view_members[] =
+{
+  { 1, &Serializers_t4_view_index[0], &Serializers_t4_view_member_id[0] }
+};
+
+static dds_view_desc_t Serializers_t4_view_desc = { &Serializers_t4_desc, 1, Serializers_t4_view_members, DDSRT_ATOMIC_VOIDP_INIT (NULL) };
+
+dds_return_t Serializers_t4_view_init (Serializers_t4_view *view, struct ddsi_serdata *serdata)
+{
+  return dds_view_init (&view->v, &Serializers_t4_view_desc, view->offs, serdata);
+}
+
+void Serializers_t4_view_fini (Serializers_t4_view *view)
+{
+  dds_view_fini (&view->v);
+}
+
+bool Serializers_t4_view_l (Serializers_t4_view *view, int32_t *value)
+{
+  const void *p = dds_view_member (&view->v, 0, 4);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+static const uint32_t Serializers_t5_ops [] =
+{
+  /* t5 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_EXT, offsetof (Serializers_t5, k), (3u << 16u) + 6u /* n1 */,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t5, l),
+  DDS_OP_RTS,
+
+  /* n1 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_1BY, offsetof (Serializers_n1, o),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_STR, offsetof (Serializers_n1, s),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (Serializers_n1, ll),
+  DDS_OP_RTS,
+  
+  /* key: k.o */
+  DDS_OP_KOF | 2, 0u /* order: 0 */, 0u /* order: 0 */,
+  
+  /* key: k.s */
+  DDS_OP_KOF | 2, 0u /* order: 0 */, 2u /* order: 1 */,
+  
+  /* key: k.ll */
+  DDS_OP_KOF | 2, 0u /* order: 0 */, 4u /* order: 2 */
+};
+
+static const dds_key_descriptor_t Serializers_t5_keys[3] =
+{
+  { "k.o", 13, 0 },
+  { "k.s", 16, 1 },
+  { "k.ll", 19, 2 }
+};
+
+static bool Serializers_t5_cdr_write_Serializers_t5 (dds_ostream_t *os, const void *sample);
+static void Serializers_t5_cdr_read_Serializers_t5 (dds_istream_t *is, void *sample);
+static bool Serializers_t5_cdr_normalize_Serializers_t5 (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version);
+static bool Serializers_t5_cdr_write_Serializers_n1 (dds_ostream_t *os, const void *sample);
+static void Serializers_t5_cdr_read_Serializers_n1 (dds_istream_t *is, void *sample);
+static bool Serializers_t5_cdr_normalize_Serializers_n1 (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version);
+
+static bool Serializers_t5_cdr_write_Serializers_t5 (dds_ostream_t *os, const void *sample)
+{
+  const char *data = sample;
+  if (!Serializers_t5_cdr_write_Serializers_n1 (os, data + offsetof (Serializers_t5, k)))
+    return false;
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t5, l), 4, 4);
+  return true;
+}
+
+static void Serializers_t5_cdr_read_Serializers_t5 (dds_istream_t *is, void *sample)
+{
+  char *data = sample;
+  Serializers_t5_cdr_read_Serializers_n1 (is, data + offsetof (Serializers_t5, k));
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_t5, l), 4, 4);
+}
+
+static bool Serializers_t5_cdr_normalize_Serializers_t5 (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version)
+{
+  if (!Serializers_t5_cdr_normalize_Serializers_n1 (data, off, size, bswap, xcdr_version))
+    return false;
+  if (!dds_stream_gen_normalize_prim (data, off, size, bswap, 4, xcdr_version))
+    return false;
+  return true;
+}
+
+static bool Serializers_t5_cdr_write_Serializers_n1 (dds_ostream_t *os, const void *sample)
+{
+  const char *data = sample;
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_n1, o), 1, 1);
+  dds_stream_gen_put_string (os, *(const char * const *) (data + offsetof (Serializers_n1, s)));
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_n1, ll), dds_stream_gen_align (os->m_xcdr_version, 8), 8);
+  return true;
+}
+
+static void Serializers_t5_cdr_read_Serializers_n1 (dds_istream_t *is, void *sample)
+{
+  char *data = sample;
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_n1, o), 1, 1);
+  *(char **) (data + offsetof (Serializers_n1, s)) = dds_stream_gen_read_string (is, *(char **) (data + offsetof (Serializers_n1, s)));
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_n1, ll), dds_stream_gen_align (is->m_xcdr_version, 8), 8);
+}
+
+static bool Serializers_t5_cdr_normalize_Serializers_n1 (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version)
+{
+  if (!dds_stream_gen_normalize_prim (data, off, size, bswap, 1, xcdr_version))
+    return false;
+  if (!dds_stream_gen_normalize_string (data, off, size, bswap, SIZE_MAX))
+    return false;
+  if (!dds_stream_gen_normalize_prim (data, off, size, bswap, 8, xcdr_version))
+    return false;
+  return true;
+}
+
+static const dds_topic_serializers_t Serializers_t5_serializers =
+{
+  .write = Serializers_t5_cdr_write_Serializers_t5,
+  .read = Serializers_t5_cdr_read_Serializers_t5,
+  .normalize = Serializers_t5_cdr_normalize_Serializers_t5,
+  .write_key = NULL,
+  .extract_key_from_data = NULL
+};
+
+/* Type Information:
+  [MINIMAL 21dd55a1f39e1860f322968a545c] (#deps: 1)
+   - [MINIMAL 9a52f69b066c95499dde2c2a1037]
+  [COMPLETE 780479049e7ab53872c05023fa00] (#deps: 1)
+   - [COMPLETE 82b85dfe5c59fb6d69158be7837a]
+*/
+#define TYPE_INFO_CDR_Serializers_t5 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x21, 0xdd, 0x55, 0xa1, 0xf3, 0x9e, 0x18, 0x60, 0xf3, 0x22, 0x96, \
+  0x8a, 0x54, 0x5c, 0x00, 0x47, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x9a, 0x52, 0xf6, 0x9b, 0x06, 0x6c, 0x95, \
+  0x49, 0x9d, 0xde, 0x2c, 0x2a, 0x10, 0x37, 0x00, 0x47, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x78, 0x04, 0x79, \
+  0x04, 0x9e, 0x7a, 0xb5, 0x38, 0x72, 0xc0, 0x50, 0x23, 0xfa, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x82, 0xb8, 0x5d, 0xfe, 0x5c, 0x59, 0xfb, 0x6d, 0x69, 0x15, 0x8b, 0xe7, 0x83, 0x7a, 0x00, \
+  0x69, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Serializers_t5 148u
+#define TYPE_MAP_CDR_Serializers_t5 (unsigned char []){ \
+  0xb3, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x21, 0xdd, 0x55, 0xa1, 0xf3, 0x9e, 0x18, \
+  0x60, 0xf3, 0x22, 0x96, 0x8a, 0x54, 0x5c, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf1, 0x9a, 0x52, 0xf6, 0x9b, 0x06, \
+  0x6c, 0x95, 0x49, 0x9d, 0xde, 0x2c, 0x2a, 0x10, 0x37, 0x8c, 0xe4, 0xb1, 0x6b, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x2d, 0xb9, 0x5e, 0x8e, 0xf1, \
+  0x9a, 0x52, 0xf6, 0x9b, 0x06, 0x6c, 0x95, 0x49, 0x9d, 0xde, 0x2c, 0x2a, 0x10, 0x37, 0x00, 0x00, \
+  0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xd9, 0x56, 0x79, 0x75, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x00, 0x03, 0xc7, 0xc0, 0xac, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x05, 0x5b, 0x54, 0xc0, 0xa0, 0x00, 0xf1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x78, 0x04, 0x79, 0x04, 0x9e, 0x7a, 0xb5, 0x38, 0x72, 0xc0, 0x50, 0x23, 0xfa, 0x00, 0x00, \
+  0x60, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, \
+  0x3a, 0x74, 0x35, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0xf2, 0x82, 0xb8, 0x5d, 0xfe, 0x5c, 0x59, 0xfb, 0x6d, 0x69, \
+  0x15, 0x8b, 0xe7, 0x83, 0x7a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x6c, 0x00, 0x00, 0x00, 0xf2, 0x82, 0xb8, 0x5d, 0xfe, 0x5c, 0x59, 0xfb, 0x6d, 0x69, 0x15, 0x8b, \
+  0xe7, 0x83, 0x7a, 0x00, 0x65, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, \
+  0x65, 0x72, 0x73, 0x3a, 0x3a, 0x6e, 0x31, 0x00, 0x41, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x6f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x78, 0x04, 0x79, 0x04, 0x9e, 0x7a, 0xb5, \
+  0x38, 0x72, 0xc0, 0x50, 0x23, 0xfa, 0x00, 0xf1, 0x21, 0xdd, 0x55, 0xa1, 0xf3, 0x9e, 0x18, 0x60, \
+  0xf3, 0x22, 0x96, 0x8a, 0x54, 0x5c, 0xf2, 0x82, 0xb8, 0x5d, 0xfe, 0x5c, 0x59, 0xfb, 0x6d, 0x69, \
+  0x15, 0x8b, 0xe7, 0x83, 0x7a, 0xf1, 0x9a, 0x52, 0xf6, 0x9b, 0x06, 0x6c, 0x95, 0x49, 0x9d, 0xde, \
+  0x2c, 0x2a, 0x10, 0x37\
+}
+#define TYPE_MAP_CDR_SZ_Serializers_t5 500u
+const dds_topic_descriptor_t Serializers_t5_desc =
+{
+  .m_size = sizeof (Serializers_t5),
+  .m_align = dds_alignof (Serializers_t5),
+  .m_flagset = DDS_TOPIC_SERIALIZERS | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "Serializers::t5",
+  .m_keys = Serializers_t5_keys,
+  .m_nops = 7,
+  .m_ops = Serializers_t5_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Serializers_t5, .sz = TYPE_INFO_CDR_SZ_Serializers_t5 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Serializers_t5, .sz = TYPE_MAP_CDR_SZ_Serializers_t5 },
+  .serializers = &Serializers_t5_serializers
+};
+
+static const uint32_t Serializers_t5_view_index[] = { 0, 0, 0, 1, 0, 2, 1 };
+static const uint32_t Serializers_t5_view_member_id[] = { 0, 0, 0, 1, 0, 2, 1 };
+static const dds_view_member_t Serializers_t5_view_members[] =
+{
+  { 2, &Serializers_t5_view_index[0], &Serializers_t5_view_member_id[0] },
+  { 2, &Serializers_t5_view_index[2], &Serializers_t5_view_member_id[2] },
+  { 2, &Serializers_t5_view_index[4], &Serializers_t5_view_member_id[4] },
+  { 1, &Serializers_t5_view_index[6], &Serializers_t5_view_member_id[6] }
+};
+
+static dds_view_desc_t Serializers_t5_view_desc = { &Serializers_t5_desc, 4, Serializers_t5_view_members, DDSRT_ATOMIC_VOIDP_INIT (NULL) };
+
+dds_return_t Serializers_t5_view_init (Serializers_t5_view *view, struct ddsi_serdata *serdata)
+{
+  return dds_view_init (&view->v, &Serializers_t5_view_desc, view->offs, serdata);
+}
+
+void Serializers_t5_view_fini (Serializers_t5_view *view)
+{
+  dds_view_fini (&view->v);
+}
+
+bool Serializers_t5_view_k_o (Serializers_t5_view *view, uint8_t *value)
+{
+  const void *p = dds_view_member (&view->v, 0, 1);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t5_view_k_s (Serializers_t5_view *view, const char **value)
+{
+  return (*value = dds_view_string (&view->v, 1)) != NULL;
+}
+
+bool Serializers_t5_view_k_ll (Serializers_t5_view *view, int64_t *value)
+{
+  const void *p = dds_view_member (&view->v, 2, 8);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t5_view_l (Serializers_t5_view *view, int32_t *value)
+{
+  const void *p = dds_view_member (&view->v, 3, 4);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+static const uint32_t Serializers_t6_ops [] =
+{
+  /* t6 */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t6, a),
+  DDS_OP_ADR | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t6, x),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_STR, offsetof (Serializers_t6, b),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (Serializers_t6, c),
+  DDS_OP_RTS,
+  
+  /* key: a */
+  DDS_OP_KOF | 1, 0u /* order: 5 */,
+  
+  /* key: b */
+  DDS_OP_KOF | 1, 4u /* order: 1 */,
+  
+  /* key: c */
+  DDS_OP_KOF | 1, 6u /* order: 3 */
+};
+
+static const dds_key_descriptor_t Serializers_t6_keys[3] =
+{
+  { "b", 11, 1 },
+  { "c", 13, 2 },
+  { "a", 9, 0 }
+};
+
+static bool Serializers_t6_cdr_write_Serializers_t6 (dds_ostream_t *os, const void *sample);
+static void Serializers_t6_cdr_read_Serializers_t6 (dds_istream_t *is, void *sample);
+static bool Serializers_t6_cdr_normalize_Serializers_t6 (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version);
+
+static bool Serializers_t6_cdr_write_Serializers_t6 (dds_ostream_t *os, const void *sample)
+{
+  const char *data = sample;
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t6, a), 4, 4);
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t6, x), 2, 2);
+  dds_stream_gen_put_string (os, *(const char * const *) (data + offsetof (Serializers_t6, b)));
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t6, c), 1, 1);
+  return true;
+}
+
+static void Serializers_t6_cdr_read_Serializers_t6 (dds_istream_t *is, void *sample)
+{
+  char *data = sample;
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_t6, a), 4, 4);
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_t6, x), 2, 2);
+  *(char **) (data + offsetof (Serializers_t6, b)) = dds_stream_gen_read_string (is, *(char **) (data + offsetof (Serializers_t6, b)));
+  dds_stream_gen_get_bytes (is, data + offsetof (Serializers_t6, c), 1, 1);
+}
+
+static bool Serializers_t6_cdr_normalize_Serializers_t6 (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version)
+{
+  if (!dds_stream_gen_normalize_prim (data, off, size, bswap, 4, xcdr_version))
+    return false;
+  if (!dds_stream_gen_normalize_prim (data, off, size, bswap, 2, xcdr_version))
+    return false;
+  if (!dds_stream_gen_normalize_string (data, off, size, bswap, SIZE_MAX))
+    return false;
+  if (!dds_stream_gen_normalize_prim (data, off, size, bswap, 1, xcdr_version))
+    return false;
+  return true;
+}
+
+static void Serializers_t6_cdr_write_key (dds_ostream_t *os, const void *sample)
+{
+  const char *data = sample;
+  dds_stream_gen_put_string (os, *(const char * const *) (data + offsetof (Serializers_t6, b)));
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t6, c), 1, 1);
+  dds_stream_gen_put_bytes (os, data + offsetof (Serializers_t6, a), 4, 4);
+}
+
+static bool Serializers_t6_cdr_extract_key (dds_istream_t *is, dds_ostream_t *os)
+{
+  uint32_t k[3];
+  k[0] = is->m_index;
+  dds_stream_gen_skip (is, 4, 4);
+  dds_stream_gen_skip (is, 2, 2);
+  k[1] = is->m_index;
+  dds_stream_gen_skip_string (is);
+  k[2] = is->m_index;
+  if (os->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+  {
+    is->m_index = k[1];
+    {
+      const uint32_t sz = dds_stream_gen_get4 (is);
+      dds_stream_gen_put4 (os, sz);
+      dds_stream_gen_put_bytes (os, is->m_buffer + is->m_index, 1, sz);
+      is->m_index += sz;
+    }
+    is->m_index = k[2];
+    {
+      uint64_t v;
+      dds_stream_gen_get_bytes (is, &v, 1, 1);
+      dds_stream_gen_put_bytes (os, &v, 1, 1);
+    }
+    is->m_index = k[0];
+    {
+      uint64_t v;
+      dds_stream_gen_get_bytes (is, &v, 4, 4);
+      dds_stream_gen_put_bytes (os, &v, 4, 4);
+    }
+    return true;
+  }
+  is->m_index = k[0];
+  {
+    uint64_t v;
+    dds_stream_gen_get_bytes (is, &v, 4, 4);
+    dds_stream_gen_put_bytes (os, &v, 4, 4);
+  }
+  is->m_index = k[1];
+  {
+    const uint32_t sz = dds_stream_gen_get4 (is);
+    dds_stream_gen_put4 (os, sz);
+    dds_stream_gen_put_bytes (os, is->m_buffer + is->m_index, 1, sz);
+    is->m_index += sz;
+  }
+  is->m_index = k[2];
+  {
+    uint64_t v;
+    dds_stream_gen_get_bytes (is, &v, 1, 1);
+    dds_stream_gen_put_bytes (os, &v, 1, 1);
+  }
+  return true;
+}
+
+static const dds_topic_serializers_t Serializers_t6_serializers =
+{
+  .write = Serializers_t6_cdr_write_Serializers_t6,
+  .read = Serializers_t6_cdr_read_Serializers_t6,
+  .normalize = Serializers_t6_cdr_normalize_Serializers_t6,
+  .write_key = Serializers_t6_cdr_write_key,
+  .extract_key_from_data = Serializers_t6_cdr_extract_key
+};
+
+/* Type Information:
+  [MINIMAL 42e1b3b336c94ef27a887a1aa399] (#deps: 0)
+  [COMPLETE ac166b1c88a9df057940afc21fac] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_Serializers_t6 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x42, 0xe1, 0xb3, 0xb3, 0x36, 0xc9, 0x4e, 0xf2, 0x7a, 0x88, 0x7a, \
+  0x1a, 0xa3, 0x99, 0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xac, 0x16, 0x6b, 0x1c, 0x88, 0xa9, 0xdf, 0x05, 0x79, 0x40, 0xaf, \
+  0xc2, 0x1f, 0xac, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Serializers_t6 100u
+#define TYPE_MAP_CDR_Serializers_t6 (unsigned char []){ \
+  0x6b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x42, 0xe1, 0xb3, 0xb3, 0x36, 0xc9, 0x4e, \
+  0xf2, 0x7a, 0x88, 0x7a, 0x1a, 0xa3, 0x99, 0x00, 0x53, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x9d, 0xd4, 0xe4, 0x61, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0x92, 0xeb, 0x5f, 0xfe, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x02, 0x4a, 0x8a, 0x08, 0xf0, 0x00, \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xac, 0x16, 0x6b, 0x1c, 0x88, 0xa9, 0xdf, \
+  0x05, 0x79, 0x40, 0xaf, 0xc2, 0x1f, 0xac, 0x00, 0x78, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x69, \
+  0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, 0x3a, 0x74, 0x36, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x63, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xac, 0x16, 0x6b, \
+  0x1c, 0x88, 0xa9, 0xdf, 0x05, 0x79, 0x40, 0xaf, 0xc2, 0x1f, 0xac, 0xf1, 0x42, 0xe1, 0xb3, 0xb3, \
+  0x36, 0xc9, 0x4e, 0xf2, 0x7a, 0x88, 0x7a, 0x1a, 0xa3, 0x99\
+}
+#define TYPE_MAP_CDR_SZ_Serializers_t6 298u
+const dds_topic_descriptor_t Serializers_t6_desc =
+{
+  .m_size = sizeof (Serializers_t6),
+  .m_align = dds_alignof (Serializers_t6),
+  .m_flagset = DDS_TOPIC_SERIALIZERS | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 3u,
+  .m_typename = "Serializers::t6",
+  .m_keys = Serializers_t6_keys,
+  .m_nops = 5,
+  .m_ops = Serializers_t6_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Serializers_t6, .sz = TYPE_INFO_CDR_SZ_Serializers_t6 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Serializers_t6, .sz = TYPE_MAP_CDR_SZ_Serializers_t6 },
+  .serializers = &Serializers_t6_serializers
+};
+
+static const uint32_t Serializers_t6_view_index[] = { 0, 1, 2, 3 };
+static const uint32_t Serializers_t6_view_member_id[] = { 5, 6, 1, 3 };
+static const dds_view_member_t Serializers_t6_view_members[] =
+{
+  { 1, &Serializers_t6_view_index[0], &Serializers_t6_view_member_id[0] },
+  { 1, &Serializers_t6_view_index[1], &Serializers_t6_view_member_id[1] },
+  { 1, &Serializers_t6_view_index[2], &Serializers_t6_view_member_id[2] },
+  { 1, &Serializers_t6_view_index[3], &Serializers_t6_view_member_id[3] }
+};
+
+static dds_view_desc_t Serializers_t6_view_desc = { &Serializers_t6_desc, 4, Serializers_t6_view_members, DDSRT_ATOMIC_VOIDP_INIT (NULL) };
+
+dds_return_t Serializers_t6_view_init (Serializers_t6_view *view, struct ddsi_serdata *serdata)
+{
+  return dds_view_init (&view->v, &Serializers_t6_view_desc, view->offs, serdata);
+}
+
+void Serializers_t6_view_fini (Serializers_t6_view *view)
+{
+  dds_view_fini (&view->v);
+}
+
+bool Serializers_t6_view_a (Serializers_t6_view *view, int32_t *value)
+{
+  const void *p = dds_view_member (&view->v, 0, 4);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t6_view_x (Serializers_t6_view *view, int16_t *value)
+{
+  const void *p = dds_view_member (&view->v, 1, 2);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t6_view_b (Serializers_t6_view *view, const char **value)
+{
+  return (*value = dds_view_string (&view->v, 2)) != NULL;
+}
+
+bool Serializers_t6_view_c (Serializers_t6_view *view, uint8_t *value)
+{
+  const void *p = dds_view_member (&view->v, 3, 1);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+static const uint32_t Serializers_t7_ops [] =
+{
+  /* t7 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t7, a),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t7, b),
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t7, c), 4u,
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (Serializers_t7, s),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (Serializers_t7, d1),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (Serializers_t7, d2),
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Serializers_t7, n), (3u << 16u) + 13u /* n3 */,
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t7, sl),
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY, offsetof (Serializers_t7, o), 3u,
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Serializers_t7, p),
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t7, ol),
+  DDS_OP_RTS,
+
+  /* n3 */
+  DDS_OP_ADR | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (Serializers_n3, x),
+  DDS_OP_ADR | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (Serializers_n3, y),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 870ae7bb1daa582ff4632fe8140f] (#deps: 1)
+   - [MINIMAL 50cbd0ab8783297d83ece8446d48]
+  [COMPLETE bd03e5073698ae88cac580cf06ef] (#deps: 1)
+   - [COMPLETE d6de99b490921f05090237928567]
+*/
+#define TYPE_INFO_CDR_Serializers_t7 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x87, 0x0a, 0xe7, 0xbb, 0x1d, 0xaa, 0x58, 0x2f, 0xf4, 0x63, 0x2f, \
+  0xe8, 0x14, 0x0f, 0x00, 0xf3, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x50, 0xcb, 0xd0, 0xab, 0x87, 0x83, 0x29, \
+  0x7d, 0x83, 0xec, 0xe8, 0x44, 0x6d, 0x48, 0x00, 0x37, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xbd, 0x03, 0xe5, \
+  0x07, 0x36, 0x98, 0xae, 0x88, 0xca, 0xc5, 0x80, 0xcf, 0x06, 0xef, 0x00, 0x41, 0x01, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xd6, 0xde, 0x99, 0xb4, 0x90, 0x92, 0x1f, 0x05, 0x09, 0x02, 0x37, 0x92, 0x85, 0x67, 0x00, \
+  0x54, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Serializers_t7 148u
+#define TYPE_MAP_CDR_Serializers_t7 (unsigned char []){ \
+  0x4f, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x87, 0x0a, 0xe7, 0xbb, 0x1d, 0xaa, 0x58, \
+  0x2f, 0xf4, 0x63, 0x2f, 0xe8, 0x14, 0x0f, 0x00, 0xef, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x92, 0xeb, 0x5f, 0xfe, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x04, 0x4a, 0x8a, 0x08, 0xf0, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x03, 0xc7, 0xc0, 0xac, 0x0b, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x99, 0x48, 0xc6, 0x45, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0xb2, 0x5b, 0x06, 0x51, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x50, 0xcb, 0xd0, 0xab, 0x87, 0x83, 0x29, 0x7d, 0x83, \
+  0xec, 0xe8, 0x44, 0x6d, 0x48, 0x7b, 0x8b, 0x96, 0x5a, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x54, 0xa2, 0xbf, 0x8c, \
+  0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x02, 0xd9, 0x56, 0x79, 0x75, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x83, 0x87, 0x8c, 0x91, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x09, 0x00, 0x04, 0x9d, 0x5d, 0xa4, 0xf3, 0xf1, 0x50, 0xcb, 0xd0, 0xab, \
+  0x87, 0x83, 0x29, 0x7d, 0x83, 0xec, 0xe8, 0x44, 0x6d, 0x48, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x9d, \
+  0xd4, 0xe4, 0x61, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x41, \
+  0x52, 0x90, 0x76, 0x00, 0xb8, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xbd, 0x03, 0xe5, \
+  0x07, 0x36, 0x98, 0xae, 0x88, 0xca, 0xc5, 0x80, 0xcf, 0x06, 0xef, 0x00, 0x3d, 0x01, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, 0x3a, 0x74, 0x37, 0x00, \
+  0x19, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x73, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x64, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x03, 0x00, 0x00, 0x00, 0x64, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xd6, \
+  0xde, 0x99, 0xb4, 0x90, 0x92, 0x1f, 0x05, 0x09, 0x02, 0x37, 0x92, 0x85, 0x67, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x73, 0x6c, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x6f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, 0x6f, 0x6c, 0x00, 0x00, 0x00, 0xf2, 0xd6, 0xde, \
+  0x99, 0xb4, 0x90, 0x92, 0x1f, 0x05, 0x09, 0x02, 0x37, 0x92, 0x85, 0x67, 0x50, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x09, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, 0x3a, 0x6e, 0x33, 0x00, \
+  0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xbd, 0x03, 0xe5, 0x07, 0x36, 0x98, 0xae, \
+  0x88, 0xca, 0xc5, 0x80, 0xcf, 0x06, 0xef, 0xf1, 0x87, 0x0a, 0xe7, 0xbb, 0x1d, 0xaa, 0x58, 0x2f, \
+  0xf4, 0x63, 0x2f, 0xe8, 0x14, 0x0f, 0xf2, 0xd6, 0xde, 0x99, 0xb4, 0x90, 0x92, 0x1f, 0x05, 0x09, \
+  0x02, 0x37, 0x92, 0x85, 0x67, 0xf1, 0x50, 0xcb, 0xd0, 0xab, 0x87, 0x83, 0x29, 0x7d, 0x83, 0xec, \
+  0xe8, 0x44, 0x6d, 0x48\
+}
+#define TYPE_MAP_CDR_SZ_Serializers_t7 852u
+const dds_topic_descriptor_t Serializers_t7_desc =
+{
+  .m_size = sizeof (Serializers_t7),
+  .m_align = dds_alignof (Serializers_t7),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "Serializers::t7",
+  .m_keys = NULL,
+  .m_nops = 15,
+  .m_ops = Serializers_t7_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Serializers_t7, .sz = TYPE_INFO_CDR_SZ_Serializers_t7 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Serializers_t7, .sz = TYPE_MAP_CDR_SZ_Serializers_t7 }
+};
+
+static const uint32_t Serializers_t7_view_index[] = { 0, 1, 3, 4, 5, 6, 0, 6, 1, 9, 10 };
+static const uint32_t Serializers_t7_view_member_id[] = { 0, 1, 3, 4, 5, 6, 0, 6, 1, 9, 10 };
+static const dds_view_member_t Serializers_t7_view_members[] =
+{
+  { 1, &Serializers_t7_view_index[0], &Serializers_t7_view_member_id[0] },
+  { 1, &Serializers_t7_view_index[1], &Serializers_t7_view_member_id[1] },
+  { 1, &Serializers_t7_view_index[2], &Serializers_t7_view_member_id[2] },
+  { 1, &Serializers_t7_view_index[3], &Serializers_t7_view_member_id[3] },
+  { 1, &Serializers_t7_view_index[4], &Serializers_t7_view_member_id[4] },
+  { 2, &Serializers_t7_view_index[5], &Serializers_t7_view_member_id[5] },
+  { 2, &Serializers_t7_view_index[7], &Serializers_t7_view_member_id[7] },
+  { 1, &Serializers_t7_view_index[9], &Serializers_t7_view_member_id[9] },
+  { 1, &Serializers_t7_view_index[10], &Serializers_t7_view_member_id[10] }
+};
+
+static dds_view_desc_t Serializers_t7_view_desc = { &Serializers_t7_desc, 9, Serializers_t7_view_members, DDSRT_ATOMIC_VOIDP_INIT (NULL) };
+
+dds_return_t Serializers_t7_view_init (Serializers_t7_view *view, struct ddsi_serdata *serdata)
+{
+  return dds_view_init (&view->v, &Serializers_t7_view_desc, view->offs, serdata);
+}
+
+void Serializers_t7_view_fini (Serializers_t7_view *view)
+{
+  dds_view_fini (&view->v);
+}
+
+bool Serializers_t7_view_a (Serializers_t7_view *view, int32_t *value)
+{
+  const void *p = dds_view_member (&view->v, 0, 4);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t7_view_b (Serializers_t7_view *view, int32_t *value)
+{
+  const void *p = dds_view_member (&view->v, 1, 4);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t7_view_s (Serializers_t7_view *view, const char **value)
+{
+  return (*value = dds_view_string (&view->v, 2)) != NULL;
+}
+
+bool Serializers_t7_view_d1 (Serializers_t7_view *view, double *value)
+{
+  const void *p = dds_view_member (&view->v, 3, 8);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t7_view_d2 (Serializers_t7_view *view, double *value)
+{
+  const void *p = dds_view_member (&view->v, 4, 8);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t7_view_n_x (Serializers_t7_view *view, int16_t *value)
+{
+  const void *p = dds_view_member (&view->v, 5, 2);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t7_view_n_y (Serializers_t7_view *view, int16_t *value)
+{
+  const void *p = dds_view_member (&view->v, 6, 2);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t7_view_p (Serializers_t7_view *view, uint8_t *value)
+{
+  const void *p = dds_view_member (&view->v, 7, 1);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t7_view_ol (Serializers_t7_view *view, int32_t *value)
+{
+  const void *p = dds_view_member (&view->v, 8, 4);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+static const uint32_t Serializers_t8_ops [] =
+{
+  /* t8 */
+  DDS_OP_PLC,
+  DDS_OP_PLM | 11, 10u,
+  DDS_OP_PLM | 12, 11u,
+  DDS_OP_PLM | 13, 12u,
+  DDS_OP_PLM | 15, 13u,
+  DDS_OP_PLM | 16, 2u,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (Serializers_t8, a),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (Serializers_t8, s),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Serializers_t8, n), (3u << 16u) + 11u /* n3 */,
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_FLAG_OPT | DDS_OP_FLAG_EXT | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (Serializers_t8, od),
+  DDS_OP_RTS,
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (Serializers_t8, e), 2u,
+  DDS_OP_RTS,
+
+  /* n3 */
+  DDS_OP_ADR | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (Serializers_n3, x),
+  DDS_OP_ADR | DDS_OP_TYPE_2BY | DDS_OP_FLAG_SGN, offsetof (Serializers_n3, y),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 2b527a23bcf0600c6288969039aa] (#deps: 2)
+   - [MINIMAL 50cbd0ab8783297d83ece8446d48]
+   - [MINIMAL d7376d9d9d6d890ee0e0cd490818]
+  [COMPLETE 27dc0a9baa4b9dca0d6c5fcc9b8d] (#deps: 2)
+   - [COMPLETE d6de99b490921f05090237928567]
+   - [COMPLETE f60b2157679e87ca3389cadeeefd]
+*/
+#define TYPE_INFO_CDR_Serializers_t8 (unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x2b, 0x52, 0x7a, 0x23, 0xbc, 0xf0, 0x60, 0x0c, 0x62, 0x88, 0x96, \
+  0x90, 0x39, 0xaa, 0x00, 0x85, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x50, 0xcb, 0xd0, 0xab, 0x87, 0x83, 0x29, \
+  0x7d, 0x83, 0xec, 0xe8, 0x44, 0x6d, 0x48, 0x00, 0x37, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xd7, 0x37, 0x6d, 0x9d, 0x9d, 0x6d, 0x89, 0x0e, 0xe0, 0xe0, 0xcd, 0x49, 0x08, 0x18, 0x00, \
+  0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x27, 0xdc, 0x0a, 0x9b, 0xaa, 0x4b, 0x9d, 0xca, 0x0d, 0x6c, 0x5f, \
+  0xcc, 0x9b, 0x8d, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xd6, 0xde, 0x99, 0xb4, 0x90, 0x92, 0x1f, \
+  0x05, 0x09, 0x02, 0x37, 0x92, 0x85, 0x67, 0x00, 0x54, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xf6, 0x0b, 0x21, 0x57, 0x67, 0x9e, 0x87, 0xca, 0x33, 0x89, 0xca, 0xde, 0xee, 0xfd, 0x00, \
+  0x7e, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Serializers_t8 196u
+#define TYPE_MAP_CDR_Serializers_t8 (unsigned char []){ \
+  0x42, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x2b, 0x52, 0x7a, 0x23, 0xbc, 0xf0, 0x60, \
+  0x0c, 0x62, 0x88, 0x96, 0x90, 0x39, 0xaa, 0x00, 0x81, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x04, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x0c, 0xc1, 0x75, 0xb9, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x03, 0xc7, 0xc0, 0xac, \
+  0x19, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x50, 0xcb, 0xd0, 0xab, 0x87, \
+  0x83, 0x29, 0x7d, 0x83, 0xec, 0xe8, 0x44, 0x6d, 0x48, 0x7b, 0x8b, 0x96, 0x5a, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x09, 0x00, 0x0a, 0xaf, 0xc7, 0xe8, 0xa9, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xd7, 0x37, 0x6d, 0x9d, 0x9d, \
+  0x6d, 0x89, 0x0e, 0xe0, 0xe0, 0xcd, 0x49, 0x08, 0x18, 0xe1, 0x67, 0x17, 0x97, 0xf1, 0x50, 0xcb, \
+  0xd0, 0xab, 0x87, 0x83, 0x29, 0x7d, 0x83, 0xec, 0xe8, 0x44, 0x6d, 0x48, 0x33, 0x00, 0x00, 0x00, \
+  0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x9d, \
+  0xd4, 0xe4, 0x61, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x41, \
+  0x52, 0x90, 0x76, 0xf1, 0xd7, 0x37, 0x6d, 0x9d, 0x9d, 0x6d, 0x89, 0x0e, 0xe0, 0xe0, 0xcd, 0x49, \
+  0x08, 0x18, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x6d, 0xe7, 0x24, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x3b, \
+  0x51, 0x2c, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0xd6, 0xe8, 0x54, 0x8c, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0xf2, 0x27, 0xdc, 0x0a, 0x9b, 0xaa, 0x4b, 0x9d, 0xca, 0x0d, 0x6c, 0x5f, 0xcc, 0x9b, 0x8d, 0x00, \
+  0xb0, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, \
+  0x3a, 0x74, 0x38, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, 0x61, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x73, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xd6, \
+  0xde, 0x99, 0xb4, 0x90, 0x92, 0x1f, 0x05, 0x09, 0x02, 0x37, 0x92, 0x85, 0x67, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x0a, 0x00, 0x03, 0x00, 0x00, 0x00, 0x6f, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xf6, 0x0b, 0x21, 0x57, 0x67, \
+  0x9e, 0x87, 0xca, 0x33, 0x89, 0xca, 0xde, 0xee, 0xfd, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x65, 0x00, 0x00, 0x00, 0xf2, 0xd6, 0xde, 0x99, 0xb4, 0x90, 0x92, 0x1f, 0x05, 0x09, 0x02, 0x37, \
+  0x92, 0x85, 0x67, 0x00, 0x50, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x69, 0x61, 0x6c, 0x69, 0x7a, \
+  0x65, 0x72, 0x73, 0x3a, 0x3a, 0x6e, 0x33, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x78, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0xf2, 0xf6, 0x0b, 0x21, 0x57, 0x67, 0x9e, 0x87, \
+  0xca, 0x33, 0x89, 0xca, 0xde, 0xee, 0xfd, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x53, 0x65, 0x72, 0x69, \
+  0x61, 0x6c, 0x69, 0x7a, 0x65, 0x72, 0x73, 0x3a, 0x3a, 0x65, 0x6e, 0x00, 0x56, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x45, 0x5f, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x45, 0x5f, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x45, 0x5f, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0xf2, 0x27, 0xdc, 0x0a, 0x9b, 0xaa, 0x4b, 0x9d, 0xca, 0x0d, 0x6c, 0x5f, 0xcc, 0x9b, 0x8d, 0xf1, \
+  0x2b, 0x52, 0x7a, 0x23, 0xbc, 0xf0, 0x60, 0x0c, 0x62, 0x88, 0x96, 0x90, 0x39, 0xaa, 0xf2, 0xd6, \
+  0xde, 0x99, 0xb4, 0x90, 0x92, 0x1f, 0x05, 0x09, 0x02, 0x37, 0x92, 0x85, 0x67, 0xf1, 0x50, 0xcb, \
+  0xd0, 0xab, 0x87, 0x83, 0x29, 0x7d, 0x83, 0xec, 0xe8, 0x44, 0x6d, 0x48, 0xf2, 0xf6, 0x0b, 0x21, \
+  0x57, 0x67, 0x9e, 0x87, 0xca, 0x33, 0x89, 0xca, 0xde, 0xee, 0xfd, 0xf1, 0xd7, 0x37, 0x6d, 0x9d, \
+  0x9d, 0x6d, 0x89, 0x0e, 0xe0, 0xe0, 0xcd, 0x49, 0x08, 0x18\
+}
+#define TYPE_MAP_CDR_SZ_Serializers_t8 874u
+const dds_topic_descriptor_t Serializers_t8_desc =
+{
+  .m_size = sizeof (Serializers_t8),
+  .m_align = dds_alignof (Serializers_t8),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "Serializers::t8",
+  .m_keys = NULL,
+  .m_nops = 15,
+  .m_ops = Serializers_t8_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Serializers_t8, .sz = TYPE_INFO_CDR_SZ_Serializers_t8 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Serializers_t8, .sz = TYPE_MAP_CDR_SZ_Serializers_t8 }
+};
+
+static const uint32_t Serializers_t8_view_index[] = { 0, 1, 2, 0, 2, 1, 3, 4 };
+static const uint32_t Serializers_t8_view_member_id[] = { 10, 11, 12, 0, 12, 1, 13, 2 };
+static const dds_view_member_t Serializers_t8_view_members[] =
+{
+  { 1, &Serializers_t8_view_index[0], &Serializers_t8_view_member_id[0] },
+  { 1, &Serializers_t8_view_index[1], &Serializers_t8_view_member_id[1] },
+  { 2, &Serializers_t8_view_index[2], &Serializers_t8_view_member_id[2] },
+  { 2, &Serializers_t8_view_index[4], &Serializers_t8_view_member_id[4] },
+  { 1, &Serializers_t8_view_index[6], &Serializers_t8_view_member_id[6] },
+  { 1, &Serializers_t8_view_index[7], &Serializers_t8_view_member_id[7] }
+};
+
+static dds_view_desc_t Serializers_t8_view_desc = { &Serializers_t8_desc, 6, Serializers_t8_view_members, DDSRT_ATOMIC_VOIDP_INIT (NULL) };
+
+dds_return_t Serializers_t8_view_init (Serializers_t8_view *view, struct ddsi_serdata *serdata)
+{
+  return dds_view_init (&view->v, &Serializers_t8_view_desc, view->offs, serdata);
+}
+
+void Serializers_t8_view_fini (Serializers_t8_view *view)
+{
+  dds_view_fini (&view->v);
+}
+
+bool Serializers_t8_view_a (Serializers_t8_view *view, int32_t *value)
+{
+  const void *p = dds_view_member (&view->v, 0, 4);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t8_view_s (Serializers_t8_view *view, const char **value)
+{
+  return (*value = dds_view_string (&view->v, 1)) != NULL;
+}
+
+bool Serializers_t8_view_n_x (Serializers_t8_view *view, int16_t *value)
+{
+  const void *p = dds_view_member (&view->v, 2, 2);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t8_view_n_y (Serializers_t8_view *view, int16_t *value)
+{
+  const void *p = dds_view_member (&view->v, 3, 2);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t8_view_od (Serializers_t8_view *view, double *value)
+{
+  const void *p = dds_view_member (&view->v, 4, 8);
+  if (p == NULL)
+    return false;
+  memcpy (value, p, sizeof (*value));
+  return true;
+}
+
+bool Serializers_t8_view_e (Serializers_t8_view *view, Serializers_en *value)
+{
+  const void *p = dds_view_member (&view->v, 5, 4);
+  uint32_t x;
+  if (p == NULL)
+    return false;
+  memcpy (&x, p, sizeof (x));
+  *value = (Serializers_en) x;
+  return true;
+}
+
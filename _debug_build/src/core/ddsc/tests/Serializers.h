@@ -0,0 +1,540 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_debug_build/src/core/ddsc/tests/Serializers.h
+  Source: /root/repo/src/core/ddsc/tests/Serializers.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#ifndef DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_DDSC_TESTS_SERIALIZERS_H
+#define DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_DDSC_TESTS_SERIALIZERS_H
+
+#include "dds/ddsc/dds_public_impl.h"
+#include "dds/ddsc/dds_view.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum Serializers_en
+{
+  Serializers_E_1,
+  Serializers_E_2,
+  Serializers_E_3
+} Serializers_en;
+
+#define Serializers_en__alloc() \
+((Serializers_en*) dds_alloc (sizeof (Serializers_en)));
+
+typedef enum Serializers_en_small
+{
+  Serializers_ES_1,
+  Serializers_ES_2
+} Serializers_en_small;
+
+#define Serializers_en_small__alloc() \
+((Serializers_en_small*) dds_alloc (sizeof (Serializers_en_small)));
+
+typedef enum Serializers_en_medium
+{
+  Serializers_EM_1,
+  Serializers_EM_2,
+  Serializers_EM_3,
+  Serializers_EM_4
+} Serializers_en_medium;
+
+#define Serializers_en_medium__alloc() \
+((Serializers_en_medium*) dds_alloc (sizeof (Serializers_en_medium)));
+
+typedef int32_t Serializers_arr_t[2][3];
+
+#define Serializers_arr_t__alloc() \
+((Serializers_arr_t*) dds_alloc (sizeof (Serializers_arr_t)));
+
+typedef struct Serializers_seq_t
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  int16_t *_buffer;
+  bool _release;
+} Serializers_seq_t;
+
+#define Serializers_seq_t__alloc() \
+((Serializers_seq_t*) dds_alloc (sizeof (Serializers_seq_t)));
+
+#define Serializers_seq_t_allocbuf(l) \
+((int16_t *) dds_alloc ((l) * sizeof (int16_t)))
+typedef struct Serializers_n1
+{
+  uint8_t o;
+  char * s;
+  int64_t ll;
+} Serializers_n1;
+
+#ifndef DDS_SEQUENCE_SERIALIZERS_N1_DEFINED
+#define DDS_SEQUENCE_SERIALIZERS_N1_DEFINED
+typedef struct dds_sequence_Serializers_n1
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  struct Serializers_n1 *_buffer;
+  bool _release;
+} dds_sequence_Serializers_n1;
+
+#define dds_sequence_Serializers_n1__alloc() \
+((dds_sequence_Serializers_n1*) dds_alloc (sizeof (dds_sequence_Serializers_n1)));
+
+#define dds_sequence_Serializers_n1_allocbuf(l) \
+((struct Serializers_n1 *) dds_alloc ((l) * sizeof (struct Serializers_n1)))
+#endif /* DDS_SEQUENCE_SERIALIZERS_N1_DEFINED */
+
+typedef struct Serializers_n2
+{
+  struct Serializers_n1 a[2];
+  dds_sequence_Serializers_n1 bs;
+  Serializers_en_small es;
+} Serializers_n2;
+
+typedef struct Serializers_t1
+{
+  int32_t id;
+  char c;
+  bool b;
+  double d;
+  char * name;
+  Serializers_en e;
+  Serializers_en_medium em;
+  char bstr[6];
+  int16_t sh;
+  Serializers_en_small ek;
+} Serializers_t1;
+
+extern const dds_topic_descriptor_t Serializers_t1_desc;
+
+#define Serializers_t1__alloc() \
+((Serializers_t1*) dds_alloc (sizeof (Serializers_t1)));
+
+#define Serializers_t1_free(d,o) \
+dds_sample_free ((d), &Serializers_t1_desc, (o))
+
+typedef struct Serializers_t1_view
+{
+  dds_view_t v;
+  uint32_t offs[10];
+} Serializers_t1_view;
+
+dds_return_t Serializers_t1_view_init (Serializers_t1_view *view, struct ddsi_serdata *serdata);
+void Serializers_t1_view_fini (Serializers_t1_view *view);
+bool Serializers_t1_view_id (Serializers_t1_view *view, int32_t *value);
+bool Serializers_t1_view_c (Serializers_t1_view *view, char *value);
+bool Serializers_t1_view_b (Serializers_t1_view *view, bool *value);
+bool Serializers_t1_view_d (Serializers_t1_view *view, double *value);
+bool Serializers_t1_view_name (Serializers_t1_view *view, const char **value);
+bool Serializers_t1_view_e (Serializers_t1_view *view, Serializers_en *value);
+bool Serializers_t1_view_em (Serializers_t1_view *view, Serializers_en_medium *value);
+bool Serializers_t1_view_bstr (Serializers_t1_view *view, const char **value);
+bool Serializers_t1_view_sh (Serializers_t1_view *view, int16_t *value);
+bool Serializers_t1_view_ek (Serializers_t1_view *view, Serializers_en_small *value);
+
+#ifndef DDS_SEQUENCE_OCTET_DEFINED
+#define DDS_SEQUENCE_OCTET_DEFINED
+typedef struct dds_sequence_octet
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  uint8_t *_buffer;
+  bool _release;
+} dds_sequence_octet;
+
+#define dds_sequence_octet__alloc() \
+((dds_sequence_octet*) dds_alloc (sizeof (dds_sequence_octet)));
+
+#define dds_sequence_octet_allocbuf(l) \
+((uint8_t *) dds_alloc ((l) * sizeof (uint8_t)))
+#endif /* DDS_SEQUENCE_OCTET_DEFINED */
+
+#ifndef DDS_SEQUENCE_LONG_LONG_DEFINED
+#define DDS_SEQUENCE_LONG_LONG_DEFINED
+typedef struct dds_sequence_long_long
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  int64_t *_buffer;
+  bool _release;
+} dds_sequence_long_long;
+
+#define dds_sequence_long_long__alloc() \
+((dds_sequence_long_long*) dds_alloc (sizeof (dds_sequence_long_long)));
+
+#define dds_sequence_long_long_allocbuf(l) \
+((int64_t *) dds_alloc ((l) * sizeof (int64_t)))
+#endif /* DDS_SEQUENCE_LONG_LONG_DEFINED */
+
+#ifndef DDS_SEQUENCE_BOOL_DEFINED
+#define DDS_SEQUENCE_BOOL_DEFINED
+typedef struct dds_sequence_bool
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  bool *_buffer;
+  bool _release;
+} dds_sequence_bool;
+
+#define dds_sequence_bool__alloc() \
+((dds_sequence_bool*) dds_alloc (sizeof (dds_sequence_bool)));
+
+#define dds_sequence_bool_allocbuf(l) \
+((bool *) dds_alloc ((l) * sizeof (bool)))
+#endif /* DDS_SEQUENCE_BOOL_DEFINED */
+
+#ifndef DDS_SEQUENCE_SERIALIZERS_EN_MEDIUM_DEFINED
+#define DDS_SEQUENCE_SERIALIZERS_EN_MEDIUM_DEFINED
+typedef struct dds_sequence_Serializers_en_medium
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  Serializers_en_medium *_buffer;
+  bool _release;
+} dds_sequence_Serializers_en_medium;
+
+#define dds_sequence_Serializers_en_medium__alloc() \
+((dds_sequence_Serializers_en_medium*) dds_alloc (sizeof (dds_sequence_Serializers_en_medium)));
+
+#define dds_sequence_Serializers_en_medium_allocbuf(l) \
+((Serializers_en_medium *) dds_alloc ((l) * sizeof (Serializers_en_medium)))
+#endif /* DDS_SEQUENCE_SERIALIZERS_EN_MEDIUM_DEFINED */
+
+#ifndef DDS_SEQUENCE_STRING_DEFINED
+#define DDS_SEQUENCE_STRING_DEFINED
+typedef struct dds_sequence_string
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  char **_buffer;
+  bool _release;
+} dds_sequence_string;
+
+#define dds_sequence_string__alloc() \
+((dds_sequence_string*) dds_alloc (sizeof (dds_sequence_string)));
+
+#define dds_sequence_string_allocbuf(l) \
+((char **) dds_alloc ((l) * sizeof (char*)))
+#endif /* DDS_SEQUENCE_STRING_DEFINED */
+
+#ifndef DDS_SEQUENCE_STRING4_DEFINED
+#define DDS_SEQUENCE_STRING4_DEFINED
+typedef struct dds_sequence_string4
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  char (*_buffer)[5];
+  bool _release;
+} dds_sequence_string4;
+
+#define dds_sequence_string4__alloc() \
+((dds_sequence_string4*) dds_alloc (sizeof (dds_sequence_string4)));
+
+#define dds_sequence_string4_allocbuf(l) \
+((char (*)[5]) dds_alloc ((l) * sizeof (char[5])))
+#endif /* DDS_SEQUENCE_STRING4_DEFINED */
+
+#ifndef DDS_SEQUENCE_SERIALIZERS_N1_DEFINED
+#define DDS_SEQUENCE_SERIALIZERS_N1_DEFINED
+typedef struct dds_sequence_Serializers_n1
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  struct Serializers_n1 *_buffer;
+  bool _release;
+} dds_sequence_Serializers_n1;
+
+#define dds_sequence_Serializers_n1__alloc() \
+((dds_sequence_Serializers_n1*) dds_alloc (sizeof (dds_sequence_Serializers_n1)));
+
+#define dds_sequence_Serializers_n1_allocbuf(l) \
+((struct Serializers_n1 *) dds_alloc ((l) * sizeof (struct Serializers_n1)))
+#endif /* DDS_SEQUENCE_SERIALIZERS_N1_DEFINED */
+
+#ifndef DDS_SEQUENCE_SERIALIZERS_N2_DEFINED
+#define DDS_SEQUENCE_SERIALIZERS_N2_DEFINED
+typedef struct dds_sequence_Serializers_n2
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  struct Serializers_n2 *_buffer;
+  bool _release;
+} dds_sequence_Serializers_n2;
+
+#define dds_sequence_Serializers_n2__alloc() \
+((dds_sequence_Serializers_n2*) dds_alloc (sizeof (dds_sequence_Serializers_n2)));
+
+#define dds_sequence_Serializers_n2_allocbuf(l) \
+((struct Serializers_n2 *) dds_alloc ((l) * sizeof (struct Serializers_n2)))
+#endif /* DDS_SEQUENCE_SERIALIZERS_N2_DEFINED */
+
+typedef struct Serializers_t2
+{
+  uint8_t o;
+  struct Serializers_n2 n;
+  int64_t k1;
+  int32_t l[3];
+  Serializers_arr_t la;
+  bool ba[3];
+  Serializers_en ea[2];
+  char * sa[2];
+  char bsa[2][4];
+  struct Serializers_n1 na[2];
+  dds_sequence_octet so;
+  dds_sequence_long_long sll;
+  Serializers_seq_t ss;
+  dds_sequence_bool sb;
+  dds_sequence_Serializers_en_medium se;
+  dds_sequence_string sstr;
+  dds_sequence_string4 sbstr;
+  dds_sequence_Serializers_n1 sn;
+  dds_sequence_Serializers_n2 sn2;
+  char k2[9];
+} Serializers_t2;
+
+extern const dds_topic_descriptor_t Serializers_t2_desc;
+
+#define Serializers_t2__alloc() \
+((Serializers_t2*) dds_alloc (sizeof (Serializers_t2)));
+
+#define Serializers_t2_free(d,o) \
+dds_sample_free ((d), &Serializers_t2_desc, (o))
+
+typedef struct Serializers_t2_view
+{
+  dds_view_t v;
+  uint32_t offs[4];
+} Serializers_t2_view;
+
+dds_return_t Serializers_t2_view_init (Serializers_t2_view *view, struct ddsi_serdata *serdata);
+void Serializers_t2_view_fini (Serializers_t2_view *view);
+bool Serializers_t2_view_o (Serializers_t2_view *view, uint8_t *value);
+bool Serializers_t2_view_n_es (Serializers_t2_view *view, Serializers_en_small *value);
+bool Serializers_t2_view_k1 (Serializers_t2_view *view, int64_t *value);
+bool Serializers_t2_view_k2 (Serializers_t2_view *view, const char **value);
+
+#ifndef DDS_SEQUENCE_DOUBLE_DEFINED
+#define DDS_SEQUENCE_DOUBLE_DEFINED
+typedef struct dds_sequence_double
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  double *_buffer;
+  bool _release;
+} dds_sequence_double;
+
+#define dds_sequence_double__alloc() \
+((dds_sequence_double*) dds_alloc (sizeof (dds_sequence_double)));
+
+#define dds_sequence_double_allocbuf(l) \
+((double *) dds_alloc ((l) * sizeof (double)))
+#endif /* DDS_SEQUENCE_DOUBLE_DEFINED */
+
+typedef struct Serializers_t3
+{
+  int32_t l;
+  dds_sequence_double sd;
+} Serializers_t3;
+
+extern const dds_topic_descriptor_t Serializers_t3_desc;
+
+#define Serializers_t3__alloc() \
+((Serializers_t3*) dds_alloc (sizeof (Serializers_t3)));
+
+#define Serializers_t3_free(d,o) \
+dds_sample_free ((d), &Serializers_t3_desc, (o))
+
+typedef struct Serializers_t3_view
+{
+  dds_view_t v;
+  uint32_t offs[1];
+} Serializers_t3_view;
+
+dds_return_t Serializers_t3_view_init (Serializers_t3_view *view, struct ddsi_serdata *serdata);
+void Serializers_t3_view_fini (Serializers_t3_view *view);
+bool Serializers_t3_view_l (Serializers_t3_view *view, int32_t *value);
+
+typedef struct Serializers_t4
+{
+  int32_t l;
+} Serializers_t4;
+
+extern const dds_topic_descriptor_t Serializers_t4_desc;
+
+#define Serializers_t4__alloc() \
+((Serializers_t4*) dds_alloc (sizeof (Serializers_t4)));
+
+#define Serializers_t4_free(d,o) \
+dds_sample_free ((d), &Serializers_t4_desc, (o))
+
+typedef struct Serializers_t4_view
+{
+  dds_view_t v;
+  uint32_t offs[1];
+} Serializers_t4_view;
+
+dds_return_t Serializers_t4_view_init (Serializers_t4_view *view, struct ddsi_serdata *serdata);
+void Serializers_t4_view_fini (Serializers_t4_view *view);
+bool Serializers_t4_view_l (Serializers_t4_view *view, int32_t *value);
+
+typedef struct Serializers_t5
+{
+  struct Serializers_n1 k;
+  int32_t l;
+} Serializers_t5;
+
+extern const dds_topic_descriptor_t Serializers_t5_desc;
+
+#define Serializers_t5__alloc() \
+((Serializers_t5*) dds_alloc (sizeof (Serializers_t5)));
+
+#define Serializers_t5_free(d,o) \
+dds_sample_free ((d), &Serializers_t5_desc, (o))
+
+typedef struct Serializers_t5_view
+{
+  dds_view_t v;
+  uint32_t offs[4];
+} Serializers_t5_view;
+
+dds_return_t Serializers_t5_view_init (Serializers_t5_view *view, struct ddsi_serdata *serdata);
+void Serializers_t5_view_fini (Serializers_t5_view *view);
+bool Serializers_t5_view_k_o (Serializers_t5_view *view, uint8_t *value);
+bool Serializers_t5_view_k_s (Serializers_t5_view *view, const char **value);
+bool Serializers_t5_view_k_ll (Serializers_t5_view *view, int64_t *value);
+bool Serializers_t5_view_l (Serializers_t5_view *view, int32_t *value);
+
+typedef struct Serializers_t6
+{
+  int32_t a;
+  int16_t x;
+  char * b;
+  uint8_t c;
+} Serializers_t6;
+
+extern const dds_topic_descriptor_t Serializers_t6_desc;
+
+#define Serializers_t6__alloc() \
+((Serializers_t6*) dds_alloc (sizeof (Serializers_t6)));
+
+#define Serializers_t6_free(d,o) \
+dds_sample_free ((d), &Serializers_t6_desc, (o))
+
+typedef struct Serializers_t6_view
+{
+  dds_view_t v;
+  uint32_t offs[4];
+} Serializers_t6_view;
+
+dds_return_t Serializers_t6_view_init (Serializers_t6_view *view, struct ddsi_serdata *serdata);
+void Serializers_t6_view_fini (Serializers_t6_view *view);
+bool Serializers_t6_view_a (Serializers_t6_view *view, int32_t *value);
+bool Serializers_t6_view_x (Serializers_t6_view *view, int16_t *value);
+bool Serializers_t6_view_b (Serializers_t6_view *view, const char **value);
+bool Serializers_t6_view_c (Serializers_t6_view *view, uint8_t *value);
+
+typedef struct Serializers_n3
+{
+  int16_t x;
+  int16_t y;
+} Serializers_n3;
+
+#ifndef DDS_SEQUENCE_LONG_DEFINED
+#define DDS_SEQUENCE_LONG_DEFINED
+typedef struct dds_sequence_long
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  int32_t *_buffer;
+  bool _release;
+} dds_sequence_long;
+
+#define dds_sequence_long__alloc() \
+((dds_sequence_long*) dds_alloc (sizeof (dds_sequence_long)));
+
+#define dds_sequence_long_allocbuf(l) \
+((int32_t *) dds_alloc ((l) * sizeof (int32_t)))
+#endif /* DDS_SEQUENCE_LONG_DEFINED */
+
+typedef struct Serializers_t7
+{
+  int32_t a;
+  int32_t b;
+  int32_t c[4];
+  char * s;
+  double d1;
+  double d2;
+  struct Serializers_n3 n;
+  dds_sequence_long sl;
+  uint8_t o[3];
+  uint8_t p;
+  int32_t * ol;
+} Serializers_t7;
+
+extern const dds_topic_descriptor_t Serializers_t7_desc;
+
+#define Serializers_t7__alloc() \
+((Serializers_t7*) dds_alloc (sizeof (Serializers_t7)));
+
+#define Serializers_t7_free(d,o) \
+dds_sample_free ((d), &Serializers_t7_desc, (o))
+
+typedef struct Serializers_t7_view
+{
+  dds_view_t v;
+  uint32_t offs[9];
+} Serializers_t7_view;
+
+dds_return_t Serializers_t7_view_init (Serializers_t7_view *view, struct ddsi_serdata *serdata);
+void Serializers_t7_view_fini (Serializers_t7_view *view);
+bool Serializers_t7_view_a (Serializers_t7_view *view, int32_t *value);
+bool Serializers_t7_view_b (Serializers_t7_view *view, int32_t *value);
+bool Serializers_t7_view_s (Serializers_t7_view *view, const char **value);
+bool Serializers_t7_view_d1 (Serializers_t7_view *view, double *value);
+bool Serializers_t7_view_d2 (Serializers_t7_view *view, double *value);
+bool Serializers_t7_view_n_x (Serializers_t7_view *view, int16_t *value);
+bool Serializers_t7_view_n_y (Serializers_t7_view *view, int16_t *value);
+bool Serializers_t7_view_p (Serializers_t7_view *view, uint8_t *value);
+bool Serializers_t7_view_ol (Serializers_t7_view *view, int32_t *value);
+
+typedef struct Serializers_t8
+{
+  int32_t a;
+  char * s;
+  struct Serializers_n3 n;
+  double * od;
+  Serializers_en e;
+} Serializers_t8;
+
+extern const dds_topic_descriptor_t Serializers_t8_desc;
+
+#define Serializers_t8__alloc() \
+((Serializers_t8*) dds_alloc (sizeof (Serializers_t8)));
+
+#define Serializers_t8_free(d,o) \
+dds_sample_free ((d), &Serializers_t8_desc, (o))
+
+typedef struct Serializers_t8_view
+{
+  dds_view_t v;
+  uint32_t offs[6];
+} Serializers_t8_view;
+
+dds_return_t Serializers_t8_view_init (Serializers_t8_view *view, struct ddsi_serdata *serdata);
+void Serializers_t8_view_fini (Serializers_t8_view *view);
+bool Serializers_t8_view_a (Serializers_t8_view *view, int32_t *value);
+bool Serializers_t8_view_s (Serializers_t8_view *view, const char **value);
+bool Serializers_t8_view_n_x (Serializers_t8_view *view, int16_t *value);
+bool Serializers_t8_view_n_y (Serializers_t8_view *view, int16_t *value);
+bool Serializers_t8_view_od (Serializers_t8_view *view, double *value);
+bool Serializers_t8_view_e (Serializers_t8_view *view, Serializers_en *value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_DDSC_TESTS_SERIALIZERS_H */
@@ -0,0 +1,184 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_debug_build/src/core/ddsc/tests/Space.h
+  Source: /root/repo/src/core/ddsc/tests/Space.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#ifndef DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_DDSC_TESTS_SPACE_H
+#define DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_DDSC_TESTS_SPACE_H
+
+#include "dds/ddsc/dds_public_impl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct Space_Type1
+{
+  int32_t long_1;
+  int32_t long_2;
+  int32_t long_3;
+} Space_Type1;
+
+extern const dds_topic_descriptor_t Space_Type1_desc;
+
+#define Space_Type1__alloc() \
+((Space_Type1*) dds_alloc (sizeof (Space_Type1)));
+
+#define Space_Type1_free(d,o) \
+dds_sample_free ((d), &Space_Type1_desc, (o))
+
+typedef struct Space_Type2
+{
+  int32_t long_1;
+  int32_t long_2;
+  int32_t long_3;
+} Space_Type2;
+
+extern const dds_topic_descriptor_t Space_Type2_desc;
+
+#define Space_Type2__alloc() \
+((Space_Type2*) dds_alloc (sizeof (Space_Type2)));
+
+#define Space_Type2_free(d,o) \
+dds_sample_free ((d), &Space_Type2_desc, (o))
+
+typedef struct Space_Type3
+{
+  int32_t long_1;
+  int32_t long_2;
+  int32_t long_3;
+} Space_Type3;
+
+extern const dds_topic_descriptor_t Space_Type3_desc;
+
+#define Space_Type3__alloc() \
+((Space_Type3*) dds_alloc (sizeof (Space_Type3)));
+
+#define Space_Type3_free(d,o) \
+dds_sample_free ((d), &Space_Type3_desc, (o))
+
+typedef struct Space_simpletypes
+{
+  int32_t l;
+  int64_t ll;
+  uint16_t us;
+  uint32_t ul;
+  uint64_t ull;
+  float f;
+  double d;
+  char c;
+  bool b;
+  uint8_t o;
+  char * s;
+} Space_simpletypes;
+
+extern const dds_topic_descriptor_t Space_simpletypes_desc;
+
+#define Space_simpletypes__alloc() \
+((Space_simpletypes*) dds_alloc (sizeof (Space_simpletypes)));
+
+#define Space_simpletypes_free(d,o) \
+dds_sample_free ((d), &Space_simpletypes_desc, (o))
+
+#ifndef DDS_SEQUENCE_STRING_DEFINED
+#define DDS_SEQUENCE_STRING_DEFINED
+typedef struct dds_sequence_string
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  char **_buffer;
+  bool _release;
+} dds_sequence_string;
+
+#define dds_sequence_string__alloc() \
+((dds_sequence_string*) dds_alloc (sizeof (dds_sequence_string)));
+
+#define dds_sequence_string_allocbuf(l) \
+((char **) dds_alloc ((l) * sizeof (char*)))
+#endif /* DDS_SEQUENCE_STRING_DEFINED */
+
+#ifndef DDS_SEQUENCE_LONG_DEFINED
+#define DDS_SEQUENCE_LONG_DEFINED
+typedef struct dds_sequence_long
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  int32_t *_buffer;
+  bool _release;
+} dds_sequence_long;
+
+#define dds_sequence_long__alloc() \
+((dds_sequence_long*) dds_alloc (sizeof (dds_sequence_long)));
+
+#define dds_sequence_long_allocbuf(l) \
+((int32_t *) dds_alloc ((l) * sizeof (int32_t)))
+#endif /* DDS_SEQUENCE_LONG_DEFINED */
+
+typedef struct Space_arenatype
+{
+  char * k;
+  char * s;
+  dds_sequence_string ss;
+  dds_sequence_long sl;
+} Space_arenatype;
+
+extern const dds_topic_descriptor_t Space_arenatype_desc;
+
+#define Space_arenatype__alloc() \
+((Space_arenatype*) dds_alloc (sizeof (Space_arenatype)));
+
+#define Space_arenatype_free(d,o) \
+dds_sample_free ((d), &Space_arenatype_desc, (o))
+
+typedef struct Space_arenabstr
+{
+  char s[256];
+} Space_arenabstr;
+
+extern const dds_topic_descriptor_t Space_arenabstr_desc;
+
+#define Space_arenabstr__alloc() \
+((Space_arenabstr*) dds_alloc (sizeof (Space_arenabstr)));
+
+#define Space_arenabstr_free(d,o) \
+dds_sample_free ((d), &Space_arenabstr_desc, (o))
+
+#ifndef DDS_SEQUENCE_SPACE_ARENABSTR_DEFINED
+#define DDS_SEQUENCE_SPACE_ARENABSTR_DEFINED
+typedef struct dds_sequence_Space_arenabstr
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  struct Space_arenabstr *_buffer;
+  bool _release;
+} dds_sequence_Space_arenabstr;
+
+#define dds_sequence_Space_arenabstr__alloc() \
+((dds_sequence_Space_arenabstr*) dds_alloc (sizeof (dds_sequence_Space_arenabstr)));
+
+#define dds_sequence_Space_arenabstr_allocbuf(l) \
+((struct Space_arenabstr *) dds_alloc ((l) * sizeof (struct Space_arenabstr)))
+#endif /* DDS_SEQUENCE_SPACE_ARENABSTR_DEFINED */
+
+typedef struct Space_arenaexpand
+{
+  int32_t k;
+  dds_sequence_Space_arenabstr bs;
+} Space_arenaexpand;
+
+extern const dds_topic_descriptor_t Space_arenaexpand_desc;
+
+#define Space_arenaexpand__alloc() \
+((Space_arenaexpand*) dds_alloc (sizeof (Space_arenaexpand)));
+
+#define Space_arenaexpand_free(d,o) \
+dds_sample_free ((d), &Space_arenaexpand_desc, (o))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_DDSC_TESTS_SPACE_H */
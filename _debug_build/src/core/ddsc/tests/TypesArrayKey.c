@@ -0,0 +1,829 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_debug_build/src/core/ddsc/tests/TypesArrayKey.c
+  Source: /root/repo/src/core/ddsc/tests/TypesArrayKey.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "TypesArrayKey.h"
+
+static const uint32_t TypesArrayKey_long_arraytypekey_ops [] =
+{
+  /* long_arraytypekey */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypesArrayKey_long_arraytypekey, key), 20u,
+  DDS_OP_RTS,
+  
+  /* key: key */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t TypesArrayKey_long_arraytypekey_keys[1] =
+{
+  { "key", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 5e9d755e2e06be6508037fcaf245] (#deps: 0)
+  [COMPLETE 696df728262bfffb8e34da477af9] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypesArrayKey_long_arraytypekey (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x5e, 0x9d, 0x75, 0x5e, 0x2e, 0x06, 0xbe, 0x65, 0x08, 0x03, 0x7f, \
+  0xca, 0xf2, 0x45, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x69, 0x6d, 0xf7, 0x28, 0x26, 0x2b, 0xff, 0xfb, 0x8e, 0x34, 0xda, \
+  0x47, 0x7a, 0xf9, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypesArrayKey_long_arraytypekey 100u
+#define TYPE_MAP_CDR_TypesArrayKey_long_arraytypekey (unsigned char []){ \
+  0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x5e, 0x9d, 0x75, 0x5e, 0x2e, 0x06, 0xbe, \
+  0x65, 0x08, 0x03, 0x7f, 0xca, 0xf2, 0x45, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x04, 0x3c, 0x6e, 0x0b, 0x8a, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x69, 0x6d, 0xf7, 0x28, 0x26, 0x2b, 0xff, 0xfb, 0x8e, 0x34, 0xda, \
+  0x47, 0x7a, 0xf9, 0x00, 0x5e, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x29, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x73, 0x41, 0x72, 0x72, \
+  0x61, 0x79, 0x4b, 0x65, 0x79, 0x3a, 0x3a, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x61, 0x72, 0x72, 0x61, \
+  0x79, 0x74, 0x79, 0x70, 0x65, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x04, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x69, 0x6d, 0xf7, 0x28, 0x26, 0x2b, 0xff, 0xfb, 0x8e, 0x34, 0xda, 0x47, 0x7a, 0xf9, 0xf1, \
+  0x5e, 0x9d, 0x75, 0x5e, 0x2e, 0x06, 0xbe, 0x65, 0x08, 0x03, 0x7f, 0xca, 0xf2, 0x45\
+}
+#define TYPE_MAP_CDR_SZ_TypesArrayKey_long_arraytypekey 238u
+const dds_topic_descriptor_t TypesArrayKey_long_arraytypekey_desc =
+{
+  .m_size = sizeof (TypesArrayKey_long_arraytypekey),
+  .m_align = dds_alignof (TypesArrayKey_long_arraytypekey),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "TypesArrayKey::long_arraytypekey",
+  .m_keys = TypesArrayKey_long_arraytypekey_keys,
+  .m_nops = 2,
+  .m_ops = TypesArrayKey_long_arraytypekey_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypesArrayKey_long_arraytypekey, .sz = TYPE_INFO_CDR_SZ_TypesArrayKey_long_arraytypekey },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypesArrayKey_long_arraytypekey, .sz = TYPE_MAP_CDR_SZ_TypesArrayKey_long_arraytypekey }
+};
+
+static const uint32_t TypesArrayKey_longlong_arraytypekey_ops [] =
+{
+  /* longlong_arraytypekey */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_8BY | DDS_OP_FLAG_SGN, offsetof (TypesArrayKey_longlong_arraytypekey, key), 20u,
+  DDS_OP_RTS,
+  
+  /* key: key */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t TypesArrayKey_longlong_arraytypekey_keys[1] =
+{
+  { "key", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL a8d8485d4b879393f9694f42c3cc] (#deps: 1)
+   - [MINIMAL 84ce9c3d894c1483f859c00d5927]
+  [COMPLETE 5487a5aec8de222bbdda6c500fbb] (#deps: 1)
+   - [COMPLETE ae7d247d860f15d796e292cae7a1]
+*/
+#define TYPE_INFO_CDR_TypesArrayKey_longlong_arraytypekey (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xa8, 0xd8, 0x48, 0x5d, 0x4b, 0x87, 0x93, 0x93, 0xf9, 0x69, 0x4f, \
+  0x42, 0xc3, 0xcc, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x84, 0xce, 0x9c, 0x3d, 0x89, 0x4c, 0x14, \
+  0x83, 0xf8, 0x59, 0xc0, 0x0d, 0x59, 0x27, 0x00, 0x13, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x54, 0x87, 0xa5, \
+  0xae, 0xc8, 0xde, 0x22, 0x2b, 0xbd, 0xda, 0x6c, 0x50, 0x0f, 0xbb, 0x00, 0x72, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xae, 0x7d, 0x24, 0x7d, 0x86, 0x0f, 0x15, 0xd7, 0x96, 0xe2, 0x92, 0xca, 0xe7, 0xa1, 0x00, \
+  0x35, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypesArrayKey_longlong_arraytypekey 148u
+#define TYPE_MAP_CDR_TypesArrayKey_longlong_arraytypekey (unsigned char []){ \
+  0x77, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xa8, 0xd8, 0x48, 0x5d, 0x4b, 0x87, 0x93, \
+  0x93, 0xf9, 0x69, 0x4f, 0x42, 0xc3, 0xcc, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0xf1, 0x84, 0xce, 0x9c, 0x3d, 0x89, 0x4c, 0x14, 0x83, 0xf8, 0x59, \
+  0xc0, 0x0d, 0x59, 0x27, 0x3c, 0x6e, 0x0b, 0x8a, 0xf1, 0x84, 0xce, 0x9c, 0x3d, 0x89, 0x4c, 0x14, \
+  0x83, 0xf8, 0x59, 0xc0, 0x0d, 0x59, 0x27, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0xcd, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x54, 0x87, 0xa5, 0xae, 0xc8, 0xde, 0x22, 0x2b, 0xbd, 0xda, 0x6c, \
+  0x50, 0x0f, 0xbb, 0x00, 0x6e, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x2d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x73, 0x41, 0x72, 0x72, \
+  0x61, 0x79, 0x4b, 0x65, 0x79, 0x3a, 0x3a, 0x6c, 0x6f, 0x6e, 0x67, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, \
+  0x61, 0x72, 0x72, 0x61, 0x79, 0x74, 0x79, 0x70, 0x65, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00, \
+  0x32, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0xf2, 0xae, 0x7d, \
+  0x24, 0x7d, 0x86, 0x0f, 0x15, 0xd7, 0x96, 0xe2, 0x92, 0xca, 0xe7, 0xa1, 0x04, 0x00, 0x00, 0x00, \
+  0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0xf2, 0xae, 0x7d, 0x24, 0x7d, 0x86, 0x0f, 0x15, 0xd7, 0x96, \
+  0xe2, 0x92, 0xca, 0xe7, 0xa1, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x4b, 0x65, 0x79, 0x3a, 0x3a, 0x6c, 0x6f, 0x6e, 0x67, 0x6c, \
+  0x6f, 0x6e, 0x67, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x54, 0x87, 0xa5, 0xae, 0xc8, 0xde, 0x22, \
+  0x2b, 0xbd, 0xda, 0x6c, 0x50, 0x0f, 0xbb, 0xf1, 0xa8, 0xd8, 0x48, 0x5d, 0x4b, 0x87, 0x93, 0x93, \
+  0xf9, 0x69, 0x4f, 0x42, 0xc3, 0xcc, 0xf2, 0xae, 0x7d, 0x24, 0x7d, 0x86, 0x0f, 0x15, 0xd7, 0x96, \
+  0xe2, 0x92, 0xca, 0xe7, 0xa1, 0xf1, 0x84, 0xce, 0x9c, 0x3d, 0x89, 0x4c, 0x14, 0x83, 0xf8, 0x59, \
+  0xc0, 0x0d, 0x59, 0x27\
+}
+#define TYPE_MAP_CDR_SZ_TypesArrayKey_longlong_arraytypekey 404u
+const dds_topic_descriptor_t TypesArrayKey_longlong_arraytypekey_desc =
+{
+  .m_size = sizeof (TypesArrayKey_longlong_arraytypekey),
+  .m_align = dds_alignof (TypesArrayKey_longlong_arraytypekey),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "TypesArrayKey::longlong_arraytypekey",
+  .m_keys = TypesArrayKey_longlong_arraytypekey_keys,
+  .m_nops = 2,
+  .m_ops = TypesArrayKey_longlong_arraytypekey_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypesArrayKey_longlong_arraytypekey, .sz = TYPE_INFO_CDR_SZ_TypesArrayKey_longlong_arraytypekey },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypesArrayKey_longlong_arraytypekey, .sz = TYPE_MAP_CDR_SZ_TypesArrayKey_longlong_arraytypekey }
+};
+
+static const uint32_t TypesArrayKey_unsignedshort_arraytypekey_ops [] =
+{
+  /* unsignedshort_arraytypekey */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_2BY, offsetof (TypesArrayKey_unsignedshort_arraytypekey, key), 20u,
+  DDS_OP_RTS,
+  
+  /* key: key */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t TypesArrayKey_unsignedshort_arraytypekey_keys[1] =
+{
+  { "key", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL cf42cf3279157791967fbf3e0fb0] (#deps: 1)
+   - [MINIMAL 80455e796dd3437163cb532089da]
+  [COMPLETE 1b350ee394b5b83b645be8d510f2] (#deps: 1)
+   - [COMPLETE 75d195e67033f10ee9531a85a5b4]
+*/
+#define TYPE_INFO_CDR_TypesArrayKey_unsignedshort_arraytypekey (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xcf, 0x42, 0xcf, 0x32, 0x79, 0x15, 0x77, 0x91, 0x96, 0x7f, 0xbf, \
+  0x3e, 0x0f, 0xb0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x80, 0x45, 0x5e, 0x79, 0x6d, 0xd3, 0x43, \
+  0x71, 0x63, 0xcb, 0x53, 0x20, 0x89, 0xda, 0x00, 0x13, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x1b, 0x35, 0x0e, \
+  0xe3, 0x94, 0xb5, 0xb8, 0x3b, 0x64, 0x5b, 0xe8, 0xd5, 0x10, 0xf2, 0x00, 0x76, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x75, 0xd1, 0x95, 0xe6, 0x70, 0x33, 0xf1, 0x0e, 0xe9, 0x53, 0x1a, 0x85, 0xa5, 0xb4, 0x00, \
+  0x3d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypesArrayKey_unsignedshort_arraytypekey 148u
+#define TYPE_MAP_CDR_TypesArrayKey_unsignedshort_arraytypekey (unsigned char []){ \
+  0x77, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xcf, 0x42, 0xcf, 0x32, 0x79, 0x15, 0x77, \
+  0x91, 0x96, 0x7f, 0xbf, 0x3e, 0x0f, 0xb0, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0xf1, 0x80, 0x45, 0x5e, 0x79, 0x6d, 0xd3, 0x43, 0x71, 0x63, 0xcb, \
+  0x53, 0x20, 0x89, 0xda, 0x3c, 0x6e, 0x0b, 0x8a, 0xf1, 0x80, 0x45, 0x5e, 0x79, 0x6d, 0xd3, 0x43, \
+  0x71, 0x63, 0xcb, 0x53, 0x20, 0x89, 0xda, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xd9, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x1b, 0x35, 0x0e, 0xe3, 0x94, 0xb5, 0xb8, 0x3b, 0x64, 0x5b, 0xe8, \
+  0xd5, 0x10, 0xf2, 0x00, 0x72, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x32, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x73, 0x41, 0x72, 0x72, \
+  0x61, 0x79, 0x4b, 0x65, 0x79, 0x3a, 0x3a, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x73, \
+  0x68, 0x6f, 0x72, 0x74, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x74, 0x79, 0x70, 0x65, 0x6b, 0x65, \
+  0x79, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x14, 0xf2, 0x75, 0xd1, 0x95, 0xe6, 0x70, 0x33, 0xf1, 0x0e, 0xe9, 0x53, 0x1a, 0x85, 0xa5, 0xb4, \
+  0x04, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0xf2, 0x75, 0xd1, 0x95, 0xe6, 0x70, \
+  0x33, 0xf1, 0x0e, 0xe9, 0x53, 0x1a, 0x85, 0xa5, 0xb4, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, \
+  0xf2, 0x30, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x4b, 0x65, 0x79, 0x3a, 0x3a, 0x75, \
+  0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x73, 0x68, 0x6f, 0x72, 0x74, 0x00, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x1b, 0x35, 0x0e, 0xe3, 0x94, 0xb5, 0xb8, 0x3b, 0x64, 0x5b, 0xe8, \
+  0xd5, 0x10, 0xf2, 0xf1, 0xcf, 0x42, 0xcf, 0x32, 0x79, 0x15, 0x77, 0x91, 0x96, 0x7f, 0xbf, 0x3e, \
+  0x0f, 0xb0, 0xf2, 0x75, 0xd1, 0x95, 0xe6, 0x70, 0x33, 0xf1, 0x0e, 0xe9, 0x53, 0x1a, 0x85, 0xa5, \
+  0xb4, 0xf1, 0x80, 0x45, 0x5e, 0x79, 0x6d, 0xd3, 0x43, 0x71, 0x63, 0xcb, 0x53, 0x20, 0x89, 0xda\
+}
+#define TYPE_MAP_CDR_SZ_TypesArrayKey_unsignedshort_arraytypekey 416u
+const dds_topic_descriptor_t TypesArrayKey_unsignedshort_arraytypekey_desc =
+{
+  .m_size = sizeof (TypesArrayKey_unsignedshort_arraytypekey),
+  .m_align = dds_alignof (TypesArrayKey_unsignedshort_arraytypekey),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "TypesArrayKey::unsignedshort_arraytypekey",
+  .m_keys = TypesArrayKey_unsignedshort_arraytypekey_keys,
+  .m_nops = 2,
+  .m_ops = TypesArrayKey_unsignedshort_arraytypekey_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypesArrayKey_unsignedshort_arraytypekey, .sz = TYPE_INFO_CDR_SZ_TypesArrayKey_unsignedshort_arraytypekey },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypesArrayKey_unsignedshort_arraytypekey, .sz = TYPE_MAP_CDR_SZ_TypesArrayKey_unsignedshort_arraytypekey }
+};
+
+static const uint32_t TypesArrayKey_unsignedlong_arraytypekey_ops [] =
+{
+  /* unsignedlong_arraytypekey */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY, offsetof (TypesArrayKey_unsignedlong_arraytypekey, key), 20u,
+  DDS_OP_RTS,
+  
+  /* key: key */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t TypesArrayKey_unsignedlong_arraytypekey_keys[1] =
+{
+  { "key", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 8c24898034037f9b02119a273c91] (#deps: 1)
+   - [MINIMAL 6b01d20c3efdfb7dc7a36c9a79cf]
+  [COMPLETE d2db0172a7b5603e584345bfd7bd] (#deps: 1)
+   - [COMPLETE 222646ee48f57ae804d7809234d4]
+*/
+#define TYPE_INFO_CDR_TypesArrayKey_unsignedlong_arraytypekey (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8c, 0x24, 0x89, 0x80, 0x34, 0x03, 0x7f, 0x9b, 0x02, 0x11, 0x9a, \
+  0x27, 0x3c, 0x91, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x6b, 0x01, 0xd2, 0x0c, 0x3e, 0xfd, 0xfb, \
+  0x7d, 0xc7, 0xa3, 0x6c, 0x9a, 0x79, 0xcf, 0x00, 0x13, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xd2, 0xdb, 0x01, \
+  0x72, 0xa7, 0xb5, 0x60, 0x3e, 0x58, 0x43, 0x45, 0xbf, 0xd7, 0xbd, 0x00, 0x76, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x22, 0x26, 0x46, 0xee, 0x48, 0xf5, 0x7a, 0xe8, 0x04, 0xd7, 0x80, 0x92, 0x34, 0xd4, 0x00, \
+  0x39, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypesArrayKey_unsignedlong_arraytypekey 148u
+#define TYPE_MAP_CDR_TypesArrayKey_unsignedlong_arraytypekey (unsigned char []){ \
+  0x77, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x8c, 0x24, 0x89, 0x80, 0x34, 0x03, 0x7f, \
+  0x9b, 0x02, 0x11, 0x9a, 0x27, 0x3c, 0x91, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0xf1, 0x6b, 0x01, 0xd2, 0x0c, 0x3e, 0xfd, 0xfb, 0x7d, 0xc7, 0xa3, \
+  0x6c, 0x9a, 0x79, 0xcf, 0x3c, 0x6e, 0x0b, 0x8a, 0xf1, 0x6b, 0x01, 0xd2, 0x0c, 0x3e, 0xfd, 0xfb, \
+  0x7d, 0xc7, 0xa3, 0x6c, 0x9a, 0x79, 0xcf, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xd5, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0xd2, 0xdb, 0x01, 0x72, 0xa7, 0xb5, 0x60, 0x3e, 0x58, 0x43, 0x45, \
+  0xbf, 0xd7, 0xbd, 0x00, 0x72, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x31, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x73, 0x41, 0x72, 0x72, \
+  0x61, 0x79, 0x4b, 0x65, 0x79, 0x3a, 0x3a, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x6c, \
+  0x6f, 0x6e, 0x67, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x74, 0x79, 0x70, 0x65, 0x6b, 0x65, 0x79, \
+  0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x14, 0xf2, 0x22, 0x26, 0x46, 0xee, 0x48, 0xf5, 0x7a, 0xe8, 0x04, 0xd7, 0x80, 0x92, 0x34, 0xd4, \
+  0x04, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0xf2, 0x22, 0x26, 0x46, 0xee, 0x48, \
+  0xf5, 0x7a, 0xe8, 0x04, 0xd7, 0x80, 0x92, 0x34, 0xd4, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, \
+  0xf2, 0x30, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x54, 0x79, 0x70, 0x65, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x4b, 0x65, 0x79, 0x3a, 0x3a, 0x75, \
+  0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x6c, 0x6f, 0x6e, 0x67, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0xd2, 0xdb, 0x01, 0x72, 0xa7, 0xb5, 0x60, 0x3e, 0x58, 0x43, 0x45, 0xbf, 0xd7, 0xbd, 0xf1, \
+  0x8c, 0x24, 0x89, 0x80, 0x34, 0x03, 0x7f, 0x9b, 0x02, 0x11, 0x9a, 0x27, 0x3c, 0x91, 0xf2, 0x22, \
+  0x26, 0x46, 0xee, 0x48, 0xf5, 0x7a, 0xe8, 0x04, 0xd7, 0x80, 0x92, 0x34, 0xd4, 0xf1, 0x6b, 0x01, \
+  0xd2, 0x0c, 0x3e, 0xfd, 0xfb, 0x7d, 0xc7, 0xa3, 0x6c, 0x9a, 0x79, 0xcf\
+}
+#define TYPE_MAP_CDR_SZ_TypesArrayKey_unsignedlong_arraytypekey 412u
+const dds_topic_descriptor_t TypesArrayKey_unsignedlong_arraytypekey_desc =
+{
+  .m_size = sizeof (TypesArrayKey_unsignedlong_arraytypekey),
+  .m_align = dds_alignof (TypesArrayKey_unsignedlong_arraytypekey),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "TypesArrayKey::unsignedlong_arraytypekey",
+  .m_keys = TypesArrayKey_unsignedlong_arraytypekey_keys,
+  .m_nops = 2,
+  .m_ops = TypesArrayKey_unsignedlong_arraytypekey_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypesArrayKey_unsignedlong_arraytypekey, .sz = TYPE_INFO_CDR_SZ_TypesArrayKey_unsignedlong_arraytypekey },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypesArrayKey_unsignedlong_arraytypekey, .sz = TYPE_MAP_CDR_SZ_TypesArrayKey_unsignedlong_arraytypekey }
+};
+
+static const uint32_t TypesArrayKey_unsignedlonglong_arraytypekey_ops [] =
+{
+  /* unsignedlonglong_arraytypekey */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_8BY, offsetof (TypesArrayKey_unsignedlonglong_arraytypekey, key), 20u,
+  DDS_OP_RTS,
+  
+  /* key: key */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t TypesArrayKey_unsignedlonglong_arraytypekey_keys[1] =
+{
+  { "key", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL e924bf0de82daf143a28a9d7b870] (#deps: 1)
+   - [MINIMAL d8398b259af5a04792e296996c27]
+  [COMPLETE 203147bc94b4384e6ebd8adf5cad] (#deps: 1)
+   - [COMPLETE 5b0f6fc61f4839ded581cde53dbb]
+*/
+#define TYPE_INFO_CDR_TypesArrayKey_unsignedlonglong_arraytypekey (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xe9, 0x24, 0xbf, 0x0d, 0xe8, 0x2d, 0xaf, 0x14, 0x3a, 0x28, 0xa9, \
+  0xd7, 0xb8, 0x70, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xd8, 0x39, 0x8b, 0x25, 0x9a, 0xf5, 0xa0, \
+  0x47, 0x92, 0xe2, 0x96, 0x99, 0x6c, 0x27, 0x00, 0x13, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x20, 0x31, 0x47, \
+  0xbc, 0x94, 0xb4, 0x38, 0x4e, 0x6e, 0xbd, 0x8a, 0xdf, 0x5c, 0xad, 0x00, 0x7a, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x5b, 0x0f, 0x6f, 0xc6, 0x1f, 0x48, 0x39, 0xde, 0xd5, 0x81, 0xcd, 0xe5, 0x3d, 0xbb, 0x00, \
+  0x3d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypesArrayKey_unsignedlonglong_arraytypekey 148u
+#define TYPE_MAP_CDR_TypesArrayKey_unsignedlonglong_arraytypekey (unsigned char []){ \
+  0x77, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xe9, 0x24, 0xbf, 0x0d, 0xe8, 0x2d, 0xaf, \
+  0x14, 0x3a, 0x28, 0xa9, 0xd7, 0xb8, 0x70, 0x00, 0x3c, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf1, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0xf1, 0xd8, 0x39, 0x8b, 0x25, 0x9a, 0xf5, 0xa0, 0x47, 0x92, 0xe2, \
+  0x96, 0x99, 0x6c, 0x27, 0x3c, 0x6e, 0x0b, 0x8a, 0xf1, 0xd8, 0x39, 0x8b, 0x25, 0x9a, 0xf5, 0xa0, \
+  0x47, 0x92, 0xe2, 0x96, 0x99, 0x6c, 0x27, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf1, 0x30, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0xdd, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x20, 0x31, 0x47, 0xbc, 0x94, 0xb4, 0x38, 0x4e, 0x6e, 0xbd, 0x8a, \
+  0xdf, 0x5c, 0xad, 0x00, 0x76, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x35, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x73, 0x41, 0x72, 0x72, \
+  0x61, 0x79, 0x4b, 0x65, 0x79, 0x3a, 0x3a, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x6c, \
+  0x6f, 0x6e, 0x67, 0x6c, 0x6f, 0x6e, 0x67, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x74, 0x79, 0x70, \
+  0x65, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf2, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0xf2, 0x5b, 0x0f, 0x6f, 0xc6, 0x1f, 0x48, 0x39, 0xde, 0xd5, 0x81, \
+  0xcd, 0xe5, 0x3d, 0xbb, 0x04, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0xf2, 0x5b, \
+  0x0f, 0x6f, 0xc6, 0x1f, 0x48, 0x39, 0xde, 0xd5, 0x81, 0xcd, 0xe5, 0x3d, 0xbb, 0x00, 0x00, 0x00, \
+  0x39, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x4b, 0x65, \
+  0x79, 0x3a, 0x3a, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x6c, 0x6f, 0x6e, 0x67, 0x6c, \
+  0x6f, 0x6e, 0x67, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x20, 0x31, 0x47, 0xbc, 0x94, 0xb4, 0x38, \
+  0x4e, 0x6e, 0xbd, 0x8a, 0xdf, 0x5c, 0xad, 0xf1, 0xe9, 0x24, 0xbf, 0x0d, 0xe8, 0x2d, 0xaf, 0x14, \
+  0x3a, 0x28, 0xa9, 0xd7, 0xb8, 0x70, 0xf2, 0x5b, 0x0f, 0x6f, 0xc6, 0x1f, 0x48, 0x39, 0xde, 0xd5, \
+  0x81, 0xcd, 0xe5, 0x3d, 0xbb, 0xf1, 0xd8, 0x39, 0x8b, 0x25, 0x9a, 0xf5, 0xa0, 0x47, 0x92, 0xe2, \
+  0x96, 0x99, 0x6c, 0x27\
+}
+#define TYPE_MAP_CDR_SZ_TypesArrayKey_unsignedlonglong_arraytypekey 420u
+const dds_topic_descriptor_t TypesArrayKey_unsignedlonglong_arraytypekey_desc =
+{
+  .m_size = sizeof (TypesArrayKey_unsignedlonglong_arraytypekey),
+  .m_align = dds_alignof (TypesArrayKey_unsignedlonglong_arraytypekey),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "TypesArrayKey::unsignedlonglong_arraytypekey",
+  .m_keys = TypesArrayKey_unsignedlonglong_arraytypekey_keys,
+  .m_nops = 2,
+  .m_ops = TypesArrayKey_unsignedlonglong_arraytypekey_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypesArrayKey_unsignedlonglong_arraytypekey, .sz = TYPE_INFO_CDR_SZ_TypesArrayKey_unsignedlonglong_arraytypekey },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypesArrayKey_unsignedlonglong_arraytypekey, .sz = TYPE_MAP_CDR_SZ_TypesArrayKey_unsignedlonglong_arraytypekey }
+};
+
+static const uint32_t TypesArrayKey_float_arraytypekey_ops [] =
+{
+  /* float_arraytypekey */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY | DDS_OP_FLAG_FP, offsetof (TypesArrayKey_float_arraytypekey, key), 20u,
+  DDS_OP_RTS,
+  
+  /* key: key */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t TypesArrayKey_float_arraytypekey_keys[1] =
+{
+  { "key", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 46288785033e46e5f714afd02b9e] (#deps: 0)
+  [COMPLETE aaf5aa1d1a1c30ef56555b5ae1e1] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypesArrayKey_float_arraytypekey (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x46, 0x28, 0x87, 0x85, 0x03, 0x3e, 0x46, 0xe5, 0xf7, 0x14, 0xaf, \
+  0xd0, 0x2b, 0x9e, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xaa, 0xf5, 0xaa, 0x1d, 0x1a, 0x1c, 0x30, 0xef, 0x56, 0x55, 0x5b, \
+  0x5a, 0xe1, 0xe1, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypesArrayKey_float_arraytypekey 100u
+#define TYPE_MAP_CDR_TypesArrayKey_float_arraytypekey (unsigned char []){ \
+  0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x46, 0x28, 0x87, 0x85, 0x03, 0x3e, 0x46, \
+  0xe5, 0xf7, 0x14, 0xaf, 0xd0, 0x2b, 0x9e, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x09, 0x3c, 0x6e, 0x0b, 0x8a, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xaa, 0xf5, 0xaa, 0x1d, 0x1a, 0x1c, 0x30, 0xef, 0x56, 0x55, 0x5b, \
+  0x5a, 0xe1, 0xe1, 0x00, 0x5e, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x73, 0x41, 0x72, 0x72, \
+  0x61, 0x79, 0x4b, 0x65, 0x79, 0x3a, 0x3a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x5f, 0x61, 0x72, 0x72, \
+  0x61, 0x79, 0x74, 0x79, 0x70, 0x65, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x09, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xaa, 0xf5, 0xaa, 0x1d, 0x1a, 0x1c, 0x30, 0xef, 0x56, 0x55, 0x5b, 0x5a, 0xe1, 0xe1, 0xf1, \
+  0x46, 0x28, 0x87, 0x85, 0x03, 0x3e, 0x46, 0xe5, 0xf7, 0x14, 0xaf, 0xd0, 0x2b, 0x9e\
+}
+#define TYPE_MAP_CDR_SZ_TypesArrayKey_float_arraytypekey 238u
+const dds_topic_descriptor_t TypesArrayKey_float_arraytypekey_desc =
+{
+  .m_size = sizeof (TypesArrayKey_float_arraytypekey),
+  .m_align = dds_alignof (TypesArrayKey_float_arraytypekey),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "TypesArrayKey::float_arraytypekey",
+  .m_keys = TypesArrayKey_float_arraytypekey_keys,
+  .m_nops = 2,
+  .m_ops = TypesArrayKey_float_arraytypekey_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypesArrayKey_float_arraytypekey, .sz = TYPE_INFO_CDR_SZ_TypesArrayKey_float_arraytypekey },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypesArrayKey_float_arraytypekey, .sz = TYPE_MAP_CDR_SZ_TypesArrayKey_float_arraytypekey }
+};
+
+static const uint32_t TypesArrayKey_double_arraytypekey_ops [] =
+{
+  /* double_arraytypekey */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_8BY | DDS_OP_FLAG_FP, offsetof (TypesArrayKey_double_arraytypekey, key), 20u,
+  DDS_OP_RTS,
+  
+  /* key: key */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t TypesArrayKey_double_arraytypekey_keys[1] =
+{
+  { "key", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 7bf0d13649a0adc7d30d88ad070f] (#deps: 0)
+  [COMPLETE beae9a6ee17ac4b020456e1a1132] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypesArrayKey_double_arraytypekey (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x7b, 0xf0, 0xd1, 0x36, 0x49, 0xa0, 0xad, 0xc7, 0xd3, 0x0d, 0x88, \
+  0xad, 0x07, 0x0f, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xbe, 0xae, 0x9a, 0x6e, 0xe1, 0x7a, 0xc4, 0xb0, 0x20, 0x45, 0x6e, \
+  0x1a, 0x11, 0x32, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypesArrayKey_double_arraytypekey 100u
+#define TYPE_MAP_CDR_TypesArrayKey_double_arraytypekey (unsigned char []){ \
+  0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x7b, 0xf0, 0xd1, 0x36, 0x49, 0xa0, 0xad, \
+  0xc7, 0xd3, 0x0d, 0x88, 0xad, 0x07, 0x0f, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x0a, 0x3c, 0x6e, 0x0b, 0x8a, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xbe, 0xae, 0x9a, 0x6e, 0xe1, 0x7a, 0xc4, 0xb0, 0x20, 0x45, 0x6e, \
+  0x1a, 0x11, 0x32, 0x00, 0x5e, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x2b, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x73, 0x41, 0x72, 0x72, \
+  0x61, 0x79, 0x4b, 0x65, 0x79, 0x3a, 0x3a, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x5f, 0x61, 0x72, \
+  0x72, 0x61, 0x79, 0x74, 0x79, 0x70, 0x65, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x0a, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xbe, 0xae, 0x9a, 0x6e, 0xe1, 0x7a, 0xc4, 0xb0, 0x20, 0x45, 0x6e, 0x1a, 0x11, 0x32, 0xf1, \
+  0x7b, 0xf0, 0xd1, 0x36, 0x49, 0xa0, 0xad, 0xc7, 0xd3, 0x0d, 0x88, 0xad, 0x07, 0x0f\
+}
+#define TYPE_MAP_CDR_SZ_TypesArrayKey_double_arraytypekey 238u
+const dds_topic_descriptor_t TypesArrayKey_double_arraytypekey_desc =
+{
+  .m_size = sizeof (TypesArrayKey_double_arraytypekey),
+  .m_align = dds_alignof (TypesArrayKey_double_arraytypekey),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "TypesArrayKey::double_arraytypekey",
+  .m_keys = TypesArrayKey_double_arraytypekey_keys,
+  .m_nops = 2,
+  .m_ops = TypesArrayKey_double_arraytypekey_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypesArrayKey_double_arraytypekey, .sz = TYPE_INFO_CDR_SZ_TypesArrayKey_double_arraytypekey },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypesArrayKey_double_arraytypekey, .sz = TYPE_MAP_CDR_SZ_TypesArrayKey_double_arraytypekey }
+};
+
+static const uint32_t TypesArrayKey_char_arraytypekey_ops [] =
+{
+  /* char_arraytypekey */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypesArrayKey_char_arraytypekey, key), 128u,
+  DDS_OP_RTS,
+  
+  /* key: key */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t TypesArrayKey_char_arraytypekey_keys[1] =
+{
+  { "key", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 227ddd6bd1317e376ac06e30558b] (#deps: 0)
+  [COMPLETE 047b998bcbdf450b81faca365051] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypesArrayKey_char_arraytypekey (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x22, 0x7d, 0xdd, 0x6b, 0xd1, 0x31, 0x7e, 0x37, 0x6a, 0xc0, 0x6e, \
+  0x30, 0x55, 0x8b, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x04, 0x7b, 0x99, 0x8b, 0xcb, 0xdf, 0x45, 0x0b, 0x81, 0xfa, 0xca, \
+  0x36, 0x50, 0x51, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypesArrayKey_char_arraytypekey 100u
+#define TYPE_MAP_CDR_TypesArrayKey_char_arraytypekey (unsigned char []){ \
+  0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x22, 0x7d, 0xdd, 0x6b, 0xd1, 0x31, 0x7e, \
+  0x37, 0x6a, 0xc0, 0x6e, 0x30, 0x55, 0x8b, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x10, 0x3c, 0x6e, 0x0b, 0x8a, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x04, 0x7b, 0x99, 0x8b, 0xcb, 0xdf, 0x45, 0x0b, 0x81, 0xfa, 0xca, \
+  0x36, 0x50, 0x51, 0x00, 0x5e, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x29, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x73, 0x41, 0x72, 0x72, \
+  0x61, 0x79, 0x4b, 0x65, 0x79, 0x3a, 0x3a, 0x63, 0x68, 0x61, 0x72, 0x5f, 0x61, 0x72, 0x72, 0x61, \
+  0x79, 0x74, 0x79, 0x70, 0x65, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x10, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x04, 0x7b, 0x99, 0x8b, 0xcb, 0xdf, 0x45, 0x0b, 0x81, 0xfa, 0xca, 0x36, 0x50, 0x51, 0xf1, \
+  0x22, 0x7d, 0xdd, 0x6b, 0xd1, 0x31, 0x7e, 0x37, 0x6a, 0xc0, 0x6e, 0x30, 0x55, 0x8b\
+}
+#define TYPE_MAP_CDR_SZ_TypesArrayKey_char_arraytypekey 238u
+const dds_topic_descriptor_t TypesArrayKey_char_arraytypekey_desc =
+{
+  .m_size = sizeof (TypesArrayKey_char_arraytypekey),
+  .m_align = dds_alignof (TypesArrayKey_char_arraytypekey),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "TypesArrayKey::char_arraytypekey",
+  .m_keys = TypesArrayKey_char_arraytypekey_keys,
+  .m_nops = 2,
+  .m_ops = TypesArrayKey_char_arraytypekey_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypesArrayKey_char_arraytypekey, .sz = TYPE_INFO_CDR_SZ_TypesArrayKey_char_arraytypekey },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypesArrayKey_char_arraytypekey, .sz = TYPE_MAP_CDR_SZ_TypesArrayKey_char_arraytypekey }
+};
+
+static const uint32_t TypesArrayKey_boolean_arraytypekey_ops [] =
+{
+  /* boolean_arraytypekey */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_BLN, offsetof (TypesArrayKey_boolean_arraytypekey, key), 128u,
+  DDS_OP_RTS,
+  
+  /* key: key */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t TypesArrayKey_boolean_arraytypekey_keys[1] =
+{
+  { "key", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 41833948db7bd0659a5dabb7e67d] (#deps: 0)
+  [COMPLETE 6a6613b92955a6a007b2cd6e9e13] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypesArrayKey_boolean_arraytypekey (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x41, 0x83, 0x39, 0x48, 0xdb, 0x7b, 0xd0, 0x65, 0x9a, 0x5d, 0xab, \
+  0xb7, 0xe6, 0x7d, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x6a, 0x66, 0x13, 0xb9, 0x29, 0x55, 0xa6, 0xa0, 0x07, 0xb2, 0xcd, \
+  0x6e, 0x9e, 0x13, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypesArrayKey_boolean_arraytypekey 100u
+#define TYPE_MAP_CDR_TypesArrayKey_boolean_arraytypekey (unsigned char []){ \
+  0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x41, 0x83, 0x39, 0x48, 0xdb, 0x7b, 0xd0, \
+  0x65, 0x9a, 0x5d, 0xab, 0xb7, 0xe6, 0x7d, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x01, 0x3c, 0x6e, 0x0b, 0x8a, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x6a, 0x66, 0x13, 0xb9, 0x29, 0x55, 0xa6, 0xa0, 0x07, 0xb2, 0xcd, \
+  0x6e, 0x9e, 0x13, 0x00, 0x5e, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x2c, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x73, 0x41, 0x72, 0x72, \
+  0x61, 0x79, 0x4b, 0x65, 0x79, 0x3a, 0x3a, 0x62, 0x6f, 0x6f, 0x6c, 0x65, 0x61, 0x6e, 0x5f, 0x61, \
+  0x72, 0x72, 0x61, 0x79, 0x74, 0x79, 0x70, 0x65, 0x6b, 0x65, 0x79, 0x00, 0x26, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x6a, 0x66, 0x13, 0xb9, 0x29, 0x55, 0xa6, 0xa0, 0x07, 0xb2, 0xcd, 0x6e, 0x9e, 0x13, 0xf1, \
+  0x41, 0x83, 0x39, 0x48, 0xdb, 0x7b, 0xd0, 0x65, 0x9a, 0x5d, 0xab, 0xb7, 0xe6, 0x7d\
+}
+#define TYPE_MAP_CDR_SZ_TypesArrayKey_boolean_arraytypekey 238u
+const dds_topic_descriptor_t TypesArrayKey_boolean_arraytypekey_desc =
+{
+  .m_size = sizeof (TypesArrayKey_boolean_arraytypekey),
+  .m_align = dds_alignof (TypesArrayKey_boolean_arraytypekey),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "TypesArrayKey::boolean_arraytypekey",
+  .m_keys = TypesArrayKey_boolean_arraytypekey_keys,
+  .m_nops = 2,
+  .m_ops = TypesArrayKey_boolean_arraytypekey_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypesArrayKey_boolean_arraytypekey, .sz = TYPE_INFO_CDR_SZ_TypesArrayKey_boolean_arraytypekey },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypesArrayKey_boolean_arraytypekey, .sz = TYPE_MAP_CDR_SZ_TypesArrayKey_boolean_arraytypekey }
+};
+
+static const uint32_t TypesArrayKey_octet_arraytypekey_ops [] =
+{
+  /* octet_arraytypekey */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY, offsetof (TypesArrayKey_octet_arraytypekey, key), 128u,
+  DDS_OP_RTS,
+  
+  /* key: key */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t TypesArrayKey_octet_arraytypekey_keys[1] =
+{
+  { "key", 4, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 6946dfaede41674459d71c28a9af] (#deps: 0)
+  [COMPLETE 3b729c7f325db5d46c66da00fdd7] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypesArrayKey_octet_arraytypekey (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x69, 0x46, 0xdf, 0xae, 0xde, 0x41, 0x67, 0x44, 0x59, 0xd7, 0x1c, \
+  0x28, 0xa9, 0xaf, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x72, 0x9c, 0x7f, 0x32, 0x5d, 0xb5, 0xd4, 0x6c, 0x66, 0xda, \
+  0x00, 0xfd, 0xd7, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypesArrayKey_octet_arraytypekey 100u
+#define TYPE_MAP_CDR_TypesArrayKey_octet_arraytypekey (unsigned char []){ \
+  0x46, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x69, 0x46, 0xdf, 0xae, 0xde, 0x41, 0x67, \
+  0x44, 0x59, 0xd7, 0x1c, 0x28, 0xa9, 0xaf, 0x00, 0x2e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x80, 0x02, 0x3c, 0x6e, 0x0b, 0x8a, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x72, 0x9c, 0x7f, 0x32, 0x5d, 0xb5, 0xd4, 0x6c, 0x66, 0xda, \
+  0x00, 0xfd, 0xd7, 0x00, 0x5e, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, 0x73, 0x41, 0x72, 0x72, \
+  0x61, 0x79, 0x4b, 0x65, 0x79, 0x3a, 0x3a, 0x6f, 0x63, 0x74, 0x65, 0x74, 0x5f, 0x61, 0x72, 0x72, \
+  0x61, 0x79, 0x74, 0x79, 0x70, 0x65, 0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x6b, 0x65, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x3b, 0x72, 0x9c, 0x7f, 0x32, 0x5d, 0xb5, 0xd4, 0x6c, 0x66, 0xda, 0x00, 0xfd, 0xd7, 0xf1, \
+  0x69, 0x46, 0xdf, 0xae, 0xde, 0x41, 0x67, 0x44, 0x59, 0xd7, 0x1c, 0x28, 0xa9, 0xaf\
+}
+#define TYPE_MAP_CDR_SZ_TypesArrayKey_octet_arraytypekey 238u
+const dds_topic_descriptor_t TypesArrayKey_octet_arraytypekey_desc =
+{
+  .m_size = sizeof (TypesArrayKey_octet_arraytypekey),
+  .m_align = dds_alignof (TypesArrayKey_octet_arraytypekey),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "TypesArrayKey::octet_arraytypekey",
+  .m_keys = TypesArrayKey_octet_arraytypekey_keys,
+  .m_nops = 2,
+  .m_ops = TypesArrayKey_octet_arraytypekey_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypesArrayKey_octet_arraytypekey, .sz = TYPE_INFO_CDR_SZ_TypesArrayKey_octet_arraytypekey },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypesArrayKey_octet_arraytypekey, .sz = TYPE_MAP_CDR_SZ_TypesArrayKey_octet_arraytypekey }
+};
+
+static const uint32_t TypesArrayKey_alltypeskey_ops [] =
+{
+  /* alltypeskey */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (TypesArrayKey_alltypeskey, l),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (TypesArrayKey_alltypeskey, ll),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_2BY, offsetof (TypesArrayKey_alltypeskey, us),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (TypesArrayKey_alltypeskey, ul),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY, offsetof (TypesArrayKey_alltypeskey, ull),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_FP, offsetof (TypesArrayKey_alltypeskey, f),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (TypesArrayKey_alltypeskey, d),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY | DDS_OP_FLAG_SGN, offsetof (TypesArrayKey_alltypeskey, c),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_BLN, offsetof (TypesArrayKey_alltypeskey, b),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_1BY, offsetof (TypesArrayKey_alltypeskey, o),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_STR, offsetof (TypesArrayKey_alltypeskey, s),
+  DDS_OP_RTS,
+  
+  /* key: l */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: ll */
+  DDS_OP_KOF | 1, 2u /* order: 1 */,
+  
+  /* key: us */
+  DDS_OP_KOF | 1, 4u /* order: 2 */,
+  
+  /* key: ul */
+  DDS_OP_KOF | 1, 6u /* order: 3 */,
+  
+  /* key: ull */
+  DDS_OP_KOF | 1, 8u /* order: 4 */,
+  
+  /* key: f */
+  DDS_OP_KOF | 1, 10u /* order: 5 */,
+  
+  /* key: d */
+  DDS_OP_KOF | 1, 12u /* order: 6 */,
+  
+  /* key: c */
+  DDS_OP_KOF | 1, 14u /* order: 7 */,
+  
+  /* key: b */
+  DDS_OP_KOF | 1, 16u /* order: 8 */,
+  
+  /* key: o */
+  DDS_OP_KOF | 1, 18u /* order: 9 */,
+  
+  /* key: s */
+  DDS_OP_KOF | 1, 20u /* order: 10 */
+};
+
+static const dds_key_descriptor_t TypesArrayKey_alltypeskey_keys[11] =
+{
+  { "l", 23, 0 },
+  { "ll", 25, 1 },
+  { "us", 27, 2 },
+  { "ul", 29, 3 },
+  { "ull", 31, 4 },
+  { "f", 33, 5 },
+  { "d", 35, 6 },
+  { "c", 37, 7 },
+  { "b", 39, 8 },
+  { "o", 41, 9 },
+  { "s", 43, 10 }
+};
+
+/* Type Information:
+  [MINIMAL 34fbb24c5bd7be89af673f379adf] (#deps: 0)
+  [COMPLETE 873f64a8f2252a0d57add0d2b499] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_TypesArrayKey_alltypeskey (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x34, 0xfb, 0xb2, 0x4c, 0x5b, 0xd7, 0xbe, 0x89, 0xaf, 0x67, 0x3f, \
+  0x37, 0x9a, 0xdf, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x87, 0x3f, 0x64, 0xa8, 0xf2, 0x25, 0x2a, 0x0d, 0x57, 0xad, 0xd0, \
+  0xd2, 0xb4, 0x99, 0x00, 0x24, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_TypesArrayKey_alltypeskey 100u
+#define TYPE_MAP_CDR_TypesArrayKey_alltypeskey (unsigned char []){ \
+  0xdc, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x34, 0xfb, 0xb2, 0x4c, 0x5b, 0xd7, 0xbe, \
+  0x89, 0xaf, 0x67, 0x3f, 0x37, 0x9a, 0xdf, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x2d, 0xb9, 0x5e, 0x8e, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x5b, 0x54, 0xc0, 0xa0, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x06, 0x0b, 0x3b, 0x97, 0xfa, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x73, 0x8a, 0x65, 0x6e, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0xd9, 0x98, 0x63, 0x94, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x31, 0x00, 0x09, 0x8f, 0xa1, 0x4c, 0xdd, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x31, 0x00, 0x0a, 0x82, 0x77, 0xe0, 0x91, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x4a, 0x8a, 0x08, 0xf0, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x00, 0x01, 0x92, 0xeb, 0x5f, 0xfe, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x31, 0x00, 0x02, 0xd9, 0x56, 0x79, 0x75, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0x03, 0xc7, 0xc0, 0xac, \
+  0x38, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x87, 0x3f, 0x64, 0xa8, 0xf2, 0x25, 0x2a, \
+  0x0d, 0x57, 0xad, 0xd0, 0xd2, 0xb4, 0x99, 0x00, 0x20, 0x01, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x54, 0x79, 0x70, 0x65, \
+  0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x4b, 0x65, 0x79, 0x3a, 0x3a, 0x61, 0x6c, 0x6c, 0x74, 0x79, \
+  0x70, 0x65, 0x73, 0x6b, 0x65, 0x79, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x6c, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x05, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x31, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x75, 0x73, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x75, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x31, 0x00, 0x08, 0x00, 0x04, 0x00, 0x00, 0x00, 0x75, 0x6c, 0x6c, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x31, 0x00, 0x09, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x31, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x31, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x62, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x31, 0x00, 0x02, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x70, 0x00, 0x02, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x87, 0x3f, 0x64, 0xa8, 0xf2, 0x25, 0x2a, 0x0d, 0x57, 0xad, 0xd0, \
+  0xd2, 0xb4, 0x99, 0xf1, 0x34, 0xfb, 0xb2, 0x4c, 0x5b, 0xd7, 0xbe, 0x89, 0xaf, 0x67, 0x3f, 0x37, \
+  0x9a, 0xdf\
+}
+#define TYPE_MAP_CDR_SZ_TypesArrayKey_alltypeskey 578u
+const dds_topic_descriptor_t TypesArrayKey_alltypeskey_desc =
+{
+  .m_size = sizeof (TypesArrayKey_alltypeskey),
+  .m_align = dds_alignof (TypesArrayKey_alltypeskey),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 11u,
+  .m_typename = "TypesArrayKey::alltypeskey",
+  .m_keys = TypesArrayKey_alltypeskey_keys,
+  .m_nops = 12,
+  .m_ops = TypesArrayKey_alltypeskey_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_TypesArrayKey_alltypeskey, .sz = TYPE_INFO_CDR_SZ_TypesArrayKey_alltypeskey },
+  .type_mapping = { .data = TYPE_MAP_CDR_TypesArrayKey_alltypeskey, .sz = TYPE_MAP_CDR_SZ_TypesArrayKey_alltypeskey }
+};
+
@@ -0,0 +1,266 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_debug_build/src/core/ddsc/tests/WriteTypes.c
+  Source: /root/repo/src/core/ddsc/tests/WriteTypes.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "WriteTypes.h"
+
+static const uint32_t WriteTypes_a_ops [] =
+{
+  /* a */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY, offsetof (WriteTypes_a, k), 3u,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY, offsetof (WriteTypes_a, ll),
+  DDS_OP_RTS,
+  
+  /* key: k */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t WriteTypes_a_keys[1] =
+{
+  { "k", 6, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 6f09502dfd32bd48fe2f58da5a0e] (#deps: 0)
+  [COMPLETE d60965846f034c1ff8bf9d079a24] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_WriteTypes_a (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x6f, 0x09, 0x50, 0x2d, 0xfd, 0x32, 0xbd, 0x48, 0xfe, 0x2f, 0x58, \
+  0xda, 0x5a, 0x0e, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xd6, 0x09, 0x65, 0x84, 0x6f, 0x03, 0x4c, 0x1f, 0xf8, 0xbf, 0x9d, \
+  0x07, 0x9a, 0x24, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_WriteTypes_a 100u
+#define TYPE_MAP_CDR_WriteTypes_a (unsigned char []){ \
+  0x57, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x6f, 0x09, 0x50, 0x2d, 0xfd, 0x32, 0xbd, \
+  0x48, 0xfe, 0x2f, 0x58, 0xda, 0x5a, 0x0e, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x02, 0x8c, 0xe4, 0xb1, 0x6b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x5b, 0x54, 0xc0, 0xa0, 0x00, 0x75, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xd6, 0x09, 0x65, 0x84, 0x6f, 0x03, 0x4c, 0x1f, 0xf8, 0xbf, 0x9d, \
+  0x07, 0x9a, 0x24, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x57, 0x72, 0x69, 0x74, 0x65, 0x54, 0x79, 0x70, \
+  0x65, 0x73, 0x3a, 0x3a, 0x61, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xd6, 0x09, 0x65, 0x84, 0x6f, 0x03, 0x4c, 0x1f, 0xf8, 0xbf, 0x9d, 0x07, 0x9a, 0x24, 0xf1, \
+  0x6f, 0x09, 0x50, 0x2d, 0xfd, 0x32, 0xbd, 0x48, 0xfe, 0x2f, 0x58, 0xda, 0x5a, 0x0e\
+}
+#define TYPE_MAP_CDR_SZ_WriteTypes_a 254u
+const dds_topic_descriptor_t WriteTypes_a_desc =
+{
+  .m_size = sizeof (WriteTypes_a),
+  .m_align = dds_alignof (WriteTypes_a),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "WriteTypes::a",
+  .m_keys = WriteTypes_a_keys,
+  .m_nops = 3,
+  .m_ops = WriteTypes_a_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_WriteTypes_a, .sz = TYPE_INFO_CDR_SZ_WriteTypes_a },
+  .type_mapping = { .data = TYPE_MAP_CDR_WriteTypes_a, .sz = TYPE_MAP_CDR_SZ_WriteTypes_a }
+};
+
+static const uint32_t WriteTypes_b_ops [] =
+{
+  /* b */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_2BY, offsetof (WriteTypes_b, k), 3u,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY, offsetof (WriteTypes_b, ll),
+  DDS_OP_RTS,
+  
+  /* key: k */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t WriteTypes_b_keys[1] =
+{
+  { "k", 6, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 10526d498b67efdf3d4d6cdc7175] (#deps: 0)
+  [COMPLETE e3b2ab86085f33b8f49c391f6dda] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_WriteTypes_b (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x10, 0x52, 0x6d, 0x49, 0x8b, 0x67, 0xef, 0xdf, 0x3d, 0x4d, 0x6c, \
+  0xdc, 0x71, 0x75, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xe3, 0xb2, 0xab, 0x86, 0x08, 0x5f, 0x33, 0xb8, 0xf4, 0x9c, 0x39, \
+  0x1f, 0x6d, 0xda, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_WriteTypes_b 100u
+#define TYPE_MAP_CDR_WriteTypes_b (unsigned char []){ \
+  0x57, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x10, 0x52, 0x6d, 0x49, 0x8b, 0x67, 0xef, \
+  0xdf, 0x3d, 0x4d, 0x6c, 0xdc, 0x71, 0x75, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x06, 0x8c, 0xe4, 0xb1, 0x6b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x5b, 0x54, 0xc0, 0xa0, 0x00, 0x75, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xe3, 0xb2, 0xab, 0x86, 0x08, 0x5f, 0x33, 0xb8, 0xf4, 0x9c, 0x39, \
+  0x1f, 0x6d, 0xda, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x57, 0x72, 0x69, 0x74, 0x65, 0x54, 0x79, 0x70, \
+  0x65, 0x73, 0x3a, 0x3a, 0x62, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x06, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xe3, 0xb2, 0xab, 0x86, 0x08, 0x5f, 0x33, 0xb8, 0xf4, 0x9c, 0x39, 0x1f, 0x6d, 0xda, 0xf1, \
+  0x10, 0x52, 0x6d, 0x49, 0x8b, 0x67, 0xef, 0xdf, 0x3d, 0x4d, 0x6c, 0xdc, 0x71, 0x75\
+}
+#define TYPE_MAP_CDR_SZ_WriteTypes_b 254u
+const dds_topic_descriptor_t WriteTypes_b_desc =
+{
+  .m_size = sizeof (WriteTypes_b),
+  .m_align = dds_alignof (WriteTypes_b),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "WriteTypes::b",
+  .m_keys = WriteTypes_b_keys,
+  .m_nops = 3,
+  .m_ops = WriteTypes_b_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_WriteTypes_b, .sz = TYPE_INFO_CDR_SZ_WriteTypes_b },
+  .type_mapping = { .data = TYPE_MAP_CDR_WriteTypes_b, .sz = TYPE_MAP_CDR_SZ_WriteTypes_b }
+};
+
+static const uint32_t WriteTypes_c_ops [] =
+{
+  /* c */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_4BY, offsetof (WriteTypes_c, k), 3u,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY, offsetof (WriteTypes_c, ll),
+  DDS_OP_RTS,
+  
+  /* key: k */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t WriteTypes_c_keys[1] =
+{
+  { "k", 6, 0 }
+};
+
+/* Type Information:
+  [MINIMAL ba780f0edc9d41c151cea71fe1ee] (#deps: 0)
+  [COMPLETE 0512d8d168c3c177a1db0c33a1ae] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_WriteTypes_c (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xba, 0x78, 0x0f, 0x0e, 0xdc, 0x9d, 0x41, 0xc1, 0x51, 0xce, 0xa7, \
+  0x1f, 0xe1, 0xee, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x05, 0x12, 0xd8, 0xd1, 0x68, 0xc3, 0xc1, 0x77, 0xa1, 0xdb, 0x0c, \
+  0x33, 0xa1, 0xae, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_WriteTypes_c 100u
+#define TYPE_MAP_CDR_WriteTypes_c (unsigned char []){ \
+  0x57, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xba, 0x78, 0x0f, 0x0e, 0xdc, 0x9d, 0x41, \
+  0xc1, 0x51, 0xce, 0xa7, 0x1f, 0xe1, 0xee, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x07, 0x8c, 0xe4, 0xb1, 0x6b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x5b, 0x54, 0xc0, 0xa0, 0x00, 0x75, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x05, 0x12, 0xd8, 0xd1, 0x68, 0xc3, 0xc1, 0x77, 0xa1, 0xdb, 0x0c, \
+  0x33, 0xa1, 0xae, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x57, 0x72, 0x69, 0x74, 0x65, 0x54, 0x79, 0x70, \
+  0x65, 0x73, 0x3a, 0x3a, 0x63, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x07, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x05, 0x12, 0xd8, 0xd1, 0x68, 0xc3, 0xc1, 0x77, 0xa1, 0xdb, 0x0c, 0x33, 0xa1, 0xae, 0xf1, \
+  0xba, 0x78, 0x0f, 0x0e, 0xdc, 0x9d, 0x41, 0xc1, 0x51, 0xce, 0xa7, 0x1f, 0xe1, 0xee\
+}
+#define TYPE_MAP_CDR_SZ_WriteTypes_c 254u
+const dds_topic_descriptor_t WriteTypes_c_desc =
+{
+  .m_size = sizeof (WriteTypes_c),
+  .m_align = dds_alignof (WriteTypes_c),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "WriteTypes::c",
+  .m_keys = WriteTypes_c_keys,
+  .m_nops = 3,
+  .m_ops = WriteTypes_c_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_WriteTypes_c, .sz = TYPE_INFO_CDR_SZ_WriteTypes_c },
+  .type_mapping = { .data = TYPE_MAP_CDR_WriteTypes_c, .sz = TYPE_MAP_CDR_SZ_WriteTypes_c }
+};
+
+static const uint32_t WriteTypes_d_ops [] =
+{
+  /* d */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_8BY, offsetof (WriteTypes_d, k), 3u,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY, offsetof (WriteTypes_d, ll),
+  DDS_OP_RTS,
+  
+  /* key: k */
+  DDS_OP_KOF | 1, 0u /* order: 0 */
+};
+
+static const dds_key_descriptor_t WriteTypes_d_keys[1] =
+{
+  { "k", 6, 0 }
+};
+
+/* Type Information:
+  [MINIMAL b26c42f8b270f81400ed2a8d5361] (#deps: 0)
+  [COMPLETE 17254fa3868878be09fcc717c658] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_WriteTypes_d (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xb2, 0x6c, 0x42, 0xf8, 0xb2, 0x70, 0xf8, 0x14, 0x00, 0xed, 0x2a, \
+  0x8d, 0x53, 0x61, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x17, 0x25, 0x4f, 0xa3, 0x86, 0x88, 0x78, 0xbe, 0x09, 0xfc, 0xc7, \
+  0x17, 0xc6, 0x58, 0x00, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_WriteTypes_d 100u
+#define TYPE_MAP_CDR_WriteTypes_d (unsigned char []){ \
+  0x57, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xb2, 0x6c, 0x42, 0xf8, 0xb2, 0x70, 0xf8, \
+  0x14, 0x00, 0xed, 0x2a, 0x8d, 0x53, 0x61, 0x00, 0x3f, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x08, 0x8c, 0xe4, 0xb1, 0x6b, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x5b, 0x54, 0xc0, 0xa0, 0x00, 0x75, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x17, 0x25, 0x4f, 0xa3, 0x86, 0x88, 0x78, 0xbe, 0x09, 0xfc, 0xc7, \
+  0x17, 0xc6, 0x58, 0x00, 0x5d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x57, 0x72, 0x69, 0x74, 0x65, 0x54, 0x79, 0x70, \
+  0x65, 0x73, 0x3a, 0x3a, 0x64, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x03, 0x08, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x6c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x17, 0x25, 0x4f, 0xa3, 0x86, 0x88, 0x78, 0xbe, 0x09, 0xfc, 0xc7, 0x17, 0xc6, 0x58, 0xf1, \
+  0xb2, 0x6c, 0x42, 0xf8, 0xb2, 0x70, 0xf8, 0x14, 0x00, 0xed, 0x2a, 0x8d, 0x53, 0x61\
+}
+#define TYPE_MAP_CDR_SZ_WriteTypes_d 254u
+const dds_topic_descriptor_t WriteTypes_d_desc =
+{
+  .m_size = sizeof (WriteTypes_d),
+  .m_align = dds_alignof (WriteTypes_d),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "WriteTypes::d",
+  .m_keys = WriteTypes_d_keys,
+  .m_nops = 3,
+  .m_ops = WriteTypes_d_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_WriteTypes_d, .sz = TYPE_INFO_CDR_SZ_WriteTypes_d },
+  .type_mapping = { .data = TYPE_MAP_CDR_WriteTypes_d, .sz = TYPE_MAP_CDR_SZ_WriteTypes_d }
+};
+
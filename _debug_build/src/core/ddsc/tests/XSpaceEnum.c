@@ -0,0 +1,922 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_debug_build/src/core/ddsc/tests/XSpaceEnum.c
+  Source: /root/repo/src/core/ddsc/tests/XSpaceEnum.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "XSpaceEnum.h"
+
+static const uint32_t XSpaceEnum_rd1_ops [] =
+{
+  /* rd1 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnum_rd1, f1), 2u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 5b8bbdc2a69f007e4e4f0ea51154] (#deps: 1)
+   - [MINIMAL a188737d0746fbf0905eb9a7f36d]
+  [COMPLETE 52fe02e20ad1339d126226cd52e8] (#deps: 1)
+   - [COMPLETE f6a9a5752a35d329e5869888dba2]
+*/
+#define TYPE_INFO_CDR_XSpaceEnum_rd1 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x5b, 0x8b, 0xbd, 0xc2, 0xa6, 0x9f, 0x00, 0x7e, 0x4e, 0x4f, 0x0e, \
+  0xa5, 0x11, 0x54, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xa1, 0x88, 0x73, 0x7d, 0x07, 0x46, 0xfb, \
+  0xf0, 0x90, 0x5e, 0xb9, 0xa7, 0xf3, 0x6d, 0x00, 0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x52, 0xfe, 0x02, \
+  0xe2, 0x0a, 0xd1, 0x33, 0x9d, 0x12, 0x62, 0x26, 0xcd, 0x52, 0xe8, 0x00, 0x51, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xf6, 0xa9, 0xa5, 0x75, 0x2a, 0x35, 0xd3, 0x29, 0xe5, 0x86, 0x98, 0x88, 0xdb, 0xa2, 0x00, \
+  0x81, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnum_rd1 148u
+#define TYPE_MAP_CDR_XSpaceEnum_rd1 (unsigned char []){ \
+  0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x5b, 0x8b, 0xbd, 0xc2, 0xa6, 0x9f, 0x00, \
+  0x7e, 0x4e, 0x4f, 0x0e, 0xa5, 0x11, 0x54, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xa1, 0x88, 0x73, 0x7d, 0x07, \
+  0x46, 0xfb, 0xf0, 0x90, 0x5e, 0xb9, 0xa7, 0xf3, 0x6d, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xa1, 0x88, \
+  0x73, 0x7d, 0x07, 0x46, 0xfb, 0xf0, 0x90, 0x5e, 0xb9, 0xa7, 0xf3, 0x6d, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0xe1, 0xdf, 0xfc, 0x87, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5c, 0x36, 0x84, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x6b, 0xf4, 0xb5, 0x00, 0x00, \
+  0xf5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x52, 0xfe, 0x02, 0xe2, 0x0a, 0xd1, 0x33, \
+  0x9d, 0x12, 0x62, 0x26, 0xcd, 0x52, 0xe8, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x72, 0x64, 0x31, 0x00, 0x29, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xf6, \
+  0xa9, 0xa5, 0x75, 0x2a, 0x35, 0xd3, 0x29, 0xe5, 0x86, 0x98, 0x88, 0xdb, 0xa2, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xf6, 0xa9, 0xa5, 0x75, 0x2a, 0x35, \
+  0xd3, 0x29, 0xe5, 0x86, 0x98, 0x88, 0xdb, 0xa2, 0x7d, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, \
+  0x1b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x66, 0x00, 0x00, \
+  0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x46, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x52, 0xfe, 0x02, 0xe2, 0x0a, 0xd1, 0x33, 0x9d, 0x12, 0x62, 0x26, \
+  0xcd, 0x52, 0xe8, 0xf1, 0x5b, 0x8b, 0xbd, 0xc2, 0xa6, 0x9f, 0x00, 0x7e, 0x4e, 0x4f, 0x0e, 0xa5, \
+  0x11, 0x54, 0xf2, 0xf6, 0xa9, 0xa5, 0x75, 0x2a, 0x35, 0xd3, 0x29, 0xe5, 0x86, 0x98, 0x88, 0xdb, \
+  0xa2, 0xf1, 0xa1, 0x88, 0x73, 0x7d, 0x07, 0x46, 0xfb, 0xf0, 0x90, 0x5e, 0xb9, 0xa7, 0xf3, 0x6d\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnum_rd1 496u
+const dds_topic_descriptor_t XSpaceEnum_rd1_desc =
+{
+  .m_size = sizeof (XSpaceEnum_rd1),
+  .m_align = dds_alignof (XSpaceEnum_rd1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnum::rd1",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnum_rd1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnum_rd1, .sz = TYPE_INFO_CDR_SZ_XSpaceEnum_rd1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnum_rd1, .sz = TYPE_MAP_CDR_SZ_XSpaceEnum_rd1 }
+};
+
+static const uint32_t XSpaceEnum_wr1_1_ops [] =
+{
+  /* wr1_1 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnum_wr1_1, f1), 2u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 5b8bbdc2a69f007e4e4f0ea51154] (#deps: 1)
+   - [MINIMAL a188737d0746fbf0905eb9a7f36d]
+  [COMPLETE ca9a34fa969d5b99200ba5df19af] (#deps: 1)
+   - [COMPLETE f6a9a5752a35d329e5869888dba2]
+*/
+#define TYPE_INFO_CDR_XSpaceEnum_wr1_1 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x5b, 0x8b, 0xbd, 0xc2, 0xa6, 0x9f, 0x00, 0x7e, 0x4e, 0x4f, 0x0e, \
+  0xa5, 0x11, 0x54, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xa1, 0x88, 0x73, 0x7d, 0x07, 0x46, 0xfb, \
+  0xf0, 0x90, 0x5e, 0xb9, 0xa7, 0xf3, 0x6d, 0x00, 0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xca, 0x9a, 0x34, \
+  0xfa, 0x96, 0x9d, 0x5b, 0x99, 0x20, 0x0b, 0xa5, 0xdf, 0x19, 0xaf, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xf6, 0xa9, 0xa5, 0x75, 0x2a, 0x35, 0xd3, 0x29, 0xe5, 0x86, 0x98, 0x88, 0xdb, 0xa2, 0x00, \
+  0x81, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnum_wr1_1 148u
+#define TYPE_MAP_CDR_XSpaceEnum_wr1_1 (unsigned char []){ \
+  0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x5b, 0x8b, 0xbd, 0xc2, 0xa6, 0x9f, 0x00, \
+  0x7e, 0x4e, 0x4f, 0x0e, 0xa5, 0x11, 0x54, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xa1, 0x88, 0x73, 0x7d, 0x07, \
+  0x46, 0xfb, 0xf0, 0x90, 0x5e, 0xb9, 0xa7, 0xf3, 0x6d, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xa1, 0x88, \
+  0x73, 0x7d, 0x07, 0x46, 0xfb, 0xf0, 0x90, 0x5e, 0xb9, 0xa7, 0xf3, 0x6d, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0xe1, 0xdf, 0xfc, 0x87, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5c, 0x36, 0x84, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x6b, 0xf4, 0xb5, 0x00, 0x00, \
+  0xf9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xca, 0x9a, 0x34, 0xfa, 0x96, 0x9d, 0x5b, \
+  0x99, 0x20, 0x0b, 0xa5, 0xdf, 0x19, 0xaf, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x77, 0x72, 0x31, 0x5f, 0x31, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xf6, 0xa9, 0xa5, 0x75, 0x2a, 0x35, 0xd3, 0x29, 0xe5, 0x86, 0x98, 0x88, 0xdb, \
+  0xa2, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xf6, 0xa9, \
+  0xa5, 0x75, 0x2a, 0x35, 0xd3, 0x29, 0xe5, 0x86, 0x98, 0x88, 0xdb, 0xa2, 0x7d, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, \
+  0x5f, 0x66, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x46, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xca, 0x9a, 0x34, 0xfa, 0x96, 0x9d, 0x5b, \
+  0x99, 0x20, 0x0b, 0xa5, 0xdf, 0x19, 0xaf, 0xf1, 0x5b, 0x8b, 0xbd, 0xc2, 0xa6, 0x9f, 0x00, 0x7e, \
+  0x4e, 0x4f, 0x0e, 0xa5, 0x11, 0x54, 0xf2, 0xf6, 0xa9, 0xa5, 0x75, 0x2a, 0x35, 0xd3, 0x29, 0xe5, \
+  0x86, 0x98, 0x88, 0xdb, 0xa2, 0xf1, 0xa1, 0x88, 0x73, 0x7d, 0x07, 0x46, 0xfb, 0xf0, 0x90, 0x5e, \
+  0xb9, 0xa7, 0xf3, 0x6d\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnum_wr1_1 500u
+const dds_topic_descriptor_t XSpaceEnum_wr1_1_desc =
+{
+  .m_size = sizeof (XSpaceEnum_wr1_1),
+  .m_align = dds_alignof (XSpaceEnum_wr1_1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnum::wr1_1",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnum_wr1_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnum_wr1_1, .sz = TYPE_INFO_CDR_SZ_XSpaceEnum_wr1_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnum_wr1_1, .sz = TYPE_MAP_CDR_SZ_XSpaceEnum_wr1_1 }
+};
+
+static const uint32_t XSpaceEnum_wr1_2_ops [] =
+{
+  /* wr1_2 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnum_wr1_2, f1), 2u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 8db5e098fffd8310c26e73003291] (#deps: 1)
+   - [MINIMAL 02463ec0e12e43bec29ee63bb7d0]
+  [COMPLETE c5d5e3812b3ad05f6d878039e34e] (#deps: 1)
+   - [COMPLETE 5c09c4786525afff3f1bb96a9013]
+*/
+#define TYPE_INFO_CDR_XSpaceEnum_wr1_2 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8d, 0xb5, 0xe0, 0x98, 0xff, 0xfd, 0x83, 0x10, 0xc2, 0x6e, 0x73, \
+  0x00, 0x32, 0x91, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x02, 0x46, 0x3e, 0xc0, 0xe1, 0x2e, 0x43, \
+  0xbe, 0xc2, 0x9e, 0xe6, 0x3b, 0xb7, 0xd0, 0x00, 0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xc5, 0xd5, 0xe3, \
+  0x81, 0x2b, 0x3a, 0xd0, 0x5f, 0x6d, 0x87, 0x80, 0x39, 0xe3, 0x4e, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x5c, 0x09, 0xc4, 0x78, 0x65, 0x25, 0xaf, 0xff, 0x3f, 0x1b, 0xb9, 0x6a, 0x90, 0x13, 0x00, \
+  0x81, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnum_wr1_2 148u
+#define TYPE_MAP_CDR_XSpaceEnum_wr1_2 (unsigned char []){ \
+  0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x8d, 0xb5, 0xe0, 0x98, 0xff, 0xfd, 0x83, \
+  0x10, 0xc2, 0x6e, 0x73, 0x00, 0x32, 0x91, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x02, 0x46, 0x3e, 0xc0, 0xe1, \
+  0x2e, 0x43, 0xbe, 0xc2, 0x9e, 0xe6, 0x3b, 0xb7, 0xd0, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x02, 0x46, \
+  0x3e, 0xc0, 0xe1, 0x2e, 0x43, 0xbe, 0xc2, 0x9e, 0xe6, 0x3b, 0xb7, 0xd0, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x27, 0xf2, 0x37, 0xe6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbd, 0xf6, 0xf6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x93, 0xd7, 0xb1, 0x00, 0x00, \
+  0xf9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xc5, 0xd5, 0xe3, 0x81, 0x2b, 0x3a, 0xd0, \
+  0x5f, 0x6d, 0x87, 0x80, 0x39, 0xe3, 0x4e, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x77, 0x72, 0x31, 0x5f, 0x32, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x5c, 0x09, 0xc4, 0x78, 0x65, 0x25, 0xaf, 0xff, 0x3f, 0x1b, 0xb9, 0x6a, 0x90, \
+  0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x5c, 0x09, \
+  0xc4, 0x78, 0x65, 0x25, 0xaf, 0xff, 0x3f, 0x1b, 0xb9, 0x6a, 0x90, 0x13, 0x7d, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x02, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, \
+  0x5f, 0x61, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x41, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xc5, 0xd5, 0xe3, 0x81, 0x2b, 0x3a, 0xd0, \
+  0x5f, 0x6d, 0x87, 0x80, 0x39, 0xe3, 0x4e, 0xf1, 0x8d, 0xb5, 0xe0, 0x98, 0xff, 0xfd, 0x83, 0x10, \
+  0xc2, 0x6e, 0x73, 0x00, 0x32, 0x91, 0xf2, 0x5c, 0x09, 0xc4, 0x78, 0x65, 0x25, 0xaf, 0xff, 0x3f, \
+  0x1b, 0xb9, 0x6a, 0x90, 0x13, 0xf1, 0x02, 0x46, 0x3e, 0xc0, 0xe1, 0x2e, 0x43, 0xbe, 0xc2, 0x9e, \
+  0xe6, 0x3b, 0xb7, 0xd0\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnum_wr1_2 500u
+const dds_topic_descriptor_t XSpaceEnum_wr1_2_desc =
+{
+  .m_size = sizeof (XSpaceEnum_wr1_2),
+  .m_align = dds_alignof (XSpaceEnum_wr1_2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnum::wr1_2",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnum_wr1_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnum_wr1_2, .sz = TYPE_INFO_CDR_SZ_XSpaceEnum_wr1_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnum_wr1_2, .sz = TYPE_MAP_CDR_SZ_XSpaceEnum_wr1_2 }
+};
+
+static const uint32_t XSpaceEnum_rd2_ops [] =
+{
+  /* rd2 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnum_rd2, f1), 2u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 8db5e098fffd8310c26e73003291] (#deps: 1)
+   - [MINIMAL 02463ec0e12e43bec29ee63bb7d0]
+  [COMPLETE 690e1885efc429711eec4e348b61] (#deps: 1)
+   - [COMPLETE 5c09c4786525afff3f1bb96a9013]
+*/
+#define TYPE_INFO_CDR_XSpaceEnum_rd2 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8d, 0xb5, 0xe0, 0x98, 0xff, 0xfd, 0x83, 0x10, 0xc2, 0x6e, 0x73, \
+  0x00, 0x32, 0x91, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x02, 0x46, 0x3e, 0xc0, 0xe1, 0x2e, 0x43, \
+  0xbe, 0xc2, 0x9e, 0xe6, 0x3b, 0xb7, 0xd0, 0x00, 0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x69, 0x0e, 0x18, \
+  0x85, 0xef, 0xc4, 0x29, 0x71, 0x1e, 0xec, 0x4e, 0x34, 0x8b, 0x61, 0x00, 0x51, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x5c, 0x09, 0xc4, 0x78, 0x65, 0x25, 0xaf, 0xff, 0x3f, 0x1b, 0xb9, 0x6a, 0x90, 0x13, 0x00, \
+  0x81, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnum_rd2 148u
+#define TYPE_MAP_CDR_XSpaceEnum_rd2 (unsigned char []){ \
+  0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x8d, 0xb5, 0xe0, 0x98, 0xff, 0xfd, 0x83, \
+  0x10, 0xc2, 0x6e, 0x73, 0x00, 0x32, 0x91, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x02, 0x46, 0x3e, 0xc0, 0xe1, \
+  0x2e, 0x43, 0xbe, 0xc2, 0x9e, 0xe6, 0x3b, 0xb7, 0xd0, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x02, 0x46, \
+  0x3e, 0xc0, 0xe1, 0x2e, 0x43, 0xbe, 0xc2, 0x9e, 0xe6, 0x3b, 0xb7, 0xd0, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x27, 0xf2, 0x37, 0xe6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbd, 0xf6, 0xf6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x93, 0xd7, 0xb1, 0x00, 0x00, \
+  0xf5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x69, 0x0e, 0x18, 0x85, 0xef, 0xc4, 0x29, \
+  0x71, 0x1e, 0xec, 0x4e, 0x34, 0x8b, 0x61, 0x00, 0x4d, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x72, 0x64, 0x32, 0x00, 0x29, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x5c, \
+  0x09, 0xc4, 0x78, 0x65, 0x25, 0xaf, 0xff, 0x3f, 0x1b, 0xb9, 0x6a, 0x90, 0x13, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x5c, 0x09, 0xc4, 0x78, 0x65, 0x25, \
+  0xaf, 0xff, 0x3f, 0x1b, 0xb9, 0x6a, 0x90, 0x13, 0x7d, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x02, 0x00, \
+  0x1b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x61, 0x00, 0x00, \
+  0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x31, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x41, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x69, 0x0e, 0x18, 0x85, 0xef, 0xc4, 0x29, 0x71, 0x1e, 0xec, 0x4e, \
+  0x34, 0x8b, 0x61, 0xf1, 0x8d, 0xb5, 0xe0, 0x98, 0xff, 0xfd, 0x83, 0x10, 0xc2, 0x6e, 0x73, 0x00, \
+  0x32, 0x91, 0xf2, 0x5c, 0x09, 0xc4, 0x78, 0x65, 0x25, 0xaf, 0xff, 0x3f, 0x1b, 0xb9, 0x6a, 0x90, \
+  0x13, 0xf1, 0x02, 0x46, 0x3e, 0xc0, 0xe1, 0x2e, 0x43, 0xbe, 0xc2, 0x9e, 0xe6, 0x3b, 0xb7, 0xd0\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnum_rd2 496u
+const dds_topic_descriptor_t XSpaceEnum_rd2_desc =
+{
+  .m_size = sizeof (XSpaceEnum_rd2),
+  .m_align = dds_alignof (XSpaceEnum_rd2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnum::rd2",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnum_rd2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnum_rd2, .sz = TYPE_INFO_CDR_SZ_XSpaceEnum_rd2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnum_rd2, .sz = TYPE_MAP_CDR_SZ_XSpaceEnum_rd2 }
+};
+
+static const uint32_t XSpaceEnum_wr2_1_ops [] =
+{
+  /* wr2_1 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnum_wr2_1, f1), 2u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 8db5e098fffd8310c26e73003291] (#deps: 1)
+   - [MINIMAL 02463ec0e12e43bec29ee63bb7d0]
+  [COMPLETE d6fb681c33a96455600890f0a856] (#deps: 1)
+   - [COMPLETE 5c09c4786525afff3f1bb96a9013]
+*/
+#define TYPE_INFO_CDR_XSpaceEnum_wr2_1 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x8d, 0xb5, 0xe0, 0x98, 0xff, 0xfd, 0x83, 0x10, 0xc2, 0x6e, 0x73, \
+  0x00, 0x32, 0x91, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x02, 0x46, 0x3e, 0xc0, 0xe1, 0x2e, 0x43, \
+  0xbe, 0xc2, 0x9e, 0xe6, 0x3b, 0xb7, 0xd0, 0x00, 0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xd6, 0xfb, 0x68, \
+  0x1c, 0x33, 0xa9, 0x64, 0x55, 0x60, 0x08, 0x90, 0xf0, 0xa8, 0x56, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x5c, 0x09, 0xc4, 0x78, 0x65, 0x25, 0xaf, 0xff, 0x3f, 0x1b, 0xb9, 0x6a, 0x90, 0x13, 0x00, \
+  0x81, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnum_wr2_1 148u
+#define TYPE_MAP_CDR_XSpaceEnum_wr2_1 (unsigned char []){ \
+  0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x8d, 0xb5, 0xe0, 0x98, 0xff, 0xfd, 0x83, \
+  0x10, 0xc2, 0x6e, 0x73, 0x00, 0x32, 0x91, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x02, 0x46, 0x3e, 0xc0, 0xe1, \
+  0x2e, 0x43, 0xbe, 0xc2, 0x9e, 0xe6, 0x3b, 0xb7, 0xd0, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x02, 0x46, \
+  0x3e, 0xc0, 0xe1, 0x2e, 0x43, 0xbe, 0xc2, 0x9e, 0xe6, 0x3b, 0xb7, 0xd0, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x27, 0xf2, 0x37, 0xe6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbd, 0xf6, 0xf6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x93, 0xd7, 0xb1, 0x00, 0x00, \
+  0xf9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xd6, 0xfb, 0x68, 0x1c, 0x33, 0xa9, 0x64, \
+  0x55, 0x60, 0x08, 0x90, 0xf0, 0xa8, 0x56, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x77, 0x72, 0x32, 0x5f, 0x31, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x5c, 0x09, 0xc4, 0x78, 0x65, 0x25, 0xaf, 0xff, 0x3f, 0x1b, 0xb9, 0x6a, 0x90, \
+  0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x5c, 0x09, \
+  0xc4, 0x78, 0x65, 0x25, 0xaf, 0xff, 0x3f, 0x1b, 0xb9, 0x6a, 0x90, 0x13, 0x7d, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x02, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, \
+  0x5f, 0x61, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x41, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xd6, 0xfb, 0x68, 0x1c, 0x33, 0xa9, 0x64, \
+  0x55, 0x60, 0x08, 0x90, 0xf0, 0xa8, 0x56, 0xf1, 0x8d, 0xb5, 0xe0, 0x98, 0xff, 0xfd, 0x83, 0x10, \
+  0xc2, 0x6e, 0x73, 0x00, 0x32, 0x91, 0xf2, 0x5c, 0x09, 0xc4, 0x78, 0x65, 0x25, 0xaf, 0xff, 0x3f, \
+  0x1b, 0xb9, 0x6a, 0x90, 0x13, 0xf1, 0x02, 0x46, 0x3e, 0xc0, 0xe1, 0x2e, 0x43, 0xbe, 0xc2, 0x9e, \
+  0xe6, 0x3b, 0xb7, 0xd0\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnum_wr2_1 500u
+const dds_topic_descriptor_t XSpaceEnum_wr2_1_desc =
+{
+  .m_size = sizeof (XSpaceEnum_wr2_1),
+  .m_align = dds_alignof (XSpaceEnum_wr2_1),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnum::wr2_1",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnum_wr2_1_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnum_wr2_1, .sz = TYPE_INFO_CDR_SZ_XSpaceEnum_wr2_1 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnum_wr2_1, .sz = TYPE_MAP_CDR_SZ_XSpaceEnum_wr2_1 }
+};
+
+static const uint32_t XSpaceEnum_wr2_2_ops [] =
+{
+  /* wr2_2 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnum_wr2_2, f1), 2u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 5b8bbdc2a69f007e4e4f0ea51154] (#deps: 1)
+   - [MINIMAL a188737d0746fbf0905eb9a7f36d]
+  [COMPLETE c72989beb8a4173855325473e8a6] (#deps: 1)
+   - [COMPLETE f6a9a5752a35d329e5869888dba2]
+*/
+#define TYPE_INFO_CDR_XSpaceEnum_wr2_2 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x5b, 0x8b, 0xbd, 0xc2, 0xa6, 0x9f, 0x00, 0x7e, 0x4e, 0x4f, 0x0e, \
+  0xa5, 0x11, 0x54, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xa1, 0x88, 0x73, 0x7d, 0x07, 0x46, 0xfb, \
+  0xf0, 0x90, 0x5e, 0xb9, 0xa7, 0xf3, 0x6d, 0x00, 0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xc7, 0x29, 0x89, \
+  0xbe, 0xb8, 0xa4, 0x17, 0x38, 0x55, 0x32, 0x54, 0x73, 0xe8, 0xa6, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xf6, 0xa9, 0xa5, 0x75, 0x2a, 0x35, 0xd3, 0x29, 0xe5, 0x86, 0x98, 0x88, 0xdb, 0xa2, 0x00, \
+  0x81, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnum_wr2_2 148u
+#define TYPE_MAP_CDR_XSpaceEnum_wr2_2 (unsigned char []){ \
+  0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x5b, 0x8b, 0xbd, 0xc2, 0xa6, 0x9f, 0x00, \
+  0x7e, 0x4e, 0x4f, 0x0e, 0xa5, 0x11, 0x54, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xa1, 0x88, 0x73, 0x7d, 0x07, \
+  0x46, 0xfb, 0xf0, 0x90, 0x5e, 0xb9, 0xa7, 0xf3, 0x6d, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xa1, 0x88, \
+  0x73, 0x7d, 0x07, 0x46, 0xfb, 0xf0, 0x90, 0x5e, 0xb9, 0xa7, 0xf3, 0x6d, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0xe1, 0xdf, 0xfc, 0x87, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5c, 0x36, 0x84, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x6b, 0xf4, 0xb5, 0x00, 0x00, \
+  0xf9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xc7, 0x29, 0x89, 0xbe, 0xb8, 0xa4, 0x17, \
+  0x38, 0x55, 0x32, 0x54, 0x73, 0xe8, 0xa6, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x77, 0x72, 0x32, 0x5f, 0x32, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0xf6, 0xa9, 0xa5, 0x75, 0x2a, 0x35, 0xd3, 0x29, 0xe5, 0x86, 0x98, 0x88, 0xdb, \
+  0xa2, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0xf6, 0xa9, \
+  0xa5, 0x75, 0x2a, 0x35, 0xd3, 0x29, 0xe5, 0x86, 0x98, 0x88, 0xdb, 0xa2, 0x7d, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x01, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, \
+  0x5f, 0x66, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x46, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xc7, 0x29, 0x89, 0xbe, 0xb8, 0xa4, 0x17, \
+  0x38, 0x55, 0x32, 0x54, 0x73, 0xe8, 0xa6, 0xf1, 0x5b, 0x8b, 0xbd, 0xc2, 0xa6, 0x9f, 0x00, 0x7e, \
+  0x4e, 0x4f, 0x0e, 0xa5, 0x11, 0x54, 0xf2, 0xf6, 0xa9, 0xa5, 0x75, 0x2a, 0x35, 0xd3, 0x29, 0xe5, \
+  0x86, 0x98, 0x88, 0xdb, 0xa2, 0xf1, 0xa1, 0x88, 0x73, 0x7d, 0x07, 0x46, 0xfb, 0xf0, 0x90, 0x5e, \
+  0xb9, 0xa7, 0xf3, 0x6d\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnum_wr2_2 500u
+const dds_topic_descriptor_t XSpaceEnum_wr2_2_desc =
+{
+  .m_size = sizeof (XSpaceEnum_wr2_2),
+  .m_align = dds_alignof (XSpaceEnum_wr2_2),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnum::wr2_2",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnum_wr2_2_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnum_wr2_2, .sz = TYPE_INFO_CDR_SZ_XSpaceEnum_wr2_2 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnum_wr2_2, .sz = TYPE_MAP_CDR_SZ_XSpaceEnum_wr2_2 }
+};
+
+static const uint32_t XSpaceEnumPlus_wr1_3_ops [] =
+{
+  /* wr1_3 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnumPlus_wr1_3, f1), 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 995a98ceca62a2beec0e0edb7a24] (#deps: 1)
+   - [MINIMAL e02402cd66de774ecb59f92849cd]
+  [COMPLETE c8f85c33746b6973eed1155e4fc0] (#deps: 1)
+   - [COMPLETE 2bd6d62997de98b1c940efacccaf]
+*/
+#define TYPE_INFO_CDR_XSpaceEnumPlus_wr1_3 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x99, 0x5a, 0x98, 0xce, 0xca, 0x62, 0xa2, 0xbe, 0xec, 0x0e, 0x0e, \
+  0xdb, 0x7a, 0x24, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xe0, 0x24, 0x02, 0xcd, 0x66, 0xde, 0x77, \
+  0x4e, 0xcb, 0x59, 0xf9, 0x28, 0x49, 0xcd, 0x00, 0x66, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xc8, 0xf8, 0x5c, \
+  0x33, 0x74, 0x6b, 0x69, 0x73, 0xee, 0xd1, 0x15, 0x5e, 0x4f, 0xc0, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x2b, 0xd6, 0xd6, 0x29, 0x97, 0xde, 0x98, 0xb1, 0xc9, 0x40, 0xef, 0xac, 0xcc, 0xaf, 0x00, \
+  0xa5, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnumPlus_wr1_3 148u
+#define TYPE_MAP_CDR_XSpaceEnumPlus_wr1_3 (unsigned char []){ \
+  0xbe, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x99, 0x5a, 0x98, 0xce, 0xca, 0x62, 0xa2, \
+  0xbe, 0xec, 0x0e, 0x0e, 0xdb, 0x7a, 0x24, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xe0, 0x24, 0x02, 0xcd, 0x66, \
+  0xde, 0x77, 0x4e, 0xcb, 0x59, 0xf9, 0x28, 0x49, 0xcd, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xe0, 0x24, \
+  0x02, 0xcd, 0x66, 0xde, 0x77, 0x4e, 0xcb, 0x59, 0xf9, 0x28, 0x49, 0xcd, 0x62, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0xe1, 0xdf, 0xfc, 0x87, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5c, 0x36, 0x84, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x6b, 0xf4, 0xb5, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe0, \
+  0xe7, 0x24, 0x00, 0x00, 0x21, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xc8, 0xf8, 0x5c, \
+  0x33, 0x74, 0x6b, 0x69, 0x73, 0xee, 0xd1, 0x15, 0x5e, 0x4f, 0xc0, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x50, 0x6c, 0x75, 0x73, 0x3a, 0x3a, \
+  0x77, 0x72, 0x31, 0x5f, 0x33, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x2b, 0xd6, 0xd6, 0x29, 0x97, \
+  0xde, 0x98, 0xb1, 0xc9, 0x40, 0xef, 0xac, 0xcc, 0xaf, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x2b, 0xd6, 0xd6, 0x29, 0x97, 0xde, 0x98, 0xb1, 0xc9, 0x40, \
+  0xef, 0xac, 0xcc, 0xaf, 0xa1, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, \
+  0x75, 0x6d, 0x50, 0x6c, 0x75, 0x73, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x66, 0x5f, 0x70, \
+  0x6c, 0x75, 0x73, 0x00, 0x71, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x46, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x46, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0xc8, 0xf8, 0x5c, 0x33, 0x74, 0x6b, 0x69, 0x73, 0xee, 0xd1, 0x15, \
+  0x5e, 0x4f, 0xc0, 0xf1, 0x99, 0x5a, 0x98, 0xce, 0xca, 0x62, 0xa2, 0xbe, 0xec, 0x0e, 0x0e, 0xdb, \
+  0x7a, 0x24, 0xf2, 0x2b, 0xd6, 0xd6, 0x29, 0x97, 0xde, 0x98, 0xb1, 0xc9, 0x40, 0xef, 0xac, 0xcc, \
+  0xaf, 0xf1, 0xe0, 0x24, 0x02, 0xcd, 0x66, 0xde, 0x77, 0x4e, 0xcb, 0x59, 0xf9, 0x28, 0x49, 0xcd\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnumPlus_wr1_3 560u
+const dds_topic_descriptor_t XSpaceEnumPlus_wr1_3_desc =
+{
+  .m_size = sizeof (XSpaceEnumPlus_wr1_3),
+  .m_align = dds_alignof (XSpaceEnumPlus_wr1_3),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnumPlus::wr1_3",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnumPlus_wr1_3_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnumPlus_wr1_3, .sz = TYPE_INFO_CDR_SZ_XSpaceEnumPlus_wr1_3 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnumPlus_wr1_3, .sz = TYPE_MAP_CDR_SZ_XSpaceEnumPlus_wr1_3 }
+};
+
+static const uint32_t XSpaceEnumPlus_wr2_3_ops [] =
+{
+  /* wr2_3 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnumPlus_wr2_3, f1), 3u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 37e8c32691756671048176e704f9] (#deps: 1)
+   - [MINIMAL 4b842d6008d90fc3df7f685a7879]
+  [COMPLETE be4bfe4c8699ce6f0f1b2517d699] (#deps: 1)
+   - [COMPLETE 203f451d635127a36659d3e740c0]
+*/
+#define TYPE_INFO_CDR_XSpaceEnumPlus_wr2_3 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x37, 0xe8, 0xc3, 0x26, 0x91, 0x75, 0x66, 0x71, 0x04, 0x81, 0x76, \
+  0xe7, 0x04, 0xf9, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x4b, 0x84, 0x2d, 0x60, 0x08, 0xd9, 0x0f, \
+  0xc3, 0xdf, 0x7f, 0x68, 0x5a, 0x78, 0x79, 0x00, 0x66, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xbe, 0x4b, 0xfe, \
+  0x4c, 0x86, 0x99, 0xce, 0x6f, 0x0f, 0x1b, 0x25, 0x17, 0xd6, 0x99, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x20, 0x3f, 0x45, 0x1d, 0x63, 0x51, 0x27, 0xa3, 0x66, 0x59, 0xd3, 0xe7, 0x40, 0xc0, 0x00, \
+  0xa5, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnumPlus_wr2_3 148u
+#define TYPE_MAP_CDR_XSpaceEnumPlus_wr2_3 (unsigned char []){ \
+  0xbe, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x37, 0xe8, 0xc3, 0x26, 0x91, 0x75, 0x66, \
+  0x71, 0x04, 0x81, 0x76, 0xe7, 0x04, 0xf9, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x4b, 0x84, 0x2d, 0x60, 0x08, \
+  0xd9, 0x0f, 0xc3, 0xdf, 0x7f, 0x68, 0x5a, 0x78, 0x79, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0x4b, 0x84, \
+  0x2d, 0x60, 0x08, 0xd9, 0x0f, 0xc3, 0xdf, 0x7f, 0x68, 0x5a, 0x78, 0x79, 0x62, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x27, 0xf2, 0x37, 0xe6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbd, 0xf6, 0xf6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x93, 0xd7, 0xb1, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2f, \
+  0x3a, 0xdf, 0x00, 0x00, 0x21, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0xbe, 0x4b, 0xfe, \
+  0x4c, 0x86, 0x99, 0xce, 0x6f, 0x0f, 0x1b, 0x25, 0x17, 0xd6, 0x99, 0x00, 0x55, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x50, 0x6c, 0x75, 0x73, 0x3a, 0x3a, \
+  0x77, 0x72, 0x32, 0x5f, 0x33, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x20, 0x3f, 0x45, 0x1d, 0x63, \
+  0x51, 0x27, 0xa3, 0x66, 0x59, 0xd3, 0xe7, 0x40, 0xc0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x20, 0x3f, 0x45, 0x1d, 0x63, 0x51, 0x27, 0xa3, 0x66, 0x59, \
+  0xd3, 0xe7, 0x40, 0xc0, 0xa1, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x02, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, \
+  0x75, 0x6d, 0x50, 0x6c, 0x75, 0x73, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x61, 0x5f, 0x70, \
+  0x6c, 0x75, 0x73, 0x00, 0x71, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x41, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x32, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x41, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0xbe, 0x4b, 0xfe, 0x4c, 0x86, 0x99, 0xce, 0x6f, 0x0f, 0x1b, 0x25, \
+  0x17, 0xd6, 0x99, 0xf1, 0x37, 0xe8, 0xc3, 0x26, 0x91, 0x75, 0x66, 0x71, 0x04, 0x81, 0x76, 0xe7, \
+  0x04, 0xf9, 0xf2, 0x20, 0x3f, 0x45, 0x1d, 0x63, 0x51, 0x27, 0xa3, 0x66, 0x59, 0xd3, 0xe7, 0x40, \
+  0xc0, 0xf1, 0x4b, 0x84, 0x2d, 0x60, 0x08, 0xd9, 0x0f, 0xc3, 0xdf, 0x7f, 0x68, 0x5a, 0x78, 0x79\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnumPlus_wr2_3 560u
+const dds_topic_descriptor_t XSpaceEnumPlus_wr2_3_desc =
+{
+  .m_size = sizeof (XSpaceEnumPlus_wr2_3),
+  .m_align = dds_alignof (XSpaceEnumPlus_wr2_3),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnumPlus::wr2_3",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnumPlus_wr2_3_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnumPlus_wr2_3, .sz = TYPE_INFO_CDR_SZ_XSpaceEnumPlus_wr2_3 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnumPlus_wr2_3, .sz = TYPE_MAP_CDR_SZ_XSpaceEnumPlus_wr2_3 }
+};
+
+static const uint32_t XSpaceEnumMin_wr1_4_ops [] =
+{
+  /* wr1_4 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnumMin_wr1_4, f1), 1u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 364d36da82dc068c9e4f969a9de3] (#deps: 1)
+   - [MINIMAL a93410fcfe0921a77b3e50f692ac]
+  [COMPLETE 6d0343082566bde683756a571983] (#deps: 1)
+   - [COMPLETE 73e6d46776ee03c9d43b866d916c]
+*/
+#define TYPE_INFO_CDR_XSpaceEnumMin_wr1_4 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x36, 0x4d, 0x36, 0xda, 0x82, 0xdc, 0x06, 0x8c, 0x9e, 0x4f, 0x96, \
+  0x9a, 0x9d, 0xe3, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xa9, 0x34, 0x10, 0xfc, 0xfe, 0x09, 0x21, \
+  0xa7, 0x7b, 0x3e, 0x50, 0xf6, 0x92, 0xac, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x6d, 0x03, 0x43, \
+  0x08, 0x25, 0x66, 0xbd, 0xe6, 0x83, 0x75, 0x6a, 0x57, 0x19, 0x83, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x73, 0xe6, 0xd4, 0x67, 0x76, 0xee, 0x03, 0xc9, 0xd4, 0x3b, 0x86, 0x6d, 0x91, 0x6c, 0x00, \
+  0x6d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnumMin_wr1_4 148u
+#define TYPE_MAP_CDR_XSpaceEnumMin_wr1_4 (unsigned char []){ \
+  0x96, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x36, 0x4d, 0x36, 0xda, 0x82, 0xdc, 0x06, \
+  0x8c, 0x9e, 0x4f, 0x96, 0x9a, 0x9d, 0xe3, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xa9, 0x34, 0x10, 0xfc, 0xfe, \
+  0x09, 0x21, 0xa7, 0x7b, 0x3e, 0x50, 0xf6, 0x92, 0xac, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xa9, 0x34, \
+  0x10, 0xfc, 0xfe, 0x09, 0x21, 0xa7, 0x7b, 0x3e, 0x50, 0xf6, 0x92, 0xac, 0x3a, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0xe1, 0xdf, 0xfc, 0x87, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x5c, 0x36, 0x84, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x6d, 0x03, 0x43, 0x08, 0x25, 0x66, 0xbd, 0xe6, 0x83, 0x75, 0x6a, \
+  0x57, 0x19, 0x83, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, \
+  0x75, 0x6d, 0x4d, 0x69, 0x6e, 0x3a, 0x3a, 0x77, 0x72, 0x31, 0x5f, 0x34, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x73, 0xe6, 0xd4, 0x67, 0x76, 0xee, 0x03, 0xc9, 0xd4, 0x3b, 0x86, 0x6d, 0x91, \
+  0x6c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x73, 0xe6, \
+  0xd4, 0x67, 0x76, 0xee, 0x03, 0xc9, 0xd4, 0x3b, 0x86, 0x6d, 0x91, 0x6c, 0x69, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x01, 0x00, 0x22, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x4d, 0x69, 0x6e, 0x3a, 0x3a, 0x65, \
+  0x6e, 0x75, 0x6d, 0x5f, 0x66, 0x5f, 0x6d, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x46, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x6d, 0x03, 0x43, 0x08, 0x25, 0x66, 0xbd, 0xe6, 0x83, 0x75, 0x6a, \
+  0x57, 0x19, 0x83, 0xf1, 0x36, 0x4d, 0x36, 0xda, 0x82, 0xdc, 0x06, 0x8c, 0x9e, 0x4f, 0x96, 0x9a, \
+  0x9d, 0xe3, 0xf2, 0x73, 0xe6, 0xd4, 0x67, 0x76, 0xee, 0x03, 0xc9, 0xd4, 0x3b, 0x86, 0x6d, 0x91, \
+  0x6c, 0xf1, 0xa9, 0x34, 0x10, 0xfc, 0xfe, 0x09, 0x21, 0xa7, 0x7b, 0x3e, 0x50, 0xf6, 0x92, 0xac\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnumMin_wr1_4 464u
+const dds_topic_descriptor_t XSpaceEnumMin_wr1_4_desc =
+{
+  .m_size = sizeof (XSpaceEnumMin_wr1_4),
+  .m_align = dds_alignof (XSpaceEnumMin_wr1_4),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnumMin::wr1_4",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnumMin_wr1_4_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnumMin_wr1_4, .sz = TYPE_INFO_CDR_SZ_XSpaceEnumMin_wr1_4 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnumMin_wr1_4, .sz = TYPE_MAP_CDR_SZ_XSpaceEnumMin_wr1_4 }
+};
+
+static const uint32_t XSpaceEnumMin_wr2_4_ops [] =
+{
+  /* wr2_4 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnumMin_wr2_4, f1), 1u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL e497e00fe5a0fc6fb43ab0fc7a78] (#deps: 1)
+   - [MINIMAL f4a6fa1ead368bccf44b28ca9771]
+  [COMPLETE 57ff084ac60ed023d91004cc7278] (#deps: 1)
+   - [COMPLETE 3b1635711bb7919f01295b759ec3]
+*/
+#define TYPE_INFO_CDR_XSpaceEnumMin_wr2_4 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xe4, 0x97, 0xe0, 0x0f, 0xe5, 0xa0, 0xfc, 0x6f, 0xb4, 0x3a, 0xb0, \
+  0xfc, 0x7a, 0x78, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xf4, 0xa6, 0xfa, 0x1e, 0xad, 0x36, 0x8b, \
+  0xcc, 0xf4, 0x4b, 0x28, 0xca, 0x97, 0x71, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x57, 0xff, 0x08, \
+  0x4a, 0xc6, 0x0e, 0xd0, 0x23, 0xd9, 0x10, 0x04, 0xcc, 0x72, 0x78, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x3b, 0x16, 0x35, 0x71, 0x1b, 0xb7, 0x91, 0x9f, 0x01, 0x29, 0x5b, 0x75, 0x9e, 0xc3, 0x00, \
+  0x6d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnumMin_wr2_4 148u
+#define TYPE_MAP_CDR_XSpaceEnumMin_wr2_4 (unsigned char []){ \
+  0x96, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xe4, 0x97, 0xe0, 0x0f, 0xe5, 0xa0, 0xfc, \
+  0x6f, 0xb4, 0x3a, 0xb0, 0xfc, 0x7a, 0x78, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xf4, 0xa6, 0xfa, 0x1e, 0xad, \
+  0x36, 0x8b, 0xcc, 0xf4, 0x4b, 0x28, 0xca, 0x97, 0x71, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xf4, 0xa6, \
+  0xfa, 0x1e, 0xad, 0x36, 0x8b, 0xcc, 0xf4, 0x4b, 0x28, 0xca, 0x97, 0x71, 0x3a, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x27, 0xf2, 0x37, 0xe6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xbd, 0xf6, 0xf6, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x57, 0xff, 0x08, 0x4a, 0xc6, 0x0e, 0xd0, 0x23, 0xd9, 0x10, 0x04, \
+  0xcc, 0x72, 0x78, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, \
+  0x75, 0x6d, 0x4d, 0x69, 0x6e, 0x3a, 0x3a, 0x77, 0x72, 0x32, 0x5f, 0x34, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x3b, 0x16, 0x35, 0x71, 0x1b, 0xb7, 0x91, 0x9f, 0x01, 0x29, 0x5b, 0x75, 0x9e, \
+  0xc3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, 0x00, 0xf2, 0x3b, 0x16, \
+  0x35, 0x71, 0x1b, 0xb7, 0x91, 0x9f, 0x01, 0x29, 0x5b, 0x75, 0x9e, 0xc3, 0x69, 0x00, 0x00, 0x00, \
+  0xf2, 0x40, 0x02, 0x00, 0x22, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, \
+  0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x4d, 0x69, 0x6e, 0x3a, 0x3a, 0x65, \
+  0x6e, 0x75, 0x6d, 0x5f, 0x61, 0x5f, 0x6d, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x41, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x57, 0xff, 0x08, 0x4a, 0xc6, 0x0e, 0xd0, 0x23, 0xd9, 0x10, 0x04, \
+  0xcc, 0x72, 0x78, 0xf1, 0xe4, 0x97, 0xe0, 0x0f, 0xe5, 0xa0, 0xfc, 0x6f, 0xb4, 0x3a, 0xb0, 0xfc, \
+  0x7a, 0x78, 0xf2, 0x3b, 0x16, 0x35, 0x71, 0x1b, 0xb7, 0x91, 0x9f, 0x01, 0x29, 0x5b, 0x75, 0x9e, \
+  0xc3, 0xf1, 0xf4, 0xa6, 0xfa, 0x1e, 0xad, 0x36, 0x8b, 0xcc, 0xf4, 0x4b, 0x28, 0xca, 0x97, 0x71\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnumMin_wr2_4 464u
+const dds_topic_descriptor_t XSpaceEnumMin_wr2_4_desc =
+{
+  .m_size = sizeof (XSpaceEnumMin_wr2_4),
+  .m_align = dds_alignof (XSpaceEnumMin_wr2_4),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnumMin::wr2_4",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnumMin_wr2_4_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnumMin_wr2_4, .sz = TYPE_INFO_CDR_SZ_XSpaceEnumMin_wr2_4 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnumMin_wr2_4, .sz = TYPE_MAP_CDR_SZ_XSpaceEnumMin_wr2_4 }
+};
+
+static const uint32_t XSpaceEnumLabel_wr1_5_ops [] =
+{
+  /* wr1_5 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnumLabel_wr1_5, f1), 2u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 780074ce8ba5947a4e495ee09d24] (#deps: 1)
+   - [MINIMAL a34a7831b5b9f15a383db273b9e7]
+  [COMPLETE 79ca87dc476546046f5d67b3bf9b] (#deps: 1)
+   - [COMPLETE bda54f9ef426f227fe152e1d53b8]
+*/
+#define TYPE_INFO_CDR_XSpaceEnumLabel_wr1_5 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x78, 0x00, 0x74, 0xce, 0x8b, 0xa5, 0x94, 0x7a, 0x4e, 0x49, 0x5e, \
+  0xe0, 0x9d, 0x24, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xa3, 0x4a, 0x78, 0x31, 0xb5, 0xb9, 0xf1, \
+  0x5a, 0x38, 0x3d, 0xb2, 0x73, 0xb9, 0xe7, 0x00, 0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x79, 0xca, 0x87, \
+  0xdc, 0x47, 0x65, 0x46, 0x04, 0x6f, 0x5d, 0x67, 0xb3, 0xbf, 0x9b, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0xbd, 0xa5, 0x4f, 0x9e, 0xf4, 0x26, 0xf2, 0x27, 0xfe, 0x15, 0x2e, 0x1d, 0x53, 0xb8, 0x00, \
+  0x8d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnumLabel_wr1_5 148u
+#define TYPE_MAP_CDR_XSpaceEnumLabel_wr1_5 (unsigned char []){ \
+  0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x78, 0x00, 0x74, 0xce, 0x8b, 0xa5, 0x94, \
+  0x7a, 0x4e, 0x49, 0x5e, 0xe0, 0x9d, 0x24, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xa3, 0x4a, 0x78, 0x31, 0xb5, \
+  0xb9, 0xf1, 0x5a, 0x38, 0x3d, 0xb2, 0x73, 0xb9, 0xe7, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xa3, 0x4a, \
+  0x78, 0x31, 0xb5, 0xb9, 0xf1, 0x5a, 0x38, 0x3d, 0xb2, 0x73, 0xb9, 0xe7, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0xe1, 0xdf, 0xfc, 0x87, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x59, 0x8a, 0xb8, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x6b, 0xf4, 0xb5, 0x00, 0x00, \
+  0x09, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x79, 0xca, 0x87, 0xdc, 0x47, 0x65, 0x46, \
+  0x04, 0x6f, 0x5d, 0x67, 0xb3, 0xbf, 0x9b, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x3a, 0x3a, 0x77, 0x72, 0x31, \
+  0x5f, 0x35, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0xbd, 0xa5, 0x4f, 0x9e, 0xf4, 0x26, 0xf2, 0x27, 0xfe, \
+  0x15, 0x2e, 0x1d, 0x53, 0xb8, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0xf2, 0xbd, 0xa5, 0x4f, 0x9e, 0xf4, 0x26, 0xf2, 0x27, 0xfe, 0x15, 0x2e, 0x1d, 0x53, 0xb8, \
+  0x89, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x26, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x4c, 0x61, \
+  0x62, 0x65, 0x6c, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x66, 0x5f, 0x6c, 0x61, 0x62, 0x65, \
+  0x6c, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x46, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x46, 0x46, 0x46, 0x32, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x46, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x79, 0xca, 0x87, 0xdc, 0x47, 0x65, 0x46, \
+  0x04, 0x6f, 0x5d, 0x67, 0xb3, 0xbf, 0x9b, 0xf1, 0x78, 0x00, 0x74, 0xce, 0x8b, 0xa5, 0x94, 0x7a, \
+  0x4e, 0x49, 0x5e, 0xe0, 0x9d, 0x24, 0xf2, 0xbd, 0xa5, 0x4f, 0x9e, 0xf4, 0x26, 0xf2, 0x27, 0xfe, \
+  0x15, 0x2e, 0x1d, 0x53, 0xb8, 0xf1, 0xa3, 0x4a, 0x78, 0x31, 0xb5, 0xb9, 0xf1, 0x5a, 0x38, 0x3d, \
+  0xb2, 0x73, 0xb9, 0xe7\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnumLabel_wr1_5 516u
+const dds_topic_descriptor_t XSpaceEnumLabel_wr1_5_desc =
+{
+  .m_size = sizeof (XSpaceEnumLabel_wr1_5),
+  .m_align = dds_alignof (XSpaceEnumLabel_wr1_5),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnumLabel::wr1_5",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnumLabel_wr1_5_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnumLabel_wr1_5, .sz = TYPE_INFO_CDR_SZ_XSpaceEnumLabel_wr1_5 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnumLabel_wr1_5, .sz = TYPE_MAP_CDR_SZ_XSpaceEnumLabel_wr1_5 }
+};
+
+static const uint32_t XSpaceEnumLabel_wr2_5_ops [] =
+{
+  /* wr2_5 */
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (XSpaceEnumLabel_wr2_5, f1), 2u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 7bfbc5101aea6301020d621a9108] (#deps: 1)
+   - [MINIMAL e1fbfc647b26fd04dd77b9b1c159]
+  [COMPLETE 9b123b2b9cabaf877f34a034bc99] (#deps: 1)
+   - [COMPLETE 35a032d0c9182432a927329effe0]
+*/
+#define TYPE_INFO_CDR_XSpaceEnumLabel_wr2_5 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x7b, 0xfb, 0xc5, 0x10, 0x1a, 0xea, 0x63, 0x01, 0x02, 0x0d, 0x62, \
+  0x1a, 0x91, 0x08, 0x00, 0x35, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xe1, 0xfb, 0xfc, 0x64, 0x7b, 0x26, 0xfd, \
+  0x04, 0xdd, 0x77, 0xb9, 0xb1, 0xc1, 0x59, 0x00, 0x52, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x9b, 0x12, 0x3b, \
+  0x2b, 0x9c, 0xab, 0xaf, 0x87, 0x7f, 0x34, 0xa0, 0x34, 0xbc, 0x99, 0x00, 0x59, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x35, 0xa0, 0x32, 0xd0, 0xc9, 0x18, 0x24, 0x32, 0xa9, 0x27, 0x32, 0x9e, 0xff, 0xe0, 0x00, \
+  0x8d, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_XSpaceEnumLabel_wr2_5 148u
+#define TYPE_MAP_CDR_XSpaceEnumLabel_wr2_5 (unsigned char []){ \
+  0xaa, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x7b, 0xfb, 0xc5, 0x10, 0x1a, 0xea, 0x63, \
+  0x01, 0x02, 0x0d, 0x62, 0x1a, 0x91, 0x08, 0x00, 0x31, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xe1, 0xfb, 0xfc, 0x64, 0x7b, \
+  0x26, 0xfd, 0x04, 0xdd, 0x77, 0xb9, 0xb1, 0xc1, 0x59, 0xbd, 0x19, 0x83, 0x6d, 0xf1, 0xe1, 0xfb, \
+  0xfc, 0x64, 0x7b, 0x26, 0xfd, 0x04, 0xdd, 0x77, 0xb9, 0xb1, 0xc1, 0x59, 0x4e, 0x00, 0x00, 0x00, \
+  0xf1, 0x40, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x27, 0xf2, 0x37, 0xe6, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xfb, 0x77, 0x3f, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x93, 0xd7, 0xb1, 0x00, 0x00, \
+  0x09, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x9b, 0x12, 0x3b, 0x2b, 0x9c, 0xab, 0xaf, \
+  0x87, 0x7f, 0x34, 0xa0, 0x34, 0xbc, 0x99, 0x00, 0x55, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, \
+  0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x4c, 0x61, 0x62, 0x65, 0x6c, 0x3a, 0x3a, 0x77, 0x72, 0x32, \
+  0x5f, 0x35, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x35, 0xa0, 0x32, 0xd0, 0xc9, 0x18, 0x24, 0x32, 0xa9, \
+  0x27, 0x32, 0x9e, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x66, 0x31, 0x00, 0x00, \
+  0x00, 0xf2, 0x35, 0xa0, 0x32, 0xd0, 0xc9, 0x18, 0x24, 0x32, 0xa9, 0x27, 0x32, 0x9e, 0xff, 0xe0, \
+  0x89, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x02, 0x00, 0x26, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x58, 0x53, 0x70, 0x61, 0x63, 0x65, 0x45, 0x6e, 0x75, 0x6d, 0x4c, 0x61, \
+  0x62, 0x65, 0x6c, 0x3a, 0x3a, 0x65, 0x6e, 0x75, 0x6d, 0x5f, 0x61, 0x5f, 0x6c, 0x61, 0x62, 0x65, \
+  0x6c, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x41, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x41, 0x41, 0x41, 0x32, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x41, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x9b, 0x12, 0x3b, 0x2b, 0x9c, 0xab, 0xaf, \
+  0x87, 0x7f, 0x34, 0xa0, 0x34, 0xbc, 0x99, 0xf1, 0x7b, 0xfb, 0xc5, 0x10, 0x1a, 0xea, 0x63, 0x01, \
+  0x02, 0x0d, 0x62, 0x1a, 0x91, 0x08, 0xf2, 0x35, 0xa0, 0x32, 0xd0, 0xc9, 0x18, 0x24, 0x32, 0xa9, \
+  0x27, 0x32, 0x9e, 0xff, 0xe0, 0xf1, 0xe1, 0xfb, 0xfc, 0x64, 0x7b, 0x26, 0xfd, 0x04, 0xdd, 0x77, \
+  0xb9, 0xb1, 0xc1, 0x59\
+}
+#define TYPE_MAP_CDR_SZ_XSpaceEnumLabel_wr2_5 516u
+const dds_topic_descriptor_t XSpaceEnumLabel_wr2_5_desc =
+{
+  .m_size = sizeof (XSpaceEnumLabel_wr2_5),
+  .m_align = dds_alignof (XSpaceEnumLabel_wr2_5),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "XSpaceEnumLabel::wr2_5",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = XSpaceEnumLabel_wr2_5_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_XSpaceEnumLabel_wr2_5, .sz = TYPE_INFO_CDR_SZ_XSpaceEnumLabel_wr2_5 },
+  .type_mapping = { .data = TYPE_MAP_CDR_XSpaceEnumLabel_wr2_5, .sz = TYPE_MAP_CDR_SZ_XSpaceEnumLabel_wr2_5 }
+};
+
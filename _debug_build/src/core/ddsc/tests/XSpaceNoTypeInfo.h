@@ -0,0 +1,35 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_debug_build/src/core/ddsc/tests/XSpaceNoTypeInfo.h
+  Source: /root/repo/src/core/ddsc/tests/XSpaceNoTypeInfo.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#ifndef DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_DDSC_TESTS_XSPACENOTYPEINFO_H
+#define DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_DDSC_TESTS_XSPACENOTYPEINFO_H
+
+#include "dds/ddsc/dds_public_impl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct XSpaceNoTypeInfo_t1
+{
+  int32_t long_1;
+} XSpaceNoTypeInfo_t1;
+
+extern const dds_topic_descriptor_t XSpaceNoTypeInfo_t1_desc;
+
+#define XSpaceNoTypeInfo_t1__alloc() \
+((XSpaceNoTypeInfo_t1*) dds_alloc (sizeof (XSpaceNoTypeInfo_t1)));
+
+#define XSpaceNoTypeInfo_t1_free(d,o) \
+dds_sample_free ((d), &XSpaceNoTypeInfo_t1_desc, (o))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_DDSC_TESTS_XSPACENOTYPEINFO_H */
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/core/ddsi/tests/compress.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/compress.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/compress.c.o.d"
+  "/root/repo/_debug_build/src/core/ddsi/tests/cunit_ddsi.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/cunit_ddsi.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/cunit_ddsi.c.o.d"
+  "/root/repo/src/core/ddsi/tests/ipaddr.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/ipaddr.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/ipaddr.c.o.d"
+  "/root/repo/src/core/ddsi/tests/lat_estim.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/lat_estim.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/lat_estim.c.o.d"
+  "/root/repo/src/core/ddsi/tests/locators.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/locators.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/locators.c.o.d"
+  "/root/repo/src/core/ddsi/tests/plist.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/plist.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/plist.c.o.d"
+  "/root/repo/src/core/ddsi/tests/plist_generic.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/plist_generic.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/plist_generic.c.o.d"
+  "/root/repo/src/core/ddsi/tests/plist_leasedur.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/plist_leasedur.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/plist_leasedur.c.o.d"
+  "/root/repo/src/core/ddsi/tests/radmin.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/radmin.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/radmin.c.o.d"
+  "/root/repo/src/core/ddsi/tests/security_msg.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/security_msg.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/security_msg.c.o.d"
+  "/root/repo/src/core/ddsi/tests/sysdeps.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/sysdeps.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/sysdeps.c.o.d"
+  "/root/repo/src/core/ddsi/tests/xmsg.c" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/xmsg.c.o" "gcc" "src/core/ddsi/tests/CMakeFiles/cunit_ddsi.dir/xmsg.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/src/core/CMakeFiles/ddsc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
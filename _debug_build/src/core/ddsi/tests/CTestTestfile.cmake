@@ -0,0 +1,70 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/core/ddsi/tests
+# Build directory: /root/repo/_debug_build/src/core/ddsi/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(CUnit_ddsi_compress_roundtrip "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_compress" "-t" "roundtrip")
+set_tests_properties(CUnit_ddsi_compress_roundtrip PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_compress_malformed "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_compress" "-t" "malformed")
+set_tests_properties(CUnit_ddsi_compress_malformed PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_ipaddr_is_nearby_address "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_ipaddr" "-t" "is_nearby_address")
+set_tests_properties(CUnit_ddsi_ipaddr_is_nearby_address PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_lat_estim_initial "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_lat_estim" "-t" "initial")
+set_tests_properties(CUnit_ddsi_lat_estim_initial PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_lat_estim_outliers_and_convergence "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_lat_estim" "-t" "outliers_and_convergence")
+set_tests_properties(CUnit_ddsi_lat_estim_outliers_and_convergence PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_locator_from_string_bogusproto "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_locator_from_string" "-t" "bogusproto")
+set_tests_properties(CUnit_ddsi_locator_from_string_bogusproto PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_locator_from_string_ipv4_cross1 "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_locator_from_string" "-t" "ipv4_cross1")
+set_tests_properties(CUnit_ddsi_locator_from_string_ipv4_cross1 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_locator_from_string_ipv4_cross2 "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_locator_from_string" "-t" "ipv4_cross2")
+set_tests_properties(CUnit_ddsi_locator_from_string_ipv4_cross2 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_locator_from_string_udpv4mcgen "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_locator_from_string" "-t" "udpv4mcgen")
+set_tests_properties(CUnit_ddsi_locator_from_string_udpv4mcgen PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_locator_from_string_ipv4_invalid "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_locator_from_string" "-t" "ipv4_invalid")
+set_tests_properties(CUnit_ddsi_locator_from_string_ipv4_invalid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_locator_from_string_ipv4 "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_locator_from_string" "-t" "ipv4")
+set_tests_properties(CUnit_ddsi_locator_from_string_ipv4 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_locator_from_string_ipv6_invalid "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_locator_from_string" "-t" "ipv6_invalid")
+set_tests_properties(CUnit_ddsi_locator_from_string_ipv6_invalid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_locator_from_string_ipv6 "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_locator_from_string" "-t" "ipv6")
+set_tests_properties(CUnit_ddsi_locator_from_string_ipv6 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_generic_ser_and_deser "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_plist_generic" "-t" "ser_and_deser")
+set_tests_properties(CUnit_ddsi_plist_generic_ser_and_deser PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_generic_unalias "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_plist_generic" "-t" "unalias")
+set_tests_properties(CUnit_ddsi_plist_generic_unalias PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_generic_invalid_input "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_plist_generic" "-t" "invalid_input")
+set_tests_properties(CUnit_ddsi_plist_generic_invalid_input PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_generic_optional "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_plist_generic" "-t" "optional")
+set_tests_properties(CUnit_ddsi_plist_generic_optional PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_unalias_copy_merge "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_plist" "-t" "unalias_copy_merge")
+set_tests_properties(CUnit_ddsi_plist_unalias_copy_merge PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_leasedur_deser "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_plist_leasedur" "-t" "deser")
+set_tests_properties(CUnit_ddsi_plist_leasedur_deser PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_leasedur_ser_spdp "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_plist_leasedur" "-t" "ser_spdp")
+set_tests_properties(CUnit_ddsi_plist_leasedur_ser_spdp PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_leasedur_ser_others "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_plist_leasedur" "-t" "ser_others")
+set_tests_properties(CUnit_ddsi_plist_leasedur_ser_others PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_leasedur_new_proxypp "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_plist_leasedur" "-t" "new_proxypp")
+set_tests_properties(CUnit_ddsi_plist_leasedur_new_proxypp PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_leasedur_new_proxypp_def "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_plist_leasedur" "-t" "new_proxypp_def")
+set_tests_properties(CUnit_ddsi_plist_leasedur_new_proxypp_def PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_leasedur_new_proxyrd "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_plist_leasedur" "-t" "new_proxyrd")
+set_tests_properties(CUnit_ddsi_plist_leasedur_new_proxyrd PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_plist_leasedur_new_proxyrd_def "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_plist_leasedur" "-t" "new_proxyrd_def")
+set_tests_properties(CUnit_ddsi_plist_leasedur_new_proxyrd_def PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_radmin_drop_gap_at_end "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_radmin" "-t" "drop_gap_at_end")
+set_tests_properties(CUnit_ddsi_radmin_drop_gap_at_end PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_radmin_defrag_fec_reconstruct "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_radmin" "-t" "defrag_fec_reconstruct")
+set_tests_properties(CUnit_ddsi_radmin_defrag_fec_reconstruct PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_sysdeps_log_stacktrace_self "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_sysdeps" "-t" "log_stacktrace_self")
+set_tests_properties(CUnit_ddsi_sysdeps_log_stacktrace_self PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_sysdeps_log_stacktrace_other "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_sysdeps" "-t" "log_stacktrace_other")
+set_tests_properties(CUnit_ddsi_sysdeps_log_stacktrace_other PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_xmsg_ts_data_template "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_xmsg" "-t" "ts_data_template")
+set_tests_properties(CUnit_ddsi_xmsg_ts_data_template PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_xmsg_xpack_addmsg_template "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_xmsg" "-t" "xpack_addmsg_template")
+set_tests_properties(CUnit_ddsi_xmsg_xpack_addmsg_template PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddsi_security_msg_serializer "/root/repo/_debug_build/bin/cunit_ddsi" "-s" "ddsi_security_msg" "-t" "serializer")
+set_tests_properties(CUnit_ddsi_security_msg_serializer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/core/ddsi/tests/CMakeLists.txt;31;add_cunit_executable;/root/repo/src/core/ddsi/tests/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/core/xtests
+# Build directory: /root/repo/_debug_build/src/core/xtests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("rhc_torture")
+subdirs("initsampledeliv")
+subdirs("xpackbench")
+subdirs("filterbench")
+subdirs("symbol_export")
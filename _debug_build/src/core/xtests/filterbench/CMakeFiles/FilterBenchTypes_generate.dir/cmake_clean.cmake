@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/FilterBenchTypes_generate"
+  "FilterBenchTypes.c"
+  "FilterBenchTypes.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/FilterBenchTypes_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../../bin/filterbench"
+  "../../../../bin/filterbench.pdb"
+  "CMakeFiles/filterbench.dir/FilterBenchTypes.c.o"
+  "CMakeFiles/filterbench.dir/FilterBenchTypes.c.o.d"
+  "CMakeFiles/filterbench.dir/filterbench.c.o"
+  "CMakeFiles/filterbench.dir/filterbench.c.o.d"
+  "FilterBenchTypes.c"
+  "FilterBenchTypes.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/filterbench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
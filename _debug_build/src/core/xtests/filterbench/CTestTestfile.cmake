@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/core/xtests/filterbench
+# Build directory: /root/repo/_debug_build/src/core/xtests/filterbench
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(filterbench "/root/repo/_debug_build/bin/filterbench" "10000")
+set_tests_properties(filterbench PROPERTIES  ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/src/core/xtests/filterbench/CMakeLists.txt;30;add_test;/root/repo/src/core/xtests/filterbench/CMakeLists.txt;0;")
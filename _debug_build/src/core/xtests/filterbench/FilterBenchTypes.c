@@ -0,0 +1,111 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_debug_build/src/core/xtests/filterbench/FilterBenchTypes.c
+  Source: /root/repo/src/core/xtests/filterbench/FilterBenchTypes.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "FilterBenchTypes.h"
+
+static const uint32_t FilterBenchTypes_Quote_ops [] =
+{
+  /* Quote */
+  DDS_OP_DLC,
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (FilterBenchTypes_Quote, id),
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (FilterBenchTypes_Quote, symbol),
+  DDS_OP_ADR | DDS_OP_TYPE_ENU | (2 << DDS_OP_FLAG_SZ_SHIFT), offsetof (FilterBenchTypes_Quote, side), 1u,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (FilterBenchTypes_Quote, price),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (FilterBenchTypes_Quote, volume),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_1BY, offsetof (FilterBenchTypes_Quote, payload),
+  DDS_OP_RTS,
+  
+  /* key: id */
+  DDS_OP_KOF | 1, 1u /* order: 0 */
+};
+
+static const dds_key_descriptor_t FilterBenchTypes_Quote_keys[1] =
+{
+  { "id", 15, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 85c5658c0af5fe9e9ab822487c86] (#deps: 1)
+   - [MINIMAL ee63b7c2bb3fec979db956ea8609]
+  [COMPLETE 30406a1ff58ac618c89ca6cdbe0d] (#deps: 1)
+   - [COMPLETE 42c7497ae976c8c46dfb865e8b11]
+*/
+#define TYPE_INFO_CDR_FilterBenchTypes_Quote (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x85, 0xc5, 0x65, 0x8c, 0x0a, 0xf5, 0xfe, 0x9e, 0x9a, 0xb8, 0x22, \
+  0x48, 0x7c, 0x86, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xee, 0x63, 0xb7, 0xc2, 0xbb, 0x3f, 0xec, \
+  0x97, 0x9d, 0xb9, 0x56, 0xea, 0x86, 0x09, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x40, 0x6a, \
+  0x1f, 0xf5, 0x8a, 0xc6, 0x18, 0xc8, 0x9c, 0xa6, 0xcd, 0xbe, 0x0d, 0x00, 0xe2, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x42, 0xc7, 0x49, 0x7a, 0xe9, 0x76, 0xc8, 0xc4, 0x6d, 0xfb, 0x86, 0x5e, 0x8b, 0x11, 0x00, \
+  0x6a, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_FilterBenchTypes_Quote 148u
+#define TYPE_MAP_CDR_FilterBenchTypes_Quote (unsigned char []){ \
+  0xee, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x85, 0xc5, 0x65, 0x8c, 0x0a, 0xf5, 0xfe, \
+  0x9e, 0x9a, 0xb8, 0x22, 0x48, 0x7c, 0x86, 0x00, 0x88, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x02, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0xb8, 0x0b, 0xb7, 0x74, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0x97, 0xbf, 0xf2, 0x68, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xee, 0x63, 0xb7, 0xc2, 0xbb, \
+  0x3f, 0xec, 0x97, 0x9d, 0xb9, 0x56, 0xea, 0x86, 0x09, 0x9c, 0x62, 0xad, 0x1f, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x78, 0xa5, 0xeb, 0x43, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x21, 0x0a, 0xb9, 0xe7, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x02, \
+  0x32, 0x1c, 0x3c, 0xf4, 0xf1, 0xee, 0x63, 0xb7, 0xc2, 0xbb, 0x3f, 0xec, 0x97, 0x9d, 0xb9, 0x56, \
+  0xea, 0x86, 0x09, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x40, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x20, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x61, 0x3d, 0x5a, 0x00, 0x00, \
+  0x0e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xb7, \
+  0x30, 0xca, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x40, 0x6a, \
+  0x1f, 0xf5, 0x8a, 0xc6, 0x18, 0xc8, 0x9c, 0xa6, 0xcd, 0xbe, 0x0d, 0x00, 0xde, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x02, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, \
+  0x46, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x42, 0x65, 0x6e, 0x63, 0x68, 0x54, 0x79, 0x70, 0x65, 0x73, \
+  0x3a, 0x3a, 0x51, 0x75, 0x6f, 0x74, 0x65, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x04, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x70, 0x00, 0x07, 0x00, 0x00, 0x00, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x42, \
+  0xc7, 0x49, 0x7a, 0xe9, 0x76, 0xc8, 0xc4, 0x6d, 0xfb, 0x86, 0x5e, 0x8b, 0x11, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x73, 0x69, 0x64, 0x65, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x06, 0x00, 0x00, 0x00, 0x70, 0x72, 0x69, 0x63, \
+  0x65, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x76, 0x6f, 0x6c, 0x75, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x1a, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x02, \
+  0x08, 0x00, 0x00, 0x00, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x00, 0x00, 0x00, 0xf2, 0x42, \
+  0xc7, 0x49, 0x7a, 0xe9, 0x76, 0xc8, 0xc4, 0x6d, 0xfb, 0x86, 0x5e, 0x8b, 0x11, 0x00, 0x00, 0x00, \
+  0x66, 0x00, 0x00, 0x00, 0xf2, 0x40, 0x01, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, \
+  0x17, 0x00, 0x00, 0x00, 0x46, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x42, 0x65, 0x6e, 0x63, 0x68, 0x54, \
+  0x79, 0x70, 0x65, 0x73, 0x3a, 0x3a, 0x53, 0x69, 0x64, 0x65, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x42, 0x49, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x41, 0x53, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x30, 0x40, 0x6a, 0x1f, 0xf5, 0x8a, 0xc6, 0x18, 0xc8, 0x9c, 0xa6, \
+  0xcd, 0xbe, 0x0d, 0xf1, 0x85, 0xc5, 0x65, 0x8c, 0x0a, 0xf5, 0xfe, 0x9e, 0x9a, 0xb8, 0x22, 0x48, \
+  0x7c, 0x86, 0xf2, 0x42, 0xc7, 0x49, 0x7a, 0xe9, 0x76, 0xc8, 0xc4, 0x6d, 0xfb, 0x86, 0x5e, 0x8b, \
+  0x11, 0xf1, 0xee, 0x63, 0xb7, 0xc2, 0xbb, 0x3f, 0xec, 0x97, 0x9d, 0xb9, 0x56, 0xea, 0x86, 0x09\
+}
+#define TYPE_MAP_CDR_SZ_FilterBenchTypes_Quote 688u
+const dds_topic_descriptor_t FilterBenchTypes_Quote_desc =
+{
+  .m_size = sizeof (FilterBenchTypes_Quote),
+  .m_align = dds_alignof (FilterBenchTypes_Quote),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "FilterBenchTypes::Quote",
+  .m_keys = FilterBenchTypes_Quote_keys,
+  .m_nops = 8,
+  .m_ops = FilterBenchTypes_Quote_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_FilterBenchTypes_Quote, .sz = TYPE_INFO_CDR_SZ_FilterBenchTypes_Quote },
+  .type_mapping = { .data = TYPE_MAP_CDR_FilterBenchTypes_Quote, .sz = TYPE_MAP_CDR_SZ_FilterBenchTypes_Quote }
+};
+
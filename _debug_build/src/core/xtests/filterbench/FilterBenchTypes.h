@@ -0,0 +1,66 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_debug_build/src/core/xtests/filterbench/FilterBenchTypes.h
+  Source: /root/repo/src/core/xtests/filterbench/FilterBenchTypes.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#ifndef DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_XTESTS_FILTERBENCH_FILTERBENCHTYPES_H
+#define DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_XTESTS_FILTERBENCH_FILTERBENCHTYPES_H
+
+#include "dds/ddsc/dds_public_impl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum FilterBenchTypes_Side
+{
+  FilterBenchTypes_BID,
+  FilterBenchTypes_ASK
+} FilterBenchTypes_Side;
+
+#define FilterBenchTypes_Side__alloc() \
+((FilterBenchTypes_Side*) dds_alloc (sizeof (FilterBenchTypes_Side)));
+
+#ifndef DDS_SEQUENCE_OCTET_DEFINED
+#define DDS_SEQUENCE_OCTET_DEFINED
+typedef struct dds_sequence_octet
+{
+  uint32_t _maximum;
+  uint32_t _length;
+  uint8_t *_buffer;
+  bool _release;
+} dds_sequence_octet;
+
+#define dds_sequence_octet__alloc() \
+((dds_sequence_octet*) dds_alloc (sizeof (dds_sequence_octet)));
+
+#define dds_sequence_octet_allocbuf(l) \
+((uint8_t *) dds_alloc ((l) * sizeof (uint8_t)))
+#endif /* DDS_SEQUENCE_OCTET_DEFINED */
+
+typedef struct FilterBenchTypes_Quote
+{
+  int32_t id;
+  char * symbol;
+  FilterBenchTypes_Side side;
+  double price;
+  int32_t volume;
+  dds_sequence_octet payload;
+} FilterBenchTypes_Quote;
+
+extern const dds_topic_descriptor_t FilterBenchTypes_Quote_desc;
+
+#define FilterBenchTypes_Quote__alloc() \
+((FilterBenchTypes_Quote*) dds_alloc (sizeof (FilterBenchTypes_Quote)));
+
+#define FilterBenchTypes_Quote_free(d,o) \
+dds_sample_free ((d), &FilterBenchTypes_Quote_desc, (o))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DDSC__ROOT_REPO__DEBUG_BUILD_SRC_CORE_XTESTS_FILTERBENCH_FILTERBENCHTYPES_H */
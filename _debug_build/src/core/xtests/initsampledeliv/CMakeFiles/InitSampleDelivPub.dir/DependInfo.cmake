@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_debug_build/src/core/xtests/initsampledeliv/InitSampleDelivData.c" "src/core/xtests/initsampledeliv/CMakeFiles/InitSampleDelivPub.dir/InitSampleDelivData.c.o" "gcc" "src/core/xtests/initsampledeliv/CMakeFiles/InitSampleDelivPub.dir/InitSampleDelivData.c.o.d"
+  "/root/repo/src/core/xtests/initsampledeliv/publisher.c" "src/core/xtests/initsampledeliv/CMakeFiles/InitSampleDelivPub.dir/publisher.c.o" "gcc" "src/core/xtests/initsampledeliv/CMakeFiles/InitSampleDelivPub.dir/publisher.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_debug_build/src/core/xtests/initsampledeliv/InitSampleDelivData.h" "/root/repo/_debug_build/src/core/xtests/initsampledeliv/InitSampleDelivData.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/src/core/CMakeFiles/ddsc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
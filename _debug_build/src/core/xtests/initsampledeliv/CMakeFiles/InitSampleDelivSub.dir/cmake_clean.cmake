@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../../bin/InitSampleDelivSub"
+  "../../../../bin/InitSampleDelivSub.pdb"
+  "CMakeFiles/InitSampleDelivSub.dir/InitSampleDelivData.c.o"
+  "CMakeFiles/InitSampleDelivSub.dir/InitSampleDelivData.c.o.d"
+  "CMakeFiles/InitSampleDelivSub.dir/subscriber.c.o"
+  "CMakeFiles/InitSampleDelivSub.dir/subscriber.c.o.d"
+  "InitSampleDelivData.c"
+  "InitSampleDelivData.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/InitSampleDelivSub.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/InitSampleDeliv_lib_generate"
+  "InitSampleDelivData.c"
+  "InitSampleDelivData.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/InitSampleDeliv_lib_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/core/xtests/initsampledeliv
+# Build directory: /root/repo/_debug_build/src/core/xtests/initsampledeliv
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
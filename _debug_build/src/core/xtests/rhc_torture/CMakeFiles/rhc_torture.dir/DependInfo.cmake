@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_debug_build/src/core/xtests/rhc_torture/RhcTypes.c" "src/core/xtests/rhc_torture/CMakeFiles/rhc_torture.dir/RhcTypes.c.o" "gcc" "src/core/xtests/rhc_torture/CMakeFiles/rhc_torture.dir/RhcTypes.c.o.d"
+  "/root/repo/src/core/xtests/rhc_torture/rhc_torture.c" "src/core/xtests/rhc_torture/CMakeFiles/rhc_torture.dir/rhc_torture.c.o" "gcc" "src/core/xtests/rhc_torture/CMakeFiles/rhc_torture.dir/rhc_torture.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_debug_build/src/core/xtests/rhc_torture/RhcTypes.h" "/root/repo/_debug_build/src/core/xtests/rhc_torture/RhcTypes.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/src/core/CMakeFiles/ddsc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../../bin/rhc_torture"
+  "../../../../bin/rhc_torture.pdb"
+  "CMakeFiles/rhc_torture.dir/RhcTypes.c.o"
+  "CMakeFiles/rhc_torture.dir/RhcTypes.c.o.d"
+  "CMakeFiles/rhc_torture.dir/rhc_torture.c.o"
+  "CMakeFiles/rhc_torture.dir/rhc_torture.c.o.d"
+  "RhcTypes.c"
+  "RhcTypes.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/rhc_torture.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/symbol_export_test"
+  "../../../../bin/symbol_export_test.pdb"
+  "CMakeFiles/symbol_export_test.dir/symbol_export.c.o"
+  "CMakeFiles/symbol_export_test.dir/symbol_export.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/symbol_export_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/core/xtests/symbol_export
+# Build directory: /root/repo/_debug_build/src/core/xtests/symbol_export
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../../../bin/xpackbench"
+  "../../../../bin/xpackbench.pdb"
+  "CMakeFiles/xpackbench.dir/xpackbench.c.o"
+  "CMakeFiles/xpackbench.dir/xpackbench.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/xpackbench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,85 @@
+file(REMOVE_RECURSE
+  "../../lib/libddsrt-internal.a"
+  "../../lib/libddsrt-internal.pdb"
+  "CMakeFiles/ddsrt-internal.dir/src/atomics.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/atomics.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/avl.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/avl.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/bits.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/bits.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/bswap.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/bswap.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/cdtors.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/cdtors.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/circlist.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/circlist.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/dynlib/posix/dynlib.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/dynlib/posix/dynlib.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/environ.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/environ.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/environ/posix/environ.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/environ/posix/environ.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/expand_vars.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/expand_vars.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/fibheap.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/fibheap.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/filesystem/posix/filesystem.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/filesystem/posix/filesystem.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/heap/posix/heap.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/heap/posix/heap.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/hopscotch.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/hopscotch.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/ifaddrs.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/ifaddrs.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/ifaddrs/posix/ifaddrs.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/ifaddrs/posix/ifaddrs.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/io.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/io.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/log.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/log.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/md5.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/md5.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/mh3.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/mh3.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/netstat/linux/netstat.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/netstat/linux/netstat.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/process/posix/process.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/process/posix/process.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/random.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/random.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/random/posix/random.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/random/posix/random.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/retcode.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/retcode.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/rusage/posix/rusage.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/rusage/posix/rusage.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/sockets.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/sockets.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/sockets/posix/gethostname.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/sockets/posix/gethostname.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/sockets/posix/socket.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/sockets/posix/socket.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/string.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/string.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/strtod.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/strtod.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/strtol.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/strtol.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/sync/posix/sync.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/sync/posix/sync.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/threads.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/threads.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/threads/posix/threads.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/threads/posix/threads.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/time.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/time.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/time/posix/time.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/time/posix/time.c.o.d"
+  "CMakeFiles/ddsrt-internal.dir/src/xmlparser.c.o"
+  "CMakeFiles/ddsrt-internal.dir/src/xmlparser.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ddsrt-internal.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
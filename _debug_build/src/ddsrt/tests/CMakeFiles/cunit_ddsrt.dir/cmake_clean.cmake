@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "../../../bin/cunit_ddsrt"
+  "../../../bin/cunit_ddsrt.pdb"
+  "CMakeFiles/cunit_ddsrt.dir/atomics.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/atomics.c.o.d"
+  "CMakeFiles/cunit_ddsrt.dir/bits.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/bits.c.o.d"
+  "CMakeFiles/cunit_ddsrt.dir/cunit_ddsrt.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/cunit_ddsrt.c.o.d"
+  "CMakeFiles/cunit_ddsrt.dir/environ.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/environ.c.o.d"
+  "CMakeFiles/cunit_ddsrt.dir/heap.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/heap.c.o.d"
+  "CMakeFiles/cunit_ddsrt.dir/hopscotch.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/hopscotch.c.o.d"
+  "CMakeFiles/cunit_ddsrt.dir/ifaddrs.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/ifaddrs.c.o.d"
+  "CMakeFiles/cunit_ddsrt.dir/log.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/log.c.o.d"
+  "CMakeFiles/cunit_ddsrt.dir/random.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/random.c.o.d"
+  "CMakeFiles/cunit_ddsrt.dir/retcode.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/retcode.c.o.d"
+  "CMakeFiles/cunit_ddsrt.dir/select.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/select.c.o.d"
+  "CMakeFiles/cunit_ddsrt.dir/socket.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/socket.c.o.d"
+  "CMakeFiles/cunit_ddsrt.dir/string.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/string.c.o.d"
+  "CMakeFiles/cunit_ddsrt.dir/strlcpy.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/strlcpy.c.o.d"
+  "CMakeFiles/cunit_ddsrt.dir/strtoll.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/strtoll.c.o.d"
+  "CMakeFiles/cunit_ddsrt.dir/sync.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/sync.c.o.d"
+  "CMakeFiles/cunit_ddsrt.dir/thread.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/thread.c.o.d"
+  "CMakeFiles/cunit_ddsrt.dir/thread_cleanup.c.o"
+  "CMakeFiles/cunit_ddsrt.dir/thread_cleanup.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cunit_ddsrt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
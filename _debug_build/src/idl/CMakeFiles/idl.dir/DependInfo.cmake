@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/idl/src/annotation.c" "src/idl/CMakeFiles/idl.dir/src/annotation.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/annotation.c.o.d"
+  "/root/repo/src/idl/src/directive.c" "src/idl/CMakeFiles/idl.dir/src/directive.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/directive.c.o.d"
+  "/root/repo/src/idl/src/expression.c" "src/idl/CMakeFiles/idl.dir/src/expression.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/expression.c.o.d"
+  "/root/repo/src/idl/src/file.c" "src/idl/CMakeFiles/idl.dir/src/file.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/file.c.o.d"
+  "/root/repo/src/idl/src/hashid.c" "src/idl/CMakeFiles/idl.dir/src/hashid.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/hashid.c.o.d"
+  "/root/repo/src/idl/src/heap.c" "src/idl/CMakeFiles/idl.dir/src/heap.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/heap.c.o.d"
+  "/root/repo/src/idl/src/keylist.c" "src/idl/CMakeFiles/idl.dir/src/keylist.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/keylist.c.o.d"
+  "/root/repo/_debug_build/src/idl/src/md5.c" "src/idl/CMakeFiles/idl.dir/src/md5.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/md5.c.o.d"
+  "/root/repo/_debug_build/src/idl/src/parser.c" "src/idl/CMakeFiles/idl.dir/src/parser.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/parser.c.o.d"
+  "/root/repo/src/idl/src/print.c" "src/idl/CMakeFiles/idl.dir/src/print.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/print.c.o.d"
+  "/root/repo/src/idl/src/processor.c" "src/idl/CMakeFiles/idl.dir/src/processor.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/processor.c.o.d"
+  "/root/repo/src/idl/src/scanner.c" "src/idl/CMakeFiles/idl.dir/src/scanner.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/scanner.c.o.d"
+  "/root/repo/src/idl/src/scope.c" "src/idl/CMakeFiles/idl.dir/src/scope.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/scope.c.o.d"
+  "/root/repo/src/idl/src/string.c" "src/idl/CMakeFiles/idl.dir/src/string.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/string.c.o.d"
+  "/root/repo/src/idl/src/symbol.c" "src/idl/CMakeFiles/idl.dir/src/symbol.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/symbol.c.o.d"
+  "/root/repo/src/idl/src/tree.c" "src/idl/CMakeFiles/idl.dir/src/tree.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/tree.c.o.d"
+  "/root/repo/src/idl/src/vector.c" "src/idl/CMakeFiles/idl.dir/src/vector.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/vector.c.o.d"
+  "/root/repo/src/idl/src/visit.c" "src/idl/CMakeFiles/idl.dir/src/visit.c.o" "gcc" "src/idl/CMakeFiles/idl.dir/src/visit.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_debug_build/lib/libcycloneddsidl.so" "/root/repo/_debug_build/lib/libcycloneddsidl.so.0.11.0"
+  "/root/repo/_debug_build/lib/libcycloneddsidl.so.0" "/root/repo/_debug_build/lib/libcycloneddsidl.so.0.11.0"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
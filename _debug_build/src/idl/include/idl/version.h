@@ -0,0 +1,21 @@
+/*
+ * Copyright(c) 2021 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#ifndef IDL_VERSION_H
+#define IDL_VERSION_H
+
+#define IDL_VERSION "0.11.0"
+#define IDL_VERSION_MAJOR 0
+#define IDL_VERSION_MINOR 11
+#define IDL_VERSION_PATCH 0
+#define IDL_VERSION_TWEAK 
+
+#endif /* IDL_VERSION_H */
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "../../../bin/cunit_idl"
+  "../../../bin/cunit_idl.pdb"
+  "CMakeFiles/cunit_idl.dir/annotation.c.o"
+  "CMakeFiles/cunit_idl.dir/annotation.c.o.d"
+  "CMakeFiles/cunit_idl.dir/cunit_idl.c.o"
+  "CMakeFiles/cunit_idl.dir/cunit_idl.c.o.d"
+  "CMakeFiles/cunit_idl.dir/enum.c.o"
+  "CMakeFiles/cunit_idl.dir/enum.c.o.d"
+  "CMakeFiles/cunit_idl.dir/expression.c.o"
+  "CMakeFiles/cunit_idl.dir/expression.c.o.d"
+  "CMakeFiles/cunit_idl.dir/file.c.o"
+  "CMakeFiles/cunit_idl.dir/file.c.o.d"
+  "CMakeFiles/cunit_idl.dir/forward.c.o"
+  "CMakeFiles/cunit_idl.dir/forward.c.o.d"
+  "CMakeFiles/cunit_idl.dir/inheritance.c.o"
+  "CMakeFiles/cunit_idl.dir/inheritance.c.o.d"
+  "CMakeFiles/cunit_idl.dir/module.c.o"
+  "CMakeFiles/cunit_idl.dir/module.c.o.d"
+  "CMakeFiles/cunit_idl.dir/parser.c.o"
+  "CMakeFiles/cunit_idl.dir/parser.c.o.d"
+  "CMakeFiles/cunit_idl.dir/pragma.c.o"
+  "CMakeFiles/cunit_idl.dir/pragma.c.o.d"
+  "CMakeFiles/cunit_idl.dir/scanner.c.o"
+  "CMakeFiles/cunit_idl.dir/scanner.c.o.d"
+  "CMakeFiles/cunit_idl.dir/typedef.c.o"
+  "CMakeFiles/cunit_idl.dir/typedef.c.o.d"
+  "CMakeFiles/cunit_idl.dir/union.c.o"
+  "CMakeFiles/cunit_idl.dir/union.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cunit_idl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,250 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/idl/tests
+# Build directory: /root/repo/_debug_build/src/idl/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(CUnit_idl_file_untaint "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_file" "-t" "untaint")
+set_tests_properties(CUnit_idl_file_untaint PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_file_normalize_empty "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_file" "-t" "normalize_empty")
+set_tests_properties(CUnit_idl_file_normalize_empty PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_file_normalize_revert "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_file" "-t" "normalize_revert")
+set_tests_properties(CUnit_idl_file_normalize_revert PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_file_normalize_revert_too_many "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_file" "-t" "normalize_revert_too_many")
+set_tests_properties(CUnit_idl_file_normalize_revert_too_many PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_file_relative_bad_params "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_file" "-t" "relative_bad_params")
+set_tests_properties(CUnit_idl_file_relative_bad_params PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_file_relative "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_file" "-t" "relative")
+set_tests_properties(CUnit_idl_file_relative PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_file_out_file_generation "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_file" "-t" "out_file_generation")
+set_tests_properties(CUnit_idl_file_out_file_generation PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_blank "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "blank")
+set_tests_properties(CUnit_idl_scanner_blank PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_blank_cseq "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "blank_cseq")
+set_tests_properties(CUnit_idl_scanner_blank_cseq PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_blank_wsp_cseq_wsp "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "blank_wsp_cseq_wsp")
+set_tests_properties(CUnit_idl_scanner_blank_wsp_cseq_wsp PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_blank_2x_cseq "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "blank_2x_cseq")
+set_tests_properties(CUnit_idl_scanner_blank_2x_cseq PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_line_comment "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "line_comment")
+set_tests_properties(CUnit_idl_scanner_line_comment PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_line_comment_wrp_cseq "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "line_comment_wrp_cseq")
+set_tests_properties(CUnit_idl_scanner_line_comment_wrp_cseq PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_line_comment_wrp_cseq_ident "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "line_comment_wrp_cseq_ident")
+set_tests_properties(CUnit_idl_scanner_line_comment_wrp_cseq_ident PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_comment "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "comment")
+set_tests_properties(CUnit_idl_scanner_comment PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_comment_x "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "comment_x")
+set_tests_properties(CUnit_idl_scanner_comment_x PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_comment_wrp_cseq "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "comment_wrp_cseq")
+set_tests_properties(CUnit_idl_scanner_comment_wrp_cseq PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_comment_wrp_cseq_ident "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "comment_wrp_cseq_ident")
+set_tests_properties(CUnit_idl_scanner_comment_wrp_cseq_ident PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_char_literal "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "char_literal")
+set_tests_properties(CUnit_idl_scanner_char_literal PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_char_literal_wrp_cseq "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "char_literal_wrp_cseq")
+set_tests_properties(CUnit_idl_scanner_char_literal_wrp_cseq PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_string_literal "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "string_literal")
+set_tests_properties(CUnit_idl_scanner_string_literal PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_string_literal_wrp_seq "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "string_literal_wrp_seq")
+set_tests_properties(CUnit_idl_scanner_string_literal_wrp_seq PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_integer_literal "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "integer_literal")
+set_tests_properties(CUnit_idl_scanner_integer_literal PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_integer_literal_hex_dot "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "integer_literal_hex_dot")
+set_tests_properties(CUnit_idl_scanner_integer_literal_hex_dot PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_floating_pt_literal "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "floating_pt_literal")
+set_tests_properties(CUnit_idl_scanner_floating_pt_literal PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_floating_pt_literal_dot_fraction "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "floating_pt_literal_dot_fraction")
+set_tests_properties(CUnit_idl_scanner_floating_pt_literal_dot_fraction PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_floating_pt_literal_int_dot_fraction_exp "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "floating_pt_literal_int_dot_fraction_exp")
+set_tests_properties(CUnit_idl_scanner_floating_pt_literal_int_dot_fraction_exp PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_floating_pt_literal_int_dot_fraction "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "floating_pt_literal_int_dot_fraction")
+set_tests_properties(CUnit_idl_scanner_floating_pt_literal_int_dot_fraction PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_ident "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "ident")
+set_tests_properties(CUnit_idl_scanner_ident PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_ident_tr_cseq "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "ident_tr_cseq")
+set_tests_properties(CUnit_idl_scanner_ident_tr_cseq PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_ident_wrp_cseq "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "ident_wrp_cseq")
+set_tests_properties(CUnit_idl_scanner_ident_wrp_cseq PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_scope "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "scope")
+set_tests_properties(CUnit_idl_scanner_scope PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_scope_wrp_cseq "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "scope_wrp_cseq")
+set_tests_properties(CUnit_idl_scanner_scope_wrp_cseq PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_scope_l "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "scope_l")
+set_tests_properties(CUnit_idl_scanner_scope_l PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_scope_l_wrp_cseq "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "scope_l_wrp_cseq")
+set_tests_properties(CUnit_idl_scanner_scope_l_wrp_cseq PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_scope_non_l "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "scope_non_l")
+set_tests_properties(CUnit_idl_scanner_scope_non_l PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_scope_r "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "scope_r")
+set_tests_properties(CUnit_idl_scanner_scope_r PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_scope_r_wrp_cseq "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "scope_r_wrp_cseq")
+set_tests_properties(CUnit_idl_scanner_scope_r_wrp_cseq PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_scope_non_r "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "scope_non_r")
+set_tests_properties(CUnit_idl_scanner_scope_non_r PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_scope_lr "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "scope_lr")
+set_tests_properties(CUnit_idl_scanner_scope_lr PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_scope_lr_wrp_cseq "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "scope_lr_wrp_cseq")
+set_tests_properties(CUnit_idl_scanner_scope_lr_wrp_cseq PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_scope_non_lr "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "scope_non_lr")
+set_tests_properties(CUnit_idl_scanner_scope_non_lr PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_scope_non_lr_l "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "scope_non_lr_l")
+set_tests_properties(CUnit_idl_scanner_scope_non_lr_l PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_scope_non_lr_r "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "scope_non_lr_r")
+set_tests_properties(CUnit_idl_scanner_scope_non_lr_r PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_hash_line "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "hash_line")
+set_tests_properties(CUnit_idl_scanner_hash_line PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_scanner_hash_pragma "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_scanner" "-t" "hash_pragma")
+set_tests_properties(CUnit_idl_scanner_hash_pragma PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_hashid_color "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_hashid" "-t" "color")
+set_tests_properties(CUnit_idl_hashid_color PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_hashid_shapesize "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_hashid" "-t" "shapesize")
+set_tests_properties(CUnit_idl_hashid_shapesize PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_optional "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "optional")
+set_tests_properties(CUnit_idl_annotation_optional PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_idl_default "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "idl_default")
+set_tests_properties(CUnit_idl_annotation_idl_default PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_default_literal "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "default_literal")
+set_tests_properties(CUnit_idl_annotation_default_literal PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_key "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "key")
+set_tests_properties(CUnit_idl_annotation_key PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_nested "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "nested")
+set_tests_properties(CUnit_idl_annotation_nested PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_topic "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "topic")
+set_tests_properties(CUnit_idl_annotation_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_default_nested "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "default_nested")
+set_tests_properties(CUnit_idl_annotation_default_nested PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_redefinition "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "redefinition")
+set_tests_properties(CUnit_idl_annotation_redefinition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_id "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "id")
+set_tests_properties(CUnit_idl_annotation_id PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_hashid "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "hashid")
+set_tests_properties(CUnit_idl_annotation_hashid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_autoid_struct "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "autoid_struct")
+set_tests_properties(CUnit_idl_annotation_autoid_struct PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_autoid_union "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "autoid_union")
+set_tests_properties(CUnit_idl_annotation_autoid_union PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_autoid_inheritance "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "autoid_inheritance")
+set_tests_properties(CUnit_idl_annotation_autoid_inheritance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_autoid_module "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "autoid_module")
+set_tests_properties(CUnit_idl_annotation_autoid_module PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_extensibility "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "extensibility")
+set_tests_properties(CUnit_idl_annotation_extensibility PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_parameter_scope "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "parameter_scope")
+set_tests_properties(CUnit_idl_annotation_parameter_scope PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_bit_bound "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "bit_bound")
+set_tests_properties(CUnit_idl_annotation_bit_bound PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_position "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "position")
+set_tests_properties(CUnit_idl_annotation_position PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_must_understand "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "must_understand")
+set_tests_properties(CUnit_idl_annotation_must_understand PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_try_construct "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "try_construct")
+set_tests_properties(CUnit_idl_annotation_try_construct PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_limits "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "limits")
+set_tests_properties(CUnit_idl_annotation_limits PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_units "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "units")
+set_tests_properties(CUnit_idl_annotation_units PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_data_representation "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "data_representation")
+set_tests_properties(CUnit_idl_annotation_data_representation PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_annotation_idl_is_string_fix "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_annotation" "-t" "idl_is_string_fix")
+set_tests_properties(CUnit_idl_annotation_idl_is_string_fix PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_expression_character "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_expression" "-t" "character")
+set_tests_properties(CUnit_idl_expression_character PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_expression_octet "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_expression" "-t" "octet")
+set_tests_properties(CUnit_idl_expression_octet PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_inheritance_extensibility "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_inheritance" "-t" "extensibility")
+set_tests_properties(CUnit_idl_inheritance_extensibility PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_inheritance_members "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_inheritance" "-t" "members")
+set_tests_properties(CUnit_idl_inheritance_members PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_inheritance_empty_structs "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_inheritance" "-t" "empty_structs")
+set_tests_properties(CUnit_idl_inheritance_empty_structs PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_parser_embedded_module "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_parser" "-t" "embedded_module")
+set_tests_properties(CUnit_idl_parser_embedded_module PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_parser_name_collision "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_parser" "-t" "name_collision")
+set_tests_properties(CUnit_idl_parser_name_collision PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_parser_struct_in_struct_same_module "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_parser" "-t" "struct_in_struct_same_module")
+set_tests_properties(CUnit_idl_parser_struct_in_struct_same_module PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_parser_struct_in_struct_other_module "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_parser" "-t" "struct_in_struct_other_module")
+set_tests_properties(CUnit_idl_parser_struct_in_struct_other_module PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_parser_require_xcdr2 "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_parser" "-t" "require_xcdr2")
+set_tests_properties(CUnit_idl_parser_require_xcdr2 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_parser_bit_bound_validation "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_parser" "-t" "bit_bound_validation")
+set_tests_properties(CUnit_idl_parser_bit_bound_validation PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_parser_base_types "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_parser" "-t" "base_types")
+set_tests_properties(CUnit_idl_parser_base_types PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_parser_extended_base_types "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_parser" "-t" "extended_base_types")
+set_tests_properties(CUnit_idl_parser_extended_base_types PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_typedef_bogus_type "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_typedef" "-t" "bogus_type")
+set_tests_properties(CUnit_idl_typedef_bogus_type PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_typedef_simple_declarator "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_typedef" "-t" "simple_declarator")
+set_tests_properties(CUnit_idl_typedef_simple_declarator PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_typedef_simple_declarators "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_typedef" "-t" "simple_declarators")
+set_tests_properties(CUnit_idl_typedef_simple_declarators PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_typedef_sequence "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_typedef" "-t" "sequence")
+set_tests_properties(CUnit_idl_typedef_sequence PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_typedef_typedef_of_typedef_sequence "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_typedef" "-t" "typedef_of_typedef_sequence")
+set_tests_properties(CUnit_idl_typedef_typedef_of_typedef_sequence PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_typedef_forward_declaration "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_typedef" "-t" "forward_declaration")
+set_tests_properties(CUnit_idl_typedef_forward_declaration PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_typedef_backwards_forward_declaration "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_typedef" "-t" "backwards_forward_declaration")
+set_tests_properties(CUnit_idl_typedef_backwards_forward_declaration PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_typedef_constructed_type "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_typedef" "-t" "constructed_type")
+set_tests_properties(CUnit_idl_typedef_constructed_type PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_typedef_scoped_name "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_typedef" "-t" "scoped_name")
+set_tests_properties(CUnit_idl_typedef_scoped_name PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_union_no_case "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_union" "-t" "no_case")
+set_tests_properties(CUnit_idl_union_no_case PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_union_name_clash "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_union" "-t" "name_clash")
+set_tests_properties(CUnit_idl_union_name_clash PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_union_single_case "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_union" "-t" "single_case")
+set_tests_properties(CUnit_idl_union_single_case PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_union_single_default_case "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_union" "-t" "single_default_case")
+set_tests_properties(CUnit_idl_union_single_default_case PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_union_enumerator_switch_type "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_union" "-t" "enumerator_switch_type")
+set_tests_properties(CUnit_idl_union_enumerator_switch_type PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_union_typedef_switch_types "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_union" "-t" "typedef_switch_types")
+set_tests_properties(CUnit_idl_union_typedef_switch_types PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_union_default_discriminator_bool "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_union" "-t" "default_discriminator_bool")
+set_tests_properties(CUnit_idl_union_default_discriminator_bool PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_union_default_discriminator_signed_int "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_union" "-t" "default_discriminator_signed_int")
+set_tests_properties(CUnit_idl_union_default_discriminator_signed_int PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_union_default_discriminator_unsigned_int "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_union" "-t" "default_discriminator_unsigned_int")
+set_tests_properties(CUnit_idl_union_default_discriminator_unsigned_int PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_union_default_discriminator_enum "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_union" "-t" "default_discriminator_enum")
+set_tests_properties(CUnit_idl_union_default_discriminator_enum PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_union_two_unions_one_enum "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_union" "-t" "two_unions_one_enum")
+set_tests_properties(CUnit_idl_union_two_unions_one_enum PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_union_bad_switch_types "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_union" "-t" "bad_switch_types")
+set_tests_properties(CUnit_idl_union_bad_switch_types PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_enum_no_enumerator "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_enum" "-t" "no_enumerator")
+set_tests_properties(CUnit_idl_enum_no_enumerator PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_enum_duplicate_enumerators "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_enum" "-t" "duplicate_enumerators")
+set_tests_properties(CUnit_idl_enum_duplicate_enumerators PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_enum_enumerator_matches_enum "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_enum" "-t" "enumerator_matches_enum")
+set_tests_properties(CUnit_idl_enum_enumerator_matches_enum PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_enum_single_enumerator "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_enum" "-t" "single_enumerator")
+set_tests_properties(CUnit_idl_enum_single_enumerator PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_enum_multiple_enumerators "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_enum" "-t" "multiple_enumerators")
+set_tests_properties(CUnit_idl_enum_multiple_enumerators PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_pragma_keylist_bad_use "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_pragma" "-t" "keylist_bad_use")
+set_tests_properties(CUnit_idl_pragma_keylist_bad_use PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_pragma_keylist "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_pragma" "-t" "keylist")
+set_tests_properties(CUnit_idl_pragma_keylist PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_pragma_keylist_nested_key "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_pragma" "-t" "keylist_nested_key")
+set_tests_properties(CUnit_idl_pragma_keylist_nested_key PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_pragma_keylist_conflicting "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_pragma" "-t" "keylist_conflicting")
+set_tests_properties(CUnit_idl_pragma_keylist_conflicting PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_pragma_keylist_scoped_name "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_pragma" "-t" "keylist_scoped_name")
+set_tests_properties(CUnit_idl_pragma_keylist_scoped_name PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_pragma_keylist_outer_scope "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_pragma" "-t" "keylist_outer_scope")
+set_tests_properties(CUnit_idl_pragma_keylist_outer_scope PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_pragma_unknown "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_pragma" "-t" "unknown")
+set_tests_properties(CUnit_idl_pragma_unknown PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_module_reopen "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_module" "-t" "reopen")
+set_tests_properties(CUnit_idl_module_reopen PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_forward_struct_union_maybe_enum "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_forward" "-t" "struct_union_maybe_enum")
+set_tests_properties(CUnit_idl_forward_struct_union_maybe_enum PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_forward_aliases "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_forward" "-t" "aliases")
+set_tests_properties(CUnit_idl_forward_aliases PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
+add_test(CUnit_idl_forward_backwards_aliases "/root/repo/_debug_build/bin/cunit_idl" "-s" "idl_forward" "-t" "backwards_aliases")
+set_tests_properties(CUnit_idl_forward_backwards_aliases PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/idl/tests/CMakeLists.txt;14;add_cunit_executable;/root/repo/src/idl/tests/CMakeLists.txt;0;")
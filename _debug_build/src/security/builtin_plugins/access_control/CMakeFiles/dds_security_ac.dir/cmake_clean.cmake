@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "../../../../lib/libdds_security_ac.pdb"
+  "../../../../lib/libdds_security_ac.so"
+  "CMakeFiles/dds_security_ac.dir/__/__/openssl/src/openssl_support.c.o"
+  "CMakeFiles/dds_security_ac.dir/__/__/openssl/src/openssl_support.c.o.d"
+  "CMakeFiles/dds_security_ac.dir/src/access_control.c.o"
+  "CMakeFiles/dds_security_ac.dir/src/access_control.c.o.d"
+  "CMakeFiles/dds_security_ac.dir/src/access_control_objects.c.o"
+  "CMakeFiles/dds_security_ac.dir/src/access_control_objects.c.o.d"
+  "CMakeFiles/dds_security_ac.dir/src/access_control_parser.c.o"
+  "CMakeFiles/dds_security_ac.dir/src/access_control_parser.c.o.d"
+  "CMakeFiles/dds_security_ac.dir/src/access_control_utils.c.o"
+  "CMakeFiles/dds_security_ac.dir/src/access_control_utils.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dds_security_ac.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
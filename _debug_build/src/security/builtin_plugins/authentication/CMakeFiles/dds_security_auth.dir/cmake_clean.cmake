@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../../../lib/libdds_security_auth.pdb"
+  "../../../../lib/libdds_security_auth.so"
+  "CMakeFiles/dds_security_auth.dir/__/__/openssl/src/openssl_support.c.o"
+  "CMakeFiles/dds_security_auth.dir/__/__/openssl/src/openssl_support.c.o.d"
+  "CMakeFiles/dds_security_auth.dir/src/auth_utils.c.o"
+  "CMakeFiles/dds_security_auth.dir/src/auth_utils.c.o.d"
+  "CMakeFiles/dds_security_auth.dir/src/authentication.c.o"
+  "CMakeFiles/dds_security_auth.dir/src/authentication.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dds_security_auth.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
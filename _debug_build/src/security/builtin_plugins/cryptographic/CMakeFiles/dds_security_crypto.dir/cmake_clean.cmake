@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "../../../../lib/libdds_security_crypto.pdb"
+  "../../../../lib/libdds_security_crypto.so"
+  "CMakeFiles/dds_security_crypto.dir/__/__/openssl/src/openssl_support.c.o"
+  "CMakeFiles/dds_security_crypto.dir/__/__/openssl/src/openssl_support.c.o.d"
+  "CMakeFiles/dds_security_crypto.dir/src/crypto_cipher.c.o"
+  "CMakeFiles/dds_security_crypto.dir/src/crypto_cipher.c.o.d"
+  "CMakeFiles/dds_security_crypto.dir/src/crypto_key_exchange.c.o"
+  "CMakeFiles/dds_security_crypto.dir/src/crypto_key_exchange.c.o.d"
+  "CMakeFiles/dds_security_crypto.dir/src/crypto_key_factory.c.o"
+  "CMakeFiles/dds_security_crypto.dir/src/crypto_key_factory.c.o.d"
+  "CMakeFiles/dds_security_crypto.dir/src/crypto_objects.c.o"
+  "CMakeFiles/dds_security_crypto.dir/src/crypto_objects.c.o.d"
+  "CMakeFiles/dds_security_crypto.dir/src/crypto_transform.c.o"
+  "CMakeFiles/dds_security_crypto.dir/src/crypto_transform.c.o.d"
+  "CMakeFiles/dds_security_crypto.dir/src/crypto_utils.c.o"
+  "CMakeFiles/dds_security_crypto.dir/src/crypto_utils.c.o.d"
+  "CMakeFiles/dds_security_crypto.dir/src/cryptography.c.o"
+  "CMakeFiles/dds_security_crypto.dir/src/cryptography.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dds_security_crypto.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/security/builtin_plugins/cryptographic
+# Build directory: /root/repo/_debug_build/src/security/builtin_plugins/cryptographic
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
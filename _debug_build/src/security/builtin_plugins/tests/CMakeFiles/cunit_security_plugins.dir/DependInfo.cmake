@@ -0,0 +1,61 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/security/openssl/src/openssl_support.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/__/__/openssl/src/openssl_support.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/__/__/openssl/src/openssl_support.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/access_control_fnmatch/src/access_control_fnmatch_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/access_control_fnmatch/src/access_control_fnmatch_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/access_control_fnmatch/src/access_control_fnmatch_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/common/src/crypto_helper.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/common/src/crypto_helper.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/common/src/crypto_helper.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/common/src/handshake_helper.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/common/src/handshake_helper.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/common/src/handshake_helper.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/common/src/loader.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/common/src/loader.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/common/src/loader.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/create_local_datareader_crypto_tokens/src/create_local_datareader_crypto_tokens_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/create_local_datareader_crypto_tokens/src/create_local_datareader_crypto_tokens_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/create_local_datareader_crypto_tokens/src/create_local_datareader_crypto_tokens_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/create_local_datawriter_crypto_tokens/src/create_local_datawriter_crypto_tokens_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/create_local_datawriter_crypto_tokens/src/create_local_datawriter_crypto_tokens_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/create_local_datawriter_crypto_tokens/src/create_local_datawriter_crypto_tokens_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/create_local_participant_crypto_tokens/src/create_local_participant_crypto_tokens_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/create_local_participant_crypto_tokens/src/create_local_participant_crypto_tokens_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/create_local_participant_crypto_tokens/src/create_local_participant_crypto_tokens_utests.c.o.d"
+  "/root/repo/_debug_build/src/security/builtin_plugins/tests/cunit_security_plugins.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/cunit_security_plugins.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/cunit_security_plugins.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/decode_datareader_submessage/src/decode_datareader_submessage_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/decode_datareader_submessage/src/decode_datareader_submessage_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/decode_datareader_submessage/src/decode_datareader_submessage_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/decode_datawriter_submessage/src/decode_datawriter_submessage_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/decode_datawriter_submessage/src/decode_datawriter_submessage_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/decode_datawriter_submessage/src/decode_datawriter_submessage_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/decode_rtps_message/src/decode_rtps_message_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/decode_rtps_message/src/decode_rtps_message_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/decode_rtps_message/src/decode_rtps_message_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/decode_serialized_payload/src/decode_serialized_payload_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/decode_serialized_payload/src/decode_serialized_payload_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/decode_serialized_payload/src/decode_serialized_payload_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/encode_datareader_submessage/src/encode_datareader_submessage_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/encode_datareader_submessage/src/encode_datareader_submessage_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/encode_datareader_submessage/src/encode_datareader_submessage_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/encode_datawriter_submessage/src/encode_datawriter_submessage_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/encode_datawriter_submessage/src/encode_datawriter_submessage_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/encode_datawriter_submessage/src/encode_datawriter_submessage_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/encode_rtps_message/src/encode_rtps_message_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/encode_rtps_message/src/encode_rtps_message_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/encode_rtps_message/src/encode_rtps_message_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/encode_serialized_payload/src/encode_serialized_payload_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/encode_serialized_payload/src/encode_serialized_payload_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/encode_serialized_payload/src/encode_serialized_payload_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/get_authenticated_peer_credential_token/src/get_authenticated_peer_credential_token_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/get_authenticated_peer_credential_token/src/get_authenticated_peer_credential_token_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/get_authenticated_peer_credential_token/src/get_authenticated_peer_credential_token_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/get_permissions_credential_token/src/get_permissions_credential_token_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/get_permissions_credential_token/src/get_permissions_credential_token_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/get_permissions_credential_token/src/get_permissions_credential_token_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/get_permissions_token/src/get_permissions_token_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/get_permissions_token/src/get_permissions_token_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/get_permissions_token/src/get_permissions_token_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/get_xxx_sec_attributes/src/get_xxx_sec_attributes_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/get_xxx_sec_attributes/src/get_xxx_sec_attributes_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/get_xxx_sec_attributes/src/get_xxx_sec_attributes_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/listeners_access_control/src/listeners_access_control_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/listeners_access_control/src/listeners_access_control_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/listeners_access_control/src/listeners_access_control_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/listeners_authentication/src/listeners_authentication_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/listeners_authentication/src/listeners_authentication_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/listeners_authentication/src/listeners_authentication_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/preprocess_secure_submsg/src/preprocess_secure_submsg_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/preprocess_secure_submsg/src/preprocess_secure_submsg_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/preprocess_secure_submsg/src/preprocess_secure_submsg_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/process_handshake/src/process_handshake_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/process_handshake/src/process_handshake_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/process_handshake/src/process_handshake_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/register_local_datareader/src/register_local_datareader_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/register_local_datareader/src/register_local_datareader_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/register_local_datareader/src/register_local_datareader_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/register_local_datawriter/src/register_local_datawriter_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/register_local_datawriter/src/register_local_datawriter_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/register_local_datawriter/src/register_local_datawriter_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/register_local_participant/src/register_local_participant_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/register_local_participant/src/register_local_participant_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/register_local_participant/src/register_local_participant_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/register_matched_remote_datareader/src/register_matched_remote_datareader_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/register_matched_remote_datareader/src/register_matched_remote_datareader_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/register_matched_remote_datareader/src/register_matched_remote_datareader_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/register_matched_remote_datawriter/src/register_matched_remote_datawriter_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/register_matched_remote_datawriter/src/register_matched_remote_datawriter_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/register_matched_remote_datawriter/src/register_matched_remote_datawriter_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/register_matched_remote_participant/src/register_matched_remote_participant_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/register_matched_remote_participant/src/register_matched_remote_participant_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/register_matched_remote_participant/src/register_matched_remote_participant_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/set_remote_datareader_crypto_tokens/src/set_remote_datareader_crypto_tokens_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/set_remote_datareader_crypto_tokens/src/set_remote_datareader_crypto_tokens_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/set_remote_datareader_crypto_tokens/src/set_remote_datareader_crypto_tokens_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/set_remote_datawriter_crypto_tokens/src/set_remote_datawriter_crypto_tokens_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/set_remote_datawriter_crypto_tokens/src/set_remote_datawriter_crypto_tokens_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/set_remote_datawriter_crypto_tokens/src/set_remote_datawriter_crypto_tokens_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/set_remote_participant_crypto_tokens/src/set_remote_participant_crypto_tokens_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/set_remote_participant_crypto_tokens/src/set_remote_participant_crypto_tokens_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/set_remote_participant_crypto_tokens/src/set_remote_participant_crypto_tokens_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/validate_begin_handshake_reply/src/validate_begin_handshake_reply_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/validate_begin_handshake_reply/src/validate_begin_handshake_reply_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/validate_begin_handshake_reply/src/validate_begin_handshake_reply_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/validate_begin_handshake_request/src/validate_begin_handshake_request_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/validate_begin_handshake_request/src/validate_begin_handshake_request_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/validate_begin_handshake_request/src/validate_begin_handshake_request_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/validate_local_identity/src/validate_local_identity_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/validate_local_identity/src/validate_local_identity_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/validate_local_identity/src/validate_local_identity_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/validate_local_permissions/src/validate_local_permissions_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/validate_local_permissions/src/validate_local_permissions_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/validate_local_permissions/src/validate_local_permissions_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/validate_remote_identity/src/validate_remote_identity_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/validate_remote_identity/src/validate_remote_identity_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/validate_remote_identity/src/validate_remote_identity_utests.c.o.d"
+  "/root/repo/src/security/builtin_plugins/tests/validate_remote_permissions/src/validate_remote_permissions_utests.c" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/validate_remote_permissions/src/validate_remote_permissions_utests.c.o" "gcc" "src/security/builtin_plugins/tests/CMakeFiles/cunit_security_plugins.dir/validate_remote_permissions/src/validate_remote_permissions_utests.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/src/security/builtin_plugins/access_control/CMakeFiles/dds_security_ac.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/security/builtin_plugins/cryptographic/CMakeFiles/dds_security_crypto.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/core/CMakeFiles/ddsc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
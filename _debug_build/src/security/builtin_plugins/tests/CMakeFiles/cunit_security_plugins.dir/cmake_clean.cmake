@@ -0,0 +1,89 @@
+file(REMOVE_RECURSE
+  "../../../../bin/cunit_security_plugins"
+  "../../../../bin/cunit_security_plugins.pdb"
+  "CMakeFiles/cunit_security_plugins.dir/__/__/openssl/src/openssl_support.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/__/__/openssl/src/openssl_support.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/access_control_fnmatch/src/access_control_fnmatch_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/access_control_fnmatch/src/access_control_fnmatch_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/common/src/crypto_helper.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/common/src/crypto_helper.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/common/src/handshake_helper.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/common/src/handshake_helper.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/common/src/loader.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/common/src/loader.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/create_local_datareader_crypto_tokens/src/create_local_datareader_crypto_tokens_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/create_local_datareader_crypto_tokens/src/create_local_datareader_crypto_tokens_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/create_local_datawriter_crypto_tokens/src/create_local_datawriter_crypto_tokens_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/create_local_datawriter_crypto_tokens/src/create_local_datawriter_crypto_tokens_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/create_local_participant_crypto_tokens/src/create_local_participant_crypto_tokens_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/create_local_participant_crypto_tokens/src/create_local_participant_crypto_tokens_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/cunit_security_plugins.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/cunit_security_plugins.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/decode_datareader_submessage/src/decode_datareader_submessage_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/decode_datareader_submessage/src/decode_datareader_submessage_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/decode_datawriter_submessage/src/decode_datawriter_submessage_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/decode_datawriter_submessage/src/decode_datawriter_submessage_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/decode_rtps_message/src/decode_rtps_message_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/decode_rtps_message/src/decode_rtps_message_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/decode_serialized_payload/src/decode_serialized_payload_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/decode_serialized_payload/src/decode_serialized_payload_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/encode_datareader_submessage/src/encode_datareader_submessage_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/encode_datareader_submessage/src/encode_datareader_submessage_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/encode_datawriter_submessage/src/encode_datawriter_submessage_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/encode_datawriter_submessage/src/encode_datawriter_submessage_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/encode_rtps_message/src/encode_rtps_message_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/encode_rtps_message/src/encode_rtps_message_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/encode_serialized_payload/src/encode_serialized_payload_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/encode_serialized_payload/src/encode_serialized_payload_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/get_authenticated_peer_credential_token/src/get_authenticated_peer_credential_token_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/get_authenticated_peer_credential_token/src/get_authenticated_peer_credential_token_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/get_permissions_credential_token/src/get_permissions_credential_token_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/get_permissions_credential_token/src/get_permissions_credential_token_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/get_permissions_token/src/get_permissions_token_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/get_permissions_token/src/get_permissions_token_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/get_xxx_sec_attributes/src/get_xxx_sec_attributes_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/get_xxx_sec_attributes/src/get_xxx_sec_attributes_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/listeners_access_control/src/listeners_access_control_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/listeners_access_control/src/listeners_access_control_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/listeners_authentication/src/listeners_authentication_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/listeners_authentication/src/listeners_authentication_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/preprocess_secure_submsg/src/preprocess_secure_submsg_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/preprocess_secure_submsg/src/preprocess_secure_submsg_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/process_handshake/src/process_handshake_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/process_handshake/src/process_handshake_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/register_local_datareader/src/register_local_datareader_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/register_local_datareader/src/register_local_datareader_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/register_local_datawriter/src/register_local_datawriter_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/register_local_datawriter/src/register_local_datawriter_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/register_local_participant/src/register_local_participant_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/register_local_participant/src/register_local_participant_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/register_matched_remote_datareader/src/register_matched_remote_datareader_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/register_matched_remote_datareader/src/register_matched_remote_datareader_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/register_matched_remote_datawriter/src/register_matched_remote_datawriter_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/register_matched_remote_datawriter/src/register_matched_remote_datawriter_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/register_matched_remote_participant/src/register_matched_remote_participant_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/register_matched_remote_participant/src/register_matched_remote_participant_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/set_remote_datareader_crypto_tokens/src/set_remote_datareader_crypto_tokens_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/set_remote_datareader_crypto_tokens/src/set_remote_datareader_crypto_tokens_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/set_remote_datawriter_crypto_tokens/src/set_remote_datawriter_crypto_tokens_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/set_remote_datawriter_crypto_tokens/src/set_remote_datawriter_crypto_tokens_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/set_remote_participant_crypto_tokens/src/set_remote_participant_crypto_tokens_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/set_remote_participant_crypto_tokens/src/set_remote_participant_crypto_tokens_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/validate_begin_handshake_reply/src/validate_begin_handshake_reply_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/validate_begin_handshake_reply/src/validate_begin_handshake_reply_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/validate_begin_handshake_request/src/validate_begin_handshake_request_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/validate_begin_handshake_request/src/validate_begin_handshake_request_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/validate_local_identity/src/validate_local_identity_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/validate_local_identity/src/validate_local_identity_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/validate_local_permissions/src/validate_local_permissions_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/validate_local_permissions/src/validate_local_permissions_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/validate_remote_identity/src/validate_remote_identity_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/validate_remote_identity/src/validate_remote_identity_utests.c.o.d"
+  "CMakeFiles/cunit_security_plugins.dir/validate_remote_permissions/src/validate_remote_permissions_utests.c.o"
+  "CMakeFiles/cunit_security_plugins.dir/validate_remote_permissions/src/validate_remote_permissions_utests.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cunit_security_plugins.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
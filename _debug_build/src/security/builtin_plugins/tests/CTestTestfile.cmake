@@ -0,0 +1,460 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/security/builtin_plugins/tests
+# Build directory: /root/repo/_debug_build/src/security/builtin_plugins/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(CUnit_ddssec_builtin_get_authenticated_peer_credential_token_after_request "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_authenticated_peer_credential" "-t" "token_after_request")
+set_tests_properties(CUnit_ddssec_builtin_get_authenticated_peer_credential_token_after_request PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_authenticated_peer_credential_token_after_reply "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_authenticated_peer_credential" "-t" "token_after_reply")
+set_tests_properties(CUnit_ddssec_builtin_get_authenticated_peer_credential_token_after_reply PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_authenticated_peer_credential_token_invalid_arguments "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_authenticated_peer_credential" "-t" "token_invalid_arguments")
+set_tests_properties(CUnit_ddssec_builtin_get_authenticated_peer_credential_token_invalid_arguments PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_process_handshake_happy_day_after_request "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_process_handshake" "-t" "happy_day_after_request")
+set_tests_properties(CUnit_ddssec_builtin_process_handshake_happy_day_after_request PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_process_handshake_happy_day_after_reply "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_process_handshake" "-t" "happy_day_after_reply")
+set_tests_properties(CUnit_ddssec_builtin_process_handshake_happy_day_after_reply PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_process_handshake_invalid_arguments "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_process_handshake" "-t" "invalid_arguments")
+set_tests_properties(CUnit_ddssec_builtin_process_handshake_invalid_arguments PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_process_handshake_invalid_certificate "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_process_handshake" "-t" "invalid_certificate")
+set_tests_properties(CUnit_ddssec_builtin_process_handshake_invalid_certificate PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_process_handshake_invalid_dsign_algo "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_process_handshake" "-t" "invalid_dsign_algo")
+set_tests_properties(CUnit_ddssec_builtin_process_handshake_invalid_dsign_algo PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_process_handshake_invalid_kagree_algo "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_process_handshake" "-t" "invalid_kagree_algo")
+set_tests_properties(CUnit_ddssec_builtin_process_handshake_invalid_kagree_algo PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_process_handshake_invalid_diffie_hellman "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_process_handshake" "-t" "invalid_diffie_hellman")
+set_tests_properties(CUnit_ddssec_builtin_process_handshake_invalid_diffie_hellman PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_process_handshake_return_handle "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_process_handshake" "-t" "return_handle")
+set_tests_properties(CUnit_ddssec_builtin_process_handshake_return_handle PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_process_handshake_extended_certificate_check "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_process_handshake" "-t" "extended_certificate_check")
+set_tests_properties(CUnit_ddssec_builtin_process_handshake_extended_certificate_check PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_process_handshake_crl "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_process_handshake" "-t" "crl")
+set_tests_properties(CUnit_ddssec_builtin_process_handshake_crl PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_begin_handshake_reply_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_begin_handshake_reply" "-t" "happy_day")
+set_tests_properties(CUnit_ddssec_builtin_validate_begin_handshake_reply_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_begin_handshake_reply_future_challenge "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_begin_handshake_reply" "-t" "future_challenge")
+set_tests_properties(CUnit_ddssec_builtin_validate_begin_handshake_reply_future_challenge PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_begin_handshake_reply_invalid_arguments "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_begin_handshake_reply" "-t" "invalid_arguments")
+set_tests_properties(CUnit_ddssec_builtin_validate_begin_handshake_reply_invalid_arguments PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_begin_handshake_reply_invalid_certificate "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_begin_handshake_reply" "-t" "invalid_certificate")
+set_tests_properties(CUnit_ddssec_builtin_validate_begin_handshake_reply_invalid_certificate PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_begin_handshake_reply_invalid_participant_data "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_begin_handshake_reply" "-t" "invalid_participant_data")
+set_tests_properties(CUnit_ddssec_builtin_validate_begin_handshake_reply_invalid_participant_data PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_begin_handshake_reply_invalid_dsign_algo "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_begin_handshake_reply" "-t" "invalid_dsign_algo")
+set_tests_properties(CUnit_ddssec_builtin_validate_begin_handshake_reply_invalid_dsign_algo PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_begin_handshake_reply_invalid_kagree_algo "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_begin_handshake_reply" "-t" "invalid_kagree_algo")
+set_tests_properties(CUnit_ddssec_builtin_validate_begin_handshake_reply_invalid_kagree_algo PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_begin_handshake_reply_invalid_diffie_hellman "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_begin_handshake_reply" "-t" "invalid_diffie_hellman")
+set_tests_properties(CUnit_ddssec_builtin_validate_begin_handshake_reply_invalid_diffie_hellman PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_begin_handshake_reply_invalid_challenge "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_begin_handshake_reply" "-t" "invalid_challenge")
+set_tests_properties(CUnit_ddssec_builtin_validate_begin_handshake_reply_invalid_challenge PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_begin_handshake_reply_return_handle "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_begin_handshake_reply" "-t" "return_handle")
+set_tests_properties(CUnit_ddssec_builtin_validate_begin_handshake_reply_return_handle PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_validate_begin_handshake_reply_extended_certificate_check "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "validate_begin_handshake_reply" "-t" "extended_certificate_check")
+set_tests_properties(CUnit_validate_begin_handshake_reply_extended_certificate_check PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_validate_begin_handshake_reply_crl "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "validate_begin_handshake_reply" "-t" "crl")
+set_tests_properties(CUnit_validate_begin_handshake_reply_crl PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_begin_handshake_request_happy_day_challenge "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_begin_handshake_request" "-t" "happy_day_challenge")
+set_tests_properties(CUnit_ddssec_builtin_validate_begin_handshake_request_happy_day_challenge PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_begin_handshake_request_happy_day_future_challenge "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_begin_handshake_request" "-t" "happy_day_future_challenge")
+set_tests_properties(CUnit_ddssec_builtin_validate_begin_handshake_request_happy_day_future_challenge PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_begin_handshake_request_invalid_arguments "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_begin_handshake_request" "-t" "invalid_arguments")
+set_tests_properties(CUnit_ddssec_builtin_validate_begin_handshake_request_invalid_arguments PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_begin_handshake_request_return_handle "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_begin_handshake_request" "-t" "return_handle")
+set_tests_properties(CUnit_ddssec_builtin_validate_begin_handshake_request_return_handle PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "happy_day")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_invalid_certificate "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "invalid_certificate")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_invalid_certificate PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_invalid_root "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "invalid_root")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_invalid_root PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_invalid_chain "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "invalid_chain")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_invalid_chain PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_certificate_key_too_small "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "certificate_key_too_small")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_certificate_key_too_small PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_invalid_private_key "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "invalid_private_key")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_invalid_private_key PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_private_key_too_small "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "private_key_too_small")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_private_key_too_small PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_missing_certificate_property "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "missing_certificate_property")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_missing_certificate_property PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_missing_ca_property "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "missing_ca_property")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_missing_ca_property PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_missing_private_key_property "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "missing_private_key_property")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_missing_private_key_property PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_unsupported_certification_format "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "unsupported_certification_format")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_unsupported_certification_format PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_encrypted_key "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "encrypted_key")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_encrypted_key PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_encrypted_key_no_password "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "encrypted_key_no_password")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_encrypted_key_no_password PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_encrypted_key_invalid_password "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "encrypted_key_invalid_password")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_encrypted_key_invalid_password PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_happy_day_elliptic "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "happy_day_elliptic")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_happy_day_elliptic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_encrypted_ec_key "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "encrypted_ec_key")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_encrypted_ec_key PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_elliptic_unsupported_certificate "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "elliptic_unsupported_certificate")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_elliptic_unsupported_certificate PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_elliptic_unsupported_private_key "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "elliptic_unsupported_private_key")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_elliptic_unsupported_private_key PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_return_freed_handle "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "return_freed_handle")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_return_freed_handle PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_no_file "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "no_file")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_no_file PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_with_extended_certificate_check "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "with_extended_certificate_check")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_with_extended_certificate_check PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_crl "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "crl")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_crl PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_identity_trusted_ca_dir_and_crl "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_identity" "-t" "trusted_ca_dir_and_crl")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_identity_trusted_ca_dir_and_crl PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_identity_happy_day_nil_auth_req "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_identity" "-t" "happy_day_nil_auth_req")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_identity_happy_day_nil_auth_req PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_identity_happy_day_with_auth_req "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_identity" "-t" "happy_day_with_auth_req")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_identity_happy_day_with_auth_req PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_identity_invalid_parameters "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_identity" "-t" "invalid_parameters")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_identity_invalid_parameters PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_identity_unknown_local_identity "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_identity" "-t" "unknown_local_identity")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_identity_unknown_local_identity PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_identity_invalid_remote_identity_token "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_identity" "-t" "invalid_remote_identity_token")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_identity_invalid_remote_identity_token PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_identity_invalid_auth_req_token "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_identity" "-t" "invalid_auth_req_token")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_identity_invalid_auth_req_token PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_identity_already_validated_same_token "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_identity" "-t" "already_validated_same_token")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_identity_already_validated_same_token PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_identity_already_validated_different_token "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_identity" "-t" "already_validated_different_token")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_identity_already_validated_different_token PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_listeners_auth_local_remote_set_before_validation "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_listeners_auth" "-t" "local_remote_set_before_validation")
+set_tests_properties(CUnit_ddssec_builtin_listeners_auth_local_remote_set_before_validation PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_listeners_access_control_local_2secs "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_listeners_access_control" "-t" "local_2secs")
+set_tests_properties(CUnit_ddssec_builtin_listeners_access_control_local_2secs PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_access_control_fnmatch_basic "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_access_control_fnmatch" "-t" "basic")
+set_tests_properties(CUnit_ddssec_builtin_access_control_fnmatch_basic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_permissions_credential_token_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_permissions_credential_token" "-t" "happy_day")
+set_tests_properties(CUnit_ddssec_builtin_get_permissions_credential_token_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_permissions_credential_token_invalid_args "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_permissions_credential_token" "-t" "invalid_args")
+set_tests_properties(CUnit_ddssec_builtin_get_permissions_credential_token_invalid_args PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_permissions_token_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_permissions_token" "-t" "happy_day")
+set_tests_properties(CUnit_ddssec_builtin_get_permissions_token_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_permissions_token_invalid_args "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_permissions_token" "-t" "invalid_args")
+set_tests_properties(CUnit_ddssec_builtin_get_permissions_token_invalid_args PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_participant_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "participant_happy_day")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_participant_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_datawriter_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "datawriter_happy_day")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_datawriter_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_datawriter_non_existing_topic "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "datawriter_non_existing_topic")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_datawriter_non_existing_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_datareader_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "datareader_happy_day")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_datareader_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_datareader_non_existing_topic "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "datareader_non_existing_topic")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_datareader_non_existing_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_participant_invalid_param "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "participant_invalid_param")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_participant_invalid_param PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_datareader_invalid_param "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "datareader_invalid_param")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_datareader_invalid_param PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_datawriter_invalid_param "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "datawriter_invalid_param")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_datawriter_invalid_param PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_topic_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "topic_happy_day")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_topic_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_topic_non_existing_topic "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "topic_non_existing_topic")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_topic_non_existing_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_topic_invalid_param "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "topic_invalid_param")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_topic_invalid_param PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_participant_2nd_rule "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "participant_2nd_rule")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_participant_2nd_rule PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_liveliness_discovery_clear "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "liveliness_discovery_clear")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_liveliness_discovery_clear PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_liveliness_discovery_encrypted "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "liveliness_discovery_encrypted")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_liveliness_discovery_encrypted PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_liveliness_discovery_signed "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "liveliness_discovery_signed")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_liveliness_discovery_signed PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_liveliness_discovery_encrypted_and_authenticated "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "liveliness_discovery_encrypted_and_authenticated")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_liveliness_discovery_encrypted_and_authenticated PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_liveliness_discovery_signed_and_authenticated "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "liveliness_discovery_signed_and_authenticated")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_liveliness_discovery_signed_and_authenticated PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_get_xxx_sec_attributes_liveliness_discovery_different "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_get_xxx_sec_attributes" "-t" "liveliness_discovery_different")
+set_tests_properties(CUnit_ddssec_builtin_get_xxx_sec_attributes_liveliness_discovery_different PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_permissions_valid_file "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_permissions" "-t" "valid_file")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_permissions_valid_file PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_permissions_valid_data "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_permissions" "-t" "valid_data")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_permissions_valid_data PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_permissions_uri_directories "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_permissions" "-t" "uri_directories")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_permissions_uri_directories PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_permissions_uri_empty_files "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_permissions" "-t" "uri_empty_files")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_permissions_uri_empty_files PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_permissions_uri_text_files "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_permissions" "-t" "uri_text_files")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_permissions_uri_text_files PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_permissions_uri_absent_files "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_permissions" "-t" "uri_absent_files")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_permissions_uri_absent_files PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_permissions_uri_no_files "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_permissions" "-t" "uri_no_files")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_permissions_uri_no_files PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_permissions_uri_empty_data "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_permissions" "-t" "uri_empty_data")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_permissions_uri_empty_data PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_permissions_uri_invalid_types "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_permissions" "-t" "uri_invalid_types")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_permissions_uri_invalid_types PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_permissions_uri_null "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_permissions" "-t" "uri_null")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_permissions_uri_null PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_permissions_corrupted_signatures "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_permissions" "-t" "corrupted_signatures")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_permissions_corrupted_signatures PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_permissions_unknown_ca "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_permissions" "-t" "unknown_ca")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_permissions_unknown_ca PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_permissions_not_signed "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_permissions" "-t" "not_signed")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_permissions_not_signed PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_permissions_validity "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_permissions" "-t" "validity")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_permissions_validity PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_permissions_subject_name "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_permissions" "-t" "subject_name")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_permissions_subject_name PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_local_permissions_xml_invalid "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_local_permissions" "-t" "xml_invalid")
+set_tests_properties(CUnit_ddssec_builtin_validate_local_permissions_xml_invalid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_permissions_valid_permissions "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_permissions" "-t" "valid_permissions")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_permissions_valid_permissions PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_permissions_permissions_unknown_ca "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_permissions" "-t" "permissions_unknown_ca")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_permissions_permissions_unknown_ca PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_permissions_permissions_not_signed "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_permissions" "-t" "permissions_not_signed")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_permissions_permissions_not_signed PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_permissions_invalid_credential_token "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_permissions" "-t" "invalid_credential_token")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_permissions_invalid_credential_token PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_permissions_invalid_xml "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_permissions" "-t" "invalid_xml")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_permissions_invalid_xml PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_permissions_permissions_expired "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_permissions" "-t" "permissions_expired")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_permissions_permissions_expired PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_permissions_permissions_not_yet "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_permissions" "-t" "permissions_not_yet")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_permissions_permissions_not_yet PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_permissions_permissions_unknown_subject_name "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_permissions" "-t" "permissions_unknown_subject_name")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_permissions_permissions_unknown_subject_name PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_permissions_permissions_different_subject "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_permissions" "-t" "permissions_different_subject")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_permissions_permissions_different_subject PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_validate_remote_permissions_corrupted_signature "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_validate_remote_permissions" "-t" "corrupted_signature")
+set_tests_properties(CUnit_ddssec_builtin_validate_remote_permissions_corrupted_signature PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_create_local_datareader_crypto_tokens_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_create_local_datareader_crypto_tokens" "-t" "happy_day")
+set_tests_properties(CUnit_ddssec_builtin_create_local_datareader_crypto_tokens_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_create_local_datareader_crypto_tokens_invalid_args "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_create_local_datareader_crypto_tokens" "-t" "invalid_args")
+set_tests_properties(CUnit_ddssec_builtin_create_local_datareader_crypto_tokens_invalid_args PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_create_local_datawriter_crypto_tokens_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_create_local_datawriter_crypto_tokens" "-t" "happy_day")
+set_tests_properties(CUnit_ddssec_builtin_create_local_datawriter_crypto_tokens_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_create_local_datawriter_crypto_tokens_invalid_args "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_create_local_datawriter_crypto_tokens" "-t" "invalid_args")
+set_tests_properties(CUnit_ddssec_builtin_create_local_datawriter_crypto_tokens_invalid_args PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_create_local_participant_crypto_tokens_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_create_local_participant_crypto_tokens" "-t" "happy_day")
+set_tests_properties(CUnit_ddssec_builtin_create_local_participant_crypto_tokens_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_create_local_participant_crypto_tokens_invalid_args "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_create_local_participant_crypto_tokens" "-t" "invalid_args")
+set_tests_properties(CUnit_ddssec_builtin_create_local_participant_crypto_tokens_invalid_args PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datareader_submessage_encoded_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datareader_submessage" "-t" "encoded_256")
+set_tests_properties(CUnit_ddssec_builtin_decode_datareader_submessage_encoded_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datareader_submessage_encoded_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datareader_submessage" "-t" "encoded_128")
+set_tests_properties(CUnit_ddssec_builtin_decode_datareader_submessage_encoded_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datareader_submessage_not_encoded_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datareader_submessage" "-t" "not_encoded_256")
+set_tests_properties(CUnit_ddssec_builtin_decode_datareader_submessage_not_encoded_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datareader_submessage_not_encoded_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datareader_submessage" "-t" "not_encoded_128")
+set_tests_properties(CUnit_ddssec_builtin_decode_datareader_submessage_not_encoded_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datareader_submessage_signed_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datareader_submessage" "-t" "signed_256")
+set_tests_properties(CUnit_ddssec_builtin_decode_datareader_submessage_signed_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datareader_submessage_signed_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datareader_submessage" "-t" "signed_128")
+set_tests_properties(CUnit_ddssec_builtin_decode_datareader_submessage_signed_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datareader_submessage_only_signed_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datareader_submessage" "-t" "only_signed_256")
+set_tests_properties(CUnit_ddssec_builtin_decode_datareader_submessage_only_signed_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datareader_submessage_only_signed_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datareader_submessage" "-t" "only_signed_128")
+set_tests_properties(CUnit_ddssec_builtin_decode_datareader_submessage_only_signed_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datareader_submessage_invalid_args "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datareader_submessage" "-t" "invalid_args")
+set_tests_properties(CUnit_ddssec_builtin_decode_datareader_submessage_invalid_args PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datareader_submessage_invalid_data "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datareader_submessage" "-t" "invalid_data")
+set_tests_properties(CUnit_ddssec_builtin_decode_datareader_submessage_invalid_data PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datareader_submessage_volatile_sec "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datareader_submessage" "-t" "volatile_sec")
+set_tests_properties(CUnit_ddssec_builtin_decode_datareader_submessage_volatile_sec PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datawriter_submessage_encoded_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datawriter_submessage" "-t" "encoded_256")
+set_tests_properties(CUnit_ddssec_builtin_decode_datawriter_submessage_encoded_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datawriter_submessage_encoded_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datawriter_submessage" "-t" "encoded_128")
+set_tests_properties(CUnit_ddssec_builtin_decode_datawriter_submessage_encoded_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datawriter_submessage_not_encoded_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datawriter_submessage" "-t" "not_encoded_256")
+set_tests_properties(CUnit_ddssec_builtin_decode_datawriter_submessage_not_encoded_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datawriter_submessage_not_encoded_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datawriter_submessage" "-t" "not_encoded_128")
+set_tests_properties(CUnit_ddssec_builtin_decode_datawriter_submessage_not_encoded_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datawriter_submessage_signed_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datawriter_submessage" "-t" "signed_256")
+set_tests_properties(CUnit_ddssec_builtin_decode_datawriter_submessage_signed_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datawriter_submessage_signed_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datawriter_submessage" "-t" "signed_128")
+set_tests_properties(CUnit_ddssec_builtin_decode_datawriter_submessage_signed_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datawriter_submessage_only_signed_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datawriter_submessage" "-t" "only_signed_256")
+set_tests_properties(CUnit_ddssec_builtin_decode_datawriter_submessage_only_signed_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datawriter_submessage_only_signed_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datawriter_submessage" "-t" "only_signed_128")
+set_tests_properties(CUnit_ddssec_builtin_decode_datawriter_submessage_only_signed_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datawriter_submessage_invalid_args "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datawriter_submessage" "-t" "invalid_args")
+set_tests_properties(CUnit_ddssec_builtin_decode_datawriter_submessage_invalid_args PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datawriter_submessage_invalid_data "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datawriter_submessage" "-t" "invalid_data")
+set_tests_properties(CUnit_ddssec_builtin_decode_datawriter_submessage_invalid_data PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_datawriter_submessage_volatile_sec "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_datawriter_submessage" "-t" "volatile_sec")
+set_tests_properties(CUnit_ddssec_builtin_decode_datawriter_submessage_volatile_sec PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_rtps_message_encoded_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_rtps_message" "-t" "encoded_256")
+set_tests_properties(CUnit_ddssec_builtin_decode_rtps_message_encoded_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_rtps_message_encoded_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_rtps_message" "-t" "encoded_128")
+set_tests_properties(CUnit_ddssec_builtin_decode_rtps_message_encoded_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_rtps_message_not_encrypted_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_rtps_message" "-t" "not_encrypted_256")
+set_tests_properties(CUnit_ddssec_builtin_decode_rtps_message_not_encrypted_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_rtps_message_not_encrypted_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_rtps_message" "-t" "not_encrypted_128")
+set_tests_properties(CUnit_ddssec_builtin_decode_rtps_message_not_encrypted_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_rtps_message_authenticated_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_rtps_message" "-t" "authenticated_256")
+set_tests_properties(CUnit_ddssec_builtin_decode_rtps_message_authenticated_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_rtps_message_authenticated_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_rtps_message" "-t" "authenticated_128")
+set_tests_properties(CUnit_ddssec_builtin_decode_rtps_message_authenticated_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_rtps_message_only_authenticated_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_rtps_message" "-t" "only_authenticated_256")
+set_tests_properties(CUnit_ddssec_builtin_decode_rtps_message_only_authenticated_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_rtps_message_only_authenticated_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_rtps_message" "-t" "only_authenticated_128")
+set_tests_properties(CUnit_ddssec_builtin_decode_rtps_message_only_authenticated_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_rtps_message_invalid_args "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_rtps_message" "-t" "invalid_args")
+set_tests_properties(CUnit_ddssec_builtin_decode_rtps_message_invalid_args PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_rtps_message_invalid_data "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_rtps_message" "-t" "invalid_data")
+set_tests_properties(CUnit_ddssec_builtin_decode_rtps_message_invalid_data PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_serialized_payload_decrypt_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_serialized_payload" "-t" "decrypt_128")
+set_tests_properties(CUnit_ddssec_builtin_decode_serialized_payload_decrypt_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_serialized_payload_decrypt_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_serialized_payload" "-t" "decrypt_256")
+set_tests_properties(CUnit_ddssec_builtin_decode_serialized_payload_decrypt_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_serialized_payload_signcheck_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_serialized_payload" "-t" "signcheck_128")
+set_tests_properties(CUnit_ddssec_builtin_decode_serialized_payload_signcheck_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_serialized_payload_signcheck_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_serialized_payload" "-t" "signcheck_256")
+set_tests_properties(CUnit_ddssec_builtin_decode_serialized_payload_signcheck_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_serialized_payload_invalid_args "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_serialized_payload" "-t" "invalid_args")
+set_tests_properties(CUnit_ddssec_builtin_decode_serialized_payload_invalid_args PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_decode_serialized_payload_invalid_data "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_decode_serialized_payload" "-t" "invalid_data")
+set_tests_properties(CUnit_ddssec_builtin_decode_serialized_payload_invalid_data PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datareader_submessage_encode_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datareader_submessage" "-t" "encode_256")
+set_tests_properties(CUnit_ddssec_builtin_encode_datareader_submessage_encode_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datareader_submessage_encode_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datareader_submessage" "-t" "encode_128")
+set_tests_properties(CUnit_ddssec_builtin_encode_datareader_submessage_encode_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datareader_submessage_no_encode_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datareader_submessage" "-t" "no_encode_256")
+set_tests_properties(CUnit_ddssec_builtin_encode_datareader_submessage_no_encode_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datareader_submessage_no_encode_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datareader_submessage" "-t" "no_encode_128")
+set_tests_properties(CUnit_ddssec_builtin_encode_datareader_submessage_no_encode_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datareader_submessage_encode_sign_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datareader_submessage" "-t" "encode_sign_256")
+set_tests_properties(CUnit_ddssec_builtin_encode_datareader_submessage_encode_sign_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datareader_submessage_encode_sign_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datareader_submessage" "-t" "encode_sign_128")
+set_tests_properties(CUnit_ddssec_builtin_encode_datareader_submessage_encode_sign_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datareader_submessage_no_encode_sign_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datareader_submessage" "-t" "no_encode_sign_256")
+set_tests_properties(CUnit_ddssec_builtin_encode_datareader_submessage_no_encode_sign_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datareader_submessage_no_encode_sign_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datareader_submessage" "-t" "no_encode_sign_128")
+set_tests_properties(CUnit_ddssec_builtin_encode_datareader_submessage_no_encode_sign_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datareader_submessage_invalid_args "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datareader_submessage" "-t" "invalid_args")
+set_tests_properties(CUnit_ddssec_builtin_encode_datareader_submessage_invalid_args PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datawriter_submessage_encode_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datawriter_submessage" "-t" "encode_256")
+set_tests_properties(CUnit_ddssec_builtin_encode_datawriter_submessage_encode_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datawriter_submessage_encode_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datawriter_submessage" "-t" "encode_128")
+set_tests_properties(CUnit_ddssec_builtin_encode_datawriter_submessage_encode_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datawriter_submessage_no_encode_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datawriter_submessage" "-t" "no_encode_256")
+set_tests_properties(CUnit_ddssec_builtin_encode_datawriter_submessage_no_encode_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datawriter_submessage_no_encode_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datawriter_submessage" "-t" "no_encode_128")
+set_tests_properties(CUnit_ddssec_builtin_encode_datawriter_submessage_no_encode_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datawriter_submessage_encode_sign_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datawriter_submessage" "-t" "encode_sign_256")
+set_tests_properties(CUnit_ddssec_builtin_encode_datawriter_submessage_encode_sign_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datawriter_submessage_encode_sign_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datawriter_submessage" "-t" "encode_sign_128")
+set_tests_properties(CUnit_ddssec_builtin_encode_datawriter_submessage_encode_sign_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datawriter_submessage_no_encode_sign_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datawriter_submessage" "-t" "no_encode_sign_256")
+set_tests_properties(CUnit_ddssec_builtin_encode_datawriter_submessage_no_encode_sign_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datawriter_submessage_no_encode_sign_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datawriter_submessage" "-t" "no_encode_sign_128")
+set_tests_properties(CUnit_ddssec_builtin_encode_datawriter_submessage_no_encode_sign_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_datawriter_submessage_invalid_args "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_datawriter_submessage" "-t" "invalid_args")
+set_tests_properties(CUnit_ddssec_builtin_encode_datawriter_submessage_invalid_args PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_rtps_message_encrypt_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_rtps_message" "-t" "encrypt_256")
+set_tests_properties(CUnit_ddssec_builtin_encode_rtps_message_encrypt_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_rtps_message_encrypt_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_rtps_message" "-t" "encrypt_128")
+set_tests_properties(CUnit_ddssec_builtin_encode_rtps_message_encrypt_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_rtps_message_no_encrypt_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_rtps_message" "-t" "no_encrypt_256")
+set_tests_properties(CUnit_ddssec_builtin_encode_rtps_message_no_encrypt_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_rtps_message_no_encrypt_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_rtps_message" "-t" "no_encrypt_128")
+set_tests_properties(CUnit_ddssec_builtin_encode_rtps_message_no_encrypt_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_rtps_message_encrypt_sign_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_rtps_message" "-t" "encrypt_sign_256")
+set_tests_properties(CUnit_ddssec_builtin_encode_rtps_message_encrypt_sign_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_rtps_message_encrypt_sign_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_rtps_message" "-t" "encrypt_sign_128")
+set_tests_properties(CUnit_ddssec_builtin_encode_rtps_message_encrypt_sign_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_rtps_message_no_encrypt_sign_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_rtps_message" "-t" "no_encrypt_sign_256")
+set_tests_properties(CUnit_ddssec_builtin_encode_rtps_message_no_encrypt_sign_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_rtps_message_no_encrypt_sign_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_rtps_message" "-t" "no_encrypt_sign_128")
+set_tests_properties(CUnit_ddssec_builtin_encode_rtps_message_no_encrypt_sign_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_rtps_message_invalid_args "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_rtps_message" "-t" "invalid_args")
+set_tests_properties(CUnit_ddssec_builtin_encode_rtps_message_invalid_args PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_serialized_payload_encrypt_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_serialized_payload" "-t" "encrypt_128")
+set_tests_properties(CUnit_ddssec_builtin_encode_serialized_payload_encrypt_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_serialized_payload_encrypt_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_serialized_payload" "-t" "encrypt_256")
+set_tests_properties(CUnit_ddssec_builtin_encode_serialized_payload_encrypt_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_serialized_payload_sign_128 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_serialized_payload" "-t" "sign_128")
+set_tests_properties(CUnit_ddssec_builtin_encode_serialized_payload_sign_128 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_serialized_payload_sign_256 "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_serialized_payload" "-t" "sign_256")
+set_tests_properties(CUnit_ddssec_builtin_encode_serialized_payload_sign_256 PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_encode_serialized_payload_invalid_args "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_encode_serialized_payload" "-t" "invalid_args")
+set_tests_properties(CUnit_ddssec_builtin_encode_serialized_payload_invalid_args PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_preprocess_secure_submsg_writer_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_preprocess_secure_submsg" "-t" "writer_happy_day")
+set_tests_properties(CUnit_ddssec_builtin_preprocess_secure_submsg_writer_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_preprocess_secure_submsg_reader_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_preprocess_secure_submsg" "-t" "reader_happy_day")
+set_tests_properties(CUnit_ddssec_builtin_preprocess_secure_submsg_reader_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_preprocess_secure_submsg_invalid_args "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_preprocess_secure_submsg" "-t" "invalid_args")
+set_tests_properties(CUnit_ddssec_builtin_preprocess_secure_submsg_invalid_args PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_preprocess_secure_submsg_invalid_message "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_preprocess_secure_submsg" "-t" "invalid_message")
+set_tests_properties(CUnit_ddssec_builtin_preprocess_secure_submsg_invalid_message PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_preprocess_secure_submsg_volatile_secure "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_preprocess_secure_submsg" "-t" "volatile_secure")
+set_tests_properties(CUnit_ddssec_builtin_preprocess_secure_submsg_volatile_secure PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_local_datareader_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_local_datareader" "-t" "happy_day")
+set_tests_properties(CUnit_ddssec_builtin_register_local_datareader_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_local_datareader_builtin_endpoint "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_local_datareader" "-t" "builtin_endpoint")
+set_tests_properties(CUnit_ddssec_builtin_register_local_datareader_builtin_endpoint PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_local_datareader_special_endpoint_name "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_local_datareader" "-t" "special_endpoint_name")
+set_tests_properties(CUnit_ddssec_builtin_register_local_datareader_special_endpoint_name PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_local_datareader_invalid_participant "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_local_datareader" "-t" "invalid_participant")
+set_tests_properties(CUnit_ddssec_builtin_register_local_datareader_invalid_participant PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_local_datawriter_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_local_datawriter" "-t" "happy_day")
+set_tests_properties(CUnit_ddssec_builtin_register_local_datawriter_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_local_datawriter_builtin_endpoint "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_local_datawriter" "-t" "builtin_endpoint")
+set_tests_properties(CUnit_ddssec_builtin_register_local_datawriter_builtin_endpoint PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_local_datawriter_special_endpoint_name "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_local_datawriter" "-t" "special_endpoint_name")
+set_tests_properties(CUnit_ddssec_builtin_register_local_datawriter_special_endpoint_name PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_local_datawriter_invalid_participant "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_local_datawriter" "-t" "invalid_participant")
+set_tests_properties(CUnit_ddssec_builtin_register_local_datawriter_invalid_participant PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_local_participant_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_local_participant" "-t" "happy_day")
+set_tests_properties(CUnit_ddssec_builtin_register_local_participant_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_local_participant_empty_identity "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_local_participant" "-t" "empty_identity")
+set_tests_properties(CUnit_ddssec_builtin_register_local_participant_empty_identity PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_remote_datareader_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_remote_datareader" "-t" "happy_day")
+set_tests_properties(CUnit_ddssec_builtin_register_remote_datareader_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_remote_datareader_volatile_secure "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_remote_datareader" "-t" "volatile_secure")
+set_tests_properties(CUnit_ddssec_builtin_register_remote_datareader_volatile_secure PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_remote_datareader_with_origin_authentication "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_remote_datareader" "-t" "with_origin_authentication")
+set_tests_properties(CUnit_ddssec_builtin_register_remote_datareader_with_origin_authentication PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_remote_datareader_invalid_participant "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_remote_datareader" "-t" "invalid_participant")
+set_tests_properties(CUnit_ddssec_builtin_register_remote_datareader_invalid_participant PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_remote_datareader_invalid_writer_properties "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_remote_datareader" "-t" "invalid_writer_properties")
+set_tests_properties(CUnit_ddssec_builtin_register_remote_datareader_invalid_writer_properties PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_remote_datawriter_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_remote_datawriter" "-t" "happy_day")
+set_tests_properties(CUnit_ddssec_builtin_register_remote_datawriter_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_remote_datawriter_volatile_secure "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_remote_datawriter" "-t" "volatile_secure")
+set_tests_properties(CUnit_ddssec_builtin_register_remote_datawriter_volatile_secure PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_remote_datawriter_with_origin_authentication "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_remote_datawriter" "-t" "with_origin_authentication")
+set_tests_properties(CUnit_ddssec_builtin_register_remote_datawriter_with_origin_authentication PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_remote_datawriter_invalid_participant "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_remote_datawriter" "-t" "invalid_participant")
+set_tests_properties(CUnit_ddssec_builtin_register_remote_datawriter_invalid_participant PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_remote_datawriter_invalid_writer_properties "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_remote_datawriter" "-t" "invalid_writer_properties")
+set_tests_properties(CUnit_ddssec_builtin_register_remote_datawriter_invalid_writer_properties PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_remote_participant_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_remote_participant" "-t" "happy_day")
+set_tests_properties(CUnit_ddssec_builtin_register_remote_participant_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_register_remote_participant_empty_identity "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_register_remote_participant" "-t" "empty_identity")
+set_tests_properties(CUnit_ddssec_builtin_register_remote_participant_empty_identity PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_set_remote_datareader_crypto_tokens_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_set_remote_datareader_crypto_tokens" "-t" "happy_day")
+set_tests_properties(CUnit_ddssec_builtin_set_remote_datareader_crypto_tokens_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_set_remote_datareader_crypto_tokens_single_token "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_set_remote_datareader_crypto_tokens" "-t" "single_token")
+set_tests_properties(CUnit_ddssec_builtin_set_remote_datareader_crypto_tokens_single_token PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_set_remote_datareader_crypto_tokens_invalid_args "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_set_remote_datareader_crypto_tokens" "-t" "invalid_args")
+set_tests_properties(CUnit_ddssec_builtin_set_remote_datareader_crypto_tokens_invalid_args PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_set_remote_datareader_crypto_tokens_invalid_tokens "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_set_remote_datareader_crypto_tokens" "-t" "invalid_tokens")
+set_tests_properties(CUnit_ddssec_builtin_set_remote_datareader_crypto_tokens_invalid_tokens PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_set_remote_datareader_crypto_tokens_invalid_key_material "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_set_remote_datareader_crypto_tokens" "-t" "invalid_key_material")
+set_tests_properties(CUnit_ddssec_builtin_set_remote_datareader_crypto_tokens_invalid_key_material PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_set_remote_datawriter_crypto_tokens_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_set_remote_datawriter_crypto_tokens" "-t" "happy_day")
+set_tests_properties(CUnit_ddssec_builtin_set_remote_datawriter_crypto_tokens_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_set_remote_datawriter_crypto_tokens_single_token "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_set_remote_datawriter_crypto_tokens" "-t" "single_token")
+set_tests_properties(CUnit_ddssec_builtin_set_remote_datawriter_crypto_tokens_single_token PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_set_remote_datawriter_crypto_tokens_invalid_args "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_set_remote_datawriter_crypto_tokens" "-t" "invalid_args")
+set_tests_properties(CUnit_ddssec_builtin_set_remote_datawriter_crypto_tokens_invalid_args PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_set_remote_datawriter_crypto_tokens_invalid_tokens "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_set_remote_datawriter_crypto_tokens" "-t" "invalid_tokens")
+set_tests_properties(CUnit_ddssec_builtin_set_remote_datawriter_crypto_tokens_invalid_tokens PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_set_remote_datawriter_crypto_tokens_invalid_key_material "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_set_remote_datawriter_crypto_tokens" "-t" "invalid_key_material")
+set_tests_properties(CUnit_ddssec_builtin_set_remote_datawriter_crypto_tokens_invalid_key_material PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_set_remote_participant_crypto_tokens_happy_day "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_set_remote_participant_crypto_tokens" "-t" "happy_day")
+set_tests_properties(CUnit_ddssec_builtin_set_remote_participant_crypto_tokens_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_set_remote_participant_crypto_tokens_invalid_args "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_set_remote_participant_crypto_tokens" "-t" "invalid_args")
+set_tests_properties(CUnit_ddssec_builtin_set_remote_participant_crypto_tokens_invalid_args PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtin_set_remote_participant_crypto_tokens_invalid_tokens "/root/repo/_debug_build/bin/cunit_security_plugins" "-s" "ddssec_builtin_set_remote_participant_crypto_tokens" "-t" "invalid_tokens")
+set_tests_properties(CUnit_ddssec_builtin_set_remote_participant_crypto_tokens_invalid_tokens PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;62;add_cunit_executable;/root/repo/src/security/builtin_plugins/tests/CMakeLists.txt;0;")
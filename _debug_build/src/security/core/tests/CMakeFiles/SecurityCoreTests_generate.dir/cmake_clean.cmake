@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SecurityCoreTests_generate"
+  "SecurityCoreTests.c"
+  "SecurityCoreTests.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/SecurityCoreTests_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
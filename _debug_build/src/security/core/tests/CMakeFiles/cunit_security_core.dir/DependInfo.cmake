@@ -0,0 +1,48 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_debug_build/src/security/core/tests/SecurityCoreTests.c" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/SecurityCoreTests.c.o" "gcc" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/SecurityCoreTests.c.o.d"
+  "/root/repo/src/security/openssl/src/openssl_support.c" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/__/__/openssl/src/openssl_support.c.o" "gcc" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/__/__/openssl/src/openssl_support.c.o.d"
+  "/root/repo/src/security/core/tests/access_control.c" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/access_control.c.o" "gcc" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/access_control.c.o.d"
+  "/root/repo/src/security/core/tests/authentication.c" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/authentication.c.o" "gcc" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/authentication.c.o.d"
+  "/root/repo/src/security/core/tests/builtintopic.c" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/builtintopic.c.o" "gcc" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/builtintopic.c.o.d"
+  "/root/repo/src/security/core/tests/common/cert_utils.c" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/common/cert_utils.c.o" "gcc" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/common/cert_utils.c.o.d"
+  "/root/repo/src/security/core/tests/common/security_config_test_utils.c" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/common/security_config_test_utils.c.o" "gcc" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/common/security_config_test_utils.c.o.d"
+  "/root/repo/src/security/core/tests/common/test_utils.c" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/common/test_utils.c.o" "gcc" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/common/test_utils.c.o.d"
+  "/root/repo/src/security/core/tests/config.c" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/config.c.o" "gcc" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/config.c.o.d"
+  "/root/repo/src/security/core/tests/crypto.c" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/crypto.c.o" "gcc" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/crypto.c.o.d"
+  "/root/repo/_debug_build/src/security/core/tests/cunit_security_core.c" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/cunit_security_core.c.o" "gcc" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/cunit_security_core.c.o.d"
+  "/root/repo/src/security/core/tests/fsm.c" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/fsm.c.o" "gcc" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/fsm.c.o.d"
+  "/root/repo/src/security/core/tests/handshake.c" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/handshake.c.o" "gcc" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/handshake.c.o.d"
+  "/root/repo/src/security/core/tests/plugin_loading.c" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/plugin_loading.c.o" "gcc" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/plugin_loading.c.o.d"
+  "/root/repo/src/security/core/tests/secure_communication.c" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/secure_communication.c.o" "gcc" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/secure_communication.c.o.d"
+  "/root/repo/src/security/core/tests/security_utils.c" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/security_utils.c.o" "gcc" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/security_utils.c.o.d"
+  "/root/repo/src/security/core/tests/timed_cb.c" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/timed_cb.c.o" "gcc" "src/security/core/tests/CMakeFiles/cunit_security_core.dir/timed_cb.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_debug_build/src/security/core/tests/SecurityCoreTests.h" "/root/repo/_debug_build/src/security/core/tests/SecurityCoreTests.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/src/security/core/tests/CMakeFiles/dds_security_access_control_wrapper.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/security/core/tests/CMakeFiles/dds_security_authentication_wrapper.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/security/core/tests/CMakeFiles/dds_security_cryptography_wrapper.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/security/builtin_plugins/access_control/CMakeFiles/dds_security_ac.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/security/builtin_plugins/authentication/CMakeFiles/dds_security_auth.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/security/builtin_plugins/cryptographic/CMakeFiles/dds_security_crypto.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/core/CMakeFiles/ddsc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,45 @@
+file(REMOVE_RECURSE
+  "../../../../bin/cunit_security_core"
+  "../../../../bin/cunit_security_core.pdb"
+  "CMakeFiles/cunit_security_core.dir/SecurityCoreTests.c.o"
+  "CMakeFiles/cunit_security_core.dir/SecurityCoreTests.c.o.d"
+  "CMakeFiles/cunit_security_core.dir/__/__/openssl/src/openssl_support.c.o"
+  "CMakeFiles/cunit_security_core.dir/__/__/openssl/src/openssl_support.c.o.d"
+  "CMakeFiles/cunit_security_core.dir/access_control.c.o"
+  "CMakeFiles/cunit_security_core.dir/access_control.c.o.d"
+  "CMakeFiles/cunit_security_core.dir/authentication.c.o"
+  "CMakeFiles/cunit_security_core.dir/authentication.c.o.d"
+  "CMakeFiles/cunit_security_core.dir/builtintopic.c.o"
+  "CMakeFiles/cunit_security_core.dir/builtintopic.c.o.d"
+  "CMakeFiles/cunit_security_core.dir/common/cert_utils.c.o"
+  "CMakeFiles/cunit_security_core.dir/common/cert_utils.c.o.d"
+  "CMakeFiles/cunit_security_core.dir/common/security_config_test_utils.c.o"
+  "CMakeFiles/cunit_security_core.dir/common/security_config_test_utils.c.o.d"
+  "CMakeFiles/cunit_security_core.dir/common/test_utils.c.o"
+  "CMakeFiles/cunit_security_core.dir/common/test_utils.c.o.d"
+  "CMakeFiles/cunit_security_core.dir/config.c.o"
+  "CMakeFiles/cunit_security_core.dir/config.c.o.d"
+  "CMakeFiles/cunit_security_core.dir/crypto.c.o"
+  "CMakeFiles/cunit_security_core.dir/crypto.c.o.d"
+  "CMakeFiles/cunit_security_core.dir/cunit_security_core.c.o"
+  "CMakeFiles/cunit_security_core.dir/cunit_security_core.c.o.d"
+  "CMakeFiles/cunit_security_core.dir/fsm.c.o"
+  "CMakeFiles/cunit_security_core.dir/fsm.c.o.d"
+  "CMakeFiles/cunit_security_core.dir/handshake.c.o"
+  "CMakeFiles/cunit_security_core.dir/handshake.c.o.d"
+  "CMakeFiles/cunit_security_core.dir/plugin_loading.c.o"
+  "CMakeFiles/cunit_security_core.dir/plugin_loading.c.o.d"
+  "CMakeFiles/cunit_security_core.dir/secure_communication.c.o"
+  "CMakeFiles/cunit_security_core.dir/secure_communication.c.o.d"
+  "CMakeFiles/cunit_security_core.dir/security_utils.c.o"
+  "CMakeFiles/cunit_security_core.dir/security_utils.c.o.d"
+  "CMakeFiles/cunit_security_core.dir/timed_cb.c.o"
+  "CMakeFiles/cunit_security_core.dir/timed_cb.c.o.d"
+  "SecurityCoreTests.c"
+  "SecurityCoreTests.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cunit_security_core.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
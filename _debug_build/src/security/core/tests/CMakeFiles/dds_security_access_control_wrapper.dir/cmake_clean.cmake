@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dds_security_access_control_wrapper.dir/common/access_control_wrapper.c.o"
+  "CMakeFiles/dds_security_access_control_wrapper.dir/common/access_control_wrapper.c.o.d"
+  "CMakeFiles/dds_security_access_control_wrapper.dir/common/plugin_wrapper_msg_q.c.o"
+  "CMakeFiles/dds_security_access_control_wrapper.dir/common/plugin_wrapper_msg_q.c.o.d"
+  "libdds_security_access_control_wrapper.pdb"
+  "libdds_security_access_control_wrapper.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dds_security_access_control_wrapper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/security/core/tests/common/authentication_wrapper.c" "src/security/core/tests/CMakeFiles/dds_security_authentication_wrapper.dir/common/authentication_wrapper.c.o" "gcc" "src/security/core/tests/CMakeFiles/dds_security_authentication_wrapper.dir/common/authentication_wrapper.c.o.d"
+  "/root/repo/src/security/core/tests/common/plugin_wrapper_msg_q.c" "src/security/core/tests/CMakeFiles/dds_security_authentication_wrapper.dir/common/plugin_wrapper_msg_q.c.o" "gcc" "src/security/core/tests/CMakeFiles/dds_security_authentication_wrapper.dir/common/plugin_wrapper_msg_q.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/src/security/builtin_plugins/authentication/CMakeFiles/dds_security_auth.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/core/CMakeFiles/ddsc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
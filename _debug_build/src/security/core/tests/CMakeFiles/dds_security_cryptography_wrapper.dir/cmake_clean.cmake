@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/dds_security_cryptography_wrapper.dir/common/cryptography_wrapper.c.o"
+  "CMakeFiles/dds_security_cryptography_wrapper.dir/common/cryptography_wrapper.c.o.d"
+  "CMakeFiles/dds_security_cryptography_wrapper.dir/common/plugin_wrapper_msg_q.c.o"
+  "CMakeFiles/dds_security_cryptography_wrapper.dir/common/plugin_wrapper_msg_q.c.o.d"
+  "libdds_security_cryptography_wrapper.pdb"
+  "libdds_security_cryptography_wrapper.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/dds_security_cryptography_wrapper.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,142 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/security/core/tests
+# Build directory: /root/repo/_debug_build/src/security/core/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(CUnit_ddssec_fsm_create "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_fsm" "-t" "create")
+set_tests_properties(CUnit_ddssec_fsm_create PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_fsm_multiple "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_fsm" "-t" "multiple")
+set_tests_properties(CUnit_ddssec_fsm_multiple PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_fsm_timeout "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_fsm" "-t" "timeout")
+set_tests_properties(CUnit_ddssec_fsm_timeout PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_fsm_double_timeout "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_fsm" "-t" "double_timeout")
+set_tests_properties(CUnit_ddssec_fsm_double_timeout PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_fsm_parallel_timeout "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_fsm" "-t" "parallel_timeout")
+set_tests_properties(CUnit_ddssec_fsm_parallel_timeout PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_fsm_delete_with_timeout "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_fsm" "-t" "delete_with_timeout")
+set_tests_properties(CUnit_ddssec_fsm_delete_with_timeout PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_timed_cb_simple_test "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_timed_cb" "-t" "simple_test")
+set_tests_properties(CUnit_ddssec_timed_cb_simple_test PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_timed_cb_simple_order "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_timed_cb" "-t" "simple_order")
+set_tests_properties(CUnit_ddssec_timed_cb_simple_order PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_timed_cb_test_enabled_and_disabled "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_timed_cb" "-t" "test_enabled_and_disabled")
+set_tests_properties(CUnit_ddssec_timed_cb_test_enabled_and_disabled PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_timed_cb_simple_test_with_future "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_timed_cb" "-t" "simple_test_with_future")
+set_tests_properties(CUnit_ddssec_timed_cb_simple_test_with_future PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_timed_cb_test_multiple_dispatchers "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_timed_cb" "-t" "test_multiple_dispatchers")
+set_tests_properties(CUnit_ddssec_timed_cb_test_multiple_dispatchers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_timed_cb_test_create_dispatcher "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_timed_cb" "-t" "test_create_dispatcher")
+set_tests_properties(CUnit_ddssec_timed_cb_test_create_dispatcher PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_timed_cb_test_remove_timer "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_timed_cb" "-t" "test_remove_timer")
+set_tests_properties(CUnit_ddssec_timed_cb_test_remove_timer PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_security_utils_parse_xml_date "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_security_utils" "-t" "parse_xml_date")
+set_tests_properties(CUnit_ddssec_security_utils_parse_xml_date PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_authentication_unauthenticated_pp "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_authentication" "-t" "unauthenticated_pp")
+set_tests_properties(CUnit_ddssec_authentication_unauthenticated_pp PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_authentication_id_ca_certs "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_authentication" "-t" "id_ca_certs")
+set_tests_properties(CUnit_ddssec_authentication_id_ca_certs PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_authentication_trusted_ca_dir "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_authentication" "-t" "trusted_ca_dir")
+set_tests_properties(CUnit_ddssec_authentication_trusted_ca_dir PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_authentication_expired_cert "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_authentication" "-t" "expired_cert")
+set_tests_properties(CUnit_ddssec_authentication_expired_cert PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_authentication_crl "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_authentication" "-t" "crl")
+set_tests_properties(CUnit_ddssec_authentication_crl PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_access_control_permissions_expiry_multiple "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_access_control" "-t" "permissions_expiry_multiple")
+set_tests_properties(CUnit_ddssec_access_control_permissions_expiry_multiple PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "20" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_access_control_encoding_mismatch_rtps "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_access_control" "-t" "encoding_mismatch_rtps")
+set_tests_properties(CUnit_ddssec_access_control_encoding_mismatch_rtps PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_access_control_encoding_mismatch_discovery "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_access_control" "-t" "encoding_mismatch_discovery")
+set_tests_properties(CUnit_ddssec_access_control_encoding_mismatch_discovery PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_access_control_encoding_mismatch_liveliness "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_access_control" "-t" "encoding_mismatch_liveliness")
+set_tests_properties(CUnit_ddssec_access_control_encoding_mismatch_liveliness PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_access_control_encoding_mismatch_metadata "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_access_control" "-t" "encoding_mismatch_metadata")
+set_tests_properties(CUnit_ddssec_access_control_encoding_mismatch_metadata PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_access_control_encoding_mismatch_payload "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_access_control" "-t" "encoding_mismatch_payload")
+set_tests_properties(CUnit_ddssec_access_control_encoding_mismatch_payload PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_access_control_readwrite_protection "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_access_control" "-t" "readwrite_protection")
+set_tests_properties(CUnit_ddssec_access_control_readwrite_protection PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_access_control_denied_topic "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_access_control" "-t" "denied_topic")
+set_tests_properties(CUnit_ddssec_access_control_denied_topic PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_access_control_partition "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_access_control" "-t" "partition")
+set_tests_properties(CUnit_ddssec_access_control_partition PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_access_control_config_parameters_file "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_access_control" "-t" "config_parameters_file")
+set_tests_properties(CUnit_ddssec_access_control_config_parameters_file PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_access_control_permissions_expiry "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_access_control" "-t" "permissions_expiry")
+set_tests_properties(CUnit_ddssec_access_control_permissions_expiry PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_access_control_hooks "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_access_control" "-t" "hooks")
+set_tests_properties(CUnit_ddssec_access_control_hooks PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_access_control_join_access_control "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_access_control" "-t" "join_access_control")
+set_tests_properties(CUnit_ddssec_access_control_join_access_control PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_access_control_discovery_liveliness_protection "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_access_control" "-t" "discovery_liveliness_protection")
+set_tests_properties(CUnit_ddssec_access_control_discovery_liveliness_protection PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "40" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_builtintopic_participant_iid "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_builtintopic" "-t" "participant_iid")
+set_tests_properties(CUnit_ddssec_builtintopic_participant_iid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_config_empty "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_config" "-t" "empty")
+set_tests_properties(CUnit_ddssec_config_empty PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_config_non "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_config" "-t" "non")
+set_tests_properties(CUnit_ddssec_config_non PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_config_missing "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_config" "-t" "missing")
+set_tests_properties(CUnit_ddssec_config_missing PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_config_all "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_config" "-t" "all")
+set_tests_properties(CUnit_ddssec_config_all PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_config_security "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_config" "-t" "security")
+set_tests_properties(CUnit_ddssec_config_security PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_config_deprecated "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_config" "-t" "deprecated")
+set_tests_properties(CUnit_ddssec_config_deprecated PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_config_qos "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_config" "-t" "qos")
+set_tests_properties(CUnit_ddssec_config_qos PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_config_qos_props "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_config" "-t" "qos_props")
+set_tests_properties(CUnit_ddssec_config_qos_props PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_config_config_qos "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_config" "-t" "config_qos")
+set_tests_properties(CUnit_ddssec_config_config_qos PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_config_other_prop "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_config" "-t" "other_prop")
+set_tests_properties(CUnit_ddssec_config_other_prop PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_config_qos_invalid "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_config" "-t" "qos_invalid")
+set_tests_properties(CUnit_ddssec_config_qos_invalid PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_config_qos_invalid_proprietary "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_config" "-t" "qos_invalid_proprietary")
+set_tests_properties(CUnit_ddssec_config_qos_invalid_proprietary PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_config_config_qos_missing_crl "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_config" "-t" "config_qos_missing_crl")
+set_tests_properties(CUnit_ddssec_config_config_qos_missing_crl PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_config_config_qos_override_crl "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_config" "-t" "config_qos_override_crl")
+set_tests_properties(CUnit_ddssec_config_config_qos_override_crl PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_crypto_inject_plain_data "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_crypto" "-t" "inject_plain_data")
+set_tests_properties(CUnit_ddssec_crypto_inject_plain_data PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "30" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_handshake_happy_day "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_handshake" "-t" "happy_day")
+set_tests_properties(CUnit_ddssec_handshake_happy_day PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_handshake_check_tokens "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_handshake" "-t" "check_tokens")
+set_tests_properties(CUnit_ddssec_handshake_check_tokens PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_security_plugin_loading_all_ok "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_security_plugin_loading" "-t" "all_ok")
+set_tests_properties(CUnit_ddssec_security_plugin_loading_all_ok PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_security_plugin_loading_missing_finalize "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_security_plugin_loading" "-t" "missing_finalize")
+set_tests_properties(CUnit_ddssec_security_plugin_loading_missing_finalize PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_security_plugin_loading_authentication_missing_function "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_security_plugin_loading" "-t" "authentication_missing_function")
+set_tests_properties(CUnit_ddssec_security_plugin_loading_authentication_missing_function PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_security_plugin_loading_access_control_missing_function "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_security_plugin_loading" "-t" "access_control_missing_function")
+set_tests_properties(CUnit_ddssec_security_plugin_loading_access_control_missing_function PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_security_plugin_loading_cryptography_missing_function "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_security_plugin_loading" "-t" "cryptography_missing_function")
+set_tests_properties(CUnit_ddssec_security_plugin_loading_cryptography_missing_function PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_security_plugin_loading_no_library_in_path "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_security_plugin_loading" "-t" "no_library_in_path")
+set_tests_properties(CUnit_ddssec_security_plugin_loading_no_library_in_path PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_security_plugin_loading_init_error "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_security_plugin_loading" "-t" "init_error")
+set_tests_properties(CUnit_ddssec_security_plugin_loading_init_error PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_security_plugin_loading_all_ok_with_props "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_security_plugin_loading" "-t" "all_ok_with_props")
+set_tests_properties(CUnit_ddssec_security_plugin_loading_all_ok_with_props PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_security_plugin_loading_missing_plugin_property_with_props "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_security_plugin_loading" "-t" "missing_plugin_property_with_props")
+set_tests_properties(CUnit_ddssec_security_plugin_loading_missing_plugin_property_with_props PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_security_plugin_loading_empty_plugin_property_with_props "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_security_plugin_loading" "-t" "empty_plugin_property_with_props")
+set_tests_properties(CUnit_ddssec_security_plugin_loading_empty_plugin_property_with_props PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_security_plugin_loading_missing_security_property_with_props "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_security_plugin_loading" "-t" "missing_security_property_with_props")
+set_tests_properties(CUnit_ddssec_security_plugin_loading_missing_security_property_with_props PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_security_plugin_loading_multiple_domains_different_config "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_security_plugin_loading" "-t" "multiple_domains_different_config")
+set_tests_properties(CUnit_ddssec_security_plugin_loading_multiple_domains_different_config PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_secure_communication_protection_kinds "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_secure_communication" "-t" "protection_kinds")
+set_tests_properties(CUnit_ddssec_secure_communication_protection_kinds PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "120" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_secure_communication_discovery_liveliness_protection "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_secure_communication" "-t" "discovery_liveliness_protection")
+set_tests_properties(CUnit_ddssec_secure_communication_discovery_liveliness_protection PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_secure_communication_check_encrypted_secret "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_secure_communication" "-t" "check_encrypted_secret")
+set_tests_properties(CUnit_ddssec_secure_communication_check_encrypted_secret PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_secure_communication_multiple_readers "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_secure_communication" "-t" "multiple_readers")
+set_tests_properties(CUnit_ddssec_secure_communication_multiple_readers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "90" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
+add_test(CUnit_ddssec_secure_communication_multiple_readers_writers "/root/repo/_debug_build/bin/cunit_security_core" "-s" "ddssec_secure_communication" "-t" "multiple_readers_writers")
+set_tests_properties(CUnit_ddssec_secure_communication_multiple_readers_writers PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "60" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/security/core/tests/CMakeLists.txt;95;add_cunit_executable;/root/repo/src/security/core/tests/CMakeLists.txt;0;")
@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tools/ddsperf/async_listener.c" "src/tools/ddsperf/CMakeFiles/ddsperf.dir/async_listener.c.o" "gcc" "src/tools/ddsperf/CMakeFiles/ddsperf.dir/async_listener.c.o.d"
+  "/root/repo/src/tools/ddsperf/cputime.c" "src/tools/ddsperf/CMakeFiles/ddsperf.dir/cputime.c.o" "gcc" "src/tools/ddsperf/CMakeFiles/ddsperf.dir/cputime.c.o.d"
+  "/root/repo/src/tools/ddsperf/ddsperf.c" "src/tools/ddsperf/CMakeFiles/ddsperf.dir/ddsperf.c.o" "gcc" "src/tools/ddsperf/CMakeFiles/ddsperf.dir/ddsperf.c.o.d"
+  "/root/repo/_debug_build/src/tools/ddsperf/ddsperf_types.c" "src/tools/ddsperf/CMakeFiles/ddsperf.dir/ddsperf_types.c.o" "gcc" "src/tools/ddsperf/CMakeFiles/ddsperf.dir/ddsperf_types.c.o.d"
+  "/root/repo/src/tools/ddsperf/netload.c" "src/tools/ddsperf/CMakeFiles/ddsperf.dir/netload.c.o" "gcc" "src/tools/ddsperf/CMakeFiles/ddsperf.dir/netload.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_debug_build/src/tools/ddsperf/ddsperf_types.h" "/root/repo/_debug_build/src/tools/ddsperf/ddsperf_types.c"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/src/core/CMakeFiles/ddsc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,21 @@
+file(REMOVE_RECURSE
+  "../../../bin/ddsperf"
+  "../../../bin/ddsperf.pdb"
+  "CMakeFiles/ddsperf.dir/async_listener.c.o"
+  "CMakeFiles/ddsperf.dir/async_listener.c.o.d"
+  "CMakeFiles/ddsperf.dir/cputime.c.o"
+  "CMakeFiles/ddsperf.dir/cputime.c.o.d"
+  "CMakeFiles/ddsperf.dir/ddsperf.c.o"
+  "CMakeFiles/ddsperf.dir/ddsperf.c.o.d"
+  "CMakeFiles/ddsperf.dir/ddsperf_types.c.o"
+  "CMakeFiles/ddsperf.dir/ddsperf_types.c.o.d"
+  "CMakeFiles/ddsperf.dir/netload.c.o"
+  "CMakeFiles/ddsperf.dir/netload.c.o.d"
+  "ddsperf_types.c"
+  "ddsperf_types.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ddsperf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ddsperf_types_generate"
+  "ddsperf_types.c"
+  "ddsperf_types.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/ddsperf_types_generate.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,1671 @@
+/****************************************************************
+
+  Generated by Eclipse Cyclone DDS IDL to C Translator
+  File name: /root/repo/_debug_build/src/tools/ddsperf/ddsperf_types.c
+  Source: /root/repo/src/tools/ddsperf/ddsperf_types.idl
+  Cyclone DDS: V0.11.0
+
+*****************************************************************/
+#include "ddsperf_types.h"
+
+static const uint32_t OneULong_ops [] =
+{
+  /* OneULong */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (OneULong, seq),
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 37b1b690826fc9b8c3009c310b10] (#deps: 0)
+  [COMPLETE bcabe1283d9f5b841ce820368020] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_OneULong (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x37, 0xb1, 0xb6, 0x90, 0x82, 0x6f, 0xc9, 0xb8, 0xc3, 0x00, 0x9c, \
+  0x31, 0x0b, 0x10, 0x00, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xbc, 0xab, 0xe1, 0x28, 0x3d, 0x9f, 0x5b, 0x84, 0x1c, 0xe8, 0x20, \
+  0x36, 0x80, 0x20, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_OneULong 100u
+#define TYPE_MAP_CDR_OneULong (unsigned char []){ \
+  0x3b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x37, 0xb1, 0xb6, 0x90, 0x82, 0x6f, 0xc9, \
+  0xb8, 0xc3, 0x00, 0x9c, 0x31, 0x0b, 0x10, 0x00, 0x23, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xe0, 0x68, 0xc2, 0xde, 0x00, \
+  0x52, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xbc, 0xab, 0xe1, 0x28, 0x3d, 0x9f, 0x5b, \
+  0x84, 0x1c, 0xe8, 0x20, 0x36, 0x80, 0x20, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x4f, 0x6e, 0x65, 0x55, \
+  0x4c, 0x6f, 0x6e, 0x67, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x73, 0x65, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xbc, 0xab, 0xe1, 0x28, 0x3d, 0x9f, 0x5b, 0x84, 0x1c, 0xe8, 0x20, 0x36, 0x80, 0x20, 0xf1, \
+  0x37, 0xb1, 0xb6, 0x90, 0x82, 0x6f, 0xc9, 0xb8, 0xc3, 0x00, 0x9c, 0x31, 0x0b, 0x10\
+}
+#define TYPE_MAP_CDR_SZ_OneULong 190u
+const dds_topic_descriptor_t OneULong_desc =
+{
+  .m_size = sizeof (OneULong),
+  .m_align = dds_alignof (OneULong),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "OneULong",
+  .m_keys = NULL,
+  .m_nops = 2,
+  .m_ops = OneULong_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_OneULong, .sz = TYPE_INFO_CDR_SZ_OneULong },
+  .type_mapping = { .data = TYPE_MAP_CDR_OneULong, .sz = TYPE_MAP_CDR_SZ_OneULong }
+};
+
+static const uint32_t Unkeyed16_ops [] =
+{
+  /* Unkeyed16 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (Unkeyed16, seq),
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY, offsetof (Unkeyed16, baggage), 12u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 3a1ae6cacd3d8bea891c25068108] (#deps: 0)
+  [COMPLETE fcd8c5d7c99166f492b1dfc404b2] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_Unkeyed16 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x3a, 0x1a, 0xe6, 0xca, 0xcd, 0x3d, 0x8b, 0xea, 0x89, 0x1c, 0x25, \
+  0x06, 0x81, 0x08, 0x00, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xfc, 0xd8, 0xc5, 0xd7, 0xc9, 0x91, 0x66, 0xf4, 0x92, 0xb1, 0xdf, \
+  0xc4, 0x04, 0xb2, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Unkeyed16 100u
+#define TYPE_MAP_CDR_Unkeyed16 (unsigned char []){ \
+  0x56, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x3a, 0x1a, 0xe6, 0xca, 0xcd, 0x3d, 0x8b, \
+  0xea, 0x89, 0x1c, 0x25, 0x06, 0x81, 0x08, 0x00, 0x3e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xe0, 0x68, 0xc2, 0xde, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x0c, 0x02, 0xc7, 0xad, 0xc2, 0xf1, 0x00, 0x00, 0x7a, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xfc, 0xd8, 0xc5, 0xd7, 0xc9, 0x91, 0x66, 0xf4, 0x92, 0xb1, 0xdf, \
+  0xc4, 0x04, 0xb2, 0x00, 0x62, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x55, 0x6e, 0x6b, 0x65, 0x79, 0x65, 0x64, 0x31, \
+  0x36, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x62, 0x61, 0x67, 0x67, 0x61, 0x67, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0xfc, 0xd8, 0xc5, 0xd7, 0xc9, 0x91, 0x66, 0xf4, 0x92, 0xb1, 0xdf, \
+  0xc4, 0x04, 0xb2, 0xf1, 0x3a, 0x1a, 0xe6, 0xca, 0xcd, 0x3d, 0x8b, 0xea, 0x89, 0x1c, 0x25, 0x06, \
+  0x81, 0x08\
+}
+#define TYPE_MAP_CDR_SZ_Unkeyed16 258u
+const dds_topic_descriptor_t Unkeyed16_desc =
+{
+  .m_size = sizeof (Unkeyed16),
+  .m_align = dds_alignof (Unkeyed16),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "Unkeyed16",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = Unkeyed16_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Unkeyed16, .sz = TYPE_INFO_CDR_SZ_Unkeyed16 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Unkeyed16, .sz = TYPE_MAP_CDR_SZ_Unkeyed16 }
+};
+
+static const uint32_t Unkeyed1024_ops [] =
+{
+  /* Unkeyed1024 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (Unkeyed1024, seq),
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY, offsetof (Unkeyed1024, baggage), 1020u,
+  DDS_OP_RTS
+};
+
+/* Type Information:
+  [MINIMAL 5ff2b108a8f4770800ce07568872] (#deps: 0)
+  [COMPLETE 49c126412024325121ccbd3e5630] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_Unkeyed1024 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x5f, 0xf2, 0xb1, 0x08, 0xa8, 0xf4, 0x77, 0x08, 0x00, 0xce, 0x07, \
+  0x56, 0x88, 0x72, 0x00, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x49, 0xc1, 0x26, 0x41, 0x20, 0x24, 0x32, 0x51, 0x21, 0xcc, 0xbd, \
+  0x3e, 0x56, 0x30, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Unkeyed1024 100u
+#define TYPE_MAP_CDR_Unkeyed1024 (unsigned char []){ \
+  0x59, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x5f, 0xf2, 0xb1, 0x08, 0xa8, 0xf4, 0x77, \
+  0x08, 0x00, 0xce, 0x07, 0x56, 0x88, 0x72, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xe0, 0x68, 0xc2, 0xde, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x91, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00, 0x02, 0xc7, 0xad, 0xc2, 0xf1, 0x00, 0x00, 0x00, \
+  0x7e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x49, 0xc1, 0x26, 0x41, 0x20, 0x24, 0x32, \
+  0x51, 0x21, 0xcc, 0xbd, 0x3e, 0x56, 0x30, 0x00, 0x66, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x55, 0x6e, 0x6b, 0x65, \
+  0x79, 0x65, 0x64, 0x31, 0x30, 0x32, 0x34, 0x00, 0x46, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x73, 0x65, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x91, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x62, 0x61, 0x67, 0x67, 0x61, 0x67, 0x65, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x49, 0xc1, 0x26, \
+  0x41, 0x20, 0x24, 0x32, 0x51, 0x21, 0xcc, 0xbd, 0x3e, 0x56, 0x30, 0xf1, 0x5f, 0xf2, 0xb1, 0x08, \
+  0xa8, 0xf4, 0x77, 0x08, 0x00, 0xce, 0x07, 0x56, 0x88, 0x72\
+}
+#define TYPE_MAP_CDR_SZ_Unkeyed1024 266u
+const dds_topic_descriptor_t Unkeyed1024_desc =
+{
+  .m_size = sizeof (Unkeyed1024),
+  .m_align = dds_alignof (Unkeyed1024),
+  .m_flagset = DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 0u,
+  .m_typename = "Unkeyed1024",
+  .m_keys = NULL,
+  .m_nops = 3,
+  .m_ops = Unkeyed1024_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Unkeyed1024, .sz = TYPE_INFO_CDR_SZ_Unkeyed1024 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Unkeyed1024, .sz = TYPE_MAP_CDR_SZ_Unkeyed1024 }
+};
+
+static const uint32_t Keyed32_ops [] =
+{
+  /* Keyed32 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (Keyed32, seq),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (Keyed32, keyval),
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY, offsetof (Keyed32, baggage), 24u,
+  DDS_OP_RTS,
+  
+  /* key: keyval */
+  DDS_OP_KOF | 1, 2u /* order: 1 */
+};
+
+static const dds_key_descriptor_t Keyed32_keys[1] =
+{
+  { "keyval", 8, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 1437fad3b97d77016ab0077670ac] (#deps: 0)
+  [COMPLETE 7a866646e17f2233ce651f82e31f] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_Keyed32 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x14, 0x37, 0xfa, 0xd3, 0xb9, 0x7d, 0x77, 0x01, 0x6a, 0xb0, 0x07, \
+  0x76, 0x70, 0xac, 0x00, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x7a, 0x86, 0x66, 0x46, 0xe1, 0x7f, 0x22, 0x33, 0xce, 0x65, 0x1f, \
+  0x82, 0xe3, 0x1f, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Keyed32 100u
+#define TYPE_MAP_CDR_Keyed32 (unsigned char []){ \
+  0x66, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x14, 0x37, 0xfa, 0xd3, 0xb9, 0x7d, 0x77, \
+  0x01, 0x6a, 0xb0, 0x07, 0x76, 0x70, 0xac, 0x00, 0x4e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xe0, 0x68, 0xc2, 0xde, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x46, 0x2e, 0x6d, 0xa1, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x18, 0x02, 0xc7, 0xad, 0xc2, 0xf1, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x7a, 0x86, 0x66, 0x46, 0xe1, 0x7f, 0x22, 0x33, 0xce, 0x65, 0x1f, \
+  0x82, 0xe3, 0x1f, 0x00, 0x7a, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x4b, 0x65, 0x79, 0x65, 0x64, 0x33, 0x32, 0x00, \
+  0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x6b, 0x65, 0x79, 0x76, 0x61, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x18, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x62, 0x61, 0x67, 0x67, 0x61, 0x67, 0x65, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x7a, 0x86, 0x66, \
+  0x46, 0xe1, 0x7f, 0x22, 0x33, 0xce, 0x65, 0x1f, 0x82, 0xe3, 0x1f, 0xf1, 0x14, 0x37, 0xfa, 0xd3, \
+  0xb9, 0x7d, 0x77, 0x01, 0x6a, 0xb0, 0x07, 0x76, 0x70, 0xac\
+}
+#define TYPE_MAP_CDR_SZ_Keyed32 298u
+const dds_topic_descriptor_t Keyed32_desc =
+{
+  .m_size = sizeof (Keyed32),
+  .m_align = dds_alignof (Keyed32),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "Keyed32",
+  .m_keys = Keyed32_keys,
+  .m_nops = 4,
+  .m_ops = Keyed32_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Keyed32, .sz = TYPE_INFO_CDR_SZ_Keyed32 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Keyed32, .sz = TYPE_MAP_CDR_SZ_Keyed32 }
+};
+
+static const uint32_t Keyed256_ops [] =
+{
+  /* Keyed256 */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (Keyed256, seq),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (Keyed256, keyval),
+  DDS_OP_ADR | DDS_OP_TYPE_ARR | DDS_OP_SUBTYPE_1BY, offsetof (Keyed256, baggage), 248u,
+  DDS_OP_RTS,
+  
+  /* key: keyval */
+  DDS_OP_KOF | 1, 2u /* order: 1 */
+};
+
+static const dds_key_descriptor_t Keyed256_keys[1] =
+{
+  { "keyval", 8, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 869a1896966c138e68f84db3fe5c] (#deps: 0)
+  [COMPLETE 4c7a8b4d415f87f0127b07090408] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_Keyed256 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x86, 0x9a, 0x18, 0x96, 0x96, 0x6c, 0x13, 0x8e, 0x68, 0xf8, 0x4d, \
+  0xb3, 0xfe, 0x5c, 0x00, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x4c, 0x7a, 0x8b, 0x4d, 0x41, 0x5f, 0x87, 0xf0, 0x12, 0x7b, 0x07, \
+  0x09, 0x04, 0x08, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Keyed256 100u
+#define TYPE_MAP_CDR_Keyed256 (unsigned char []){ \
+  0x66, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x86, 0x9a, 0x18, 0x96, 0x96, 0x6c, 0x13, \
+  0x8e, 0x68, 0xf8, 0x4d, 0xb3, 0xfe, 0x5c, 0x00, 0x4e, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xe0, 0x68, 0xc2, 0xde, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x46, 0x2e, 0x6d, 0xa1, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf8, 0x02, 0xc7, 0xad, 0xc2, 0xf1, 0x00, 0x00, 0x96, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x4c, 0x7a, 0x8b, 0x4d, 0x41, 0x5f, 0x87, 0xf0, 0x12, 0x7b, 0x07, \
+  0x09, 0x04, 0x08, 0x00, 0x7e, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x4b, 0x65, 0x79, 0x65, 0x64, 0x32, 0x35, 0x36, \
+  0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x76, 0x61, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x90, 0xf3, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf8, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x62, 0x61, 0x67, 0x67, \
+  0x61, 0x67, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0x4c, 0x7a, 0x8b, 0x4d, 0x41, 0x5f, 0x87, 0xf0, 0x12, 0x7b, 0x07, 0x09, 0x04, 0x08, 0xf1, \
+  0x86, 0x9a, 0x18, 0x96, 0x96, 0x6c, 0x13, 0x8e, 0x68, 0xf8, 0x4d, 0xb3, 0xfe, 0x5c\
+}
+#define TYPE_MAP_CDR_SZ_Keyed256 302u
+const dds_topic_descriptor_t Keyed256_desc =
+{
+  .m_size = sizeof (Keyed256),
+  .m_align = dds_alignof (Keyed256),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "Keyed256",
+  .m_keys = Keyed256_keys,
+  .m_nops = 4,
+  .m_ops = Keyed256_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Keyed256, .sz = TYPE_INFO_CDR_SZ_Keyed256 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Keyed256, .sz = TYPE_MAP_CDR_SZ_Keyed256 }
+};
+
+static const uint32_t KeyedSeq_ops [] =
+{
+  /* KeyedSeq */
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (KeyedSeq, seq),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (KeyedSeq, keyval),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_1BY, offsetof (KeyedSeq, baggage),
+  DDS_OP_RTS,
+  
+  /* key: keyval */
+  DDS_OP_KOF | 1, 2u /* order: 1 */
+};
+
+static const dds_key_descriptor_t KeyedSeq_keys[1] =
+{
+  { "keyval", 7, 0 }
+};
+
+/* Type Information:
+  [MINIMAL fa0413693f17171633962dcd81a2] (#deps: 0)
+  [COMPLETE c6e6285a68c8f6cd7c4203c46cb2] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_KeyedSeq (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xfa, 0x04, 0x13, 0x69, 0x3f, 0x17, 0x17, 0x16, 0x33, 0x96, 0x2d, \
+  0xcd, 0x81, 0xa2, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0xc6, 0xe6, 0x28, 0x5a, 0x68, 0xc8, 0xf6, 0xcd, 0x7c, 0x42, 0x03, \
+  0xc4, 0x6c, 0xb2, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_KeyedSeq 100u
+#define TYPE_MAP_CDR_KeyedSeq (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0xfa, 0x04, 0x13, 0x69, 0x3f, 0x17, 0x17, \
+  0x16, 0x33, 0x96, 0x2d, 0xcd, 0x81, 0xa2, 0x00, 0x48, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xe0, 0x68, 0xc2, 0xde, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x46, 0x2e, 0x6d, 0xa1, 0x00, \
+  0x10, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x02, \
+  0xc7, 0xad, 0xc2, 0xf1, 0x8e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0xc6, 0xe6, 0x28, \
+  0x5a, 0x68, 0xc8, 0xf6, 0xcd, 0x7c, 0x42, 0x03, 0xc4, 0x6c, 0xb2, 0x00, 0x76, 0x00, 0x00, 0x00, \
+  0xf2, 0x51, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x4b, 0x65, 0x79, 0x65, 0x64, 0x53, 0x65, 0x71, 0x00, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, \
+  0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x76, \
+  0x61, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x80, 0xf3, 0x01, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, 0x00, 0x62, 0x61, 0x67, 0x67, \
+  0x61, 0x67, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0xf2, 0xc6, 0xe6, 0x28, 0x5a, 0x68, 0xc8, 0xf6, 0xcd, 0x7c, 0x42, 0x03, 0xc4, 0x6c, 0xb2, 0xf1, \
+  0xfa, 0x04, 0x13, 0x69, 0x3f, 0x17, 0x17, 0x16, 0x33, 0x96, 0x2d, 0xcd, 0x81, 0xa2\
+}
+#define TYPE_MAP_CDR_SZ_KeyedSeq 286u
+const dds_topic_descriptor_t KeyedSeq_desc =
+{
+  .m_size = sizeof (KeyedSeq),
+  .m_align = dds_alignof (KeyedSeq),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "KeyedSeq",
+  .m_keys = KeyedSeq_keys,
+  .m_nops = 4,
+  .m_ops = KeyedSeq_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_KeyedSeq, .sz = TYPE_INFO_CDR_SZ_KeyedSeq },
+  .type_mapping = { .data = TYPE_MAP_CDR_KeyedSeq, .sz = TYPE_MAP_CDR_SZ_KeyedSeq }
+};
+
+static const uint32_t CPUStats_ops [] =
+{
+  /* CPUStats */
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_STR, offsetof (CPUStats, hostname),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (CPUStats, pid),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_FP, offsetof (CPUStats, maxrss),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (CPUStats, vcsw),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (CPUStats, ivcsw),
+  DDS_OP_ADR | DDS_OP_TYPE_BLN, offsetof (CPUStats, some_above),
+  DDS_OP_ADR | DDS_OP_TYPE_SEQ | DDS_OP_SUBTYPE_STU, offsetof (CPUStats, cpu), sizeof (CPUStatThread), (4u << 16u) + 5u /* CPUStatThread */,
+  DDS_OP_RTS,
+
+  /* CPUStatThread */
+  DDS_OP_ADR | DDS_OP_TYPE_STR, offsetof (CPUStatThread, name),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CPUStatThread, u_pct),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY | DDS_OP_FLAG_SGN, offsetof (CPUStatThread, s_pct),
+  DDS_OP_RTS,
+  
+  /* key: hostname */
+  DDS_OP_KOF | 1, 0u /* order: 0 */,
+  
+  /* key: pid */
+  DDS_OP_KOF | 1, 2u /* order: 1 */
+};
+
+static const dds_key_descriptor_t CPUStats_keys[2] =
+{
+  { "hostname", 24, 0 },
+  { "pid", 26, 1 }
+};
+
+/* Type Information:
+  [MINIMAL 27c902397800af12dc1aff0c1212] (#deps: 1)
+   - [MINIMAL 91f354b8e134e42f8d513e316e88]
+  [COMPLETE 59c345a058a7fd92f6669f2a279b] (#deps: 1)
+   - [COMPLETE 8383ddd15723cf04f58796fd2fb9]
+*/
+#define TYPE_INFO_CDR_CPUStats (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x27, 0xc9, 0x02, 0x39, 0x78, 0x00, 0xaf, 0x12, 0xdc, 0x1a, 0xff, \
+  0x0c, 0x12, 0x12, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x91, 0xf3, 0x54, 0xb8, 0xe1, 0x34, 0xe4, \
+  0x2f, 0x8d, 0x51, 0x3e, 0x31, 0x6e, 0x88, 0x00, 0x47, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x59, 0xc3, 0x45, \
+  0xa0, 0x58, 0xa7, 0xfd, 0x92, 0xf6, 0x66, 0x9f, 0x2a, 0x27, 0x9b, 0x00, 0xf2, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x83, 0x83, 0xdd, 0xd1, 0x57, 0x23, 0xcf, 0x04, 0xf5, 0x87, 0x96, 0xfd, 0x2f, 0xb9, 0x00, \
+  0x74, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_CPUStats 148u
+#define TYPE_MAP_CDR_CPUStats (unsigned char []){ \
+  0x07, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0x27, 0xc9, 0x02, 0x39, 0x78, 0x00, 0xaf, \
+  0x12, 0xdc, 0x1a, 0xff, 0x0c, 0x12, 0x12, 0x00, 0x96, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0x08, 0x97, 0xac, 0xf4, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x0d, 0xb3, 0x20, 0x9e, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x30, 0x0b, 0x59, 0x0a, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x8d, 0x83, 0xcd, 0xf2, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x0b, 0xc5, 0x1e, 0x9a, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x7a, 0x6f, 0x82, 0x3e, 0x00, \
+  0x1e, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf1, 0x01, 0x00, 0x00, 0xf1, \
+  0x91, 0xf3, 0x54, 0xb8, 0xe1, 0x34, 0xe4, 0x2f, 0x8d, 0x51, 0x3e, 0x31, 0x6e, 0x88, 0xd9, 0x74, \
+  0x7e, 0x2d, 0xf1, 0x91, 0xf3, 0x54, 0xb8, 0xe1, 0x34, 0xe4, 0x2f, 0x8d, 0x51, 0x3e, 0x31, 0x6e, \
+  0x88, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0xf1, 0x51, 0x09, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, 0xb0, 0x68, 0x93, 0x1c, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x5c, 0x8d, 0x91, 0xa4, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x19, 0x09, 0x3a, 0x0c, 0x00, 0x8c, 0x01, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x59, 0xc3, 0x45, 0xa0, 0x58, 0xa7, 0xfd, 0x92, 0xf6, 0x66, 0x9f, \
+  0x2a, 0x27, 0x9b, 0x00, 0xee, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x43, 0x50, 0x55, 0x53, 0x74, 0x61, 0x74, 0x73, \
+  0x00, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x70, 0x00, 0x09, 0x00, 0x00, 0x00, 0x68, 0x6f, 0x73, 0x74, \
+  0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x70, 0x69, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x6d, 0x61, 0x78, 0x72, 0x73, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x00, 0x76, 0x63, 0x73, 0x77, \
+  0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x69, 0x76, 0x63, 0x73, 0x77, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x6f, 0x6d, 0x65, \
+  0x5f, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x80, 0xf2, 0x01, 0x00, 0x00, 0xf2, 0x83, 0x83, 0xdd, 0xd1, \
+  0x57, 0x23, 0xcf, 0x04, 0xf5, 0x87, 0x96, 0xfd, 0x2f, 0xb9, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x63, 0x70, 0x75, 0x00, 0x00, 0x00, 0xf2, 0x83, 0x83, 0xdd, 0xd1, 0x57, 0x23, 0xcf, 0x04, 0xf5, \
+  0x87, 0x96, 0xfd, 0x2f, 0xb9, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x09, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x43, 0x50, 0x55, 0x53, \
+  0x74, 0x61, 0x74, 0x54, 0x68, 0x72, 0x65, 0x61, 0x64, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x70, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x6e, 0x61, 0x6d, 0x65, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x75, 0x5f, 0x70, 0x63, \
+  0x74, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00, \
+  0x06, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x70, 0x63, 0x74, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0xf2, 0x59, 0xc3, 0x45, 0xa0, 0x58, 0xa7, 0xfd, 0x92, 0xf6, 0x66, 0x9f, \
+  0x2a, 0x27, 0x9b, 0xf1, 0x27, 0xc9, 0x02, 0x39, 0x78, 0x00, 0xaf, 0x12, 0xdc, 0x1a, 0xff, 0x0c, \
+  0x12, 0x12, 0xf2, 0x83, 0x83, 0xdd, 0xd1, 0x57, 0x23, 0xcf, 0x04, 0xf5, 0x87, 0x96, 0xfd, 0x2f, \
+  0xb9, 0xf1, 0x91, 0xf3, 0x54, 0xb8, 0xe1, 0x34, 0xe4, 0x2f, 0x8d, 0x51, 0x3e, 0x31, 0x6e, 0x88\
+}
+#define TYPE_MAP_CDR_SZ_CPUStats 736u
+const dds_topic_descriptor_t CPUStats_desc =
+{
+  .m_size = sizeof (CPUStats),
+  .m_align = dds_alignof (CPUStats),
+  .m_flagset = DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 2u,
+  .m_typename = "CPUStats",
+  .m_keys = CPUStats_keys,
+  .m_nops = 12,
+  .m_ops = CPUStats_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_CPUStats, .sz = TYPE_INFO_CDR_SZ_CPUStats },
+  .type_mapping = { .data = TYPE_MAP_CDR_CPUStats, .sz = TYPE_MAP_CDR_SZ_CPUStats }
+};
+
+static const uint32_t Struct16_ops [] =
+{
+  /* Struct16 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct0),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct1),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct2),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct3),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct4),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct5),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct6),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct7),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct8),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct9),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structa),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structb),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structc),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structd),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structe),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structf),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (Struct16, junk),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (Struct16, seq),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (Struct16, keyval),
+  DDS_OP_RTS,
+  
+  /* key: keyval */
+  DDS_OP_KOF | 1, 36u /* order: 18 */
+};
+
+static const dds_key_descriptor_t Struct16_keys[1] =
+{
+  { "keyval", 39, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 54e98945d81c91e9e5c8a0db70b4] (#deps: 0)
+  [COMPLETE 8e1101a3870be07c68be641c4bd9] (#deps: 0)
+*/
+#define TYPE_INFO_CDR_Struct16 (unsigned char []){ \
+  0x60, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, \
+  0xdb, 0x70, 0xb4, 0x00, 0x47, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x28, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, \
+  0x1c, 0x4b, 0xd9, 0x00, 0x31, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Struct16 100u
+#define TYPE_MAP_CDR_Struct16 (unsigned char []){ \
+  0x5b, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, \
+  0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x00, 0x43, 0x01, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xa8, 0x89, 0x52, 0x2d, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xb7, 0x8b, 0x0f, 0x01, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x96, 0xe7, 0x0c, 0xe1, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x23, 0xf3, 0xb2, 0x1f, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xc0, 0xf2, 0x65, 0x1f, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xf1, 0x69, 0x11, 0x8b, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x37, 0x75, 0xe2, 0x76, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xdb, 0xc3, 0x99, 0x9c, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x43, 0xc7, 0x17, 0x20, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xb1, 0x41, 0xce, 0x96, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x8a, 0xd2, 0xcc, 0xb1, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xd2, 0x35, 0xa8, 0x42, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xa2, 0x1c, 0x56, 0x13, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x98, 0x67, 0x5e, 0xe2, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x30, 0x84, 0x4f, 0xfe, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x19, 0x49, 0x9e, 0xa8, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x0c, 0x82, 0x1f, 0x67, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xe0, 0x68, 0xc2, 0xde, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x46, 0x2e, 0x6d, 0xa1, 0x00, \
+  0x45, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, \
+  0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x2d, 0x02, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x53, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x31, 0x36, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x36, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x61, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x65, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x6a, 0x75, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x6b, 0x65, 0x79, 0x76, 0x61, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, \
+  0x1c, 0x4b, 0xd9, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, \
+  0x70, 0xb4\
+}
+#define TYPE_MAP_CDR_SZ_Struct16 978u
+const dds_topic_descriptor_t Struct16_desc =
+{
+  .m_size = sizeof (Struct16),
+  .m_align = dds_alignof (Struct16),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "Struct16",
+  .m_keys = Struct16_keys,
+  .m_nops = 20,
+  .m_ops = Struct16_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Struct16, .sz = TYPE_INFO_CDR_SZ_Struct16 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Struct16, .sz = TYPE_MAP_CDR_SZ_Struct16 }
+};
+
+static const uint32_t Struct256_ops [] =
+{
+  /* Struct256 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct160), (3u << 16u) + 55u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct161), (3u << 16u) + 52u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct162), (3u << 16u) + 49u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct163), (3u << 16u) + 46u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct164), (3u << 16u) + 43u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct165), (3u << 16u) + 40u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct166), (3u << 16u) + 37u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct167), (3u << 16u) + 34u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct168), (3u << 16u) + 31u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct169), (3u << 16u) + 28u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16a), (3u << 16u) + 25u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16b), (3u << 16u) + 22u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16c), (3u << 16u) + 19u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16d), (3u << 16u) + 16u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16e), (3u << 16u) + 13u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16f), (3u << 16u) + 10u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (Struct256, junk),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (Struct256, seq),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (Struct256, keyval),
+  DDS_OP_RTS,
+
+  /* Struct16 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct0),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct1),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct2),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct3),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct4),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct5),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct6),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct7),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct8),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct9),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structa),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structb),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structc),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structd),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structe),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structf),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (Struct16, junk),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (Struct16, seq),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (Struct16, keyval),
+  DDS_OP_RTS,
+  
+  /* key: keyval */
+  DDS_OP_KOF | 1, 52u /* order: 18 */
+};
+
+static const dds_key_descriptor_t Struct256_keys[1] =
+{
+  { "keyval", 94, 0 }
+};
+
+/* Type Information:
+  [MINIMAL de852d85fd42386c30d1b0ea9d9c] (#deps: 1)
+   - [MINIMAL 54e98945d81c91e9e5c8a0db70b4]
+  [COMPLETE 7635dd61178d003b02a8ce07d33b] (#deps: 1)
+   - [COMPLETE 8e1101a3870be07c68be641c4bd9]
+*/
+#define TYPE_INFO_CDR_Struct256 (unsigned char []){ \
+  0x90, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, \
+  0xea, 0x9d, 0x9c, 0x00, 0x47, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, \
+  0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x00, 0x47, 0x01, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x40, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x76, 0x35, 0xdd, \
+  0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x31, 0x03, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, \
+  0x31, 0x02, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Struct256 148u
+#define TYPE_MAP_CDR_Struct256 (unsigned char []){ \
+  0xb3, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, \
+  0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0x00, 0x43, 0x02, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x02, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0xc7, 0x67, 0x18, 0xc4, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x9c, 0x94, 0x22, 0x60, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0xa2, 0xe4, 0x9e, 0x0d, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x7e, 0x2f, 0x3c, 0x8f, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0xb1, 0xc2, 0xc8, 0xa0, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x3f, 0x5e, 0x65, 0xa4, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x2e, 0xdd, 0xa3, 0xc8, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x1b, 0x95, 0x11, 0x64, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x62, 0xf3, 0xb4, 0xe5, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0xf1, 0x61, 0xec, 0xe0, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x4d, 0x9a, 0xb1, 0xaf, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0xac, 0x1f, 0xb2, 0xe6, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0xe6, 0x3f, 0x3b, 0x0e, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0xdd, 0x3a, 0x57, 0xfe, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x64, 0x7d, 0xd6, 0x62, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x77, 0x7a, 0x44, 0xef, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x0c, 0x82, 0x1f, 0x67, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xe0, 0x68, 0xc2, 0xde, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x46, 0x2e, 0x6d, 0xa1, 0xf1, \
+  0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x00, 0x00, \
+  0x43, 0x01, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x33, 0x01, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xa8, 0x89, 0x52, 0x2d, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xb7, 0x8b, 0x0f, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x96, 0xe7, 0x0c, 0xe1, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x23, 0xf3, 0xb2, 0x1f, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xc0, 0xf2, 0x65, 0x1f, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xf1, 0x69, 0x11, 0x8b, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x37, 0x75, 0xe2, 0x76, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xdb, 0xc3, 0x99, 0x9c, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x43, 0xc7, 0x17, 0x20, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xb1, 0x41, 0xce, 0x96, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x8a, 0xd2, 0xcc, 0xb1, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xd2, 0x35, 0xa8, 0x42, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xa2, 0x1c, 0x56, 0x13, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x98, 0x67, 0x5e, 0xe2, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x30, 0x84, 0x4f, 0xfe, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x19, 0x49, 0x9e, 0xa8, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x05, 0x0c, 0x82, 0x1f, 0x67, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x07, 0xe0, 0x68, 0xc2, 0xde, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x07, 0x46, 0x2e, 0x6d, 0xa1, 0x00, 0x85, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, \
+  0x2d, 0x03, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x00, 0x00, 0x00, \
+  0x0d, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, \
+  0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, \
+  0x30, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, \
+  0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x31, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, \
+  0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x32, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, \
+  0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x31, 0x36, 0x33, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, \
+  0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, \
+  0x34, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, \
+  0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x35, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, \
+  0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x36, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, \
+  0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x31, 0x36, 0x37, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, \
+  0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, \
+  0x38, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, \
+  0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x39, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, \
+  0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x61, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, \
+  0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x31, 0x36, 0x62, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, \
+  0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, \
+  0x63, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, \
+  0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x64, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, \
+  0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x65, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, \
+  0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x31, 0x36, 0x66, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x6a, 0x75, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x00, \
+  0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x73, 0x65, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x76, 0x61, 0x6c, 0x00, 0x00, \
+  0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, \
+  0x2d, 0x02, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x00, 0x00, 0x00, 0x00, \
+  0x0d, 0x02, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x30, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x34, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x38, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x63, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x6a, 0x75, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x00, \
+  0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x73, 0x65, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x76, 0x61, 0x6c, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf2, 0x76, 0x35, 0xdd, \
+  0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0xf1, 0xde, 0x85, 0x2d, 0x85, \
+  0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, \
+  0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, \
+  0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4\
+}
+#define TYPE_MAP_CDR_SZ_Struct256 2440u
+const dds_topic_descriptor_t Struct256_desc =
+{
+  .m_size = sizeof (Struct256),
+  .m_align = dds_alignof (Struct256),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "Struct256",
+  .m_keys = Struct256_keys,
+  .m_nops = 40,
+  .m_ops = Struct256_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Struct256, .sz = TYPE_INFO_CDR_SZ_Struct256 },
+  .type_mapping = { .data = TYPE_MAP_CDR_Struct256, .sz = TYPE_MAP_CDR_SZ_Struct256 }
+};
+
+static const uint32_t Struct4k_ops [] =
+{
+  /* Struct4k */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2560), (3u << 16u) + 55u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2561), (3u << 16u) + 52u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2562), (3u << 16u) + 49u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2563), (3u << 16u) + 46u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2564), (3u << 16u) + 43u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2565), (3u << 16u) + 40u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2566), (3u << 16u) + 37u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2567), (3u << 16u) + 34u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2568), (3u << 16u) + 31u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2569), (3u << 16u) + 28u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct256a), (3u << 16u) + 25u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct256b), (3u << 16u) + 22u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct256c), (3u << 16u) + 19u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct256d), (3u << 16u) + 16u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct256e), (3u << 16u) + 13u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct256f), (3u << 16u) + 10u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (Struct4k, junk),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (Struct4k, seq),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (Struct4k, keyval),
+  DDS_OP_RTS,
+
+  /* Struct256 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct160), (3u << 16u) + 55u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct161), (3u << 16u) + 52u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct162), (3u << 16u) + 49u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct163), (3u << 16u) + 46u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct164), (3u << 16u) + 43u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct165), (3u << 16u) + 40u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct166), (3u << 16u) + 37u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct167), (3u << 16u) + 34u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct168), (3u << 16u) + 31u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct169), (3u << 16u) + 28u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16a), (3u << 16u) + 25u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16b), (3u << 16u) + 22u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16c), (3u << 16u) + 19u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16d), (3u << 16u) + 16u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16e), (3u << 16u) + 13u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16f), (3u << 16u) + 10u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (Struct256, junk),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (Struct256, seq),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (Struct256, keyval),
+  DDS_OP_RTS,
+
+  /* Struct16 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct0),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct1),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct2),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct3),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct4),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct5),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct6),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct7),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct8),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct9),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structa),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structb),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structc),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structd),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structe),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structf),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (Struct16, junk),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (Struct16, seq),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (Struct16, keyval),
+  DDS_OP_RTS,
+  
+  /* key: keyval */
+  DDS_OP_KOF | 1, 52u /* order: 18 */
+};
+
+static const dds_key_descriptor_t Struct4k_keys[1] =
+{
+  { "keyval", 149, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 6b0d1e810e4e53ea231b6ef3222c] (#deps: 2)
+   - [MINIMAL de852d85fd42386c30d1b0ea9d9c]
+   - [MINIMAL 54e98945d81c91e9e5c8a0db70b4]
+  [COMPLETE 79c5f09469c2eae1d9daecf47423] (#deps: 2)
+   - [COMPLETE 7635dd61178d003b02a8ce07d33b]
+   - [COMPLETE 8e1101a3870be07c68be641c4bd9]
+*/
+#define TYPE_INFO_CDR_Struct4k (unsigned char []){ \
+  0xc0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x6b, 0x0d, 0x1e, 0x81, 0x0e, 0x4e, 0x53, 0xea, 0x23, 0x1b, 0x6e, \
+  0xf3, 0x22, 0x2c, 0x00, 0x47, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, \
+  0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0x00, 0x47, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x00, \
+  0x47, 0x01, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, 0x58, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf2, 0x79, 0xc5, 0xf0, 0x94, 0x69, 0xc2, 0xea, 0xe1, 0xd9, 0xda, 0xec, \
+  0xf4, 0x74, 0x23, 0x00, 0x71, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, \
+  0x02, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, \
+  0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x31, 0x03, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, \
+  0x31, 0x02, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Struct4k 196u
+#define TYPE_MAP_CDR_Struct4k (unsigned char []){ \
+  0x0b, 0x06, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf1, 0x6b, 0x0d, 0x1e, 0x81, 0x0e, 0x4e, 0x53, \
+  0xea, 0x23, 0x1b, 0x6e, 0xf3, 0x22, 0x2c, 0x00, 0x43, 0x02, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x02, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, \
+  0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0xc4, 0x1e, 0x19, 0x9a, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, \
+  0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0x3d, 0x09, 0x5c, 0x22, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, \
+  0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0x66, 0xf0, 0x4d, 0x37, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, \
+  0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0x63, 0xb1, 0x8d, 0x4f, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, \
+  0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0x1b, 0x24, 0x60, 0x21, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, \
+  0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0xc7, 0x4d, 0x89, 0x5c, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, \
+  0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0x7f, 0x29, 0xd2, 0x89, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, \
+  0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0xb1, 0x67, 0x21, 0xec, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, \
+  0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0x86, 0xa0, 0xd2, 0x1b, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, \
+  0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0xd7, 0xcb, 0x0c, 0x74, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, \
+  0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0x58, 0x5a, 0x1b, 0xef, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, \
+  0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0x9d, 0x54, 0x6a, 0x62, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, \
+  0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0x94, 0x97, 0x7d, 0xb4, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, \
+  0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0x64, 0x5d, 0xe3, 0xfe, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, \
+  0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0x07, 0xb4, 0x00, 0x1b, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, \
+  0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0x17, 0xa5, 0x7f, 0xab, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x0c, 0x82, 0x1f, 0x67, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xe0, 0x68, 0xc2, 0xde, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x46, 0x2e, 0x6d, 0xa1, 0xf1, \
+  0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0x00, 0x00, \
+  0x43, 0x02, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x33, 0x02, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, \
+  0xb4, 0xc7, 0x67, 0x18, 0xc4, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, \
+  0xb4, 0x9c, 0x94, 0x22, 0x60, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, \
+  0xb4, 0xa2, 0xe4, 0x9e, 0x0d, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, \
+  0xb4, 0x7e, 0x2f, 0x3c, 0x8f, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, \
+  0xb4, 0xb1, 0xc2, 0xc8, 0xa0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, \
+  0xb4, 0x3f, 0x5e, 0x65, 0xa4, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, \
+  0xb4, 0x2e, 0xdd, 0xa3, 0xc8, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, \
+  0xb4, 0x1b, 0x95, 0x11, 0x64, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, \
+  0xb4, 0x62, 0xf3, 0xb4, 0xe5, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, \
+  0xb4, 0xf1, 0x61, 0xec, 0xe0, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, \
+  0xb4, 0x4d, 0x9a, 0xb1, 0xaf, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, \
+  0xb4, 0xac, 0x1f, 0xb2, 0xe6, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, \
+  0xb4, 0xe6, 0x3f, 0x3b, 0x0e, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, \
+  0xb4, 0xdd, 0x3a, 0x57, 0xfe, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, \
+  0xb4, 0x64, 0x7d, 0xd6, 0x62, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, \
+  0xb4, 0x77, 0x7a, 0x44, 0xef, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x05, 0x0c, 0x82, 0x1f, 0x67, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x07, 0xe0, 0x68, 0xc2, 0xde, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x07, 0x46, 0x2e, 0x6d, 0xa1, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, \
+  0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x00, 0x00, 0x43, 0x01, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xa8, 0x89, 0x52, 0x2d, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xb7, 0x8b, 0x0f, 0x01, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x96, 0xe7, 0x0c, 0xe1, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x23, 0xf3, 0xb2, 0x1f, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xc0, 0xf2, 0x65, 0x1f, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xf1, 0x69, 0x11, 0x8b, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x37, 0x75, 0xe2, 0x76, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xdb, 0xc3, 0x99, 0x9c, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x43, 0xc7, 0x17, 0x20, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xb1, 0x41, 0xce, 0x96, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x8a, 0xd2, 0xcc, 0xb1, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xd2, 0x35, 0xa8, 0x42, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0xa2, 0x1c, 0x56, 0x13, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x98, 0x67, 0x5e, 0xe2, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x30, 0x84, 0x4f, 0xfe, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x19, 0x49, 0x9e, 0xa8, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x0c, 0x82, 0x1f, 0x67, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xe0, 0x68, 0xc2, 0xde, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x46, 0x2e, 0x6d, 0xa1, 0x00, \
+  0x05, 0x09, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf2, 0x79, 0xc5, 0xf0, 0x94, 0x69, 0xc2, 0xea, \
+  0xe1, 0xd9, 0xda, 0xec, 0xf4, 0x74, 0x23, 0x00, 0x6d, 0x03, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x53, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x34, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, \
+  0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, \
+  0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, \
+  0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, \
+  0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, \
+  0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, \
+  0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, \
+  0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, \
+  0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, \
+  0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, \
+  0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, \
+  0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, \
+  0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, \
+  0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, \
+  0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, \
+  0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x29, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, \
+  0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x6a, 0x75, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x6b, 0x65, 0x79, 0x76, 0x61, 0x6c, 0x00, 0x00, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, \
+  0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x2d, 0x03, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x53, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x32, 0x35, 0x36, 0x00, 0x00, 0x00, 0x0d, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, \
+  0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x30, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, \
+  0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x31, 0x36, 0x31, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, \
+  0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, \
+  0x32, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, \
+  0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x33, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, \
+  0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x34, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, \
+  0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x31, 0x36, 0x35, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, \
+  0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, \
+  0x36, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, \
+  0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x37, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, \
+  0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x38, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, \
+  0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x31, 0x36, 0x39, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, \
+  0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, \
+  0x61, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, \
+  0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x62, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, \
+  0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x63, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, \
+  0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x31, 0x36, 0x64, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, \
+  0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, \
+  0x65, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, \
+  0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x66, 0x00, 0x00, 0x00, \
+  0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x6a, 0x75, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x6b, 0x65, 0x79, 0x76, 0x61, 0x6c, 0x00, 0x00, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, \
+  0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x2d, 0x02, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, \
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x53, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x31, 0x36, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x36, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x61, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x65, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x6a, 0x75, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x73, 0x65, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x15, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x6b, 0x65, 0x79, 0x76, 0x61, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0xf2, 0x79, 0xc5, 0xf0, 0x94, 0x69, 0xc2, 0xea, 0xe1, 0xd9, 0xda, 0xec, \
+  0xf4, 0x74, 0x23, 0xf1, 0x6b, 0x0d, 0x1e, 0x81, 0x0e, 0x4e, 0x53, 0xea, 0x23, 0x1b, 0x6e, 0xf3, \
+  0x22, 0x2c, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, \
+  0x3b, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, \
+  0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0xf1, \
+  0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4\
+}
+#define TYPE_MAP_CDR_SZ_Struct4k 3966u
+const dds_topic_descriptor_t Struct4k_desc =
+{
+  .m_size = sizeof (Struct4k),
+  .m_align = dds_alignof (Struct4k),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "Struct4k",
+  .m_keys = Struct4k_keys,
+  .m_nops = 60,
+  .m_ops = Struct4k_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Struct4k, .sz = TYPE_INFO_CDR_SZ_Struct4k },
+  .type_mapping = { .data = TYPE_MAP_CDR_Struct4k, .sz = TYPE_MAP_CDR_SZ_Struct4k }
+};
+
+static const uint32_t Struct32k_ops [] =
+{
+  /* Struct32k */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct32k, struct4k0), (3u << 16u) + 31u /* Struct4k */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct32k, struct4k1), (3u << 16u) + 28u /* Struct4k */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct32k, struct4k2), (3u << 16u) + 25u /* Struct4k */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct32k, struct4k3), (3u << 16u) + 22u /* Struct4k */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct32k, struct4k4), (3u << 16u) + 19u /* Struct4k */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct32k, struct4k5), (3u << 16u) + 16u /* Struct4k */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct32k, struct4k6), (3u << 16u) + 13u /* Struct4k */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct32k, struct4k7), (3u << 16u) + 10u /* Struct4k */,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (Struct32k, junk),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (Struct32k, seq),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (Struct32k, keyval),
+  DDS_OP_RTS,
+
+  /* Struct4k */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2560), (3u << 16u) + 55u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2561), (3u << 16u) + 52u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2562), (3u << 16u) + 49u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2563), (3u << 16u) + 46u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2564), (3u << 16u) + 43u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2565), (3u << 16u) + 40u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2566), (3u << 16u) + 37u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2567), (3u << 16u) + 34u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2568), (3u << 16u) + 31u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct2569), (3u << 16u) + 28u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct256a), (3u << 16u) + 25u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct256b), (3u << 16u) + 22u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct256c), (3u << 16u) + 19u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct256d), (3u << 16u) + 16u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct256e), (3u << 16u) + 13u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct4k, struct256f), (3u << 16u) + 10u /* Struct256 */,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (Struct4k, junk),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (Struct4k, seq),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (Struct4k, keyval),
+  DDS_OP_RTS,
+
+  /* Struct256 */
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct160), (3u << 16u) + 55u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct161), (3u << 16u) + 52u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct162), (3u << 16u) + 49u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct163), (3u << 16u) + 46u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct164), (3u << 16u) + 43u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct165), (3u << 16u) + 40u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct166), (3u << 16u) + 37u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct167), (3u << 16u) + 34u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct168), (3u << 16u) + 31u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct169), (3u << 16u) + 28u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16a), (3u << 16u) + 25u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16b), (3u << 16u) + 22u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16c), (3u << 16u) + 19u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16d), (3u << 16u) + 16u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16e), (3u << 16u) + 13u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_EXT, offsetof (Struct256, struct16f), (3u << 16u) + 10u /* Struct16 */,
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (Struct256, junk),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (Struct256, seq),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (Struct256, keyval),
+  DDS_OP_RTS,
+
+  /* Struct16 */
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct0),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct1),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct2),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct3),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct4),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct5),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct6),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct7),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct8),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, struct9),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structa),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structb),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structc),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structd),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structe),
+  DDS_OP_ADR | DDS_OP_TYPE_1BY, offsetof (Struct16, structf),
+  DDS_OP_ADR | DDS_OP_TYPE_8BY | DDS_OP_FLAG_SGN, offsetof (Struct16, junk),
+  DDS_OP_ADR | DDS_OP_TYPE_4BY, offsetof (Struct16, seq),
+  DDS_OP_ADR | DDS_OP_FLAG_KEY | DDS_OP_FLAG_MU | DDS_OP_TYPE_4BY, offsetof (Struct16, keyval),
+  DDS_OP_RTS,
+  
+  /* key: keyval */
+  DDS_OP_KOF | 1, 28u /* order: 10 */
+};
+
+static const dds_key_descriptor_t Struct32k_keys[1] =
+{
+  { "keyval", 180, 0 }
+};
+
+/* Type Information:
+  [MINIMAL 16988dc76747dc0c1c5471c2e5dd] (#deps: 3)
+   - [MINIMAL 6b0d1e810e4e53ea231b6ef3222c]
+   - [MINIMAL de852d85fd42386c30d1b0ea9d9c]
+   - [MINIMAL 54e98945d81c91e9e5c8a0db70b4]
+  [COMPLETE bc47b19fe0bdbcfd8b55a5caaccc] (#deps: 3)
+   - [COMPLETE 79c5f09469c2eae1d9daecf47423]
+   - [COMPLETE 7635dd61178d003b02a8ce07d33b]
+   - [COMPLETE 8e1101a3870be07c68be641c4bd9]
+*/
+#define TYPE_INFO_CDR_Struct32k (unsigned char []){ \
+  0xf0, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x40, 0x70, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, \
+  0x14, 0x00, 0x00, 0x00, 0xf1, 0x16, 0x98, 0x8d, 0xc7, 0x67, 0x47, 0xdc, 0x0c, 0x1c, 0x54, 0x71, \
+  0xc2, 0xe5, 0xdd, 0x00, 0x47, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x6b, 0x0d, 0x1e, 0x81, 0x0e, 0x4e, 0x53, \
+  0xea, 0x23, 0x1b, 0x6e, 0xf3, 0x22, 0x2c, 0x00, 0x47, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0x00, \
+  0x47, 0x02, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, \
+  0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x00, 0x47, 0x01, 0x00, 0x00, 0x02, 0x10, 0x00, 0x40, \
+  0x70, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0xbc, 0x47, 0xb1, \
+  0x9f, 0xe0, 0xbd, 0xbc, 0xfd, 0x8b, 0x55, 0xa5, 0xca, 0xac, 0xcc, 0x00, 0xd1, 0x01, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x79, 0xc5, 0xf0, 0x94, 0x69, 0xc2, 0xea, 0xe1, 0xd9, 0xda, 0xec, 0xf4, 0x74, 0x23, 0x00, \
+  0x71, 0x03, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, \
+  0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0x00, 0x31, 0x03, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, \
+  0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, \
+  0x31, 0x02, 0x00, 0x00\
+}
+#define TYPE_INFO_CDR_SZ_Struct32k 244u
+#define TYPE_MAP_CDR_Struct32k (unsigned char []){ \
+  0x63, 0x07, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf1, 0x16, 0x98, 0x8d, 0xc7, 0x67, 0x47, 0xdc, \
+  0x0c, 0x1c, 0x54, 0x71, 0xc2, 0xe5, 0xdd, 0x00, 0x43, 0x01, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x6b, 0x0d, 0x1e, 0x81, 0x0e, \
+  0x4e, 0x53, 0xea, 0x23, 0x1b, 0x6e, 0xf3, 0x22, 0x2c, 0xd2, 0x86, 0x06, 0x41, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x6b, 0x0d, 0x1e, 0x81, 0x0e, \
+  0x4e, 0x53, 0xea, 0x23, 0x1b, 0x6e, 0xf3, 0x22, 0x2c, 0x89, 0xa7, 0xca, 0x57, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x6b, 0x0d, 0x1e, 0x81, 0x0e, \
+  0x4e, 0x53, 0xea, 0x23, 0x1b, 0x6e, 0xf3, 0x22, 0x2c, 0xc9, 0x19, 0x8c, 0xf5, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x6b, 0x0d, 0x1e, 0x81, 0x0e, \
+  0x4e, 0x53, 0xea, 0x23, 0x1b, 0x6e, 0xf3, 0x22, 0x2c, 0x64, 0x00, 0xa7, 0x9c, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x6b, 0x0d, 0x1e, 0x81, 0x0e, \
+  0x4e, 0x53, 0xea, 0x23, 0x1b, 0x6e, 0xf3, 0x22, 0x2c, 0x7e, 0x18, 0x75, 0x5c, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x6b, 0x0d, 0x1e, 0x81, 0x0e, \
+  0x4e, 0x53, 0xea, 0x23, 0x1b, 0x6e, 0xf3, 0x22, 0x2c, 0x90, 0xb9, 0x08, 0x0e, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x6b, 0x0d, 0x1e, 0x81, 0x0e, \
+  0x4e, 0x53, 0xea, 0x23, 0x1b, 0x6e, 0xf3, 0x22, 0x2c, 0x1b, 0xb3, 0xbe, 0xc2, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x6b, 0x0d, 0x1e, 0x81, 0x0e, \
+  0x4e, 0x53, 0xea, 0x23, 0x1b, 0x6e, 0xf3, 0x22, 0x2c, 0xd5, 0x1e, 0x18, 0xa7, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x0c, 0x82, 0x1f, 0x67, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xe0, 0x68, 0xc2, 0xde, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x46, 0x2e, 0x6d, 0xa1, 0xf1, \
+  0x6b, 0x0d, 0x1e, 0x81, 0x0e, 0x4e, 0x53, 0xea, 0x23, 0x1b, 0x6e, 0xf3, 0x22, 0x2c, 0x00, 0x00, \
+  0x43, 0x02, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x33, 0x02, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, \
+  0x9c, 0xc4, 0x1e, 0x19, 0x9a, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, \
+  0x9c, 0x3d, 0x09, 0x5c, 0x22, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, \
+  0x9c, 0x66, 0xf0, 0x4d, 0x37, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, \
+  0x9c, 0x63, 0xb1, 0x8d, 0x4f, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, \
+  0x9c, 0x1b, 0x24, 0x60, 0x21, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, \
+  0x9c, 0xc7, 0x4d, 0x89, 0x5c, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, \
+  0x9c, 0x7f, 0x29, 0xd2, 0x89, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, \
+  0x9c, 0xb1, 0x67, 0x21, 0xec, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, \
+  0x9c, 0x86, 0xa0, 0xd2, 0x1b, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, \
+  0x9c, 0xd7, 0xcb, 0x0c, 0x74, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, \
+  0x9c, 0x58, 0x5a, 0x1b, 0xef, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, \
+  0x9c, 0x9d, 0x54, 0x6a, 0x62, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, \
+  0x9c, 0x94, 0x97, 0x7d, 0xb4, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, \
+  0x9c, 0x64, 0x5d, 0xe3, 0xfe, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, \
+  0x9c, 0x07, 0xb4, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, 0x30, 0xd1, 0xb0, 0xea, 0x9d, \
+  0x9c, 0x17, 0xa5, 0x7f, 0xab, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x05, 0x0c, 0x82, 0x1f, 0x67, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x07, 0xe0, 0x68, 0xc2, 0xde, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x07, 0x46, 0x2e, 0x6d, 0xa1, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, \
+  0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, \
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x02, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0xc7, 0x67, 0x18, 0xc4, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x9c, 0x94, 0x22, 0x60, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0xa2, 0xe4, 0x9e, 0x0d, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x7e, 0x2f, 0x3c, 0x8f, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0xb1, 0xc2, 0xc8, 0xa0, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x3f, 0x5e, 0x65, 0xa4, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x2e, 0xdd, 0xa3, 0xc8, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x1b, 0x95, 0x11, 0x64, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x62, 0xf3, 0xb4, 0xe5, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0xf1, 0x61, 0xec, 0xe0, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x4d, 0x9a, 0xb1, 0xaf, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0xac, 0x1f, 0xb2, 0xe6, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0xe6, 0x3f, 0x3b, 0x0e, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0xdd, 0x3a, 0x57, 0xfe, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x64, 0x7d, 0xd6, 0x62, 0x00, 0x00, 0x00, \
+  0x19, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, \
+  0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x77, 0x7a, 0x44, 0xef, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x05, 0x0c, 0x82, 0x1f, 0x67, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0xe0, 0x68, 0xc2, 0xde, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, 0x31, 0x00, 0x07, 0x46, 0x2e, 0x6d, 0xa1, 0xf1, \
+  0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, 0xa0, 0xdb, 0x70, 0xb4, 0x00, 0x00, \
+  0x43, 0x01, 0x00, 0x00, 0xf1, 0x51, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x33, 0x01, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xa8, 0x89, 0x52, 0x2d, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xb7, 0x8b, 0x0f, 0x01, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x96, 0xe7, 0x0c, 0xe1, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x23, 0xf3, 0xb2, 0x1f, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xc0, 0xf2, 0x65, 0x1f, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xf1, 0x69, 0x11, 0x8b, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x37, 0x75, 0xe2, 0x76, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xdb, 0xc3, 0x99, 0x9c, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x43, 0xc7, 0x17, 0x20, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xb1, 0x41, 0xce, 0x96, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x8a, 0xd2, 0xcc, 0xb1, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xd2, 0x35, 0xa8, 0x42, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0xa2, 0x1c, 0x56, 0x13, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x98, 0x67, 0x5e, 0xe2, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x30, 0x84, 0x4f, 0xfe, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x19, 0x49, 0x9e, 0xa8, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x05, 0x0c, 0x82, 0x1f, 0x67, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x07, 0xe0, 0x68, 0xc2, 0xde, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x07, 0x46, 0x2e, 0x6d, 0xa1, 0x00, 0xe5, 0x0a, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0xf2, 0xbc, 0x47, 0xb1, 0x9f, 0xe0, 0xbd, 0xbc, 0xfd, 0x8b, 0x55, 0xa5, 0xca, 0xac, 0xcc, 0x00, \
+  0xcd, 0x01, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x33, 0x32, 0x6b, 0x00, 0x00, 0x00, \
+  0xad, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x79, 0xc5, 0xf0, 0x94, 0x69, 0xc2, 0xea, 0xe1, 0xd9, 0xda, 0xec, 0xf4, 0x74, \
+  0x23, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x34, 0x6b, \
+  0x30, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x79, \
+  0xc5, 0xf0, 0x94, 0x69, 0xc2, 0xea, 0xe1, 0xd9, 0xda, 0xec, 0xf4, 0x74, 0x23, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x34, 0x6b, 0x31, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x79, 0xc5, 0xf0, 0x94, 0x69, \
+  0xc2, 0xea, 0xe1, 0xd9, 0xda, 0xec, 0xf4, 0x74, 0x23, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x34, 0x6b, 0x32, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x79, 0xc5, 0xf0, 0x94, 0x69, 0xc2, 0xea, 0xe1, 0xd9, \
+  0xda, 0xec, 0xf4, 0x74, 0x23, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x34, 0x6b, 0x33, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x79, 0xc5, 0xf0, 0x94, 0x69, 0xc2, 0xea, 0xe1, 0xd9, 0xda, 0xec, 0xf4, 0x74, \
+  0x23, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x34, 0x6b, \
+  0x34, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x79, \
+  0xc5, 0xf0, 0x94, 0x69, 0xc2, 0xea, 0xe1, 0xd9, 0xda, 0xec, 0xf4, 0x74, 0x23, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x34, 0x6b, 0x35, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x79, 0xc5, 0xf0, 0x94, 0x69, \
+  0xc2, 0xea, 0xe1, 0xd9, 0xda, 0xec, 0xf4, 0x74, 0x23, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x34, 0x6b, 0x36, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x79, 0xc5, 0xf0, 0x94, 0x69, 0xc2, 0xea, 0xe1, 0xd9, \
+  0xda, 0xec, 0xf4, 0x74, 0x23, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x34, 0x6b, 0x37, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x6a, 0x75, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x00, \
+  0x12, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x73, 0x65, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x76, 0x61, 0x6c, 0x00, 0x00, \
+  0x00, 0xf2, 0x79, 0xc5, 0xf0, 0x94, 0x69, 0xc2, 0xea, 0xe1, 0xd9, 0xda, 0xec, 0xf4, 0x74, 0x23, \
+  0x6d, 0x03, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x34, 0x6b, 0x00, 0x00, 0x00, 0x00, \
+  0x4d, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, \
+  0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, \
+  0x36, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, \
+  0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, \
+  0x36, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, \
+  0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, \
+  0x36, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, \
+  0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, \
+  0x36, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, \
+  0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, \
+  0x36, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, \
+  0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, \
+  0x36, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, \
+  0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, \
+  0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, \
+  0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, \
+  0x36, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, \
+  0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, \
+  0x36, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, \
+  0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, \
+  0x36, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, \
+  0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, \
+  0x36, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, \
+  0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, \
+  0x36, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, \
+  0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, \
+  0x36, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, \
+  0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, \
+  0x36, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, \
+  0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, \
+  0x36, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, \
+  0x3b, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, \
+  0x36, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x6a, 0x75, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x00, \
+  0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x73, 0x65, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x76, 0x61, 0x6c, 0x00, 0x00, \
+  0x00, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, 0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, \
+  0x2d, 0x03, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x35, 0x36, 0x00, 0x00, 0x00, \
+  0x0d, 0x03, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, \
+  0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, \
+  0x30, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, \
+  0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x31, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, \
+  0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x32, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, \
+  0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x31, 0x36, 0x33, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, \
+  0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, \
+  0x34, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, \
+  0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x35, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, \
+  0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x36, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, \
+  0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x31, 0x36, 0x37, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, \
+  0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, \
+  0x38, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, \
+  0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x39, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, \
+  0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x61, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, \
+  0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x31, 0x36, 0x62, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, \
+  0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, \
+  0x63, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, \
+  0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, \
+  0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x64, 0x00, 0x00, 0x00, \
+  0x28, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, \
+  0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x65, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, \
+  0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x31, 0x36, 0x66, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x6a, 0x75, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x00, \
+  0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x73, 0x65, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x76, 0x61, 0x6c, 0x00, 0x00, \
+  0x00, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, 0xbe, 0x64, 0x1c, 0x4b, 0xd9, \
+  0x2d, 0x02, 0x00, 0x00, 0xf2, 0x51, 0x01, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x09, 0x00, 0x00, 0x00, 0x53, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x36, 0x00, 0x00, 0x00, 0x00, \
+  0x0d, 0x02, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x30, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x34, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x38, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x0b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x63, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, \
+  0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, \
+  0x16, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, \
+  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, \
+  0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x73, 0x74, 0x72, 0x75, \
+  0x63, 0x74, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, \
+  0x01, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00, 0x00, 0x6a, 0x75, 0x6e, 0x6b, 0x00, 0x00, 0x00, 0x00, \
+  0x12, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, \
+  0x73, 0x65, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x12, 0x00, 0x00, 0x00, \
+  0x31, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x6b, 0x65, 0x79, 0x76, 0x61, 0x6c, 0x00, 0x00, \
+  0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0xf2, 0xbc, 0x47, 0xb1, \
+  0x9f, 0xe0, 0xbd, 0xbc, 0xfd, 0x8b, 0x55, 0xa5, 0xca, 0xac, 0xcc, 0xf1, 0x16, 0x98, 0x8d, 0xc7, \
+  0x67, 0x47, 0xdc, 0x0c, 0x1c, 0x54, 0x71, 0xc2, 0xe5, 0xdd, 0xf2, 0x79, 0xc5, 0xf0, 0x94, 0x69, \
+  0xc2, 0xea, 0xe1, 0xd9, 0xda, 0xec, 0xf4, 0x74, 0x23, 0xf1, 0x6b, 0x0d, 0x1e, 0x81, 0x0e, 0x4e, \
+  0x53, 0xea, 0x23, 0x1b, 0x6e, 0xf3, 0x22, 0x2c, 0xf2, 0x76, 0x35, 0xdd, 0x61, 0x17, 0x8d, 0x00, \
+  0x3b, 0x02, 0xa8, 0xce, 0x07, 0xd3, 0x3b, 0xf1, 0xde, 0x85, 0x2d, 0x85, 0xfd, 0x42, 0x38, 0x6c, \
+  0x30, 0xd1, 0xb0, 0xea, 0x9d, 0x9c, 0xf2, 0x8e, 0x11, 0x01, 0xa3, 0x87, 0x0b, 0xe0, 0x7c, 0x68, \
+  0xbe, 0x64, 0x1c, 0x4b, 0xd9, 0xf1, 0x54, 0xe9, 0x89, 0x45, 0xd8, 0x1c, 0x91, 0xe9, 0xe5, 0xc8, \
+  0xa0, 0xdb, 0x70, 0xb4\
+}
+#define TYPE_MAP_CDR_SZ_Struct32k 4820u
+const dds_topic_descriptor_t Struct32k_desc =
+{
+  .m_size = sizeof (Struct32k),
+  .m_align = dds_alignof (Struct32k),
+  .m_flagset = DDS_TOPIC_FIXED_KEY | DDS_TOPIC_FIXED_KEY_XCDR2 | DDS_TOPIC_FIXED_SIZE | DDS_TOPIC_XTYPES_METADATA,
+  .m_nkeys = 1u,
+  .m_typename = "Struct32k",
+  .m_keys = Struct32k_keys,
+  .m_nops = 72,
+  .m_ops = Struct32k_ops,
+  .m_meta = "",
+  .type_information = { .data = TYPE_INFO_CDR_Struct32k, .sz = TYPE_INFO_CDR_SZ_Struct32k },
+  .type_mapping = { .data = TYPE_MAP_CDR_Struct32k, .sz = TYPE_MAP_CDR_SZ_Struct32k }
+};
+
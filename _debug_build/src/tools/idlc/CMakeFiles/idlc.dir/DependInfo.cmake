@@ -0,0 +1,30 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tools/idlc/src/descriptor.c" "src/tools/idlc/CMakeFiles/idlc.dir/src/descriptor.c.o" "gcc" "src/tools/idlc/CMakeFiles/idlc.dir/src/descriptor.c.o.d"
+  "/root/repo/src/tools/idlc/src/descriptor_serializers.c" "src/tools/idlc/CMakeFiles/idlc.dir/src/descriptor_serializers.c.o" "gcc" "src/tools/idlc/CMakeFiles/idlc.dir/src/descriptor_serializers.c.o.d"
+  "/root/repo/src/tools/idlc/src/descriptor_type_meta.c" "src/tools/idlc/CMakeFiles/idlc.dir/src/descriptor_type_meta.c.o" "gcc" "src/tools/idlc/CMakeFiles/idlc.dir/src/descriptor_type_meta.c.o.d"
+  "/root/repo/src/tools/idlc/src/generator.c" "src/tools/idlc/CMakeFiles/idlc.dir/src/generator.c.o" "gcc" "src/tools/idlc/CMakeFiles/idlc.dir/src/generator.c.o.d"
+  "/root/repo/src/tools/idlc/src/idlc.c" "src/tools/idlc/CMakeFiles/idlc.dir/src/idlc.c.o" "gcc" "src/tools/idlc/CMakeFiles/idlc.dir/src/idlc.c.o.d"
+  "/root/repo/src/tools/idlc/src/options.c" "src/tools/idlc/CMakeFiles/idlc.dir/src/options.c.o" "gcc" "src/tools/idlc/CMakeFiles/idlc.dir/src/options.c.o.d"
+  "/root/repo/src/tools/idlc/src/plugin.c" "src/tools/idlc/CMakeFiles/idlc.dir/src/plugin.c.o" "gcc" "src/tools/idlc/CMakeFiles/idlc.dir/src/plugin.c.o.d"
+  "/root/repo/src/tools/idlc/src/types.c" "src/tools/idlc/CMakeFiles/idlc.dir/src/types.c.o" "gcc" "src/tools/idlc/CMakeFiles/idlc.dir/src/types.c.o.d"
+  "/root/repo/src/tools/idlc/src/views.c" "src/tools/idlc/CMakeFiles/idlc.dir/src/views.c.o" "gcc" "src/tools/idlc/CMakeFiles/idlc.dir/src/views.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/src/idl/CMakeFiles/idl.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/tools/idlpp/CMakeFiles/idlpp.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/core/CMakeFiles/ddsc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
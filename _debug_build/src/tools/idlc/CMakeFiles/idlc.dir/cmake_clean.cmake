@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "../../../bin/idlc"
+  "../../../bin/idlc.pdb"
+  "CMakeFiles/idlc.dir/src/descriptor.c.o"
+  "CMakeFiles/idlc.dir/src/descriptor.c.o.d"
+  "CMakeFiles/idlc.dir/src/descriptor_serializers.c.o"
+  "CMakeFiles/idlc.dir/src/descriptor_serializers.c.o.d"
+  "CMakeFiles/idlc.dir/src/descriptor_type_meta.c.o"
+  "CMakeFiles/idlc.dir/src/descriptor_type_meta.c.o.d"
+  "CMakeFiles/idlc.dir/src/generator.c.o"
+  "CMakeFiles/idlc.dir/src/generator.c.o.d"
+  "CMakeFiles/idlc.dir/src/idlc.c.o"
+  "CMakeFiles/idlc.dir/src/idlc.c.o.d"
+  "CMakeFiles/idlc.dir/src/options.c.o"
+  "CMakeFiles/idlc.dir/src/options.c.o.d"
+  "CMakeFiles/idlc.dir/src/plugin.c.o"
+  "CMakeFiles/idlc.dir/src/plugin.c.o.d"
+  "CMakeFiles/idlc.dir/src/types.c.o"
+  "CMakeFiles/idlc.dir/src/types.c.o.d"
+  "CMakeFiles/idlc.dir/src/views.c.o"
+  "CMakeFiles/idlc.dir/src/views.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/idlc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1 @@
+#define HAVE_GETOPT_H 1
@@ -0,0 +1,31 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tools/idlc/src/descriptor.c" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/__/src/descriptor.c.o" "gcc" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/__/src/descriptor.c.o.d"
+  "/root/repo/src/tools/idlc/src/descriptor_serializers.c" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/__/src/descriptor_serializers.c.o" "gcc" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/__/src/descriptor_serializers.c.o.d"
+  "/root/repo/src/tools/idlc/src/descriptor_type_meta.c" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/__/src/descriptor_type_meta.c.o" "gcc" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/__/src/descriptor_type_meta.c.o.d"
+  "/root/repo/src/tools/idlc/src/generator.c" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/__/src/generator.c.o" "gcc" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/__/src/generator.c.o.d"
+  "/root/repo/src/tools/idlc/src/plugin.c" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/__/src/plugin.c.o" "gcc" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/__/src/plugin.c.o.d"
+  "/root/repo/src/tools/idlc/src/types.c" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/__/src/types.c.o" "gcc" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/__/src/types.c.o.d"
+  "/root/repo/src/tools/idlc/src/views.c" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/__/src/views.c.o" "gcc" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/__/src/views.c.o.d"
+  "/root/repo/_debug_build/src/tools/idlc/tests/cunit_idlc.c" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/cunit_idlc.c.o" "gcc" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/cunit_idlc.c.o.d"
+  "/root/repo/src/tools/idlc/tests/descriptor.c" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/descriptor.c.o" "gcc" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/descriptor.c.o.d"
+  "/root/repo/src/tools/idlc/tests/test_common.c" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/test_common.c.o" "gcc" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/test_common.c.o.d"
+  "/root/repo/src/tools/idlc/tests/type_meta.c" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/type_meta.c.o" "gcc" "src/tools/idlc/tests/CMakeFiles/cunit_idlc.dir/type_meta.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_debug_build/src/idl/CMakeFiles/idl.dir/DependInfo.cmake"
+  "/root/repo/_debug_build/src/core/CMakeFiles/ddsc.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,31 @@
+file(REMOVE_RECURSE
+  "../../../../bin/cunit_idlc"
+  "../../../../bin/cunit_idlc.pdb"
+  "CMakeFiles/cunit_idlc.dir/__/src/descriptor.c.o"
+  "CMakeFiles/cunit_idlc.dir/__/src/descriptor.c.o.d"
+  "CMakeFiles/cunit_idlc.dir/__/src/descriptor_serializers.c.o"
+  "CMakeFiles/cunit_idlc.dir/__/src/descriptor_serializers.c.o.d"
+  "CMakeFiles/cunit_idlc.dir/__/src/descriptor_type_meta.c.o"
+  "CMakeFiles/cunit_idlc.dir/__/src/descriptor_type_meta.c.o.d"
+  "CMakeFiles/cunit_idlc.dir/__/src/generator.c.o"
+  "CMakeFiles/cunit_idlc.dir/__/src/generator.c.o.d"
+  "CMakeFiles/cunit_idlc.dir/__/src/plugin.c.o"
+  "CMakeFiles/cunit_idlc.dir/__/src/plugin.c.o.d"
+  "CMakeFiles/cunit_idlc.dir/__/src/types.c.o"
+  "CMakeFiles/cunit_idlc.dir/__/src/types.c.o.d"
+  "CMakeFiles/cunit_idlc.dir/__/src/views.c.o"
+  "CMakeFiles/cunit_idlc.dir/__/src/views.c.o.d"
+  "CMakeFiles/cunit_idlc.dir/cunit_idlc.c.o"
+  "CMakeFiles/cunit_idlc.dir/cunit_idlc.c.o.d"
+  "CMakeFiles/cunit_idlc.dir/descriptor.c.o"
+  "CMakeFiles/cunit_idlc.dir/descriptor.c.o.d"
+  "CMakeFiles/cunit_idlc.dir/test_common.c.o"
+  "CMakeFiles/cunit_idlc.dir/test_common.c.o.d"
+  "CMakeFiles/cunit_idlc.dir/type_meta.c.o"
+  "CMakeFiles/cunit_idlc.dir/type_meta.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cunit_idlc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/src/tools/idlc/tests
+# Build directory: /root/repo/_debug_build/src/tools/idlc/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(CUnit_idlc_descriptor_keys_nested "/root/repo/_debug_build/bin/cunit_idlc" "-s" "idlc_descriptor" "-t" "keys_nested")
+set_tests_properties(CUnit_idlc_descriptor_keys_nested PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/tools/idlc/tests/CMakeLists.txt;30;add_cunit_executable;/root/repo/src/tools/idlc/tests/CMakeLists.txt;0;")
+add_test(CUnit_idlc_descriptor_default_extensibility "/root/repo/_debug_build/bin/cunit_idlc" "-s" "idlc_descriptor" "-t" "default_extensibility")
+set_tests_properties(CUnit_idlc_descriptor_default_extensibility PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/tools/idlc/tests/CMakeLists.txt;30;add_cunit_executable;/root/repo/src/tools/idlc/tests/CMakeLists.txt;0;")
+add_test(CUnit_idlc_descriptor_key_size "/root/repo/_debug_build/bin/cunit_idlc" "-s" "idlc_descriptor" "-t" "key_size")
+set_tests_properties(CUnit_idlc_descriptor_key_size PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/tools/idlc/tests/CMakeLists.txt;30;add_cunit_executable;/root/repo/src/tools/idlc/tests/CMakeLists.txt;0;")
+add_test(CUnit_idlc_descriptor_key_valid_types "/root/repo/_debug_build/bin/cunit_idlc" "-s" "idlc_descriptor" "-t" "key_valid_types")
+set_tests_properties(CUnit_idlc_descriptor_key_valid_types PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/tools/idlc/tests/CMakeLists.txt;30;add_cunit_executable;/root/repo/src/tools/idlc/tests/CMakeLists.txt;0;")
+add_test(CUnit_idlc_descriptor_keys_inheritance "/root/repo/_debug_build/bin/cunit_idlc" "-s" "idlc_descriptor" "-t" "keys_inheritance")
+set_tests_properties(CUnit_idlc_descriptor_keys_inheritance PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/tools/idlc/tests/CMakeLists.txt;30;add_cunit_executable;/root/repo/src/tools/idlc/tests/CMakeLists.txt;0;")
+add_test(CUnit_idlc_type_meta_union_max_label_value "/root/repo/_debug_build/bin/cunit_idlc" "-s" "idlc_type_meta" "-t" "union_max_label_value")
+set_tests_properties(CUnit_idlc_type_meta_union_max_label_value PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/tools/idlc/tests/CMakeLists.txt;30;add_cunit_executable;/root/repo/src/tools/idlc/tests/CMakeLists.txt;0;")
+add_test(CUnit_idlc_type_meta_type_obj_serdes "/root/repo/_debug_build/bin/cunit_idlc" "-s" "idlc_type_meta" "-t" "type_obj_serdes")
+set_tests_properties(CUnit_idlc_type_meta_type_obj_serdes PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/tools/idlc/tests/CMakeLists.txt;30;add_cunit_executable;/root/repo/src/tools/idlc/tests/CMakeLists.txt;0;")
+add_test(CUnit_idlc_type_meta_type_obj_annotations "/root/repo/_debug_build/bin/cunit_idlc" "-s" "idlc_type_meta" "-t" "type_obj_annotations")
+set_tests_properties(CUnit_idlc_type_meta_type_obj_annotations PROPERTIES  DISABLED "FALSE" ENVIRONMENT "LD_LIBRARY_PATH=/root/repo/_debug_build/lib::" TIMEOUT "10" _BACKTRACE_TRIPLES "/root/repo/cmake/Modules/CUnit.cmake;301;add_test;/root/repo/src/tools/idlc/tests/CMakeLists.txt;30;add_cunit_executable;/root/repo/src/tools/idlc/tests/CMakeLists.txt;0;")
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/tools/idlpp/src/directive.c" "src/tools/idlpp/CMakeFiles/idlpp.dir/src/directive.c.o" "gcc" "src/tools/idlpp/CMakeFiles/idlpp.dir/src/directive.c.o.d"
+  "/root/repo/src/tools/idlpp/src/eval.c" "src/tools/idlpp/CMakeFiles/idlpp.dir/src/eval.c.o" "gcc" "src/tools/idlpp/CMakeFiles/idlpp.dir/src/eval.c.o.d"
+  "/root/repo/src/tools/idlpp/src/expand.c" "src/tools/idlpp/CMakeFiles/idlpp.dir/src/expand.c.o" "gcc" "src/tools/idlpp/CMakeFiles/idlpp.dir/src/expand.c.o.d"
+  "/root/repo/src/tools/idlpp/src/main.c" "src/tools/idlpp/CMakeFiles/idlpp.dir/src/main.c.o" "gcc" "src/tools/idlpp/CMakeFiles/idlpp.dir/src/main.c.o.d"
+  "/root/repo/src/tools/idlpp/src/mbchar.c" "src/tools/idlpp/CMakeFiles/idlpp.dir/src/mbchar.c.o" "gcc" "src/tools/idlpp/CMakeFiles/idlpp.dir/src/mbchar.c.o.d"
+  "/root/repo/src/tools/idlpp/src/support.c" "src/tools/idlpp/CMakeFiles/idlpp.dir/src/support.c.o" "gcc" "src/tools/idlpp/CMakeFiles/idlpp.dir/src/support.c.o.d"
+  "/root/repo/src/tools/idlpp/src/system.c" "src/tools/idlpp/CMakeFiles/idlpp.dir/src/system.c.o" "gcc" "src/tools/idlpp/CMakeFiles/idlpp.dir/src/system.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
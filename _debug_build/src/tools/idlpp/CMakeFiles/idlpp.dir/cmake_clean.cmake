@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "../../../lib/libidlpp.a"
+  "../../../lib/libidlpp.pdb"
+  "CMakeFiles/idlpp.dir/src/directive.c.o"
+  "CMakeFiles/idlpp.dir/src/directive.c.o.d"
+  "CMakeFiles/idlpp.dir/src/eval.c.o"
+  "CMakeFiles/idlpp.dir/src/eval.c.o.d"
+  "CMakeFiles/idlpp.dir/src/expand.c.o"
+  "CMakeFiles/idlpp.dir/src/expand.c.o.d"
+  "CMakeFiles/idlpp.dir/src/main.c.o"
+  "CMakeFiles/idlpp.dir/src/main.c.o.d"
+  "CMakeFiles/idlpp.dir/src/mbchar.c.o"
+  "CMakeFiles/idlpp.dir/src/mbchar.c.o.d"
+  "CMakeFiles/idlpp.dir/src/support.c.o"
+  "CMakeFiles/idlpp.dir/src/support.c.o.d"
+  "CMakeFiles/idlpp.dir/src/system.c.o"
+  "CMakeFiles/idlpp.dir/src/system.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/idlpp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -54,11 +54,21 @@ enum dds_cdr_type_extensibility
   DDS_CDR_TYPE_EXT_MUTABLE = 2
 };
 
+/* Allocator for the memory referenced by a sample that is deserialized from an
+   istream.  The deserializer never resizes or frees memory obtained from it, so
+   it may only be used when reading into a zero-initialized sample, and sequences
+   read using it have their _release flag cleared. */
+struct dds_cdrstream_allocator {
+  void * (*malloc) (void *arg, size_t size); /* must not return a null pointer */
+  void *arg;
+};
+
 typedef struct dds_istream {
   const unsigned char *m_buffer;
   uint32_t m_size;          /* Buffer size */
   uint32_t m_index;         /* Read/write offset from start of buffer */
   uint32_t m_xcdr_version;  /* XCDR version of the data */
+  const struct dds_cdrstream_allocator *m_allocator; /* Allocator for sample contents, null: heap */
 } dds_istream_t;
 
 typedef struct dds_ostream {
@@ -91,6 +101,32 @@ typedef struct dds_cdrstream_desc_op_seq {
   uint32_t *ops;    /* Marshalling meta data */
 } dds_cdrstream_desc_op_seq_t;
 
+/**
+ * @brief Step in a copy plan
+ *
+ * A step is either a run of primitive members and primitive arrays that are contiguous
+ * in memory and in CDR (num > 0), or a single member that is handled by the serializer
+ * instructions at ops_offs (num = 0).
+ */
+struct dds_cdrstream_copy_step {
+  uint32_t ops_offs;  /* Offset of the ADR instruction in the ops (num = 0) */
+  uint32_t data_offs; /* Offset of the run (num > 0) or of the struct containing the member (num = 0) */
+  uint32_t num;       /* Number of elements in the run */
+  enum dds_stream_typecode type; /* Element type of the run: 1BY, 2BY, 4BY or 8BY */
+};
+
+/**
+ * @brief Copy plan for a type
+ *
+ * Flattened list of steps for writing, reading and normalizing a final type, that
+ * is used instead of interpreting the serializer instructions for each member. The
+ * plan is the same for XCDR1 and XCDR2.
+ */
+struct dds_cdrstream_copy_plan {
+  uint32_t nsteps;
+  struct dds_cdrstream_copy_step *steps;
+};
+
 struct dds_cdrstream_desc {
   uint32_t size;    /* Size of type */
   uint32_t align;   /* Alignment of top-level type */
@@ -99,8 +135,24 @@ struct dds_cdrstream_desc {
   dds_cdrstream_desc_op_seq_t ops;
   size_t opt_size_xcdr1;
   size_t opt_size_xcdr2;
+  const struct dds_topic_serializers *serializers; /* Type-specific serializers, null: interpret ops */
+  struct dds_cdrstream_copy_plan *copy_plan; /* Copy plan, null: interpret ops */
+};
+
+/**
+ * @brief Reference to a member of a (nested) struct in the serializer instructions
+ *
+ * The path holds the ADR instructions of the member and of the struct-typed members
+ * that contain it, outermost first.
+ */
+struct dds_cdrstream_member_ref {
+  uint32_t depth;
+  const uint32_t *path[DDS_CDRSTREAM_MAX_NESTING_DEPTH];
 };
 
+/* Offset returned by dds_stream_locate_members for members that are not in the data */
+#define DDS_CDRSTREAM_MEMBER_ABSENT UINT32_MAX
+
 DDSRT_STATIC_ASSERT (offsetof (dds_ostreamLE_t, x) == 0);
 DDSRT_STATIC_ASSERT (offsetof (dds_ostreamBE_t, x) == 0);
 
@@ -185,6 +237,12 @@ DDS_EXPORT uint32_t dds_stream_countops (const uint32_t * __restrict ops, uint32
 /** @component cdr_serializer */
 size_t dds_stream_check_optimize (const struct dds_cdrstream_desc * __restrict desc, uint32_t xcdr_version);
 
+/** @component cdr_serializer */
+DDS_EXPORT struct dds_cdrstream_copy_plan *dds_stream_compile_copy_plan (const struct dds_cdrstream_desc * __restrict desc);
+
+/** @component cdr_serializer */
+DDS_EXPORT void dds_stream_free_copy_plan (struct dds_cdrstream_copy_plan *plan);
+
 /** @component cdr_serializer */
 void dds_stream_write_key (dds_ostream_t * __restrict os, const char * __restrict sample, const struct dds_cdrstream_desc * __restrict type);
 
@@ -215,6 +273,45 @@ DDS_EXPORT size_t dds_stream_print_key (dds_istream_t * __restrict is, const str
 /** @component cdr_serializer */
 DDS_EXPORT size_t dds_stream_print_sample (dds_istream_t * __restrict is, const struct dds_cdrstream_desc * __restrict type, char * __restrict buf, size_t size);
 
+/**
+ * @component cdr_serializer
+ * @brief Initializes a member reference from the member indices and member ids of the member path
+ *
+ * The index is the position of the member in the declaration order of the struct and is
+ * used for final and appendable types; the member id is used for mutable types. Only
+ * paths through struct-typed members (i.e., not through collections or unions) are supported.
+ *
+ * @returns false if the path can't be resolved
+ */
+DDS_EXPORT bool dds_stream_member_ref_init (struct dds_cdrstream_member_ref * __restrict ref, const uint32_t * __restrict ops, uint32_t depth, const uint32_t * __restrict index, const uint32_t * __restrict member_id);
+
+/**
+ * @component cdr_serializer
+ * @brief Computes the offset of a member in the serialized data if it doesn't depend on the data
+ *
+ * That is the case if the member and everything preceding it in the data has a fixed size,
+ * and no DHEADERs and EMHEADERs are involved.  The offset is relative to the start of the
+ * data following the encoding header.
+ *
+ * @returns true if the offset is fixed
+ */
+DDS_EXPORT bool dds_stream_member_fixed_offset (const uint32_t * __restrict ops, const struct dds_cdrstream_member_ref * __restrict ref, uint32_t xcdr_version, uint32_t * __restrict offset);
+
+/**
+ * @component cdr_serializer
+ * @brief Finds the offsets of a number of members in serialized data
+ *
+ * Walks the data, skipping everything that doesn't contain one of the referenced members,
+ * and stops as soon as all of them have been found.  The data need not be in native byte
+ * order and is checked for being well-formed only to the extent needed to stay within the
+ * buffer.  The offsets of primitive, enum, bitmask and string members point to the value
+ * (for strings: its length) in the data, offsets of absent optional members and members
+ * beyond the end of an appendable type in the data are set to DDS_CDRSTREAM_MEMBER_ABSENT.
+ *
+ * @returns false if the data is malformed
+ */
+DDS_EXPORT bool dds_stream_locate_members (dds_istream_t * __restrict is, bool bswap, const uint32_t * __restrict ops, uint32_t nrefs, const struct dds_cdrstream_member_ref * __restrict refs, uint32_t * __restrict offs);
+
 /** @component cdr_serializer */
 uint16_t dds_stream_minimum_xcdr_version (const uint32_t * __restrict ops);
 
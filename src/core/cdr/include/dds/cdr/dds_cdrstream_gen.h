@@ -0,0 +1,185 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#ifndef DDS_CDRSTREAM_GEN_H
+#define DDS_CDRSTREAM_GEN_H
+
+#include <string.h>
+#include "dds/cdr/dds_cdrstream.h"
+
+#if defined (__cplusplus)
+extern "C" {
+#endif
+
+/*
+  Support functions for the type-specific serializers that idlc generates when
+  invoked with "-f serializers".  These only deal with final types in native
+  endianness and follow the serialization rules of the interpreter in
+  dds_cdrstream.c, so that both produce identical output.  The trivial operations
+  are inline, the remainder wraps the implementation of the interpreter.
+*/
+
+/** @component cdr_serializer */
+DDS_EXPORT void dds_stream_gen_grow (dds_ostream_t * __restrict os, uint32_t size);
+
+/** @component cdr_serializer */
+DDS_EXPORT char *dds_stream_gen_read_string (dds_istream_t * __restrict is, char * __restrict str);
+
+/** @component cdr_serializer */
+DDS_EXPORT void dds_stream_gen_read_bstring (dds_istream_t * __restrict is, char * __restrict str, uint32_t size);
+
+/** @component cdr_serializer */
+DDS_EXPORT void dds_stream_gen_skip_string (dds_istream_t * __restrict is);
+
+/** @component cdr_serializer */
+DDS_EXPORT void dds_stream_gen_realloc_sequence (dds_istream_t * __restrict is, dds_sequence_t * __restrict seq, uint32_t num, uint32_t elem_size, bool init);
+
+/** @component cdr_serializer */
+DDS_EXPORT bool dds_stream_gen_normalize_uint32 (uint32_t * __restrict val, char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap) ddsrt_attribute_warn_unused_result ddsrt_nonnull_all;
+
+/** @component cdr_serializer */
+DDS_EXPORT bool dds_stream_gen_normalize_dheader (uint32_t * __restrict size1, char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap) ddsrt_attribute_warn_unused_result ddsrt_nonnull_all;
+
+/** @component cdr_serializer */
+DDS_EXPORT bool dds_stream_gen_normalize_string (char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap, size_t maxsz) ddsrt_attribute_warn_unused_result ddsrt_nonnull_all;
+
+/** @component cdr_serializer */
+DDS_EXPORT bool dds_stream_gen_normalize_primarray (char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap, uint32_t num, uint32_t elem_size, uint32_t xcdr_version) ddsrt_attribute_warn_unused_result ddsrt_nonnull_all;
+
+/** @component cdr_serializer */
+DDS_EXPORT bool dds_stream_gen_normalize_enumarray (char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap, uint32_t enum_sz, uint32_t num, uint32_t max) ddsrt_attribute_warn_unused_result ddsrt_nonnull_all;
+
+/** @component cdr_serializer */
+DDS_EXPORT bool dds_stream_gen_normalize_error (void);
+
+/* Alignment of a primitive of the given size in the stream's encoding version */
+static inline uint32_t dds_stream_gen_align (uint32_t xcdr_version, uint32_t size)
+{
+  return (size > 4) ? (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 ? 4 : 8) : size;
+}
+
+/* Pads to the alignment with zeros and makes room for another "size" bytes */
+static inline void dds_stream_gen_align_resize (dds_ostream_t * __restrict os, uint32_t align, uint32_t size)
+{
+  const uint32_t pad = (align - os->m_index % align) % align;
+  if (os->m_size < os->m_index + pad + size)
+    dds_stream_gen_grow (os, pad + size);
+  for (uint32_t i = 0; i < pad; i++)
+    os->m_buffer[os->m_index++] = 0;
+}
+
+static inline void dds_stream_gen_put_bytes (dds_ostream_t * __restrict os, const void * __restrict src, uint32_t align, uint32_t size)
+{
+  dds_stream_gen_align_resize (os, align, size);
+  memcpy (os->m_buffer + os->m_index, src, size);
+  os->m_index += size;
+}
+
+static inline void dds_stream_gen_put1 (dds_ostream_t * __restrict os, uint8_t v)
+{
+  dds_stream_gen_put_bytes (os, &v, 1, 1);
+}
+
+static inline void dds_stream_gen_put2 (dds_ostream_t * __restrict os, uint16_t v)
+{
+  dds_stream_gen_put_bytes (os, &v, 2, 2);
+}
+
+static inline void dds_stream_gen_put4 (dds_ostream_t * __restrict os, uint32_t v)
+{
+  dds_stream_gen_put_bytes (os, &v, 4, 4);
+}
+
+static inline void dds_stream_gen_put_string (dds_ostream_t * __restrict os, const char * __restrict str)
+{
+  if (str == NULL)
+    str = "";
+  const uint32_t size = (uint32_t) strlen (str) + 1;
+  dds_stream_gen_put4 (os, size);
+  dds_stream_gen_put_bytes (os, str, 1, size);
+}
+
+/* Reserves a DHEADER, returns the offset that dds_stream_gen_patch_dheader expects */
+static inline uint32_t dds_stream_gen_reserve_dheader (dds_ostream_t * __restrict os)
+{
+  dds_stream_gen_align_resize (os, 4, 4);
+  os->m_index += 4;
+  return os->m_index;
+}
+
+static inline void dds_stream_gen_patch_dheader (dds_ostream_t * __restrict os, uint32_t offs)
+{
+  const uint32_t sz = os->m_index - offs;
+  memcpy (os->m_buffer + offs - 4, &sz, 4);
+}
+
+static inline void dds_stream_gen_get_bytes (dds_istream_t * __restrict is, void * __restrict dst, uint32_t align, uint32_t size)
+{
+  is->m_index = (is->m_index + align - 1) & ~(align - 1);
+  memcpy (dst, is->m_buffer + is->m_index, size);
+  is->m_index += size;
+}
+
+static inline uint8_t dds_stream_gen_get1 (dds_istream_t * __restrict is)
+{
+  return is->m_buffer[is->m_index++];
+}
+
+static inline uint16_t dds_stream_gen_get2 (dds_istream_t * __restrict is)
+{
+  uint16_t v;
+  dds_stream_gen_get_bytes (is, &v, 2, 2);
+  return v;
+}
+
+static inline uint32_t dds_stream_gen_get4 (dds_istream_t * __restrict is)
+{
+  uint32_t v;
+  dds_stream_gen_get_bytes (is, &v, 4, 4);
+  return v;
+}
+
+static inline void dds_stream_gen_skip (dds_istream_t * __restrict is, uint32_t align, uint32_t size)
+{
+  is->m_index = ((is->m_index + align - 1) & ~(align - 1)) + size;
+}
+
+/* Validates a primitive and swaps it to native endianness if needed */
+static inline bool dds_stream_gen_normalize_prim (char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap, uint32_t elem_size, uint32_t xcdr_version)
+{
+  const uint32_t align = dds_stream_gen_align (xcdr_version, elem_size);
+  const uint32_t off1 = (*off + align - 1) & ~(align - 1);
+  if (size < off1 || size - off1 < elem_size)
+    return dds_stream_gen_normalize_error ();
+  *off = off1;
+  if (bswap)
+  {
+    switch (elem_size)
+    {
+      case 2: *((uint16_t *) (data + off1)) = ddsrt_bswap2u (*((uint16_t *) (data + off1))); break;
+      case 4: *((uint32_t *) (data + off1)) = ddsrt_bswap4u (*((uint32_t *) (data + off1))); break;
+      case 8: {
+        uint32_t x = ddsrt_bswap4u (* (uint32_t *) (data + off1));
+        *((uint32_t *) (data + off1)) = ddsrt_bswap4u (* ((uint32_t *) (data + off1) + 1));
+        *((uint32_t *) (data + off1) + 1) = x;
+        break;
+      }
+      default: break;
+    }
+  }
+  *off += elem_size;
+  return true;
+}
+
+#if defined (__cplusplus)
+}
+#endif
+#endif /* DDS_CDRSTREAM_GEN_H */
@@ -0,0 +1,62 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#ifndef DDS__CDRSTREAM_SIMD_H
+#define DDS__CDRSTREAM_SIMD_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined (__cplusplus)
+extern "C" {
+#endif
+
+/* Arrays smaller than this (in bytes) are not worth the indirect call */
+#define DDS_STREAM_SIMD_MIN_BYTES 64
+
+enum dds_stream_simd_level {
+  DDS_STREAM_SIMD_SCALAR,
+  DDS_STREAM_SIMD_SSE2,
+  DDS_STREAM_SIMD_AVX2,
+  DDS_STREAM_SIMD_NEON
+};
+
+/* Kernels for bulk processing of arrays of primitives in CDR. The data need
+   not be aligned to the element size, because 8-byte values are only 4-byte
+   aligned in XCDR2. Element sizes are 1, 2, 4 or 8. */
+struct dds_stream_simd_ops {
+  enum dds_stream_simd_level level;
+
+  /* Byte-swaps num elements in place */
+  void (*swap) (void * __restrict buf, uint32_t size, uint32_t num);
+
+  /* Copies num elements from src to dst, byte-swapping each element */
+  void (*swap_copy) (void * __restrict dst, const void * __restrict src, uint32_t size, uint32_t num);
+
+  /* Byte-swaps num elements in place if bswap is set and checks that all
+     elements are <= max (size 1, 2 or 4); returns false if any exceeds max,
+     in which case the contents of buf are unspecified */
+  bool (*check_max) (void * __restrict buf, uint32_t size, uint32_t num, uint32_t max, bool bswap);
+};
+
+/** @component cdr_serializer */
+const struct dds_stream_simd_ops *dds_stream_simd (void);
+
+/* Kernels for a specific level, or a null pointer if the level is not supported
+   by the compiler or the CPU */
+/** @component cdr_serializer */
+const struct dds_stream_simd_ops *dds_stream_simd_get_ops (enum dds_stream_simd_level level);
+
+#if defined (__cplusplus)
+}
+#endif
+
+#endif /* DDS__CDRSTREAM_SIMD_H */
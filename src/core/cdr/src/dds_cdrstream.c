@@ -19,6 +19,8 @@
 #include "dds/ddsrt/string.h"
 #include "dds/ddsrt/static_assert.h"
 #include "dds/cdr/dds_cdrstream.h"
+#include "dds/cdr/dds_cdrstream_gen.h"
+#include "dds__cdrstream_simd.h"
 
 #define TOKENPASTE(a, b) a ## b
 #define TOKENPASTE2(a, b) TOKENPASTE(a, b)
@@ -80,6 +82,7 @@
 #define dds_stream_write_pl_memberlistBO              NAME_BYTE_ORDER(dds_stream_write_pl_memberlist)
 #define dds_stream_write_pl_memberBO                  NAME_BYTE_ORDER(dds_stream_write_pl_member)
 #define dds_stream_write_delimitedBO                  NAME_BYTE_ORDER(dds_stream_write_delimited)
+#define dds_stream_write_copy_planBO                  NAME_BYTE_ORDER(dds_stream_write_copy_plan)
 #define dds_stream_write_keyBO                        NAME_BYTE_ORDER(dds_stream_write_key)
 #define dds_stream_write_keyBO_impl                   NAME2_BYTE_ORDER(dds_stream_write_key, _impl)
 #define dds_cdr_alignto_clear_and_resizeBO            NAME_BYTE_ORDER(dds_cdr_alignto_clear_and_resize)
@@ -102,7 +105,7 @@ struct key_off_info {
 };
 
 static const uint32_t *dds_stream_skip_adr (uint32_t insn, const uint32_t * __restrict ops);
-static const uint32_t *dds_stream_skip_default (char * __restrict data, const uint32_t * __restrict ops);
+static const uint32_t *dds_stream_skip_default (dds_istream_t * __restrict is, char * __restrict data, const uint32_t * __restrict ops);
 static const uint32_t *dds_stream_extract_key_from_data1 (dds_istream_t * __restrict is, dds_ostream_t * __restrict os,
   uint32_t ops_offs_idx, uint32_t * __restrict ops_offs, const uint32_t * const __restrict op0, const uint32_t * const __restrict op0_type, const uint32_t * __restrict ops, bool mutable_member, bool mutable_member_or_parent,
   uint32_t n_keys, uint32_t * __restrict keys_remaining, const dds_cdrstream_desc_key_t * __restrict key, struct key_off_info * __restrict key_offs);
@@ -169,6 +172,7 @@ void dds_istream_init (dds_istream_t * __restrict st, uint32_t size, const void
   st->m_size = size;
   st->m_index = 0;
   st->m_xcdr_version = xcdr_version;
+  st->m_allocator = NULL;
 }
 
 void dds_ostream_init (dds_ostream_t * __restrict st, uint32_t size, uint32_t xcdr_version)
@@ -352,9 +356,19 @@ static void dds_os_put8BE (dds_ostreamBE_t * __restrict s, uint64_t v) { dds_os_
 static uint32_t dds_os_reserve4BE (dds_ostreamBE_t * __restrict s) { return dds_os_reserve4 (&s->x); }
 static uint32_t dds_os_reserve8BE (dds_ostreamBE_t * __restrict s) { return dds_os_reserve8 (&s->x); }
 
+static inline bool use_simd (uint32_t size, uint32_t num)
+{
+  return size * num >= DDS_STREAM_SIMD_MIN_BYTES;
+}
+
 static void dds_stream_swap (void * __restrict vbuf, uint32_t size, uint32_t num)
 {
   assert (size == 1 || size == 2 || size == 4 || size == 8);
+  if (size > 1 && use_simd (size, num))
+  {
+    dds_stream_simd ()->swap (vbuf, size, num);
+    return;
+  }
   switch (size)
   {
     case 1:
@@ -647,6 +661,108 @@ size_t dds_stream_check_optimize (const struct dds_cdrstream_desc * __restrict d
   return opt_size;
 }
 
+struct copy_plan_builder {
+  const uint32_t *ops0;
+  uint32_t nmembers;
+  uint32_t nsteps, maxsteps;
+  struct dds_cdrstream_copy_step *steps;
+};
+
+static void copy_plan_add_step (struct copy_plan_builder *b, const struct dds_cdrstream_copy_step *step)
+{
+  if (step->num > 0 && b->nsteps > 0)
+  {
+    /* Extend the previous run if this run directly follows it in memory, which
+       implies it also directly follows it in the CDR: the element size and
+       therefore the alignment are the same. */
+    struct dds_cdrstream_copy_step *prev = &b->steps[b->nsteps - 1];
+    if (prev->num > 0 && prev->type == step->type && prev->data_offs + prev->num * get_primitive_size (prev->type) == step->data_offs)
+    {
+      prev->num += step->num;
+      return;
+    }
+  }
+  if (b->nsteps == b->maxsteps)
+  {
+    b->maxsteps = b->maxsteps ? 2 * b->maxsteps : 8;
+    b->steps = ddsrt_realloc (b->steps, b->maxsteps * sizeof (*b->steps));
+  }
+  b->steps[b->nsteps++] = *step;
+}
+
+static bool dds_stream_compile_copy_plan1 (struct copy_plan_builder *b, const uint32_t *ops, uint32_t data_offs)
+{
+  uint32_t insn;
+  while ((insn = *ops) != DDS_OP_RTS)
+  {
+    if (DDS_OP (insn) != DDS_OP_ADR)
+      return false;
+    b->nmembers++;
+    if (!op_type_external (insn) && !op_type_optional (insn))
+    {
+      switch (DDS_OP_TYPE (insn))
+      {
+        case DDS_OP_VAL_1BY: case DDS_OP_VAL_2BY: case DDS_OP_VAL_4BY: case DDS_OP_VAL_8BY:
+          copy_plan_add_step (b, &(struct dds_cdrstream_copy_step) { .data_offs = data_offs + ops[1], .num = 1, .type = DDS_OP_TYPE (insn) });
+          ops += 2;
+          continue;
+        case DDS_OP_VAL_ARR:
+          if (DDS_OP_SUBTYPE (insn) >= DDS_OP_VAL_1BY && DDS_OP_SUBTYPE (insn) <= DDS_OP_VAL_8BY)
+          {
+            copy_plan_add_step (b, &(struct dds_cdrstream_copy_step) { .data_offs = data_offs + ops[1], .num = ops[2], .type = DDS_OP_SUBTYPE (insn) });
+            ops += 3;
+            continue;
+          }
+          break;
+        case DDS_OP_VAL_EXT: {
+          /* Nested final types are flattened into the plan, other extensibilities
+             have a DLC or PLC instruction and are handled by the interpreter */
+          const uint32_t *jsr_ops = ops + DDS_OP_ADR_JSR (ops[2]);
+          const uint32_t jmp = DDS_OP_ADR_JMP (ops[2]);
+          if (DDS_OP_ADR_JSR (ops[2]) > 0 && DDS_OP (jsr_ops[0]) == DDS_OP_ADR)
+          {
+            b->nmembers--;
+            if (!dds_stream_compile_copy_plan1 (b, jsr_ops, data_offs + ops[1]))
+              return false;
+            ops += jmp ? jmp : 3;
+            continue;
+          }
+          break;
+        }
+        default:
+          break;
+      }
+    }
+    copy_plan_add_step (b, &(struct dds_cdrstream_copy_step) { .ops_offs = (uint32_t) (ops - b->ops0), .data_offs = data_offs, .num = 0 });
+    ops = dds_stream_skip_adr (insn, ops);
+  }
+  return true;
+}
+
+struct dds_cdrstream_copy_plan *dds_stream_compile_copy_plan (const struct dds_cdrstream_desc * __restrict desc)
+{
+  /* Only final types have a plain list of members; the plan is only useful if
+     it combines members into runs, so that there are fewer steps than members */
+  struct copy_plan_builder b = { .ops0 = desc->ops.ops, .nmembers = 0, .nsteps = 0, .maxsteps = 0, .steps = NULL };
+  if (!dds_stream_compile_copy_plan1 (&b, desc->ops.ops, 0) || b.nsteps >= b.nmembers)
+  {
+    ddsrt_free (b.steps);
+    return NULL;
+  }
+  struct dds_cdrstream_copy_plan *plan = ddsrt_malloc (sizeof (*plan));
+  plan->nsteps = b.nsteps;
+  plan->steps = ddsrt_realloc (b.steps, b.nsteps * sizeof (*b.steps));
+  return plan;
+}
+
+void dds_stream_free_copy_plan (struct dds_cdrstream_copy_plan *plan)
+{
+  if (plan == NULL)
+    return;
+  ddsrt_free (plan->steps);
+  ddsrt_free (plan);
+}
+
 static void dds_stream_countops1 (const uint32_t * __restrict ops, const uint32_t **ops_end, uint16_t *min_xcdrv, uint32_t nestc, uint32_t *nestm);
 
 static const uint32_t *dds_stream_countops_seq (const uint32_t * __restrict ops, uint32_t insn, const uint32_t **ops_end, uint16_t *min_xcdrv, uint32_t nestc, uint32_t *nestm)
@@ -866,6 +982,24 @@ uint32_t dds_stream_countops (const uint32_t * __restrict ops, uint32_t nkeys, c
   return (uint32_t) (ops_end - ops);
 }
 
+static void *dds_stream_alloc (dds_istream_t * __restrict is, void *ptr, size_t size)
+{
+  if (is->m_allocator == NULL)
+    return dds_realloc (ptr, size);
+  /* memory obtained from the allocator is never resized, the sample is zero-initialized */
+  assert (ptr == NULL);
+  return is->m_allocator->malloc (is->m_allocator->arg, size);
+}
+
+static void *dds_stream_alloc_zero (dds_istream_t * __restrict is, size_t size)
+{
+  if (is == NULL || is->m_allocator == NULL)
+    return ddsrt_calloc (1, size);
+  void *ptr = is->m_allocator->malloc (is->m_allocator->arg, size);
+  memset (ptr, 0, size);
+  return ptr;
+}
+
 static char *dds_stream_reuse_string_bound (dds_istream_t * __restrict is, char * __restrict str, const uint32_t size, bool alloc)
 {
   const uint32_t length = dds_is_get4 (is);
@@ -889,16 +1023,16 @@ static char *dds_stream_reuse_string (dds_istream_t * __restrict is, char * __re
   const uint32_t length = dds_is_get4 (is);
   const void *src = is->m_buffer + is->m_index;
   if (str == NULL || strlen (str) + 1 < length)
-    str = dds_realloc (str, length);
+    str = dds_stream_alloc (is, str, length);
   memcpy (str, src, length);
   is->m_index += length;
   return str;
 }
 
-static char *dds_stream_reuse_string_empty (char * __restrict str)
+static char *dds_stream_reuse_string_empty (dds_istream_t * __restrict is, char * __restrict str)
 {
   if (str == NULL)
-    str = dds_realloc (str, 1);
+    str = dds_stream_alloc (is, str, 1);
   str[0] = '\0';
   return str;
 }
@@ -1027,7 +1161,7 @@ static const uint32_t *skip_array_insns (uint32_t insn, const uint32_t * __restr
   return NULL;
 }
 
-static const uint32_t *skip_array_default (uint32_t insn, char * __restrict data, const uint32_t * __restrict ops)
+static const uint32_t *skip_array_default (dds_istream_t * __restrict is, uint32_t insn, char * __restrict data, const uint32_t * __restrict ops)
 {
   const enum dds_stream_typecode subtype = DDS_OP_SUBTYPE (insn);
   const uint32_t num = ops[2];
@@ -1046,7 +1180,7 @@ static const uint32_t *skip_array_default (uint32_t insn, char * __restrict data
     case DDS_OP_VAL_STR: {
       char **ptr = (char **) data;
       for (uint32_t i = 0; i < num; i++)
-        ptr[i] = dds_stream_reuse_string_empty (*(char **) ptr[i]);
+        ptr[i] = dds_stream_reuse_string_empty (is, ptr[i]);
       return ops + 3;
     }
     case DDS_OP_VAL_BST: {
@@ -1061,7 +1195,7 @@ static const uint32_t *skip_array_default (uint32_t insn, char * __restrict data
       const uint32_t jmp = DDS_OP_ADR_JMP (ops[3]);
       const uint32_t elem_size = ops[4];
       for (uint32_t i = 0; i < num; i++)
-        (void) dds_stream_skip_default (data + i * elem_size, jsr_ops);
+        (void) dds_stream_skip_default (is, data + i * elem_size, jsr_ops);
       return ops + (jmp ? jmp : 5);
     }
     case DDS_OP_VAL_EXT: {
@@ -1072,7 +1206,7 @@ static const uint32_t *skip_array_default (uint32_t insn, char * __restrict data
   return NULL;
 }
 
-static const uint32_t *skip_union_default (uint32_t insn, char * __restrict discaddr, char * __restrict baseaddr, const uint32_t * __restrict ops)
+static const uint32_t *skip_union_default (dds_istream_t * __restrict is, uint32_t insn, char * __restrict discaddr, char * __restrict baseaddr, const uint32_t * __restrict ops)
 {
   switch (DDS_OP_SUBTYPE (insn))
   {
@@ -1093,9 +1227,9 @@ static const uint32_t *skip_union_default (uint32_t insn, char * __restrict disc
       case DDS_OP_VAL_2BY: *((uint16_t *) valaddr) = 0; break;
       case DDS_OP_VAL_4BY: case DDS_OP_VAL_ENU: *((uint32_t *) valaddr) = 0; break;
       case DDS_OP_VAL_8BY: *((uint64_t *) valaddr) = 0; break;
-      case DDS_OP_VAL_STR: *(char **) valaddr = dds_stream_reuse_string_empty (*((char **) valaddr)); break;
+      case DDS_OP_VAL_STR: *(char **) valaddr = dds_stream_reuse_string_empty (is, *((char **) valaddr)); break;
       case DDS_OP_VAL_BST: case DDS_OP_VAL_SEQ: case DDS_OP_VAL_BSQ: case DDS_OP_VAL_ARR: case DDS_OP_VAL_UNI: case DDS_OP_VAL_STU: case DDS_OP_VAL_BMK:
-        (void) dds_stream_skip_default (valaddr, jeq_op + DDS_OP_ADR_JSR (jeq_op[0]));
+        (void) dds_stream_skip_default (is, valaddr, jeq_op + DDS_OP_ADR_JSR (jeq_op[0]));
         break;
       case DDS_OP_VAL_EXT: {
         abort (); /* not supported */
@@ -1267,6 +1401,15 @@ static inline void dds_stream_to_LE_insitu (void * __restrict vbuf, uint32_t siz
 #include "dds_cdrstream_write.part.c"
 #undef NAME_BYTE_ORDER_EXT
 
+/* Type-specific serializers are only used if the sample can't simply be copied */
+static bool write_with_serializers (const dds_ostream_t * __restrict os, const struct dds_cdrstream_desc * __restrict desc)
+{
+  if (desc->serializers == NULL || desc->serializers->write == NULL)
+    return false;
+  const size_t opt_size = os->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_1 ? desc->opt_size_xcdr1 : desc->opt_size_xcdr2;
+  return !(opt_size && desc->align && (os->m_index % desc->align) == 0);
+}
+
 // Map some write-native functions to their little-endian or big-endian equivalent
 #if DDSRT_ENDIAN == DDSRT_LITTLE_ENDIAN
 
@@ -1302,6 +1445,8 @@ const uint32_t *dds_stream_write (dds_ostream_t * __restrict os, const char * __
 
 bool dds_stream_write_sample (dds_ostream_t * __restrict os, const void * __restrict data, const struct dds_cdrstream_desc * __restrict desc)
 {
+  if (write_with_serializers (os, desc))
+    return desc->serializers->write (os, data);
   return dds_stream_write_sampleLE ((dds_ostreamLE_t *) os, data, desc);
 }
 
@@ -1313,12 +1458,16 @@ bool dds_stream_write_sampleLE (dds_ostreamLE_t * __restrict os, const void * __
     dds_os_put_bytes ((struct dds_ostream *)os, data, (uint32_t) opt_size);
     return true;
   }
+  else if (desc->copy_plan)
+    return dds_stream_write_copy_planLE (os, data, desc->ops.ops, desc->copy_plan);
   else
     return dds_stream_writeLE (os, data, desc->ops.ops) != NULL;
 }
 
 bool dds_stream_write_sampleBE (dds_ostreamBE_t * __restrict os, const void * __restrict data, const struct dds_cdrstream_desc * __restrict desc)
 {
+  if (desc->copy_plan)
+    return dds_stream_write_copy_planBE (os, data, desc->ops.ops, desc->copy_plan);
   return dds_stream_writeBE (os, data, desc->ops.ops) != NULL;
 }
 
@@ -1356,11 +1505,15 @@ const uint32_t *dds_stream_write (dds_ostream_t * __restrict os, const char * __
 
 bool dds_stream_write_sample (dds_ostream_t * __restrict os, const void * __restrict data, const struct dds_cdrstream_desc * __restrict desc)
 {
+  if (write_with_serializers (os, desc))
+    return desc->serializers->write (os, data);
   return dds_stream_write_sampleBE ((dds_ostreamBE_t *) os, data, desc);
 }
 
 bool dds_stream_write_sampleLE (dds_ostreamLE_t * __restrict os, const void * __restrict data, const struct dds_cdrstream_desc * __restrict desc)
 {
+  if (desc->copy_plan)
+    return dds_stream_write_copy_planLE (os, data, desc->ops.ops, desc->copy_plan);
   return dds_stream_writeLE (os, data, desc->ops.ops) != NULL;
 }
 
@@ -1372,6 +1525,8 @@ bool dds_stream_write_sampleBE (dds_ostreamBE_t * __restrict os, const void * __
     dds_os_put_bytes ((struct dds_ostream *)os, data, (uint32_t) opt_size);
     return true;
   }
+  else if (desc->copy_plan)
+    return dds_stream_write_copy_planBE (os, data, desc->ops.ops, desc->copy_plan);
   else
     return dds_stream_writeBE (os, data, desc->ops.ops) != NULL;
 }
@@ -1388,7 +1543,7 @@ const uint32_t * dds_stream_write_with_byte_order (dds_ostream_t * __restrict os
     return dds_stream_write (os, data, ops);
 }
 
-static void realloc_sequence_buffer_if_needed (dds_sequence_t * __restrict seq, uint32_t num, uint32_t elem_size, bool init)
+static void realloc_sequence_buffer_if_needed (dds_istream_t * __restrict is, dds_sequence_t * __restrict seq, uint32_t num, uint32_t elem_size, bool init)
 {
   const uint32_t size = num * elem_size;
 
@@ -1408,10 +1563,10 @@ static void realloc_sequence_buffer_if_needed (dds_sequence_t * __restrict seq,
   }
   else if (num > 0 && seq->_maximum == 0)
   {
-    seq->_buffer = ddsrt_malloc (size);
+    seq->_buffer = dds_stream_alloc (is, NULL, size);
     if (init)
       memset (seq->_buffer, 0, size);
-    seq->_release = true;
+    seq->_release = (is->m_allocator == NULL);
     seq->_maximum = num;
   }
 }
@@ -1443,7 +1598,7 @@ static const uint32_t *dds_stream_read_seq (dds_istream_t * __restrict is, char
   {
     case DDS_OP_VAL_BLN: case DDS_OP_VAL_1BY: case DDS_OP_VAL_2BY: case DDS_OP_VAL_4BY: case DDS_OP_VAL_8BY: {
       const uint32_t elem_size = get_primitive_size (subtype);
-      realloc_sequence_buffer_if_needed (seq, num, elem_size, false);
+      realloc_sequence_buffer_if_needed (is, seq, num, elem_size, false);
       seq->_length = (num <= seq->_maximum) ? num : seq->_maximum;
       dds_is_get_bytes (is, seq->_buffer, seq->_length, elem_size);
       if (seq->_length < num)
@@ -1452,7 +1607,7 @@ static const uint32_t *dds_stream_read_seq (dds_istream_t * __restrict is, char
     }
     case DDS_OP_VAL_ENU: {
       const uint32_t elem_size = DDS_OP_TYPE_SZ (insn);
-      realloc_sequence_buffer_if_needed (seq, num, 4, false);
+      realloc_sequence_buffer_if_needed (is, seq, num, 4, false);
       seq->_length = (num <= seq->_maximum) ? num : seq->_maximum;
       switch (elem_size)
       {
@@ -1474,7 +1629,7 @@ static const uint32_t *dds_stream_read_seq (dds_istream_t * __restrict is, char
     }
     case DDS_OP_VAL_BMK: {
       const uint32_t elem_size = DDS_OP_TYPE_SZ (insn);
-      realloc_sequence_buffer_if_needed (seq, num, elem_size, false);
+      realloc_sequence_buffer_if_needed (is, seq, num, elem_size, false);
       seq->_length = (num <= seq->_maximum) ? num : seq->_maximum;
       dds_is_get_bytes (is, seq->_buffer, seq->_length, elem_size);
       if (seq->_length < num)
@@ -1482,7 +1637,7 @@ static const uint32_t *dds_stream_read_seq (dds_istream_t * __restrict is, char
       return ops + 4 + bound_op;
     }
     case DDS_OP_VAL_STR: {
-      realloc_sequence_buffer_if_needed (seq, num, sizeof (char *), true);
+      realloc_sequence_buffer_if_needed (is, seq, num, sizeof (char *), true);
       seq->_length = (num <= seq->_maximum) ? num : seq->_maximum;
       char **ptr = (char **) seq->_buffer;
       for (uint32_t i = 0; i < seq->_length; i++)
@@ -1493,7 +1648,7 @@ static const uint32_t *dds_stream_read_seq (dds_istream_t * __restrict is, char
     }
     case DDS_OP_VAL_BST: {
       const uint32_t elem_size = ops[2 + bound_op];
-      realloc_sequence_buffer_if_needed (seq, num, elem_size, false);
+      realloc_sequence_buffer_if_needed (is, seq, num, elem_size, false);
       seq->_length = (num <= seq->_maximum) ? num : seq->_maximum;
       char *ptr = (char *) seq->_buffer;
       for (uint32_t i = 0; i < seq->_length; i++)
@@ -1506,7 +1661,7 @@ static const uint32_t *dds_stream_read_seq (dds_istream_t * __restrict is, char
       const uint32_t elem_size = ops[2 + bound_op];
       const uint32_t jmp = DDS_OP_ADR_JMP (ops[3 + bound_op]);
       uint32_t const * const jsr_ops = ops + DDS_OP_ADR_JSR (ops[3 + bound_op]);
-      realloc_sequence_buffer_if_needed (seq, num, elem_size, true);
+      realloc_sequence_buffer_if_needed (is, seq, num, elem_size, true);
       seq->_length = (num <= seq->_maximum) ? num : seq->_maximum;
       char *ptr = (char *) seq->_buffer;
       for (uint32_t i = 0; i < num; i++)
@@ -1615,7 +1770,7 @@ static const uint32_t *dds_stream_read_uni (dds_istream_t * __restrict is, char
       assert (DDS_OP (jeq_op[0]) == DDS_OP_JEQ4);
       uint32_t sz = get_jeq4_type_size (valtype, jeq_op);
       if (*((char **) valaddr) == NULL)
-        *((char **) valaddr) = ddsrt_calloc (1, sz);
+        *((char **) valaddr) = dds_stream_alloc_zero (is, sz);
       valaddr = *((char **) valaddr);
     }
 
@@ -1654,14 +1809,15 @@ static const uint32_t *dds_stream_read_uni (dds_istream_t * __restrict is, char
   return ops;
 }
 
-static void dds_stream_alloc_external (const uint32_t * __restrict ops, uint32_t insn, void ** addr)
+static void dds_stream_alloc_external (dds_istream_t * __restrict is, const uint32_t * __restrict ops, uint32_t insn, void ** addr)
 {
   /* Allocate memory for @external member. This memory must be initialized to 0,
       because the type may contain sequences that need to have 0 index/size
-      or external fields that need to be initialized to null */
+      or external fields that need to be initialized to null.  The input stream
+      is null when not deserializing. */
   uint32_t sz = get_adr_type_size (insn, ops);
   if (*((char **) *addr) == NULL)
-    *((char **) *addr) = ddsrt_calloc (1, sz);
+    *((char **) *addr) = dds_stream_alloc_zero (is, sz);
   *addr = *((char **) *addr);
 }
 
@@ -1676,7 +1832,7 @@ static inline const uint32_t *dds_stream_read_adr (uint32_t insn, dds_istream_t
   }
 
   if (op_type_external (insn))
-    dds_stream_alloc_external (ops, insn, &addr);
+    dds_stream_alloc_external (is, ops, insn, &addr);
 
   switch (DDS_OP_TYPE (insn))
   {
@@ -1763,7 +1919,7 @@ static const uint32_t *dds_stream_skip_adr (uint32_t insn, const uint32_t * __re
   return NULL;
 }
 
-static const uint32_t *dds_stream_skip_adr_default (uint32_t insn, char * __restrict data, const uint32_t * __restrict ops)
+static const uint32_t *dds_stream_skip_adr_default (dds_istream_t * __restrict is, uint32_t insn, char * __restrict data, const uint32_t * __restrict ops)
 {
   void *addr = data + ops[1];
   /* FIXME: currently only implicit default values are used, this code should be
@@ -1775,7 +1931,7 @@ static const uint32_t *dds_stream_skip_adr_default (uint32_t insn, char * __rest
     case DDS_OP_VAL_4BY: *(uint32_t *) addr = 0; return ops + 2;
     case DDS_OP_VAL_8BY: *(uint64_t *) addr = 0; return ops + 2;
 
-    case DDS_OP_VAL_STR: *(char **) addr = dds_stream_reuse_string_empty (*(char **) addr); return ops + 2;
+    case DDS_OP_VAL_STR: *(char **) addr = dds_stream_reuse_string_empty (is, *(char **) addr); return ops + 2;
     case DDS_OP_VAL_BST: ((char *) addr)[0] = '\0'; return ops + 3;
     case DDS_OP_VAL_ENU: *(uint32_t *) addr = 0; return ops + 3;
     case DDS_OP_VAL_BMK:
@@ -1794,15 +1950,15 @@ static const uint32_t *dds_stream_skip_adr_default (uint32_t insn, char * __rest
       return skip_sequence_insns (insn, ops);
     }
     case DDS_OP_VAL_ARR: {
-      return skip_array_default (insn, addr, ops);
+      return skip_array_default (is, insn, addr, ops);
     }
     case DDS_OP_VAL_UNI: {
-      return skip_union_default (insn, addr, data, ops);
+      return skip_union_default (is, insn, addr, data, ops);
     }
     case DDS_OP_VAL_EXT: {
       const uint32_t *jsr_ops = ops + DDS_OP_ADR_JSR (ops[2]);
       const uint32_t jmp = DDS_OP_ADR_JMP (ops[2]);
-      (void) dds_stream_skip_default (addr, jsr_ops);
+      (void) dds_stream_skip_default (is, addr, jsr_ops);
       return ops + (jmp ? jmp : 3);
     }
     case DDS_OP_VAL_STU: {
@@ -1813,7 +1969,7 @@ static const uint32_t *dds_stream_skip_adr_default (uint32_t insn, char * __rest
   return NULL;
 }
 
-static const uint32_t *dds_stream_skip_default (char * __restrict data, const uint32_t * __restrict ops)
+static const uint32_t *dds_stream_skip_default (dds_istream_t * __restrict is, char * __restrict data, const uint32_t * __restrict ops)
 {
   uint32_t insn;
   while ((insn = *ops) != DDS_OP_RTS)
@@ -1821,11 +1977,11 @@ static const uint32_t *dds_stream_skip_default (char * __restrict data, const ui
     switch (DDS_OP (insn))
     {
       case DDS_OP_ADR: {
-        ops = dds_stream_skip_adr_default (insn, data, ops);
+        ops = dds_stream_skip_adr_default (is, insn, data, ops);
         break;
       }
       case DDS_OP_JSR: {
-        (void) dds_stream_skip_default (data, ops + DDS_OP_JUMP (insn));
+        (void) dds_stream_skip_default (is, data, ops + DDS_OP_JUMP (insn));
         ops++;
         break;
       }
@@ -1848,7 +2004,7 @@ static const uint32_t *dds_stream_read_delimited (dds_istream_t * __restrict is,
     {
       case DDS_OP_ADR: {
         /* skip fields that are not in serialized data for appendable type */
-        ops = (is->m_index - delimited_offs < delimited_sz) ? dds_stream_read_adr (insn, is, data, ops, false) : dds_stream_skip_adr_default (insn, data, ops);
+        ops = (is->m_index - delimited_offs < delimited_sz) ? dds_stream_read_adr (insn, is, data, ops, false) : dds_stream_skip_adr_default (is, insn, data, ops);
         break;
       }
       case DDS_OP_JSR: {
@@ -1995,28 +2151,28 @@ static inline const uint32_t *normalize_error_ops (void) { normalize_error (); r
    padding and a primitive type overflowing our offset */
 #define CDR_SIZE_MAX ((uint32_t) 0xfffffff0)
 
-static uint32_t check_align_prim (uint32_t off, uint32_t size, uint32_t a_lg2)
+static uint32_t check_align_prim (uint32_t off, uint32_t size, uint32_t a_lg2, uint32_t c_lg2)
 {
-  assert (a_lg2 <= 3);
+  assert (a_lg2 <= c_lg2 && c_lg2 <= 3);
   const uint32_t a = 1u << a_lg2;
   assert (size <= CDR_SIZE_MAX);
   assert (off <= size);
   const uint32_t off1 = (off + a - 1) & ~(a - 1);
   assert (off <= off1 && off1 <= CDR_SIZE_MAX);
-  if (size < off1 + a)
+  if (size < off1 + (1u << c_lg2))
     return normalize_error_offset ();
   return off1;
 }
 
-static uint32_t check_align_prim_many (uint32_t off, uint32_t size, uint32_t a_lg2, uint32_t n)
+static uint32_t check_align_prim_many (uint32_t off, uint32_t size, uint32_t a_lg2, uint32_t c_lg2, uint32_t n)
 {
-  assert (a_lg2 <= 3);
+  assert (a_lg2 <= c_lg2 && c_lg2 <= 3);
   const uint32_t a = 1u << a_lg2;
   assert (size <= CDR_SIZE_MAX);
   assert (off <= size);
   const uint32_t off1 = (off + a - 1) & ~(a - 1);
   assert (off <= off1 && off1 <= CDR_SIZE_MAX);
-  if (size < off1 || ((size - off1) >> a_lg2) < n)
+  if (size < off1 || ((size - off1) >> c_lg2) < n)
     return normalize_error_offset ();
   return off1;
 }
@@ -2033,7 +2189,7 @@ static bool normalize_uint8 (uint32_t *off, uint32_t size)
 static bool normalize_uint16 (char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap) ddsrt_attribute_warn_unused_result ddsrt_nonnull_all;
 static bool normalize_uint16 (char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap)
 {
-  if ((*off = check_align_prim (*off, size, 1)) == UINT32_MAX)
+  if ((*off = check_align_prim (*off, size, 1, 1)) == UINT32_MAX)
     return false;
   if (bswap)
     *((uint16_t *) (data + *off)) = ddsrt_bswap2u (*((uint16_t *) (data + *off)));
@@ -2044,7 +2200,7 @@ static bool normalize_uint16 (char * __restrict data, uint32_t * __restrict off,
 static bool normalize_uint32 (char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap) ddsrt_attribute_warn_unused_result ddsrt_nonnull_all;
 static bool normalize_uint32 (char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap)
 {
-  if ((*off = check_align_prim (*off, size, 2)) == UINT32_MAX)
+  if ((*off = check_align_prim (*off, size, 2, 2)) == UINT32_MAX)
     return false;
   if (bswap)
     *((uint32_t *) (data + *off)) = ddsrt_bswap4u (*((uint32_t *) (data + *off)));
@@ -2055,7 +2211,7 @@ static bool normalize_uint32 (char * __restrict data, uint32_t * __restrict off,
 static bool normalize_uint64 (char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap, uint32_t xcdr_version) ddsrt_attribute_warn_unused_result ddsrt_nonnull_all;
 static bool normalize_uint64 (char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap, uint32_t xcdr_version)
 {
-  if ((*off = check_align_prim (*off, size, xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 ? 2 : 3)) == UINT32_MAX)
+  if ((*off = check_align_prim (*off, size, xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 ? 2 : 3, 3)) == UINT32_MAX)
     return false;
   if (bswap)
   {
@@ -2095,7 +2251,7 @@ static bool read_and_normalize_bool (bool * __restrict val, char * __restrict da
 static inline bool read_and_normalize_uint8 (uint8_t * __restrict val, char * __restrict data, uint32_t * __restrict off, uint32_t size) ddsrt_attribute_warn_unused_result ddsrt_nonnull_all;
 static inline bool read_and_normalize_uint8 (uint8_t * __restrict val, char * __restrict data, uint32_t * __restrict off, uint32_t size)
 {
-  if ((*off = check_align_prim (*off, size, 0)) == UINT32_MAX)
+  if ((*off = check_align_prim (*off, size, 0, 0)) == UINT32_MAX)
     return false;
   *val = *((uint8_t *) (data + *off));
   (*off)++;
@@ -2105,7 +2261,7 @@ static inline bool read_and_normalize_uint8 (uint8_t * __restrict val, char * __
 static inline bool read_and_normalize_uint16 (uint16_t * __restrict val, char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap) ddsrt_attribute_warn_unused_result ddsrt_nonnull_all;
 static inline bool read_and_normalize_uint16 (uint16_t * __restrict val, char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap)
 {
-  if ((*off = check_align_prim (*off, size, 1)) == UINT32_MAX)
+  if ((*off = check_align_prim (*off, size, 1, 1)) == UINT32_MAX)
     return false;
   if (bswap)
     *((uint16_t *) (data + *off)) = ddsrt_bswap2u (*((uint16_t *) (data + *off)));
@@ -2117,7 +2273,7 @@ static inline bool read_and_normalize_uint16 (uint16_t * __restrict val, char *
 static inline bool read_and_normalize_uint32 (uint32_t * __restrict val, char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap) ddsrt_attribute_warn_unused_result ddsrt_nonnull_all;
 static inline bool read_and_normalize_uint32 (uint32_t * __restrict val, char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap)
 {
-  if ((*off = check_align_prim (*off, size, 2)) == UINT32_MAX)
+  if ((*off = check_align_prim (*off, size, 2, 2)) == UINT32_MAX)
     return false;
   if (bswap)
     *((uint32_t *) (data + *off)) = ddsrt_bswap4u (*((uint32_t *) (data + *off)));
@@ -2129,7 +2285,7 @@ static inline bool read_and_normalize_uint32 (uint32_t * __restrict val, char *
 static inline bool read_and_normalize_uint64 (uint64_t * __restrict val, char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap, uint32_t xcdr_version) ddsrt_attribute_warn_unused_result ddsrt_nonnull_all;
 static inline bool read_and_normalize_uint64 (uint64_t * __restrict val, char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap, uint32_t xcdr_version)
 {
-  if ((*off = check_align_prim (*off, size, xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 ? 2 : 3)) == UINT32_MAX)
+  if ((*off = check_align_prim (*off, size, xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 ? 2 : 3, 3)) == UINT32_MAX)
     return false;
   if (bswap)
   {
@@ -2145,7 +2301,7 @@ static inline bool read_and_normalize_uint64 (uint64_t * __restrict val, char *
 static bool peek_and_normalize_uint32 (uint32_t * __restrict val, char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap) ddsrt_attribute_warn_unused_result ddsrt_nonnull_all;
 static bool peek_and_normalize_uint32 (uint32_t * __restrict val, char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap)
 {
-  if ((*off = check_align_prim (*off, size, 2)) == UINT32_MAX)
+  if ((*off = check_align_prim (*off, size, 2, 2)) == UINT32_MAX)
     return false;
   if (bswap)
     *val = ddsrt_bswap4u (*((uint32_t *) (data + *off)));
@@ -2257,14 +2413,16 @@ static bool normalize_primarray (char * __restrict data, uint32_t * __restrict o
   switch (type)
   {
     case DDS_OP_VAL_1BY:
-      if ((*off = check_align_prim_many (*off, size, 0, num)) == UINT32_MAX)
+      if ((*off = check_align_prim_many (*off, size, 0, 0, num)) == UINT32_MAX)
         return false;
       *off += num;
       return true;
     case DDS_OP_VAL_2BY:
-      if ((*off = check_align_prim_many (*off, size, 1, num)) == UINT32_MAX)
+      if ((*off = check_align_prim_many (*off, size, 1, 1, num)) == UINT32_MAX)
         return false;
-      if (bswap)
+      if (bswap && use_simd (2, num))
+        dds_stream_simd ()->swap (data + *off, 2, num);
+      else if (bswap)
       {
         uint16_t *xs = (uint16_t *) (data + *off);
         for (uint32_t i = 0; i < num; i++)
@@ -2273,9 +2431,11 @@ static bool normalize_primarray (char * __restrict data, uint32_t * __restrict o
       *off += 2 * num;
       return true;
     case DDS_OP_VAL_4BY:
-      if ((*off = check_align_prim_many (*off, size, 2, num)) == UINT32_MAX)
+      if ((*off = check_align_prim_many (*off, size, 2, 2, num)) == UINT32_MAX)
         return false;
-      if (bswap)
+      if (bswap && use_simd (4, num))
+        dds_stream_simd ()->swap (data + *off, 4, num);
+      else if (bswap)
       {
         uint32_t *xs = (uint32_t *) (data + *off);
         for (uint32_t i = 0; i < num; i++)
@@ -2284,9 +2444,11 @@ static bool normalize_primarray (char * __restrict data, uint32_t * __restrict o
       *off += 4 * num;
       return true;
     case DDS_OP_VAL_8BY:
-      if ((*off = check_align_prim_many (*off, size, xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 ? 2 : 3, num)) == UINT32_MAX)
+      if ((*off = check_align_prim_many (*off, size, xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 ? 2 : 3, 3, num)) == UINT32_MAX)
         return false;
-      if (bswap)
+      if (bswap && use_simd (8, num))
+        dds_stream_simd ()->swap (data + *off, 8, num);
+      else if (bswap)
       {
         uint64_t *xs = (uint64_t *) (data + *off);
         for (uint32_t i = 0; i < num; i++)
@@ -2311,32 +2473,56 @@ static bool normalize_enumarray (char * __restrict data, uint32_t * __restrict o
   switch (enum_sz)
   {
     case 1: {
-      if ((*off = check_align_prim_many (*off, size, 0, num)) == UINT32_MAX)
+      if ((*off = check_align_prim_many (*off, size, 0, 0, num)) == UINT32_MAX)
         return false;
       uint8_t * const xs = (uint8_t *) (data + *off);
-      for (uint32_t i = 0; i < num; i++)
-        if (xs[i] > max)
+      if (use_simd (1, num))
+      {
+        if (!dds_stream_simd ()->check_max (xs, 1, num, max, false))
           return normalize_error_bool ();
+      }
+      else
+      {
+        for (uint32_t i = 0; i < num; i++)
+          if (xs[i] > max)
+            return normalize_error_bool ();
+      }
       *off += num;
       break;
     }
     case 2: {
-      if ((*off = check_align_prim_many (*off, size, 1, num)) == UINT32_MAX)
+      if ((*off = check_align_prim_many (*off, size, 1, 1, num)) == UINT32_MAX)
         return false;
       uint16_t * const xs = (uint16_t *) (data + *off);
-      for (uint32_t i = 0; i < num; i++)
-        if ((uint16_t) (bswap ? (xs[i] = ddsrt_bswap2u (xs[i])) : xs[i]) > max)
+      if (use_simd (2, num))
+      {
+        if (!dds_stream_simd ()->check_max (xs, 2, num, max, bswap))
           return normalize_error_bool ();
+      }
+      else
+      {
+        for (uint32_t i = 0; i < num; i++)
+          if ((uint16_t) (bswap ? (xs[i] = ddsrt_bswap2u (xs[i])) : xs[i]) > max)
+            return normalize_error_bool ();
+      }
       *off += 2 * num;
       break;
     }
     case 4: {
-      if ((*off = check_align_prim_many (*off, size, 2, num)) == UINT32_MAX)
+      if ((*off = check_align_prim_many (*off, size, 2, 2, num)) == UINT32_MAX)
         return false;
       uint32_t * const xs = (uint32_t *) (data + *off);
-      for (uint32_t i = 0; i < num; i++)
-        if ((uint32_t) (bswap ? (xs[i] = ddsrt_bswap4u (xs[i])) : xs[i]) > max)
+      if (use_simd (4, num))
+      {
+        if (!dds_stream_simd ()->check_max (xs, 4, num, max, bswap))
           return normalize_error_bool ();
+      }
+      else
+      {
+        for (uint32_t i = 0; i < num; i++)
+          if ((uint32_t) (bswap ? (xs[i] = ddsrt_bswap4u (xs[i])) : xs[i]) > max)
+            return normalize_error_bool ();
+      }
       *off += 4 * num;
       break;
     }
@@ -2352,7 +2538,7 @@ static bool normalize_bitmaskarray (char * __restrict data, uint32_t * __restric
   switch (DDS_OP_TYPE_SZ (insn))
   {
     case 1: {
-      if ((*off = check_align_prim_many (*off, size, 0, num)) == UINT32_MAX)
+      if ((*off = check_align_prim_many (*off, size, 0, 0, num)) == UINT32_MAX)
         return false;
       uint8_t * const xs = (uint8_t *) (data + *off);
       for (uint32_t i = 0; i < num; i++)
@@ -2362,7 +2548,7 @@ static bool normalize_bitmaskarray (char * __restrict data, uint32_t * __restric
       break;
     }
     case 2: {
-      if ((*off = check_align_prim_many (*off, size, 1, num)) == UINT32_MAX)
+      if ((*off = check_align_prim_many (*off, size, 1, 1, num)) == UINT32_MAX)
         return false;
       uint16_t * const xs = (uint16_t *) (data + *off);
       for (uint32_t i = 0; i < num; i++)
@@ -2372,7 +2558,7 @@ static bool normalize_bitmaskarray (char * __restrict data, uint32_t * __restric
       break;
     }
     case 4: {
-      if ((*off = check_align_prim_many (*off, size, 2, num)) == UINT32_MAX)
+      if ((*off = check_align_prim_many (*off, size, 2, 2, num)) == UINT32_MAX)
         return false;
       uint32_t * const xs = (uint32_t *) (data + *off);
       for (uint32_t i = 0; i < num; i++)
@@ -2382,7 +2568,7 @@ static bool normalize_bitmaskarray (char * __restrict data, uint32_t * __restric
       break;
     }
     case 8: {
-      if ((*off = check_align_prim_many (*off, size, xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 ? 2 : 3, num)) == UINT32_MAX)
+      if ((*off = check_align_prim_many (*off, size, xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 ? 2 : 3, 3, num)) == UINT32_MAX)
         return false;
       uint64_t * const xs = (uint64_t *) (data + *off);
       for (uint32_t i = 0; i < num; i++)
@@ -2565,13 +2751,13 @@ static bool normalize_uni_disc (uint32_t * __restrict val, char * __restrict dat
       return true;
     }
     case DDS_OP_VAL_1BY:
-      if ((*off = check_align_prim (*off, size, 0)) == UINT32_MAX)
+      if ((*off = check_align_prim (*off, size, 0, 0)) == UINT32_MAX)
         return false;
       *val = *((uint8_t *) (data + *off));
       (*off) += 1;
       return true;
     case DDS_OP_VAL_2BY:
-      if ((*off = check_align_prim (*off, size, 1)) == UINT32_MAX)
+      if ((*off = check_align_prim (*off, size, 1, 1)) == UINT32_MAX)
         return false;
       if (bswap)
         *((uint16_t *) (data + *off)) = ddsrt_bswap2u (*((uint16_t *) (data + *off)));
@@ -2579,7 +2765,7 @@ static bool normalize_uni_disc (uint32_t * __restrict val, char * __restrict dat
       (*off) += 2;
       return true;
     case DDS_OP_VAL_4BY:
-      if ((*off = check_align_prim (*off, size, 2)) == UINT32_MAX)
+      if ((*off = check_align_prim (*off, size, 2, 2)) == UINT32_MAX)
         return false;
       if (bswap)
         *((uint32_t *) (data + *off)) = ddsrt_bswap4u (*((uint32_t *) (data + *off)));
@@ -2900,6 +3086,23 @@ const uint32_t *dds_stream_normalize_data (char * __restrict data, uint32_t * __
   return stream_normalize_data_impl (data, off, size, bswap, xcdr_version, ops, false);
 }
 
+static bool stream_normalize_copy_plan (char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap, uint32_t xcdr_version, const uint32_t * __restrict ops, const struct dds_cdrstream_copy_plan * __restrict plan) ddsrt_attribute_warn_unused_result ddsrt_nonnull_all;
+static bool stream_normalize_copy_plan (char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap, uint32_t xcdr_version, const uint32_t * __restrict ops, const struct dds_cdrstream_copy_plan * __restrict plan)
+{
+  for (uint32_t i = 0; i < plan->nsteps; i++)
+  {
+    const struct dds_cdrstream_copy_step *step = &plan->steps[i];
+    if (step->num > 0)
+    {
+      if (!normalize_primarray (data, off, size, bswap, step->num, step->type, xcdr_version))
+        return false;
+    }
+    else if (stream_normalize_adr (ops[step->ops_offs], data, off, size, bswap, xcdr_version, ops + step->ops_offs, false) == NULL)
+      return false;
+  }
+  return true;
+}
+
 static bool stream_normalize_key_impl (void * __restrict data, uint32_t size, uint32_t *offs, bool bswap, uint32_t xcdr_version, const uint32_t * __restrict ops, uint16_t key_offset_count, const uint32_t * key_offset_insn) ddsrt_attribute_warn_unused_result ddsrt_nonnull ((1, 3, 6));
 static bool stream_normalize_key_impl (void * __restrict data, uint32_t size, uint32_t *offs, bool bswap, uint32_t xcdr_version, const uint32_t * __restrict ops, uint16_t key_offset_count, const uint32_t * key_offset_insn)
 {
@@ -2967,6 +3170,20 @@ bool dds_stream_normalize (void * __restrict data, uint32_t size, bool bswap, ui
     return normalize_error_bool ();
   else if (just_key)
     return stream_normalize_key (data, size, bswap, xcdr_version, desc, actual_size);
+  else if (desc->serializers && desc->serializers->normalize)
+  {
+    if (!desc->serializers->normalize (data, &off, size, bswap, xcdr_version))
+      return false;
+    *actual_size = off;
+    return true;
+  }
+  else if (desc->copy_plan)
+  {
+    if (!stream_normalize_copy_plan (data, &off, size, bswap, xcdr_version, desc->ops.ops, desc->copy_plan))
+      return false;
+    *actual_size = off;
+    return true;
+  }
   else if (!stream_normalize_data_impl (data, &off, size, bswap, xcdr_version, desc->ops.ops, false))
     return false;
   else
@@ -3311,6 +3528,11 @@ static void dds_stream_extract_key_from_key_prim_op (dds_istream_t * __restrict
 static void dds_stream_swap_copy (void * __restrict vdst, const void * __restrict vsrc, uint32_t size, uint32_t num)
 {
   assert (size == 1 || size == 2 || size == 4 || size == 8);
+  if (size > 1 && use_simd (size, num))
+  {
+    dds_stream_simd ()->swap_copy (vdst, vsrc, size, num);
+    return;
+  }
   switch (size)
   {
     case 1:
@@ -3548,12 +3770,501 @@ static const uint32_t *dds_stream_extract_key_from_data_skip_adr (dds_istream_t
   return ops;
 }
 
+/*******************************************************************************************
+ **
+ **  Locating members in serialized data, e.g. for evaluating content filters without
+ **  deserializing the sample.
+ **
+ *******************************************************************************************/
+
+static const uint32_t *find_member_op (const uint32_t * __restrict ops, uint32_t index, uint32_t member_id)
+{
+  uint32_t insn;
+  if (DDS_OP (*ops) == DDS_OP_PLC)
+  {
+    /* mutable type: PLM-memberid pairs */
+    for (ops++; (insn = *ops) != DDS_OP_RTS; ops += 2)
+    {
+      if (!(DDS_PLM_FLAGS (insn) & DDS_OP_FLAG_BASE) && ops[1] == member_id)
+      {
+        const uint32_t *plm_ops = ops + DDS_OP_ADR_PLM (insn);
+        return (DDS_OP (*plm_ops) == DDS_OP_ADR) ? plm_ops : NULL;
+      }
+    }
+    return NULL;
+  }
+
+  if (DDS_OP (*ops) == DDS_OP_DLC)
+    ops++;
+  while ((insn = *ops) != DDS_OP_RTS)
+  {
+    if (DDS_OP (insn) != DDS_OP_ADR)
+      return NULL;
+    if (!op_type_base (insn))
+    {
+      if (index == 0)
+        return ops;
+      index--;
+    }
+    ops = dds_stream_skip_adr (insn, ops);
+  }
+  return NULL;
+}
+
+bool dds_stream_member_ref_init (struct dds_cdrstream_member_ref * __restrict ref, const uint32_t * __restrict ops, uint32_t depth, const uint32_t * __restrict index, const uint32_t * __restrict member_id)
+{
+  if (depth == 0 || depth > DDS_CDRSTREAM_MAX_NESTING_DEPTH)
+    return false;
+  ref->depth = depth;
+  for (uint32_t d = 0; d < depth; d++)
+  {
+    if (d > 0)
+    {
+      const uint32_t *outer = ref->path[d - 1];
+      if (DDS_OP_TYPE (*outer) != DDS_OP_VAL_EXT || op_type_optional (*outer))
+        return false;
+      ops = outer + DDS_OP_ADR_JSR (outer[2]);
+    }
+    if ((ref->path[d] = find_member_op (ops, index[d], member_id[d])) == NULL)
+      return false;
+  }
+  return true;
+}
+
+static bool member_fixed_offset_walk (const uint32_t * __restrict ops, const struct dds_cdrstream_member_ref * __restrict ref, uint32_t d, uint32_t xcdr_version, uint32_t * __restrict off, bool * __restrict found)
+{
+  uint32_t insn;
+  if (DDS_OP (*ops) == DDS_OP_DLC || DDS_OP (*ops) == DDS_OP_PLC)
+    return false;
+  while ((insn = *ops) != DDS_OP_RTS)
+  {
+    if (DDS_OP (insn) != DDS_OP_ADR || op_type_optional (insn))
+      return false;
+    const bool target = (ref != NULL && ref->path[d] == ops);
+    uint32_t size, num = 1;
+    switch (DDS_OP_TYPE (insn))
+    {
+      case DDS_OP_VAL_BLN: case DDS_OP_VAL_1BY: case DDS_OP_VAL_2BY: case DDS_OP_VAL_4BY: case DDS_OP_VAL_8BY:
+        size = get_primitive_size (DDS_OP_TYPE (insn));
+        break;
+      case DDS_OP_VAL_ENU: case DDS_OP_VAL_BMK:
+        size = DDS_OP_TYPE_SZ (insn);
+        break;
+      case DDS_OP_VAL_STR: case DDS_OP_VAL_BST:
+        /* variable length, so only ok if it is the member we're looking for */
+        if (!target)
+          return false;
+        size = 4;
+        break;
+      case DDS_OP_VAL_ARR:
+        if (target || !is_primitive_type (DDS_OP_SUBTYPE (insn)))
+          return false;
+        size = get_primitive_size (DDS_OP_SUBTYPE (insn));
+        num = ops[2];
+        break;
+      case DDS_OP_VAL_EXT: {
+        if (op_type_base (insn))
+          return false;
+        /* ops of a nested type may be shared by several members, so only pass the reference
+           on when descending into the member that is on its path */
+        if (!member_fixed_offset_walk (ops + DDS_OP_ADR_JSR (ops[2]), target ? ref : NULL, d + 1, xcdr_version, off, found))
+          return false;
+        if (*found)
+          return true;
+        ops = dds_stream_skip_adr (insn, ops);
+        continue;
+      }
+      default:
+        return false;
+    }
+    const align_t align = dds_cdr_get_align (xcdr_version, size);
+    *off = (*off + ALIGN(align) - 1) & ~(ALIGN(align) - 1);
+    if (target)
+    {
+      *found = (d + 1 == ref->depth);
+      return *found;
+    }
+    *off += num * size;
+    ops = dds_stream_skip_adr (insn, ops);
+  }
+  return true;
+}
+
+bool dds_stream_member_fixed_offset (const uint32_t * __restrict ops, const struct dds_cdrstream_member_ref * __restrict ref, uint32_t xcdr_version, uint32_t * __restrict offset)
+{
+  bool found = false;
+  *offset = 0;
+  return member_fixed_offset_walk (ops, ref, 0, xcdr_version, offset, &found) && found;
+}
+
+struct locate_state {
+  dds_istream_t *is;
+  bool bswap;
+  uint32_t depth; /* number of entries in path */
+  const uint32_t *path[DDS_CDRSTREAM_MAX_NESTING_DEPTH]; /* ADR ops of the members we're currently in */
+  uint32_t nrefs;
+  uint32_t remaining; /* number of refs not yet located, walk stops when it reaches 0 */
+  const struct dds_cdrstream_member_ref *refs;
+  uint32_t *offs;
+};
+
+static const uint32_t *locate_members_impl (struct locate_state * __restrict st, const uint32_t * __restrict ops, bool match, bool mutable_member);
+
+static bool locate_align (dds_istream_t * __restrict is, uint32_t size)
+{
+  const align_t align = dds_cdr_get_align (is->m_xcdr_version, size);
+  const uint32_t idx = (is->m_index + ALIGN(align) - 1) & ~(ALIGN(align) - 1);
+  if (idx < is->m_index || idx > is->m_size)
+    return false;
+  is->m_index = idx;
+  return true;
+}
+
+static bool locate_get (struct locate_state * __restrict st, uint32_t size, uint32_t * __restrict v)
+{
+  dds_istream_t * const is = st->is;
+  if (!locate_align (is, size) || is->m_size - is->m_index < size)
+    return false;
+  const unsigned char *src = is->m_buffer + is->m_index;
+  switch (size)
+  {
+    case 1: *v = *src; break;
+    case 2: { uint16_t x; memcpy (&x, src, 2); *v = st->bswap ? ddsrt_bswap2u (x) : x; break; }
+    case 4: { uint32_t x; memcpy (&x, src, 4); *v = st->bswap ? ddsrt_bswap4u (x) : x; break; }
+    default: return false;
+  }
+  is->m_index += size;
+  return true;
+}
+
+static bool locate_skip_elems (dds_istream_t * __restrict is, uint32_t num, uint32_t elem_size)
+{
+  if (!locate_align (is, elem_size) || (uint64_t) num * elem_size > is->m_size - is->m_index)
+    return false;
+  is->m_index += num * elem_size;
+  return true;
+}
+
+static bool locate_skip_subtype (struct locate_state * __restrict st, uint32_t num, uint32_t insn, uint32_t subtype, const uint32_t * __restrict subops)
+{
+  switch (subtype)
+  {
+    case DDS_OP_VAL_BLN: case DDS_OP_VAL_1BY: case DDS_OP_VAL_2BY: case DDS_OP_VAL_4BY: case DDS_OP_VAL_8BY:
+      return locate_skip_elems (st->is, num, get_primitive_size (subtype));
+    case DDS_OP_VAL_ENU: case DDS_OP_VAL_BMK:
+      /* see dds_stream_extract_key_from_data_skip_subtype for the bitmask-in-union case */
+      return locate_skip_elems (st->is, num, DDS_OP_TYPE_SZ (DDS_OP (insn) == DDS_OP_JEQ4 && subtype == DDS_OP_VAL_BMK ? subops[0] : insn));
+    case DDS_OP_VAL_STR: case DDS_OP_VAL_BST:
+      for (uint32_t i = 0; i < num; i++)
+      {
+        uint32_t len;
+        if (!locate_get (st, 4, &len) || !locate_skip_elems (st->is, len, 1))
+          return false;
+      }
+      return true;
+    case DDS_OP_VAL_SEQ: case DDS_OP_VAL_BSQ: case DDS_OP_VAL_ARR: case DDS_OP_VAL_UNI: case DDS_OP_VAL_STU:
+      for (uint32_t i = 0; i < num; i++)
+        if (locate_members_impl (st, subops, false, false) == NULL)
+          return false;
+      return true;
+    case DDS_OP_VAL_EXT:
+      break;
+  }
+  return false;
+}
+
+static const uint32_t *locate_skip_sequence_or_array (struct locate_state * __restrict st, const uint32_t * __restrict ops)
+{
+  const uint32_t insn = *ops;
+  const enum dds_stream_typecode type = DDS_OP_TYPE (insn), subtype = DDS_OP_SUBTYPE (insn);
+  const uint32_t jsr_op = (type == DDS_OP_VAL_BSQ) ? 4 : 3;
+  if (is_dheader_needed (subtype, st->is->m_xcdr_version))
+  {
+    uint32_t sz;
+    if (!locate_get (st, 4, &sz) || !locate_skip_elems (st->is, sz, 1))
+      return NULL;
+  }
+  else
+  {
+    uint32_t num;
+    if (type == DDS_OP_VAL_ARR)
+      num = ops[2];
+    else if (!locate_get (st, 4, &num))
+      return NULL;
+    if (num > 0 && !locate_skip_subtype (st, num, insn, subtype, type_has_subtype_or_members (subtype) ? ops + DDS_OP_ADR_JSR (ops[jsr_op]) : NULL))
+      return NULL;
+  }
+  return (type == DDS_OP_VAL_ARR) ? skip_array_insns (insn, ops) : skip_sequence_insns (insn, ops);
+}
+
+static const uint32_t *locate_skip_union (struct locate_state * __restrict st, const uint32_t * __restrict ops)
+{
+  const uint32_t insn = *ops;
+  uint32_t disc = 0, disc_size = 0;
+  switch (DDS_OP_SUBTYPE (insn))
+  {
+    case DDS_OP_VAL_BLN: case DDS_OP_VAL_1BY: disc_size = 1; break;
+    case DDS_OP_VAL_2BY: disc_size = 2; break;
+    case DDS_OP_VAL_4BY: disc_size = 4; break;
+    case DDS_OP_VAL_ENU: disc_size = DDS_OP_TYPE_SZ (insn); break;
+    default: break;
+  }
+  if (disc_size > 0 && !locate_get (st, disc_size, &disc))
+    return NULL;
+  uint32_t const * const jeq_op = find_union_case (ops, disc);
+  if (jeq_op && !locate_skip_subtype (st, 1, jeq_op[0], DDS_JEQ_TYPE (jeq_op[0]), jeq_op + DDS_OP_ADR_JSR (jeq_op[0])))
+    return NULL;
+  return ops + DDS_OP_ADR_JMP (ops[3]);
+}
+
+static uint32_t locate_value_offset (const dds_istream_t * __restrict is, uint32_t insn)
+{
+  uint32_t size;
+  switch (DDS_OP_TYPE (insn))
+  {
+    case DDS_OP_VAL_BLN: case DDS_OP_VAL_1BY: case DDS_OP_VAL_2BY: case DDS_OP_VAL_4BY: case DDS_OP_VAL_8BY:
+      size = get_primitive_size (DDS_OP_TYPE (insn));
+      break;
+    case DDS_OP_VAL_ENU: case DDS_OP_VAL_BMK:
+      size = DDS_OP_TYPE_SZ (insn);
+      break;
+    case DDS_OP_VAL_STR: case DDS_OP_VAL_BST:
+      size = 4;
+      break;
+    default:
+      return is->m_index;
+  }
+  const align_t align = dds_cdr_get_align (is->m_xcdr_version, size);
+  return (is->m_index + ALIGN(align) - 1) & ~(ALIGN(align) - 1);
+}
+
+static const uint32_t *locate_members_adr (struct locate_state * __restrict st, uint32_t insn, const uint32_t * __restrict ops, bool match, bool mutable_member)
+{
+  if (op_type_optional (insn) && !mutable_member)
+  {
+    uint32_t present;
+    if (!locate_get (st, 1, &present))
+      return NULL;
+    if (!present)
+      return dds_stream_skip_adr (insn, ops);
+  }
+
+  bool descend = false;
+  if (match)
+  {
+    for (uint32_t i = 0; i < st->nrefs; i++)
+    {
+      const struct dds_cdrstream_member_ref *ref = &st->refs[i];
+      if (ref->depth <= st->depth || ref->path[st->depth] != ops || memcmp (ref->path, st->path, st->depth * sizeof (*st->path)) != 0)
+        continue;
+      if (ref->depth > st->depth + 1)
+        descend = true;
+      else
+      {
+        st->offs[i] = locate_value_offset (st->is, insn);
+        st->remaining--;
+      }
+    }
+  }
+
+  switch (DDS_OP_TYPE (insn))
+  {
+    case DDS_OP_VAL_BLN: case DDS_OP_VAL_1BY: case DDS_OP_VAL_2BY: case DDS_OP_VAL_4BY: case DDS_OP_VAL_8BY:
+    case DDS_OP_VAL_STR: case DDS_OP_VAL_BST: case DDS_OP_VAL_ENU: case DDS_OP_VAL_BMK:
+      if (!locate_skip_subtype (st, 1, insn, DDS_OP_TYPE (insn), NULL))
+        return NULL;
+      return dds_stream_skip_adr (insn, ops);
+    case DDS_OP_VAL_SEQ: case DDS_OP_VAL_BSQ: case DDS_OP_VAL_ARR:
+      return locate_skip_sequence_or_array (st, ops);
+    case DDS_OP_VAL_UNI:
+      return locate_skip_union (st, ops);
+    case DDS_OP_VAL_EXT: {
+      const uint32_t *jsr_ops = ops + DDS_OP_ADR_JSR (ops[2]);
+      /* base type members follow without a DHEADER of their own, see dds_stream_extract_key_from_data_adr */
+      if (op_type_base (insn) && jsr_ops[0] == DDS_OP_DLC)
+        jsr_ops++;
+      if (descend)
+      {
+        assert (st->depth < DDS_CDRSTREAM_MAX_NESTING_DEPTH);
+        st->path[st->depth++] = ops;
+      }
+      const uint32_t *ret = locate_members_impl (st, jsr_ops, descend, false);
+      if (descend)
+        st->depth--;
+      return (ret == NULL) ? NULL : dds_stream_skip_adr (insn, ops);
+    }
+    case DDS_OP_VAL_STU:
+      break;
+  }
+  return NULL;
+}
+
+static const uint32_t *locate_members_delimited (struct locate_state * __restrict st, const uint32_t * __restrict ops, bool match)
+{
+  dds_istream_t * const is = st->is;
+  uint32_t delimited_sz, insn;
+  if (!locate_get (st, 4, &delimited_sz) || delimited_sz > is->m_size - is->m_index)
+    return NULL;
+  const uint32_t delimited_offs = is->m_index;
+  ops++;
+  while (st->remaining > 0 && (insn = *ops) != DDS_OP_RTS)
+  {
+    switch (DDS_OP (insn))
+    {
+      case DDS_OP_ADR:
+        /* members beyond the end of the serialized data are absent (appendable type) */
+        if (is->m_index - delimited_offs < delimited_sz)
+          ops = locate_members_adr (st, insn, ops, match, false);
+        else
+          ops = dds_stream_skip_adr (insn, ops);
+        break;
+      case DDS_OP_JSR:
+        if (locate_members_impl (st, ops + DDS_OP_JUMP (insn), match, false) == NULL)
+          return NULL;
+        ops++;
+        break;
+      default:
+        return NULL;
+    }
+    if (ops == NULL)
+      return NULL;
+  }
+  /* the data may contain members that are not in our version of the type */
+  is->m_index = delimited_offs + delimited_sz;
+  return ops;
+}
+
+static bool locate_members_pl_member (struct locate_state * __restrict st, uint32_t m_id, const uint32_t * __restrict ops, bool match, bool * __restrict found)
+{
+  uint32_t insn, ops_csr = 0;
+  while (!*found && (insn = ops[ops_csr]) != DDS_OP_RTS)
+  {
+    const uint32_t *plm_ops = ops + ops_csr + DDS_OP_ADR_PLM (insn);
+    if (DDS_PLM_FLAGS (insn) & DDS_OP_FLAG_BASE)
+    {
+      /* skip PLC to go to first PLM from base type */
+      if (!locate_members_pl_member (st, m_id, plm_ops + 1, match, found))
+        return false;
+    }
+    else if (ops[ops_csr + 1] == m_id)
+    {
+      *found = true;
+      return locate_members_impl (st, plm_ops, match, true) != NULL;
+    }
+    ops_csr += 2;
+  }
+  return true;
+}
+
+static const uint32_t *locate_members_pl (struct locate_state * __restrict st, const uint32_t * __restrict ops, bool match)
+{
+  dds_istream_t * const is = st->is;
+  uint32_t pl_sz;
+  if (!locate_get (st, 4, &pl_sz) || pl_sz > is->m_size - is->m_index)
+    return NULL;
+  const uint32_t pl_offs = is->m_index;
+  ops++; /* skip PLC op */
+  while (st->remaining > 0 && is->m_index - pl_offs < pl_sz)
+  {
+    uint32_t em_hdr, msz;
+    if (!locate_get (st, 4, &em_hdr))
+      return NULL;
+    const uint32_t lc = EMHEADER_LENGTH_CODE (em_hdr), m_id = EMHEADER_MEMBERID (em_hdr);
+    switch (lc)
+    {
+      case LENGTH_CODE_1B: case LENGTH_CODE_2B: case LENGTH_CODE_4B: case LENGTH_CODE_8B:
+        msz = 1u << lc;
+        break;
+      case LENGTH_CODE_NEXTINT:
+        if (!locate_get (st, 4, &msz))
+          return NULL;
+        break;
+      default:
+        /* length is part of serialized data, and doesn't include its own 4 bytes */
+        if (!locate_get (st, 4, &msz) || (lc > LENGTH_CODE_ALSO_NEXTINT && msz > (UINT32_MAX >> (lc - 4))))
+          return NULL;
+        is->m_index -= 4;
+        msz = (lc > LENGTH_CODE_ALSO_NEXTINT) ? msz << (lc - 4) : msz;
+        if (msz > UINT32_MAX - 4)
+          return NULL;
+        msz += 4;
+        break;
+    }
+    if (msz > is->m_size - is->m_index)
+      return NULL;
+    const uint32_t mend = is->m_index + msz;
+    bool found = false;
+    if (!locate_members_pl_member (st, m_id, ops, match, &found))
+      return NULL;
+    is->m_index = mend;
+  }
+  while (ops[0] != DDS_OP_RTS)
+    ops += 2;
+  return ops;
+}
+
+static const uint32_t *locate_members_impl (struct locate_state * __restrict st, const uint32_t * __restrict ops, bool match, bool mutable_member)
+{
+  uint32_t insn;
+  while (ops != NULL && st->remaining > 0 && (insn = *ops) != DDS_OP_RTS)
+  {
+    switch (DDS_OP (insn))
+    {
+      case DDS_OP_ADR:
+        ops = locate_members_adr (st, insn, ops, match, mutable_member);
+        break;
+      case DDS_OP_JSR:
+        if (locate_members_impl (st, ops + DDS_OP_JUMP (insn), match, mutable_member) == NULL)
+          return NULL;
+        ops++;
+        break;
+      case DDS_OP_DLC:
+        ops = locate_members_delimited (st, ops, match);
+        break;
+      case DDS_OP_PLC:
+        ops = locate_members_pl (st, ops, match);
+        break;
+      default:
+        return NULL;
+    }
+  }
+  return ops;
+}
+
+bool dds_stream_locate_members (dds_istream_t * __restrict is, bool bswap, const uint32_t * __restrict ops, uint32_t nrefs, const struct dds_cdrstream_member_ref * __restrict refs, uint32_t * __restrict offs)
+{
+  /* path only needs to be valid up to depth, so leave it uninitialized */
+  struct locate_state st;
+  st.is = is;
+  st.bswap = bswap;
+  st.depth = 0;
+  st.nrefs = nrefs;
+  st.remaining = nrefs;
+  st.refs = refs;
+  st.offs = offs;
+  for (uint32_t i = 0; i < nrefs; i++)
+    offs[i] = DDS_CDRSTREAM_MEMBER_ABSENT;
+  return locate_members_impl (&st, ops, true, false) != NULL;
+}
+
 /*******************************************************************************************
  **
  **  Read/write of samples and keys -- i.e., DDSI payloads.
  **
  *******************************************************************************************/
 
+static void dds_stream_read_copy_plan (dds_istream_t * __restrict is, char * __restrict data, const uint32_t * __restrict ops, const struct dds_cdrstream_copy_plan * __restrict plan)
+{
+  for (uint32_t i = 0; i < plan->nsteps; i++)
+  {
+    const struct dds_cdrstream_copy_step *step = &plan->steps[i];
+    if (step->num > 0)
+      dds_is_get_bytes (is, data + step->data_offs, step->num, get_primitive_size (step->type));
+    else
+      (void) dds_stream_read_adr (ops[step->ops_offs], is, data + step->data_offs, ops + step->ops_offs, false);
+  }
+}
+
 void dds_stream_read_sample (dds_istream_t * __restrict is, void * __restrict data, const struct dds_cdrstream_desc * __restrict desc)
 {
   size_t opt_size = is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_1 ? desc->opt_size_xcdr1 : desc->opt_size_xcdr2;
@@ -3564,6 +4275,12 @@ void dds_stream_read_sample (dds_istream_t * __restrict is, void * __restrict da
        potential out-of-bounds read */
     dds_is_get_bytes (is, data, (uint32_t) opt_size, 1);
   }
+  else if (desc->serializers && desc->serializers->read)
+  {
+    /* types containing unions have no generated serializers */
+    assert (!(desc->flagset & DDS_TOPIC_CONTAINS_UNION));
+    desc->serializers->read (is, data);
+  }
   else
   {
     if (desc->flagset & DDS_TOPIC_CONTAINS_UNION)
@@ -3577,7 +4294,10 @@ void dds_stream_read_sample (dds_istream_t * __restrict is, void * __restrict da
       dds_stream_free_sample (data, desc->ops.ops);
       memset (data, 0, desc->size);
     }
-    (void) dds_stream_read_impl (is, data, desc->ops.ops, false);
+    if (desc->copy_plan)
+      dds_stream_read_copy_plan (is, data, desc->ops.ops, desc->copy_plan);
+    else
+      (void) dds_stream_read_impl (is, data, desc->ops.ops, false);
   }
 }
 
@@ -3588,7 +4308,7 @@ static void dds_stream_read_key_impl (dds_istream_t * __restrict is, char * __re
   assert (insn_key_ok_p (insn));
 
   if (op_type_external (insn))
-    dds_stream_alloc_external (ops, insn, &dst);
+    dds_stream_alloc_external (is, ops, insn, &dst);
 
   switch (DDS_OP_TYPE (insn))
   {
@@ -4347,6 +5067,8 @@ void dds_cdrstream_desc_from_topic_desc (struct dds_cdrstream_desc *desc, const
       desc->keys.keys[i].idx = topic_desc->m_keys[i].m_idx;
     }
   }
+  if (topic_desc->m_flagset & DDS_TOPIC_SERIALIZERS)
+    desc->serializers = topic_desc->serializers;
 }
 
 void dds_cdrstream_desc_fini (struct dds_cdrstream_desc *desc)
@@ -4354,5 +5076,78 @@ void dds_cdrstream_desc_fini (struct dds_cdrstream_desc *desc)
   if (desc->keys.nkeys > 0 && desc->keys.keys != NULL)
     ddsrt_free (desc->keys.keys);
   ddsrt_free (desc->ops.ops);
+  dds_stream_free_copy_plan (desc->copy_plan);
 }
 
+
+/* Out-of-line support for the type-specific serializers generated by idlc, see
+   dds_cdrstream_gen.h */
+
+void dds_stream_gen_grow (dds_ostream_t * __restrict os, uint32_t size)
+{
+  dds_ostream_grow (os, size);
+}
+
+char *dds_stream_gen_read_string (dds_istream_t * __restrict is, char * __restrict str)
+{
+  return dds_stream_reuse_string (is, str);
+}
+
+void dds_stream_gen_read_bstring (dds_istream_t * __restrict is, char * __restrict str, uint32_t size)
+{
+  (void) dds_stream_reuse_string_bound (is, str, size, false);
+}
+
+void dds_stream_gen_skip_string (dds_istream_t * __restrict is)
+{
+  dds_stream_skip_string (is);
+}
+
+void dds_stream_gen_realloc_sequence (dds_istream_t * __restrict is, dds_sequence_t * __restrict seq, uint32_t num, uint32_t elem_size, bool init)
+{
+  realloc_sequence_buffer_if_needed (is, seq, num, elem_size, init);
+  seq->_length = (num <= seq->_maximum) ? num : seq->_maximum;
+}
+
+bool dds_stream_gen_normalize_uint32 (uint32_t * __restrict val, char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap)
+{
+  return read_and_normalize_uint32 (val, data, off, size, bswap);
+}
+
+bool dds_stream_gen_normalize_dheader (uint32_t * __restrict size1, char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap)
+{
+  if (!read_and_normalize_uint32 (size1, data, off, size, bswap))
+    return false;
+  if (*size1 > size - *off)
+    return normalize_error_bool ();
+  *size1 += *off;
+  return true;
+}
+
+bool dds_stream_gen_normalize_string (char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap, size_t maxsz)
+{
+  return normalize_string (data, off, size, bswap, maxsz);
+}
+
+bool dds_stream_gen_normalize_primarray (char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap, uint32_t num, uint32_t elem_size, uint32_t xcdr_version)
+{
+  switch (elem_size)
+  {
+    case 1: return normalize_primarray (data, off, size, bswap, num, DDS_OP_VAL_1BY, xcdr_version);
+    case 2: return normalize_primarray (data, off, size, bswap, num, DDS_OP_VAL_2BY, xcdr_version);
+    case 4: return normalize_primarray (data, off, size, bswap, num, DDS_OP_VAL_4BY, xcdr_version);
+    case 8: return normalize_primarray (data, off, size, bswap, num, DDS_OP_VAL_8BY, xcdr_version);
+  }
+  abort ();
+  return false;
+}
+
+bool dds_stream_gen_normalize_enumarray (char * __restrict data, uint32_t * __restrict off, uint32_t size, bool bswap, uint32_t enum_sz, uint32_t num, uint32_t max)
+{
+  return normalize_enumarray (data, off, size, bswap, enum_sz, num, max);
+}
+
+bool dds_stream_gen_normalize_error (void)
+{
+  return normalize_error_bool ();
+}
@@ -18,7 +18,7 @@ static void dds_stream_write_keyBO_impl (DDS_OSTREAM_T * __restrict os, const ui
   void *addr = (char *) src + ops[1];
 
   if (op_type_external (insn))
-    dds_stream_alloc_external (ops, insn, &addr);
+    dds_stream_alloc_external (NULL, ops, insn, &addr);
 
   switch (DDS_OP_TYPE (insn))
   {
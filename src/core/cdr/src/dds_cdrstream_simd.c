@@ -0,0 +1,499 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include <assert.h>
+#include <string.h>
+
+#include "dds/ddsrt/atomics.h"
+#include "dds/ddsrt/bswap.h"
+#include "dds__cdrstream_simd.h"
+
+#if defined __x86_64__ || defined _M_X64 || (defined __i386__ && defined __SSE2__)
+#define HAVE_SSE2 1
+#include <emmintrin.h>
+#if defined __GNUC__ || defined __clang__
+/* AVX2 kernels are compiled for the AVX2 target and only used if the CPU
+   supports it, so the library itself still runs on any x86-64 */
+#define HAVE_AVX2 1
+#define TARGET_AVX2 __attribute__ ((target ("avx2")))
+#include <immintrin.h>
+#endif
+#elif defined __aarch64__ || defined _M_ARM64
+#define HAVE_NEON 1
+#include <arm_neon.h>
+#endif
+
+/* Scalar versions, used for the tail of the SIMD kernels and on platforms
+   without any SIMD support. The elements are accessed using memcpy because
+   the data need not be aligned to the element size */
+
+static void swap_copy_scalar_impl (char *dst, const char *src, uint32_t size, uint32_t num)
+{
+  switch (size)
+  {
+    case 1:
+      if (dst != src)
+        memcpy (dst, src, num);
+      break;
+    case 2:
+      for (uint32_t i = 0; i < num; i++)
+      {
+        uint16_t x;
+        memcpy (&x, src + 2 * i, sizeof (x));
+        x = ddsrt_bswap2u (x);
+        memcpy (dst + 2 * i, &x, sizeof (x));
+      }
+      break;
+    case 4:
+      for (uint32_t i = 0; i < num; i++)
+      {
+        uint32_t x;
+        memcpy (&x, src + 4 * i, sizeof (x));
+        x = ddsrt_bswap4u (x);
+        memcpy (dst + 4 * i, &x, sizeof (x));
+      }
+      break;
+    case 8:
+      for (uint32_t i = 0; i < num; i++)
+      {
+        uint64_t x;
+        memcpy (&x, src + 8 * i, sizeof (x));
+        x = ddsrt_bswap8u (x);
+        memcpy (dst + 8 * i, &x, sizeof (x));
+      }
+      break;
+  }
+}
+
+static bool check_max_scalar_impl (char *buf, uint32_t size, uint32_t num, uint32_t max, bool bswap)
+{
+  switch (size)
+  {
+    case 1:
+      for (uint32_t i = 0; i < num; i++)
+        if ((uint8_t) buf[i] > max)
+          return false;
+      break;
+    case 2:
+      for (uint32_t i = 0; i < num; i++)
+      {
+        uint16_t x;
+        memcpy (&x, buf + 2 * i, sizeof (x));
+        if (bswap)
+        {
+          x = ddsrt_bswap2u (x);
+          memcpy (buf + 2 * i, &x, sizeof (x));
+        }
+        if (x > max)
+          return false;
+      }
+      break;
+    case 4:
+      for (uint32_t i = 0; i < num; i++)
+      {
+        uint32_t x;
+        memcpy (&x, buf + 4 * i, sizeof (x));
+        if (bswap)
+        {
+          x = ddsrt_bswap4u (x);
+          memcpy (buf + 4 * i, &x, sizeof (x));
+        }
+        if (x > max)
+          return false;
+      }
+      break;
+    default:
+      assert (0);
+      return false;
+  }
+  return true;
+}
+
+static void swap_scalar (void * __restrict buf, uint32_t size, uint32_t num)
+{
+  swap_copy_scalar_impl (buf, buf, size, num);
+}
+
+static void swap_copy_scalar (void * __restrict dst, const void * __restrict src, uint32_t size, uint32_t num)
+{
+  swap_copy_scalar_impl (dst, src, size, num);
+}
+
+static bool check_max_scalar (void * __restrict buf, uint32_t size, uint32_t num, uint32_t max, bool bswap)
+{
+  return check_max_scalar_impl (buf, size, num, max, bswap);
+}
+
+static const struct dds_stream_simd_ops simd_ops_scalar = {
+  .level = DDS_STREAM_SIMD_SCALAR,
+  .swap = swap_scalar,
+  .swap_copy = swap_copy_scalar,
+  .check_max = check_max_scalar
+};
+
+/* The SIMD kernels process the data in blocks of one vector, then hand the
+   remainder to the scalar versions. Byte-swapping is done in place when dst
+   and src are the same. */
+
+#define SWAP_BLOCKS(vec_t, vsize, load, store, bswap) \
+  for (; i + (vsize) <= n; i += (vsize)) \
+    store ((vec_t *) (dst + i), bswap (load ((const vec_t *) (src + i))))
+
+#if HAVE_SSE2
+
+static inline __m128i sse2_bswap16 (__m128i v)
+{
+  return _mm_or_si128 (_mm_slli_epi16 (v, 8), _mm_srli_epi16 (v, 8));
+}
+
+static inline __m128i sse2_bswap32 (__m128i v)
+{
+  v = _mm_shufflelo_epi16 (v, _MM_SHUFFLE (2, 3, 0, 1));
+  v = _mm_shufflehi_epi16 (v, _MM_SHUFFLE (2, 3, 0, 1));
+  return sse2_bswap16 (v);
+}
+
+static inline __m128i sse2_bswap64 (__m128i v)
+{
+  v = _mm_shufflelo_epi16 (v, _MM_SHUFFLE (0, 1, 2, 3));
+  v = _mm_shufflehi_epi16 (v, _MM_SHUFFLE (0, 1, 2, 3));
+  return sse2_bswap16 (v);
+}
+
+static void swap_copy_sse2_impl (char *dst, const char *src, uint32_t size, uint32_t num)
+{
+  const uint32_t n = size * num;
+  uint32_t i = 0;
+  switch (size)
+  {
+    case 2: SWAP_BLOCKS (__m128i, 16, _mm_loadu_si128, _mm_storeu_si128, sse2_bswap16); break;
+    case 4: SWAP_BLOCKS (__m128i, 16, _mm_loadu_si128, _mm_storeu_si128, sse2_bswap32); break;
+    case 8: SWAP_BLOCKS (__m128i, 16, _mm_loadu_si128, _mm_storeu_si128, sse2_bswap64); break;
+  }
+  swap_copy_scalar_impl (dst + i, src + i, size, (n - i) / size);
+}
+
+static void swap_sse2 (void * __restrict buf, uint32_t size, uint32_t num)
+{
+  swap_copy_sse2_impl (buf, buf, size, num);
+}
+
+static void swap_copy_sse2 (void * __restrict dst, const void * __restrict src, uint32_t size, uint32_t num)
+{
+  swap_copy_sse2_impl (dst, src, size, num);
+}
+
+static bool check_max_sse2 (void * __restrict vbuf, uint32_t size, uint32_t num, uint32_t max, bool bswap)
+{
+  char *buf = vbuf;
+  const uint32_t n = size * num;
+  uint32_t i = 0;
+  /* Accumulates a non-zero value in some lane for any element > max; SSE2 has
+     no unsigned 32-bit compare, so those are compared as signed after flipping
+     the sign bit */
+  __m128i acc = _mm_setzero_si128 ();
+  switch (size)
+  {
+    case 1: {
+      const __m128i vmax = _mm_set1_epi8 ((char) (max > UINT8_MAX ? UINT8_MAX : max));
+      for (; i + 16 <= n; i += 16)
+        acc = _mm_or_si128 (acc, _mm_subs_epu8 (_mm_loadu_si128 ((const __m128i *) (buf + i)), vmax));
+      break;
+    }
+    case 2: {
+      const __m128i vmax = _mm_set1_epi16 ((short) (max > UINT16_MAX ? UINT16_MAX : max));
+      for (; i + 16 <= n; i += 16)
+      {
+        __m128i v = _mm_loadu_si128 ((const __m128i *) (buf + i));
+        if (bswap)
+        {
+          v = sse2_bswap16 (v);
+          _mm_storeu_si128 ((__m128i *) (buf + i), v);
+        }
+        acc = _mm_or_si128 (acc, _mm_subs_epu16 (v, vmax));
+      }
+      break;
+    }
+    case 4: {
+      const __m128i sign = _mm_set1_epi32 (INT32_MIN);
+      const __m128i vmax = _mm_xor_si128 (_mm_set1_epi32 ((int32_t) max), sign);
+      for (; i + 16 <= n; i += 16)
+      {
+        __m128i v = _mm_loadu_si128 ((const __m128i *) (buf + i));
+        if (bswap)
+        {
+          v = sse2_bswap32 (v);
+          _mm_storeu_si128 ((__m128i *) (buf + i), v);
+        }
+        acc = _mm_or_si128 (acc, _mm_cmpgt_epi32 (_mm_xor_si128 (v, sign), vmax));
+      }
+      break;
+    }
+    default:
+      assert (0);
+      return false;
+  }
+  if (_mm_movemask_epi8 (_mm_cmpeq_epi8 (acc, _mm_setzero_si128 ())) != 0xffff)
+    return false;
+  return check_max_scalar_impl (buf + i, size, (n - i) / size, max, bswap);
+}
+
+static const struct dds_stream_simd_ops simd_ops_sse2 = {
+  .level = DDS_STREAM_SIMD_SSE2,
+  .swap = swap_sse2,
+  .swap_copy = swap_copy_sse2,
+  .check_max = check_max_sse2
+};
+
+#endif /* HAVE_SSE2 */
+
+#if HAVE_AVX2
+
+/* Byte shuffles stay within 128-bit lanes, which is fine because elements
+   never cross a lane */
+TARGET_AVX2 static inline __m256i avx2_bswap16 (__m256i v)
+{
+  const __m256i m = _mm256_setr_epi8 (1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  return _mm256_shuffle_epi8 (v, m);
+}
+
+TARGET_AVX2 static inline __m256i avx2_bswap32 (__m256i v)
+{
+  const __m256i m = _mm256_setr_epi8 (3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  return _mm256_shuffle_epi8 (v, m);
+}
+
+TARGET_AVX2 static inline __m256i avx2_bswap64 (__m256i v)
+{
+  const __m256i m = _mm256_setr_epi8 (7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+  return _mm256_shuffle_epi8 (v, m);
+}
+
+TARGET_AVX2 static void swap_copy_avx2_impl (char *dst, const char *src, uint32_t size, uint32_t num)
+{
+  const uint32_t n = size * num;
+  uint32_t i = 0;
+  switch (size)
+  {
+    case 2: SWAP_BLOCKS (__m256i, 32, _mm256_loadu_si256, _mm256_storeu_si256, avx2_bswap16); break;
+    case 4: SWAP_BLOCKS (__m256i, 32, _mm256_loadu_si256, _mm256_storeu_si256, avx2_bswap32); break;
+    case 8: SWAP_BLOCKS (__m256i, 32, _mm256_loadu_si256, _mm256_storeu_si256, avx2_bswap64); break;
+  }
+  swap_copy_scalar_impl (dst + i, src + i, size, (n - i) / size);
+}
+
+static void swap_avx2 (void * __restrict buf, uint32_t size, uint32_t num)
+{
+  swap_copy_avx2_impl (buf, buf, size, num);
+}
+
+static void swap_copy_avx2 (void * __restrict dst, const void * __restrict src, uint32_t size, uint32_t num)
+{
+  swap_copy_avx2_impl (dst, src, size, num);
+}
+
+TARGET_AVX2 static bool check_max_avx2 (void * __restrict vbuf, uint32_t size, uint32_t num, uint32_t max, bool bswap)
+{
+  char *buf = vbuf;
+  const uint32_t n = size * num;
+  uint32_t i = 0;
+  /* min (v, max) differs from v for any element > max */
+  __m256i acc = _mm256_setzero_si256 ();
+  switch (size)
+  {
+    case 1: {
+      const __m256i vmax = _mm256_set1_epi8 ((char) (max > UINT8_MAX ? UINT8_MAX : max));
+      for (; i + 32 <= n; i += 32)
+      {
+        const __m256i v = _mm256_loadu_si256 ((const __m256i *) (buf + i));
+        acc = _mm256_or_si256 (acc, _mm256_xor_si256 (_mm256_min_epu8 (v, vmax), v));
+      }
+      break;
+    }
+    case 2: {
+      const __m256i vmax = _mm256_set1_epi16 ((short) (max > UINT16_MAX ? UINT16_MAX : max));
+      for (; i + 32 <= n; i += 32)
+      {
+        __m256i v = _mm256_loadu_si256 ((const __m256i *) (buf + i));
+        if (bswap)
+        {
+          v = avx2_bswap16 (v);
+          _mm256_storeu_si256 ((__m256i *) (buf + i), v);
+        }
+        acc = _mm256_or_si256 (acc, _mm256_xor_si256 (_mm256_min_epu16 (v, vmax), v));
+      }
+      break;
+    }
+    case 4: {
+      const __m256i vmax = _mm256_set1_epi32 ((int32_t) max);
+      for (; i + 32 <= n; i += 32)
+      {
+        __m256i v = _mm256_loadu_si256 ((const __m256i *) (buf + i));
+        if (bswap)
+        {
+          v = avx2_bswap32 (v);
+          _mm256_storeu_si256 ((__m256i *) (buf + i), v);
+        }
+        acc = _mm256_or_si256 (acc, _mm256_xor_si256 (_mm256_min_epu32 (v, vmax), v));
+      }
+      break;
+    }
+    default:
+      assert (0);
+      return false;
+  }
+  if (!_mm256_testz_si256 (acc, acc))
+    return false;
+  return check_max_scalar_impl (buf + i, size, (n - i) / size, max, bswap);
+}
+
+static const struct dds_stream_simd_ops simd_ops_avx2 = {
+  .level = DDS_STREAM_SIMD_AVX2,
+  .swap = swap_avx2,
+  .swap_copy = swap_copy_avx2,
+  .check_max = check_max_avx2
+};
+
+#endif /* HAVE_AVX2 */
+
+#if HAVE_NEON
+
+static inline uint8x16_t neon_load (const uint8_t *p) { return vld1q_u8 (p); }
+static inline void neon_store (uint8_t *p, uint8x16_t v) { vst1q_u8 (p, v); }
+
+static void swap_copy_neon_impl (char *dst, const char *src, uint32_t size, uint32_t num)
+{
+  const uint32_t n = size * num;
+  uint32_t i = 0;
+  switch (size)
+  {
+    case 2: SWAP_BLOCKS (uint8_t, 16, neon_load, neon_store, vrev16q_u8); break;
+    case 4: SWAP_BLOCKS (uint8_t, 16, neon_load, neon_store, vrev32q_u8); break;
+    case 8: SWAP_BLOCKS (uint8_t, 16, neon_load, neon_store, vrev64q_u8); break;
+  }
+  swap_copy_scalar_impl (dst + i, src + i, size, (n - i) / size);
+}
+
+static void swap_neon (void * __restrict buf, uint32_t size, uint32_t num)
+{
+  swap_copy_neon_impl (buf, buf, size, num);
+}
+
+static void swap_copy_neon (void * __restrict dst, const void * __restrict src, uint32_t size, uint32_t num)
+{
+  swap_copy_neon_impl (dst, src, size, num);
+}
+
+static bool check_max_neon (void * __restrict vbuf, uint32_t size, uint32_t num, uint32_t max, bool bswap)
+{
+  char *buf = vbuf;
+  const uint32_t n = size * num;
+  uint32_t i = 0;
+  uint32x4_t acc = vdupq_n_u32 (0);
+  switch (size)
+  {
+    case 1: {
+      const uint8x16_t vmax = vdupq_n_u8 ((uint8_t) (max > UINT8_MAX ? UINT8_MAX : max));
+      for (; i + 16 <= n; i += 16)
+        acc = vorrq_u32 (acc, vreinterpretq_u32_u8 (vcgtq_u8 (vld1q_u8 ((const uint8_t *) (buf + i)), vmax)));
+      break;
+    }
+    case 2: {
+      const uint16x8_t vmax = vdupq_n_u16 ((uint16_t) (max > UINT16_MAX ? UINT16_MAX : max));
+      for (; i + 16 <= n; i += 16)
+      {
+        uint8x16_t v = vld1q_u8 ((const uint8_t *) (buf + i));
+        if (bswap)
+        {
+          v = vrev16q_u8 (v);
+          vst1q_u8 ((uint8_t *) (buf + i), v);
+        }
+        acc = vorrq_u32 (acc, vreinterpretq_u32_u16 (vcgtq_u16 (vreinterpretq_u16_u8 (v), vmax)));
+      }
+      break;
+    }
+    case 4: {
+      const uint32x4_t vmax = vdupq_n_u32 (max);
+      for (; i + 16 <= n; i += 16)
+      {
+        uint8x16_t v = vld1q_u8 ((const uint8_t *) (buf + i));
+        if (bswap)
+        {
+          v = vrev32q_u8 (v);
+          vst1q_u8 ((uint8_t *) (buf + i), v);
+        }
+        acc = vorrq_u32 (acc, vcgtq_u32 (vreinterpretq_u32_u8 (v), vmax));
+      }
+      break;
+    }
+    default:
+      assert (0);
+      return false;
+  }
+  if (vmaxvq_u32 (acc) != 0)
+    return false;
+  return check_max_scalar_impl (buf + i, size, (n - i) / size, max, bswap);
+}
+
+static const struct dds_stream_simd_ops simd_ops_neon = {
+  .level = DDS_STREAM_SIMD_NEON,
+  .swap = swap_neon,
+  .swap_copy = swap_copy_neon,
+  .check_max = check_max_neon
+};
+
+#endif /* HAVE_NEON */
+
+const struct dds_stream_simd_ops *dds_stream_simd_get_ops (enum dds_stream_simd_level level)
+{
+  switch (level)
+  {
+    case DDS_STREAM_SIMD_SCALAR:
+      return &simd_ops_scalar;
+    case DDS_STREAM_SIMD_SSE2:
+#if HAVE_SSE2
+      return &simd_ops_sse2;
+#else
+      return NULL;
+#endif
+    case DDS_STREAM_SIMD_AVX2:
+#if HAVE_AVX2
+      __builtin_cpu_init ();
+      return __builtin_cpu_supports ("avx2") ? &simd_ops_avx2 : NULL;
+#else
+      return NULL;
+#endif
+    case DDS_STREAM_SIMD_NEON:
+#if HAVE_NEON
+      return &simd_ops_neon;
+#else
+      return NULL;
+#endif
+  }
+  return NULL;
+}
+
+const struct dds_stream_simd_ops *dds_stream_simd (void)
+{
+  static ddsrt_atomic_voidp_t simd_ops = DDSRT_ATOMIC_VOIDP_INIT (NULL);
+  const struct dds_stream_simd_ops *ops;
+  if ((ops = ddsrt_atomic_ldvoidp (&simd_ops)) == NULL)
+  {
+    /* Selecting the kernels is idempotent, so a race is harmless */
+    static const enum dds_stream_simd_level levels[] = {
+      DDS_STREAM_SIMD_AVX2, DDS_STREAM_SIMD_SSE2, DDS_STREAM_SIMD_NEON, DDS_STREAM_SIMD_SCALAR
+    };
+    for (size_t i = 0; ops == NULL && i < sizeof (levels) / sizeof (levels[0]); i++)
+      ops = dds_stream_simd_get_ops (levels[i]);
+    ddsrt_atomic_stvoidp (&simd_ops, (void *) ops);
+  }
+  return ops;
+}
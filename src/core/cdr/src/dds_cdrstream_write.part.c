@@ -625,6 +625,25 @@ static const uint32_t *dds_stream_write_implBO (DDS_OSTREAM_T * __restrict os, c
   return ops;
 }
 
+static bool dds_stream_write_copy_planBO (DDS_OSTREAM_T * __restrict os, const char * __restrict data, const uint32_t * __restrict ops, const struct dds_cdrstream_copy_plan * __restrict plan)
+{
+  const uint32_t xcdrv = ((struct dds_ostream *)os)->m_xcdr_version;
+  for (uint32_t i = 0; i < plan->nsteps; i++)
+  {
+    const struct dds_cdrstream_copy_step *step = &plan->steps[i];
+    if (step->num > 0)
+    {
+      const uint32_t elem_size = get_primitive_size (step->type);
+      void *dst;
+      dds_os_put_bytes_aligned ((struct dds_ostream *)os, data + step->data_offs, step->num, elem_size, dds_cdr_get_align (xcdrv, elem_size), &dst);
+      dds_stream_to_BO_insitu (dst, elem_size, step->num);
+    }
+    else if (!dds_stream_write_adrBO (ops[step->ops_offs], os, data + step->data_offs, ops + step->ops_offs, false))
+      return false;
+  }
+  return true;
+}
+
 const uint32_t *dds_stream_writeBO (DDS_OSTREAM_T * __restrict os, const char * __restrict data, const uint32_t * __restrict ops)
 {
   return dds_stream_write_implBO (os, data, ops, false);
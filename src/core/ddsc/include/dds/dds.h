@@ -1755,6 +1755,37 @@ dds_get_topic_filter_extended (
   dds_entity_t topic,
   struct dds_topic_filter *filter);
 
+/**
+ * @brief Sets a content filter expression on a topic.
+ * @ingroup topic_filter
+ * @component topic
+ * @warning Unstable API
+ *
+ * The expression uses the SQL subset of the DDS specification for content-filtered topics:
+ * comparisons of fields (named using '.' for nested members) with literals, parameters
+ * (%0 .. %99) or other fields using =, <>, <, <=, >, >=, LIKE and BETWEEN, combined with
+ * AND, OR, NOT and parentheses.  Enumerated values are written as quoted labels.
+ *
+ * The expression is compiled against the type and evaluated on the serialized data, so
+ * samples it rejects are never deserialized.  It is applied before a filter function set
+ * with @ref dds_set_topic_filter_extended, a sample must pass both to be accepted.
+ *
+ * @param[in]  topic       The topic on which the content filter is set.
+ * @param[in]  expression  The filter expression, or NULL to remove it.
+ * @param[in]  nparams     The number of parameters.
+ * @param[in]  params      The parameter values (may be NULL if nparams is 0).
+ *
+ * @retval DDS_RETCODE_OK  Filter set successfully
+ * @retval DDS_RETCODE_BAD_PARAMETER  The topic handle is invalid, or the expression is invalid for the type
+ * @retval DDS_RETCODE_UNSUPPORTED  The type has no type information or uses unsupported fields
+ */
+DDS_EXPORT dds_return_t
+dds_set_topic_filter_expression (
+  dds_entity_t topic,
+  const char *expression,
+  uint32_t nparams,
+  const char * const *params);
+
 /**
  * @defgroup subscriber (Subscriber)
  * @ingroup subscription
@@ -3706,6 +3737,163 @@ dds_takecdr(
   dds_sample_info_t *si,
   uint32_t mask);
 
+/**
+ * @brief Arena holding a batch of samples taken with @ref dds_take_arena
+ * @ingroup reading
+ */
+typedef struct dds_sample_arena dds_sample_arena_t;
+
+/**
+ * @brief Create an arena for batches of samples
+ * @ingroup reading
+ * @component read_data
+ *
+ * The arena provides the memory for the samples taken with @ref dds_take_arena and for
+ * everything they reference (strings, sequences, external members). It allocates memory
+ * in chunks and all samples in it are released together by resetting or deleting the
+ * arena.
+ *
+ * @param[in]  chunk_size Size of the chunks in bytes, 0 selects a default size. Larger
+ *                        chunks are allocated for samples that do not fit in one.
+ *
+ * @returns A pointer to the new arena.
+ */
+DDS_EXPORT dds_sample_arena_t *
+dds_create_sample_arena(size_t chunk_size);
+
+/**
+ * @brief Release all samples in an arena
+ * @ingroup reading
+ * @component read_data
+ *
+ * All samples taken into the arena become invalid. The memory is retained for reuse by
+ * subsequent calls to @ref dds_take_arena.
+ *
+ * @param[in]  arena The arena to reset, may be NULL.
+ */
+DDS_EXPORT void
+dds_reset_sample_arena(dds_sample_arena_t *arena);
+
+/**
+ * @brief Delete an arena and release all samples in it
+ * @ingroup reading
+ * @component read_data
+ *
+ * @param[in]  arena The arena to delete, may be NULL.
+ */
+DDS_EXPORT void
+dds_delete_sample_arena(dds_sample_arena_t *arena);
+
+/**
+ * @brief Take a batch of samples from a reader into an arena
+ * @ingroup reading
+ * @component read_data
+ *
+ * This operation takes samples like @ref dds_take_mask, but instead of deserializing
+ * them into samples provided by the application or loaned from the reader, it allocates
+ * the samples and all the memory they reference from the arena. There are no further
+ * allocations and the samples must not be freed individually: they remain valid until
+ * the arena is reset or deleted. Multiple batches may be taken into the same arena.
+ *
+ * This is only supported for readers of topics created using a topic descriptor.
+ *
+ * @param[in]  reader The reader entity.
+ * @param[out] buf An array of at least maxs pointers that on return point to the samples
+ *                 in the arena.
+ * @param[out] si Pointer to an array of @ref dds_sample_info_t returned for each data value.
+ * @param[in]  maxs Maximum number of samples to take.
+ * @param[in]  mask Filter the data based on dds_sample_state_t|dds_view_state_t|dds_instance_state_t.
+ * @param[in]  arena The arena that receives the samples.
+ *
+ * @returns A dds_return_t with the number of samples taken or an error code.
+ *
+ * @retval >=0
+ *             Number of samples taken.
+ * @retval DDS_RETCODE_BAD_PARAMETER
+ *             One of the given arguments is not valid.
+ * @retval DDS_RETCODE_ILLEGAL_OPERATION
+ *             The operation is invoked on an inappropriate object.
+ * @retval DDS_RETCODE_UNSUPPORTED
+ *             The reader's type does not support deserializing into an arena.
+ * @retval DDS_RETCODE_ERROR
+ *             None of the samples taken could be deserialized.  Samples that can't be
+ *             deserialized are dropped, if only some of them fail the others are returned.
+ * @retval DDS_RETCODE_ALREADY_DELETED
+ *             The entity has already been deleted.
+ */
+DDS_EXPORT dds_return_t
+dds_take_arena(
+  dds_entity_t reader,
+  void **buf,
+  dds_sample_info_t *si,
+  uint32_t maxs,
+  uint32_t mask,
+  dds_sample_arena_t *arena);
+
+/**
+ * @brief Take samples from a stream reader
+ * @ingroup reading
+ * @component read_data
+ *
+ * A stream reader, created with the reader stream QoS policy (see @ref
+ * dds_qset_reader_stream), keeps the received samples in a ring and this operation
+ * removes the oldest samples from it and deserializes them into the samples provided
+ * by the application, without producing sample info. As all samples of a stream
+ * reader are valid data of the one instance of a keyless topic, the sample info would
+ * carry little information anyway.
+ *
+ * @param[in]  reader The stream reader entity.
+ * @param[in,out] buf An array of at least maxs pointers to initialized samples, on
+ *                 return the first samples contain the data taken.
+ * @param[in]  maxs Maximum number of samples to take.
+ *
+ * @returns A dds_return_t with the number of samples taken or an error code.
+ *
+ * @retval >=0
+ *             Number of samples taken.
+ * @retval DDS_RETCODE_BAD_PARAMETER
+ *             One of the given arguments is not valid.
+ * @retval DDS_RETCODE_ILLEGAL_OPERATION
+ *             The operation is invoked on an entity that is not a stream reader.
+ * @retval DDS_RETCODE_ALREADY_DELETED
+ *             The entity has already been deleted.
+ */
+DDS_EXPORT dds_return_t
+dds_take_stream(
+  dds_entity_t reader,
+  void **buf,
+  uint32_t maxs);
+
+/**
+ * @brief Take serialized samples from a stream reader
+ * @ingroup reading
+ * @component read_data
+ *
+ * This operation is the same as @ref dds_take_stream, except that it returns the
+ * references to the received @ref ddsi_serdata structures. The caller must release
+ * them using ddsi_serdata_unref.
+ *
+ * @param[in]  reader The stream reader entity.
+ * @param[out] buf An array of at least maxs pointers to @ref ddsi_serdata structures.
+ * @param[in]  maxs Maximum number of samples to take.
+ *
+ * @returns A dds_return_t with the number of samples taken or an error code.
+ *
+ * @retval >=0
+ *             Number of samples taken.
+ * @retval DDS_RETCODE_BAD_PARAMETER
+ *             One of the given arguments is not valid.
+ * @retval DDS_RETCODE_ILLEGAL_OPERATION
+ *             The operation is invoked on an entity that is not a stream reader.
+ * @retval DDS_RETCODE_ALREADY_DELETED
+ *             The entity has already been deleted.
+ */
+DDS_EXPORT dds_return_t
+dds_takecdr_stream(
+  dds_entity_t reader,
+  struct ddsi_serdata **buf,
+  uint32_t maxs);
+
 /**
  * @brief Access the collection of serialized data values (of same type) and
  *        sample info from the data reader, readcondition or querycondition
@@ -612,6 +612,13 @@ enum dds_stream_typecode_subtype {
  */
 #define DDS_TOPIC_RESTRICT_DATA_REPRESENTATION  (1u << 7)
 
+/**
+ * @anchor DDS_TOPIC_SERIALIZERS
+ * @ingroup topic_flags
+ * @brief Set if the topic descriptor references type-specific serialization functions
+ */
+#define DDS_TOPIC_SERIALIZERS                   (1u << 8)
+
 /**
  * @anchor DDS_FIXED_KEY_MAX_SIZE
  * @ingroup topic_flags
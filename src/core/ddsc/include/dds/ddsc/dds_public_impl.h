@@ -146,6 +146,28 @@ struct dds_type_meta_ser
  */
 #define DDS_DATA_REPRESENTATION_RESTRICT_DEFAULT  (DDS_DATA_REPRESENTATION_FLAG_XCDR1 | DDS_DATA_REPRESENTATION_FLAG_XCDR2)
 
+struct dds_istream;
+struct dds_ostream;
+
+/**
+ * @brief Type-specific (de)serialization functions
+ * @ingroup topic_definition
+ * @warning Unstable/Private API
+ * Functions generated by the IDL compiler that serialize, deserialize, normalize and
+ * extract the key for one particular type, with the same behaviour as the interpreter
+ * of the marshalling meta data in the topic descriptor.  The serializer uses them in
+ * preference to interpreting the meta data, any of them may be a null pointer.
+ */
+typedef struct dds_topic_serializers
+{
+  bool (*write) (struct dds_ostream *os, const void *sample); /**< serialize a sample in native byte order */
+  void (*read) (struct dds_istream *is, void *sample); /**< deserialize native byte order data into a sample */
+  bool (*normalize) (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version); /**< validate data and convert it to native byte order */
+  void (*write_key) (struct dds_ostream *os, const void *sample); /**< serialize the key fields of a sample in native byte order */
+  bool (*extract_key_from_data) (struct dds_istream *is, struct dds_ostream *os); /**< extract the XCDR2 key from normalized data */
+}
+dds_topic_serializers_t;
+
 /**
  * @brief Topic Descriptor
  * @ingroup topic_definition
@@ -169,6 +191,7 @@ typedef struct dds_topic_descriptor
                                                    only present if flag DDS_TOPIC_XTYPES_METADATA is set */
   const uint32_t restrict_data_representation; /**< restrictions on the data representations allowed for the top-level type for this topic,
                                            only present if flag DDS_TOPIC_RESTRICT_DATA_REPRESENTATION */
+  const dds_topic_serializers_t * serializers; /**< type-specific serialization functions, only present if flag DDS_TOPIC_SERIALIZERS is set */
 }
 dds_topic_descriptor_t;
 
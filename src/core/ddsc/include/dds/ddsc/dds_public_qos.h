@@ -441,6 +441,69 @@ dds_qset_ignorelocal (
   dds_qos_t * __restrict qos,
   dds_ignorelocal_kind_t ignore);
 
+/**
+ * @ingroup qos_setters
+ * @component qos_obj
+ * @brief Set the instance shard policy of a qos structure
+ *
+ * A reader with this policy only receives the instances that map to shard @p index of
+ * @p count, allowing a set of readers, possibly in different processes, to divide the
+ * instances of a topic between them.  The mapping is based on the key hash of the
+ * instance.  Cyclone DDS writers use it to avoid sending data to readers that are not
+ * interested in it, in all other cases the data is dropped by the reader before it
+ * enters the reader history cache.
+ *
+ * @param[in,out] qos - Pointer to a dds_qos_t structure that will store the policy
+ * @param[in] index - Shard of this reader, must be less than count
+ * @param[in] count - Number of shards, must be at least 1
+ */
+DDS_EXPORT void
+dds_qset_instance_shard (
+  dds_qos_t * __restrict qos,
+  uint32_t index,
+  uint32_t count);
+
+/**
+ * @ingroup qos_setters
+ * @component qos_obj
+ * @brief Set the reader loan pool policy of a qos structure
+ *
+ * A read or take without buffers provided by the application lends it a buffer of
+ * samples owned by the reader, which is reused once it is returned with
+ * dds_return_loan.  This policy sets how many of these buffers a reader keeps, and
+ * therefore how many loans can be outstanding before read and take fall back to
+ * allocating memory.  The default is 1.  The policy is local to the reader and is
+ * not sent to remote entities.
+ *
+ * @param[in,out] qos - Pointer to a dds_qos_t structure that will store the policy
+ * @param[in] depth - Number of loan buffers, from 1 up to and including 256
+ */
+DDS_EXPORT void
+dds_qset_reader_loan_pool (
+  dds_qos_t * __restrict qos,
+  uint32_t depth);
+
+/**
+ * @ingroup qos_setters
+ * @component qos_obj
+ * @brief Set the reader stream policy of a qos structure
+ *
+ * A stream reader stores the received samples in a bounded ring instead of the usual
+ * reader history cache, avoiding the cost of maintaining instances and sample states.
+ * Only take is supported, through dds_take_stream, dds_takecdr_stream or the regular
+ * take operations; read and read/query conditions are not.  It requires a keyless
+ * topic and KEEP_ALL history, and when the ring is full, reliable data is held back
+ * and best-effort data is rejected.  The policy is local to the reader and is not sent
+ * to remote entities.
+ *
+ * @param[in,out] qos - Pointer to a dds_qos_t structure that will store the policy
+ * @param[in] capacity - Minimum number of samples the ring can hold, rounded up to a power of 2, from 1 up to and including 2^20
+ */
+DDS_EXPORT void
+dds_qset_reader_stream (
+  dds_qos_t * __restrict qos,
+  uint32_t capacity);
+
 /**
  * @ingroup qos_setters
  * @component qos_obj
@@ -922,6 +985,53 @@ dds_qget_ignorelocal (
   const dds_qos_t * __restrict qos,
   dds_ignorelocal_kind_t *ignore);
 
+/**
+ * @ingroup qos_getters
+ * @component qos_obj
+ * @brief Get the instance shard qos policy
+ *
+ * @param[in] qos - Pointer to a dds_qos_t structure storing the policy
+ * @param[in,out] index - Pointer that will store the shard index (optional)
+ * @param[in,out] count - Pointer that will store the number of shards (optional)
+ *
+ * @returns - false iff any of the arguments is invalid or the qos is not present in the qos object
+ */
+DDS_EXPORT bool
+dds_qget_instance_shard (
+  const dds_qos_t * __restrict qos,
+  uint32_t *index,
+  uint32_t *count);
+
+/**
+ * @ingroup qos_getters
+ * @component qos_obj
+ * @brief Get the reader loan pool qos policy
+ *
+ * @param[in] qos - Pointer to a dds_qos_t structure storing the policy
+ * @param[in,out] depth - Pointer that will store the number of loan buffers (optional)
+ *
+ * @returns - false iff any of the arguments is invalid or the qos is not present in the qos object
+ */
+DDS_EXPORT bool
+dds_qget_reader_loan_pool (
+  const dds_qos_t * __restrict qos,
+  uint32_t *depth);
+
+/**
+ * @ingroup qos_getters
+ * @component qos_obj
+ * @brief Get the reader stream qos policy
+ *
+ * @param[in] qos - Pointer to a dds_qos_t structure storing the policy
+ * @param[in,out] capacity - Pointer that will store the capacity of the ring (optional)
+ *
+ * @returns - false iff any of the arguments is invalid or the qos is not present in the qos object
+ */
+DDS_EXPORT bool
+dds_qget_reader_stream (
+  const dds_qos_t * __restrict qos,
+  uint32_t *capacity);
+
 /**
  * @ingroup qos_getters
  * @component qos_obj
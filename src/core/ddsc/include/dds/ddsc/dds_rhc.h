@@ -35,6 +35,16 @@ typedef void (*dds_rhc_remove_readcondition_t) (struct dds_rhc *rhc, struct dds_
 
 typedef uint32_t (*dds_rhc_lock_samples_t) (struct dds_rhc *rhc);
 
+/** @brief Occupancy of the memory pools of an RHC, for the reader's statistics */
+struct dds_rhc_stats {
+  uint32_t instance_pool_size; /**< number of instances allocated */
+  uint32_t instance_pool_used; /**< number of instances in use */
+  uint32_t sample_pool_size; /**< number of sample nodes allocated */
+  uint32_t sample_pool_used; /**< number of sample nodes in use */
+};
+
+typedef void (*dds_rhc_get_stats_t) (struct dds_rhc *rhc, struct dds_rhc_stats *stats);
+
 struct dds_rhc_ops {
   /* A copy of DDSI rhc ops comes first so we can use either interface without
      additional indirections */
@@ -47,6 +57,7 @@ struct dds_rhc_ops {
   dds_rhc_remove_readcondition_t remove_readcondition;
   dds_rhc_lock_samples_t lock_samples;
   dds_rhc_associate_t associate;
+  dds_rhc_get_stats_t get_stats; /**< optional, may be null: the statistics are then all 0 */
 };
 
 struct dds_rhc {
@@ -123,6 +134,17 @@ DDS_INLINE_EXPORT inline uint32_t dds_rhc_lock_samples (struct dds_rhc *rhc) {
   return rhc->common.ops->lock_samples (rhc);
 }
 
+/** @component rhc */
+DDS_INLINE_EXPORT inline void dds_rhc_get_stats (struct dds_rhc *rhc, struct dds_rhc_stats *stats) {
+  if (rhc->common.ops->get_stats)
+    rhc->common.ops->get_stats (rhc, stats);
+  else
+  {
+    stats->instance_pool_size = stats->instance_pool_used = 0;
+    stats->sample_pool_size = stats->sample_pool_used = 0;
+  }
+}
+
 /** @component rhc */
 DDS_EXPORT void dds_reader_data_available_cb (struct dds_reader *rd);
 
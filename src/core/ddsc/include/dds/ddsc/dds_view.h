@@ -0,0 +1,152 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+
+/** @file
+ *
+ * @brief Views on the serialized data of samples
+ *
+ * A view gives access to members of a sample directly in its serialized
+ * representation, as obtained from e.g. dds_takecdr, without deserializing the
+ * sample. The accessors for a type are generated by idlc when invoked with
+ * "-f views"; this header contains the support functions they use.
+ *
+ * Offsets of members that do not depend on the contents of the sample are
+ * computed once per type, the first time a view for the type is initialized.
+ * The offsets of the other members are determined on the first access to one of
+ * them, in a single pass over the data. Views only support data in native byte
+ * order, which is how samples are stored by the default serdata implementation.
+ */
+#ifndef DDS_VIEW_H
+#define DDS_VIEW_H
+
+#include "dds/export.h"
+#include "dds/ddsrt/atomics.h"
+#include "dds/ddsrt/iovec.h"
+#include "dds/ddsrt/retcode.h"
+#include "dds/ddsc/dds_public_impl.h"
+
+#if defined (__cplusplus)
+extern "C" {
+#endif
+
+struct ddsi_serdata;
+struct dds_view_layout;
+
+/**
+ * @brief Member of a type that is accessible through a view
+ *
+ * The member is identified by its path from the top-level type, where index
+ * is the position of the member in the declaration order of the struct (not
+ * counting members of a base type) and member_id is its member id.
+ */
+typedef struct dds_view_member {
+  uint32_t depth;
+  const uint32_t *index;
+  const uint32_t *member_id;
+} dds_view_member_t;
+
+/**
+ * @brief Description of the members accessible through views on a type
+ *
+ * The layout is computed on first use and must be initialized to a null pointer.
+ */
+typedef struct dds_view_desc {
+  const dds_topic_descriptor_t *topic_desc;
+  uint32_t nmembers;
+  const dds_view_member_t *members;
+  ddsrt_atomic_voidp_t layout;
+} dds_view_desc_t;
+
+/**
+ * @brief View on the serialized data of a sample
+ *
+ * The offs array has an entry for each member in the view description and is
+ * provided by the generated code.
+ */
+typedef struct dds_view {
+  const dds_view_desc_t *desc;
+  const struct dds_view_layout *layout;
+  struct ddsi_serdata *serdata;
+  ddsrt_iovec_t ref;
+  const unsigned char *data;
+  uint32_t size;
+  uint32_t xcdr_version;
+  bool resolved;
+  uint32_t *offs;
+} dds_view_t;
+
+/**
+ * @ingroup view
+ * @component view
+ * @brief Initializes a view on the data of a serdata
+ *
+ * The view holds a reference to the serialized data, which is released by
+ * dds_view_fini.
+ *
+ * @param[out] view the view to initialize
+ * @param[in] desc the view description of the type
+ * @param[in] offs storage for the offsets of the members, desc->nmembers entries
+ * @param[in] serdata the sample, for example obtained through dds_takecdr
+ *
+ * @returns A dds_return_t indicating success or failure
+ *
+ * @retval DDS_RETCODE_OK
+ *             The view was initialized
+ * @retval DDS_RETCODE_BAD_PARAMETER
+ *             The serdata contains no data or is of a different type, which includes
+ *             a different version of the type with the same name
+ * @retval DDS_RETCODE_UNSUPPORTED
+ *             The data is not in native byte order
+ */
+DDS_EXPORT dds_return_t dds_view_init (dds_view_t *view, dds_view_desc_t *desc, uint32_t *offs, struct ddsi_serdata *serdata);
+
+/**
+ * @ingroup view
+ * @component view
+ * @brief Releases the reference to the serialized data held by the view
+ *
+ * @param[in] view the view
+ */
+DDS_EXPORT void dds_view_fini (dds_view_t *view);
+
+/**
+ * @ingroup view
+ * @component view
+ * @brief Locates a member of primitive or enumerated type in the data
+ *
+ * @param[in] view the view
+ * @param[in] member index of the member in the view description
+ * @param[in] size size of the member in the serialized data
+ *
+ * @returns A pointer to the (possibly unaligned) value, or a null pointer if
+ *          the member is not present in the data
+ */
+DDS_EXPORT const void *dds_view_member (dds_view_t *view, uint32_t member, uint32_t size);
+
+/**
+ * @ingroup view
+ * @component view
+ * @brief Locates a member of string type in the data
+ *
+ * @param[in] view the view
+ * @param[in] member index of the member in the view description
+ *
+ * @returns A pointer to the zero-terminated string in the data, or a null pointer
+ *          if the member is not present in the data
+ */
+DDS_EXPORT const char *dds_view_string (dds_view_t *view, uint32_t member);
+
+#if defined (__cplusplus)
+}
+#endif
+
+#endif /* DDS_VIEW_H */
@@ -0,0 +1,91 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#ifndef DDS__FILTER_EXPR_H
+#define DDS__FILTER_EXPR_H
+
+#include <stdbool.h>
+#include "dds/ddsi/ddsi_serdata.h"
+
+#if defined (__cplusplus)
+extern "C" {
+#endif
+
+/* Maximum number of distinct fields and of parameters in a filter expression */
+#define DDS_FILTER_EXPR_MAX_FIELDS 32
+#define DDS_FILTER_EXPR_MAX_PARAMS 100
+
+/* A content filter expression (the SQL subset of the DDS specification) compiled against
+   the serializer instructions of a type.  It is evaluated on the serialized representation
+   of a sample, so samples need not be deserialized to decide whether they are accepted.
+   A compiled expression is immutable. */
+struct dds_filter_expr;
+
+/**
+ * @brief Compiles a filter expression for a type
+ * @component topic
+ *
+ * Field names are resolved using the type information, so the type must be a default
+ * sertype that has it.  Parameters are referenced in the expression as %0 .. %99 and
+ * are interpreted as literals of the type of the field they're compared with.
+ *
+ * @param[out] expr        compiled expression
+ * @param[in]  type        the type of the samples to be filtered
+ * @param[in]  expression  filter expression
+ * @param[in]  nparams     number of parameters
+ * @param[in]  params      parameter values, may be NULL if nparams = 0
+ *
+ * @retval DDS_RETCODE_OK  success
+ * @retval DDS_RETCODE_BAD_PARAMETER  syntax error, unknown field or a type mismatch
+ * @retval DDS_RETCODE_UNSUPPORTED  the type or a referenced field can't be used in an expression
+ */
+dds_return_t dds_filter_expr_compile (struct dds_filter_expr **expr, const struct ddsi_sertype *type, const char *expression, uint32_t nparams, const char * const *params);
+
+/** @component topic */
+void dds_filter_expr_free (struct dds_filter_expr *expr);
+
+/**
+ * @brief Evaluates a filter expression on serialized data
+ * @component topic
+ *
+ * @param[in] expr          compiled expression
+ * @param[in] data          serialized data, following the encoding header
+ * @param[in] size          size of the data
+ * @param[in] xcdr_version  XCDR version of the data
+ * @param[in] bswap         whether the data is in non-native byte order
+ * @returns true if the sample is accepted, false if it is rejected or malformed
+ */
+bool dds_filter_expr_eval_cdr (const struct dds_filter_expr *expr, const void *data, uint32_t size, uint32_t xcdr_version, bool bswap);
+
+/**
+ * @brief Evaluates a filter expression on a sample
+ * @component topic
+ *
+ * Samples of the default sertype are evaluated in place, any other representation is
+ * evaluated on its serialized form.
+ *
+ * @param[in] expr    compiled expression
+ * @param[in] sample  sample containing data
+ * @returns true if the sample is accepted
+ */
+bool dds_filter_expr_eval_serdata (const struct dds_filter_expr *expr, const struct ddsi_serdata *sample);
+
+/** @component topic */
+const char *dds_filter_expr_expression (const struct dds_filter_expr *expr);
+
+/** @component topic */
+uint32_t dds_filter_expr_parameters (const struct dds_filter_expr *expr, const char * const **params);
+
+#if defined (__cplusplus)
+}
+#endif
+
+#endif /* DDS__FILTER_EXPR_H */
@@ -40,7 +40,8 @@ extern "C" {
    DDSI_QP_RESOURCE_LIMITS | DDSI_QP_ADLINK_READER_DATA_LIFECYCLE |                         \
    DDSI_QP_CYCLONE_IGNORELOCAL | DDSI_QP_PROPERTY_LIST |                                    \
    DDSI_QP_TYPE_CONSISTENCY_ENFORCEMENT | DDSI_QP_DATA_REPRESENTATION |                     \
-   DDSI_QP_ENTITY_NAME)
+   DDSI_QP_ENTITY_NAME | DDSI_QP_CYCLONE_INSTANCE_SHARD |                                   \
+   DDSI_QP_CYCLONE_READER_LOAN_POOL | DDSI_QP_CYCLONE_READER_STREAM)
 
 #define DDS_SUBSCRIBER_QOS_MASK                                                             \
   (DDSI_QP_PARTITION | DDSI_QP_PRESENTATION | DDSI_QP_GROUP_DATA |                          \
@@ -0,0 +1,67 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#ifndef DDS__RHC_STREAM_H
+#define DDS__RHC_STREAM_H
+
+#include "dds/ddsc/dds_rhc.h"
+
+#if defined (__cplusplus)
+extern "C" {
+#endif
+
+struct dds_reader;
+struct ddsi_serdata;
+
+/**
+ * @brief Creates a reader history cache for a stream reader
+ * @component rhc
+ *
+ * A stream reader history cache is a bounded ring of references to the received
+ * samples, without instances, sample states or read conditions.  It is only suitable
+ * for keyless topics and KEEP_ALL history.  Delivery appends to the ring and take
+ * removes from it, holding different locks so that the two don't contend.
+ *
+ * @param[in] reader    reader owning the history cache
+ * @param[in] capacity  minimum number of samples the ring can hold
+ * @returns the new history cache
+ */
+struct dds_rhc *dds_rhc_stream_new (struct dds_reader *reader, uint32_t capacity);
+
+/** @component rhc */
+bool dds_rhc_is_stream (const struct dds_rhc *rhc);
+
+/**
+ * @brief Takes samples from a stream reader history cache into application samples
+ * @component rhc
+ *
+ * @param[in] rhc     stream reader history cache
+ * @param[out] values array of at least maxs pointers to initialized samples
+ * @param[in] maxs    maximum number of samples to take
+ * @returns the number of samples taken
+ */
+int32_t dds_rhc_stream_take_samples (struct dds_rhc *rhc, void **values, uint32_t maxs);
+
+/**
+ * @brief Takes references to the serialized samples from a stream reader history cache
+ * @component rhc
+ *
+ * @param[in] rhc     stream reader history cache
+ * @param[out] values array of at least maxs serdata pointers, the caller owns the references
+ * @param[in] maxs    maximum number of samples to take
+ * @returns the number of samples taken
+ */
+int32_t dds_rhc_stream_take_serdata (struct dds_rhc *rhc, struct ddsi_serdata **values, uint32_t maxs);
+
+#if defined (__cplusplus)
+}
+#endif
+#endif /* DDS__RHC_STREAM_H */
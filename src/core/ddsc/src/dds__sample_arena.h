@@ -0,0 +1,51 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#ifndef DDS__SAMPLE_ARENA_H
+#define DDS__SAMPLE_ARENA_H
+
+#include <stdbool.h>
+#include "dds/dds.h"
+#include "dds/ddsi/ddsi_serdata.h"
+
+#if defined (__cplusplus)
+extern "C" {
+#endif
+
+struct dds_sample_arena_chunk;
+
+/* Memory for a batch of samples and everything they reference: it is allocated by
+   bumping a pointer in the most recent chunk, adding a chunk when it is exhausted,
+   and is only ever released as a whole. */
+struct dds_sample_arena {
+  size_t chunk_size;
+  struct dds_sample_arena_chunk *chunks; /* most recent first */
+  uintptr_t ptr; /* free space in the most recent chunk */
+  uintptr_t lim;
+};
+
+/**
+ * @brief Deserializes a sample into memory taken from an arena
+ * @component read_data
+ *
+ * @param[in] arena      arena providing the memory
+ * @param[in] type       sertype of the reader, must be a default sertype
+ * @param[in] d          serdata as returned by takecdr
+ * @param[in] valid_data whether d contains data or only a key
+ *
+ * @returns a pointer to the sample in the arena, or NULL if it can't be deserialized
+ */
+void *dds_sample_arena_deserialize (struct dds_sample_arena *arena, const struct ddsi_sertype *type, const struct ddsi_serdata *d, bool valid_data);
+
+#if defined (__cplusplus)
+}
+#endif
+#endif /* DDS__SAMPLE_ARENA_H */
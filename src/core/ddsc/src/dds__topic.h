@@ -46,6 +46,9 @@ dds_entity_t dds_create_topic_impl (
     const dds_listener_t *listener,
     bool is_builtin);
 
+/** @component topic */
+void dds_topic_content_filter_init (struct dds_domain *dom) ddsrt_nonnull_all;
+
 #if defined (__cplusplus)
 }
 #endif
@@ -23,6 +23,7 @@
 #endif
 #include "dds/ddsrt/avl.h"
 #include "dds/ddsi/ddsi_builtin_topic_if.h"
+#include "dds/ddsi/ddsi_content_filter_if.h"
 #include "dds__handles.h"
 
 #ifdef DDS_HAS_SHM
@@ -290,10 +291,15 @@ typedef struct dds_domain {
 #endif
 
   struct ddsi_builtin_topic_interface btif;
+  struct ddsi_content_filter_interface cfif;
   struct ddsi_domaingv gv;
 
   /* Transmit side: pool for the serializer & transmit messages */
   struct dds_serdatapool *serpool;
+
+  /* Bytes kept in memory by the WHCs of transient-local writers that may spill their
+     history to disk, for enforcing Internal/WhcSpill/DomainLimit */
+  ddsrt_atomic_uint64_t whc_resident_bytes;
 } dds_domain;
 
 typedef struct dds_subscriber {
@@ -359,14 +365,20 @@ typedef struct dds_participant {
   ddsrt_avl_tree_t m_ktopics; /* [m_entity.m_mutex] */
 } dds_participant;
 
+/* Buffer of samples that read/take lends to the application when it doesn't provide one */
+struct dds_reader_loan {
+  bool out;      /* currently lent to the application */
+  void *buf;     /* samples, null if not allocated yet */
+  uint32_t size; /* number of samples in buf */
+};
+
 typedef struct dds_reader {
   struct dds_entity m_entity;
   struct dds_topic *m_topic; /* refc'd, constant, lock(rd) -> lock(tp) allowed */
   struct dds_rhc *m_rhc; /* aliases m_rd->rhc with a wider interface, FIXME: but m_rd owns it for resource management */
   struct ddsi_reader *m_rd;
-  bool m_loan_out;
-  void *m_loan;
-  uint32_t m_loan_size;
+  uint32_t m_nloans; /* [constant] size of the loan pool, from the reader loan pool QoS */
+  struct dds_reader_loan *m_loans; /* [m_entity.m_mutex] */
 #ifdef DDS_HAS_SHM
   iox_sub_context_t m_iox_sub_context;
   iox_sub_t m_iox_sub;
@@ -408,6 +420,7 @@ typedef struct dds_topic {
   struct ddsi_sertype *m_stype;
   struct dds_ktopic *m_ktopic; /* refc'd, constant */
   struct dds_topic_filter m_filter;
+  ddsrt_atomic_voidp_t m_filter_expr; /* struct dds_filter_expr *, applied before m_filter */
   dds_inconsistent_topic_status_t m_inconsistent_topic_status; /* Status metrics */
 } dds_topic;
 
@@ -19,12 +19,64 @@ extern "C" {
 #endif
 
 struct ddsi_domaingv;
-struct whc_writer_info;
 struct dds_writer;
 
+struct whc_writer_info {
+  struct dds_writer * writer; /* can be NULL, eg in case of whc for built-in writers */
+  unsigned is_transient_local: 1;
+  unsigned has_deadline: 1;
+  unsigned has_lifespan: 1;
+  unsigned is_keyless: 1;
+  unsigned is_persistent: 1;
+  uint32_t hdepth; /* 0 = unlimited */
+  uint32_t tldepth; /* 0 = disabled/unlimited (no need to maintain an index if KEEP_ALL <=> is_transient_local + tldepth=0) */
+  uint32_t idxdepth; /* = max (hdepth, tldepth) */
+};
+
 /** @component whc */
 struct ddsi_whc *dds_whc_new (struct ddsi_domaingv *gv, const struct whc_writer_info *wrinfo);
 
+/**
+ * @brief Whether the sequence-number indexed ring WHC can be used for a writer
+ * @component whc
+ *
+ * This is the case for keyless, volatile writers without deadline and lifespan,
+ * where all the default WHC needs its instance index and interval tree for is a
+ * single instance and (in case of KEEP_LAST) its history depth.
+ */
+bool dds_whc_ring_applicable (const struct whc_writer_info *wrinfo);
+
+/**
+ * @brief Constructs a WHC that stores its samples in a ring indexed by sequence number
+ * @component whc
+ *
+ * Inserting, looking up and dropping acknowledged samples are constant-time operations
+ * that don't allocate memory once the ring and its node pool have grown to the size
+ * required by the writer.
+ */
+struct ddsi_whc *dds_whc_ring_new (struct ddsi_domaingv *gv, const struct whc_writer_info *wrinfo);
+
+/**
+ * @brief Constructs a WHC that also appends the samples to a log on disk
+ * @component whc
+ *
+ * Used for writers with PERSISTENT durability if a directory for the log has been
+ * configured.  Otherwise behaves like a WHC for a transient-local writer.
+ */
+struct ddsi_whc *dds_whc_persistent_new (struct ddsi_domaingv *gv, const struct whc_writer_info *wrinfo);
+
+/**
+ * @brief Republishes the samples recovered from the log of a persistent WHC
+ * @component whc
+ *
+ * Must be called once the DDSI writer exists but before the application can use the
+ * writer.  Does nothing if the WHC doesn't store its history on disk.
+ *
+ * @param[in] whc  the writer's WHC
+ * @param[in] wr   the writer
+ */
+void dds_whc_persistent_recover (struct ddsi_whc *whc, struct dds_writer *wr);
+
 /** @component whc */
 struct whc_writer_info *dds_whc_make_wrinfo (struct dds_writer *wr, const dds_qos_t *qos);
 
@@ -0,0 +1,112 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#ifndef DDS__WHC_SPILL_H
+#define DDS__WHC_SPILL_H
+
+#include <stdbool.h>
+#include "dds/ddsi/ddsi_serdata.h"
+
+#if defined (__cplusplus)
+extern "C" {
+#endif
+
+struct ddsi_domaingv;
+
+/* A spill file holds the serialised representation of samples that a WHC moved out of
+   memory.  It is owned by a single WHC and all operations on it must be performed while
+   holding that WHC's lock. */
+struct dds_whc_spill;
+
+/* Location and the metadata of a serdata that isn't part of its serialised form */
+struct dds_whc_spill_rec {
+  struct dds_whc_spill_rec *prev, *next; /* in order of offset in the file */
+  uint64_t off;
+  uint32_t size;
+  uint32_t statusinfo;
+  ddsrt_wctime_t timestamp;
+  ddsrt_mtime_t twrite;
+  const struct ddsi_sertype *type;
+};
+
+/**
+ * @brief Creates a spill file in the configured directory
+ * @component whc
+ *
+ * @param[in] gv  domain, for configuration and logging
+ * @returns spill file or NULL on failure
+ */
+struct dds_whc_spill *dds_whc_spill_new (struct ddsi_domaingv *gv);
+
+/** @component whc */
+void dds_whc_spill_free (struct dds_whc_spill *sp);
+
+/**
+ * @brief Whether a sample can be spilled
+ * @component whc
+ *
+ * Only samples with data and a type that can reconstruct them from their serialised
+ * form can be spilled.
+ */
+bool dds_whc_spill_supported (const struct ddsi_serdata *serdata);
+
+/**
+ * @brief Appends the serialised form of a sample to the spill file
+ * @component whc
+ *
+ * @param[in] sp       spill file
+ * @param[in] serdata  sample, must be supported
+ * @returns a record for locating it, or NULL if writing it failed
+ */
+struct dds_whc_spill_rec *dds_whc_spill_write (struct dds_whc_spill *sp, const struct ddsi_serdata *serdata);
+
+/**
+ * @brief Reconstructs a spilled sample
+ * @component whc
+ *
+ * The record remains valid, each call returns a new serdata.
+ *
+ * @returns new serdata or NULL if reading it failed
+ */
+struct ddsi_serdata *dds_whc_spill_read (struct dds_whc_spill *sp, const struct dds_whc_spill_rec *rec);
+
+/**
+ * @brief Releases a spilled sample
+ * @component whc
+ *
+ * This does no I/O, the space is reclaimed by @ref dds_whc_spill_compact.
+ */
+void dds_whc_spill_drop (struct dds_whc_spill *sp, struct dds_whc_spill_rec *rec);
+
+/**
+ * @brief Whether enough of the file has been released to make compacting it worthwhile
+ * @component whc
+ *
+ * That is the case once the amount of released data exceeds what is still live.
+ */
+bool dds_whc_spill_compact_needed (const struct dds_whc_spill *sp);
+
+/**
+ * @brief Performs a step in moving the live data to the front of the file
+ * @component whc
+ *
+ * Each step moves a bounded amount of data, so that the WHC lock is never held for
+ * long.  Samples may be written, read and dropped in between steps.
+ *
+ * @returns true if more steps are needed, false if done or if an I/O error occurred
+ */
+bool dds_whc_spill_compact (struct dds_whc_spill *sp);
+
+#if defined (__cplusplus)
+}
+#endif
+
+#endif /* DDS__WHC_SPILL_H */
@@ -19,6 +19,7 @@
 #include "dds/ddsc/dds_rhc.h"
 #include "dds__domain.h"
 #include "dds__builtin.h"
+#include "dds__topic.h"
 #include "dds__whc_builtintopic.h"
 #include "dds__entity.h"
 #include "dds/ddsi/ddsi_iid.h"
@@ -136,6 +137,7 @@ static dds_entity_t dds_domain_init (dds_domain *domain, dds_domainid_t domain_i
   }
 
   domain->serpool = dds_serdatapool_new ();
+  ddsrt_atomic_st64 (&domain->whc_resident_bytes, 0);
 
 #ifdef DDS_HAS_SHM
   // if DDS_HAS_SHM is enabled the iceoryx runtime was created in ddsi_init and is ready
@@ -174,6 +176,7 @@ static dds_entity_t dds_domain_init (dds_domain *domain, dds_domainid_t domain_i
   }
 
   dds__builtin_init (domain);
+  dds_topic_content_filter_init (domain);
 
   if (ddsi_start (&domain->gv) < 0)
   {
@@ -0,0 +1,991 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include <assert.h>
+#include <ctype.h>
+#include <string.h>
+#include "dds/ddsrt/heap.h"
+#include "dds/ddsrt/string.h"
+#include "dds/ddsrt/strtol.h"
+#include "dds/ddsrt/strtod.h"
+#include "dds/ddsrt/bswap.h"
+#include "dds/ddsi/ddsi_sertype.h"
+#include "dds/ddsi/ddsi_typelib.h"
+#include "dds/ddsi/ddsi_protocol.h"
+#include "dds/cdr/dds_cdrstream.h"
+#include "dds__serdata_default.h"
+#include "dds__filter_expr.h"
+
+/* Representation of field values in the CDR */
+enum filter_kind {
+  FK_BOOL, FK_U8, FK_I8, FK_U16, FK_I16, FK_U32, FK_I32, FK_U64, FK_I64, FK_F32, FK_F64, FK_STRING
+};
+
+/* Values used in comparisons, integers are signed or unsigned 64-bit numbers, strings point
+   into the CDR or to a constant in the expression and are not null-terminated */
+enum filter_vkind { FVK_INT, FVK_UINT, FVK_FLOAT, FVK_STRING };
+
+struct filter_value {
+  enum filter_vkind kind;
+  union {
+    int64_t i;
+    uint64_t u;
+    double f;
+    struct { const char *s; uint32_t n; } str;
+  } u;
+};
+
+struct filter_field {
+  char *name;
+  enum filter_kind kind;
+  bool is_enum;
+  uint32_t fixed_offset[2]; /* for XCDR1, XCDR2, or DDS_CDRSTREAM_MEMBER_ABSENT if it depends on the data */
+};
+
+enum filter_relop { FR_EQ, FR_NE, FR_LT, FR_LE, FR_GT, FR_GE, FR_LIKE };
+
+/* Predicates always have a field on the left; a constant on the right owns its string */
+struct filter_pred {
+  enum filter_relop op;
+  uint32_t field;
+  bool rhs_is_field;
+  uint32_t rhs_field;
+  struct filter_value rhs;
+};
+
+/* The program operates on a single boolean: TEST sets it to the outcome of a predicate,
+   NOT inverts it, and the jumps implement short-circuit evaluation of AND and OR.  The
+   result is its value once the program counter runs off the end. */
+enum filter_opcode { FOP_TEST, FOP_NOT, FOP_JT, FOP_JF };
+
+struct filter_insn {
+  enum filter_opcode op;
+  uint32_t arg; /* predicate for TEST, target for the jumps */
+};
+
+struct dds_filter_expr {
+  char *expression;
+  uint32_t nparams;
+  char **params;
+  const uint32_t *ops;
+  bool fixed[2]; /* all field offsets fixed for XCDR1, XCDR2 */
+  bool delimited; /* top-level type is appendable, fixed offsets for XCDR2 follow the DHEADER */
+  uint32_t nfields;
+  struct filter_field fields[DDS_FILTER_EXPR_MAX_FIELDS];
+  struct dds_cdrstream_member_ref *refs; /* nfields entries, for locating the fields in the data */
+  uint32_t npreds, size_preds;
+  struct filter_pred *preds;
+  uint32_t ninsns, size_insns;
+  struct filter_insn *insns;
+};
+
+/*******************************************************************************************
+ **
+ **  Evaluation
+ **
+ *******************************************************************************************/
+
+static bool load_field (const struct filter_field *f, const unsigned char *data, uint32_t size, uint32_t off, bool bswap, struct filter_value *v)
+{
+  static const uint32_t kind_size[] = {
+    [FK_BOOL] = 1, [FK_U8] = 1, [FK_I8] = 1, [FK_U16] = 2, [FK_I16] = 2, [FK_U32] = 4, [FK_I32] = 4,
+    [FK_U64] = 8, [FK_I64] = 8, [FK_F32] = 4, [FK_F64] = 8, [FK_STRING] = 4
+  };
+  if (off == DDS_CDRSTREAM_MEMBER_ABSENT || off > size || size - off < kind_size[f->kind])
+    return false;
+  const unsigned char *src = data + off;
+  switch (f->kind)
+  {
+    case FK_BOOL: case FK_U8:
+      v->kind = FVK_UINT; v->u.u = *src;
+      break;
+    case FK_I8:
+      v->kind = FVK_INT; v->u.i = (int8_t) *src;
+      break;
+    case FK_U16: case FK_I16: {
+      uint16_t x;
+      memcpy (&x, src, sizeof (x));
+      if (bswap)
+        x = ddsrt_bswap2u (x);
+      if (f->kind == FK_U16) { v->kind = FVK_UINT; v->u.u = x; }
+      else { v->kind = FVK_INT; v->u.i = (int16_t) x; }
+      break;
+    }
+    case FK_U32: case FK_I32: case FK_F32: {
+      uint32_t x;
+      memcpy (&x, src, sizeof (x));
+      if (bswap)
+        x = ddsrt_bswap4u (x);
+      if (f->kind == FK_U32) { v->kind = FVK_UINT; v->u.u = x; }
+      else if (f->kind == FK_I32) { v->kind = FVK_INT; v->u.i = (int32_t) x; }
+      else { float y; memcpy (&y, &x, sizeof (y)); v->kind = FVK_FLOAT; v->u.f = y; }
+      break;
+    }
+    case FK_U64: case FK_I64: case FK_F64: {
+      uint64_t x;
+      memcpy (&x, src, sizeof (x));
+      if (bswap)
+        x = ddsrt_bswap8u (x);
+      if (f->kind == FK_U64) { v->kind = FVK_UINT; v->u.u = x; }
+      else if (f->kind == FK_I64) { v->kind = FVK_INT; v->u.i = (int64_t) x; }
+      else { v->kind = FVK_FLOAT; memcpy (&v->u.f, &x, sizeof (v->u.f)); }
+      break;
+    }
+    case FK_STRING: {
+      uint32_t len;
+      memcpy (&len, src, sizeof (len));
+      if (bswap)
+        len = ddsrt_bswap4u (len);
+      if (len > size - off - 4)
+        return false;
+      v->kind = FVK_STRING;
+      v->u.str.s = (const char *) src + 4;
+      v->u.str.n = (len > 0) ? len - 1 : 0; /* length includes the terminating 0 */
+      break;
+    }
+  }
+  return true;
+}
+
+static double value_as_double (const struct filter_value *v)
+{
+  switch (v->kind)
+  {
+    case FVK_INT: return (double) v->u.i;
+    case FVK_UINT: return (double) v->u.u;
+    case FVK_FLOAT: return v->u.f;
+    case FVK_STRING: break;
+  }
+  assert (0);
+  return 0.0;
+}
+
+/* -1, 0, 1 for less, equal, greater; 2 if unordered (NaN) */
+static int compare_values (const struct filter_value *a, const struct filter_value *b)
+{
+  if (a->kind == FVK_STRING)
+  {
+    assert (b->kind == FVK_STRING);
+    const int c = memcmp (a->u.str.s, b->u.str.s, (a->u.str.n < b->u.str.n) ? a->u.str.n : b->u.str.n);
+    if (c != 0)
+      return (c < 0) ? -1 : 1;
+    return (a->u.str.n > b->u.str.n) - (a->u.str.n < b->u.str.n);
+  }
+  else if (a->kind == FVK_FLOAT || b->kind == FVK_FLOAT)
+  {
+    const double x = value_as_double (a), y = value_as_double (b);
+    if (x < y)
+      return -1;
+    else if (x > y)
+      return 1;
+    else
+      return (x == y) ? 0 : 2;
+  }
+  else
+  {
+    /* negative numbers are less than anything unsigned, all else can be compared as unsigned */
+    const bool aneg = (a->kind == FVK_INT && a->u.i < 0), bneg = (b->kind == FVK_INT && b->u.i < 0);
+    if (aneg && bneg)
+      return (a->u.i > b->u.i) - (a->u.i < b->u.i);
+    else if (aneg != bneg)
+      return aneg ? -1 : 1;
+    const uint64_t x = (a->kind == FVK_INT) ? (uint64_t) a->u.i : a->u.u;
+    const uint64_t y = (b->kind == FVK_INT) ? (uint64_t) b->u.i : b->u.u;
+    return (x > y) - (x < y);
+  }
+}
+
+/* LIKE: '%' matches any sequence of characters, '_' any single character */
+static bool like_match (const char *s, uint32_t sn, const char *p, uint32_t pn)
+{
+  uint32_t si = 0, pi = 0, star_p = UINT32_MAX, star_s = 0;
+  while (si < sn)
+  {
+    if (pi < pn && p[pi] == '%')
+    {
+      star_p = pi++;
+      star_s = si;
+    }
+    else if (pi < pn && (p[pi] == '_' || p[pi] == s[si]))
+    {
+      pi++;
+      si++;
+    }
+    else if (star_p != UINT32_MAX)
+    {
+      pi = star_p + 1;
+      si = ++star_s;
+    }
+    else
+    {
+      return false;
+    }
+  }
+  while (pi < pn && p[pi] == '%')
+    pi++;
+  return pi == pn;
+}
+
+static bool eval_pred (const struct dds_filter_expr *expr, const struct filter_pred *pred, const unsigned char *data, uint32_t size, const uint32_t *offs, bool bswap)
+{
+  struct filter_value lhs, rhsv;
+  const struct filter_value *rhs = &pred->rhs;
+  /* comparisons involving absent (optional) members are false */
+  if (!load_field (&expr->fields[pred->field], data, size, offs[pred->field], bswap, &lhs))
+    return false;
+  if (pred->rhs_is_field)
+  {
+    if (!load_field (&expr->fields[pred->rhs_field], data, size, offs[pred->rhs_field], bswap, &rhsv))
+      return false;
+    rhs = &rhsv;
+  }
+  if (pred->op == FR_LIKE)
+    return like_match (lhs.u.str.s, lhs.u.str.n, rhs->u.str.s, rhs->u.str.n);
+  const int c = compare_values (&lhs, rhs);
+  switch (pred->op)
+  {
+    case FR_EQ: return c == 0;
+    case FR_NE: return c != 0;
+    case FR_LT: return c == -1;
+    case FR_LE: return c == -1 || c == 0;
+    case FR_GT: return c == 1;
+    case FR_GE: return c == 1 || c == 0;
+    case FR_LIKE: break;
+  }
+  return false;
+}
+
+bool dds_filter_expr_eval_cdr (const struct dds_filter_expr *expr, const void *data, uint32_t size, uint32_t xcdr_version, bool bswap)
+{
+  uint32_t offs[DDS_FILTER_EXPR_MAX_FIELDS];
+  const int xv = (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_1) ? 0 : 1;
+  if (expr->fixed[xv])
+  {
+    if (expr->delimited)
+    {
+      /* an older version of the type may have fewer members */
+      uint32_t dheader;
+      if (size < 4)
+        return false;
+      memcpy (&dheader, data, sizeof (dheader));
+      if (bswap)
+        dheader = ddsrt_bswap4u (dheader);
+      if (dheader > size - 4)
+        return false;
+      size = dheader + 4;
+    }
+    for (uint32_t i = 0; i < expr->nfields; i++)
+      offs[i] = expr->fields[i].fixed_offset[xv];
+  }
+  else
+  {
+    dds_istream_t is = { .m_buffer = data, .m_size = size, .m_index = 0, .m_xcdr_version = xcdr_version };
+    if (!dds_stream_locate_members (&is, bswap, expr->ops, expr->nfields, expr->refs, offs))
+      return false;
+  }
+
+  bool acc = false;
+  uint32_t pc = 0;
+  while (pc < expr->ninsns)
+  {
+    const struct filter_insn *insn = &expr->insns[pc++];
+    switch (insn->op)
+    {
+      case FOP_TEST: acc = eval_pred (expr, &expr->preds[insn->arg], data, size, offs, bswap); break;
+      case FOP_NOT: acc = !acc; break;
+      case FOP_JT: if (acc) pc = insn->arg; break;
+      case FOP_JF: if (!acc) pc = insn->arg; break;
+    }
+  }
+  return acc;
+}
+
+bool dds_filter_expr_eval_serdata (const struct dds_filter_expr *expr, const struct ddsi_serdata *sample)
+{
+  assert (sample->kind == SDK_DATA);
+  if (sample->type->ops == &dds_sertype_ops_default
+#ifdef DDS_HAS_SHM
+      && sample->iox_chunk == NULL
+#endif
+      )
+  {
+    /* default samples are kept in native byte order */
+    const struct dds_serdata_default *d = (const struct dds_serdata_default *) sample;
+    assert (DDSI_RTPS_CDR_ENC_IS_NATIVE (d->hdr.identifier));
+    return dds_filter_expr_eval_cdr (expr, d->data, d->pos, ddsi_sertype_enc_id_xcdr_version (d->hdr.identifier), false);
+  }
+
+  const uint32_t size = ddsi_serdata_size (sample);
+  if (size < sizeof (struct dds_cdr_header))
+    return false;
+  ddsrt_iovec_t iov;
+  struct ddsi_serdata * const ref = ddsi_serdata_to_ser_ref (sample, 0, size, &iov);
+  struct dds_cdr_header hdr;
+  memcpy (&hdr, iov.iov_base, sizeof (hdr));
+  const bool accept = dds_filter_expr_eval_cdr (expr, (const char *) iov.iov_base + sizeof (hdr), size - (uint32_t) sizeof (hdr),
+    ddsi_sertype_enc_id_xcdr_version (hdr.identifier), !DDSI_RTPS_CDR_ENC_IS_NATIVE (hdr.identifier));
+  ddsi_serdata_to_ser_unref (ref, &iov);
+  return accept;
+}
+
+/*******************************************************************************************
+ **
+ **  Compilation
+ **
+ *******************************************************************************************/
+
+enum token_kind {
+  TK_END, TK_ERROR, TK_IDENT, TK_INT, TK_FLOAT, TK_STRING, TK_PARAM,
+  TK_LPAREN, TK_RPAREN, TK_EQ, TK_NE, TK_LT, TK_LE, TK_GT, TK_GE,
+  TK_AND, TK_OR, TK_NOT, TK_BETWEEN, TK_LIKE, TK_TRUE, TK_FALSE
+};
+
+struct token {
+  enum token_kind kind;
+  const char *s; /* text, for strings without the quotes */
+  size_t n;
+};
+
+struct operand {
+  bool is_field;
+  uint32_t field;
+  struct token lit;
+};
+
+struct parser {
+  const char *pos;
+  struct token tok;
+  uint32_t nparams;
+  const char * const *params;
+#ifdef DDS_HAS_TYPE_DISCOVERY
+  const ddsi_typemap_t *typemap;
+  const ddsi_typeid_t *type_id;
+#endif
+  struct dds_filter_expr *expr;
+};
+
+static void lex (const char **pos, struct token *t)
+{
+  static const struct { const char *kw; enum token_kind kind; } keywords[] = {
+    { "AND", TK_AND }, { "OR", TK_OR }, { "NOT", TK_NOT }, { "BETWEEN", TK_BETWEEN },
+    { "LIKE", TK_LIKE }, { "TRUE", TK_TRUE }, { "FALSE", TK_FALSE }
+  };
+  const char *s = *pos;
+  while (isspace ((unsigned char) *s))
+    s++;
+  t->s = s;
+  t->n = 1;
+  switch (*s)
+  {
+    case 0: t->kind = TK_END; t->n = 0; break;
+    case '(': t->kind = TK_LPAREN; break;
+    case ')': t->kind = TK_RPAREN; break;
+    case '=': t->kind = TK_EQ; break;
+    case '<':
+      if (s[1] == '=') { t->kind = TK_LE; t->n = 2; }
+      else if (s[1] == '>') { t->kind = TK_NE; t->n = 2; }
+      else { t->kind = TK_LT; }
+      break;
+    case '>':
+      if (s[1] == '=') { t->kind = TK_GE; t->n = 2; }
+      else { t->kind = TK_GT; }
+      break;
+    case '!':
+      if (s[1] == '=') { t->kind = TK_NE; t->n = 2; }
+      else { t->kind = TK_ERROR; }
+      break;
+    case '\'': {
+      const char *end = strchr (s + 1, '\'');
+      if (end == NULL)
+        t->kind = TK_ERROR;
+      else
+      {
+        t->kind = TK_STRING;
+        t->s = s + 1;
+        t->n = (size_t) (end - t->s);
+        *pos = end + 1;
+        return;
+      }
+      break;
+    }
+    case '%': {
+      size_t n = 0;
+      while (isdigit ((unsigned char) s[1 + n]))
+        n++;
+      if (n == 0 || n > 2)
+        t->kind = TK_ERROR;
+      else
+      {
+        t->kind = TK_PARAM;
+        t->s = s + 1;
+        t->n = n;
+        *pos = s + 1 + n;
+        return;
+      }
+      break;
+    }
+    default: {
+      const char *e = s;
+      if (isdigit ((unsigned char) *e) || ((*e == '-' || *e == '+' || *e == '.') && (isdigit ((unsigned char) e[1]) || (e[1] == '.' && isdigit ((unsigned char) e[2])))))
+      {
+        t->kind = TK_INT;
+        if (*e == '-' || *e == '+')
+          e++;
+        if (e[0] == '0' && (e[1] == 'x' || e[1] == 'X'))
+        {
+          e += 2;
+          while (isxdigit ((unsigned char) *e))
+            e++;
+        }
+        else
+        {
+          while (isdigit ((unsigned char) *e))
+            e++;
+          if (*e == '.')
+          {
+            t->kind = TK_FLOAT;
+            for (e++; isdigit ((unsigned char) *e); e++)
+              ;
+          }
+          if (*e == 'e' || *e == 'E')
+          {
+            t->kind = TK_FLOAT;
+            e++;
+            if (*e == '-' || *e == '+')
+              e++;
+            while (isdigit ((unsigned char) *e))
+              e++;
+          }
+        }
+        t->n = (size_t) (e - s);
+      }
+      else if (isalpha ((unsigned char) *e) || *e == '_')
+      {
+        while (isalnum ((unsigned char) *e) || *e == '_' || *e == '.')
+          e++;
+        t->n = (size_t) (e - s);
+        t->kind = TK_IDENT;
+        for (size_t i = 0; i < sizeof (keywords) / sizeof (keywords[0]); i++)
+        {
+          if (strlen (keywords[i].kw) == t->n && ddsrt_strncasecmp (keywords[i].kw, s, t->n) == 0)
+          {
+            t->kind = keywords[i].kind;
+            break;
+          }
+        }
+      }
+      else
+      {
+        t->kind = TK_ERROR;
+      }
+      break;
+    }
+  }
+  *pos = s + t->n;
+}
+
+static void next (struct parser *p)
+{
+  lex (&p->pos, &p->tok);
+}
+
+static bool field_kind_from_insn (uint32_t insn, enum filter_kind *kind, bool *is_enum)
+{
+  const uint32_t flags = DDS_OP_FLAGS (insn);
+  *is_enum = false;
+  switch (DDS_OP_TYPE (insn))
+  {
+    case DDS_OP_VAL_BLN: *kind = FK_BOOL; return true;
+    case DDS_OP_VAL_1BY: *kind = (flags & DDS_OP_FLAG_SGN) ? FK_I8 : FK_U8; return true;
+    case DDS_OP_VAL_2BY: *kind = (flags & DDS_OP_FLAG_SGN) ? FK_I16 : FK_U16; return true;
+    case DDS_OP_VAL_4BY: *kind = (flags & DDS_OP_FLAG_FP) ? FK_F32 : (flags & DDS_OP_FLAG_SGN) ? FK_I32 : FK_U32; return true;
+    case DDS_OP_VAL_8BY: *kind = (flags & DDS_OP_FLAG_FP) ? FK_F64 : (flags & DDS_OP_FLAG_SGN) ? FK_I64 : FK_U64; return true;
+    case DDS_OP_VAL_STR: case DDS_OP_VAL_BST: *kind = FK_STRING; return true;
+    case DDS_OP_VAL_ENU: case DDS_OP_VAL_BMK:
+      *is_enum = (DDS_OP_TYPE (insn) == DDS_OP_VAL_ENU);
+      switch (DDS_OP_TYPE_SZ (insn))
+      {
+        case 1: *kind = FK_U8; return true;
+        case 2: *kind = FK_U16; return true;
+        case 4: *kind = FK_U32; return true;
+        case 8: *kind = FK_U64; return true;
+      }
+      break;
+    default:
+      break;
+  }
+  return false;
+}
+
+static dds_return_t add_field (struct parser *p, const struct token *t, uint32_t *field)
+{
+  struct dds_filter_expr * const expr = p->expr;
+  for (uint32_t i = 0; i < expr->nfields; i++)
+  {
+    if (strlen (expr->fields[i].name) == t->n && strncmp (expr->fields[i].name, t->s, t->n) == 0)
+    {
+      *field = i;
+      return DDS_RETCODE_OK;
+    }
+  }
+  if (expr->nfields == DDS_FILTER_EXPR_MAX_FIELDS)
+    return DDS_RETCODE_UNSUPPORTED;
+
+#ifdef DDS_HAS_TYPE_DISCOVERY
+  struct filter_field * const f = &expr->fields[expr->nfields];
+  struct dds_cdrstream_member_ref * const ref = &expr->refs[expr->nfields];
+  uint32_t depth, index[DDS_CDRSTREAM_MAX_NESTING_DEPTH], member_id[DDS_CDRSTREAM_MAX_NESTING_DEPTH];
+  dds_return_t ret;
+  char *name = ddsrt_strndup (t->s, t->n);
+  if ((ret = ddsi_typemap_resolve_member (p->typemap, p->type_id, name, DDS_CDRSTREAM_MAX_NESTING_DEPTH, &depth, index, member_id)) != DDS_RETCODE_OK)
+  {
+    ddsrt_free (name);
+    return ret;
+  }
+  /* only fields of primitive, enumerated and string types can be used, and the path
+     may not go through anything but (non-optional) struct members */
+  if (!dds_stream_member_ref_init (ref, expr->ops, depth, index, member_id) || !field_kind_from_insn (*ref->path[depth - 1], &f->kind, &f->is_enum))
+  {
+    ddsrt_free (name);
+    return DDS_RETCODE_UNSUPPORTED;
+  }
+  f->name = name;
+  for (int xv = 0; xv < 2; xv++)
+  {
+    /* appendable types only exist in XCDR2, and there the members follow a DHEADER */
+    const uint32_t xcdr_version = (xv == 0) ? DDSI_RTPS_CDR_ENC_VERSION_1 : DDSI_RTPS_CDR_ENC_VERSION_2;
+    if (expr->delimited && xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && dds_stream_member_fixed_offset (expr->ops + 1, ref, xcdr_version, &f->fixed_offset[xv]))
+      f->fixed_offset[xv] += 4;
+    else if (expr->delimited || !dds_stream_member_fixed_offset (expr->ops, ref, xcdr_version, &f->fixed_offset[xv]))
+    {
+      f->fixed_offset[xv] = DDS_CDRSTREAM_MEMBER_ABSENT;
+      expr->fixed[xv] = false;
+    }
+  }
+  *field = expr->nfields++;
+  return DDS_RETCODE_OK;
+#else
+  (void) p; (void) field;
+  return DDS_RETCODE_UNSUPPORTED;
+#endif
+}
+
+static dds_return_t parse_operand (struct parser *p, struct operand *opnd)
+{
+  dds_return_t ret = DDS_RETCODE_OK;
+  opnd->is_field = false;
+  switch (p->tok.kind)
+  {
+    case TK_IDENT:
+      opnd->is_field = true;
+      ret = add_field (p, &p->tok, &opnd->field);
+      break;
+    case TK_INT: case TK_FLOAT: case TK_STRING: case TK_TRUE: case TK_FALSE:
+      opnd->lit = p->tok;
+      break;
+    case TK_PARAM: {
+      const uint32_t idx = (p->tok.n == 1) ? (uint32_t) (p->tok.s[0] - '0') : (uint32_t) (10 * (p->tok.s[0] - '0') + (p->tok.s[1] - '0'));
+      if (idx >= p->nparams)
+        return DDS_RETCODE_BAD_PARAMETER;
+      /* a parameter is a literal, but an unquoted string is taken as a string as well */
+      const char *pos = p->params[idx];
+      struct token end;
+      lex (&pos, &opnd->lit);
+      lex (&pos, &end);
+      switch (opnd->lit.kind)
+      {
+        case TK_INT: case TK_FLOAT: case TK_STRING: case TK_TRUE: case TK_FALSE:
+          if (end.kind == TK_END)
+            break;
+          /* falls through */
+        default:
+          opnd->lit.kind = TK_STRING;
+          opnd->lit.s = p->params[idx];
+          opnd->lit.n = strlen (p->params[idx]);
+          break;
+      }
+      break;
+    }
+    default:
+      return DDS_RETCODE_BAD_PARAMETER;
+  }
+  next (p);
+  return ret;
+}
+
+static bool parse_int (const struct token *t, struct filter_value *v)
+{
+  char buf[32], *end;
+  unsigned long long x;
+  if (t->n >= sizeof (buf))
+    return false;
+  memcpy (buf, t->s, t->n);
+  buf[t->n] = 0;
+  const char *s = buf;
+  const bool neg = (*s == '-');
+  if (*s == '-' || *s == '+')
+    s++;
+  const bool hex = (s[0] == '0' && (s[1] == 'x' || s[1] == 'X'));
+  if (ddsrt_strtoull (hex ? s + 2 : s, &end, hex ? 16 : 10, &x) != DDS_RETCODE_OK || *end != 0)
+    return false;
+  if (!neg)
+  {
+    v->kind = FVK_UINT;
+    v->u.u = x;
+  }
+  else if (x > (unsigned long long) INT64_MAX + 1)
+    return false;
+  else
+  {
+    v->kind = FVK_INT;
+    v->u.i = (x == (unsigned long long) INT64_MAX + 1) ? INT64_MIN : -(int64_t) x;
+  }
+  return true;
+}
+
+static bool parse_float (const struct token *t, struct filter_value *v)
+{
+  char buf[64], *end;
+  if (t->n >= sizeof (buf))
+    return false;
+  memcpy (buf, t->s, t->n);
+  buf[t->n] = 0;
+  v->kind = FVK_FLOAT;
+  return ddsrt_strtod (buf, &end, &v->u.f) == DDS_RETCODE_OK && *end == 0;
+}
+
+/* Converts a literal to a value that can be compared with the field */
+static dds_return_t convert_literal (struct parser *p, const struct filter_field *f, const struct token *lit, struct filter_value *v)
+{
+  if (f->kind == FK_STRING)
+  {
+    if (lit->kind != TK_STRING || lit->n >= UINT32_MAX)
+      return DDS_RETCODE_BAD_PARAMETER;
+    v->kind = FVK_STRING;
+    v->u.str.s = ddsrt_strndup (lit->s, lit->n);
+    v->u.str.n = (uint32_t) lit->n;
+    return DDS_RETCODE_OK;
+  }
+
+  switch (lit->kind)
+  {
+    case TK_INT:
+      return parse_int (lit, v) ? DDS_RETCODE_OK : DDS_RETCODE_BAD_PARAMETER;
+    case TK_FLOAT:
+      return parse_float (lit, v) ? DDS_RETCODE_OK : DDS_RETCODE_BAD_PARAMETER;
+    case TK_TRUE: case TK_FALSE:
+      v->kind = FVK_UINT;
+      v->u.u = (lit->kind == TK_TRUE);
+      return DDS_RETCODE_OK;
+    case TK_STRING:
+      if (f->is_enum)
+      {
+#ifdef DDS_HAS_TYPE_DISCOVERY
+        /* enumerated values are written as strings */
+        char *label = ddsrt_strndup (lit->s, lit->n);
+        int32_t value;
+        dds_return_t ret = ddsi_typemap_resolve_enum_literal (p->typemap, p->type_id, f->name, label, &value);
+        ddsrt_free (label);
+        v->kind = FVK_INT;
+        v->u.i = value;
+        return ret;
+#else
+        (void) p;
+        return DDS_RETCODE_UNSUPPORTED;
+#endif
+      }
+      else if (lit->n == 1 && (f->kind == FK_U8 || f->kind == FK_I8))
+      {
+        /* character literal */
+        v->kind = FVK_UINT;
+        v->u.u = (unsigned char) lit->s[0];
+        return DDS_RETCODE_OK;
+      }
+      return DDS_RETCODE_BAD_PARAMETER;
+    default:
+      return DDS_RETCODE_BAD_PARAMETER;
+  }
+}
+
+static uint32_t emit (struct parser *p, enum filter_opcode op, uint32_t arg)
+{
+  struct dds_filter_expr * const expr = p->expr;
+  if (expr->ninsns == expr->size_insns)
+  {
+    expr->size_insns = (expr->size_insns == 0) ? 8 : 2 * expr->size_insns;
+    expr->insns = ddsrt_realloc (expr->insns, expr->size_insns * sizeof (*expr->insns));
+  }
+  expr->insns[expr->ninsns].op = op;
+  expr->insns[expr->ninsns].arg = arg;
+  return expr->ninsns++;
+}
+
+/* Jumps that need to be patched are linked through their arguments */
+static void patch_jumps (struct parser *p, uint32_t chain, uint32_t target)
+{
+  while (chain != UINT32_MAX)
+  {
+    const uint32_t prev = p->expr->insns[chain].arg;
+    p->expr->insns[chain].arg = target;
+    chain = prev;
+  }
+}
+
+static dds_return_t emit_test (struct parser *p, enum filter_relop op, const struct operand *a, const struct operand *b)
+{
+  struct dds_filter_expr * const expr = p->expr;
+  static const enum filter_relop mirror[] = {
+    [FR_EQ] = FR_EQ, [FR_NE] = FR_NE, [FR_LT] = FR_GT, [FR_LE] = FR_GE, [FR_GT] = FR_LT, [FR_GE] = FR_LE, [FR_LIKE] = FR_LIKE
+  };
+  dds_return_t ret;
+  if (!a->is_field)
+  {
+    /* FIELDNAME RelOp Parameter, Parameter RelOp FIELDNAME, FIELDNAME RelOp FIELDNAME */
+    if (!b->is_field || op == FR_LIKE)
+      return DDS_RETCODE_BAD_PARAMETER;
+    const struct operand * const tmp = a; a = b; b = tmp;
+    op = mirror[op];
+  }
+
+  struct filter_pred pred = { .op = op, .field = a->field, .rhs_is_field = b->is_field, .rhs_field = 0 };
+  const struct filter_field * const fa = &expr->fields[a->field];
+  if (b->is_field)
+  {
+    if ((fa->kind == FK_STRING) != (expr->fields[b->field].kind == FK_STRING))
+      return DDS_RETCODE_BAD_PARAMETER;
+    pred.rhs_field = b->field;
+  }
+  else if ((ret = convert_literal (p, fa, &b->lit, &pred.rhs)) != DDS_RETCODE_OK)
+  {
+    return ret;
+  }
+  if (op == FR_LIKE && fa->kind != FK_STRING)
+    return DDS_RETCODE_BAD_PARAMETER;
+
+  if (expr->npreds == expr->size_preds)
+  {
+    expr->size_preds = (expr->size_preds == 0) ? 4 : 2 * expr->size_preds;
+    expr->preds = ddsrt_realloc (expr->preds, expr->size_preds * sizeof (*expr->preds));
+  }
+  expr->preds[expr->npreds] = pred;
+  (void) emit (p, FOP_TEST, expr->npreds++);
+  return DDS_RETCODE_OK;
+}
+
+static dds_return_t parse_or (struct parser *p);
+
+static dds_return_t parse_predicate (struct parser *p)
+{
+  struct operand a, b;
+  dds_return_t ret;
+  if ((ret = parse_operand (p, &a)) != DDS_RETCODE_OK)
+    return ret;
+
+  bool negate = false;
+  if (p->tok.kind == TK_NOT)
+  {
+    next (p);
+    if (p->tok.kind != TK_BETWEEN)
+      return DDS_RETCODE_BAD_PARAMETER;
+    negate = true;
+  }
+  if (p->tok.kind == TK_BETWEEN)
+  {
+    /* FIELDNAME [NOT] BETWEEN lo AND hi = [NOT] (FIELDNAME >= lo AND FIELDNAME <= hi) */
+    struct operand c;
+    next (p);
+    if (!a.is_field)
+      return DDS_RETCODE_BAD_PARAMETER;
+    if ((ret = parse_operand (p, &b)) != DDS_RETCODE_OK)
+      return ret;
+    if (p->tok.kind != TK_AND)
+      return DDS_RETCODE_BAD_PARAMETER;
+    next (p);
+    if ((ret = parse_operand (p, &c)) != DDS_RETCODE_OK)
+      return ret;
+    if ((ret = emit_test (p, FR_GE, &a, &b)) != DDS_RETCODE_OK)
+      return ret;
+    const uint32_t jf = emit (p, FOP_JF, UINT32_MAX);
+    if ((ret = emit_test (p, FR_LE, &a, &c)) != DDS_RETCODE_OK)
+      return ret;
+    patch_jumps (p, jf, p->expr->ninsns);
+    if (negate)
+      (void) emit (p, FOP_NOT, 0);
+    return DDS_RETCODE_OK;
+  }
+
+  enum filter_relop op;
+  switch (p->tok.kind)
+  {
+    case TK_EQ: op = FR_EQ; break;
+    case TK_NE: op = FR_NE; break;
+    case TK_LT: op = FR_LT; break;
+    case TK_LE: op = FR_LE; break;
+    case TK_GT: op = FR_GT; break;
+    case TK_GE: op = FR_GE; break;
+    case TK_LIKE: op = FR_LIKE; break;
+    default: return DDS_RETCODE_BAD_PARAMETER;
+  }
+  next (p);
+  if ((ret = parse_operand (p, &b)) != DDS_RETCODE_OK)
+    return ret;
+  return emit_test (p, op, &a, &b);
+}
+
+static dds_return_t parse_not (struct parser *p)
+{
+  dds_return_t ret;
+  if (p->tok.kind == TK_NOT)
+  {
+    next (p);
+    if ((ret = parse_not (p)) != DDS_RETCODE_OK)
+      return ret;
+    (void) emit (p, FOP_NOT, 0);
+    return DDS_RETCODE_OK;
+  }
+  else if (p->tok.kind == TK_LPAREN)
+  {
+    next (p);
+    if ((ret = parse_or (p)) != DDS_RETCODE_OK)
+      return ret;
+    if (p->tok.kind != TK_RPAREN)
+      return DDS_RETCODE_BAD_PARAMETER;
+    next (p);
+    return DDS_RETCODE_OK;
+  }
+  else
+  {
+    return parse_predicate (p);
+  }
+}
+
+static dds_return_t parse_and (struct parser *p)
+{
+  dds_return_t ret;
+  uint32_t chain = UINT32_MAX;
+  if ((ret = parse_not (p)) != DDS_RETCODE_OK)
+    return ret;
+  while (p->tok.kind == TK_AND)
+  {
+    next (p);
+    chain = emit (p, FOP_JF, chain);
+    if ((ret = parse_not (p)) != DDS_RETCODE_OK)
+      return ret;
+  }
+  patch_jumps (p, chain, p->expr->ninsns);
+  return DDS_RETCODE_OK;
+}
+
+static dds_return_t parse_or (struct parser *p)
+{
+  dds_return_t ret;
+  uint32_t chain = UINT32_MAX;
+  if ((ret = parse_and (p)) != DDS_RETCODE_OK)
+    return ret;
+  while (p->tok.kind == TK_OR)
+  {
+    next (p);
+    chain = emit (p, FOP_JT, chain);
+    if ((ret = parse_and (p)) != DDS_RETCODE_OK)
+      return ret;
+  }
+  patch_jumps (p, chain, p->expr->ninsns);
+  return DDS_RETCODE_OK;
+}
+
+void dds_filter_expr_free (struct dds_filter_expr *expr)
+{
+  for (uint32_t i = 0; i < expr->npreds; i++)
+    if (!expr->preds[i].rhs_is_field && expr->preds[i].rhs.kind == FVK_STRING)
+      ddsrt_free ((char *) expr->preds[i].rhs.u.str.s);
+  for (uint32_t i = 0; i < expr->nfields; i++)
+    ddsrt_free (expr->fields[i].name);
+  for (uint32_t i = 0; i < expr->nparams; i++)
+    ddsrt_free (expr->params[i]);
+  ddsrt_free (expr->params);
+  ddsrt_free (expr->refs);
+  ddsrt_free (expr->preds);
+  ddsrt_free (expr->insns);
+  ddsrt_free (expr->expression);
+  ddsrt_free (expr);
+}
+
+dds_return_t dds_filter_expr_compile (struct dds_filter_expr **expr, const struct ddsi_sertype *type, const char *expression, uint32_t nparams, const char * const *params)
+{
+  if (expression == NULL || nparams > DDS_FILTER_EXPR_MAX_PARAMS || (nparams > 0 && params == NULL))
+    return DDS_RETCODE_BAD_PARAMETER;
+  for (uint32_t i = 0; i < nparams; i++)
+    if (params[i] == NULL)
+      return DDS_RETCODE_BAD_PARAMETER;
+#ifndef DDS_HAS_TYPE_DISCOVERY
+  (void) expr; (void) type;
+  return DDS_RETCODE_UNSUPPORTED;
+#else
+  /* field names are only known from the type information */
+  if (type->ops != &dds_sertype_ops_default)
+    return DDS_RETCODE_UNSUPPORTED;
+  ddsi_typeinfo_t *typeinfo = ddsi_sertype_typeinfo (type);
+  if (typeinfo == NULL)
+    return DDS_RETCODE_UNSUPPORTED;
+  ddsi_typemap_t *typemap = ddsi_sertype_typemap (type);
+  if (typemap == NULL)
+  {
+    ddsi_typeinfo_fini (typeinfo);
+    ddsrt_free (typeinfo);
+    return DDS_RETCODE_UNSUPPORTED;
+  }
+
+  struct dds_filter_expr *x = ddsrt_calloc (1, sizeof (*x));
+  x->expression = ddsrt_strdup (expression);
+  x->nparams = nparams;
+  x->params = ddsrt_malloc ((nparams > 0 ? nparams : 1) * sizeof (*x->params));
+  for (uint32_t i = 0; i < nparams; i++)
+    x->params[i] = ddsrt_strdup (params[i]);
+  x->ops = ((const struct dds_sertype_default *) type)->type.ops.ops;
+  x->fixed[0] = x->fixed[1] = true;
+  x->delimited = (DDS_OP (x->ops[0]) == DDS_OP_DLC);
+  x->refs = ddsrt_malloc (DDS_FILTER_EXPR_MAX_FIELDS * sizeof (*x->refs));
+
+  struct parser p = {
+    .pos = x->expression, .nparams = nparams, .params = (const char * const *) x->params,
+    .typemap = typemap, .type_id = ddsi_typeinfo_complete_typeid (typeinfo), .expr = x
+  };
+  dds_return_t ret;
+  next (&p);
+  if (p.tok.kind == TK_END)
+    ret = DDS_RETCODE_BAD_PARAMETER;
+  else if ((ret = parse_or (&p)) == DDS_RETCODE_OK && p.tok.kind != TK_END)
+    ret = DDS_RETCODE_BAD_PARAMETER;
+
+  ddsi_typemap_fini (typemap);
+  ddsrt_free (typemap);
+  ddsi_typeinfo_fini (typeinfo);
+  ddsrt_free (typeinfo);
+  if (ret != DDS_RETCODE_OK)
+  {
+    dds_filter_expr_free (x);
+    return ret;
+  }
+  *expr = x;
+  return DDS_RETCODE_OK;
+#endif
+}
+
+const char *dds_filter_expr_expression (const struct dds_filter_expr *expr)
+{
+  return expr->expression;
+}
+
+uint32_t dds_filter_expr_parameters (const struct dds_filter_expr *expr, const char * const **params)
+{
+  *params = (const char * const *) expr->params;
+  return expr->nparams;
+}
@@ -313,6 +313,31 @@ void dds_qset_ignorelocal (dds_qos_t * __restrict qos, dds_ignorelocal_kind_t ig
   qos->present |= DDSI_QP_CYCLONE_IGNORELOCAL;
 }
 
+void dds_qset_instance_shard (dds_qos_t * __restrict qos, uint32_t index, uint32_t count)
+{
+  if (qos == NULL)
+    return;
+  qos->instance_shard.index = index;
+  qos->instance_shard.count = count;
+  qos->present |= DDSI_QP_CYCLONE_INSTANCE_SHARD;
+}
+
+void dds_qset_reader_loan_pool (dds_qos_t * __restrict qos, uint32_t depth)
+{
+  if (qos == NULL)
+    return;
+  qos->reader_loan_pool.depth = depth;
+  qos->present |= DDSI_QP_CYCLONE_READER_LOAN_POOL;
+}
+
+void dds_qset_reader_stream (dds_qos_t * __restrict qos, uint32_t capacity)
+{
+  if (qos == NULL)
+    return;
+  qos->reader_stream.capacity = capacity;
+  qos->present |= DDSI_QP_CYCLONE_READER_STREAM;
+}
+
 static void dds_qprop_init (dds_qos_t * qos)
 {
   if (!(qos->present & DDSI_QP_PROPERTY_LIST))
@@ -700,6 +725,35 @@ bool dds_qget_ignorelocal (const dds_qos_t * __restrict qos, dds_ignorelocal_kin
   return true;
 }
 
+bool dds_qget_instance_shard (const dds_qos_t * __restrict qos, uint32_t *index, uint32_t *count)
+{
+  if (qos == NULL || !(qos->present & DDSI_QP_CYCLONE_INSTANCE_SHARD))
+    return false;
+  if (index)
+    *index = qos->instance_shard.index;
+  if (count)
+    *count = qos->instance_shard.count;
+  return true;
+}
+
+bool dds_qget_reader_loan_pool (const dds_qos_t * __restrict qos, uint32_t *depth)
+{
+  if (qos == NULL || !(qos->present & DDSI_QP_CYCLONE_READER_LOAN_POOL))
+    return false;
+  if (depth)
+    *depth = qos->reader_loan_pool.depth;
+  return true;
+}
+
+bool dds_qget_reader_stream (const dds_qos_t * __restrict qos, uint32_t *capacity)
+{
+  if (qos == NULL || !(qos->present & DDSI_QP_CYCLONE_READER_STREAM))
+    return false;
+  if (capacity)
+    *capacity = qos->reader_stream.capacity;
+  return true;
+}
+
 #define DDS_QGET_PROPNAMES(prop_type_, prop_field_) \
 bool dds_qget_##prop_type_##names (const dds_qos_t * __restrict qos, uint32_t * n, char *** names) \
 { \
@@ -17,6 +17,7 @@
 #include "dds__reader.h"
 #include "dds__topic.h"
 #include "dds__readcond.h"
+#include "dds__rhc_stream.h"
 #include "dds/ddsi/ddsi_serdata.h"
 
 dds_entity_t dds_create_querycondition (dds_entity_t reader, uint32_t mask, dds_querycondition_filter_fn filter)
@@ -26,6 +27,11 @@ dds_entity_t dds_create_querycondition (dds_entity_t reader, uint32_t mask, dds_
 
   if ((rc = dds_reader_lock (reader, &r)) != DDS_RETCODE_OK)
     return rc;
+  else if (dds_rhc_is_stream (r->m_rhc))
+  {
+    dds_reader_unlock (r);
+    return DDS_RETCODE_ILLEGAL_OPERATION;
+  }
   else
   {
     dds_entity_t hdl;
@@ -13,6 +13,9 @@
 #include <string.h>
 #include "dds__entity.h"
 #include "dds__reader.h"
+#include "dds__serdata_default.h"
+#include "dds__sample_arena.h"
+#include "dds__rhc_stream.h"
 #include "dds/ddsi/ddsi_tkmap.h"
 #include "dds/ddsc/dds_rhc.h"
 #include "dds/ddsi/ddsi_thread.h"
@@ -23,6 +26,24 @@
 
 #include "dds/ddsc/dds_loan_api.h"
 
+/* Selects a loan buffer that isn't out to lend for reading maxs samples: preferably one
+   that is large enough, then any allocated one, then an unused one; null if all are out */
+static struct dds_reader_loan *find_free_loan (struct dds_reader *rd, uint32_t maxs)
+{
+  struct dds_reader_loan *best = NULL;
+  for (uint32_t i = 0; i < rd->m_nloans; i++)
+  {
+    struct dds_reader_loan * const loan = &rd->m_loans[i];
+    if (loan->out)
+      continue;
+    else if (loan->buf && loan->size >= maxs)
+      return loan;
+    else if (best == NULL || (loan->buf && best->buf == NULL))
+      best = loan;
+  }
+  return best;
+}
+
 /*
   dds_read_impl: Core read/take function. Usually maxs is size of buf and si
   into which samples/status are written, when set to zero is special case
@@ -36,6 +57,7 @@ static dds_return_t dds_read_impl (bool take, dds_entity_t reader_or_condition,
   struct dds_entity *entity;
   struct dds_reader *rd;
   struct dds_readcond *cond;
+  struct dds_reader_loan *loan = NULL;
   unsigned nodata_cleanups = 0;
 #define NC_CLEAR_LOAN_OUT 1u
 #define NC_FREE_BUF 2u
@@ -66,35 +88,35 @@ static dds_return_t dds_read_impl (bool take, dds_entity_t reader_or_condition,
   /* Allocate samples if not provided (assuming all or none provided) */
   if (buf[0] == NULL)
   {
-    /* Allocate, use or reallocate loan cached on reader */
+    /* Allocate, use or reallocate a loan cached on reader */
     ddsrt_mutex_lock (&rd->m_entity.m_mutex);
-    if (rd->m_loan_out)
+    if ((loan = find_free_loan (rd, maxs)) == NULL)
     {
       ddsi_sertype_realloc_samples (buf, rd->m_topic->m_stype, NULL, 0, maxs);
       nodata_cleanups = NC_FREE_BUF | NC_RESET_BUF;
     }
     else
     {
-      if (rd->m_loan)
+      if (loan->buf)
       {
-        if (rd->m_loan_size >= maxs)
+        if (loan->size >= maxs)
         {
           /* This ensures buf is properly initialized */
-          ddsi_sertype_realloc_samples (buf, rd->m_topic->m_stype, rd->m_loan, rd->m_loan_size, rd->m_loan_size);
+          ddsi_sertype_realloc_samples (buf, rd->m_topic->m_stype, loan->buf, loan->size, loan->size);
         }
         else
         {
-          ddsi_sertype_realloc_samples (buf, rd->m_topic->m_stype, rd->m_loan, rd->m_loan_size, maxs);
-          rd->m_loan_size = maxs;
+          ddsi_sertype_realloc_samples (buf, rd->m_topic->m_stype, loan->buf, loan->size, maxs);
+          loan->size = maxs;
         }
       }
       else
       {
         ddsi_sertype_realloc_samples (buf, rd->m_topic->m_stype, NULL, 0, maxs);
-        rd->m_loan_size = maxs;
+        loan->size = maxs;
       }
-      rd->m_loan = buf[0];
-      rd->m_loan_out = true;
+      loan->buf = buf[0];
+      loan->out = true;
       nodata_cleanups = NC_RESET_BUF | NC_CLEAR_LOAN_OUT;
     }
     ddsrt_mutex_unlock (&rd->m_entity.m_mutex);
@@ -114,12 +136,12 @@ static dds_return_t dds_read_impl (bool take, dds_entity_t reader_or_condition,
 
   /* if no data read, restore the state to what it was before the call, with the sole
      exception of holding on to a buffer we just allocated and that is pointed to by
-     rd->m_loan */
+     the loan */
   if (ret <= 0 && nodata_cleanups)
   {
     ddsrt_mutex_lock (&rd->m_entity.m_mutex);
     if (nodata_cleanups & NC_CLEAR_LOAN_OUT)
-      rd->m_loan_out = false;
+      loan->out = false;
     if (nodata_cleanups & NC_FREE_BUF)
       ddsi_sertype_free_samples (rd->m_topic->m_stype, buf, maxs, DDS_FREE_ALL);
     if (nodata_cleanups & NC_RESET_BUF)
@@ -395,6 +417,101 @@ dds_return_t dds_takecdr (dds_entity_t rd_or_cnd, struct ddsi_serdata **buf, uin
   return dds_readcdr_impl (true, rd_or_cnd, buf, maxs, si, mask, DDS_HANDLE_NIL, lock);
 }
 
+dds_return_t dds_take_arena (dds_entity_t reader, void **buf, dds_sample_info_t *si, uint32_t maxs, uint32_t mask, dds_sample_arena_t *arena)
+{
+  dds_return_t ret;
+  struct dds_entity *entity;
+
+  if (buf == NULL || si == NULL || arena == NULL || maxs == 0 || maxs > INT32_MAX)
+    return DDS_RETCODE_BAD_PARAMETER;
+  if ((ret = dds_entity_pin (reader, &entity)) < 0)
+    return ret;
+  if (dds_entity_kind (entity) != DDS_KIND_READER)
+  {
+    dds_entity_unpin (entity);
+    return DDS_RETCODE_ILLEGAL_OPERATION;
+  }
+  const struct ddsi_sertype *type = ((struct dds_reader *) entity)->m_topic->m_stype;
+  if (type->ops != &dds_sertype_ops_default)
+  {
+    dds_entity_unpin (entity);
+    return DDS_RETCODE_UNSUPPORTED;
+  }
+
+  /* buf doubles as the array of serdata references, each of which is replaced by the
+     sample deserialized from it.  The samples have been taken from the reader already,
+     so one that can't be deserialized is dropped and the others are moved up to close
+     the gap. */
+  struct ddsi_serdata **sds = (struct ddsi_serdata **) buf;
+  if ((ret = dds_readcdr_impl (true, reader, sds, maxs, si, mask, DDS_HANDLE_NIL, true)) > 0)
+  {
+    const int32_t n = ret;
+    int32_t m = 0;
+    for (int32_t i = 0; i < n; i++)
+    {
+      struct ddsi_serdata *sd = sds[i];
+      void *sample = dds_sample_arena_deserialize (arena, type, sd, si[i].valid_data);
+      ddsi_serdata_unref (sd);
+      if (sample != NULL)
+      {
+        si[m] = si[i];
+        buf[m++] = sample;
+      }
+    }
+    for (int32_t i = m; i < n; i++)
+    {
+      buf[i] = NULL;
+      memset (&si[i], 0, sizeof (si[i]));
+    }
+    if (m < n)
+      DDS_CWARNING (&entity->m_domain->gv.logconfig, "dds_take_arena: dropped %"PRId32" samples that could not be deserialized\n", n - m);
+    ret = (m > 0) ? m : DDS_RETCODE_ERROR;
+  }
+  dds_entity_unpin (entity);
+  return ret;
+}
+
+static dds_return_t dds_take_stream_impl (dds_entity_t reader, void **buf, struct ddsi_serdata **cdrbuf, uint32_t maxs)
+{
+  dds_return_t ret;
+  struct dds_entity *entity;
+
+  if ((ret = dds_entity_pin (reader, &entity)) < 0)
+    return ret;
+  struct dds_reader * const rd = (struct dds_reader *) entity;
+  if (dds_entity_kind (entity) != DDS_KIND_READER || !dds_rhc_is_stream (rd->m_rhc))
+  {
+    dds_entity_unpin (entity);
+    return DDS_RETCODE_ILLEGAL_OPERATION;
+  }
+
+  /* same as dds_read_impl: must reset before taking */
+  const uint32_t sm_old = dds_entity_status_reset_ov (&rd->m_entity, DDS_DATA_AVAILABLE_STATUS);
+  if (sm_old & (DDS_DATA_ON_READERS_STATUS << SAM_ENABLED_SHIFT))
+    dds_entity_status_reset (rd->m_entity.m_parent, DDS_DATA_ON_READERS_STATUS);
+
+  if (cdrbuf)
+    ret = dds_rhc_stream_take_serdata (rd->m_rhc, cdrbuf, maxs);
+  else
+    ret = dds_rhc_stream_take_samples (rd->m_rhc, buf, maxs);
+  dds_entity_unpin (entity);
+  return ret;
+}
+
+dds_return_t dds_take_stream (dds_entity_t reader, void **buf, uint32_t maxs)
+{
+  if (buf == NULL || buf[0] == NULL || maxs == 0 || maxs > INT32_MAX)
+    return DDS_RETCODE_BAD_PARAMETER;
+  return dds_take_stream_impl (reader, buf, NULL, maxs);
+}
+
+dds_return_t dds_takecdr_stream (dds_entity_t reader, struct ddsi_serdata **buf, uint32_t maxs)
+{
+  if (buf == NULL || maxs == 0 || maxs > INT32_MAX)
+    return DDS_RETCODE_BAD_PARAMETER;
+  return dds_take_stream_impl (reader, NULL, buf, maxs);
+}
+
 dds_return_t dds_take_instance (dds_entity_t rd_or_cnd, void **buf, dds_sample_info_t *si, size_t bufsz, uint32_t maxs, dds_instance_handle_t handle)
 {
   bool lock = true;
@@ -506,14 +623,20 @@ dds_return_t dds_return_reader_loan (dds_reader *rd, void **buf, int32_t bufsz)
      the observer_lock), so holding it for a bit longer in return for simpler
      code is a fair trade-off. */
   ddsrt_mutex_lock (&rd->m_entity.m_mutex);
-  if (buf[0] != rd->m_loan)
+  struct dds_reader_loan *loan = NULL;
+  for (uint32_t i = 0; i < rd->m_nloans && loan == NULL; i++)
+  {
+    if (buf[0] == rd->m_loans[i].buf)
+      loan = &rd->m_loans[i];
+  }
+  if (loan == NULL)
   {
     /* Not so much a loan as a buffer allocated by the middleware on behalf of the
        application.  So it really is no more than a sophisticated variant of "free". */
     ddsi_sertype_free_samples (st, buf, (size_t) bufsz, DDS_FREE_ALL);
     buf[0] = NULL;
   }
-  else if (!rd->m_loan_out)
+  else if (!loan->out)
   {
     /* Trying to return a loan that has been returned already */
     ddsrt_mutex_unlock (&rd->m_entity.m_mutex);
@@ -525,8 +648,8 @@ dds_return_t dds_return_reader_loan (dds_reader *rd, void **buf, int32_t bufsz)
        Zero them to guarantee the absence of dangling pointers that might cause
        trouble on a following operation.  FIXME: there's got to be a better way */
     ddsi_sertype_free_samples (st, buf, (size_t) bufsz, DDS_FREE_CONTENTS);
-    ddsi_sertype_zero_samples (st, rd->m_loan, rd->m_loan_size);
-    rd->m_loan_out = false;
+    ddsi_sertype_zero_samples (st, loan->buf, loan->size);
+    loan->out = false;
     buf[0] = NULL;
   }
   ddsrt_mutex_unlock (&rd->m_entity.m_mutex);
@@ -13,6 +13,7 @@
 #include "dds__reader.h"
 #include "dds__readcond.h"
 #include "dds/ddsc/dds_rhc.h"
+#include "dds__rhc_stream.h"
 #include "dds__entity.h"
 #include "dds/ddsi/ddsi_iid.h"
 #include "dds/ddsi/ddsi_entity_index.h"
@@ -71,6 +72,12 @@ dds_entity_t dds_create_readcondition (dds_entity_t reader, uint32_t mask)
   dds_return_t rc;
   if ((rc = dds_reader_lock (reader, &rd)) != DDS_RETCODE_OK)
     return rc;
+  else if (dds_rhc_is_stream (rd->m_rhc))
+  {
+    /* a stream reader doesn't track sample states */
+    dds_reader_unlock (rd);
+    return DDS_RETCODE_ILLEGAL_OPERATION;
+  }
   else
   {
     dds_entity_t hdl;
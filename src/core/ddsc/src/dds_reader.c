@@ -22,6 +22,7 @@
 #include "dds__init.h"
 #include "dds/ddsc/dds_rhc.h"
 #include "dds__rhc_default.h"
+#include "dds__rhc_stream.h"
 #include "dds__topic.h"
 #include "dds__get_status.h"
 #include "dds__qos.h"
@@ -91,13 +92,18 @@ static dds_return_t dds_reader_delete (dds_entity *e)
 {
   dds_reader * const rd = (dds_reader *) e;
 
-  if (rd->m_loan)
+  for (uint32_t i = 0; i < rd->m_nloans; i++)
   {
-    void **ptrs = ddsrt_malloc (rd->m_loan_size * sizeof (*ptrs));
-    ddsi_sertype_realloc_samples (ptrs, rd->m_topic->m_stype, rd->m_loan, rd->m_loan_size, rd->m_loan_size);
-    ddsi_sertype_free_samples (rd->m_topic->m_stype, ptrs, rd->m_loan_size, DDS_FREE_ALL);
-    ddsrt_free (ptrs);
+    struct dds_reader_loan * const loan = &rd->m_loans[i];
+    if (loan->buf)
+    {
+      void **ptrs = ddsrt_malloc (loan->size * sizeof (*ptrs));
+      ddsi_sertype_realloc_samples (ptrs, rd->m_topic->m_stype, loan->buf, loan->size, loan->size);
+      ddsi_sertype_free_samples (rd->m_topic->m_stype, ptrs, loan->size, DDS_FREE_ALL);
+      ddsrt_free (ptrs);
+    }
   }
+  dds_free (rd->m_loans);
 
   ddsi_thread_state_awake (ddsi_lookup_thread_state (), &e->m_domain->gv);
   dds_rhc_free (rd->m_rhc);
@@ -141,6 +147,8 @@ static dds_return_t dds_reader_qos_set (dds_entity *e, const dds_qos_t *qos, boo
     ddsi_thread_state_awake (ddsi_lookup_thread_state (), &e->m_domain->gv);
     if ((rd = ddsi_entidx_lookup_reader_guid (e->m_domain->gv.entity_index, &e->m_guid)) != NULL)
       ddsi_update_reader_qos (rd, qos);
+    /* the reader history cache implements the time-based filter */
+    dds_rhc_set_qos (((struct dds_reader *) e)->m_rhc, qos);
     ddsi_thread_state_asleep (ddsi_lookup_thread_state ());
   }
   return DDS_RETCODE_OK;
@@ -438,7 +446,11 @@ void dds_reader_status_cb (void *ventity, const ddsi_status_cb_data_t *data)
 }
 
 static const struct dds_stat_keyvalue_descriptor dds_reader_statistics_kv[] = {
-  { "discarded_bytes", DDS_STAT_KIND_UINT64 }
+  { "discarded_bytes", DDS_STAT_KIND_UINT64 },
+  { "rhc_instance_pool_size", DDS_STAT_KIND_UINT32 },
+  { "rhc_instance_pool_used", DDS_STAT_KIND_UINT32 },
+  { "rhc_sample_pool_size", DDS_STAT_KIND_UINT32 },
+  { "rhc_sample_pool_used", DDS_STAT_KIND_UINT32 }
 };
 
 static const struct dds_stat_descriptor dds_reader_statistics_desc = {
@@ -456,6 +468,15 @@ static void dds_reader_refresh_statistics (const struct dds_entity *entity, stru
   const struct dds_reader *rd = (const struct dds_reader *) entity;
   if (rd->m_rd)
     ddsi_get_reader_stats (rd->m_rd, &stat->kv[0].u.u64);
+  if (rd->m_rhc)
+  {
+    struct dds_rhc_stats rhcst;
+    dds_rhc_get_stats (rd->m_rhc, &rhcst);
+    stat->kv[1].u.u32 = rhcst.instance_pool_size;
+    stat->kv[2].u.u32 = rhcst.instance_pool_used;
+    stat->kv[3].u.u32 = rhcst.sample_pool_size;
+    stat->kv[4].u.u32 = rhcst.sample_pool_used;
+  }
 }
 
 const struct dds_entity_deriver dds_entity_deriver_reader = {
@@ -643,6 +664,13 @@ static dds_entity_t dds_create_reader_int (dds_entity_t participant_or_subscribe
     goto err_bad_qos;
   }
 
+  /* A stream reader has no notion of instances and can't discard samples to make room */
+  if ((rqos->present & DDSI_QP_CYCLONE_READER_STREAM) && !(tp->m_stype->typekind_no_key && rqos->history.kind == DDS_HISTORY_KEEP_ALL))
+  {
+    rc = DDS_RETCODE_INCONSISTENT_POLICY;
+    goto err_bad_qos;
+  }
+
   ddsi_thread_state_awake (ddsi_lookup_thread_state (), gv);
   const struct ddsi_guid * ppguid = dds_entity_participant_guid (&sub->m_entity);
   struct ddsi_participant * pp = ddsi_entidx_lookup_participant_guid (gv->entity_index, ppguid);
@@ -676,7 +704,14 @@ static dds_entity_t dds_create_reader_int (dds_entity_t participant_or_subscribe
   ddsrt_atomic_or32 (&rd->m_entity.m_status.m_status_and_mask, DDS_DATA_ON_READERS_STATUS << SAM_ENABLED_SHIFT);
   rd->m_sample_rejected_status.last_reason = DDS_NOT_REJECTED;
   rd->m_topic = tp;
-  rd->m_rhc = rhc ? rhc : dds_rhc_default_new (rd, tp->m_stype);
+  rd->m_nloans = (rqos->present & DDSI_QP_CYCLONE_READER_LOAN_POOL) ? rqos->reader_loan_pool.depth : 1;
+  rd->m_loans = dds_alloc (rd->m_nloans * sizeof (*rd->m_loans));
+  if (rhc)
+    rd->m_rhc = rhc;
+  else if (rqos->present & DDSI_QP_CYCLONE_READER_STREAM)
+    rd->m_rhc = dds_rhc_stream_new (rd, rqos->reader_stream.capacity);
+  else
+    rd->m_rhc = dds_rhc_default_new (rd, tp->m_stype);
   if (dds_rhc_associate (rd->m_rhc, rd, tp->m_stype, rd->m_entity.m_domain->gv.m_tkmap) < 0)
   {
     /* FIXME: see also create_querycond, need to be able to undo entity_init */
@@ -27,3 +27,4 @@ DDS_EXPORT extern inline int32_t dds_rhc_takecdr (struct dds_rhc *rhc, bool lock
 DDS_EXPORT extern inline bool dds_rhc_add_readcondition (struct dds_rhc *rhc, struct dds_readcond *cond);
 DDS_EXPORT extern inline void dds_rhc_remove_readcondition (struct dds_rhc *rhc, struct dds_readcond *cond);
 DDS_EXPORT extern inline uint32_t dds_rhc_lock_samples (struct dds_rhc *rhc);
+DDS_EXPORT extern inline void dds_rhc_get_stats (struct dds_rhc *rhc, struct dds_rhc_stats *stats);
@@ -27,10 +27,12 @@
 #include "dds__reader.h"
 #include "dds/ddsc/dds_rhc.h"
 #include "dds__rhc_default.h"
+#include "dds__filter_expr.h"
 #include "dds/ddsi/ddsi_tkmap.h"
 #include "dds/ddsrt/hopscotch.h"
 #include "dds/ddsrt/avl.h"
 #include "dds/ddsrt/circlist.h"
+#include "dds/ddsrt/fibheap.h"
 #include "dds/ddsi/ddsi_rhc.h"
 #include "dds/ddsi/ddsi_xqos.h"
 #include "dds/ddsi/ddsi_unused.h"
@@ -38,6 +40,8 @@
 #include "dds/ddsi/ddsi_radmin.h" /* sampleinfo */
 #include "dds/ddsi/ddsi_entity.h"
 #include "dds/ddsi/ddsi_serdata.h"
+#include "dds/ddsi/ddsi_thread.h"
+#include "dds/ddsi/ddsi_xevent.h"
 #ifdef DDS_HAS_LIFESPAN
 #include "dds/ddsi/ddsi_lifespan.h"
 #endif
@@ -259,7 +263,6 @@ struct rhc_instance {
   dds_querycond_mask_t conds;  /* matching query conditions */
   uint32_t wrcount;            /* number of live writers */
   unsigned isnew : 1;          /* NEW or NOT_NEW view state */
-  unsigned a_sample_free : 1;  /* whether or not a_sample is in use */
   unsigned isdisposed : 1;     /* DISPOSED or NOT_DISPOSED (if not disposed, wrcount determines ALIVE/NOT_ALIVE_NO_WRITERS) */
   unsigned autodispose : 1;    /* wrcount > 0 => at least one registered writer has had auto-dispose set on some update */
   unsigned wr_iid_islive : 1;  /* whether wr_iid is of a live writer */
@@ -276,9 +279,106 @@ struct rhc_instance {
   struct deadline_elem deadline; /* element in deadline missed administration */
 #endif
   struct ddsi_tkmap_instance *tk;/* backref into TK for unref'ing */
-  struct rhc_sample a_sample;  /* pre-allocated storage for 1 sample */
+  struct rhc_wrreg *wrregs;    /* writers that (may) have registered this instance */
+  ddsrt_mtime_t tbf_tnext;     /* time-based filter: earliest time at which a sample will be stored */
+  struct rhc_tbf_deferred *tbf_deferred; /* latest sample held back by the time-based filter, or NULL */
+  struct rhc_instance_slab *slab; /* slab from which this instance was allocated */
+  uint32_t inline_free;        /* bit mask of unused entries in inline_samples */
+  struct rhc_sample inline_samples[]; /* pre-allocated storage for rhc->n_inline_samples samples */
 };
 
+/* Instances are allocated in slabs of RHC_INSTANCES_PER_SLAB, with room for the first
+   few samples of each instance in the instance itself, so that walking over the instances
+   and their samples touches far fewer cache lines than when each of them is allocated
+   separately.  Slabs in which some instances are free are linked in a list, a slab is
+   returned to the heap once all its instances have been freed, unless it is the only
+   one with free instances or the reader has reserved it.  The number of slabs reserved
+   (and allocated up front) follows from the max_instances resource limit.
+
+   Samples that don't fit in the instance come from a per-reader free list, which is
+   filled up front if the max_samples resource limit is set and otherwise only retains
+   up to RHC_SAMPLE_POOL_RETAIN samples.  That way a reader with resource limits doesn't
+   hit the heap at all when storing and taking in the steady state. */
+#define RHC_INSTANCES_PER_SLAB 32
+#define RHC_MAX_INLINE_SAMPLES 8
+#define RHC_PREWARM_MAX_INSTANCES 4096
+#define RHC_PREWARM_MAX_SAMPLES 4096
+#define RHC_SAMPLE_POOL_RETAIN 256
+
+struct rhc_instance_free {
+  struct rhc_instance_free *next;
+};
+
+struct rhc_sample_free {
+  struct rhc_sample_free *next;
+};
+
+struct rhc_instance_slab {
+  struct rhc_instance_slab *prev, *next; /* slabs with free instances */
+  struct rhc_instance_free *free;
+  uint32_t ninuse;
+  /* instances follow at offset RHC_SLAB_HEADER_SIZE */
+};
+
+#define RHC_ALIGN(x) (((x) + 15) & ~(size_t) 15)
+#define RHC_SLAB_HEADER_SIZE RHC_ALIGN (sizeof (struct rhc_instance_slab))
+
+/* Read and query conditions with the same sample, view and instance state masks have the
+   same "read condition" part, so when an instance changes state, that part only needs to
+   be evaluated once for all of them, and a store only needs to look at the conditions in
+   the groups for which it may have changed.  Query conditions in a group that matched
+   before and after the update only need to be looked at if the update touched samples
+   matching their filter. */
+struct rhc_condgroup {
+  struct rhc_condgroup *next;
+  uint32_t qminv;                    /* m_qminv of all conditions in this group */
+  uint32_t sample_states;            /* m_sample_states of all conditions in this group */
+  uint32_t nconds, size;
+  dds_readcond **conds;
+};
+
+/* Distinct query condition filters: conditions using the same filter function get the
+   result of a single evaluation, and a sample is only deserialized once for evaluating
+   all filters */
+#define RHC_MAX_QCFILTERS (8 * sizeof (dds_querycond_mask_t))
+
+struct rhc_qcfilter {
+  dds_querycondition_filter_fn filter;
+  dds_querycond_mask_t qcmask;       /* query conditions using this filter */
+};
+
+/* A sample waiting to be stored: delivery threads queue plain writes here instead of
+   blocking when an application thread holds the RHC lock, and whichever thread holds
+   the lock next folds them into the history before doing anything else.  Only samples
+   for which storing can't result in anything but a DATA_AVAILABLE notification are
+   eligible, so the delivery thread can do the notification when it queues them. */
+struct rhc_staged {
+  struct rhc_staged *next;
+  struct ddsi_writer_info wrinfo;
+  struct ddsi_serdata *sample;
+  struct ddsi_tkmap_instance *tk;
+};
+
+/* Latest sample for an instance that arrived within the minimum separation of the
+   TIME_BASED_FILTER, it is stored once the separation has elapsed unless a newer one
+   arrives after that time but before the timer fires. */
+struct rhc_tbf_deferred {
+  ddsrt_fibheap_node_t heapnode;
+  ddsrt_mtime_t tsched;
+  struct rhc_instance *inst;
+  struct ddsi_writer_info wrinfo;
+  struct ddsi_serdata *sample;
+};
+
+static int compare_tbf_deferred (const void *va, const void *vb)
+{
+  const struct rhc_tbf_deferred *a = va;
+  const struct rhc_tbf_deferred *b = vb;
+  return (a->tsched.v == b->tsched.v) ? 0 : (a->tsched.v < b->tsched.v) ? -1 : 1;
+}
+
+static const ddsrt_fibheap_def_t tbf_deferred_fhdef = DDSRT_FIBHEAPDEF_INITIALIZER(offsetof (struct rhc_tbf_deferred, heapnode), compare_tbf_deferred);
+
 typedef enum rhc_store_result {
   RHC_STORED,
   RHC_FILTERED,
@@ -296,6 +396,7 @@ struct dds_rhc_default {
   int32_t max_instances; /* FIXME: probably better as uint32_t with MAX_UINT32 for unlimited */
   int32_t max_samples;   /* FIXME: probably better as uint32_t with MAX_UINT32 for unlimited */
   int32_t max_samples_per_instance; /* FIXME: probably better as uint32_t with MAX_UINT32 for unlimited */
+  dds_duration_t minimum_separation; /* from time-based filter QoS, 0 if disabled */
 
   uint32_t n_instances;              /* # instances, including empty */
   uint32_t n_nonempty_instances;     /* # non-empty instances */
@@ -317,11 +418,28 @@ struct dds_rhc_default {
   struct ddsi_domaingv *gv;          /* globals -- so far only for log config */
   const struct ddsi_sertype *type;   /* type description */
   uint32_t history_depth;            /* depth, 1 for KEEP_LAST_1, 2**32-1 for KEEP_ALL */
+  uint32_t n_inline_samples;         /* number of samples stored in the instance itself */
+  size_t instance_size;              /* size of an instance including inline samples */
+  struct rhc_instance_slab *partial_slabs; /* slabs with free instances */
+  uint32_t n_slabs;                  /* # instance slabs allocated */
+  uint32_t n_slabs_reserved;         /* # instance slabs that are retained even when empty */
+  struct rhc_sample_free *sample_pool; /* free samples for storing beyond the inline ones */
+  uint32_t n_pool_samples;           /* # samples in sample_pool */
+  uint32_t n_pool_samples_retain;    /* # samples sample_pool may hold before returning them to the heap */
+  uint32_t n_ool_samples;            /* # samples in use that are not stored inline */
 
   ddsrt_mutex_t lock;
+  bool staging;                      /* whether store may queue plain writes when the lock is taken */
+  uint32_t staged_lost;              /* SAMPLE_LOST events owed for staged samples that got rejected */
+  ddsrt_mutex_t staging_lock;        /* protects staged_first/staged_last */
+  ddsrt_atomic_uint32_t n_staged;    /* # samples in staging queue, may be read without staging_lock */
+  struct rhc_staged *staged_first, *staged_last;
   dds_readcond * conds;              /* List of associated read conditions */
   uint32_t nconds;                   /* Number of associated read conditions */
   uint32_t nqconds;                  /* Number of associated query conditions */
+  struct rhc_condgroup *condgroups;  /* Associated read conditions grouped by state masks */
+  uint32_t n_qcfilters;              /* Number of distinct query condition filters */
+  struct rhc_qcfilter qcfilters[RHC_MAX_QCFILTERS];
   dds_querycond_mask_t qconds_samplest;  /* Mask of associated query conditions that check the sample state */
   void *qcond_eval_samplebuf;        /* Temporary storage for evaluating query conditions, NULL if no qconds */
 #ifdef DDS_HAS_LIFESPAN
@@ -330,6 +448,9 @@ struct dds_rhc_default {
 #ifdef DDS_HAS_DEADLINE_MISSED
   struct ddsi_deadline_adm deadline; /* Deadline missed administration */
 #endif
+  ddsrt_fibheap_t tbf_heap;          /* samples deferred by time-based filter, by time they may be stored */
+  struct ddsi_xevent *tbf_evt;       /* for storing deferred samples, created when first needed */
+  struct ddsrt_hh *writers;          /* rhc_writer by wr_iid, for the instances registered by a writer */
 };
 
 struct trigger_info_cmn {
@@ -414,6 +535,8 @@ static void init_trigger_info_qcond (struct trigger_info_qcond *qc);
 static void drop_instance_noupdate_no_writers (struct dds_rhc_default * __restrict rhc, struct rhc_instance * __restrict * __restrict instptr);
 static bool update_conditions_locked (struct dds_rhc_default *rhc, bool called_from_insert, const struct trigger_info_pre *pre, const struct trigger_info_post *post, const struct trigger_info_qcond *trig_qc, const struct rhc_instance *inst);
 static void account_for_nonempty_to_empty_transition (struct dds_rhc_default * __restrict rhc, struct rhc_instance * __restrict * __restrict instptr, const char *__restrict traceprefix);
+static void rhc_fold_staged_locked (struct dds_rhc_default * __restrict rhc);
+static void rhc_unlock (struct dds_rhc_default * __restrict rhc);
 #ifndef NDEBUG
 static int rhc_check_counts_locked (struct dds_rhc_default *rhc, bool check_conds, bool check_qcmask);
 #endif
@@ -431,6 +554,100 @@ static int instance_iid_eq (const void *va, const void *vb)
   return (a->iid == b->iid);
 }
 
+/* Unregistering all instances of a writer when it is lost and relinquishing its
+   ownership only need to look at the instances it registered, not at all instances.
+   For each writer, the instances it registered are linked via rhc_wrreg nodes, and each
+   instance has a list of those nodes so they can be removed when it is freed.  The lists
+   are a superset: a node gets added when a writer registers an instance and is not
+   removed when it unregisters it, only when the instance is freed or the writer is lost.
+   That keeps the registration path cheap and bounds the number of nodes by the number of
+   (instance, known writer) pairs. */
+struct rhc_wrreg {
+  struct rhc_wrreg *wr_prev, *wr_next; /* instances of this writer */
+  struct rhc_wrreg *inst_next;         /* writers of this instance */
+  struct rhc_writer *wr;
+  struct rhc_instance *inst;
+};
+
+struct rhc_writer {
+  uint64_t wr_iid;
+  struct rhc_wrreg *regs;
+};
+
+static uint32_t rhc_writer_hash (const void *va)
+{
+  const struct rhc_writer *a = va;
+  return (uint32_t) a->wr_iid;
+}
+
+static int rhc_writer_eq (const void *va, const void *vb)
+{
+  const struct rhc_writer *a = va;
+  const struct rhc_writer *b = vb;
+  return (a->wr_iid == b->wr_iid);
+}
+
+static struct rhc_writer *rhc_writer_lookup (const struct dds_rhc_default *rhc, uint64_t wr_iid)
+{
+  const struct rhc_writer dummy = { .wr_iid = wr_iid, .regs = NULL };
+  return ddsrt_hh_lookup (rhc->writers, &dummy);
+}
+
+static void wrreg_note (struct dds_rhc_default *rhc, struct rhc_instance *inst, uint64_t wr_iid)
+{
+  struct rhc_wrreg *r;
+  struct rhc_writer *wr;
+  for (r = inst->wrregs; r; r = r->inst_next)
+    if (r->wr->wr_iid == wr_iid)
+      return;
+  if ((wr = rhc_writer_lookup (rhc, wr_iid)) == NULL)
+  {
+    wr = ddsrt_malloc (sizeof (*wr));
+    wr->wr_iid = wr_iid;
+    wr->regs = NULL;
+    ddsrt_hh_add_absent (rhc->writers, wr);
+  }
+  r = ddsrt_malloc (sizeof (*r));
+  r->wr = wr;
+  r->inst = inst;
+  r->wr_prev = NULL;
+  if ((r->wr_next = wr->regs) != NULL)
+    wr->regs->wr_prev = r;
+  wr->regs = r;
+  r->inst_next = inst->wrregs;
+  inst->wrregs = r;
+}
+
+static void wrreg_unlink_from_instance (struct rhc_instance *inst, struct rhc_wrreg *r)
+{
+  struct rhc_wrreg **pr = &inst->wrregs;
+  while (*pr != r)
+    pr = &(*pr)->inst_next;
+  *pr = r->inst_next;
+}
+
+static void wrreg_drop_instance (struct dds_rhc_default *rhc, struct rhc_instance *inst)
+{
+  struct rhc_wrreg *r;
+  while ((r = inst->wrregs) != NULL)
+  {
+    struct rhc_writer * const wr = r->wr;
+    inst->wrregs = r->inst_next;
+    if (r->wr_prev)
+      r->wr_prev->wr_next = r->wr_next;
+    else
+      wr->regs = r->wr_next;
+    if (r->wr_next)
+      r->wr_next->wr_prev = r->wr_prev;
+    if (wr->regs == NULL)
+    {
+      ddsrt_hh_remove_present (rhc->writers, wr);
+      ddsrt_free (wr);
+    }
+    ddsrt_free (r);
+  }
+}
+
 static void add_inst_to_nonempty_list (struct dds_rhc_default *rhc, struct rhc_instance *inst)
 {
   ddsrt_circlist_append (&rhc->nonempty_instances, &inst->nonempty_list);
@@ -520,7 +737,7 @@ ddsrt_mtime_t dds_rhc_default_sample_expired_cb(void *hc, ddsrt_mtime_t tnow)
   ddsrt_mutex_lock (&rhc->lock);
   while ((tnext = ddsi_lifespan_next_expired_locked (&rhc->lifespan, tnow, (void **)&sample)).v == 0)
     drop_expired_samples (rhc, sample);
-  ddsrt_mutex_unlock (&rhc->lock);
+  rhc_unlock (rhc);
   return tnext;
 }
 #endif /* DDS_HAS_LIFESPAN */
@@ -550,11 +767,114 @@ ddsrt_mtime_t dds_rhc_default_deadline_missed_cb(void *hc, ddsrt_mtime_t tnow)
 
     tnow = ddsrt_time_monotonic ();
   }
-  ddsrt_mutex_unlock (&rhc->lock);
+  rhc_unlock (rhc);
   return tnext;
 }
 #endif /* DDS_HAS_DEADLINE_MISSED */
 
+static void set_instance_layout (struct dds_rhc_default *rhc, uint32_t n_inline_samples)
+{
+  assert (n_inline_samples >= 1 && n_inline_samples <= RHC_MAX_INLINE_SAMPLES);
+  rhc->n_inline_samples = n_inline_samples;
+  rhc->instance_size = RHC_ALIGN (sizeof (struct rhc_instance) + n_inline_samples * sizeof (struct rhc_sample));
+}
+
+static void add_instance_slab (struct dds_rhc_default *rhc)
+{
+  char *mem = ddsrt_malloc (RHC_SLAB_HEADER_SIZE + RHC_INSTANCES_PER_SLAB * rhc->instance_size);
+  struct rhc_instance_slab *slab = (struct rhc_instance_slab *) mem;
+  slab->prev = NULL;
+  slab->free = NULL;
+  slab->ninuse = 0;
+  for (uint32_t i = RHC_INSTANCES_PER_SLAB; i > 0; i--)
+  {
+    struct rhc_instance_free *f = (struct rhc_instance_free *) (mem + RHC_SLAB_HEADER_SIZE + (i - 1) * rhc->instance_size);
+    f->next = slab->free;
+    slab->free = f;
+  }
+  if ((slab->next = rhc->partial_slabs) != NULL)
+    slab->next->prev = slab;
+  rhc->partial_slabs = slab;
+  rhc->n_slabs++;
+}
+
+static void prewarm_pools (struct dds_rhc_default *rhc)
+{
+  /* Resource limits are immutable, so this only needs to be done once */
+  uint32_t ninst = 1;
+  if (rhc->max_instances != DDS_LENGTH_UNLIMITED)
+    ninst = ((uint32_t) rhc->max_instances < RHC_PREWARM_MAX_INSTANCES) ? (uint32_t) rhc->max_instances : RHC_PREWARM_MAX_INSTANCES;
+  rhc->n_slabs_reserved = (ninst + RHC_INSTANCES_PER_SLAB - 1) / RHC_INSTANCES_PER_SLAB;
+  while (rhc->n_slabs < rhc->n_slabs_reserved)
+    add_instance_slab (rhc);
+
+  /* Samples only go outside the instance if the history is deeper than what fits in it */
+  uint32_t nsamples = 0;
+  if (rhc->history_depth > rhc->n_inline_samples && rhc->max_samples != DDS_LENGTH_UNLIMITED)
+    nsamples = ((uint32_t) rhc->max_samples < RHC_PREWARM_MAX_SAMPLES) ? (uint32_t) rhc->max_samples : RHC_PREWARM_MAX_SAMPLES;
+  rhc->n_pool_samples_retain = (nsamples > RHC_SAMPLE_POOL_RETAIN) ? nsamples : RHC_SAMPLE_POOL_RETAIN;
+  while (rhc->n_pool_samples < nsamples)
+  {
+    struct rhc_sample_free *f = ddsrt_malloc (sizeof (struct rhc_sample));
+    f->next = rhc->sample_pool;
+    rhc->sample_pool = f;
+    rhc->n_pool_samples++;
+  }
+}
+
+static struct rhc_instance *alloc_instance (struct dds_rhc_default *rhc)
+{
+  struct rhc_instance_slab *slab;
+  if (rhc->partial_slabs == NULL)
+    add_instance_slab (rhc);
+  slab = rhc->partial_slabs;
+  struct rhc_instance_free *f = slab->free;
+  slab->free = f->next;
+  if (++slab->ninuse == RHC_INSTANCES_PER_SLAB)
+  {
+    assert (slab->free == NULL && slab->prev == NULL);
+    if ((rhc->partial_slabs = slab->next) != NULL)
+      rhc->partial_slabs->prev = NULL;
+  }
+  struct rhc_instance *inst = (struct rhc_instance *) f;
+  memset (inst, 0, sizeof (*inst));
+  inst->slab = slab;
+  inst->inline_free = (uint32_t) ((1u << rhc->n_inline_samples) - 1);
+#if USE_VALGRIND
+  VALGRIND_MAKE_MEM_NOACCESS (inst->inline_samples, rhc->n_inline_samples * sizeof (inst->inline_samples[0]));
+#endif
+  return inst;
+}
+
+static void free_instance (struct dds_rhc_default *rhc, struct rhc_instance *inst)
+{
+  struct rhc_instance_slab * const slab = inst->slab;
+  struct rhc_instance_free * const f = (struct rhc_instance_free *) inst;
+  assert (inst->inline_free == (uint32_t) ((1u << rhc->n_inline_samples) - 1));
+  f->next = slab->free;
+  slab->free = f;
+  if (slab->ninuse-- == RHC_INSTANCES_PER_SLAB)
+  {
+    /* was full, so not in the list */
+    slab->prev = NULL;
+    if ((slab->next = rhc->partial_slabs) != NULL)
+      slab->next->prev = slab;
+    rhc->partial_slabs = slab;
+  }
+  if (slab->ninuse == 0 && (slab->prev || slab->next) && rhc->n_slabs > rhc->n_slabs_reserved)
+  {
+    /* keep one empty slab around so instances coming and going don't hit the heap */
+    if (slab->prev)
+      slab->prev->next = slab->next;
+    else
+      rhc->partial_slabs = slab->next;
+    if (slab->next)
+      slab->next->prev = slab->prev;
+    rhc->n_slabs--;
+    ddsrt_free (slab);
+  }
+}
+
 struct dds_rhc *dds_rhc_default_new_xchecks (dds_reader *reader, struct ddsi_domaingv *gv, const struct ddsi_sertype *type, bool xchecks)
 {
   struct dds_rhc_default *rhc = ddsrt_malloc (sizeof (*rhc));
@@ -563,13 +883,18 @@ struct dds_rhc *dds_rhc_default_new_xchecks (dds_reader *reader, struct ddsi_dom
 
   lwregs_init (&rhc->registrations);
   ddsrt_mutex_init (&rhc->lock);
+  ddsrt_mutex_init (&rhc->staging_lock);
+  ddsrt_atomic_st32 (&rhc->n_staged, 0);
   rhc->instances = ddsrt_hh_new (1, instance_iid_hash, instance_iid_eq);
+  rhc->writers = ddsrt_hh_new (1, rhc_writer_hash, rhc_writer_eq);
   ddsrt_circlist_init (&rhc->nonempty_instances);
   rhc->type = type;
   rhc->reader = reader;
   rhc->tkmap = gv->m_tkmap;
   rhc->gv = gv;
   rhc->xchecks = xchecks;
+  set_instance_layout (rhc, 1);
+  ddsrt_fibheap_init (&tbf_deferred_fhdef, &rhc->tbf_heap);
 
 #ifdef DDS_HAS_LIFESPAN
   ddsi_lifespan_init (gv, &rhc->lifespan, offsetof(struct dds_rhc_default, lifespan), offsetof(struct rhc_sample, lifespan), dds_rhc_default_sample_expired_cb);
@@ -595,21 +920,70 @@ static dds_return_t dds_rhc_default_associate (struct dds_rhc *rhc, dds_reader *
   return DDS_RETCODE_OK;
 }
 
+static bool staging_possible (const struct dds_rhc_default *rhc)
+{
+  /* ordering, ownership and resource limits can all cause a sample to be rejected with a
+     notification that must be raised by the delivery thread, and the time-based filter
+     may hold it back, so that raising DATA_AVAILABLE when staging it would be wrong:
+     staging is only possible if none of them apply and no samples are still held back
+     from before the filter got disabled */
+  return (rhc->gv->config.rhc_staging && rhc->minimum_separation == 0 &&
+          !rhc->by_source_ordering && !rhc->exclusive_ownership &&
+          rhc->max_samples == DDS_LENGTH_UNLIMITED &&
+          rhc->max_instances == DDS_LENGTH_UNLIMITED &&
+          rhc->max_samples_per_instance == DDS_LENGTH_UNLIMITED &&
+          ddsrt_fibheap_min (&tbf_deferred_fhdef, &rhc->tbf_heap) == NULL);
+}
+
+static void tbf_expedite_deferred (struct dds_rhc_default *rhc)
+{
+  /* samples held back under a larger minimum separation may be stored right away, that
+     is left to the timer so that the listeners get invoked from the usual context */
+  const ddsrt_mtime_t tnow = ddsrt_time_monotonic ();
+  struct ddsrt_hh_iter it;
+  for (struct rhc_instance *inst = ddsrt_hh_iter_first (rhc->instances, &it); inst != NULL; inst = ddsrt_hh_iter_next (&it))
+  {
+    struct rhc_tbf_deferred * const d = inst->tbf_deferred;
+    if (d != NULL && d->tsched.v > tnow.v)
+    {
+      d->tsched = tnow;
+      ddsrt_fibheap_decrease_key (&tbf_deferred_fhdef, &rhc->tbf_heap, d);
+    }
+  }
+  (void) ddsi_resched_xevent_if_earlier (rhc->tbf_evt, tnow);
+}
+
 static void dds_rhc_default_set_qos (struct ddsi_rhc *rhc_common, const dds_qos_t * qos)
 {
   struct dds_rhc_default * const rhc = (struct dds_rhc_default *) rhc_common;
   /* Set read related QoS */
+  ddsrt_mutex_lock (&rhc->lock);
 
   rhc->max_samples = qos->resource_limits.max_samples;
   rhc->max_instances = qos->resource_limits.max_instances;
   rhc->max_samples_per_instance = qos->resource_limits.max_samples_per_instance;
+  if (qos->time_based_filter.minimum_separation < rhc->minimum_separation && ddsrt_fibheap_min (&tbf_deferred_fhdef, &rhc->tbf_heap) != NULL)
+    tbf_expedite_deferred (rhc);
+  rhc->minimum_separation = qos->time_based_filter.minimum_separation;
   rhc->by_source_ordering = (qos->destination_order.kind == DDS_DESTINATIONORDER_BY_SOURCE_TIMESTAMP);
   rhc->exclusive_ownership = (qos->ownership.kind == DDS_OWNERSHIP_EXCLUSIVE);
   rhc->reliable = (qos->reliability.kind == DDS_RELIABILITY_RELIABLE);
+  rhc->staging = staging_possible (rhc);
   assert(qos->history.kind != DDS_HISTORY_KEEP_LAST || qos->history.depth > 0);
   rhc->history_depth = (qos->history.kind == DDS_HISTORY_KEEP_LAST) ? (uint32_t)qos->history.depth : ~0u;
+  /* the history QoS is immutable, so the layout only needs to be set before the first
+     instance is created, this also gets called when a mutable QoS changes */
+  if (rhc->n_slabs == 0)
+  {
+    if (qos->history.kind == DDS_HISTORY_KEEP_ALL)
+      set_instance_layout (rhc, 1);
+    else
+      set_instance_layout (rhc, (rhc->history_depth < RHC_MAX_INLINE_SAMPLES) ? rhc->history_depth : RHC_MAX_INLINE_SAMPLES);
+    prewarm_pools (rhc);
+  }
   /* FIXME: updating deadline duration not yet supported
   rhc->deadline.dur = qos->deadline.deadline; */
+  rhc_unlock (rhc);
 }
 
 static bool eval_predicate_sample (const struct dds_rhc_default *rhc, const struct ddsi_serdata *sample, bool (*pred) (const void *sample))
@@ -626,45 +1000,86 @@ static bool eval_predicate_invsample (const struct dds_rhc_default *rhc, const s
   return ret;
 }
 
-static struct rhc_sample *alloc_sample (struct rhc_instance *inst)
+static dds_querycond_mask_t eval_qcfilters (const struct dds_rhc_default *rhc)
+{
+  dds_querycond_mask_t conds = 0;
+  for (uint32_t i = 0; i < rhc->n_qcfilters; i++)
+    if (rhc->qcfilters[i].filter (rhc->qcond_eval_samplebuf))
+      conds |= rhc->qcfilters[i].qcmask;
+  return conds;
+}
+
+static dds_querycond_mask_t eval_qconds_sample (const struct dds_rhc_default *rhc, const struct ddsi_serdata *sample)
 {
-  if (inst->a_sample_free)
+  ddsi_serdata_to_sample (sample, rhc->qcond_eval_samplebuf, NULL, NULL);
+  return eval_qcfilters (rhc);
+}
+
+static dds_querycond_mask_t eval_qconds_invsample (const struct dds_rhc_default *rhc, const struct rhc_instance *inst)
+{
+  untyped_to_clean_invsample (rhc->type, inst->tk->m_sample, rhc->qcond_eval_samplebuf, NULL, NULL);
+  return eval_qcfilters (rhc);
+}
+
+static struct rhc_sample *alloc_sample (struct dds_rhc_default *rhc, struct rhc_instance *inst)
+{
+  if (inst->inline_free)
   {
-    inst->a_sample_free = 0;
+    uint32_t i = 0;
+    while (!(inst->inline_free & (1u << i)))
+      i++;
+    inst->inline_free &= ~(1u << i);
 #if USE_VALGRIND
-    VALGRIND_MAKE_MEM_UNDEFINED (&inst->a_sample, sizeof (inst->a_sample));
+    VALGRIND_MAKE_MEM_UNDEFINED (&inst->inline_samples[i], sizeof (inst->inline_samples[i]));
 #endif
-    return &inst->a_sample;
+    return &inst->inline_samples[i];
   }
   else
   {
     /* This instead of sizeof(rhc_sample) gets us type checking */
     struct rhc_sample *s;
-    s = ddsrt_malloc (sizeof (*s));
+    struct rhc_sample_free *f;
+    if ((f = rhc->sample_pool) == NULL)
+      s = ddsrt_malloc (sizeof (*s));
+    else
+    {
+      rhc->sample_pool = f->next;
+      rhc->n_pool_samples--;
+      s = (struct rhc_sample *) f;
+    }
+    rhc->n_ool_samples++;
     return s;
   }
 }
 
 static void free_sample (struct dds_rhc_default *rhc, struct rhc_instance *inst, struct rhc_sample *s)
 {
-#ifndef DDS_HAS_LIFESPAN
-  DDSRT_UNUSED_ARG (rhc);
-#endif
   ddsi_serdata_unref (s->sample);
 #ifdef DDS_HAS_LIFESPAN
   ddsi_lifespan_unregister_sample_locked (&rhc->lifespan, &s->lifespan);
 #endif
-  if (s == &inst->a_sample)
+  const uintptr_t i = ((uintptr_t) s - (uintptr_t) inst->inline_samples) / sizeof (*s);
+  if ((uintptr_t) s >= (uintptr_t) inst->inline_samples && i < rhc->n_inline_samples)
   {
-    assert (!inst->a_sample_free);
+    assert (!(inst->inline_free & (1u << i)));
 #if USE_VALGRIND
-    VALGRIND_MAKE_MEM_NOACCESS (&inst->a_sample, sizeof (inst->a_sample));
+    VALGRIND_MAKE_MEM_NOACCESS (s, sizeof (*s));
 #endif
-    inst->a_sample_free = 1;
+    inst->inline_free |= 1u << i;
   }
   else
   {
-    ddsrt_free (s);
+    assert (rhc->n_ool_samples > 0);
+    rhc->n_ool_samples--;
+    if (rhc->n_pool_samples >= rhc->n_pool_samples_retain)
+      ddsrt_free (s);
+    else
+    {
+      struct rhc_sample_free *f = (struct rhc_sample_free *) s;
+      f->next = rhc->sample_pool;
+      rhc->sample_pool = f;
+      rhc->n_pool_samples++;
+    }
   }
 }
 
@@ -708,15 +1123,68 @@ static void inst_set_invsample (struct dds_rhc_default *rhc, struct rhc_instance
   }
 }
 
+static struct rhc_tbf_deferred *tbf_remove_deferred (struct dds_rhc_default *rhc, struct rhc_instance *inst)
+{
+  struct rhc_tbf_deferred * const d = inst->tbf_deferred;
+  ddsrt_fibheap_delete (&tbf_deferred_fhdef, &rhc->tbf_heap, d);
+  inst->tbf_deferred = NULL;
+  return d;
+}
+
+static void tbf_free_deferred (struct rhc_tbf_deferred *d)
+{
+  ddsi_serdata_unref (d->sample);
+  ddsrt_free (d);
+}
+
+static void tbf_deferred_cb (struct ddsi_xevent *xev, void *varg, ddsrt_mtime_t tnow);
+
+static bool tbf_defer (struct dds_rhc_default *rhc, struct rhc_instance *inst, const struct ddsi_writer_info *wrinfo, struct ddsi_serdata *sample)
+{
+  /* only plain writes are subject to the filter: disposes and unregisters change the
+     instance state and can't be dropped */
+  if (sample->kind != SDK_DATA || sample->statusinfo != 0)
+    return false;
+  /* the separation may have been lowered to 0 while a sample was held back */
+  if (rhc->minimum_separation <= 0 || ddsrt_time_monotonic ().v >= inst->tbf_tnext.v)
+  {
+    /* a sample that was held back is superseded by this one */
+    if (inst->tbf_deferred)
+      tbf_free_deferred (tbf_remove_deferred (rhc, inst));
+    return false;
+  }
+  struct rhc_tbf_deferred *d;
+  if ((d = inst->tbf_deferred) != NULL)
+    ddsi_serdata_unref (d->sample);
+  else
+  {
+    d = ddsrt_malloc (sizeof (*d));
+    d->tsched = inst->tbf_tnext;
+    d->inst = inst;
+    inst->tbf_deferred = d;
+    ddsrt_fibheap_insert (&tbf_deferred_fhdef, &rhc->tbf_heap, d);
+    if (rhc->tbf_evt == NULL)
+      rhc->tbf_evt = ddsi_qxev_callback (rhc->gv->xevents, d->tsched, tbf_deferred_cb, rhc);
+    else
+      (void) ddsi_resched_xevent_if_earlier (rhc->tbf_evt, d->tsched);
+  }
+  d->wrinfo = *wrinfo;
+  d->sample = ddsi_serdata_ref (sample);
+  return true;
+}
+
 static void free_empty_instance (struct rhc_instance *inst, struct dds_rhc_default *rhc)
 {
   assert (inst_is_empty (inst));
+  if (inst->tbf_deferred)
+    tbf_free_deferred (tbf_remove_deferred (rhc, inst));
+  wrreg_drop_instance (rhc, inst);
   ddsi_tkmap_instance_unref (rhc->tkmap, inst->tk);
 #ifdef DDS_HAS_DEADLINE_MISSED
   if (inst->deadline_reg)
     ddsi_deadline_unregister_instance_locked (&rhc->deadline, &inst->deadline);
 #endif
-  ddsrt_free (inst);
+  free_instance (rhc, inst);
 }
 
 static void free_instance_rhc_free (struct rhc_instance *inst, struct dds_rhc_default *rhc)
@@ -748,15 +1216,28 @@ static void free_instance_rhc_free (struct rhc_instance *inst, struct dds_rhc_de
   free_empty_instance(inst, rhc);
 }
 
+static void dds_rhc_default_get_stats (struct dds_rhc *rhc_common, struct dds_rhc_stats *stats)
+{
+  struct dds_rhc_default * const rhc = (struct dds_rhc_default *) rhc_common;
+  ddsrt_mutex_lock (&rhc->lock);
+  rhc_fold_staged_locked (rhc);
+  stats->instance_pool_size = rhc->n_slabs * RHC_INSTANCES_PER_SLAB;
+  stats->instance_pool_used = rhc->n_instances;
+  stats->sample_pool_size = rhc->n_ool_samples + rhc->n_pool_samples;
+  stats->sample_pool_used = rhc->n_ool_samples;
+  rhc_unlock (rhc);
+}
+
 static uint32_t dds_rhc_default_lock_samples (struct dds_rhc *rhc_common)
 {
   struct dds_rhc_default * const rhc = (struct dds_rhc_default *) rhc_common;
   uint32_t no;
   ddsrt_mutex_lock (&rhc->lock);
+  rhc_fold_staged_locked (rhc);
   no = rhc->n_vsamples + rhc->n_invsamples;
   if (no == 0)
   {
-    ddsrt_mutex_unlock (&rhc->lock);
+    rhc_unlock (rhc);
   }
   return no;
 }
@@ -776,15 +1257,43 @@ static void dds_rhc_default_free (struct ddsi_rhc *rhc_common)
 #ifdef DDS_HAS_DEADLINE_MISSED
   ddsi_deadline_stop (&rhc->deadline);
 #endif
+  if (rhc->tbf_evt)
+    ddsi_delete_xevent_callback (rhc->tbf_evt);
+  while (rhc->staged_first)
+  {
+    struct rhc_staged *st = rhc->staged_first;
+    rhc->staged_first = st->next;
+    ddsi_serdata_unref (st->sample);
+    ddsi_tkmap_instance_unref (rhc->tkmap, st->tk);
+    ddsrt_free (st);
+  }
   ddsrt_hh_enum (rhc->instances, free_instance_rhc_free_wrap, rhc);
   assert (ddsrt_circlist_isempty (&rhc->nonempty_instances));
+  assert (ddsrt_fibheap_min (&tbf_deferred_fhdef, &rhc->tbf_heap) == NULL);
 #ifdef DDS_HAS_DEADLINE_MISSED
   ddsi_deadline_fini (&rhc->deadline);
 #endif
   ddsrt_hh_free (rhc->instances);
+  ddsrt_hh_free (rhc->writers);
+  assert (rhc->n_ool_samples == 0);
+  while (rhc->partial_slabs)
+  {
+    struct rhc_instance_slab *slab = rhc->partial_slabs;
+    assert (slab->ninuse == 0);
+    rhc->partial_slabs = slab->next;
+    ddsrt_free (slab);
+  }
+  while (rhc->sample_pool)
+  {
+    struct rhc_sample_free *f = rhc->sample_pool;
+    rhc->sample_pool = f->next;
+    ddsrt_free (f);
+  }
   lwregs_fini (&rhc->registrations);
+  assert (rhc->condgroups == NULL && rhc->n_qcfilters == 0);
   if (rhc->qcond_eval_samplebuf != NULL)
     ddsi_sertype_free_sample (rhc->type, rhc->qcond_eval_samplebuf, DDS_FREE_ALL);
+  ddsrt_mutex_destroy (&rhc->staging_lock);
   ddsrt_mutex_destroy (&rhc->lock);
   ddsrt_free (rhc);
 }
@@ -893,7 +1402,7 @@ static bool add_sample (struct dds_rhc_default *rhc, struct rhc_instance *inst,
     }
 
     /* add new latest sample */
-    s = alloc_sample (inst);
+    s = alloc_sample (rhc, inst);
     inst_clear_invsample_if_exists (rhc, inst, trig_qc);
     if (inst->latest == NULL)
     {
@@ -919,16 +1428,12 @@ static bool add_sample (struct dds_rhc_default *rhc, struct rhc_instance *inst,
   ddsi_lifespan_register_sample_locked (&rhc->lifespan, &s->lifespan);
 #endif
 
-  s->conds = 0;
-  if (rhc->nqconds != 0)
-  {
-    for (dds_readcond *rc = rhc->conds; rc != NULL; rc = rc->m_next)
-      if (rc->m_query.m_filter != 0 && eval_predicate_sample (rhc, s->sample, rc->m_query.m_filter))
-        s->conds |= rc->m_query.m_qcmask;
-  }
+  s->conds = (rhc->nqconds != 0) ? eval_qconds_sample (rhc, s->sample) : 0;
 
   trig_qc->inc_conds_sample = s->conds;
   inst->latest = s;
+  if (rhc->minimum_separation > 0)
+    inst->tbf_tnext = ddsrt_mtime_add_duration (ddsrt_time_monotonic (), rhc->minimum_separation);
   *nda = true;
   return true;
 }
@@ -966,6 +1471,9 @@ static bool content_filter_accepts (const dds_reader *reader, const struct ddsi_
   if (reader)
   {
     const struct dds_topic *tp = reader->m_topic;
+    const struct dds_filter_expr *expr = ddsrt_atomic_ldvoidp (&tp->m_filter_expr);
+    if (expr && !dds_filter_expr_eval_serdata (expr, sample))
+      return false;
     switch (tp->m_filter.mode)
     {
       case DDS_TOPIC_FILTER_NONE:
@@ -1103,6 +1611,8 @@ static void dds_rhc_register (struct dds_rhc_default *rhc, struct rhc_instance *
 
      Is a dispose a sample?  I don't think so (though a write dispose
      is).  Is a pure register a sample?  Don't think so either. */
+  if (inst_wr_iid != wr_iid)
+    wrreg_note (rhc, inst, wr_iid);
   if (inst_wr_iid == wr_iid)
   {
     /* Same writer as last time => we know it is registered already.
@@ -1384,16 +1894,15 @@ static struct rhc_instance *alloc_new_instance (struct dds_rhc_default *rhc, con
   struct rhc_instance *inst;
 
   ddsi_tkmap_instance_ref (tk);
-  inst = ddsrt_malloc (sizeof (*inst));
-  memset (inst, 0, sizeof (*inst));
+  inst = alloc_instance (rhc);
   inst->iid = tk->m_iid;
   inst->tk = tk;
   inst->wrcount = 1;
+  wrreg_note (rhc, inst, wrinfo->iid);
   inst->isdisposed = (serdata->statusinfo & DDSI_STATUSINFO_DISPOSE) != 0;
   inst->autodispose = wrinfo->auto_dispose;
   inst->deadline_reg = 0;
   inst->isnew = 1;
-  inst->a_sample_free = 1;
   inst->conds = 0;
   inst->wr_iid = wrinfo->iid;
   inst->wr_iid_islive = (inst->wrcount != 0);
@@ -1402,15 +1911,7 @@ static struct rhc_instance *alloc_new_instance (struct dds_rhc_default *rhc, con
   inst->strength = wrinfo->ownership_strength;
 
   if (rhc->nqconds != 0)
-  {
-    for (dds_readcond *c = rhc->conds; c != NULL; c = c->m_next)
-    {
-      assert ((dds_entity_kind (&c->m_entity) == DDS_KIND_COND_READ && c->m_query.m_filter == 0) ||
-              (dds_entity_kind (&c->m_entity) == DDS_KIND_COND_QUERY && c->m_query.m_filter != 0));
-      if (c->m_query.m_filter && eval_predicate_invsample (rhc, inst, c->m_query.m_filter))
-        inst->conds |= c->m_query.m_qcmask;
-    }
-  }
+    inst->conds = eval_qconds_invsample (rhc, inst);
   return inst;
 }
 
@@ -1555,9 +2056,8 @@ static void update_viewstate_and_disposedness (struct dds_rhc_default * __restri
   delivered (true unless a reliable sample rejected).
 */
 
-static bool dds_rhc_default_store (struct ddsi_rhc * __restrict rhc_common, const struct ddsi_writer_info * __restrict wrinfo, struct ddsi_serdata * __restrict sample, struct ddsi_tkmap_instance * __restrict tk)
+static rhc_store_result_t rhc_store_locked (struct dds_rhc_default * __restrict rhc, const struct ddsi_writer_info * __restrict wrinfo, struct ddsi_serdata * __restrict sample, struct ddsi_tkmap_instance * __restrict tk, ddsi_status_cb_data_t * __restrict cb_data, bool * __restrict nda)
 {
-  struct dds_rhc_default * const __restrict rhc = (struct dds_rhc_default * __restrict) rhc_common;
   const uint64_t wr_iid = wrinfo->iid;
   const uint32_t statusinfo = sample->statusinfo;
   const bool has_data = (sample->kind == SDK_DATA);
@@ -1567,30 +2067,23 @@ static bool dds_rhc_default_store (struct ddsi_rhc * __restrict rhc_common, cons
   struct trigger_info_pre pre;
   struct trigger_info_post post;
   struct trigger_info_qcond trig_qc;
-  rhc_store_result_t stored;
-  ddsi_status_cb_data_t cb_data;   /* Callback data for reader status callback */
-  bool notify_data_available;
-
-  TRACE ("rhc_store %"PRIx64",%"PRIx64" si %"PRIx32" has_data %d:", tk->m_iid, wr_iid, statusinfo, has_data);
-  if (!has_data && statusinfo == 0)
-  {
-    /* Write with nothing but a key -- I guess that would be a
-       register, which we do implicitly. (Currently DDSI2 won't allow
-       it through anyway.) */
-    TRACE (" ignore explicit register\n");
-    return true;
-  }
+  rhc_store_result_t stored = RHC_FILTERED;
+  bool deferred = false;
 
-  notify_data_available = false;
   dummy_instance.iid = tk->m_iid;
-  stored = RHC_FILTERED;
-  cb_data.raw_status_id = -1;
-
   init_trigger_info_qcond (&trig_qc);
 
-  ddsrt_mutex_lock (&rhc->lock);
-
   inst = ddsrt_hh_lookup (rhc->instances, &dummy_instance);
+  if (inst != NULL && inst->tbf_deferred != NULL && !(has_data && statusinfo == 0))
+  {
+    /* a dispose or unregister must not overtake a write held back by the time-based filter */
+    struct rhc_tbf_deferred * const d = tbf_remove_deferred (rhc, inst);
+    inst->tbf_tnext.v = 0;
+    TRACE (" store deferred %"PRIx64":", d->wrinfo.iid);
+    (void) rhc_store_locked (rhc, &d->wrinfo, d->sample, tk, cb_data, nda);
+    tbf_free_deferred (d);
+    inst = ddsrt_hh_lookup (rhc->instances, &dummy_instance);
+  }
   if (inst == NULL)
   {
     /* New instance for this reader.  If no data content -- not (also)
@@ -1605,32 +2098,35 @@ static bool dds_rhc_default_store (struct ddsi_rhc * __restrict rhc_common, cons
     else
     {
       TRACE (" new instance\n");
-      stored = rhc_store_new_instance (&inst, rhc, wrinfo, sample, tk, has_data, &cb_data, &trig_qc, &notify_data_available);
+      stored = rhc_store_new_instance (&inst, rhc, wrinfo, sample, tk, has_data, cb_data, &trig_qc, nda);
       if (stored != RHC_STORED)
         goto error_or_nochange;
 
       init_trigger_info_cmn_nonmatch (&pre.c);
     }
   }
-  else if (!inst_accepts_sample (rhc, inst, wrinfo, sample, has_data))
+  else if (!inst_accepts_sample (rhc, inst, wrinfo, sample, has_data) || (deferred = tbf_defer (rhc, inst, wrinfo, sample)))
   {
     /* Rejected samples (and disposes) should still register the writer;
        unregister *must* be processed, or we have a memory leak. (We
        will raise a SAMPLE_REJECTED, and indicate that the system should
        kill itself.)  Not letting instances go to ALIVE or NEW based on
-       a rejected sample - (no one knows, it seemed) */
-    TRACE (" instance rejects sample\n");
+       a rejected sample - (no one knows, it seemed)
+
+       Samples held back by the time-based filter are treated the same
+       way until they get stored, except that nothing is lost. */
+    TRACE (deferred ? " time-based filter defers sample\n" : " instance rejects sample\n");
 
     get_trigger_info_pre (&pre, inst);
     if (has_data || is_dispose)
     {
-      dds_rhc_register (rhc, inst, wr_iid, wrinfo->auto_dispose, false, &notify_data_available);
-      if (notify_data_available)
+      dds_rhc_register (rhc, inst, wr_iid, wrinfo->auto_dispose, false, nda);
+      if (*nda)
       {
         if (inst->latest == NULL || inst->latest->isread)
         {
           const bool was_empty = inst_is_empty (inst);
-          inst_set_invsample (rhc, inst, &trig_qc, &notify_data_available);
+          inst_set_invsample (rhc, inst, &trig_qc, nda);
           if (was_empty)
             account_for_empty_to_nonempty_transition (rhc, inst);
         }
@@ -1638,10 +2134,13 @@ static bool dds_rhc_default_store (struct ddsi_rhc * __restrict rhc_common, cons
     }
 
     /* notify sample lost */
-    cb_data.raw_status_id = (int) DDS_SAMPLE_LOST_STATUS_ID;
-    cb_data.extra = 0;
-    cb_data.handle = 0;
-    cb_data.add = true;
+    if (!deferred)
+    {
+      cb_data->raw_status_id = (int) DDS_SAMPLE_LOST_STATUS_ID;
+      cb_data->extra = 0;
+      cb_data->handle = 0;
+      cb_data->add = true;
+    }
   }
   else
   {
@@ -1669,14 +2168,14 @@ static bool dds_rhc_default_store (struct ddsi_rhc * __restrict rhc_common, cons
          (i.e., out-of-memory), abort the operation and hope that the
          caller can still notify the application.  */
 
-      dds_rhc_register (rhc, inst, wr_iid, wrinfo->auto_dispose, true, &notify_data_available);
-      update_viewstate_and_disposedness (rhc, inst, has_data, not_alive, is_dispose, &notify_data_available);
+      dds_rhc_register (rhc, inst, wr_iid, wrinfo->auto_dispose, true, nda);
+      update_viewstate_and_disposedness (rhc, inst, has_data, not_alive, is_dispose, nda);
 
       /* Only need to add a sample to the history if the input actually is a sample. */
       if (has_data)
       {
         TRACE (" add_sample");
-        if (!add_sample (rhc, inst, wrinfo, sample, &cb_data, &trig_qc, &notify_data_available))
+        if (!add_sample (rhc, inst, wrinfo, sample, cb_data, &trig_qc, nda))
         {
           TRACE ("(reject)\n");
           stored = RHC_REJECTED;
@@ -1692,7 +2191,7 @@ static bool dds_rhc_default_store (struct ddsi_rhc * __restrict rhc_common, cons
 
       /* If instance became disposed, add an invalid sample if there are no samples left */
       if ((bool) inst->isdisposed > old_isdisposed && (inst->latest == NULL || inst->latest->isread))
-        inst_set_invsample (rhc, inst, &trig_qc, &notify_data_available);
+        inst_set_invsample (rhc, inst, &trig_qc, nda);
 
       update_inst_have_wr_iid (inst, wrinfo, sample->timestamp);
 
@@ -1715,7 +2214,7 @@ static bool dds_rhc_default_store (struct ddsi_rhc * __restrict rhc_common, cons
       }
     }
 
-    TRACE(" nda=%d\n", notify_data_available);
+    TRACE(" nda=%d\n", *nda);
     assert (rhc_check_counts_locked (rhc, false, false));
   }
 
@@ -1734,7 +2233,7 @@ static bool dds_rhc_default_store (struct ddsi_rhc * __restrict rhc_common, cons
        mean an application reading "x" after the write and reading it
        again after the unregister will see a change in the
        no_writers_generation field? */
-    dds_rhc_unregister (rhc, inst, wrinfo, sample->timestamp, &post, &trig_qc, &notify_data_available);
+    dds_rhc_unregister (rhc, inst, wrinfo, sample->timestamp, &post, &trig_qc, nda);
   }
   else
   {
@@ -1744,7 +2243,182 @@ static bool dds_rhc_default_store (struct ddsi_rhc * __restrict rhc_common, cons
   postprocess_instance_update (rhc, &inst, &pre, &post, &trig_qc);
 
 error_or_nochange:
+  return stored;
+}
+
+static void tbf_deferred_cb (struct ddsi_xevent *xev, void *varg, ddsrt_mtime_t tnow)
+{
+  struct dds_rhc_default * const rhc = varg;
+  struct rhc_tbf_deferred *d;
+  bool notify_data_available = false;
+  ddsrt_mutex_lock (&rhc->lock);
+  /* anything staged arrived before now and may supersede a deferred sample */
+  rhc_fold_staged_locked (rhc);
+  while ((d = ddsrt_fibheap_min (&tbf_deferred_fhdef, &rhc->tbf_heap)) != NULL && d->tsched.v <= tnow.v)
+  {
+    struct rhc_instance * const inst = d->inst;
+    ddsi_status_cb_data_t cb_data;
+    (void) tbf_remove_deferred (rhc, inst);
+    inst->tbf_tnext.v = 0;
+    cb_data.raw_status_id = -1;
+    TRACE ("rhc_store_deferred %"PRIx64",%"PRIx64":", inst->iid, d->wrinfo.iid);
+    (void) rhc_store_locked (rhc, &d->wrinfo, d->sample, inst->tk, &cb_data, &notify_data_available);
+    tbf_free_deferred (d);
+    if (cb_data.raw_status_id >= 0 && rhc->reader)
+    {
+      ddsrt_mutex_unlock (&rhc->lock);
+      dds_reader_status_cb (&rhc->reader->m_entity, &cb_data);
+      ddsrt_mutex_lock (&rhc->lock);
+    }
+  }
+  const ddsrt_mtime_t tnext = (d != NULL) ? d->tsched : DDSRT_MTIME_NEVER;
+  /* staging may have been held off until the deferred samples were stored */
+  rhc->staging = staging_possible (rhc);
+  rhc_unlock (rhc);
+  if (rhc->reader && notify_data_available)
+    dds_reader_data_available_cb (rhc->reader);
+  (void) ddsi_resched_xevent_if_earlier (xev, tnext);
+}
+
+static bool content_filter_in_use (const dds_reader *reader)
+{
+  return reader && (reader->m_topic->m_filter.mode != DDS_TOPIC_FILTER_NONE || ddsrt_atomic_ldvoidp (&reader->m_topic->m_filter_expr) != NULL);
+}
+
+static void rhc_stage (struct dds_rhc_default * __restrict rhc, const struct ddsi_writer_info * __restrict wrinfo, struct ddsi_serdata * __restrict sample, struct ddsi_tkmap_instance * __restrict tk)
+{
+  struct rhc_staged *st = ddsrt_malloc (sizeof (*st));
+  st->next = NULL;
+  st->wrinfo = *wrinfo;
+  st->sample = ddsi_serdata_ref (sample);
+  ddsi_tkmap_instance_ref (tk);
+  st->tk = tk;
+  ddsrt_mutex_lock (&rhc->staging_lock);
+  if (rhc->staged_first == NULL)
+    rhc->staged_first = st;
+  else
+    rhc->staged_last->next = st;
+  rhc->staged_last = st;
+  ddsrt_atomic_inc32 (&rhc->n_staged);
+  ddsrt_mutex_unlock (&rhc->staging_lock);
+}
+
+static void rhc_fold_staged_locked (struct dds_rhc_default * __restrict rhc)
+{
+  struct rhc_staged *st;
+  if (ddsrt_atomic_ld32 (&rhc->n_staged) == 0)
+    return;
+  ddsrt_mutex_lock (&rhc->staging_lock);
+  st = rhc->staged_first;
+  rhc->staged_first = rhc->staged_last = NULL;
+  ddsrt_atomic_st32 (&rhc->n_staged, 0);
+  ddsrt_mutex_unlock (&rhc->staging_lock);
+  while (st)
+  {
+    struct rhc_staged * const next = st->next;
+    ddsi_status_cb_data_t cb_data;
+    bool nda = false;
+    cb_data.raw_status_id = -1;
+    TRACE ("rhc_fold %"PRIx64",%"PRIx64":", st->tk->m_iid, st->wrinfo.iid);
+    (void) rhc_store_locked (rhc, &st->wrinfo, st->sample, st->tk, &cb_data, &nda);
+    /* DATA_AVAILABLE was raised when it was staged; a content filter installed since then
+       is the only way it can get rejected */
+    if (cb_data.raw_status_id >= 0)
+    {
+      assert (cb_data.raw_status_id == (int) DDS_SAMPLE_LOST_STATUS_ID);
+      rhc->staged_lost++;
+    }
+    ddsi_serdata_unref (st->sample);
+    ddsi_tkmap_instance_unref (rhc->tkmap, st->tk);
+    ddsrt_free (st);
+    st = next;
+  }
+}
+
+static void rhc_unlock (struct dds_rhc_default * __restrict rhc)
+{
+  /* A delivery thread that failed to get the lock leaves its sample in the staging queue
+     and then tries once more; if that also fails, the sample must be picked up by whoever
+     was holding it at the time */
   ddsrt_mutex_unlock (&rhc->lock);
+  ddsrt_atomic_fence ();
+  if (ddsrt_atomic_ld32 (&rhc->n_staged) == 0)
+    return;
+  /* releasing the tkmap references requires being awake, not all callers are */
+  struct ddsi_thread_state * const thrst = ddsi_lookup_thread_state ();
+  const bool asleep = !ddsi_thread_is_awake ();
+  if (asleep)
+    ddsi_thread_state_awake (thrst, rhc->gv);
+  while (ddsrt_atomic_ld32 (&rhc->n_staged) > 0 && ddsrt_mutex_trylock (&rhc->lock))
+  {
+    rhc_fold_staged_locked (rhc);
+    ddsrt_mutex_unlock (&rhc->lock);
+    ddsrt_atomic_fence ();
+  }
+  if (asleep)
+    ddsi_thread_state_asleep (thrst);
+}
+
+static void rhc_notify_staged_lost (struct dds_rhc_default * __restrict rhc, uint32_t staged_lost)
+{
+  ddsi_status_cb_data_t cb_data;
+  cb_data.raw_status_id = (int) DDS_SAMPLE_LOST_STATUS_ID;
+  cb_data.extra = 0;
+  cb_data.handle = 0;
+  cb_data.add = true;
+  while (staged_lost--)
+    dds_reader_status_cb (&rhc->reader->m_entity, &cb_data);
+}
+
+static bool dds_rhc_default_store (struct ddsi_rhc * __restrict rhc_common, const struct ddsi_writer_info * __restrict wrinfo, struct ddsi_serdata * __restrict sample, struct ddsi_tkmap_instance * __restrict tk)
+{
+  struct dds_rhc_default * const __restrict rhc = (struct dds_rhc_default * __restrict) rhc_common;
+  const uint32_t statusinfo = sample->statusinfo;
+  const bool has_data = (sample->kind == SDK_DATA);
+  rhc_store_result_t stored;
+  ddsi_status_cb_data_t cb_data;   /* Callback data for reader status callback */
+  bool notify_data_available;
+  uint32_t staged_lost;
+
+  TRACE ("rhc_store %"PRIx64",%"PRIx64" si %"PRIx32" has_data %d:", tk->m_iid, wrinfo->iid, statusinfo, has_data);
+  if (!has_data && statusinfo == 0)
+  {
+    /* Write with nothing but a key -- I guess that would be a
+       register, which we do implicitly. (Currently DDSI2 won't allow
+       it through anyway.) */
+    TRACE (" ignore explicit register\n");
+    return true;
+  }
+
+  if (!(rhc->staging && has_data && statusinfo == 0 && !content_filter_in_use (rhc->reader)))
+    ddsrt_mutex_lock (&rhc->lock);
+  else if (!ddsrt_mutex_trylock (&rhc->lock))
+  {
+    TRACE (" staged\n");
+    rhc_stage (rhc, wrinfo, sample, tk);
+    ddsrt_atomic_fence ();
+    if (ddsrt_mutex_trylock (&rhc->lock))
+    {
+      rhc_fold_staged_locked (rhc);
+      staged_lost = rhc->staged_lost;
+      rhc->staged_lost = 0;
+      rhc_unlock (rhc);
+      if (rhc->reader && staged_lost > 0)
+        rhc_notify_staged_lost (rhc, staged_lost);
+    }
+    if (rhc->reader)
+      dds_reader_data_available_cb (rhc->reader);
+    return true;
+  }
+
+  /* anything that got staged precedes this sample */
+  rhc_fold_staged_locked (rhc);
+  notify_data_available = false;
+  cb_data.raw_status_id = -1;
+  stored = rhc_store_locked (rhc, wrinfo, sample, tk, &cb_data, &notify_data_available);
+  staged_lost = rhc->staged_lost;
+  rhc->staged_lost = 0;
+  rhc_unlock (rhc);
 
   if (rhc->reader)
   {
@@ -1752,6 +2426,8 @@ error_or_nochange:
       dds_reader_data_available_cb (rhc->reader);
     if (cb_data.raw_status_id >= 0)
       dds_reader_status_cb (&rhc->reader->m_entity, &cb_data);
+    if (staged_lost > 0)
+      rhc_notify_staged_lost (rhc, staged_lost);
   }
   return !(rhc->reliable && stored == RHC_REJECTED);
 }
@@ -1775,14 +2451,32 @@ static void dds_rhc_default_unregister_wr (struct ddsi_rhc * __restrict rhc_comm
      for tracking registrations and unregistrations. */
   struct dds_rhc_default * __restrict const rhc = (struct dds_rhc_default * __restrict) rhc_common;
   bool notify_data_available = false;
-  struct rhc_instance *inst;
-  struct ddsrt_hh_iter iter;
+  struct rhc_writer *wr;
   const uint64_t wr_iid = wrinfo->iid;
 
   ddsrt_mutex_lock (&rhc->lock);
+  /* staged samples may still register this writer */
+  rhc_fold_staged_locked (rhc);
   TRACE ("rhc_unregister_wr_iid %"PRIx64",%d:\n", wr_iid, wrinfo->auto_dispose);
-  for (inst = ddsrt_hh_iter_first (rhc->instances, &iter); inst; inst = ddsrt_hh_iter_next (&iter))
-  {
+  if ((wr = rhc_writer_lookup (rhc, wr_iid)) == NULL)
+  {
+    rhc_unlock (rhc);
+    return;
+  }
+  /* Unregistering may free the instance (and with it the nodes of the other writers of
+     that instance), so remove the node before doing anything with the instance */
+  struct rhc_wrreg *r;
+  while ((r = wr->regs) != NULL)
+  {
+    struct rhc_instance *inst = r->inst;
+    if ((wr->regs = r->wr_next) != NULL)
+      wr->regs->wr_prev = NULL;
+    /* storing a sample the time-based filter held back would register the writer again
+       after it has been lost, leaving the instance alive forever */
+    if (inst->tbf_deferred && inst->tbf_deferred->wrinfo.iid == wr_iid)
+      tbf_free_deferred (tbf_remove_deferred (rhc, inst));
+    wrreg_unlink_from_instance (inst, r);
+    ddsrt_free (r);
     if ((inst->wr_iid_islive && inst->wr_iid == wr_iid) || lwregs_contains (&rhc->registrations, inst->iid, wr_iid))
     {
       assert (inst->wrcount > 0);
@@ -1797,7 +2491,9 @@ static void dds_rhc_default_unregister_wr (struct ddsi_rhc * __restrict rhc_comm
       TRACE ("\n");
     }
   }
-  ddsrt_mutex_unlock (&rhc->lock);
+  ddsrt_hh_remove_present (rhc->writers, wr);
+  ddsrt_free (wr);
+  rhc_unlock (rhc);
 
   if (rhc->reader && notify_data_available)
     dds_reader_data_available_cb (rhc->reader);
@@ -1806,20 +2502,32 @@ static void dds_rhc_default_unregister_wr (struct ddsi_rhc * __restrict rhc_comm
 static void dds_rhc_default_relinquish_ownership (struct ddsi_rhc * __restrict rhc_common, const uint64_t wr_iid)
 {
   struct dds_rhc_default * __restrict const rhc = (struct dds_rhc_default * __restrict) rhc_common;
-  struct rhc_instance *inst;
-  struct ddsrt_hh_iter iter;
+  struct rhc_writer *wr;
   ddsrt_mutex_lock (&rhc->lock);
+  rhc_fold_staged_locked (rhc);
   TRACE ("rhc_relinquish_ownership(%"PRIx64":\n", wr_iid);
-  for (inst = ddsrt_hh_iter_first (rhc->instances, &iter); inst; inst = ddsrt_hh_iter_next (&iter))
+  if ((wr = rhc_writer_lookup (rhc, wr_iid)) != NULL)
   {
-    if (inst->wr_iid_islive && inst->wr_iid == wr_iid)
+    for (struct rhc_wrreg *r = wr->regs; r; r = r->wr_next)
     {
-      inst->wr_iid_islive = 0;
+      struct rhc_instance * const inst = r->inst;
+      if (inst->wr_iid_islive && inst->wr_iid == wr_iid)
+      {
+        /* a sole registration is implied by wr_iid, it must be made explicit or it
+           would be lost */
+        if (inst->wrcount == 1)
+        {
+          int x = lwregs_add (&rhc->registrations, inst->iid, wr_iid);
+          assert (x);
+          (void) x;
+        }
+        inst->wr_iid_islive = 0;
+      }
     }
   }
   TRACE (")\n");
   assert (rhc_check_counts_locked (rhc, true, false));
-  ddsrt_mutex_unlock (&rhc->lock);
+  rhc_unlock (rhc);
 }
 
 /* STATUSES:
@@ -2200,6 +2908,7 @@ static int32_t read_w_qminv (struct dds_rhc_default * __restrict rhc, bool lock,
   {
     ddsrt_mutex_lock (&rhc->lock);
   }
+  rhc_fold_staged_locked (rhc);
 
   TRACE ("read_w_qminv(%p,%p,%p,%"PRId32",%"PRIx32",%"PRIx64",%p) - inst %"PRIu32" nonempty %"PRIu32" disp %"PRIu32" nowr %"PRIu32" new %"PRIu32" samples %"PRIu32"+%"PRIu32" read %"PRIu32"+%"PRIu32"\n",
     (void *) rhc, (void *) values, (void *) info_seq, max_samples, qminv, handle, (void *) cond,
@@ -2233,7 +2942,7 @@ static int32_t read_w_qminv (struct dds_rhc_default * __restrict rhc, bool lock,
   // It appears to have been introduced at some point so another language binding could lock
   // the RHC using dds_rhc_default_lock_samples to find out the number of samples present,
   // then allocate stuff and call read/take with lock=true. All that needs fixing.
-  ddsrt_mutex_unlock (&rhc->lock);
+  rhc_unlock (rhc);
   return n;
 }
 
@@ -2245,6 +2954,7 @@ static int32_t take_w_qminv (struct dds_rhc_default * __restrict rhc, bool lock,
   {
     ddsrt_mutex_lock (&rhc->lock);
   }
+  rhc_fold_staged_locked (rhc);
 
   TRACE ("take_w_qminv(%p,%p,%p,%"PRId32",%"PRIx32",%"PRIx64",%p) - inst %"PRIu32" nonempty %"PRIu32" disp %"PRIu32" nowr %"PRIu32" new %"PRIu32" samples %"PRIu32"+%"PRIu32" read %"PRIu32"+%"PRIu32"\n",
     (void*) rhc, (void*) values, (void*) info_seq, max_samples, qminv, handle, (void *) cond,
@@ -2280,7 +2990,7 @@ static int32_t take_w_qminv (struct dds_rhc_default * __restrict rhc, bool lock,
   // It appears to have been introduced at some point so another language binding could lock
   // the RHC using dds_rhc_default_lock_samples to find out the number of samples present,
   // then allocate stuff and call read/take with lock=true. All that needs fixing.
-  ddsrt_mutex_unlock (&rhc->lock);
+  rhc_unlock (rhc);
   return n;
 }
 
@@ -2353,6 +3063,77 @@ static bool cond_is_sample_state_dependent (const struct dds_readcond *cond)
   }
 }
 
+static void condgroup_add (struct dds_rhc_default *rhc, dds_readcond *cond)
+{
+  struct rhc_condgroup *g;
+  for (g = rhc->condgroups; g; g = g->next)
+    if (g->qminv == cond->m_qminv && g->sample_states == cond->m_sample_states)
+      break;
+  if (g == NULL)
+  {
+    g = ddsrt_malloc (sizeof (*g));
+    g->qminv = cond->m_qminv;
+    g->sample_states = cond->m_sample_states;
+    g->nconds = g->size = 0;
+    g->conds = NULL;
+    g->next = rhc->condgroups;
+    rhc->condgroups = g;
+  }
+  if (g->nconds == g->size)
+  {
+    g->size = (g->size == 0) ? 4 : 2 * g->size;
+    g->conds = ddsrt_realloc (g->conds, g->size * sizeof (*g->conds));
+  }
+  g->conds[g->nconds++] = cond;
+}
+
+static void condgroup_remove (struct dds_rhc_default *rhc, dds_readcond *cond)
+{
+  struct rhc_condgroup **pg = &rhc->condgroups, *g;
+  while ((*pg)->qminv != cond->m_qminv || (*pg)->sample_states != cond->m_sample_states)
+    pg = &(*pg)->next;
+  g = *pg;
+  uint32_t i = 0;
+  while (g->conds[i] != cond)
+    i++;
+  g->conds[i] = g->conds[--g->nconds];
+  if (g->nconds == 0)
+  {
+    *pg = g->next;
+    ddsrt_free (g->conds);
+    ddsrt_free (g);
+  }
+}
+
+static dds_querycond_mask_t qcfilter_add (struct dds_rhc_default *rhc, dds_querycondition_filter_fn filter, dds_querycond_mask_t qcmask)
+{
+  /* returns the query conditions that already use this filter */
+  for (uint32_t i = 0; i < rhc->n_qcfilters; i++)
+  {
+    if (rhc->qcfilters[i].filter == filter)
+    {
+      const dds_querycond_mask_t others = rhc->qcfilters[i].qcmask;
+      rhc->qcfilters[i].qcmask |= qcmask;
+      return others;
+    }
+  }
+  assert (rhc->n_qcfilters < RHC_MAX_QCFILTERS);
+  rhc->qcfilters[rhc->n_qcfilters].filter = filter;
+  rhc->qcfilters[rhc->n_qcfilters].qcmask = qcmask;
+  rhc->n_qcfilters++;
+  return 0;
+}
+
+static void qcfilter_remove (struct dds_rhc_default *rhc, dds_querycondition_filter_fn filter, dds_querycond_mask_t qcmask)
+{
+  uint32_t i = 0;
+  while (rhc->qcfilters[i].filter != filter)
+    i++;
+  assert (i < rhc->n_qcfilters && (rhc->qcfilters[i].qcmask & qcmask));
+  if ((rhc->qcfilters[i].qcmask &= ~qcmask) == 0)
+    rhc->qcfilters[i] = rhc->qcfilters[--rhc->n_qcfilters];
+}
+
 static bool dds_rhc_default_add_readcondition (struct dds_rhc *rhc_common, dds_readcond *cond)
 {
   /* On the assumption that a readcondition will be attached to a
@@ -2383,7 +3164,7 @@ static bool dds_rhc_default_add_readcondition (struct dds_rhc *rhc_common, dds_r
     if (avail_qcmask == 0)
     {
       /* no available indices */
-      ddsrt_mutex_unlock (&rhc->lock);
+      rhc_unlock (rhc);
       return false;
     }
 
@@ -2394,6 +3175,7 @@ static bool dds_rhc_default_add_readcondition (struct dds_rhc *rhc_common, dds_r
   rhc->nconds++;
   cond->m_next = rhc->conds;
   rhc->conds = cond;
+  condgroup_add (rhc, cond);
 
   uint32_t trigger = 0;
   if (cond->m_query.m_filter == 0)
@@ -2421,11 +3203,13 @@ static bool dds_rhc_default_add_readcondition (struct dds_rhc *rhc_common, dds_r
     }
 
     /* Attaching a query condition means clearing the allocated bit in all instances and
-       samples, except for those that match the predicate. */
+       samples, except for those that match the predicate.  If another condition uses the
+       same filter, its bit has the result. */
     const dds_querycond_mask_t qcmask = cond->m_query.m_qcmask;
+    const dds_querycond_mask_t same_filter = qcfilter_add (rhc, cond->m_query.m_filter, qcmask);
     for (struct rhc_instance *inst = ddsrt_hh_iter_first (rhc->instances, &it); inst != NULL; inst = ddsrt_hh_iter_next (&it))
     {
-      const bool instmatch = eval_predicate_invsample (rhc, inst, cond->m_query.m_filter);;
+      const bool instmatch = same_filter ? (inst->conds & same_filter) != 0 : eval_predicate_invsample (rhc, inst, cond->m_query.m_filter);
       uint32_t matches = 0;
 
       inst->conds = (inst->conds & ~qcmask) | (instmatch ? qcmask : 0);
@@ -2433,7 +3217,7 @@ static bool dds_rhc_default_add_readcondition (struct dds_rhc *rhc_common, dds_r
       {
         struct rhc_sample *sample = inst->latest->next, * const end = sample;
         do {
-          const bool m = eval_predicate_sample (rhc, sample->sample, cond->m_query.m_filter);
+          const bool m = same_filter ? (sample->conds & same_filter) != 0 : eval_predicate_sample (rhc, sample->sample, cond->m_query.m_filter);
           sample->conds = (sample->conds & ~qcmask) | (m ? qcmask : 0);
           matches += m;
           sample = sample->next;
@@ -2455,7 +3239,7 @@ static bool dds_rhc_default_add_readcondition (struct dds_rhc *rhc_common, dds_r
     (void *) rhc, cond->m_sample_states, cond->m_view_states,
     cond->m_instance_states, (void *) cond, cond->m_qminv, rhc->nconds);
 
-  ddsrt_mutex_unlock (&rhc->lock);
+  rhc_unlock (rhc);
   return true;
 }
 
@@ -2469,8 +3253,10 @@ static void dds_rhc_default_remove_readcondition (struct dds_rhc *rhc_common, dd
     ptr = &(*ptr)->m_next;
   *ptr = (*ptr)->m_next;
   rhc->nconds--;
+  condgroup_remove (rhc, cond);
   if (cond->m_query.m_filter)
   {
+    qcfilter_remove (rhc, cond->m_query.m_filter, cond->m_query.m_qcmask);
     rhc->nqconds--;
     rhc->qconds_samplest &= ~cond->m_query.m_qcmask;
     cond->m_query.m_qcmask = 0;
@@ -2481,15 +3267,15 @@ static void dds_rhc_default_remove_readcondition (struct dds_rhc *rhc_common, dd
       rhc->qcond_eval_samplebuf = NULL;
     }
   }
-  ddsrt_mutex_unlock (&rhc->lock);
+  rhc_unlock (rhc);
 }
 
 static bool update_conditions_locked (struct dds_rhc_default *rhc, bool called_from_insert, const struct trigger_info_pre *pre, const struct trigger_info_post *post, const struct trigger_info_qcond *trig_qc, const struct rhc_instance *inst)
 {
   /* Pre: rhc->lock held; returns 1 if triggering required, else 0. */
-  bool trigger = false;
-  dds_readcond *iter;
-  bool m_pre, m_post;
+  bool any_trigger = false;
+  const dds_querycond_mask_t qc_touched =
+    trig_qc->dec_conds_invsample | trig_qc->dec_conds_sample | trig_qc->inc_conds_invsample | trig_qc->inc_conds_sample;
 
   TRACE ("update_conditions_locked(%p %p) - inst %"PRIu32" nonempty %"PRIu32" disp %"PRIu32" nowr %"PRIu32" new %"PRIu32" samples %"PRIu32" read %"PRIu32"\n",
          (void *) rhc, (void *) inst, rhc->n_instances, rhc->n_nonempty_instances, rhc->n_not_alive_disposed,
@@ -2508,22 +3294,18 @@ static bool update_conditions_locked (struct dds_rhc_default *rhc, bool called_f
 #endif
   assert (rhc->n_vsamples >= rhc->n_vread);
 
-  iter = rhc->conds;
-  while (iter)
+  for (const struct rhc_condgroup *grp = rhc->condgroups; grp; grp = grp->next)
   {
-    m_pre = ((pre->c.qminst & iter->m_qminv) == 0);
-    m_post = ((post->c.qminst & iter->m_qminv) == 0);
+    bool m_pre = ((pre->c.qminst & grp->qminv) == 0);
+    bool m_post = ((post->c.qminst & grp->qminv) == 0);
 
     /* Fast path out: instance did not and will not match based on instance, view states, so no
        need to evaluate anything else */
     if (!m_pre && !m_post)
-    {
-      iter = iter->m_next;
       continue;
-    }
 
     /* FIXME: use bitmask? */
-    switch (iter->m_sample_states)
+    switch (grp->sample_states)
     {
       case DDS_SST_READ:
         m_pre = m_pre && pre->c.has_read;
@@ -2539,151 +3321,166 @@ static bool update_conditions_locked (struct dds_rhc_default *rhc, bool called_f
         m_post = m_post && (post->c.has_read + post->c.has_not_read);
         break;
       default:
-        DDS_FATAL ("update_readconditions: sample_states invalid: %"PRIx32"\n", iter->m_sample_states);
+        DDS_FATAL ("update_readconditions: sample_states invalid: %"PRIx32"\n", grp->sample_states);
     }
 
-    TRACE ("  cond %p %08"PRIx32": ", (void *) iter, iter->m_query.m_qcmask);
-    if (iter->m_query.m_filter == 0)
+    /* Nothing changes for any of the conditions in the group if none matches before or after */
+    if (!m_pre && !m_post)
+      continue;
+
+    for (uint32_t i = 0; i < grp->nconds; i++)
     {
-      assert (dds_entity_kind (&iter->m_entity) == DDS_KIND_COND_READ);
-      if (m_pre == m_post)
-        TRACE ("no change");
-      else if (m_pre < m_post)
+      dds_readcond * const iter = grp->conds[i];
+      bool trigger = false;
+
+      /* If all conditions in the group matched before and still do, the count only changes for
+         query conditions for which the update involved a sample matching the filter */
+      if (m_pre && m_post && (iter->m_query.m_qcmask & qc_touched) == 0)
+        continue;
+
+      TRACE ("  cond %p %08"PRIx32": ", (void *) iter, iter->m_query.m_qcmask);
+      if (iter->m_query.m_filter == 0)
       {
-        TRACE ("now matches");
-        trigger = (ddsrt_atomic_inc32_ov (&iter->m_entity.m_status.m_trigger) == 0);
-        if (trigger)
-          TRACE (" (cond now triggers)");
+        assert (dds_entity_kind (&iter->m_entity) == DDS_KIND_COND_READ);
+        if (m_pre == m_post)
+          TRACE ("no change");
+        else if (m_pre < m_post)
+        {
+          TRACE ("now matches");
+          trigger = (ddsrt_atomic_inc32_ov (&iter->m_entity.m_status.m_trigger) == 0);
+          if (trigger)
+            TRACE (" (cond now triggers)");
+        }
+        else
+        {
+          TRACE ("no longer matches");
+          if (ddsrt_atomic_dec32_nv (&iter->m_entity.m_status.m_trigger) == 0)
+            TRACE (" (cond no longer triggers)");
+        }
       }
-      else
+      else if (m_pre || m_post) /* no need to look any further if both are false */
       {
-        TRACE ("no longer matches");
-        if (ddsrt_atomic_dec32_nv (&iter->m_entity.m_status.m_trigger) == 0)
-          TRACE (" (cond no longer triggers)");
-      }
-    }
-    else if (m_pre || m_post) /* no need to look any further if both are false */
-    {
-      assert (dds_entity_kind (&iter->m_entity) == DDS_KIND_COND_QUERY);
-      assert (iter->m_query.m_qcmask != 0);
-      const dds_querycond_mask_t qcmask = iter->m_query.m_qcmask;
-      int32_t mdelta = 0;
+        assert (dds_entity_kind (&iter->m_entity) == DDS_KIND_COND_QUERY);
+        assert (iter->m_query.m_qcmask != 0);
+        const dds_querycond_mask_t qcmask = iter->m_query.m_qcmask;
+        int32_t mdelta = 0;
 
-      switch (iter->m_sample_states)
-      {
-        case DDS_SST_READ:
-          if (trig_qc->dec_invsample_read)
-            mdelta -= (trig_qc->dec_conds_invsample & qcmask) != 0;
-          if (trig_qc->dec_sample_read)
-            mdelta -= (trig_qc->dec_conds_sample & qcmask) != 0;
-          if (trig_qc->inc_invsample_read)
-            mdelta += (trig_qc->inc_conds_invsample & qcmask) != 0;
-          if (trig_qc->inc_sample_read)
-            mdelta += (trig_qc->inc_conds_sample & qcmask) != 0;
-          break;
-        case DDS_SST_NOT_READ:
-          if (!trig_qc->dec_invsample_read)
+        switch (iter->m_sample_states)
+        {
+          case DDS_SST_READ:
+            if (trig_qc->dec_invsample_read)
+              mdelta -= (trig_qc->dec_conds_invsample & qcmask) != 0;
+            if (trig_qc->dec_sample_read)
+              mdelta -= (trig_qc->dec_conds_sample & qcmask) != 0;
+            if (trig_qc->inc_invsample_read)
+              mdelta += (trig_qc->inc_conds_invsample & qcmask) != 0;
+            if (trig_qc->inc_sample_read)
+              mdelta += (trig_qc->inc_conds_sample & qcmask) != 0;
+            break;
+          case DDS_SST_NOT_READ:
+            if (!trig_qc->dec_invsample_read)
+              mdelta -= (trig_qc->dec_conds_invsample & qcmask) != 0;
+            if (!trig_qc->dec_sample_read)
+              mdelta -= (trig_qc->dec_conds_sample & qcmask) != 0;
+            if (!trig_qc->inc_invsample_read)
+              mdelta += (trig_qc->inc_conds_invsample & qcmask) != 0;
+            if (!trig_qc->inc_sample_read)
+              mdelta += (trig_qc->inc_conds_sample & qcmask) != 0;
+            break;
+          case DDS_SST_READ | DDS_SST_NOT_READ:
+          case 0:
             mdelta -= (trig_qc->dec_conds_invsample & qcmask) != 0;
-          if (!trig_qc->dec_sample_read)
             mdelta -= (trig_qc->dec_conds_sample & qcmask) != 0;
-          if (!trig_qc->inc_invsample_read)
             mdelta += (trig_qc->inc_conds_invsample & qcmask) != 0;
-          if (!trig_qc->inc_sample_read)
             mdelta += (trig_qc->inc_conds_sample & qcmask) != 0;
-          break;
-        case DDS_SST_READ | DDS_SST_NOT_READ:
-        case 0:
-          mdelta -= (trig_qc->dec_conds_invsample & qcmask) != 0;
-          mdelta -= (trig_qc->dec_conds_sample & qcmask) != 0;
-          mdelta += (trig_qc->inc_conds_invsample & qcmask) != 0;
-          mdelta += (trig_qc->inc_conds_sample & qcmask) != 0;
-          break;
-        default:
-          DDS_FATAL ("update_readconditions: sample_states invalid: %"PRIx32"\n", iter->m_sample_states);
-      }
-
-      if (m_pre == m_post)
-      {
-        assert (m_pre);
-        /* there was a match at read-condition level
-           - therefore the matching samples in the instance are accounted for in the trigger count
-           - therefore an incremental update is required
-           there is always space for a valid and an invalid sample, both add and remove
-           inserting an update always has unread data added, but a read pretends it is a removal
-           of whatever and an insertion of read data */
-        assert (mdelta >= 0 || ddsrt_atomic_ld32 (&iter->m_entity.m_status.m_trigger) >= (uint32_t) -mdelta);
-        if (mdelta == 0)
-          TRACE ("no change @ %"PRIu32" (0)", ddsrt_atomic_ld32 (&iter->m_entity.m_status.m_trigger));
-        else
-          TRACE ("m=%"PRId32" @ %"PRIu32" (0)", mdelta, ddsrt_atomic_ld32 (&iter->m_entity.m_status.m_trigger) + (uint32_t) mdelta);
-        /* even though it matches now and matched before, it is not a given that any of the samples
-           matched before, so m_trigger may still be 0 */
-        const uint32_t ov = ddsrt_atomic_add32_ov (&iter->m_entity.m_status.m_trigger, (uint32_t) mdelta);
-        if (mdelta > 0 && ov == 0)
-          trigger = true;
-        if (trigger)
-          TRACE (" (cond now triggers)");
-        else if (mdelta < 0 && ov == (uint32_t) -mdelta)
-          TRACE (" (cond no longer triggers)");
-      }
-      else
-      {
-        /* There either was no match at read-condition level, now there is: scan all samples for matches;
-           or there was a match and now there is not: so also scan all samples for matches.  The only
-           difference is in whether the number of matches should be added or subtracted. */
-        int32_t mcurrent = 0;
-        if (inst)
-        {
-          if (inst->inv_exists)
-            mcurrent += (qmask_of_invsample (inst) & iter->m_qminv) == 0 && (inst->conds & qcmask) != 0;
-          if (inst->latest)
-          {
-            struct rhc_sample *sample = inst->latest->next, * const end = sample;
-            do {
-              mcurrent += (qmask_of_sample (sample) & iter->m_qminv) == 0 && (sample->conds & qcmask) != 0;
-              sample = sample->next;
-            } while (sample != end);
-          }
+            break;
+          default:
+            DDS_FATAL ("update_readconditions: sample_states invalid: %"PRIx32"\n", iter->m_sample_states);
         }
-        if (mdelta == 0 && mcurrent == 0)
-          TRACE ("no change @ %"PRIu32" (2)", ddsrt_atomic_ld32 (&iter->m_entity.m_status.m_trigger));
-        else if (m_pre < m_post)
+
+        if (m_pre == m_post)
         {
-          /* No match previously, so the instance wasn't accounted for at all in the trigger value.
-             Therefore when inserting data, all that matters is how many currently match.
-
-             When reading or taking it is evaluated incrementally _before_ changing the state of the
-             sample, so mrem reflects the state before the change, and the incremental change needs
-             to be taken into account. */
-          const int32_t m = called_from_insert ? mcurrent : mcurrent + mdelta;
-          TRACE ("mdelta=%"PRId32" mcurrent=%"PRId32" => %"PRId32" => %"PRIu32" (2a)", mdelta, mcurrent, m, ddsrt_atomic_ld32 (&iter->m_entity.m_status.m_trigger) + (uint32_t) m);
-          assert (m >= 0 || ddsrt_atomic_ld32 (&iter->m_entity.m_status.m_trigger) >= (uint32_t) -m);
-          trigger = (ddsrt_atomic_add32_ov (&iter->m_entity.m_status.m_trigger, (uint32_t) m) == 0 && m > 0);
+          assert (m_pre);
+          /* there was a match at read-condition level
+             - therefore the matching samples in the instance are accounted for in the trigger count
+             - therefore an incremental update is required
+             there is always space for a valid and an invalid sample, both add and remove
+             inserting an update always has unread data added, but a read pretends it is a removal
+             of whatever and an insertion of read data */
+          assert (mdelta >= 0 || ddsrt_atomic_ld32 (&iter->m_entity.m_status.m_trigger) >= (uint32_t) -mdelta);
+          if (mdelta == 0)
+            TRACE ("no change @ %"PRIu32" (0)", ddsrt_atomic_ld32 (&iter->m_entity.m_status.m_trigger));
+          else
+            TRACE ("m=%"PRId32" @ %"PRIu32" (0)", mdelta, ddsrt_atomic_ld32 (&iter->m_entity.m_status.m_trigger) + (uint32_t) mdelta);
+          /* even though it matches now and matched before, it is not a given that any of the samples
+             matched before, so m_trigger may still be 0 */
+          const uint32_t ov = ddsrt_atomic_add32_ov (&iter->m_entity.m_status.m_trigger, (uint32_t) mdelta);
+          if (mdelta > 0 && ov == 0)
+            trigger = true;
           if (trigger)
             TRACE (" (cond now triggers)");
+          else if (mdelta < 0 && ov == (uint32_t) -mdelta)
+            TRACE (" (cond no longer triggers)");
         }
         else
         {
-          /* Previously matched, but no longer, which means we need to subtract the current number
-             of matches as well as those that were removed just before, hence need the incremental
-             change as well */
-          const int32_t m = mcurrent - mdelta;
-          TRACE ("mdelta=%"PRId32" mcurrent=%"PRId32" => %"PRId32" => %"PRIu32" (2b)", mdelta, mcurrent, m, ddsrt_atomic_ld32 (&iter->m_entity.m_status.m_trigger) - (uint32_t) m);
-          assert (m < 0 || ddsrt_atomic_ld32 (&iter->m_entity.m_status.m_trigger) >= (uint32_t) m);
-          if (ddsrt_atomic_sub32_nv (&iter->m_entity.m_status.m_trigger, (uint32_t) m) == 0)
-            TRACE (" (cond no longer triggers)");
+          /* There either was no match at read-condition level, now there is: scan all samples for matches;
+             or there was a match and now there is not: so also scan all samples for matches.  The only
+             difference is in whether the number of matches should be added or subtracted. */
+          int32_t mcurrent = 0;
+          if (inst)
+          {
+            if (inst->inv_exists)
+              mcurrent += (qmask_of_invsample (inst) & iter->m_qminv) == 0 && (inst->conds & qcmask) != 0;
+            if (inst->latest)
+            {
+              struct rhc_sample *sample = inst->latest->next, * const end = sample;
+              do {
+                mcurrent += (qmask_of_sample (sample) & iter->m_qminv) == 0 && (sample->conds & qcmask) != 0;
+                sample = sample->next;
+              } while (sample != end);
+            }
+          }
+          if (mdelta == 0 && mcurrent == 0)
+            TRACE ("no change @ %"PRIu32" (2)", ddsrt_atomic_ld32 (&iter->m_entity.m_status.m_trigger));
+          else if (m_pre < m_post)
+          {
+            /* No match previously, so the instance wasn't accounted for at all in the trigger value.
+               Therefore when inserting data, all that matters is how many currently match.
+
+               When reading or taking it is evaluated incrementally _before_ changing the state of the
+               sample, so mrem reflects the state before the change, and the incremental change needs
+               to be taken into account. */
+            const int32_t m = called_from_insert ? mcurrent : mcurrent + mdelta;
+            TRACE ("mdelta=%"PRId32" mcurrent=%"PRId32" => %"PRId32" => %"PRIu32" (2a)", mdelta, mcurrent, m, ddsrt_atomic_ld32 (&iter->m_entity.m_status.m_trigger) + (uint32_t) m);
+            assert (m >= 0 || ddsrt_atomic_ld32 (&iter->m_entity.m_status.m_trigger) >= (uint32_t) -m);
+            trigger = (ddsrt_atomic_add32_ov (&iter->m_entity.m_status.m_trigger, (uint32_t) m) == 0 && m > 0);
+            if (trigger)
+              TRACE (" (cond now triggers)");
+          }
+          else
+          {
+            /* Previously matched, but no longer, which means we need to subtract the current number
+               of matches as well as those that were removed just before, hence need the incremental
+               change as well */
+            const int32_t m = mcurrent - mdelta;
+            TRACE ("mdelta=%"PRId32" mcurrent=%"PRId32" => %"PRId32" => %"PRIu32" (2b)", mdelta, mcurrent, m, ddsrt_atomic_ld32 (&iter->m_entity.m_status.m_trigger) - (uint32_t) m);
+            assert (m < 0 || ddsrt_atomic_ld32 (&iter->m_entity.m_status.m_trigger) >= (uint32_t) m);
+            if (ddsrt_atomic_sub32_nv (&iter->m_entity.m_status.m_trigger, (uint32_t) m) == 0)
+              TRACE (" (cond no longer triggers)");
+          }
         }
       }
-    }
 
-    if (trigger)
-    {
-      dds_entity_status_signal (&iter->m_entity, DDS_DATA_AVAILABLE_STATUS);
+      if (trigger)
+      {
+        dds_entity_status_signal (&iter->m_entity, DDS_DATA_AVAILABLE_STATUS);
+        any_trigger = true;
+      }
+      TRACE ("\n");
     }
-    TRACE ("\n");
-    iter = iter->m_next;
   }
-  return trigger;
+  return any_trigger;
 }
 
 
@@ -2757,11 +3554,18 @@ static int rhc_check_counts_locked (struct dds_rhc_default *rhc, bool check_cond
   for (inst = ddsrt_hh_iter_first (rhc->instances, &iter); inst; inst = ddsrt_hh_iter_next (&iter))
   {
     uint32_t n_vsamples_in_instance = 0, n_read_vsamples_in_instance = 0;
-    bool a_sample_free = true;
+    uint32_t inline_free = (uint32_t) ((1u << rhc->n_inline_samples) - 1);
 
     n_instances++;
     if (inst->isnew)
       n_new++;
+    if (inst->wr_iid_islive)
+    {
+      const struct rhc_wrreg *r;
+      for (r = inst->wrregs; r && r->wr->wr_iid != inst->wr_iid; r = r->inst_next)
+        ;
+      assert (r != NULL && r->inst == inst && rhc_writer_lookup (rhc, inst->wr_iid) == r->wr);
+    }
     if (inst_is_empty (inst))
       continue;
 
@@ -2775,10 +3579,13 @@ static int rhc_check_counts_locked (struct dds_rhc_default *rhc, bool check_cond
     {
       struct rhc_sample *sample = inst->latest->next, * const end = sample;
       do {
-        if (sample == &inst->a_sample)
+        for (uint32_t i = 0; i < rhc->n_inline_samples; i++)
         {
-          assert (a_sample_free);
-          a_sample_free = false;
+          if (sample == &inst->inline_samples[i])
+          {
+            assert (inline_free & (1u << i));
+            inline_free &= ~(1u << i);
+          }
         }
         n_vsamples++;
         n_vsamples_in_instance++;
@@ -2799,7 +3606,7 @@ static int rhc_check_counts_locked (struct dds_rhc_default *rhc, bool check_cond
 
     assert (n_read_vsamples_in_instance == inst->nvread);
     assert (n_vsamples_in_instance == inst->nvsamples);
-    assert (a_sample_free == inst->a_sample_free);
+    assert (inline_free == inst->inline_free);
 
     if (check_conds)
     {
@@ -2908,5 +3715,6 @@ static const struct dds_rhc_ops dds_rhc_default_ops = {
   .add_readcondition = dds_rhc_default_add_readcondition,
   .remove_readcondition = dds_rhc_default_remove_readcondition,
   .lock_samples = dds_rhc_default_lock_samples,
-  .associate = dds_rhc_default_associate
+  .associate = dds_rhc_default_associate,
+  .get_stats = dds_rhc_default_get_stats
 };
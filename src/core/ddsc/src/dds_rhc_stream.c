@@ -0,0 +1,323 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include <assert.h>
+#include <string.h>
+#include "dds/ddsrt/heap.h"
+#include "dds/ddsrt/sync.h"
+#include "dds/ddsrt/atomics.h"
+#include "dds/ddsi/ddsi_rhc.h"
+#include "dds/ddsi/ddsi_serdata.h"
+#include "dds/ddsi/ddsi_tkmap.h"
+#include "dds/ddsi/ddsi_entity.h"
+#include "dds/ddsi/ddsi_thread.h"
+#include "dds__entity.h"
+#include "dds__reader.h"
+#include "dds__rhc_stream.h"
+
+/* The ring is indexed by free-running counters: head is only written by the producer
+   side (delivery) and tail only by the consumer side (take), each holding its own lock
+   so that multiple delivery paths resp. multiple application threads are serialized
+   among themselves, but never with the other side.  A slot is free for the producer
+   once tail has moved past it, and contains a sample for the consumer once head has
+   moved past it. */
+
+struct rhc_stream_entry {
+  struct ddsi_serdata *sample;
+  uint64_t wr_iid;
+  uint64_t iid;
+};
+
+struct dds_rhc_stream {
+  struct dds_rhc common;
+  struct dds_reader *reader;
+  bool reliable;
+  uint32_t size_mask; /* capacity - 1, capacity is a power of 2 */
+  struct rhc_stream_entry *ring;
+
+  ddsrt_mutex_t producer_lock;
+  ddsrt_atomic_uint32_t head;
+  char pad[DDSI_CACHE_LINE_SIZE];
+  ddsrt_mutex_t consumer_lock;
+  ddsrt_atomic_uint32_t tail;
+};
+
+static const struct dds_rhc_ops dds_rhc_stream_ops;
+
+static bool dds_rhc_stream_store (struct ddsi_rhc * __restrict rhc_common, const struct ddsi_writer_info * __restrict wrinfo, struct ddsi_serdata * __restrict sample, struct ddsi_tkmap_instance * __restrict tk)
+{
+  struct dds_rhc_stream * __restrict const rhc = (struct dds_rhc_stream * __restrict) rhc_common;
+
+  /* The topic is keyless and only the data is of interest: disposes, unregisters and
+     registrations don't change anything */
+  if (sample->kind != SDK_DATA || sample->statusinfo != 0)
+    return true;
+
+  ddsrt_mutex_lock (&rhc->producer_lock);
+  const uint32_t head = ddsrt_atomic_ld32 (&rhc->head);
+  const uint32_t tail = ddsrt_atomic_ld32 (&rhc->tail);
+  ddsrt_atomic_fence_acq ();
+  if (head - tail > rhc->size_mask)
+  {
+    ddsrt_mutex_unlock (&rhc->producer_lock);
+    ddsi_status_cb_data_t cb_data = {
+      .raw_status_id = (int) DDS_SAMPLE_REJECTED_STATUS_ID,
+      .extra = DDS_REJECTED_BY_SAMPLES_LIMIT,
+      .handle = tk->m_iid,
+      .add = true
+    };
+    dds_reader_status_cb (&rhc->reader->m_entity, &cb_data);
+    /* a reliable sample gets retried, a best-effort one is lost */
+    return !rhc->reliable;
+  }
+  struct rhc_stream_entry * const e = &rhc->ring[head & rhc->size_mask];
+  e->sample = ddsi_serdata_ref (sample);
+  e->wr_iid = wrinfo->iid;
+  e->iid = tk->m_iid;
+  ddsrt_atomic_fence_rel ();
+  ddsrt_atomic_st32 (&rhc->head, head + 1);
+  ddsrt_mutex_unlock (&rhc->producer_lock);
+
+  dds_reader_data_available_cb (rhc->reader);
+  return true;
+}
+
+static void dds_rhc_stream_unregister_wr (struct ddsi_rhc * __restrict rhc_common, const struct ddsi_writer_info * __restrict wrinfo)
+{
+  (void) rhc_common; (void) wrinfo;
+}
+
+static void dds_rhc_stream_relinquish_ownership (struct ddsi_rhc * __restrict rhc_common, const uint64_t wr_iid)
+{
+  (void) rhc_common; (void) wr_iid;
+}
+
+static void dds_rhc_stream_set_qos (struct ddsi_rhc *rhc_common, const dds_qos_t *qos)
+{
+  (void) rhc_common; (void) qos;
+}
+
+static void dds_rhc_stream_free (struct ddsi_rhc *rhc_common)
+{
+  struct dds_rhc_stream *rhc = (struct dds_rhc_stream *) rhc_common;
+  const uint32_t head = ddsrt_atomic_ld32 (&rhc->head);
+  for (uint32_t i = ddsrt_atomic_ld32 (&rhc->tail); i != head; i++)
+    ddsi_serdata_unref (rhc->ring[i & rhc->size_mask].sample);
+  ddsrt_free (rhc->ring);
+  ddsrt_mutex_destroy (&rhc->producer_lock);
+  ddsrt_mutex_destroy (&rhc->consumer_lock);
+  ddsrt_free (rhc);
+}
+
+/* Removes up to maxs samples from the ring, the caller must hold the consumer lock.  On
+   return entries[0 .. n-1] are the taken entries, n the return value. */
+static uint32_t take_entries (struct dds_rhc_stream *rhc, struct rhc_stream_entry *entries, uint32_t maxs)
+{
+  const uint32_t tail = ddsrt_atomic_ld32 (&rhc->tail);
+  const uint32_t head = ddsrt_atomic_ld32 (&rhc->head);
+  ddsrt_atomic_fence_acq ();
+  const uint32_t n = (head - tail < maxs) ? head - tail : maxs;
+  for (uint32_t i = 0; i < n; i++)
+    entries[i] = rhc->ring[(tail + i) & rhc->size_mask];
+  ddsrt_atomic_fence_rel ();
+  ddsrt_atomic_st32 (&rhc->tail, tail + n);
+  return n;
+}
+
+/* Takes the samples in batches, to avoid copying out one entry at a time */
+#define TAKE_BATCH 32
+
+static void make_sampleinfo (dds_sample_info_t *si, const struct rhc_stream_entry *e)
+{
+  memset (si, 0, sizeof (*si));
+  si->sample_state = DDS_SST_NOT_READ;
+  si->view_state = DDS_VST_NEW;
+  si->instance_state = DDS_IST_ALIVE;
+  si->valid_data = true;
+  si->source_timestamp = e->sample->timestamp.v;
+  si->instance_handle = e->iid;
+  si->publication_handle = e->wr_iid;
+}
+
+static bool stream_states_match (uint32_t sample_states, uint32_t view_states, uint32_t instance_states)
+{
+  /* all samples are not-read samples of a new, alive instance */
+  return ((sample_states == 0 || (sample_states & DDS_NOT_READ_SAMPLE_STATE)) &&
+          (view_states == 0 || (view_states & DDS_NEW_VIEW_STATE)) &&
+          (instance_states == 0 || (instance_states & DDS_ALIVE_INSTANCE_STATE)));
+}
+
+static int32_t take_locked (struct dds_rhc_stream *rhc, void **values, struct ddsi_serdata **cdrvalues, dds_sample_info_t *info_seq, uint32_t maxs)
+{
+  struct rhc_stream_entry entries[TAKE_BATCH];
+  uint32_t n = 0, m;
+  do {
+    const uint32_t req = (maxs - n < TAKE_BATCH) ? maxs - n : TAKE_BATCH;
+    m = take_entries (rhc, entries, req);
+    for (uint32_t i = 0; i < m; i++)
+    {
+      if (info_seq)
+        make_sampleinfo (&info_seq[n + i], &entries[i]);
+      if (cdrvalues)
+        cdrvalues[n + i] = entries[i].sample;
+      else
+      {
+        (void) ddsi_serdata_to_sample (entries[i].sample, values[n + i], NULL, NULL);
+        ddsi_serdata_unref (entries[i].sample);
+      }
+    }
+    n += m;
+  } while (m == TAKE_BATCH && n < maxs);
+  return (int32_t) n;
+}
+
+static int32_t dds_rhc_stream_read (struct dds_rhc *rhc_common, bool lock, void **values, dds_sample_info_t *info_seq, uint32_t max_samples, uint32_t mask, dds_instance_handle_t handle, struct dds_readcond *cond)
+{
+  /* reading leaves the sample in the ring and would need to track its state */
+  struct dds_rhc_stream * const rhc = (struct dds_rhc_stream *) rhc_common;
+  (void) values; (void) info_seq; (void) max_samples; (void) mask; (void) handle; (void) cond;
+  if (!lock)
+    ddsrt_mutex_unlock (&rhc->consumer_lock);
+  return DDS_RETCODE_ILLEGAL_OPERATION;
+}
+
+static int32_t dds_rhc_stream_readcdr (struct dds_rhc *rhc_common, bool lock, struct ddsi_serdata **values, dds_sample_info_t *info_seq, uint32_t max_samples, uint32_t sample_states, uint32_t view_states, uint32_t instance_states, dds_instance_handle_t handle)
+{
+  struct dds_rhc_stream * const rhc = (struct dds_rhc_stream *) rhc_common;
+  (void) values; (void) info_seq; (void) max_samples; (void) sample_states; (void) view_states; (void) instance_states; (void) handle;
+  if (!lock)
+    ddsrt_mutex_unlock (&rhc->consumer_lock);
+  return DDS_RETCODE_ILLEGAL_OPERATION;
+}
+
+static int32_t dds_rhc_stream_take_impl (struct dds_rhc_stream *rhc, bool lock, void **values, struct ddsi_serdata **cdrvalues, dds_sample_info_t *info_seq, uint32_t max_samples, uint32_t sample_states, uint32_t view_states, uint32_t instance_states, dds_instance_handle_t handle)
+{
+  int32_t n;
+  if (lock)
+    ddsrt_mutex_lock (&rhc->consumer_lock);
+  if (handle != DDS_HANDLE_NIL)
+    n = DDS_RETCODE_ILLEGAL_OPERATION;
+  else if (!stream_states_match (sample_states, view_states, instance_states))
+    n = 0;
+  else
+    n = take_locked (rhc, values, cdrvalues, info_seq, max_samples);
+  ddsrt_mutex_unlock (&rhc->consumer_lock);
+  return n;
+}
+
+static int32_t dds_rhc_stream_take (struct dds_rhc *rhc_common, bool lock, void **values, dds_sample_info_t *info_seq, uint32_t max_samples, uint32_t mask, dds_instance_handle_t handle, struct dds_readcond *cond)
+{
+  struct dds_rhc_stream * const rhc = (struct dds_rhc_stream *) rhc_common;
+  /* conditions can't be attached to a stream reader */
+  assert (cond == NULL);
+  (void) cond;
+  return dds_rhc_stream_take_impl (rhc, lock, values, NULL, info_seq, max_samples, mask & DDS_ANY_SAMPLE_STATE, mask & DDS_ANY_VIEW_STATE, mask & DDS_ANY_INSTANCE_STATE, handle);
+}
+
+static int32_t dds_rhc_stream_takecdr (struct dds_rhc *rhc_common, bool lock, struct ddsi_serdata **values, dds_sample_info_t *info_seq, uint32_t max_samples, uint32_t sample_states, uint32_t view_states, uint32_t instance_states, dds_instance_handle_t handle)
+{
+  struct dds_rhc_stream * const rhc = (struct dds_rhc_stream *) rhc_common;
+  return dds_rhc_stream_take_impl (rhc, lock, NULL, values, info_seq, max_samples, sample_states, view_states, instance_states, handle);
+}
+
+static bool dds_rhc_stream_add_readcondition (struct dds_rhc *rhc_common, struct dds_readcond *cond)
+{
+  /* dds_create_readcondition and dds_create_querycondition refuse stream readers */
+  (void) rhc_common; (void) cond;
+  assert (0);
+  return false;
+}
+
+static void dds_rhc_stream_remove_readcondition (struct dds_rhc *rhc_common, struct dds_readcond *cond)
+{
+  (void) rhc_common; (void) cond;
+}
+
+static uint32_t dds_rhc_stream_lock_samples (struct dds_rhc *rhc_common)
+{
+  struct dds_rhc_stream * const rhc = (struct dds_rhc_stream *) rhc_common;
+  ddsrt_mutex_lock (&rhc->consumer_lock);
+  return ddsrt_atomic_ld32 (&rhc->head) - ddsrt_atomic_ld32 (&rhc->tail);
+}
+
+static dds_return_t dds_rhc_stream_associate (struct dds_rhc *rhc_common, struct dds_reader *reader, const struct ddsi_sertype *type, struct ddsi_tkmap *tkmap)
+{
+  (void) rhc_common; (void) reader; (void) type; (void) tkmap;
+  return DDS_RETCODE_OK;
+}
+
+static void dds_rhc_stream_get_stats (struct dds_rhc *rhc_common, struct dds_rhc_stats *stats)
+{
+  struct dds_rhc_stream * const rhc = (struct dds_rhc_stream *) rhc_common;
+  const uint32_t tail = ddsrt_atomic_ld32 (&rhc->tail);
+  stats->instance_pool_size = 0;
+  stats->instance_pool_used = 0;
+  stats->sample_pool_size = rhc->size_mask + 1;
+  stats->sample_pool_used = ddsrt_atomic_ld32 (&rhc->head) - tail;
+}
+
+static const struct dds_rhc_ops dds_rhc_stream_ops = {
+  .rhc_ops = {
+    .store = dds_rhc_stream_store,
+    .unregister_wr = dds_rhc_stream_unregister_wr,
+    .relinquish_ownership = dds_rhc_stream_relinquish_ownership,
+    .set_qos = dds_rhc_stream_set_qos,
+    .free = dds_rhc_stream_free
+  },
+  .read = dds_rhc_stream_read,
+  .take = dds_rhc_stream_take,
+  .readcdr = dds_rhc_stream_readcdr,
+  .takecdr = dds_rhc_stream_takecdr,
+  .add_readcondition = dds_rhc_stream_add_readcondition,
+  .remove_readcondition = dds_rhc_stream_remove_readcondition,
+  .lock_samples = dds_rhc_stream_lock_samples,
+  .associate = dds_rhc_stream_associate,
+  .get_stats = dds_rhc_stream_get_stats
+};
+
+struct dds_rhc *dds_rhc_stream_new (struct dds_reader *reader, uint32_t capacity)
+{
+  struct dds_rhc_stream *rhc = ddsrt_malloc (sizeof (*rhc));
+  uint32_t size = 1;
+  assert (capacity > 0 && capacity <= DDS_READER_STREAM_MAX_CAPACITY);
+  while (size < capacity)
+    size <<= 1;
+  memset (rhc, 0, sizeof (*rhc));
+  rhc->common.common.ops = &dds_rhc_stream_ops;
+  rhc->reader = reader;
+  rhc->reliable = (reader->m_entity.m_qos->reliability.kind == DDS_RELIABILITY_RELIABLE);
+  rhc->size_mask = size - 1;
+  rhc->ring = ddsrt_malloc (size * sizeof (*rhc->ring));
+  ddsrt_mutex_init (&rhc->producer_lock);
+  ddsrt_atomic_st32 (&rhc->head, 0);
+  ddsrt_mutex_init (&rhc->consumer_lock);
+  ddsrt_atomic_st32 (&rhc->tail, 0);
+  return &rhc->common;
+}
+
+bool dds_rhc_is_stream (const struct dds_rhc *rhc)
+{
+  return rhc->common.ops == &dds_rhc_stream_ops;
+}
+
+int32_t dds_rhc_stream_take_samples (struct dds_rhc *rhc_common, void **values, uint32_t maxs)
+{
+  struct dds_rhc_stream * const rhc = (struct dds_rhc_stream *) rhc_common;
+  assert (dds_rhc_is_stream (rhc_common));
+  return dds_rhc_stream_take_impl (rhc, true, values, NULL, NULL, maxs, 0, 0, 0, DDS_HANDLE_NIL);
+}
+
+int32_t dds_rhc_stream_take_serdata (struct dds_rhc *rhc_common, struct ddsi_serdata **values, uint32_t maxs)
+{
+  struct dds_rhc_stream * const rhc = (struct dds_rhc_stream *) rhc_common;
+  assert (dds_rhc_is_stream (rhc_common));
+  return dds_rhc_stream_take_impl (rhc, true, NULL, values, NULL, maxs, 0, 0, 0, DDS_HANDLE_NIL);
+}
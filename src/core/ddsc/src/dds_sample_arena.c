@@ -0,0 +1,130 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include <assert.h>
+#include <string.h>
+#include "dds/ddsrt/heap.h"
+#include "dds/ddsi/ddsi_sertype.h"
+#include "dds/ddsi/ddsi_serdata.h"
+#include "dds__serdata_default.h"
+#include "dds__sample_arena.h"
+
+#define DDS_SAMPLE_ARENA_DEFAULT_CHUNK_SIZE 65536u
+#define DDS_SAMPLE_ARENA_ALIGN ((uintptr_t) 8)
+
+struct dds_sample_arena_chunk {
+  struct dds_sample_arena_chunk *next;
+  size_t size; /* number of bytes following the header */
+};
+
+static uintptr_t chunk_start (const struct dds_sample_arena_chunk *chunk)
+{
+  return (uintptr_t) (chunk + 1);
+}
+
+static void add_chunk (struct dds_sample_arena *arena, size_t size)
+{
+  struct dds_sample_arena_chunk *chunk = ddsrt_malloc (sizeof (*chunk) + size);
+  chunk->next = arena->chunks;
+  chunk->size = size;
+  arena->chunks = chunk;
+  arena->ptr = chunk_start (chunk);
+  arena->lim = arena->ptr + size;
+}
+
+static void free_chunks (struct dds_sample_arena_chunk *chunk)
+{
+  while (chunk)
+  {
+    struct dds_sample_arena_chunk *next = chunk->next;
+    ddsrt_free (chunk);
+    chunk = next;
+  }
+}
+
+dds_sample_arena_t *dds_create_sample_arena (size_t chunk_size)
+{
+  struct dds_sample_arena *arena = ddsrt_malloc (sizeof (*arena));
+  arena->chunk_size = (chunk_size > 0) ? chunk_size : DDS_SAMPLE_ARENA_DEFAULT_CHUNK_SIZE;
+  arena->chunks = NULL;
+  arena->ptr = arena->lim = 0;
+  return arena;
+}
+
+void dds_reset_sample_arena (dds_sample_arena_t *arena)
+{
+  if (arena == NULL || arena->chunks == NULL)
+    return;
+  /* hang on to the largest chunk */
+  struct dds_sample_arena_chunk **largest = &arena->chunks;
+  for (struct dds_sample_arena_chunk **c = &arena->chunks->next; *c; c = &(*c)->next)
+    if ((*c)->size > (*largest)->size)
+      largest = c;
+  struct dds_sample_arena_chunk * const keep = *largest;
+  *largest = keep->next;
+  free_chunks (arena->chunks);
+  keep->next = NULL;
+  arena->chunks = keep;
+  arena->ptr = chunk_start (keep);
+  arena->lim = arena->ptr + keep->size;
+}
+
+void dds_delete_sample_arena (dds_sample_arena_t *arena)
+{
+  if (arena == NULL)
+    return;
+  free_chunks (arena->chunks);
+  ddsrt_free (arena);
+}
+
+/* Tries to deserialize the sample into the free space of the most recent chunk.  If the
+   contents don't fit but the sample itself does, deserializing still runs to completion
+   and sets *contents_size to the amount of memory the contents need. */
+static void *try_deserialize (struct dds_sample_arena *arena, const struct dds_sertype_default *tp, uintptr_t align, const struct ddsi_serdata *d, bool valid_data, size_t *contents_size, bool *contents_size_known)
+{
+  const uintptr_t p = (arena->ptr + align - 1) & ~(align - 1);
+  if (arena->chunks == NULL || p > arena->lim || tp->type.size > arena->lim - p)
+    return NULL;
+  void *sample = (void *) p;
+  void *bufptr = (char *) sample + tp->type.size;
+  void *buflim = (void *) arena->lim;
+  if (valid_data ? ddsi_serdata_to_sample (d, sample, &bufptr, buflim) : ddsi_serdata_untyped_to_sample (&tp->c, d, sample, &bufptr, buflim))
+  {
+    arena->ptr = (uintptr_t) bufptr;
+    return sample;
+  }
+  /* on failure bufptr is where the contents would have ended */
+  *contents_size = (size_t) ((uintptr_t) bufptr - (p + tp->type.size));
+  *contents_size_known = true;
+  return NULL;
+}
+
+void *dds_sample_arena_deserialize (struct dds_sample_arena *arena, const struct ddsi_sertype *type, const struct ddsi_serdata *d, bool valid_data)
+{
+  const struct dds_sertype_default *tp = (const struct dds_sertype_default *) type;
+  const uintptr_t align = (tp->type.align > DDS_SAMPLE_ARENA_ALIGN) ? tp->type.align : DDS_SAMPLE_ARENA_ALIGN;
+  size_t contents_size = 0;
+  bool contents_size_known = false, last_attempt = false;
+  void *sample;
+  assert (type->ops == &dds_sertype_ops_default);
+  /* If it doesn't fit in the remainder of the current chunk, add one large enough for
+     the sample and the contents (if known), with some slack for alignment.  The contents
+     are known after at most one more attempt and a chunk sized for them must suffice. */
+  while ((sample = try_deserialize (arena, tp, align, d, valid_data, &contents_size, &contents_size_known)) == NULL)
+  {
+    if (last_attempt)
+      return NULL;
+    last_attempt = contents_size_known;
+    const size_t size = tp->type.size + contents_size + 2 * align;
+    add_chunk (arena, (size > arena->chunk_size) ? size : arena->chunk_size);
+  }
+  return sample;
+}
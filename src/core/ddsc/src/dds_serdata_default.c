@@ -219,6 +219,14 @@ static inline bool is_topic_fixed_key(uint32_t flagset, uint32_t xcdrv)
   return false;
 }
 
+static void write_key (dds_ostream_t * __restrict os, const char * __restrict sample, const struct dds_sertype_default * __restrict type)
+{
+  if (type->type.serializers && type->type.serializers->write_key)
+    type->type.serializers->write_key (os, sample);
+  else
+    dds_stream_write_key (os, sample, &type->type);
+}
+
 static bool gen_serdata_key (const struct dds_sertype_default *type, struct dds_serdata_default_key *kh, enum gen_serdata_key_input_kind input_kind, void *input)
 {
   const struct dds_cdrstream_desc *desc = &type->type;
@@ -255,10 +263,15 @@ static bool gen_serdata_key (const struct dds_sertype_default *type, struct dds_
     switch (input_kind)
     {
       case GSKIK_SAMPLE:
-        dds_stream_write_key (&os, input, &type->type);
+        write_key (&os, input, type);
         break;
       case GSKIK_CDRSAMPLE:
-        if (!dds_stream_extract_key_from_data (input, &os, &type->type))
+        if (type->type.serializers && type->type.serializers->extract_key_from_data)
+        {
+          if (!type->type.serializers->extract_key_from_data (input, &os))
+            return false;
+        }
+        else if (!dds_stream_extract_key_from_data (input, &os, &type->type))
           return false;
         break;
       case GSKIK_CDRKEY:
@@ -530,6 +543,7 @@ static void istream_from_serdata_default (dds_istream_t * __restrict s, const st
   assert (!DDSI_RTPS_CDR_ENC_LE (d->hdr.identifier));
 #endif
   s->m_xcdr_version = ddsi_sertype_enc_id_xcdr_version (d->hdr.identifier);
+  s->m_allocator = NULL;
 }
 
 static void ostream_from_serdata_default (dds_ostream_t * __restrict s, const struct dds_serdata_default * __restrict d)
@@ -574,7 +588,7 @@ static struct dds_serdata_default *serdata_default_from_sample_cdr_common (const
       ostream_add_to_serdata_default (&os, &d);
       break;
     case SDK_KEY:
-      dds_stream_write_key (&os, sample, &tp->type);
+      write_key (&os, sample, tp);
       ostream_add_to_serdata_default (&os, &d);
 
       /* FIXME: detect cases where the XCDR1 and 2 representations are equal,
@@ -706,10 +720,70 @@ static void serdata_default_to_ser_unref (struct ddsi_serdata *serdata_common, c
   ddsi_serdata_unref(serdata_common);
 }
 
+/* Memory used for the contents of a sample when to_sample is given a buffer: it is taken
+   from *bufptr .. buflim and, once that is exhausted, from the heap so that deserialization
+   can run to completion.  The latter only happens for a conversion that fails, but the
+   allocations are still laid out as if the buffer were large enough so that the caller
+   learns how much memory the sample needs. */
+union to_sample_overflow {
+  union to_sample_overflow *next;
+  uint64_t align_u64;
+  double align_dbl;
+  void *align_ptr;
+};
+
+struct to_sample_buffer {
+  struct dds_cdrstream_allocator allocator;
+  uintptr_t ptr;
+  uintptr_t lim;
+  union to_sample_overflow *overflow;
+};
+
+static void *to_sample_buffer_malloc (void *varg, size_t size)
+{
+  struct to_sample_buffer * const arg = varg;
+  const uintptr_t align = sizeof (union to_sample_overflow);
+  const uintptr_t p = (arg->ptr + align - 1) & ~(align - 1);
+  arg->ptr = p + size;
+  if (arg->overflow == NULL && p <= arg->lim && size <= arg->lim - p)
+    return (void *) p;
+  union to_sample_overflow *ov = ddsrt_malloc (sizeof (*ov) + size);
+  ov->next = arg->overflow;
+  arg->overflow = ov;
+  return ov + 1;
+}
+
+static void to_sample_buffer_init (struct to_sample_buffer *tsb, dds_istream_t *is, void *sample, const struct dds_sertype_default *tp, void **bufptr, void *buflim)
+{
+  tsb->allocator.malloc = to_sample_buffer_malloc;
+  tsb->allocator.arg = tsb;
+  tsb->ptr = (uintptr_t) *bufptr;
+  tsb->lim = (uintptr_t) buflim;
+  tsb->overflow = NULL;
+  is->m_allocator = &tsb->allocator;
+  /* memory in the buffer is never reused, so start with a zero-initialized sample */
+  memset (sample, 0, tp->type.size);
+}
+
+static bool to_sample_buffer_fini (struct to_sample_buffer *tsb, void **bufptr)
+{
+  *bufptr = (void *) tsb->ptr;
+  if (tsb->overflow == NULL)
+    return true;
+  while (tsb->overflow)
+  {
+    union to_sample_overflow *ov = tsb->overflow;
+    tsb->overflow = ov->next;
+    ddsrt_free (ov);
+  }
+  return false;
+}
+
 static bool serdata_default_to_sample_cdr (const struct ddsi_serdata *serdata_common, void *sample, void **bufptr, void *buflim)
 {
   const struct dds_serdata_default *d = (const struct dds_serdata_default *)serdata_common;
   const struct dds_sertype_default *tp = (const struct dds_sertype_default *) d->c.type;
+  struct to_sample_buffer tsb;
   dds_istream_t is;
 #ifdef DDS_HAS_SHM
   if (d->c.iox_chunk)
@@ -718,11 +792,15 @@ static bool serdata_default_to_sample_cdr (const struct ddsi_serdata *serdata_co
     iceoryx_header_t* hdr = iceoryx_header_from_chunk(iox_chunk);
     if(hdr->shm_data_state == IOX_CHUNK_CONTAINS_SERIALIZED_DATA) {
       dds_istream_init (&is, hdr->data_size, iox_chunk, ddsi_sertype_enc_id_xcdr_version(d->hdr.identifier));
+      if (bufptr)
+        to_sample_buffer_init (&tsb, &is, sample, tp, bufptr, buflim);
       assert (DDSI_RTPS_CDR_ENC_IS_NATIVE (d->hdr.identifier));
       if (d->c.kind == SDK_KEY)
         dds_stream_read_key (&is, sample, &tp->type);
       else
         dds_stream_read_sample (&is, sample, &tp->type);
+      if (bufptr)
+        return to_sample_buffer_fini (&tsb, bufptr);
     } else {
       // should contain raw unserialized data
       // we could check the data_state but should not be needed
@@ -731,13 +809,16 @@ static bool serdata_default_to_sample_cdr (const struct ddsi_serdata *serdata_co
     return true;
   }
 #endif
-  if (bufptr) abort(); else { (void)buflim; } /* FIXME: haven't implemented that bit yet! */
   assert (DDSI_RTPS_CDR_ENC_IS_NATIVE (d->hdr.identifier));
   istream_from_serdata_default(&is, d);
+  if (bufptr)
+    to_sample_buffer_init (&tsb, &is, sample, tp, bufptr, buflim);
   if (d->c.kind == SDK_KEY)
     dds_stream_read_key (&is, sample, &tp->type);
   else
     dds_stream_read_sample (&is, sample, &tp->type);
+  if (bufptr)
+    return to_sample_buffer_fini (&tsb, bufptr);
   return true; /* FIXME: can't conversion to sample fail? */
 }
 
@@ -745,22 +826,28 @@ static bool serdata_default_untyped_to_sample_cdr (const struct ddsi_sertype *se
 {
   const struct dds_serdata_default *d = (const struct dds_serdata_default *)serdata_common;
   const struct dds_sertype_default *tp = (const struct dds_sertype_default *) sertype_common;
+  struct to_sample_buffer tsb;
   dds_istream_t is;
   assert (d->c.type == NULL);
   assert (d->c.kind == SDK_KEY);
   assert (d->c.ops == sertype_common->serdata_ops);
   assert (DDSI_RTPS_CDR_ENC_IS_NATIVE (d->hdr.identifier));
-  if (bufptr) abort(); else { (void)buflim; } /* FIXME: haven't implemented that bit yet! */
   istream_from_serdata_default(&is, d);
+  if (bufptr)
+    to_sample_buffer_init (&tsb, &is, sample, tp, bufptr, buflim);
   dds_stream_read_key (&is, sample, &tp->type);
+  if (bufptr)
+    return to_sample_buffer_fini (&tsb, bufptr);
   return true; /* FIXME: can't conversion to sample fail? */
 }
 
 static bool serdata_default_untyped_to_sample_cdr_nokey (const struct ddsi_sertype *sertype_common, const struct ddsi_serdata *serdata_common, void *sample, void **bufptr, void *buflim)
 {
-  (void)sertype_common; (void)sample; (void)bufptr; (void)buflim; (void)serdata_common;
+  (void)buflim; (void)serdata_common;
   assert (serdata_common->type == NULL);
   assert (serdata_common->kind == SDK_KEY);
+  if (bufptr)
+    memset (sample, 0, ((const struct dds_sertype_default *) sertype_common)->type.size);
   return true;
 }
 
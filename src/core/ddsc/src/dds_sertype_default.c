@@ -116,6 +116,7 @@ static void sertype_default_free (struct ddsi_sertype *tpcmn)
   struct dds_sertype_default *tp = (struct dds_sertype_default *) tpcmn;
   ddsrt_free (tp->type.keys.keys);
   ddsrt_free (tp->type.ops.ops);
+  dds_stream_free_copy_plan (tp->type.copy_plan);
   if (tp->typeinfo_ser.data != NULL)
     ddsrt_free (tp->typeinfo_ser.data);
   if (tp->typemap_ser.data != NULL)
@@ -323,6 +324,10 @@ dds_return_t dds_sertype_default_init (const struct dds_domain *domain, struct d
   }
   st->type.ops.nops = dds_stream_countops (desc->m_ops, desc->m_nkeys, desc->m_keys);
   st->type.ops.ops = ddsrt_memdup (desc->m_ops, st->type.ops.nops * sizeof (*st->type.ops.ops));
+  st->type.serializers = (desc->m_flagset & DDS_TOPIC_SERIALIZERS) ? desc->serializers : NULL;
+  if (st->type.serializers)
+    GVTRACE ("Using generated serializers for type: %s\n", desc->m_typename);
+  st->type.copy_plan = NULL;
 
   if (min_xcdrv == DDSI_RTPS_CDR_ENC_VERSION_2 && dds_stream_type_nesting_depth (desc->m_ops) > DDS_CDRSTREAM_MAX_NESTING_DEPTH)
   {
@@ -361,5 +366,12 @@ dds_return_t dds_sertype_default_init (const struct dds_domain *domain, struct d
   if (st->type.opt_size_xcdr2 > 0)
     GVTRACE ("Marshalling XCDR2 for type: %s is %soptimised\n", st->c.type_name, st->type.opt_size_xcdr2 ? "" : "not ");
 
+  if (st->type.opt_size_xcdr1 == 0 || st->type.opt_size_xcdr2 == 0)
+  {
+    st->type.copy_plan = dds_stream_compile_copy_plan (&st->type);
+    if (st->type.copy_plan)
+      GVTRACE ("Marshalling for type: %s uses a copy plan with %"PRIu32" steps\n", st->c.type_name, st->type.copy_plan->nsteps);
+  }
+
   return DDS_RETCODE_OK;
 }
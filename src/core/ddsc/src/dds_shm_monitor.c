@@ -171,7 +171,8 @@ static void receive_data_wakeup_handler(struct dds_reader* rd)
     else
       xqos = ((struct ddsi_writer *) e)->xqos;
     ddsi_make_writer_info(&wrinfo, e, xqos, d->statusinfo);
-    (void)ddsi_rhc_store(rd->m_rd->rhc, &wrinfo, d, tk);
+    if (ddsi_reader_accepts_instance(rd->m_rd, tk, d))
+      (void)ddsi_rhc_store(rd->m_rd->rhc, &wrinfo, d, tk);
 
 release:
     if (tk)
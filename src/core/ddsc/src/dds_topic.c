@@ -36,9 +36,13 @@
 #include "dds/ddsi/ddsi_domaingv.h"
 #include "dds/ddsi/ddsi_security_omg.h"
 #include "dds/ddsi/ddsi_typebuilder.h"
+#include "dds/ddsi/ddsi_gc.h"
+#include "dds/ddsi/ddsi_content_filter_if.h"
 #include "dds/cdr/dds_cdrstream.h"
 #include "dds__serdata_builtintopic.h"
 #include "dds__serdata_default.h"
+#include "dds__filter_expr.h"
+#include "dds__reader.h"
 
 DECL_ENTITY_LOCK_UNLOCK (dds_topic)
 
@@ -232,6 +236,9 @@ static void dds_topic_close (dds_entity *e)
   ddsi_type_unref_sertype (&e->m_domain->gv, tp->m_stype);
 #endif
   dds_free (tp->m_name);
+  struct dds_filter_expr *expr = ddsrt_atomic_ldvoidp (&tp->m_filter_expr);
+  if (expr)
+    dds_filter_expr_free (expr);
 
   ddsrt_mutex_lock (&pp->m_entity.m_mutex);
 
@@ -958,6 +965,142 @@ dds_return_t dds_set_topic_filter_extended (dds_entity_t topic, const struct dds
   return DDS_RETCODE_OK;
 }
 
+static void free_filter_expr_gc (struct ddsi_gcreq *gcreq)
+{
+  dds_filter_expr_free (ddsi_gcreq_get_arg (gcreq));
+  ddsi_gcreq_free (gcreq);
+}
+
+static void republish_readers_of_topic (dds_topic *tp)
+{
+  /* tp pinned but not locked; the discovery data of the readers includes the filter expression,
+     readers are created with the subscriber locked, so any reader found has its DDSI reader */
+  struct dds_participant * const pp = dds_entity_participant (&tp->m_entity);
+  dds_instance_handle_t last_sub_iid = 0;
+  dds_entity *sub;
+  ddsrt_mutex_lock (&pp->m_entity.m_mutex);
+  while ((sub = ddsrt_avl_lookup_succ (&dds_entity_children_td, &pp->m_entity.m_children, &last_sub_iid)) != NULL)
+  {
+    dds_entity *x;
+    last_sub_iid = sub->m_iid;
+    if (dds_entity_kind (sub) != DDS_KIND_SUBSCRIBER || dds_entity_pin (sub->m_hdllink.hdl, &x) < 0)
+      continue;
+    ddsrt_mutex_unlock (&pp->m_entity.m_mutex);
+
+    dds_instance_handle_t last_rd_iid = 0;
+    dds_entity *rd;
+    ddsrt_mutex_lock (&sub->m_mutex);
+    while ((rd = ddsrt_avl_lookup_succ (&dds_entity_children_td, &sub->m_children, &last_rd_iid)) != NULL)
+    {
+      dds_entity *y;
+      last_rd_iid = rd->m_iid;
+      if (((dds_reader *) rd)->m_topic != tp || dds_entity_pin (rd->m_hdllink.hdl, &y) < 0)
+        continue;
+      ddsrt_mutex_unlock (&sub->m_mutex);
+      ddsi_thread_state_awake (ddsi_lookup_thread_state (), &rd->m_domain->gv);
+      ddsi_update_reader_content_filter (((dds_reader *) rd)->m_rd);
+      ddsi_thread_state_asleep (ddsi_lookup_thread_state ());
+      dds_entity_unpin (y);
+      ddsrt_mutex_lock (&sub->m_mutex);
+    }
+    ddsrt_mutex_unlock (&sub->m_mutex);
+
+    dds_entity_unpin (x);
+    ddsrt_mutex_lock (&pp->m_entity.m_mutex);
+  }
+  ddsrt_mutex_unlock (&pp->m_entity.m_mutex);
+}
+
+dds_return_t dds_set_topic_filter_expression (dds_entity_t topic, const char *expression, uint32_t nparams, const char * const *params)
+{
+  struct dds_filter_expr *expr = NULL, *old;
+  dds_topic *t;
+  dds_return_t rc;
+
+  if ((rc = dds_topic_lock (topic, &t)) != DDS_RETCODE_OK)
+    return rc;
+  if (expression != NULL && (rc = dds_filter_expr_compile (&expr, t->m_stype, expression, nparams, params)) != DDS_RETCODE_OK)
+  {
+    dds_topic_unlock (t);
+    return rc;
+  }
+  // readers evaluate the expression without holding the topic lock, so the old one
+  // can only be freed once no thread can still be using it
+  old = ddsrt_atomic_ldvoidp (&t->m_filter_expr);
+  ddsrt_atomic_stvoidp (&t->m_filter_expr, expr);
+  if (old)
+  {
+    struct ddsi_gcreq *gcreq = ddsi_gcreq_new (t->m_entity.m_domain->gv.gcreq_queue, free_filter_expr_gc);
+    ddsi_gcreq_set_arg (gcreq, old);
+    ddsi_gcreq_enqueue (gcreq);
+  }
+  dds_topic_unlock (t);
+
+  // remote writers may filter on behalf of the readers, so they need to know
+  if (old != NULL || expr != NULL)
+  {
+    dds_topic *tp;
+    if (dds_topic_pin (topic, &tp) == DDS_RETCODE_OK)
+    {
+      republish_readers_of_topic (tp);
+      dds_topic_unpin (tp);
+    }
+  }
+  return DDS_RETCODE_OK;
+}
+
+static bool content_filter_reader_property (const struct ddsi_reader *rd, ddsi_content_filter_property_t *cfp, void *arg)
+{
+  (void) arg;
+  if (rd->status_cb != dds_reader_status_cb)
+    return false;
+  const dds_reader *reader = rd->status_cb_entity;
+  const struct dds_filter_expr *expr = ddsrt_atomic_ldvoidp (&reader->m_topic->m_filter_expr);
+  if (expr == NULL)
+    return false;
+  const char * const *params;
+  cfp->content_filtered_topic_name = reader->m_topic->m_name;
+  cfp->related_topic_name = reader->m_topic->m_name;
+  cfp->filter_class_name = (char *) DDSI_CONTENT_FILTER_CLASS_SQL;
+  cfp->filter_expression = (char *) dds_filter_expr_expression (expr);
+  cfp->expression_parameters.n = dds_filter_expr_parameters (expr, &params);
+  cfp->expression_parameters.strs = ddsrt_malloc ((cfp->expression_parameters.n > 0 ? cfp->expression_parameters.n : 1) * sizeof (*cfp->expression_parameters.strs));
+  for (uint32_t i = 0; i < cfp->expression_parameters.n; i++)
+    cfp->expression_parameters.strs[i] = (char *) params[i];
+  return true;
+}
+
+static void *content_filter_compile (const struct ddsi_sertype *type, const ddsi_content_filter_property_t *cfp, void *arg)
+{
+  struct dds_filter_expr *expr;
+  (void) arg;
+  if (dds_filter_expr_compile (&expr, type, cfp->filter_expression, cfp->expression_parameters.n, (const char * const *) cfp->expression_parameters.strs) != DDS_RETCODE_OK)
+    return NULL;
+  return expr;
+}
+
+static bool content_filter_eval (const void *filter, const struct ddsi_serdata *serdata, void *arg)
+{
+  (void) arg;
+  return dds_filter_expr_eval_serdata (filter, serdata);
+}
+
+static void content_filter_free (void *filter, void *arg)
+{
+  (void) arg;
+  dds_filter_expr_free (filter);
+}
+
+void dds_topic_content_filter_init (struct dds_domain *dom)
+{
+  dom->cfif.arg = dom;
+  dom->cfif.content_filter_reader_property = content_filter_reader_property;
+  dom->cfif.content_filter_compile = content_filter_compile;
+  dom->cfif.content_filter_eval = content_filter_eval;
+  dom->cfif.content_filter_free = content_filter_free;
+  dom->gv.content_filter_interface = &dom->cfif;
+}
+
 dds_return_t dds_set_topic_filter_and_arg (dds_entity_t topic, dds_topic_filter_arg_fn filter, void *arg)
 {
   struct dds_topic_filter f = {
@@ -0,0 +1,198 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include <assert.h>
+#include <string.h>
+#include "dds/ddsrt/heap.h"
+#include "dds/ddsi/ddsi_serdata.h"
+#include "dds/ddsi/ddsi_sertype.h"
+#include "dds/ddsi/ddsi_protocol.h"
+#include "dds/cdr/dds_cdrstream.h"
+#include "dds/ddsc/dds_view.h"
+#include "dds__serdata_default.h"
+
+/* Per-type part of a view, computed once and shared by all views on the type */
+struct dds_view_layout {
+  const uint32_t *ops;
+  uint32_t nops;
+  bool delimited; /* top-level type is appendable, fixed offsets for XCDR2 follow the DHEADER */
+  bool fixed[2]; /* all members at fixed offsets for XCDR1, XCDR2 */
+  uint32_t *fixed_offset; /* [2 * nmembers], DDS_CDRSTREAM_MEMBER_ABSENT if it depends on the data */
+  struct dds_cdrstream_member_ref *refs;
+};
+
+static void layout_free (struct dds_view_layout *layout)
+{
+  ddsrt_free (layout->fixed_offset);
+  ddsrt_free (layout->refs);
+  ddsrt_free (layout);
+}
+
+static struct dds_view_layout *layout_new (const dds_view_desc_t *desc)
+{
+  struct dds_view_layout *layout = ddsrt_malloc (sizeof (*layout));
+  const uint32_t n = desc->nmembers;
+  layout->ops = desc->topic_desc->m_ops;
+  layout->nops = dds_stream_countops (layout->ops, desc->topic_desc->m_nkeys, desc->topic_desc->m_keys);
+  layout->delimited = (DDS_OP (layout->ops[0]) == DDS_OP_DLC);
+  layout->fixed[0] = layout->fixed[1] = true;
+  layout->fixed_offset = ddsrt_malloc ((n > 0 ? 2 * n : 1) * sizeof (*layout->fixed_offset));
+  layout->refs = ddsrt_malloc ((n > 0 ? n : 1) * sizeof (*layout->refs));
+  for (uint32_t i = 0; i < n; i++)
+  {
+    const dds_view_member_t *m = &desc->members[i];
+    if (!dds_stream_member_ref_init (&layout->refs[i], layout->ops, m->depth, m->index, m->member_id))
+    {
+      layout_free (layout);
+      return NULL;
+    }
+    for (int xv = 0; xv < 2; xv++)
+    {
+      const uint32_t xcdr_version = (xv == 0) ? DDSI_RTPS_CDR_ENC_VERSION_1 : DDSI_RTPS_CDR_ENC_VERSION_2;
+      uint32_t * const off = &layout->fixed_offset[2 * i + (uint32_t) xv];
+      if (layout->delimited && xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && dds_stream_member_fixed_offset (layout->ops + 1, &layout->refs[i], xcdr_version, off))
+        *off += 4;
+      else if (layout->delimited || !dds_stream_member_fixed_offset (layout->ops, &layout->refs[i], xcdr_version, off))
+      {
+        *off = DDS_CDRSTREAM_MEMBER_ABSENT;
+        layout->fixed[xv] = false;
+      }
+    }
+  }
+  return layout;
+}
+
+static const struct dds_view_layout *get_layout (dds_view_desc_t *desc)
+{
+  struct dds_view_layout *layout;
+  if ((layout = ddsrt_atomic_ldvoidp (&desc->layout)) != NULL)
+    return layout;
+  if ((layout = layout_new (desc)) == NULL)
+    return NULL;
+  /* another thread may have beaten us to it; the layout lives as long as the
+     (generated, static) view descriptor */
+  if (!ddsrt_atomic_casvoidp (&desc->layout, NULL, layout))
+  {
+    layout_free (layout);
+    layout = ddsrt_atomic_ldvoidp (&desc->layout);
+  }
+  return layout;
+}
+
+static bool is_type_of_view (const struct dds_view_layout *layout, const dds_view_desc_t *desc, const struct ddsi_sertype *type)
+{
+  /* Different versions of a type share the name, but the accessors interpret the data
+     using the ops of the view's type, so those must be the ops of the serdata's type */
+  if (type->ops != &dds_sertype_ops_default || strcmp (type->type_name, desc->topic_desc->m_typename) != 0)
+    return false;
+  const struct dds_sertype_default *tp = (const struct dds_sertype_default *) type;
+  return tp->type.ops.nops == layout->nops && memcmp (tp->type.ops.ops, layout->ops, layout->nops * sizeof (*layout->ops)) == 0;
+}
+
+dds_return_t dds_view_init (dds_view_t *view, dds_view_desc_t *desc, uint32_t *offs, struct ddsi_serdata *serdata)
+{
+  if (view == NULL || desc == NULL || (offs == NULL && desc->nmembers > 0) || serdata == NULL)
+    return DDS_RETCODE_BAD_PARAMETER;
+  if (serdata->kind != SDK_DATA)
+    return DDS_RETCODE_BAD_PARAMETER;
+  const struct dds_view_layout *layout;
+  if ((layout = get_layout (desc)) == NULL)
+    return DDS_RETCODE_UNSUPPORTED;
+  if (!is_type_of_view (layout, desc, serdata->type))
+    return DDS_RETCODE_BAD_PARAMETER;
+
+  const uint32_t size = ddsi_serdata_size (serdata);
+  if (size < sizeof (struct dds_cdr_header))
+    return DDS_RETCODE_BAD_PARAMETER;
+  ddsrt_iovec_t ref;
+  struct ddsi_serdata * const sd = ddsi_serdata_to_ser_ref (serdata, 0, size, &ref);
+  struct dds_cdr_header hdr;
+  memcpy (&hdr, ref.iov_base, sizeof (hdr));
+  if (!DDSI_RTPS_CDR_ENC_IS_NATIVE (hdr.identifier))
+  {
+    ddsi_serdata_to_ser_unref (sd, &ref);
+    return DDS_RETCODE_UNSUPPORTED;
+  }
+
+  view->desc = desc;
+  view->layout = layout;
+  view->serdata = sd;
+  view->ref = ref;
+  view->data = (const unsigned char *) ref.iov_base + sizeof (hdr);
+  view->size = size - (uint32_t) sizeof (hdr);
+  view->xcdr_version = ddsi_sertype_enc_id_xcdr_version (hdr.identifier);
+  view->offs = offs;
+
+  const uint32_t xv = (view->xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_1) ? 0 : 1;
+  for (uint32_t i = 0; i < desc->nmembers; i++)
+    offs[i] = layout->fixed_offset[2 * i + xv];
+  if (layout->delimited && view->xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)
+  {
+    /* an older version of the type may have fewer members, anything beyond
+       the DHEADER is absent */
+    uint32_t dheader;
+    if (view->size < 4)
+      view->size = 0;
+    else
+    {
+      memcpy (&dheader, view->data, sizeof (dheader));
+      view->size = (dheader <= view->size - 4) ? dheader + 4 : 0;
+    }
+  }
+  view->resolved = layout->fixed[xv];
+  return DDS_RETCODE_OK;
+}
+
+void dds_view_fini (dds_view_t *view)
+{
+  ddsi_serdata_to_ser_unref (view->serdata, &view->ref);
+  view->serdata = NULL;
+  view->data = NULL;
+}
+
+static uint32_t member_offset (dds_view_t *view, uint32_t member)
+{
+  assert (member < view->desc->nmembers);
+  if (view->offs[member] == DDS_CDRSTREAM_MEMBER_ABSENT && !view->resolved)
+  {
+    /* the first access to a member that depends on the contents of the sample
+       locates all members in a single pass over the data */
+    dds_istream_t is = { .m_buffer = view->data, .m_size = view->size, .m_index = 0, .m_xcdr_version = view->xcdr_version };
+    if (!dds_stream_locate_members (&is, false, view->layout->ops, view->desc->nmembers, view->layout->refs, view->offs))
+    {
+      for (uint32_t i = 0; i < view->desc->nmembers; i++)
+        view->offs[i] = DDS_CDRSTREAM_MEMBER_ABSENT;
+    }
+    view->resolved = true;
+  }
+  return view->offs[member];
+}
+
+const void *dds_view_member (dds_view_t *view, uint32_t member, uint32_t size)
+{
+  const uint32_t off = member_offset (view, member);
+  if (off == DDS_CDRSTREAM_MEMBER_ABSENT || off > view->size || size > view->size - off)
+    return NULL;
+  return view->data + off;
+}
+
+const char *dds_view_string (dds_view_t *view, uint32_t member)
+{
+  const uint32_t off = member_offset (view, member);
+  uint32_t len;
+  if (off == DDS_CDRSTREAM_MEMBER_ABSENT || off > view->size || 4 > view->size - off)
+    return NULL;
+  memcpy (&len, view->data + off, sizeof (len));
+  /* the length includes the terminating 0 */
+  if (len == 0 || len > view->size - off - 4 || view->data[off + 4 + len - 1] != 0)
+    return NULL;
+  return (const char *) view->data + off + 4;
+}
@@ -30,9 +30,13 @@
 #include "dds/ddsi/ddsi_unused.h"
 #include "dds/ddsi/ddsi_tkmap.h"
 #include "dds/ddsi/ddsi_freelist.h"
+#include "dds/ddsi/ddsi_gc.h"
+#include "dds/ddsi/ddsi_xevent.h"
 #include "dds/ddsi/ddsi_domaingv.h"
 #include "dds/ddsi/ddsi_entity.h"
+#include "dds/ddsi/ddsi_endpoint.h"
 #include "dds__whc.h"
+#include "dds__whc_spill.h"
 #include "dds__entity.h"
 #include "dds__writer.h"
 
@@ -54,7 +58,9 @@ struct dds_whc_default_node {
 #ifdef DDS_HAS_LIFESPAN
   struct ddsi_lifespan_fhnode lifespan; /* fibheap node for lifespan */
 #endif
-  struct ddsi_serdata *serdata;
+  struct ddsi_serdata *serdata; /* NULL iff spilled */
+  struct ddsi_serdata *wire_serdata; /* NULL if serdata goes out on the wire as is */
+  struct dds_whc_spill_rec *spilled; /* location in spill file if spilled */
 };
 DDSRT_STATIC_ASSERT (offsetof (struct dds_whc_default_node, common) == 0);
 
@@ -84,15 +90,6 @@ struct whc_seq_entry {
 };
 #endif
 
-struct whc_writer_info {
-  dds_writer * writer; /* can be NULL, eg in case of whc for built-in writers */
-  unsigned is_transient_local: 1;
-  unsigned has_deadline: 1;
-  uint32_t hdepth; /* 0 = unlimited */
-  uint32_t tldepth; /* 0 = disabled/unlimited (no need to maintain an index if KEEP_ALL <=> is_transient_local + tldepth=0) */
-  uint32_t idxdepth; /* = max (hdepth, tldepth) */
-};
-
 struct whc_impl {
   struct ddsi_whc common;
   ddsrt_mutex_t lock;
@@ -121,6 +118,21 @@ struct whc_impl {
 #ifdef DDS_HAS_DEADLINE_MISSED
   struct ddsi_deadline_adm deadline; /* Deadline missed administration */
 #endif
+  struct dds_whc_spill *spill; /* NULL if history is never spilled to disk */
+  size_t resident_bytes; /* size of samples not spilled, only maintained if spill != NULL */
+  ddsi_seqno_t spill_seq; /* acked samples below spill_seq have been considered for spilling */
+  ddsrt_atomic_uint64_t *domain_resident_bytes;
+  struct ddsi_xevent *spill_evt; /* for spilling and compacting, created when first needed */
+  struct dds_whc_default_node *deleted; /* removed while holding lock, freed after releasing it */
+
+  /* Removed nodes are freed by the GC thread, in batches, rather than by the thread that
+     removed them (typically a receive thread processing an ACK).  The batch is a list of
+     lists, chained through the prev_seq of their first node.  As the GC request refers to
+     the WHC, freeing the WHC is deferred to the GC request if one is outstanding. */
+  ddsrt_mutex_t reclaim_lock;
+  struct dds_whc_default_node *reclaim;
+  bool reclaim_queued;
+  bool freed;
 };
 
 struct ddsi_whc_sample_iter_impl {
@@ -148,13 +160,14 @@ static void insert_whcn_in_hash (struct whc_impl *whc, struct dds_whc_default_no
 static void whc_delete_one (struct whc_impl *whc, struct dds_whc_default_node *whcn);
 static int compare_seq (const void *va, const void *vb);
 static void free_deferred_free_list (struct dds_whc_default_node *deferred_free_list);
+static void whc_reclaim (struct whc_impl *whc, struct dds_whc_default_node *list);
 static void get_state_locked (const struct whc_impl *whc, struct ddsi_whc_state *st);
 
 static uint32_t whc_default_remove_acked_messages_full (struct whc_impl *whc, ddsi_seqno_t max_drop_seq, struct ddsi_whc_node **deferred_free_list);
 static uint32_t whc_default_remove_acked_messages (struct ddsi_whc *whc, ddsi_seqno_t max_drop_seq, struct ddsi_whc_state *whcst, struct ddsi_whc_node **deferred_free_list);
 static void whc_default_free_deferred_free_list (struct ddsi_whc *whc, struct ddsi_whc_node *deferred_free_list);
 static void whc_default_get_state (const struct ddsi_whc *whc, struct ddsi_whc_state *st);
-static int whc_default_insert (struct ddsi_whc *whc, ddsi_seqno_t max_drop_seq, ddsi_seqno_t seq, ddsrt_mtime_t exp, struct ddsi_serdata *serdata, struct ddsi_tkmap_instance *tk);
+static int whc_default_insert (struct ddsi_whc *whc, ddsi_seqno_t max_drop_seq, ddsi_seqno_t seq, ddsrt_mtime_t exp, struct ddsi_serdata *serdata, struct ddsi_serdata *wire_serdata, struct ddsi_tkmap_instance *tk);
 static ddsi_seqno_t whc_default_next_seq (const struct ddsi_whc *whc, ddsi_seqno_t seq);
 static bool whc_default_borrow_sample (const struct ddsi_whc *whc, ddsi_seqno_t seq, struct ddsi_whc_borrowed_sample *sample);
 static bool whc_default_borrow_sample_key (const struct ddsi_whc *whc, const struct ddsi_serdata *serdata_key, struct ddsi_whc_borrowed_sample *sample);
@@ -190,6 +203,9 @@ static const struct ddsi_whc_ops whc_ops = {
  8k entries seems to be roughly the amount needed for minimum samples,
  maximum message size and a short round-trip time */
 #define MAX_FREELIST_SIZE 8192
+
+/* Maximum number of bytes spilled to disk in one go */
+#define WHC_SPILL_BATCH 1048576
 static uint32_t whc_count;
 static struct ddsi_freelist whc_node_freelist;
 
@@ -377,11 +393,15 @@ static ddsrt_mtime_t whc_sample_expired_cb(void *hc, ddsrt_mtime_t tnow)
   struct whc_impl *whc = hc;
   void *sample;
   ddsrt_mtime_t tnext;
+  struct dds_whc_default_node *deleted;
   ddsrt_mutex_lock (&whc->lock);
   while ((tnext = ddsi_lifespan_next_expired_locked (&whc->lifespan, tnow, &sample)).v == 0)
     whc_delete_one (whc, sample);
   whc->maxseq_node = whc_findmax_procedurally (whc);
+  deleted = whc->deleted;
+  whc->deleted = NULL;
   ddsrt_mutex_unlock (&whc->lock);
+  whc_reclaim (whc, deleted);
   return tnext;
 }
 #endif
@@ -422,8 +442,14 @@ struct whc_writer_info *dds_whc_make_wrinfo (struct dds_writer *wr, const dds_qo
   assert (qos->present & DDSI_QP_DURABILITY);
   assert (qos->present & DDSI_QP_DURABILITY_SERVICE);
   wrinfo->writer = wr;
-  wrinfo->is_transient_local = (qos->durability.kind == DDS_DURABILITY_TRANSIENT_LOCAL);
+  if (wr != NULL)
+    wrinfo->is_transient_local = ddsi_durability_served_by_writer (&wr->m_entity.m_domain->gv, qos->durability.kind);
+  else
+    wrinfo->is_transient_local = (qos->durability.kind == DDS_DURABILITY_TRANSIENT_LOCAL);
+  wrinfo->is_persistent = (qos->durability.kind == DDS_DURABILITY_PERSISTENT);
   wrinfo->has_deadline = (qos->deadline.deadline != DDS_INFINITY);
+  wrinfo->has_lifespan = (qos->present & DDSI_QP_LIFESPAN) && qos->lifespan.duration != DDS_INFINITY;
+  wrinfo->is_keyless = (wr != NULL && wr->m_topic->m_stype->typekind_no_key);
   wrinfo->hdepth = (qos->history.kind == DDS_HISTORY_KEEP_ALL) ? 0 : (unsigned) qos->history.depth;
   if (!wrinfo->is_transient_local)
     wrinfo->tldepth = 0;
@@ -446,6 +472,11 @@ struct ddsi_whc *dds_whc_new (struct ddsi_domaingv *gv, const struct whc_writer_
 
   assert ((wrinfo->hdepth == 0 || wrinfo->tldepth <= wrinfo->hdepth) || wrinfo->is_transient_local);
 
+  if (dds_whc_ring_applicable (wrinfo))
+    return dds_whc_ring_new (gv, wrinfo);
+  if (wrinfo->is_persistent && wrinfo->is_transient_local && wrinfo->writer)
+    return dds_whc_persistent_new (gv, wrinfo);
+
   whc = ddsrt_malloc (sizeof (*whc));
   whc->common.ops = &whc_ops;
   ddsrt_mutex_init (&whc->lock);
@@ -484,6 +515,24 @@ struct ddsi_whc *dds_whc_new (struct ddsi_domaingv *gv, const struct whc_writer_
   whc->open_intv = intv;
   whc->maxseq_node = NULL;
 
+  /* Spilling is for limiting the memory used by the history retained for late-joining
+     readers, so only for transient-local application writers */
+  whc->spill = NULL;
+  whc->resident_bytes = 0;
+  whc->spill_seq = 1;
+  whc->domain_resident_bytes = NULL;
+  whc->spill_evt = NULL;
+  whc->deleted = NULL;
+  ddsrt_mutex_init (&whc->reclaim_lock);
+  whc->reclaim = NULL;
+  whc->reclaim_queued = false;
+  whc->freed = false;
+  if (wrinfo->writer && wrinfo->is_transient_local && (gv->config.whc_spill_writer_limit > 0 || gv->config.whc_spill_domain_limit > 0))
+  {
+    if ((whc->spill = dds_whc_spill_new (gv)) != NULL)
+      whc->domain_resident_bytes = &wrinfo->writer->m_entity.m_domain->whc_resident_bytes;
+  }
+
   ddsrt_mutex_lock (ddsrt_get_singleton_mutex ());
   if (whc_count++ == 0)
     ddsi_freelist_init (&whc_node_freelist, MAX_FREELIST_SIZE, offsetof (struct dds_whc_default_node, next_seq));
@@ -495,7 +544,83 @@ struct ddsi_whc *dds_whc_new (struct ddsi_domaingv *gv, const struct whc_writer_
 
 static void free_whc_node_contents (struct dds_whc_default_node *whcn)
 {
-  ddsi_serdata_unref (whcn->serdata);
+  /* spill records are released when the node is removed from the WHC */
+  assert (whcn->spilled == NULL);
+  if (whcn->serdata)
+    ddsi_serdata_unref (whcn->serdata);
+  if (whcn->wire_serdata)
+    ddsi_serdata_unref (whcn->wire_serdata);
+}
+
+static void whc_resident_add (struct whc_impl *whc, size_t sz)
+{
+  whc->resident_bytes += sz;
+  ddsrt_atomic_add64 (whc->domain_resident_bytes, sz);
+}
+
+static void whc_resident_sub (struct whc_impl *whc, size_t sz)
+{
+  assert (whc->resident_bytes >= sz);
+  whc->resident_bytes -= sz;
+  ddsrt_atomic_sub64 (whc->domain_resident_bytes, sz);
+}
+
+static void whc_release (struct whc_impl *whc)
+{
+  ddsrt_mutex_destroy (&whc->reclaim_lock);
+  ddsrt_free (whc);
+
+  ddsrt_mutex_lock (ddsrt_get_singleton_mutex ());
+  if (--whc_count == 0)
+    ddsi_freelist_fini (&whc_node_freelist, ddsrt_free);
+  ddsrt_mutex_unlock (ddsrt_get_singleton_mutex ());
+}
+
+static void whc_reclaim_gc (struct ddsi_gcreq *gcreq)
+{
+  struct whc_impl * const whc = ddsi_gcreq_get_arg (gcreq);
+  bool freed;
+  ddsrt_mutex_lock (&whc->reclaim_lock);
+  while (whc->reclaim)
+  {
+    struct dds_whc_default_node *list = whc->reclaim;
+    whc->reclaim = NULL;
+    ddsrt_mutex_unlock (&whc->reclaim_lock);
+    while (list)
+    {
+      struct dds_whc_default_node *next = list->prev_seq;
+      free_deferred_free_list (list);
+      list = next;
+    }
+    ddsrt_mutex_lock (&whc->reclaim_lock);
+  }
+  whc->reclaim_queued = false;
+  freed = whc->freed;
+  ddsrt_mutex_unlock (&whc->reclaim_lock);
+  if (freed)
+    whc_release (whc);
+  ddsi_gcreq_free (gcreq);
+}
+
+static void whc_reclaim (struct whc_impl *whc, struct dds_whc_default_node *list)
+{
+  /* Hands a list of removed nodes to the GC thread; everything handed over while a
+     request is outstanding is freed by that same request */
+  bool enqueue;
+  if (list == NULL)
+    return;
+  ddsrt_mutex_lock (&whc->reclaim_lock);
+  list->prev_seq = whc->reclaim;
+  whc->reclaim = list;
+  enqueue = !whc->reclaim_queued;
+  whc->reclaim_queued = true;
+  ddsrt_mutex_unlock (&whc->reclaim_lock);
+  if (enqueue)
+  {
+    struct ddsi_gcreq *gcreq = ddsi_gcreq_new (whc->gv->gcreq_queue, whc_reclaim_gc);
+    ddsi_gcreq_set_arg (gcreq, whc);
+    ddsi_gcreq_enqueue (gcreq);
+  }
 }
 
 void whc_default_free (struct ddsi_whc *whc_generic)
@@ -504,6 +629,9 @@ void whc_default_free (struct ddsi_whc *whc_generic)
   struct whc_impl * const whc = (struct whc_impl *)whc_generic;
   check_whc (whc);
 
+  if (whc->spill_evt)
+    ddsi_delete_xevent_callback (whc->spill_evt);
+
 #ifdef DDS_HAS_LIFESPAN
   whc_sample_expired_cb (whc, DDSRT_MTIME_NEVER);
   ddsi_lifespan_fini (&whc->lifespan);
@@ -535,17 +663,23 @@ void whc_default_free (struct ddsi_whc *whc_generic)
       DDSRT_WARNING_MSVC_OFF (6001);
       whcn = whcn->prev_seq;
       DDSRT_WARNING_MSVC_ON (6001);
+      if (tmp->spilled)
+      {
+        ddsrt_free (tmp->spilled);
+        tmp->spilled = NULL;
+      }
       free_whc_node_contents (tmp);
       ddsrt_free (tmp);
     }
   }
 
-  ddsrt_avl_free (&whc_seq_treedef, &whc->seq, ddsrt_free);
+  if (whc->spill)
+  {
+    ddsrt_atomic_sub64 (whc->domain_resident_bytes, whc->resident_bytes);
+    dds_whc_spill_free (whc->spill);
+  }
 
-  ddsrt_mutex_lock (ddsrt_get_singleton_mutex ());
-  if (--whc_count == 0)
-    ddsi_freelist_fini (&whc_node_freelist, ddsrt_free);
-  ddsrt_mutex_unlock (ddsrt_get_singleton_mutex ());
+  ddsrt_avl_free (&whc_seq_treedef, &whc->seq, ddsrt_free);
 
 #if USE_EHH
   ddsrt_ehh_free (whc->seq_hash);
@@ -553,7 +687,22 @@ void whc_default_free (struct ddsi_whc *whc_generic)
   ddsrt_hh_free (whc->seq_hash);
 #endif
   ddsrt_mutex_destroy (&whc->lock);
-  ddsrt_free (whc);
+
+  /* Nodes awaiting the GC are freed here, but if there is an outstanding GC request it
+     still needs the WHC */
+  bool queued;
+  ddsrt_mutex_lock (&whc->reclaim_lock);
+  while (whc->reclaim)
+  {
+    struct dds_whc_default_node *list = whc->reclaim;
+    whc->reclaim = list->prev_seq;
+    free_deferred_free_list (list);
+  }
+  if ((queued = whc->reclaim_queued))
+    whc->freed = true;
+  ddsrt_mutex_unlock (&whc->reclaim_lock);
+  if (!queued)
+    whc_release (whc);
 }
 
 static void get_state_locked (const struct whc_impl *whc, struct ddsi_whc_state *st)
@@ -726,6 +875,15 @@ static void whc_delete_one_intv (struct whc_impl *whc, struct whc_intvnode **p_i
     whc->unacked_bytes -= whcn->size;
     whcn->unacked = 0;
   }
+  if (whcn->spilled)
+  {
+    dds_whc_spill_drop (whc->spill, whcn->spilled);
+    whcn->spilled = NULL;
+  }
+  else if (whc->spill)
+  {
+    whc_resident_sub (whc, whcn->size);
+  }
 
 #ifdef DDS_HAS_LIFESPAN
   ddsi_lifespan_unregister_sample_locked (&whc->lifespan, &whcn->lifespan);
@@ -815,8 +973,8 @@ static void whc_delete_one (struct whc_impl *whc, struct dds_whc_default_node *w
     whcn_tmp->prev_seq->next_seq = whcn_tmp->next_seq;
   if (whcn_tmp->next_seq)
     whcn_tmp->next_seq->prev_seq = whcn_tmp->prev_seq;
-  whcn_tmp->next_seq = NULL;
-  free_deferred_free_list (whcn_tmp);
+  whcn_tmp->next_seq = whc->deleted;
+  whc->deleted = whcn_tmp;
   whc->seq_size--;
 }
 
@@ -844,8 +1002,8 @@ static void free_deferred_free_list (struct dds_whc_default_node *deferred_free_
 
 static void whc_default_free_deferred_free_list (struct ddsi_whc *whc_generic, struct ddsi_whc_node *deferred_free_list)
 {
-  (void) whc_generic;
-  free_deferred_free_list ((struct dds_whc_default_node *) deferred_free_list);
+  struct whc_impl * const whc = (struct whc_impl *) whc_generic;
+  whc_reclaim (whc, (struct dds_whc_default_node *) deferred_free_list);
 }
 
 static uint32_t whc_default_remove_acked_messages_noidx (struct whc_impl *whc, ddsi_seqno_t max_drop_seq, struct ddsi_whc_node **deferred_free_list)
@@ -863,6 +1021,9 @@ static uint32_t whc_default_remove_acked_messages_noidx (struct whc_impl *whc, d
     return 0;
   }
 
+  /* Spilling is only for transient-local writers */
+  assert (whc->spill == NULL);
+
   /* If simple, we have always dropped everything up to whc->max_drop_seq,
    and there can only be a single interval */
 #ifndef NDEBUG
@@ -1067,6 +1228,78 @@ static uint32_t whc_default_remove_acked_messages_full (struct whc_impl *whc, dd
   return ndropped;
 }
 
+static bool whc_over_budget (const struct whc_impl *whc)
+{
+  const struct ddsi_config * const config = &whc->gv->config;
+  if (config->whc_spill_writer_limit > 0 && whc->resident_bytes > config->whc_spill_writer_limit)
+    return true;
+  if (config->whc_spill_domain_limit > 0 && ddsrt_atomic_ld64 (whc->domain_resident_bytes) > config->whc_spill_domain_limit)
+    return true;
+  return false;
+}
+
+static bool whc_spill_cold_samples (struct whc_impl *whc)
+{
+  /* Acknowledged samples that are still in the WHC are there only for the benefit of
+     late-joining readers, these are moved to the spill file, oldest first, until the WHC
+     is back within budget.  Acknowledged samples form a prefix of the WHC, and all those
+     preceding spill_seq have been considered already.  At most WHC_SPILL_BATCH bytes are
+     written per call to bound the time spent holding the lock, the return value indicates
+     whether more could be spilled. */
+  struct whc_intvnode *intv;
+  struct dds_whc_default_node *whcn;
+  size_t written = 0;
+  if (!whc_over_budget (whc))
+    return false;
+  whcn = find_nextseq_intv (&intv, whc, whc->spill_seq - 1);
+  while (whcn && !whcn->unacked && whc_over_budget (whc))
+  {
+    if (written >= WHC_SPILL_BATCH)
+      return true;
+    /* a compressed wire form references the original, spilling it would gain nothing */
+    if (whcn->serdata && whcn->wire_serdata == NULL && !whcn->borrowed && dds_whc_spill_supported (whcn->serdata))
+    {
+      /* try again later if writing fails */
+      if ((whcn->spilled = dds_whc_spill_write (whc->spill, whcn->serdata)) == NULL)
+        return false;
+      TRACE ("whc_spill_cold_samples(%p) whcn %p %"PRIu64" size %"PRIuSIZE"\n", (void *) whc, (void *) whcn, whcn->common.seq, whcn->size);
+      ddsi_serdata_unref (whcn->serdata);
+      whcn->serdata = NULL;
+      whc_resident_sub (whc, whcn->size);
+      written += whcn->size;
+    }
+    whc->spill_seq = whcn->common.seq + 1;
+    whcn = whcn->next_seq;
+  }
+  return false;
+}
+
+static void whc_spill_cb (struct ddsi_xevent *xev, void *varg, ddsrt_mtime_t tnow)
+{
+  struct whc_impl * const whc = varg;
+  ddsrt_mutex_lock (&whc->lock);
+  bool more = whc_spill_cold_samples (whc);
+  if (dds_whc_spill_compact_needed (whc->spill))
+    more = dds_whc_spill_compact (whc->spill) || more;
+  ddsrt_mutex_unlock (&whc->lock);
+  /* continue with the next batch after giving writers and ACKs a chance at the lock */
+  if (more)
+    (void) ddsi_resched_xevent_if_earlier (xev, tnow);
+}
+
+static void whc_spill_schedule (struct whc_impl *whc)
+{
+  /* Spilling and compacting involve file I/O, which is done by the event thread instead of
+     on the write path or while processing an ACK.  Called with the WHC lock held. */
+  if (whc->spill == NULL || !(whc_over_budget (whc) || dds_whc_spill_compact_needed (whc->spill)))
+    return;
+  const ddsrt_mtime_t tnow = ddsrt_time_monotonic ();
+  if (whc->spill_evt == NULL)
+    whc->spill_evt = ddsi_qxev_callback (whc->gv->xevents, tnow, whc_spill_cb, whc);
+  else
+    (void) ddsi_resched_xevent_if_earlier (whc->spill_evt, tnow);
+}
+
 static uint32_t whc_default_remove_acked_messages (struct ddsi_whc *whc_generic, ddsi_seqno_t max_drop_seq, struct ddsi_whc_state *whcst, struct ddsi_whc_node **deferred_free_list)
 {
   struct whc_impl * const whc = (struct whc_impl *)whc_generic;
@@ -1095,13 +1328,25 @@ static uint32_t whc_default_remove_acked_messages (struct ddsi_whc *whc_generic,
     cnt = whc_default_remove_acked_messages_noidx (whc, max_drop_seq, deferred_free_list);
   else
     cnt = whc_default_remove_acked_messages_full (whc, max_drop_seq, deferred_free_list);
+  if (whc->deleted)
+  {
+    /* pruned from the index, these can go with the rest */
+    struct dds_whc_default_node *last = whc->deleted;
+    while (last->next_seq)
+      last = last->next_seq;
+    last->next_seq = (struct dds_whc_default_node *) *deferred_free_list;
+    *deferred_free_list = (struct ddsi_whc_node *) whc->deleted;
+    whc->deleted = NULL;
+  }
+  whc_spill_schedule (whc);
   get_state_locked (whc, whcst);
   ddsrt_mutex_unlock (&whc->lock);
   return cnt;
 }
 
-static struct dds_whc_default_node *whc_default_insert_seq (struct whc_impl *whc, ddsi_seqno_t max_drop_seq, ddsi_seqno_t seq, ddsrt_mtime_t exp, struct ddsi_serdata *serdata)
+static struct dds_whc_default_node *whc_default_new_node (struct whc_impl *whc, ddsi_seqno_t max_drop_seq, ddsi_seqno_t seq, ddsrt_mtime_t exp, struct ddsi_serdata *serdata, struct ddsi_serdata *wire_serdata)
 {
+  /* Only touches the new node, so the WHC lock need not be held */
   struct dds_whc_default_node *newn = NULL;
 
 #ifndef DDS_HAS_LIFESPAN
@@ -1118,21 +1363,31 @@ static struct dds_whc_default_node *whc_default_insert_seq (struct whc_impl *whc
   newn->last_rexmit_ts.v = 0;
   newn->rexmit_count = 0;
   newn->serdata = ddsi_serdata_ref (serdata);
+  newn->wire_serdata = (wire_serdata != serdata) ? ddsi_serdata_ref (wire_serdata) : NULL;
+  newn->spilled = NULL;
   newn->next_seq = NULL;
+  newn->size = whcn_size (whc, newn);
+#ifdef DDS_HAS_LIFESPAN
+  newn->lifespan.t_expire = exp;
+#endif
+  return newn;
+}
+
+static void whc_default_insert_seq (struct whc_impl *whc, struct dds_whc_default_node *newn)
+{
+  const ddsi_seqno_t seq = newn->common.seq;
+
   newn->prev_seq = whc->maxseq_node;
   if (newn->prev_seq)
     newn->prev_seq->next_seq = newn;
   whc->maxseq_node = newn;
 
-  newn->size = whcn_size (whc, newn);
   whc->total_bytes += newn->size;
   newn->total_bytes = whc->total_bytes;
   if (newn->unacked)
     whc->unacked_bytes += newn->size;
-
-#ifdef DDS_HAS_LIFESPAN
-  newn->lifespan.t_expire = exp;
-#endif
+  if (whc->spill)
+    whc_resident_add (whc, newn->size);
 
   insert_whcn_in_hash (whc, newn);
 
@@ -1168,13 +1423,12 @@ static struct dds_whc_default_node *whc_default_insert_seq (struct whc_impl *whc
 #ifdef DDS_HAS_LIFESPAN
   ddsi_lifespan_register_sample_locked (&whc->lifespan, &newn->lifespan);
 #endif
-  return newn;
 }
 
-static int whc_default_insert (struct ddsi_whc *whc_generic, ddsi_seqno_t max_drop_seq, ddsi_seqno_t seq, ddsrt_mtime_t exp, struct ddsi_serdata *serdata, struct ddsi_tkmap_instance *tk)
+static int whc_default_insert (struct ddsi_whc *whc_generic, ddsi_seqno_t max_drop_seq, ddsi_seqno_t seq, ddsrt_mtime_t exp, struct ddsi_serdata *serdata, struct ddsi_serdata *wire_serdata, struct ddsi_tkmap_instance *tk)
 {
   struct whc_impl * const whc = (struct whc_impl *)whc_generic;
-  struct dds_whc_default_node *newn = NULL;
+  struct dds_whc_default_node *newn = NULL, *deleted;
   struct whc_idxnode *idxn;
   union {
     struct whc_idxnode idxn;
@@ -1184,6 +1438,11 @@ static int whc_default_insert (struct ddsi_whc *whc_generic, ddsi_seqno_t max_dr
   /* FIXME: the 'exp' arg is used for lifespan, refactor this parameter to a struct 'writer info'
     that contains both lifespan als deadline info of the writer */
 
+  /* Everything that doesn't depend on the contents of the WHC is done before taking the
+     lock, everything that was removed from it is freed after releasing it, so as not to
+     hold up ACK processing */
+  newn = whc_default_new_node (whc, max_drop_seq, seq, exp, serdata, wire_serdata);
+
   ddsrt_mutex_lock (&whc->lock);
   check_whc (whc);
 
@@ -1206,7 +1465,7 @@ static int whc_default_insert (struct ddsi_whc *whc_generic, ddsi_seqno_t max_dr
   assert (whc->seq_size == 0 || seq > whc->maxseq_node->common.seq);
 
   /* Always insert in seq admin */
-  newn = whc_default_insert_seq (whc, max_drop_seq, seq, exp, serdata);
+  whc_default_insert_seq (whc, newn);
 
   TRACE ("  whcn %p:", (void*)newn);
 
@@ -1214,6 +1473,8 @@ static int whc_default_insert (struct ddsi_whc *whc_generic, ddsi_seqno_t max_dr
   if (serdata->kind == SDK_EMPTY)
   {
     TRACE (" empty or no hist\n");
+    whc_spill_schedule (whc);
+    assert (whc->deleted == NULL);
     ddsrt_mutex_unlock (&whc->lock);
     return 0;
   }
@@ -1322,19 +1583,29 @@ static int whc_default_insert (struct ddsi_whc *whc_generic, ddsi_seqno_t max_dr
     }
     TRACE ("\n");
   }
+  whc_spill_schedule (whc);
+  deleted = whc->deleted;
+  whc->deleted = NULL;
   ddsrt_mutex_unlock (&whc->lock);
+  whc_reclaim (whc, deleted);
   return 0;
 }
 
-static void make_borrowed_sample (struct ddsi_whc_borrowed_sample *sample, struct dds_whc_default_node *whcn)
+static bool make_borrowed_sample (const struct whc_impl *whc, struct ddsi_whc_borrowed_sample *sample, struct dds_whc_default_node *whcn)
 {
   assert (!whcn->borrowed);
+  /* Spilled samples are read back for the borrower only, the WHC keeps them on disk */
+  if (whcn->spilled == NULL)
+    sample->serdata = whcn->serdata;
+  else if ((sample->serdata = dds_whc_spill_read (whc->spill, whcn->spilled)) == NULL)
+    return false;
+  sample->wire_serdata = whcn->wire_serdata ? whcn->wire_serdata : sample->serdata;
   whcn->borrowed = 1;
   sample->seq = whcn->common.seq;
-  sample->serdata = whcn->serdata;
   sample->unacked = whcn->unacked;
   sample->rexmit_count = whcn->rexmit_count;
   sample->last_rexmit_ts = whcn->last_rexmit_ts;
+  return true;
 }
 
 static bool whc_default_borrow_sample (const struct ddsi_whc *whc_generic, ddsi_seqno_t seq, struct ddsi_whc_borrowed_sample *sample)
@@ -1346,10 +1617,7 @@ static bool whc_default_borrow_sample (const struct ddsi_whc *whc_generic, ddsi_
   if ((whcn = whc_findseq (whc, seq)) == NULL)
     found = false;
   else
-  {
-    make_borrowed_sample (sample, whcn);
-    found = true;
-  }
+    found = make_borrowed_sample (whc, sample, whcn);
   ddsrt_mutex_unlock ((ddsrt_mutex_t *)&whc->lock);
   return found;
 }
@@ -1363,10 +1631,7 @@ static bool whc_default_borrow_sample_key (const struct ddsi_whc *whc_generic, c
   if ((whcn = whc_findkey (whc, serdata_key)) == NULL)
     found = false;
   else
-  {
-    make_borrowed_sample (sample, whcn);
-    found = true;
-  }
+    found = make_borrowed_sample (whc, sample, whcn);
   ddsrt_mutex_unlock ((ddsrt_mutex_t *)&whc->lock);
   return found;
 }
@@ -1378,11 +1643,17 @@ static void return_sample_locked (struct whc_impl *whc, struct ddsi_whc_borrowed
   {
     /* data no longer present in WHC */
     ddsi_serdata_unref (sample->serdata);
+    if (sample->wire_serdata != sample->serdata)
+      ddsi_serdata_unref (sample->wire_serdata);
   }
   else
   {
     assert (whcn->borrowed);
     whcn->borrowed = 0;
+    if (whcn->spilled)
+      ddsi_serdata_unref (sample->serdata);
+    else if (whcn->common.seq < whc->spill_seq)
+      whc->spill_seq = whcn->common.seq; /* skipped it while it was borrowed */
     if (update_retransmit_info)
     {
       whcn->rexmit_count = sample->rexmit_count;
@@ -1426,13 +1697,10 @@ static bool whc_default_sample_iter_borrow_next (struct ddsi_whc_sample_iter *op
     it->first = false;
     seq = 0;
   }
-  if ((whcn = find_nextseq_intv (&intv, whc, seq)) == NULL)
-    valid = false;
-  else
-  {
-    make_borrowed_sample (sample, whcn);
-    valid = true;
-  }
+  whcn = find_nextseq_intv (&intv, whc, seq);
+  while (whcn && !make_borrowed_sample (whc, sample, whcn))
+    whcn = whcn->next_seq;
+  valid = (whcn != NULL);
   ddsrt_mutex_unlock (&whc->lock);
   return valid;
 }
@@ -108,6 +108,7 @@ static bool bwhc_sample_iter_borrow_next_proxy_topic (struct bwhc_iter * const i
   }
   /* next topic found, make sample and release proxypp lock */
   sample->serdata = dds__builtin_make_sample_proxy_topic (proxytp, proxytp->tupdate, true);
+  sample->wire_serdata = sample->serdata;
   it->have_sample = true;
   ddsrt_mutex_unlock (&it->cur_proxypp->e.lock);
 #else
@@ -183,6 +184,7 @@ static bool bwhc_sample_iter_borrow_next (struct ddsi_whc_sample_iter *opaque_it
       if (entity)
       {
         sample->serdata = make_sample (entity);
+        sample->wire_serdata = sample->serdata;
         it->have_sample = true;
         return true;
       }
@@ -221,6 +223,7 @@ static bool bwhc_sample_iter_borrow_next (struct ddsi_whc_sample_iter *opaque_it
           return false;
         }
         sample->serdata = dds__builtin_make_sample_endpoint (entity, entity->tupdate, true);
+        sample->wire_serdata = sample->serdata;
         it->have_sample = true;
         return true;
       }
@@ -237,13 +240,14 @@ static void bwhc_get_state (const struct ddsi_whc *whc, struct ddsi_whc_state *s
   st->unacked_bytes = 0;
 }
 
-static int bwhc_insert (struct ddsi_whc *whc, ddsi_seqno_t max_drop_seq, ddsi_seqno_t seq, ddsrt_mtime_t exp, struct ddsi_serdata *serdata, struct ddsi_tkmap_instance *tk)
+static int bwhc_insert (struct ddsi_whc *whc, ddsi_seqno_t max_drop_seq, ddsi_seqno_t seq, ddsrt_mtime_t exp, struct ddsi_serdata *serdata, struct ddsi_serdata *wire_serdata, struct ddsi_tkmap_instance *tk)
 {
   (void)whc;
   (void)max_drop_seq;
   (void)seq;
   (void)exp;
   (void)serdata;
+  (void)wire_serdata;
   (void)tk;
   return 0;
 }
@@ -0,0 +1,915 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include <assert.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dds/ddsrt/cdtors.h"
+#include "dds/ddsrt/filesystem.h"
+#include "dds/ddsrt/heap.h"
+#include "dds/ddsrt/hopscotch.h"
+#include "dds/ddsrt/io.h"
+#include "dds/ddsrt/mh3.h"
+#include "dds/ddsrt/misc.h"
+#include "dds/ddsrt/string.h"
+#include "dds/ddsrt/sync.h"
+#include "dds/ddsi/ddsi_domaingv.h"
+#include "dds/ddsi/ddsi_endpoint.h"
+#include "dds/ddsi/ddsi_serdata.h"
+#include "dds/ddsi/ddsi_thread.h"
+#include "dds/ddsi/ddsi_tkmap.h"
+#include "dds__whc.h"
+#include "dds__writer.h"
+#include "dds__write.h"
+
+#if DDSRT_HAVE_FILESYSTEM
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#endif
+
+/* The history of a persistent writer is stored in a log of segment files, each a sequence
+   of records consisting of a header and the serialised sample.  Records are only ever
+   appended to the newest segment (the "head"); a record that is no longer part of the
+   history gets marked as dead in place.  Older segments are removed once they no longer
+   contain live records, and compacted by copying their live records to the head once the
+   fraction of dead ones exceeds the configured threshold.  The log sequence number in the
+   header preserves the original order of the samples across compactions.
+
+   On start-up, the live records are read back, the history depth is applied once more in
+   case the process died before it could mark some records as dead, and the samples are
+   republished by the new writer.
+
+   There is no mmap abstraction in ddsrt and reconstructing a sample from its serialised
+   form copies the data anyway, so the segments are accessed using stdio.  All accesses to
+   the log happen while holding the lock of the WHC. */
+
+#define PLOG_MAGIC_LIVE 0x43444c31u /* "CDL1" */
+#define PLOG_MAGIC_DEAD 0x43444c30u /* "CDL0" */
+#define PLOG_SUFFIX ".log"
+
+struct plog_rec_hdr {
+  uint32_t magic;
+  uint32_t size; /* size of serialised sample following the header */
+  uint64_t lsn;
+  int64_t timestamp;
+  uint32_t statusinfo;
+  uint32_t kind;
+  uint32_t check; /* hash of the serialised sample */
+  uint32_t pad;
+};
+DDSRT_STATIC_ASSERT (sizeof (struct plog_rec_hdr) == 40);
+
+struct plog_rec {
+  struct plog_rec *prev, *next; /* live records in the same segment */
+  struct plog_rec *inst_next; /* next more recent live record of the same instance */
+  struct plog_segment *seg;
+  uint64_t off;
+  uint32_t size; /* including header */
+};
+
+struct plog_segment {
+  struct plog_segment *prev, *next; /* in order of id */
+  uint32_t id;
+  FILE *fp;
+  uint64_t size; /* offset of the end of the last record */
+  uint64_t live; /* total size of the live records */
+  bool dirty; /* written to since the last sync */
+  struct plog_rec *first, *last;
+};
+
+struct plog_instance {
+  uint64_t iid;
+  struct ddsi_tkmap_instance *tk;
+  uint32_t nrecs;
+  struct plog_rec *oldest, *newest;
+  uint32_t total, nseen; /* only used during recovery */
+};
+
+struct plog {
+  struct plog *next_open; /* protected by the singleton mutex */
+  struct ddsi_domaingv *gv;
+  char *prefix; /* path of the segment files up to the segment id */
+  uint32_t depth; /* history depth per instance, 0 = unlimited */
+  uint64_t next_lsn;
+  struct ddsrt_hh *instances;
+  struct plog_segment *first, *head;
+  ddsrt_mtime_t tsync;
+  bool compacting;
+};
+
+struct whc_persistent {
+  struct ddsi_whc common;
+  struct ddsi_whc *inner; /* does all the real work */
+  ddsrt_mutex_t lock;
+  struct ddsi_domaingv *gv;
+  uint32_t depth;
+  struct plog *log; /* NULL until recovered or if the log couldn't be opened */
+  bool replaying;
+};
+
+/* Logs currently in use, so no two writers in the process write to the same one */
+static struct plog *open_logs;
+
+static uint32_t plog_instance_hash (const void *va)
+{
+  const struct plog_instance *a = va;
+  return (uint32_t) a->iid;
+}
+
+static int plog_instance_eq (const void *va, const void *vb)
+{
+  const struct plog_instance *a = va;
+  const struct plog_instance *b = vb;
+  return a->iid == b->iid;
+}
+
+static char *plog_segment_path (const struct plog *log, uint32_t id)
+{
+  char *path;
+  (void) ddsrt_asprintf (&path, "%s%08"PRIx32 PLOG_SUFFIX, log->prefix, id);
+  return path;
+}
+
+static bool plog_seek (FILE *fp, uint64_t off)
+{
+  return off <= LONG_MAX && fseek (fp, (long) off, SEEK_SET) == 0;
+}
+
+static bool plog_fsync (FILE *fp)
+{
+  if (fflush (fp) != 0)
+    return false;
+#if DDSRT_HAVE_FILESYSTEM
+#ifdef _WIN32
+  return _commit (_fileno (fp)) == 0;
+#else
+  return fsync (fileno (fp)) == 0;
+#endif
+#else
+  return true;
+#endif
+}
+
+static void plog_sync (struct plog *log, bool force)
+{
+  const struct ddsi_config * const config = &log->gv->config;
+  const ddsrt_mtime_t tnow = ddsrt_time_monotonic ();
+  switch (config->persistent_store_fsync)
+  {
+    case DDSI_FSYNC_NEVER:
+      return;
+    case DDSI_FSYNC_INTERVAL:
+      if (!force && tnow.v < log->tsync.v + config->persistent_store_fsync_interval)
+        return;
+      break;
+    case DDSI_FSYNC_ALWAYS:
+      break;
+  }
+  for (struct plog_segment *seg = log->first; seg; seg = seg->next)
+  {
+    if (seg->dirty && !plog_fsync (seg->fp))
+      DDS_CWARNING (&log->gv->logconfig, "persistent store %s: synchronising segment %"PRIu32" failed\n", log->prefix, seg->id);
+    seg->dirty = false;
+  }
+  log->tsync = tnow;
+}
+
+static struct plog_segment *plog_add_segment (struct plog *log, uint32_t id, FILE *fp)
+{
+  struct plog_segment *seg = ddsrt_malloc (sizeof (*seg));
+  seg->id = id;
+  seg->fp = fp;
+  seg->size = 0;
+  seg->live = 0;
+  seg->dirty = false;
+  seg->first = seg->last = NULL;
+  seg->next = NULL;
+  if ((seg->prev = log->head) != NULL)
+    log->head->next = seg;
+  else
+    log->first = seg;
+  log->head = seg;
+  return seg;
+}
+
+static void plog_remove_segment (struct plog *log, struct plog_segment *seg)
+{
+  assert (seg->first == NULL && seg != log->head);
+  char *path = plog_segment_path (log, seg->id);
+  fclose (seg->fp);
+  (void) remove (path);
+  ddsrt_free (path);
+  if (seg->prev)
+    seg->prev->next = seg->next;
+  else
+    log->first = seg->next;
+  /* never the head, so there is always a next one */
+  seg->next->prev = seg->prev;
+  ddsrt_free (seg);
+}
+
+static bool plog_new_head (struct plog *log)
+{
+  const uint32_t id = log->head ? log->head->id + 1 : 0;
+  char *path = plog_segment_path (log, id);
+  FILE *fp;
+  DDSRT_WARNING_MSVC_OFF (4996);
+  fp = fopen (path, "w+b");
+  DDSRT_WARNING_MSVC_ON (4996);
+  if (fp == NULL)
+    DDS_CWARNING (&log->gv->logconfig, "persistent store: could not create %s\n", path);
+  ddsrt_free (path);
+  if (fp == NULL)
+    return false;
+  struct plog_segment * const old_head = log->head;
+  (void) plog_add_segment (log, id, fp);
+  if (old_head && old_head->first == NULL)
+    plog_remove_segment (log, old_head);
+  return true;
+}
+
+static void plog_link_rec (struct plog_segment *seg, struct plog_rec *rec)
+{
+  rec->seg = seg;
+  rec->next = NULL;
+  if ((rec->prev = seg->last) != NULL)
+    seg->last->next = rec;
+  else
+    seg->first = rec;
+  seg->last = rec;
+  seg->live += rec->size;
+}
+
+static void plog_unlink_rec (struct plog_rec *rec)
+{
+  struct plog_segment * const seg = rec->seg;
+  if (rec->prev)
+    rec->prev->next = rec->next;
+  else
+    seg->first = rec->next;
+  if (rec->next)
+    rec->next->prev = rec->prev;
+  else
+    seg->last = rec->prev;
+  assert (seg->live >= rec->size);
+  seg->live -= rec->size;
+}
+
+static void plog_mark_dead (struct plog *log, struct plog_segment *seg, uint64_t off)
+{
+  const uint32_t magic = PLOG_MAGIC_DEAD;
+  if (!plog_seek (seg->fp, off) || fwrite (&magic, sizeof (magic), 1, seg->fp) != 1 || fflush (seg->fp) != 0)
+    DDS_CWARNING (&log->gv->logconfig, "persistent store %s: marking record in segment %"PRIu32" as dead failed\n", log->prefix, seg->id);
+  seg->dirty = true;
+}
+
+static void plog_kill_rec (struct plog *log, struct plog_rec *rec)
+{
+  struct plog_segment * const seg = rec->seg;
+  plog_unlink_rec (rec);
+  if (seg->first == NULL && seg != log->head)
+    plog_remove_segment (log, seg);
+  else
+    plog_mark_dead (log, seg, rec->off);
+  ddsrt_free (rec);
+}
+
+static void plog_compact (struct plog *log);
+
+static bool plog_append_raw (struct plog *log, const struct plog_rec_hdr *hdr, const void *payload, uint64_t *off)
+{
+  struct plog_segment *head = log->head;
+  if (head->size >= log->gv->config.persistent_store_segment_size)
+  {
+    /* closing a segment means syncing it unless told never to sync */
+    plog_sync (log, true);
+    if (!plog_new_head (log))
+      return false;
+    head = log->head;
+    if (!log->compacting)
+      plog_compact (log);
+  }
+  if (!plog_seek (head->fp, head->size) ||
+      fwrite (hdr, sizeof (*hdr), 1, head->fp) != 1 ||
+      (hdr->size > 0 && fwrite (payload, hdr->size, 1, head->fp) != 1) ||
+      fflush (head->fp) != 0)
+  {
+    DDS_CWARNING (&log->gv->logconfig, "persistent store %s: writing to segment %"PRIu32" failed\n", log->prefix, head->id);
+    return false;
+  }
+  *off = head->size;
+  head->size += sizeof (*hdr) + hdr->size;
+  head->dirty = true;
+  return true;
+}
+
+static bool plog_move_live_records (struct plog *log, struct plog_segment *seg)
+{
+  /* If this fails half-way through, the copies that did get written are recognised by
+     their log sequence numbers on recovery */
+  void *buf = NULL;
+  size_t bufsize = 0;
+  bool ok = true;
+  while (ok && seg->first)
+  {
+    struct plog_rec * const rec = seg->first;
+    struct plog_rec_hdr hdr;
+    uint64_t off;
+    if (rec->size > bufsize)
+    {
+      buf = ddsrt_realloc (buf, rec->size);
+      bufsize = rec->size;
+    }
+    if (!(ok = (plog_seek (seg->fp, rec->off) && fread (&hdr, sizeof (hdr), 1, seg->fp) == 1 &&
+                (hdr.size == 0 || fread (buf, hdr.size, 1, seg->fp) == 1))))
+      DDS_CWARNING (&log->gv->logconfig, "persistent store %s: reading from segment %"PRIu32" failed\n", log->prefix, seg->id);
+    else if ((ok = plog_append_raw (log, &hdr, buf, &off)))
+    {
+      plog_unlink_rec (rec);
+      rec->off = off;
+      plog_link_rec (log->head, rec);
+    }
+  }
+  ddsrt_free (buf);
+  return ok;
+}
+
+static void plog_compact (struct plog *log)
+{
+  const uint64_t threshold = (uint64_t) log->gv->config.persistent_store_compaction_threshold;
+  bool moved = false;
+  log->compacting = true;
+  for (struct plog_segment *seg = log->first, *next; seg != log->head; seg = next)
+  {
+    next = seg->next;
+    if (seg->live > 0 && (seg->size - seg->live) * 100 >= threshold * seg->size && seg->size > seg->live)
+    {
+      if (!plog_move_live_records (log, seg))
+        break;
+      moved = true;
+    }
+  }
+  if (moved)
+  {
+    /* the copies must be on disk before the originals disappear */
+    plog_sync (log, true);
+    for (struct plog_segment *seg = log->first, *next; seg != log->head; seg = next)
+    {
+      next = seg->next;
+      if (seg->first == NULL)
+        plog_remove_segment (log, seg);
+    }
+  }
+  log->compacting = false;
+}
+
+static struct plog_instance *plog_lookup_instance (struct plog *log, struct ddsi_tkmap_instance *tk)
+{
+  struct plog_instance template = { .iid = tk->m_iid }, *inst;
+  if ((inst = ddsrt_hh_lookup (log->instances, &template)) == NULL)
+  {
+    inst = ddsrt_malloc (sizeof (*inst));
+    inst->iid = tk->m_iid;
+    inst->tk = tk;
+    ddsi_tkmap_instance_ref (tk);
+    inst->nrecs = 0;
+    inst->oldest = inst->newest = NULL;
+    inst->total = inst->nseen = 0;
+    ddsrt_hh_add_absent (log->instances, inst);
+  }
+  return inst;
+}
+
+static void plog_free_instance (struct plog *log, struct plog_instance *inst)
+{
+  ddsi_tkmap_instance_unref (log->gv->m_tkmap, inst->tk);
+  ddsrt_free (inst);
+}
+
+static void plog_drop_instance (struct plog *log, struct plog_instance *inst)
+{
+  ddsrt_hh_remove_present (log->instances, inst);
+  while (inst->oldest)
+  {
+    struct plog_rec *rec = inst->oldest;
+    inst->oldest = rec->inst_next;
+    plog_kill_rec (log, rec);
+  }
+  plog_free_instance (log, inst);
+}
+
+static void plog_push_rec (struct plog *log, struct plog_instance *inst, struct plog_rec *rec)
+{
+  rec->inst_next = NULL;
+  if (inst->newest)
+    inst->newest->inst_next = rec;
+  else
+    inst->oldest = rec;
+  inst->newest = rec;
+  if (++inst->nrecs > log->depth && log->depth > 0)
+  {
+    struct plog_rec *old = inst->oldest;
+    inst->oldest = old->inst_next;
+    inst->nrecs--;
+    plog_kill_rec (log, old);
+  }
+}
+
+static void plog_append (struct plog *log, struct ddsi_tkmap_instance *tk, struct ddsi_serdata *serdata)
+{
+  if (serdata->statusinfo & DDSI_STATUSINFO_UNREGISTER)
+  {
+    /* the WHC forgets about unregistered instances, so must we */
+    struct plog_instance template = { .iid = tk->m_iid }, *inst;
+    if ((inst = ddsrt_hh_lookup (log->instances, &template)) != NULL)
+      plog_drop_instance (log, inst);
+    plog_sync (log, false);
+    return;
+  }
+
+  const uint32_t size = ddsi_serdata_size (serdata);
+  struct plog_rec_hdr hdr;
+  ddsrt_iovec_t iov;
+  uint64_t off;
+  memset (&hdr, 0, sizeof (hdr));
+  hdr.magic = PLOG_MAGIC_LIVE;
+  hdr.size = size;
+  hdr.lsn = log->next_lsn++;
+  hdr.timestamp = serdata->timestamp.v;
+  hdr.statusinfo = serdata->statusinfo;
+  hdr.kind = (uint32_t) serdata->kind;
+  struct ddsi_serdata * const ref = ddsi_serdata_to_ser_ref (serdata, 0, size, &iov);
+  bool ok;
+  if (iov.iov_len < size)
+  {
+    /* the serdata may not be able to provide its contents in a single buffer */
+    DDS_CWARNING (&log->gv->logconfig, "persistent store %s: sample not available in contiguous memory\n", log->prefix);
+    ok = false;
+  }
+  else
+  {
+    hdr.check = ddsrt_mh3 (iov.iov_base, size, hdr.size);
+    ok = plog_append_raw (log, &hdr, iov.iov_base, &off);
+  }
+  ddsi_serdata_to_ser_unref (ref, &iov);
+  if (ok)
+  {
+    struct plog_rec *rec = ddsrt_malloc (sizeof (*rec));
+    rec->off = off;
+    rec->size = (uint32_t) sizeof (hdr) + size;
+    plog_link_rec (log->head, rec);
+    plog_push_rec (log, plog_lookup_instance (log, tk), rec);
+  }
+  plog_sync (log, false);
+}
+
+struct plog_recovered {
+  uint64_t lsn;
+  struct plog_segment *seg;
+  uint64_t off;
+  uint32_t size;
+  struct ddsi_serdata *sd;
+  struct plog_instance *inst;
+};
+
+static int plog_recovered_cmp (const void *va, const void *vb)
+{
+  const struct plog_recovered *a = va;
+  const struct plog_recovered *b = vb;
+  return (a->lsn == b->lsn) ? 0 : (a->lsn < b->lsn) ? -1 : 1;
+}
+
+static int plog_id_cmp (const void *va, const void *vb)
+{
+  const uint32_t *a = va;
+  const uint32_t *b = vb;
+  return (*a == *b) ? 0 : (*a < *b) ? -1 : 1;
+}
+
+static void plog_read_segment (struct plog *log, const struct ddsi_sertype *type, struct plog_segment *seg, struct plog_recovered **recs, size_t *nrecs, size_t *maxrecs)
+{
+  /* Reads records until the end of the file or the first one that is incomplete or
+     corrupt, which should only happen if the process died while writing it. */
+  struct plog_rec_hdr hdr;
+  uint64_t off = 0, fsize;
+  long end;
+  if (fseek (seg->fp, 0, SEEK_END) != 0 || (end = ftell (seg->fp)) < 0)
+    return;
+  fsize = (uint64_t) end;
+  while (plog_seek (seg->fp, off) && fread (&hdr, sizeof (hdr), 1, seg->fp) == 1)
+  {
+    if (hdr.magic != PLOG_MAGIC_LIVE && hdr.magic != PLOG_MAGIC_DEAD)
+      break;
+    /* a size beyond the end of the segment can only come from a corrupt header */
+    if (hdr.size > fsize - off - sizeof (hdr))
+      break;
+    if (hdr.magic == PLOG_MAGIC_LIVE)
+    {
+      ddsrt_iovec_t iov;
+      struct ddsi_serdata *sd = NULL;
+      iov.iov_base = ddsrt_malloc (hdr.size > 0 ? hdr.size : 1);
+      iov.iov_len = (ddsrt_iov_len_t) hdr.size;
+      if ((hdr.size > 0 && fread (iov.iov_base, hdr.size, 1, seg->fp) != 1) || ddsrt_mh3 (iov.iov_base, hdr.size, hdr.size) != hdr.check)
+      {
+        ddsrt_free (iov.iov_base);
+        break;
+      }
+      if ((hdr.kind == SDK_DATA || hdr.kind == SDK_KEY) &&
+          (sd = ddsi_serdata_from_ser_iov (type, (enum ddsi_serdata_kind) hdr.kind, 1, &iov, hdr.size)) != NULL)
+      {
+        sd->timestamp.v = hdr.timestamp;
+        sd->statusinfo = hdr.statusinfo;
+      }
+      ddsrt_free (iov.iov_base);
+      if (sd == NULL)
+      {
+        /* not a sample of this type, so also not something we can ever use */
+        DDS_CWARNING (&log->gv->logconfig, "persistent store %s: discarding invalid sample in segment %"PRIu32"\n", log->prefix, seg->id);
+        plog_mark_dead (log, seg, off);
+      }
+      else
+      {
+        if (*nrecs == *maxrecs)
+        {
+          *maxrecs = (*maxrecs == 0) ? 64 : 2 * *maxrecs;
+          *recs = ddsrt_realloc (*recs, *maxrecs * sizeof (**recs));
+        }
+        struct plog_recovered * const r = &(*recs)[(*nrecs)++];
+        r->lsn = hdr.lsn;
+        r->seg = seg;
+        r->off = off;
+        r->size = (uint32_t) sizeof (hdr) + hdr.size;
+        r->sd = sd;
+        r->inst = NULL;
+      }
+    }
+    off += sizeof (hdr) + hdr.size;
+    seg->size = off;
+  }
+}
+
+static uint32_t *plog_list_segments (const char *dir, const char *base, size_t *nids)
+{
+  uint32_t *ids = NULL;
+  size_t maxids = 0;
+  *nids = 0;
+#if DDSRT_HAVE_FILESYSTEM
+  ddsrt_dir_handle_t dh;
+  struct ddsrt_dirent de;
+  const size_t baselen = strlen (base), suffixlen = strlen (PLOG_SUFFIX);
+  if (ddsrt_opendir (dir, &dh) != DDS_RETCODE_OK)
+    return NULL;
+  while (ddsrt_readdir (dh, &de) == DDS_RETCODE_OK)
+  {
+    char *endp;
+    unsigned long id;
+    if (strlen (de.d_name) != baselen + 8 + suffixlen || strncmp (de.d_name, base, baselen) != 0 || strcmp (de.d_name + baselen + 8, PLOG_SUFFIX) != 0)
+      continue;
+    id = strtoul (de.d_name + baselen, &endp, 16);
+    if (endp != de.d_name + baselen + 8)
+      continue;
+    if (*nids == maxids)
+    {
+      maxids = (maxids == 0) ? 8 : 2 * maxids;
+      ids = ddsrt_realloc (ids, maxids * sizeof (*ids));
+    }
+    ids[(*nids)++] = (uint32_t) id;
+  }
+  (void) ddsrt_closedir (dh);
+  qsort (ids, *nids, sizeof (*ids), plog_id_cmp);
+#else
+  (void) dir; (void) base;
+#endif
+  return ids;
+}
+
+static void plog_free (struct plog *log)
+{
+  struct ddsrt_hh_iter it;
+  struct plog_instance *inst;
+  for (inst = ddsrt_hh_iter_first (log->instances, &it); inst; inst = ddsrt_hh_iter_next (&it))
+  {
+    struct plog_rec *rec = inst->oldest;
+    while (rec)
+    {
+      struct plog_rec *tmp = rec;
+      rec = rec->inst_next;
+      ddsrt_free (tmp);
+    }
+    plog_free_instance (log, inst);
+  }
+  ddsrt_hh_free (log->instances);
+  while (log->first)
+  {
+    struct plog_segment *seg = log->first;
+    log->first = seg->next;
+    if (seg->dirty && log->gv->config.persistent_store_fsync != DDSI_FSYNC_NEVER)
+      (void) plog_fsync (seg->fp);
+    fclose (seg->fp);
+    if (seg->live == 0)
+    {
+      /* no need to leave behind segments without data */
+      char *path = plog_segment_path (log, seg->id);
+      (void) remove (path);
+      ddsrt_free (path);
+    }
+    ddsrt_free (seg);
+  }
+  ddsrt_mutex_lock (ddsrt_get_singleton_mutex ());
+  struct plog **plog = &open_logs;
+  while (*plog != log)
+    plog = &(*plog)->next_open;
+  *plog = log->next_open;
+  ddsrt_mutex_unlock (ddsrt_get_singleton_mutex ());
+  ddsrt_free (log->prefix);
+  ddsrt_free (log);
+}
+
+static char *plog_base_name (const char *topic_name, const char *type_name)
+{
+  /* topic names may contain all sorts of characters, so use a sanitised prefix of the
+     topic name for readability and a hash of the topic and type names for uniqueness */
+  char buf[33], *base;
+  size_t i;
+  for (i = 0; i < sizeof (buf) - 1 && topic_name[i]; i++)
+  {
+    const char c = topic_name[i];
+    buf[i] = ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_') ? c : '_';
+  }
+  buf[i] = 0;
+  const uint32_t h = ddsrt_mh3 (type_name, strlen (type_name), ddsrt_mh3 (topic_name, strlen (topic_name), 0));
+  (void) ddsrt_asprintf (&base, "%s-%08"PRIx32"-", buf, h);
+  return base;
+}
+
+static struct plog *plog_open (struct ddsi_domaingv *gv, const char *topic_name, const struct ddsi_sertype *type, uint32_t depth, struct ddsi_serdata ***replay, size_t *nreplay)
+{
+  const char *dir = gv->config.persistent_store_directory;
+  char *base = plog_base_name (topic_name, type->type_name);
+  struct plog *log = ddsrt_malloc (sizeof (*log));
+  log->gv = gv;
+#if DDSRT_HAVE_FILESYSTEM
+  (void) ddsrt_asprintf (&log->prefix, "%s%s%s", dir, ddsrt_file_sep (), base);
+#else
+  (void) ddsrt_asprintf (&log->prefix, "%s/%s", dir, base);
+#endif
+  log->depth = depth;
+  log->next_lsn = 0;
+  log->instances = ddsrt_hh_new (1, plog_instance_hash, plog_instance_eq);
+  log->first = log->head = NULL;
+  log->tsync = ddsrt_time_monotonic ();
+  log->compacting = false;
+  *replay = NULL;
+  *nreplay = 0;
+
+  ddsrt_mutex_lock (ddsrt_get_singleton_mutex ());
+  for (struct plog *l = open_logs; l; l = l->next_open)
+  {
+    if (strcmp (l->prefix, log->prefix) == 0)
+    {
+      ddsrt_mutex_unlock (ddsrt_get_singleton_mutex ());
+      DDS_CWARNING (&gv->logconfig, "persistent store %s: already in use, history of topic %s will not be persisted\n", log->prefix, topic_name);
+      ddsrt_hh_free (log->instances);
+      ddsrt_free (log->prefix);
+      ddsrt_free (log);
+      ddsrt_free (base);
+      return NULL;
+    }
+  }
+  log->next_open = open_logs;
+  open_logs = log;
+  ddsrt_mutex_unlock (ddsrt_get_singleton_mutex ());
+
+  /* read all live records in all segments */
+  struct plog_recovered *recs = NULL;
+  size_t nrecs = 0, maxrecs = 0, nids;
+  uint32_t *ids = plog_list_segments (dir, base, &nids);
+  ddsrt_free (base);
+  for (size_t i = 0; i < nids; i++)
+  {
+    char *path = plog_segment_path (log, ids[i]);
+    FILE *fp;
+    DDSRT_WARNING_MSVC_OFF (4996);
+    fp = fopen (path, "r+b");
+    DDSRT_WARNING_MSVC_ON (4996);
+    if (fp == NULL)
+      DDS_CWARNING (&gv->logconfig, "persistent store: could not open %s\n", path);
+    else
+      plog_read_segment (log, type, plog_add_segment (log, ids[i], fp), &recs, &nrecs, &maxrecs);
+    ddsrt_free (path);
+  }
+  ddsrt_free (ids);
+
+  /* apply history depth in original order of writing, a sample may be present twice if
+     compacting got interrupted */
+  qsort (recs, nrecs, sizeof (*recs), plog_recovered_cmp);
+  for (size_t i = 0; i < nrecs; i++)
+  {
+    if (i > 0 && recs[i].lsn == recs[i-1].lsn)
+    {
+      plog_mark_dead (log, recs[i].seg, recs[i].off);
+      ddsi_serdata_unref (recs[i].sd);
+      recs[i].sd = NULL;
+      continue;
+    }
+    struct ddsi_tkmap_instance *tk = ddsi_tkmap_lookup_instance_ref (gv->m_tkmap, recs[i].sd);
+    recs[i].inst = plog_lookup_instance (log, tk);
+    recs[i].inst->total++;
+    ddsi_tkmap_instance_unref (gv->m_tkmap, tk);
+    log->next_lsn = recs[i].lsn + 1;
+  }
+  *replay = ddsrt_malloc ((nrecs > 0 ? nrecs : 1) * sizeof (**replay));
+  for (size_t i = 0; i < nrecs; i++)
+  {
+    struct plog_instance * const inst = recs[i].inst;
+    if (recs[i].sd == NULL)
+      continue;
+    else if (depth > 0 && inst->total - inst->nseen++ > depth)
+    {
+      plog_mark_dead (log, recs[i].seg, recs[i].off);
+      ddsi_serdata_unref (recs[i].sd);
+    }
+    else
+    {
+      struct plog_rec *rec = ddsrt_malloc (sizeof (*rec));
+      rec->off = recs[i].off;
+      rec->size = recs[i].size;
+      plog_link_rec (recs[i].seg, rec);
+      plog_push_rec (log, inst, rec);
+      (*replay)[(*nreplay)++] = recs[i].sd;
+    }
+  }
+  ddsrt_free (recs);
+
+  /* never append to a recovered segment: it may end in a partially written record */
+  if (!plog_new_head (log))
+  {
+    for (size_t i = 0; i < *nreplay; i++)
+      ddsi_serdata_unref ((*replay)[i]);
+    ddsrt_free (*replay);
+    *replay = NULL;
+    *nreplay = 0;
+    plog_free (log);
+    return NULL;
+  }
+  for (struct plog_segment *seg = log->first, *next; seg != log->head; seg = next)
+  {
+    next = seg->next;
+    if (seg->first == NULL)
+      plog_remove_segment (log, seg);
+  }
+  plog_sync (log, true);
+  return log;
+}
+
+static int whc_persistent_insert (struct ddsi_whc *whc_generic, ddsi_seqno_t max_drop_seq, ddsi_seqno_t seq, ddsrt_mtime_t exp, struct ddsi_serdata *serdata, struct ddsi_serdata *wire_serdata, struct ddsi_tkmap_instance *tk)
+{
+  struct whc_persistent * const whc = (struct whc_persistent *) whc_generic;
+  int ret;
+  ddsrt_mutex_lock (&whc->lock);
+  if ((ret = whc->inner->ops->insert (whc->inner, max_drop_seq, seq, exp, serdata, wire_serdata, tk)) == 0)
+  {
+    if (whc->log && !whc->replaying && serdata->kind != SDK_EMPTY && tk != NULL)
+      plog_append (whc->log, tk, serdata);
+  }
+  ddsrt_mutex_unlock (&whc->lock);
+  return ret;
+}
+
+static uint32_t whc_persistent_remove_acked_messages (struct ddsi_whc *whc_generic, ddsi_seqno_t max_drop_seq, struct ddsi_whc_state *whcst, struct ddsi_whc_node **deferred_free_list)
+{
+  struct whc_persistent * const whc = (struct whc_persistent *) whc_generic;
+  return whc->inner->ops->remove_acked_messages (whc->inner, max_drop_seq, whcst, deferred_free_list);
+}
+
+static void whc_persistent_free_deferred_free_list (struct ddsi_whc *whc_generic, struct ddsi_whc_node *deferred_free_list)
+{
+  struct whc_persistent * const whc = (struct whc_persistent *) whc_generic;
+  whc->inner->ops->free_deferred_free_list (whc->inner, deferred_free_list);
+}
+
+static void whc_persistent_get_state (const struct ddsi_whc *whc_generic, struct ddsi_whc_state *st)
+{
+  const struct whc_persistent * const whc = (const struct whc_persistent *) whc_generic;
+  whc->inner->ops->get_state (whc->inner, st);
+}
+
+static ddsi_seqno_t whc_persistent_next_seq (const struct ddsi_whc *whc_generic, ddsi_seqno_t seq)
+{
+  const struct whc_persistent * const whc = (const struct whc_persistent *) whc_generic;
+  return whc->inner->ops->next_seq (whc->inner, seq);
+}
+
+static bool whc_persistent_borrow_sample (const struct ddsi_whc *whc_generic, ddsi_seqno_t seq, struct ddsi_whc_borrowed_sample *sample)
+{
+  const struct whc_persistent * const whc = (const struct whc_persistent *) whc_generic;
+  return whc->inner->ops->borrow_sample (whc->inner, seq, sample);
+}
+
+static bool whc_persistent_borrow_sample_key (const struct ddsi_whc *whc_generic, const struct ddsi_serdata *serdata_key, struct ddsi_whc_borrowed_sample *sample)
+{
+  const struct whc_persistent * const whc = (const struct whc_persistent *) whc_generic;
+  return whc->inner->ops->borrow_sample_key (whc->inner, serdata_key, sample);
+}
+
+static void whc_persistent_return_sample (struct ddsi_whc *whc_generic, struct ddsi_whc_borrowed_sample *sample, bool update_retransmit_info)
+{
+  struct whc_persistent * const whc = (struct whc_persistent *) whc_generic;
+  whc->inner->ops->return_sample (whc->inner, sample, update_retransmit_info);
+}
+
+static void whc_persistent_sample_iter_init (const struct ddsi_whc *whc_generic, struct ddsi_whc_sample_iter *opaque_it)
+{
+  /* the iterator refers to the WHC it was initialised with, so that must be the inner one */
+  const struct whc_persistent * const whc = (const struct whc_persistent *) whc_generic;
+  whc->inner->ops->sample_iter_init (whc->inner, opaque_it);
+}
+
+static bool whc_persistent_sample_iter_borrow_next (struct ddsi_whc_sample_iter *opaque_it, struct ddsi_whc_borrowed_sample *sample)
+{
+  struct ddsi_whc * const inner = opaque_it->c.whc;
+  return inner->ops->sample_iter_borrow_next (opaque_it, sample);
+}
+
+static void whc_persistent_free (struct ddsi_whc *whc_generic)
+{
+  struct whc_persistent * const whc = (struct whc_persistent *) whc_generic;
+  if (whc->log)
+    plog_free (whc->log);
+  whc->inner->ops->free (whc->inner);
+  ddsrt_mutex_destroy (&whc->lock);
+  ddsrt_free (whc);
+}
+
+static const struct ddsi_whc_ops whc_persistent_ops = {
+  .insert = whc_persistent_insert,
+  .remove_acked_messages = whc_persistent_remove_acked_messages,
+  .free_deferred_free_list = whc_persistent_free_deferred_free_list,
+  .get_state = whc_persistent_get_state,
+  .next_seq = whc_persistent_next_seq,
+  .borrow_sample = whc_persistent_borrow_sample,
+  .borrow_sample_key = whc_persistent_borrow_sample_key,
+  .return_sample = whc_persistent_return_sample,
+  .sample_iter_init = whc_persistent_sample_iter_init,
+  .sample_iter_borrow_next = whc_persistent_sample_iter_borrow_next,
+  .free = whc_persistent_free
+};
+
+struct ddsi_whc *dds_whc_persistent_new (struct ddsi_domaingv *gv, const struct whc_writer_info *wrinfo)
+{
+  struct whc_writer_info inner_wrinfo = *wrinfo;
+  assert (wrinfo->is_persistent && wrinfo->is_transient_local);
+  inner_wrinfo.is_persistent = 0;
+  struct whc_persistent *whc = ddsrt_malloc (sizeof (*whc));
+  whc->common.ops = &whc_persistent_ops;
+  whc->inner = dds_whc_new (gv, &inner_wrinfo);
+  ddsrt_mutex_init (&whc->lock);
+  whc->gv = gv;
+  whc->depth = wrinfo->tldepth;
+  whc->log = NULL;
+  whc->replaying = false;
+  return &whc->common;
+}
+
+void dds_whc_persistent_recover (struct ddsi_whc *whc_generic, struct dds_writer *wr)
+{
+  if (whc_generic->ops != &whc_persistent_ops)
+    return;
+  struct whc_persistent * const whc = (struct whc_persistent *) whc_generic;
+  struct ddsi_serdata **replay;
+  size_t nreplay;
+  /* reading the log looks up the instances in the tkmap, which requires being awake */
+  struct ddsi_thread_state * const thrst = ddsi_lookup_thread_state ();
+  ddsi_thread_state_awake (thrst, whc->gv);
+  ddsrt_mutex_lock (&whc->lock);
+  whc->log = plog_open (whc->gv, wr->m_topic->m_name, wr->m_wr->type, whc->depth, &replay, &nreplay);
+  whc->replaying = true;
+  ddsrt_mutex_unlock (&whc->lock);
+  ddsi_thread_state_asleep (thrst);
+  if (whc->log == NULL)
+    return;
+
+  /* republish the history, the samples are in the log already */
+  struct ddsi_domaingv * const gv = whc->gv;
+  GVLOG (DDS_LC_DISCOVERY, "persistent store %s: republishing %"PRIuSIZE" samples\n", whc->log->prefix, nreplay);
+  for (size_t i = 0; i < nreplay; i++)
+    (void) dds_writecdr_impl (wr, wr->m_xp, replay[i], i + 1 == nreplay);
+  ddsrt_free (replay);
+
+  ddsrt_mutex_lock (&whc->lock);
+  whc->replaying = false;
+  ddsrt_mutex_unlock (&whc->lock);
+}
@@ -0,0 +1,546 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+#include "dds/ddsrt/heap.h"
+#include "dds/ddsrt/sync.h"
+#include "dds/ddsrt/misc.h"
+#include "dds/ddsi/ddsi_serdata.h"
+#include "dds/ddsi/ddsi_unused.h"
+#include "dds/ddsi/ddsi_domaingv.h"
+#include "dds/ddsi/ddsi_entity.h"
+#include "dds__whc.h"
+
+/* WHC for keyless, volatile writers without deadline or lifespan QoS
+ *
+ * With only a single instance and no transient-local history to maintain, the samples
+ * in the WHC are simply those that have not been acknowledged yet, minus those that
+ * were pushed out of a KEEP_LAST history.  So instead of the sequence number hash table,
+ * interval tree and instance index of the default WHC, this one has:
+ *
+ * - a power-of-two ring of node pointers indexed by sequence number, covering the range
+ *   [min_seq,max_seq] of sequence numbers present in the WHC; slots for sequence numbers
+ *   that were dropped from the middle of the range (only KEEP_LAST history does that)
+ *   are NULL;
+ * - for KEEP_LAST, a ring of the sequence numbers of the last hdepth samples of the
+ *   instance, an unregister resets the instance;
+ * - a pool of nodes, refilled by free_deferred_free_list.
+ *
+ * The ring grows (by doubling) if a writer gets ahead of its readers by more than its
+ * size, the node pool grows if it runs dry, but neither ever shrinks and so once they
+ * have grown to the writer's working set, nothing gets allocated anymore.
+ */
+
+#define WHC_RING_INITIAL_SIZE 64u
+
+struct whc_ring_node {
+  struct ddsi_whc_node common;
+  struct whc_ring_node *next; /* deferred free list & node pool */
+  size_t size;
+  unsigned unacked: 1; /* counted in whc::unacked_bytes iff 1 */
+  unsigned borrowed: 1; /* at most one can borrow it at any time */
+  ddsrt_mtime_t last_rexmit_ts;
+  uint32_t rexmit_count;
+  struct ddsi_serdata *serdata;
+  struct ddsi_serdata *wire_serdata; /* NULL if serdata goes out on the wire as is */
+};
+DDSRT_STATIC_ASSERT (offsetof (struct whc_ring_node, common) == 0);
+
+struct whc_ring {
+  struct ddsi_whc common;
+  ddsrt_mutex_t lock;
+  struct ddsi_domaingv *gv;
+  uint32_t hdepth; /* 0 = KEEP_ALL */
+  uint32_t seq_size; /* number of samples present */
+  size_t unacked_bytes;
+  size_t sample_overhead;
+  uint32_t fragment_size;
+  ddsi_seqno_t max_drop_seq;
+  ddsi_seqno_t min_seq; /* lowest seq present, valid iff seq_size > 0 */
+  ddsi_seqno_t max_seq; /* highest seq present, valid iff seq_size > 0 */
+  uint32_t mask; /* size of ring - 1 */
+  struct whc_ring_node **ring;
+  uint32_t hist_head; /* index of most recent entry in hist */
+  uint32_t hist_count; /* number of valid entries in hist */
+  ddsi_seqno_t *hist; /* sequence numbers of the most recent samples of the instance */
+  struct whc_ring_node *pool;
+};
+
+struct ddsi_whc_sample_iter_ring {
+  struct ddsi_whc_sample_iter_base c;
+  bool first;
+};
+
+/* check that our definition of whc_sample_iter fits in the type that callers allocate */
+DDSRT_STATIC_ASSERT (sizeof (struct ddsi_whc_sample_iter_ring) <= sizeof (struct ddsi_whc_sample_iter));
+
+static uint32_t whc_ring_remove_acked_messages (struct ddsi_whc *whc, ddsi_seqno_t max_drop_seq, struct ddsi_whc_state *whcst, struct ddsi_whc_node **deferred_free_list);
+static void whc_ring_free_deferred_free_list (struct ddsi_whc *whc, struct ddsi_whc_node *deferred_free_list);
+static void whc_ring_get_state (const struct ddsi_whc *whc, struct ddsi_whc_state *st);
+static int whc_ring_insert (struct ddsi_whc *whc, ddsi_seqno_t max_drop_seq, ddsi_seqno_t seq, ddsrt_mtime_t exp, struct ddsi_serdata *serdata, struct ddsi_serdata *wire_serdata, struct ddsi_tkmap_instance *tk);
+static ddsi_seqno_t whc_ring_next_seq (const struct ddsi_whc *whc, ddsi_seqno_t seq);
+static bool whc_ring_borrow_sample (const struct ddsi_whc *whc, ddsi_seqno_t seq, struct ddsi_whc_borrowed_sample *sample);
+static bool whc_ring_borrow_sample_key (const struct ddsi_whc *whc, const struct ddsi_serdata *serdata_key, struct ddsi_whc_borrowed_sample *sample);
+static void whc_ring_return_sample (struct ddsi_whc *whc, struct ddsi_whc_borrowed_sample *sample, bool update_retransmit_info);
+static void whc_ring_sample_iter_init (const struct ddsi_whc *whc, struct ddsi_whc_sample_iter *opaque_it);
+static bool whc_ring_sample_iter_borrow_next (struct ddsi_whc_sample_iter *opaque_it, struct ddsi_whc_borrowed_sample *sample);
+static void whc_ring_free (struct ddsi_whc *whc);
+
+static const struct ddsi_whc_ops whc_ring_ops = {
+  .insert = whc_ring_insert,
+  .remove_acked_messages = whc_ring_remove_acked_messages,
+  .free_deferred_free_list = whc_ring_free_deferred_free_list,
+  .get_state = whc_ring_get_state,
+  .next_seq = whc_ring_next_seq,
+  .borrow_sample = whc_ring_borrow_sample,
+  .borrow_sample_key = whc_ring_borrow_sample_key,
+  .return_sample = whc_ring_return_sample,
+  .sample_iter_init = whc_ring_sample_iter_init,
+  .sample_iter_borrow_next = whc_ring_sample_iter_borrow_next,
+  .free = whc_ring_free
+};
+
+#define TRACE(...) DDS_CLOG (DDS_LC_WHC, &whc->gv->logconfig, __VA_ARGS__)
+
+bool dds_whc_ring_applicable (const struct whc_writer_info *wrinfo)
+{
+  return (wrinfo->writer != NULL && wrinfo->is_keyless && !wrinfo->is_transient_local &&
+          !wrinfo->has_deadline && !wrinfo->has_lifespan);
+}
+
+struct ddsi_whc *dds_whc_ring_new (struct ddsi_domaingv *gv, const struct whc_writer_info *wrinfo)
+{
+  struct whc_ring *whc;
+  assert (dds_whc_ring_applicable (wrinfo));
+  whc = ddsrt_malloc (sizeof (*whc));
+  whc->common.ops = &whc_ring_ops;
+  ddsrt_mutex_init (&whc->lock);
+  whc->gv = gv;
+  whc->hdepth = wrinfo->hdepth;
+  whc->seq_size = 0;
+  whc->unacked_bytes = 0;
+  whc->sample_overhead = 80; /* INFO_TS, DATA (estimate), inline QoS */
+  whc->fragment_size = gv->config.fragment_size;
+  whc->max_drop_seq = 0;
+  whc->min_seq = whc->max_seq = 0;
+  whc->mask = WHC_RING_INITIAL_SIZE - 1;
+  whc->ring = ddsrt_malloc (WHC_RING_INITIAL_SIZE * sizeof (*whc->ring));
+  memset (whc->ring, 0, WHC_RING_INITIAL_SIZE * sizeof (*whc->ring));
+  whc->hist_head = 0;
+  whc->hist_count = 0;
+  whc->hist = (whc->hdepth > 0) ? ddsrt_malloc (whc->hdepth * sizeof (*whc->hist)) : NULL;
+  whc->pool = NULL;
+  return (struct ddsi_whc *) whc;
+}
+
+static void node_unref_serdata (struct whc_ring_node *n)
+{
+  ddsi_serdata_unref (n->serdata);
+  if (n->wire_serdata)
+    ddsi_serdata_unref (n->wire_serdata);
+}
+
+static void whc_ring_free (struct ddsi_whc *whc_generic)
+{
+  struct whc_ring * const whc = (struct whc_ring *) whc_generic;
+  if (whc->seq_size > 0)
+  {
+    for (ddsi_seqno_t seq = whc->min_seq; seq <= whc->max_seq; seq++)
+    {
+      struct whc_ring_node *n = whc->ring[seq & whc->mask];
+      if (n != NULL)
+      {
+        node_unref_serdata (n);
+        ddsrt_free (n);
+      }
+    }
+  }
+  while (whc->pool)
+  {
+    struct whc_ring_node *n = whc->pool;
+    whc->pool = n->next;
+    ddsrt_free (n);
+  }
+  ddsrt_free (whc->hist);
+  ddsrt_free (whc->ring);
+  ddsrt_mutex_destroy (&whc->lock);
+  ddsrt_free (whc);
+}
+
+static struct whc_ring_node *whc_ring_lookup (const struct whc_ring *whc, ddsi_seqno_t seq)
+{
+  if (whc->seq_size == 0 || seq < whc->min_seq || seq > whc->max_seq)
+    return NULL;
+  struct whc_ring_node * const n = whc->ring[seq & whc->mask];
+  assert (n == NULL || n->common.seq == seq);
+  return n;
+}
+
+static void get_state_locked (const struct whc_ring *whc, struct ddsi_whc_state *st)
+{
+  if (whc->seq_size == 0)
+  {
+    st->min_seq = st->max_seq = 0;
+    st->unacked_bytes = 0;
+  }
+  else
+  {
+    st->min_seq = whc->min_seq;
+    st->max_seq = whc->max_seq;
+    st->unacked_bytes = whc->unacked_bytes;
+  }
+}
+
+static void whc_ring_get_state (const struct ddsi_whc *whc_generic, struct ddsi_whc_state *st)
+{
+  const struct whc_ring * const whc = (const struct whc_ring *) whc_generic;
+  ddsrt_mutex_lock ((ddsrt_mutex_t *) &whc->lock);
+  get_state_locked (whc, st);
+  ddsrt_mutex_unlock ((ddsrt_mutex_t *) &whc->lock);
+}
+
+static struct whc_ring_node *find_nextseq (const struct whc_ring *whc, ddsi_seqno_t seq)
+{
+  /* holes only occur when KEEP_LAST pushes samples out of the history while older ones
+     are still unacknowledged, so in practice this loop rarely iterates */
+  if (whc->seq_size == 0 || seq >= whc->max_seq)
+    return NULL;
+  if (seq < whc->min_seq)
+    seq = whc->min_seq;
+  else
+    seq++;
+  struct whc_ring_node *n;
+  while ((n = whc->ring[seq & whc->mask]) == NULL)
+  {
+    assert (seq < whc->max_seq);
+    seq++;
+  }
+  return n;
+}
+
+static ddsi_seqno_t whc_ring_next_seq (const struct ddsi_whc *whc_generic, ddsi_seqno_t seq)
+{
+  const struct whc_ring * const whc = (const struct whc_ring *) whc_generic;
+  struct whc_ring_node *n;
+  ddsi_seqno_t nseq;
+  ddsrt_mutex_lock ((ddsrt_mutex_t *) &whc->lock);
+  if ((n = find_nextseq (whc, seq)) == NULL)
+    nseq = DDSI_MAX_SEQ_NUMBER;
+  else
+    nseq = n->common.seq;
+  ddsrt_mutex_unlock ((ddsrt_mutex_t *) &whc->lock);
+  return nseq;
+}
+
+static void whc_ring_grow (struct whc_ring *whc, ddsi_seqno_t seq)
+{
+  /* ring must be able to hold [min_seq,seq] */
+  uint32_t size = whc->mask + 1;
+  while (seq - whc->min_seq >= size)
+    size *= 2;
+  TRACE ("  grow ring %"PRIu32" -> %"PRIu32"\n", whc->mask + 1, size);
+  struct whc_ring_node **ring = ddsrt_malloc (size * sizeof (*ring));
+  memset (ring, 0, size * sizeof (*ring));
+  for (ddsi_seqno_t s = whc->min_seq; s <= whc->max_seq; s++)
+    ring[s & (size - 1)] = whc->ring[s & whc->mask];
+  ddsrt_free (whc->ring);
+  whc->ring = ring;
+  whc->mask = size - 1;
+}
+
+static void unlink_node (struct whc_ring *whc, struct whc_ring_node *n)
+{
+  /* removes n from the ring and updates the bookkeeping, but leaves it to the caller to
+     free it */
+  assert (whc->ring[n->common.seq & whc->mask] == n);
+  whc->ring[n->common.seq & whc->mask] = NULL;
+  if (n->unacked)
+  {
+    assert (whc->unacked_bytes >= n->size);
+    whc->unacked_bytes -= n->size;
+    n->unacked = 0;
+  }
+  if (--whc->seq_size == 0)
+    whc->min_seq = whc->max_seq = 0;
+  else if (n->common.seq == whc->min_seq)
+  {
+    do {
+      whc->min_seq++;
+    } while (whc->ring[whc->min_seq & whc->mask] == NULL);
+  }
+  else if (n->common.seq == whc->max_seq)
+  {
+    do {
+      whc->max_seq--;
+    } while (whc->ring[whc->max_seq & whc->mask] == NULL);
+  }
+}
+
+static void delete_one (struct whc_ring *whc, struct whc_ring_node *n)
+{
+  /* for use with the lock held, so only for (rare) pruning because of KEEP_LAST or
+     unregistering the instance */
+  TRACE (" del %"PRIu64, n->common.seq);
+  unlink_node (whc, n);
+  if (!n->borrowed)
+    node_unref_serdata (n);
+  n->next = whc->pool;
+  whc->pool = n;
+}
+
+static size_t node_size (const struct whc_ring *whc, const struct whc_ring_node *n)
+{
+  size_t sz = ddsi_serdata_size (n->serdata);
+  return sz + ((sz + whc->fragment_size - 1) / whc->fragment_size) * whc->sample_overhead;
+}
+
+static int whc_ring_insert (struct ddsi_whc *whc_generic, ddsi_seqno_t max_drop_seq, ddsi_seqno_t seq, ddsrt_mtime_t exp, struct ddsi_serdata *serdata, struct ddsi_serdata *wire_serdata, struct ddsi_tkmap_instance *tk)
+{
+  struct whc_ring * const whc = (struct whc_ring *) whc_generic;
+  struct whc_ring_node *newn;
+  DDSRT_UNUSED_ARG (exp);
+  DDSRT_UNUSED_ARG (tk);
+
+  ddsrt_mutex_lock (&whc->lock);
+  TRACE ("whc_ring_insert(%p max_drop_seq %"PRIu64" seq %"PRIu64" serdata %p)", (void *) whc, max_drop_seq, seq, (void *) serdata);
+  assert (max_drop_seq < DDSI_MAX_SEQ_NUMBER);
+  assert (max_drop_seq >= whc->max_drop_seq);
+  assert (whc->seq_size == 0 || seq > whc->max_seq);
+
+  if ((newn = whc->pool) != NULL)
+    whc->pool = newn->next;
+  else
+    newn = ddsrt_malloc (sizeof (*newn));
+  newn->common.seq = seq;
+  newn->next = NULL;
+  newn->unacked = (seq > max_drop_seq);
+  newn->borrowed = 0;
+  newn->last_rexmit_ts.v = 0;
+  newn->rexmit_count = 0;
+  newn->serdata = ddsi_serdata_ref (serdata);
+  newn->wire_serdata = (wire_serdata != serdata) ? ddsi_serdata_ref (wire_serdata) : NULL;
+  newn->size = node_size (whc, newn);
+  if (newn->unacked)
+    whc->unacked_bytes += newn->size;
+
+  if (whc->seq_size == 0)
+    whc->min_seq = seq;
+  else if (seq - whc->min_seq > whc->mask)
+    whc_ring_grow (whc, seq);
+  whc->max_seq = seq;
+  whc->ring[seq & whc->mask] = newn;
+  whc->seq_size++;
+
+  if (serdata->kind == SDK_EMPTY)
+  {
+    /* nothing to do for the instance */
+  }
+  else if (serdata->statusinfo & DDSI_STATUSINFO_UNREGISTER)
+  {
+    /* instance goes away: samples in its history that have been acknowledged already
+       go with it, unacknowledged ones remain until they have been acknowledged */
+    TRACE (" unreg");
+    for (uint32_t i = 0, idx = whc->hist_head; i < whc->hist_count; i++)
+    {
+      struct whc_ring_node *oldn;
+      if ((oldn = whc_ring_lookup (whc, whc->hist[idx])) != NULL && oldn->common.seq <= max_drop_seq)
+        delete_one (whc, oldn);
+      idx = (idx == 0) ? whc->hdepth - 1 : idx - 1;
+    }
+    whc->hist_count = 0;
+    if (seq <= max_drop_seq)
+      delete_one (whc, newn);
+  }
+  else if (whc->hdepth > 0)
+  {
+    /* KEEP_LAST: the sample that was hdepth samples ago (if still present) gets pushed
+       out, regardless of whether it has been acknowledged */
+    if (++whc->hist_head == whc->hdepth)
+      whc->hist_head = 0;
+    if (whc->hist_count < whc->hdepth)
+      whc->hist_count++;
+    else
+    {
+      struct whc_ring_node *oldn;
+      if ((oldn = whc_ring_lookup (whc, whc->hist[whc->hist_head])) != NULL)
+        delete_one (whc, oldn);
+    }
+    whc->hist[whc->hist_head] = seq;
+  }
+  TRACE ("\n");
+  ddsrt_mutex_unlock (&whc->lock);
+  return 0;
+}
+
+static uint32_t whc_ring_remove_acked_messages (struct ddsi_whc *whc_generic, ddsi_seqno_t max_drop_seq, struct ddsi_whc_state *whcst, struct ddsi_whc_node **deferred_free_list)
+{
+  struct whc_ring * const whc = (struct whc_ring *) whc_generic;
+  struct whc_ring_node head, *tail = &head;
+  uint32_t ndropped = 0;
+
+  ddsrt_mutex_lock (&whc->lock);
+  assert (max_drop_seq < DDSI_MAX_SEQ_NUMBER);
+  assert (max_drop_seq >= whc->max_drop_seq);
+  TRACE ("whc_ring_remove_acked_messages(%p max_drop_seq %"PRIu64")\n", (void *) whc, max_drop_seq);
+
+  head.next = NULL;
+  while (whc->seq_size > 0 && whc->min_seq <= max_drop_seq)
+  {
+    struct whc_ring_node * const n = whc->ring[whc->min_seq & whc->mask];
+    assert (n != NULL && n->common.seq == whc->min_seq);
+    unlink_node (whc, n);
+    tail->next = n;
+    tail = n;
+    ndropped++;
+  }
+  tail->next = NULL;
+  whc->max_drop_seq = max_drop_seq;
+  *deferred_free_list = (struct ddsi_whc_node *) head.next;
+  get_state_locked (whc, whcst);
+  ddsrt_mutex_unlock (&whc->lock);
+  return ndropped;
+}
+
+static void whc_ring_free_deferred_free_list (struct ddsi_whc *whc_generic, struct ddsi_whc_node *deferred_free_list)
+{
+  struct whc_ring * const whc = (struct whc_ring *) whc_generic;
+  struct whc_ring_node *first = (struct whc_ring_node *) deferred_free_list, *last = NULL;
+  if (first == NULL)
+    return;
+  /* dropping the references to the serdata is the expensive bit, do that without
+     holding the lock, then return the nodes to the pool in one go */
+  for (struct whc_ring_node *n = first; n; last = n, n = n->next)
+  {
+    if (!n->borrowed)
+      node_unref_serdata (n);
+  }
+  ddsrt_mutex_lock (&whc->lock);
+  last->next = whc->pool;
+  whc->pool = first;
+  ddsrt_mutex_unlock (&whc->lock);
+}
+
+static void make_borrowed_sample (struct ddsi_whc_borrowed_sample *sample, struct whc_ring_node *n)
+{
+  assert (!n->borrowed);
+  n->borrowed = 1;
+  sample->seq = n->common.seq;
+  sample->serdata = n->serdata;
+  sample->wire_serdata = n->wire_serdata ? n->wire_serdata : n->serdata;
+  sample->unacked = n->unacked;
+  sample->rexmit_count = n->rexmit_count;
+  sample->last_rexmit_ts = n->last_rexmit_ts;
+}
+
+static bool whc_ring_borrow_sample (const struct ddsi_whc *whc_generic, ddsi_seqno_t seq, struct ddsi_whc_borrowed_sample *sample)
+{
+  const struct whc_ring * const whc = (const struct whc_ring *) whc_generic;
+  struct whc_ring_node *n;
+  bool found;
+  ddsrt_mutex_lock ((ddsrt_mutex_t *) &whc->lock);
+  if ((n = whc_ring_lookup (whc, seq)) == NULL)
+    found = false;
+  else
+  {
+    make_borrowed_sample (sample, n);
+    found = true;
+  }
+  ddsrt_mutex_unlock ((ddsrt_mutex_t *) &whc->lock);
+  return found;
+}
+
+static bool whc_ring_borrow_sample_key (const struct ddsi_whc *whc_generic, const struct ddsi_serdata *serdata_key, struct ddsi_whc_borrowed_sample *sample)
+{
+  /* there is only one instance, so the key doesn't matter, the latest sample in
+     its history does; only KEEP_LAST maintains that history */
+  const struct whc_ring * const whc = (const struct whc_ring *) whc_generic;
+  struct whc_ring_node *n;
+  bool found;
+  DDSRT_UNUSED_ARG (serdata_key);
+  ddsrt_mutex_lock ((ddsrt_mutex_t *) &whc->lock);
+  if (whc->hist_count == 0 || (n = whc_ring_lookup (whc, whc->hist[whc->hist_head])) == NULL)
+    found = false;
+  else
+  {
+    make_borrowed_sample (sample, n);
+    found = true;
+  }
+  ddsrt_mutex_unlock ((ddsrt_mutex_t *) &whc->lock);
+  return found;
+}
+
+static void return_sample_locked (struct whc_ring *whc, struct ddsi_whc_borrowed_sample *sample, bool update_retransmit_info)
+{
+  struct whc_ring_node *n;
+  if ((n = whc_ring_lookup (whc, sample->seq)) == NULL)
+  {
+    /* data no longer present in WHC */
+    ddsi_serdata_unref (sample->serdata);
+    if (sample->wire_serdata != sample->serdata)
+      ddsi_serdata_unref (sample->wire_serdata);
+  }
+  else
+  {
+    assert (n->borrowed);
+    n->borrowed = 0;
+    if (update_retransmit_info)
+    {
+      n->rexmit_count = sample->rexmit_count;
+      n->last_rexmit_ts = sample->last_rexmit_ts;
+    }
+  }
+}
+
+static void whc_ring_return_sample (struct ddsi_whc *whc_generic, struct ddsi_whc_borrowed_sample *sample, bool update_retransmit_info)
+{
+  struct whc_ring * const whc = (struct whc_ring *) whc_generic;
+  ddsrt_mutex_lock (&whc->lock);
+  return_sample_locked (whc, sample, update_retransmit_info);
+  ddsrt_mutex_unlock (&whc->lock);
+}
+
+static void whc_ring_sample_iter_init (const struct ddsi_whc *whc_generic, struct ddsi_whc_sample_iter *opaque_it)
+{
+  struct ddsi_whc_sample_iter_ring *it = (struct ddsi_whc_sample_iter_ring *) opaque_it;
+  it->c.whc = (struct ddsi_whc *) whc_generic;
+  it->first = true;
+}
+
+static bool whc_ring_sample_iter_borrow_next (struct ddsi_whc_sample_iter *opaque_it, struct ddsi_whc_borrowed_sample *sample)
+{
+  struct ddsi_whc_sample_iter_ring * const it = (struct ddsi_whc_sample_iter_ring *) opaque_it;
+  struct whc_ring * const whc = (struct whc_ring *) it->c.whc;
+  struct whc_ring_node *n;
+  ddsi_seqno_t seq;
+  bool valid;
+  ddsrt_mutex_lock (&whc->lock);
+  if (!it->first)
+  {
+    seq = sample->seq;
+    return_sample_locked (whc, sample, false);
+  }
+  else
+  {
+    it->first = false;
+    seq = 0;
+  }
+  if ((n = find_nextseq (whc, seq)) == NULL)
+    valid = false;
+  else
+  {
+    make_borrowed_sample (sample, n);
+    valid = true;
+  }
+  ddsrt_mutex_unlock (&whc->lock);
+  return valid;
+}
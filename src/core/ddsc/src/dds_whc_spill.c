@@ -0,0 +1,237 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include <assert.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include "dds/ddsrt/heap.h"
+#include "dds/ddsrt/io.h"
+#include "dds/ddsrt/atomics.h"
+#include "dds/ddsrt/misc.h"
+#include "dds/ddsrt/process.h"
+#include "dds/ddsrt/filesystem.h"
+#include "dds/ddsi/ddsi_domaingv.h"
+#include "dds__whc_spill.h"
+
+/* Don't bother moving data around unless it frees up at least this much */
+#define SPILL_COMPACT_MIN 1048576
+
+/* Maximum amount of data moved by a single compaction step */
+#define SPILL_COMPACT_STEP 1048576
+
+struct dds_whc_spill {
+  struct ddsi_domaingv *gv;
+  FILE *fp;
+  char *name; /* NULL if anonymous */
+  uint64_t end; /* offset at which the next record gets written */
+  uint64_t live; /* total size of the records in the file */
+  struct dds_whc_spill_rec *first, *last;
+  void *buf; /* bounce buffer for compacting */
+  size_t bufsize;
+};
+
+static ddsrt_atomic_uint32_t spill_file_seq = DDSRT_ATOMIC_UINT32_INIT (0);
+
+struct dds_whc_spill *dds_whc_spill_new (struct ddsi_domaingv *gv)
+{
+  const char *dir = gv->config.whc_spill_directory;
+  char *name = NULL;
+  FILE *fp;
+  DDSRT_WARNING_MSVC_OFF (4996);
+  if (dir == NULL || *dir == 0)
+    fp = tmpfile ();
+  else
+  {
+#ifdef DDSRT_HAVE_FILESYSTEM
+    const char *sep = ddsrt_file_sep ();
+#else
+    const char *sep = "/";
+#endif
+    (void) ddsrt_asprintf (&name, "%s%scyclonedds-whc-%"PRIdPID"-%"PRIu32".spill", dir, sep, ddsrt_getpid (), ddsrt_atomic_inc32_nv (&spill_file_seq));
+    fp = fopen (name, "w+b");
+  }
+  DDSRT_WARNING_MSVC_ON (4996);
+  if (fp == NULL)
+  {
+    DDS_CWARNING (&gv->logconfig, "whc: could not create spill file %s, keeping all history in memory\n", name ? name : "(anonymous)");
+    ddsrt_free (name);
+    return NULL;
+  }
+  struct dds_whc_spill *sp = ddsrt_malloc (sizeof (*sp));
+  sp->gv = gv;
+  sp->fp = fp;
+  sp->name = name;
+  sp->end = 0;
+  sp->live = 0;
+  sp->first = sp->last = NULL;
+  sp->buf = NULL;
+  sp->bufsize = 0;
+  return sp;
+}
+
+void dds_whc_spill_free (struct dds_whc_spill *sp)
+{
+  /* records are owned by the WHC nodes, it frees them with the nodes */
+  fclose (sp->fp);
+  if (sp->name)
+  {
+    (void) remove (sp->name);
+    ddsrt_free (sp->name);
+  }
+  ddsrt_free (sp->buf);
+  ddsrt_free (sp);
+}
+
+bool dds_whc_spill_supported (const struct ddsi_serdata *serdata)
+{
+#ifdef DDS_HAS_SHM
+  if (serdata->iox_chunk != NULL)
+    return false;
+#endif
+  return serdata->kind == SDK_DATA && serdata->ops->from_ser_iov != 0;
+}
+
+static bool spill_seek (struct dds_whc_spill *sp, uint64_t off)
+{
+  if (off > LONG_MAX)
+    return false;
+  return fseek (sp->fp, (long) off, SEEK_SET) == 0;
+}
+
+static bool spill_pwrite (struct dds_whc_spill *sp, uint64_t off, const void *buf, size_t size)
+{
+  return spill_seek (sp, off) && fwrite (buf, 1, size, sp->fp) == size;
+}
+
+static bool spill_pread (struct dds_whc_spill *sp, uint64_t off, void *buf, size_t size)
+{
+  return spill_seek (sp, off) && fread (buf, 1, size, sp->fp) == size;
+}
+
+struct dds_whc_spill_rec *dds_whc_spill_write (struct dds_whc_spill *sp, const struct ddsi_serdata *serdata)
+{
+  assert (dds_whc_spill_supported (serdata));
+  const uint32_t size = ddsi_serdata_size (serdata);
+  if (sp->end + size > LONG_MAX)
+    return NULL;
+
+  ddsrt_iovec_t iov;
+  struct ddsi_serdata * const ref = ddsi_serdata_to_ser_ref (serdata, 0, size, &iov);
+  if (ref == NULL || iov.iov_len < size)
+  {
+    DDS_CWARNING (&sp->gv->logconfig, "whc: serialised form of sample is not contiguous, not spilling it\n");
+    if (ref)
+      ddsi_serdata_to_ser_unref (ref, &iov);
+    return NULL;
+  }
+  const bool ok = spill_pwrite (sp, sp->end, iov.iov_base, size);
+  ddsi_serdata_to_ser_unref (ref, &iov);
+  if (!ok)
+  {
+    DDS_CWARNING (&sp->gv->logconfig, "whc: writing to spill file failed\n");
+    return NULL;
+  }
+
+  struct dds_whc_spill_rec *rec = ddsrt_malloc (sizeof (*rec));
+  rec->off = sp->end;
+  rec->size = size;
+  rec->statusinfo = serdata->statusinfo;
+  rec->timestamp = serdata->timestamp;
+  rec->twrite = serdata->twrite;
+  rec->type = serdata->type;
+  rec->next = NULL;
+  if ((rec->prev = sp->last) != NULL)
+    sp->last->next = rec;
+  else
+    sp->first = rec;
+  sp->last = rec;
+  sp->end += size;
+  sp->live += size;
+  return rec;
+}
+
+struct ddsi_serdata *dds_whc_spill_read (struct dds_whc_spill *sp, const struct dds_whc_spill_rec *rec)
+{
+  struct ddsi_serdata *sd = NULL;
+  ddsrt_iovec_t iov;
+  iov.iov_base = ddsrt_malloc (rec->size);
+  iov.iov_len = (ddsrt_iov_len_t) rec->size;
+  if (!spill_pread (sp, rec->off, iov.iov_base, rec->size))
+    DDS_CWARNING (&sp->gv->logconfig, "whc: reading from spill file failed\n");
+  else if ((sd = ddsi_serdata_from_ser_iov (rec->type, SDK_DATA, 1, &iov, rec->size)) != NULL)
+  {
+    sd->statusinfo = rec->statusinfo;
+    sd->timestamp = rec->timestamp;
+    sd->twrite = rec->twrite;
+  }
+  ddsrt_free (iov.iov_base);
+  return sd;
+}
+
+bool dds_whc_spill_compact_needed (const struct dds_whc_spill *sp)
+{
+  return sp->end - sp->live > sp->live && sp->end - sp->live >= SPILL_COMPACT_MIN;
+}
+
+bool dds_whc_spill_compact (struct dds_whc_spill *sp)
+{
+  /* Records are in order of offset, so moving each one to the end of the preceding one
+     never overwrites data that is still needed.  Records that have been moved already
+     are contiguous from the start of the file, so a step simply skips over them.  If an
+     I/O error occurs, the records that haven't been moved are still where they were and
+     we simply stop. */
+  uint64_t cursor = 0;
+  size_t moved = 0;
+  for (struct dds_whc_spill_rec *rec = sp->first; rec; rec = rec->next)
+  {
+    if (rec->off != cursor)
+    {
+      if (moved >= SPILL_COMPACT_STEP)
+        return true;
+      if (rec->size > sp->bufsize)
+      {
+        sp->buf = ddsrt_realloc (sp->buf, rec->size);
+        sp->bufsize = rec->size;
+      }
+      if (!spill_pread (sp, rec->off, sp->buf, rec->size) || !spill_pwrite (sp, cursor, sp->buf, rec->size))
+      {
+        DDS_CWARNING (&sp->gv->logconfig, "whc: compacting spill file failed\n");
+        return false;
+      }
+      rec->off = cursor;
+      moved += rec->size;
+    }
+    cursor += rec->size;
+  }
+  sp->end = cursor;
+  return false;
+}
+
+void dds_whc_spill_drop (struct dds_whc_spill *sp, struct dds_whc_spill_rec *rec)
+{
+  if (rec->prev)
+    rec->prev->next = rec->next;
+  else
+    sp->first = rec->next;
+  if (rec->next)
+    rec->next->prev = rec->prev;
+  else
+    sp->last = rec->prev;
+  assert (sp->live >= rec->size);
+  sp->live -= rec->size;
+  ddsrt_free (rec);
+
+  if (sp->first == NULL)
+    sp->end = 0;
+  else if (sp->last->off + sp->last->size < sp->end)
+    sp->end = sp->last->off + sp->last->size;
+}
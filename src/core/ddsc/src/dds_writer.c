@@ -485,6 +485,10 @@ dds_entity_t dds_create_writer (dds_entity_t participant_or_publisher, dds_entit
   wr->m_entity.m_iid = ddsi_get_entity_instanceid (&wr->m_entity.m_domain->gv, &wr->m_entity.m_guid);
   dds_entity_register_child (&pub->m_entity, &wr->m_entity);
 
+  /* republish whatever a previous incarnation of a persistent writer left behind before
+     the application gets a chance to write anything */
+  dds_whc_persistent_recover (wr->m_whc, wr);
+
   dds_entity_init_complete (&wr->m_entity);
 
   dds_topic_allow_set_qos (tp);
@@ -21,9 +21,11 @@
 #include "dds/ddsc/dds_public_impl.h"
 #include "dds/cdr/dds_cdrstream.h"
 #include "dds__topic.h"
+#include "dds__cdrstream_simd.h"
 #include "test_util.h"
 #include "MinXcdrVersion.h"
 #include "CdrStreamOptimize.h"
+#include "Serializers.h"
 
 #define DDS_DOMAINID1 0
 #define DDS_DOMAINID2 1
@@ -1787,6 +1789,7 @@ CU_Theory ((const char *descr, const dds_topic_descriptor_t *desc1, const dds_to
     is.m_index = 0;
     is.m_size = os.m_size;
     is.m_xcdr_version = DDSI_RTPS_CDR_ENC_VERSION_2;
+    is.m_allocator = NULL;
 
     struct dds_cdrstream_desc desc_rd;
     memset (&desc_rd, 0, sizeof (desc_rd));
@@ -1900,5 +1903,572 @@ CU_Test (ddsc_cdrstream, check_optimize)
 }
 #undef D
 
+static void *serializers_sample_t1 (void)
+{
+  static Serializers_t1 s = { .id = 1, .c = 'x', .b = true, .d = 2.5, .name = "name", .e = Serializers_E_3,
+    .em = Serializers_EM_4, .bstr = "abc", .sh = -3, .ek = Serializers_ES_2 };
+  return &s;
+}
+
+static void *serializers_sample_t2 (void)
+{
+  static Serializers_n1 n1[3] = { { 1, "n1-1", -1 }, { 2, NULL, 1 << 30 }, { 3, "", INT64_MAX } };
+  static Serializers_n2 n2[2] = {
+    { .a = { { 4, "a", 5 }, { 6, "b", 7 } }, .bs = { 2, 2, n1, false }, .es = Serializers_ES_2 },
+    { .a = { { 8, "c", 9 }, { 10, "d", 11 } }, .bs = { 0, 0, NULL, false }, .es = Serializers_ES_1 }
+  };
+  static uint8_t so[5] = { 1, 2, 3, 4, 5 };
+  static int64_t sll[2] = { -1, 1 };
+  static int16_t ss[3] = { 1, -2, 3 };
+  static bool sb[3] = { true, false, true };
+  static Serializers_en_medium se[2] = { Serializers_EM_2, Serializers_EM_3 };
+  static char *sstr[3] = { "x", "yy", "zzz" };
+  static char sbstr[2][5] = { "abcd", "" };
+  static Serializers_t2 s = {
+    .o = 1,
+    .n = { .a = { { 1, "a1", 2 }, { 3, "a2", 4 } }, .bs = { 3, 3, n1, false }, .es = Serializers_ES_2 },
+    .k1 = 123456789012345,
+    .l = { 1, 2, 3 },
+    .la = { { 1, 2, 3 }, { 4, 5, 6 } },
+    .ba = { true, false, true },
+    .ea = { Serializers_E_2, Serializers_E_3 },
+    .sa = { "sa1", NULL },
+    .bsa = { "abc", "d" },
+    .na = { { 5, "na1", 6 }, { 7, "na2", 8 } },
+    .so = { 5, 5, so, false },
+    .sll = { 2, 2, sll, false },
+    .ss = { 3, 3, ss, false },
+    .sb = { 3, 3, sb, false },
+    .se = { 2, 2, se, false },
+    .sstr = { 3, 3, sstr, false },
+    .sbstr = { 2, 2, sbstr, false },
+    .sn = { 3, 3, n1, false },
+    .sn2 = { 2, 2, n2, false },
+    .k2 = "key2"
+  };
+  return &s;
+}
+
+static void *serializers_sample_t3 (void)
+{
+  static double sd[2] = { 1.5, -2.5 };
+  static Serializers_t3 s = { .l = 3, .sd = { 2, 2, sd, false } };
+  return &s;
+}
+
+static void *serializers_sample_t5 (void)
+{
+  static Serializers_t5 s = { .k = { 1, "k", 2 }, .l = 3 };
+  return &s;
+}
+
+static void *serializers_sample_t6 (void)
+{
+  static Serializers_t6 s = { .a = 1, .x = 2, .b = "b", .c = 3 };
+  return &s;
+}
+
+static void serializers_check_stream_eq (const dds_ostream_t *os1, const dds_ostream_t *os2)
+{
+  CU_ASSERT_EQUAL_FATAL (os1->m_index, os2->m_index);
+  CU_ASSERT_FATAL (memcmp (os1->m_buffer, os2->m_buffer, os1->m_index) == 0);
+}
+
+#define D(n) (&Serializers_ ## n ## _desc)
+#define S(n) (serializers_sample_ ## n)
+CU_Test (ddsc_cdrstream, generated_serializers)
+{
+  static const struct {
+    const dds_topic_descriptor_t *desc;
+    sample_init sample_init_fn;
+  } tests[] = {
+    { D(t1), S(t1) }, { D(t2), S(t2) }, { D(t3), S(t3) }, { D(t5), S(t5) }, { D(t6), S(t6) }
+  };
+
+  CU_ASSERT_FATAL (!(Serializers_t4_desc.m_flagset & DDS_TOPIC_SERIALIZERS));
+  CU_ASSERT_FATAL (Serializers_t5_desc.serializers->write_key == NULL);
+  for (uint32_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+  {
+    struct dds_cdrstream_desc desc_gen, desc_interp;
+    dds_cdrstream_desc_from_topic_desc (&desc_gen, tests[i].desc);
+    CU_ASSERT_FATAL (desc_gen.serializers != NULL);
+    desc_interp = desc_gen;
+    desc_interp.serializers = NULL;
+    const dds_topic_serializers_t *ser = desc_gen.serializers;
+    void *sample = tests[i].sample_init_fn ();
+
+    for (uint32_t v = 0; v < 2; v++)
+    {
+      const uint32_t xcdrv = v ? XCDR2 : XCDR1;
+      printf ("running test for desc %s, xcdr version %"PRIu32"\n", tests[i].desc->m_typename, xcdrv);
+
+      /* serialized data is identical */
+      dds_ostream_t os_gen, os_interp;
+      dds_ostream_init (&os_gen, 0, xcdrv);
+      dds_ostream_init (&os_interp, 0, xcdrv);
+      CU_ASSERT_FATAL (dds_stream_write_sample (&os_gen, sample, &desc_gen));
+      CU_ASSERT_FATAL (dds_stream_write_sample (&os_interp, sample, &desc_interp));
+      serializers_check_stream_eq (&os_gen, &os_interp);
+
+      /* normalizing accepts the native and byte-swapped data, and rejects truncated data */
+      const uint32_t sz = os_gen.m_index;
+      uint32_t actual_sz;
+      char *data = ddsrt_memdup (os_gen.m_buffer, sz);
+      CU_ASSERT_FATAL (dds_stream_normalize (data, sz, false, xcdrv, &desc_gen, false, &actual_sz));
+      CU_ASSERT_EQUAL_FATAL (actual_sz, sz);
+      CU_ASSERT_FATAL (memcmp (data, os_gen.m_buffer, sz) == 0);
+      CU_ASSERT_FATAL (!dds_stream_normalize (data, sz - 1, false, xcdrv, &desc_gen, false, &actual_sz));
+      ddsrt_free (data);
+
+      dds_ostreamBE_t os_be;
+      dds_ostreamBE_init (&os_be, 0, xcdrv);
+      CU_ASSERT_FATAL (dds_stream_write_sampleBE (&os_be, sample, &desc_interp));
+      CU_ASSERT_EQUAL_FATAL (os_be.x.m_index, sz);
+      CU_ASSERT_FATAL (dds_stream_normalize (os_be.x.m_buffer, sz, (DDSRT_ENDIAN == DDSRT_LITTLE_ENDIAN), xcdrv, &desc_gen, false, &actual_sz));
+      CU_ASSERT_FATAL (memcmp (os_be.x.m_buffer, os_gen.m_buffer, sz) == 0);
+      dds_ostreamBE_fini (&os_be);
+
+      /* read sample serializes to the same data */
+      dds_istream_t is;
+      dds_istream_init (&is, sz, os_gen.m_buffer, xcdrv);
+      void *sample_rd = ddsrt_calloc (1, desc_gen.size);
+      dds_stream_read_sample (&is, sample_rd, &desc_gen);
+      CU_ASSERT_EQUAL_FATAL (is.m_index, sz);
+      dds_ostream_t os_rd;
+      dds_ostream_init (&os_rd, 0, xcdrv);
+      CU_ASSERT_FATAL (dds_stream_write_sample (&os_rd, sample_rd, &desc_interp));
+      serializers_check_stream_eq (&os_rd, &os_interp);
+      dds_ostream_fini (&os_rd);
+
+      /* reading into the previous sample reuses its memory */
+      is.m_index = 0;
+      dds_stream_read_sample (&is, sample_rd, &desc_gen);
+      dds_ostream_init (&os_rd, 0, xcdrv);
+      CU_ASSERT_FATAL (dds_stream_write_sample (&os_rd, sample_rd, &desc_interp));
+      serializers_check_stream_eq (&os_rd, &os_interp);
+      dds_ostream_fini (&os_rd);
+      dds_stream_free_sample (sample_rd, desc_gen.ops.ops);
+      ddsrt_free (sample_rd);
+
+      /* key from sample and from data matches the interpreter, keys are
+         always in XCDR2 format but extracting from data supports both */
+      if (ser->write_key)
+      {
+        for (uint32_t kv = 0; kv < 2; kv++)
+        {
+          dds_ostream_t os_key_data, os_key_interp;
+          dds_ostream_init (&os_key_data, 0, kv ? XCDR2 : XCDR1);
+          dds_ostream_init (&os_key_interp, 0, kv ? XCDR2 : XCDR1);
+          is.m_index = 0;
+          CU_ASSERT_FATAL (ser->extract_key_from_data (&is, &os_key_data));
+          is.m_index = 0;
+          CU_ASSERT_FATAL (dds_stream_extract_key_from_data (&is, &os_key_interp, &desc_interp));
+          serializers_check_stream_eq (&os_key_data, &os_key_interp);
+          if (kv)
+          {
+            dds_ostream_t os_key_gen;
+            dds_ostream_init (&os_key_gen, 0, XCDR2);
+            ser->write_key (&os_key_gen, sample);
+            serializers_check_stream_eq (&os_key_gen, &os_key_interp);
+            dds_ostream_fini (&os_key_gen);
+          }
+          dds_ostream_fini (&os_key_data);
+          dds_ostream_fini (&os_key_interp);
+        }
+      }
+
+      dds_istream_fini (&is);
+      dds_ostream_fini (&os_gen);
+      dds_ostream_fini (&os_interp);
+    }
+    dds_cdrstream_desc_fini (&desc_gen);
+  }
+
+  /* invalid values are rejected */
+  Serializers_t1 t1 = *(Serializers_t1 *) serializers_sample_t1 ();
+  memset (&t1.b, 2, sizeof (t1.b));
+  struct dds_cdrstream_desc desc;
+  dds_cdrstream_desc_from_topic_desc (&desc, D(t1));
+  dds_ostream_t os;
+  dds_ostream_init (&os, 0, XCDR2);
+  CU_ASSERT_FATAL (!dds_stream_write_sample (&os, &t1, &desc));
+  dds_ostream_fini (&os);
+  dds_cdrstream_desc_fini (&desc);
+}
+
+CU_Test (ddsc_cdrstream, generated_serializers_write_read, .init = cdrstream_init, .fini = cdrstream_fini)
+{
+  entity_init (D(t2), DDS_DATA_REPRESENTATION_XCDR2, false);
+  void *msg = serializers_sample_t2 ();
+  dds_return_t ret = dds_write (wr, msg);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+
+  void *rds[1] = { NULL };
+  dds_sample_info_t si[1];
+  while ((ret = dds_take (rd, rds, si, 1, 1)) == 0)
+    dds_sleepfor (DDS_MSECS (10));
+  CU_ASSERT_EQUAL_FATAL (ret, 1);
+
+  struct dds_cdrstream_desc desc;
+  dds_cdrstream_desc_from_topic_desc (&desc, D(t2));
+  desc.serializers = NULL;
+  dds_ostream_t os_wr, os_rd;
+  dds_ostream_init (&os_wr, 0, XCDR2);
+  dds_ostream_init (&os_rd, 0, XCDR2);
+  CU_ASSERT_FATAL (dds_stream_write_sample (&os_wr, msg, &desc));
+  CU_ASSERT_FATAL (dds_stream_write_sample (&os_rd, rds[0], &desc));
+  serializers_check_stream_eq (&os_wr, &os_rd);
+  dds_ostream_fini (&os_wr);
+  dds_ostream_fini (&os_rd);
+  dds_cdrstream_desc_fini (&desc);
+  dds_return_loan (rd, rds, 1);
+}
+
+static void *serializers_sample_t7 (void)
+{
+  static int32_t sl[3] = { 1, -2, 3 };
+  static int32_t ol = 4;
+  static Serializers_t7 s = {
+    .a = 1, .b = -1, .c = { 2, 3, 4, 5 }, .s = "string", .d1 = 1.5, .d2 = -2.5, .n = { 6, 7 },
+    .sl = { 3, 3, sl, false }, .o = { 8, 9, 10 }, .p = 11, .ol = &ol
+  };
+  return &s;
+}
+
+CU_Test (ddsc_cdrstream, copy_plan)
+{
+  static const struct {
+    const dds_topic_descriptor_t *desc;
+    sample_init sample_init_fn;
+    uint32_t nsteps;
+  } tests[] = {
+    { D(t2), S(t2), 0 }, { D(t7), S(t7), 7 }
+  };
+
+  /* no plan if none of the members can be combined */
+  struct dds_cdrstream_desc desc_t1;
+  dds_cdrstream_desc_from_topic_desc (&desc_t1, D(t1));
+  CU_ASSERT_FATAL (dds_stream_compile_copy_plan (&desc_t1) == NULL);
+  dds_cdrstream_desc_fini (&desc_t1);
+
+  for (uint32_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+  {
+    struct dds_cdrstream_desc desc_plan, desc_interp;
+    dds_cdrstream_desc_from_topic_desc (&desc_plan, tests[i].desc);
+    desc_plan.serializers = NULL;
+    desc_interp = desc_plan;
+    desc_plan.copy_plan = dds_stream_compile_copy_plan (&desc_plan);
+    CU_ASSERT_FATAL (desc_plan.copy_plan != NULL);
+    if (tests[i].nsteps)
+      CU_ASSERT_EQUAL_FATAL (desc_plan.copy_plan->nsteps, tests[i].nsteps);
+    void *sample = tests[i].sample_init_fn ();
+
+    for (uint32_t v = 0; v < 2; v++)
+    {
+      const uint32_t xcdrv = v ? XCDR2 : XCDR1;
+      printf ("running test for desc %s, xcdr version %"PRIu32"\n", tests[i].desc->m_typename, xcdrv);
+
+      /* serialized data is identical, in native and non-native byte order */
+      dds_ostream_t os_plan, os_interp;
+      dds_ostream_init (&os_plan, 0, xcdrv);
+      dds_ostream_init (&os_interp, 0, xcdrv);
+      CU_ASSERT_FATAL (dds_stream_write_sample (&os_plan, sample, &desc_plan));
+      CU_ASSERT_FATAL (dds_stream_write_sample (&os_interp, sample, &desc_interp));
+      serializers_check_stream_eq (&os_plan, &os_interp);
+
+      dds_ostreamBE_t os_be_plan, os_be_interp;
+      dds_ostreamBE_init (&os_be_plan, 0, xcdrv);
+      dds_ostreamBE_init (&os_be_interp, 0, xcdrv);
+      CU_ASSERT_FATAL (dds_stream_write_sampleBE (&os_be_plan, sample, &desc_plan));
+      CU_ASSERT_FATAL (dds_stream_write_sampleBE (&os_be_interp, sample, &desc_interp));
+      serializers_check_stream_eq (&os_be_plan.x, &os_be_interp.x);
+
+      /* normalizing swaps the big-endian data to native, and rejects truncated data */
+      const uint32_t sz = os_plan.m_index;
+      uint32_t actual_sz;
+      CU_ASSERT_FATAL (dds_stream_normalize (os_be_plan.x.m_buffer, sz, (DDSRT_ENDIAN == DDSRT_LITTLE_ENDIAN), xcdrv, &desc_plan, false, &actual_sz));
+      CU_ASSERT_EQUAL_FATAL (actual_sz, sz);
+      CU_ASSERT_FATAL (memcmp (os_be_plan.x.m_buffer, os_plan.m_buffer, sz) == 0);
+      CU_ASSERT_FATAL (!dds_stream_normalize (os_be_interp.x.m_buffer, sz - 1, (DDSRT_ENDIAN == DDSRT_LITTLE_ENDIAN), xcdrv, &desc_plan, false, &actual_sz));
+      dds_ostreamBE_fini (&os_be_plan);
+      dds_ostreamBE_fini (&os_be_interp);
+
+      /* read sample serializes to the same data, also when reusing the sample */
+      dds_istream_t is;
+      dds_istream_init (&is, sz, os_plan.m_buffer, xcdrv);
+      void *sample_rd = ddsrt_calloc (1, desc_plan.size);
+      for (uint32_t r = 0; r < 2; r++)
+      {
+        is.m_index = 0;
+        dds_stream_read_sample (&is, sample_rd, &desc_plan);
+        CU_ASSERT_EQUAL_FATAL (is.m_index, sz);
+        dds_ostream_t os_rd;
+        dds_ostream_init (&os_rd, 0, xcdrv);
+        CU_ASSERT_FATAL (dds_stream_write_sample (&os_rd, sample_rd, &desc_interp));
+        serializers_check_stream_eq (&os_rd, &os_interp);
+        dds_ostream_fini (&os_rd);
+      }
+      dds_stream_free_sample (sample_rd, desc_plan.ops.ops);
+      ddsrt_free (sample_rd);
+
+      dds_istream_fini (&is);
+      dds_ostream_fini (&os_plan);
+      dds_ostream_fini (&os_interp);
+    }
+    dds_cdrstream_desc_fini (&desc_plan);
+  }
+}
+
+static struct ddsi_serdata *views_write_take (const dds_topic_descriptor_t *desc, dds_data_representation_id_t data_representation, const void *sample)
+{
+  entity_init (desc, data_representation, false);
+  dds_return_t ret = dds_write (wr, sample);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  struct ddsi_serdata *sd = NULL;
+  dds_sample_info_t si;
+  while ((ret = dds_takecdr (rd, &sd, 1, &si, 0)) == 0)
+    dds_sleepfor (DDS_MSECS (10));
+  CU_ASSERT_EQUAL_FATAL (ret, 1);
+  return sd;
+}
+
+CU_Test (ddsc_cdrstream, views, .init = cdrstream_init, .fini = cdrstream_fini)
+{
+  static const dds_data_representation_id_t reprs[] = { DDS_DATA_REPRESENTATION_XCDR1, DDS_DATA_REPRESENTATION_XCDR2 };
+  for (uint32_t r = 0; r < sizeof (reprs) / sizeof (reprs[0]); r++)
+  {
+    printf ("running test for data representation %"PRId16"\n", reprs[r]);
+    int32_t l;
+    int16_t sh;
+    uint8_t o;
+    char c;
+    bool b;
+    double d;
+    int64_t ll;
+    const char *str;
+    Serializers_en e;
+    Serializers_en_medium em;
+    Serializers_en_small es;
+    dds_return_t ret;
+
+    /* members of nested structs */
+    Serializers_t5 s5 = { .k = { 7, "nested", -8 }, .l = 9 };
+    struct ddsi_serdata *sd5 = views_write_take (D(t5), reprs[r], &s5);
+    Serializers_t5_view v5;
+    ret = Serializers_t5_view_init (&v5, sd5);
+    CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+    CU_ASSERT_FATAL (Serializers_t5_view_l (&v5, &l) && l == 9);
+    CU_ASSERT_FATAL (Serializers_t5_view_k_o (&v5, &o) && o == 7);
+    CU_ASSERT_FATAL (Serializers_t5_view_k_s (&v5, &str) && strcmp (str, "nested") == 0);
+    CU_ASSERT_FATAL (Serializers_t5_view_k_ll (&v5, &ll) && ll == -8);
+    Serializers_t5_view_fini (&v5);
+
+    /* a view is only valid for the type it was generated for */
+    Serializers_t1_view v1x;
+    ret = Serializers_t1_view_init (&v1x, sd5);
+    CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_BAD_PARAMETER);
+    ddsi_serdata_unref (sd5);
+
+    /* ... even if another type has the same name */
+    const dds_topic_descriptor_t t5_as_t1 = {
+      .m_size = D(t5)->m_size, .m_align = D(t5)->m_align,
+      .m_flagset = D(t5)->m_flagset & ~(uint32_t) DDS_TOPIC_XTYPES_METADATA,
+      .m_nkeys = D(t5)->m_nkeys, .m_typename = D(t1)->m_typename, .m_keys = D(t5)->m_keys,
+      .m_nops = D(t5)->m_nops, .m_ops = D(t5)->m_ops, .m_meta = D(t5)->m_meta,
+      .restrict_data_representation = D(t5)->restrict_data_representation
+    };
+    sd5 = views_write_take (&t5_as_t1, reprs[r], &s5);
+    CU_ASSERT_STRING_EQUAL_FATAL (sd5->type->type_name, D(t1)->m_typename);
+    ret = Serializers_t1_view_init (&v1x, sd5);
+    CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_BAD_PARAMETER);
+    ddsi_serdata_unref (sd5);
+
+    /* optional members, enums with a bit bound and appendable and mutable
+       types require XCDR2 */
+    if (reprs[r] != DDS_DATA_REPRESENTATION_XCDR2)
+      continue;
+
+    /* optional members that are not set are not in the data */
+    Serializers_t7 s7 = *(Serializers_t7 *) serializers_sample_t7 ();
+    for (int opt = 0; opt < 2; opt++)
+    {
+      if (opt)
+        s7.ol = NULL;
+      struct ddsi_serdata *sd7 = views_write_take (D(t7), reprs[r], &s7);
+      Serializers_t7_view v7;
+      ret = Serializers_t7_view_init (&v7, sd7);
+      CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+      CU_ASSERT_FATAL (Serializers_t7_view_b (&v7, &l) && l == -1);
+      CU_ASSERT_FATAL (Serializers_t7_view_s (&v7, &str) && strcmp (str, "string") == 0);
+      CU_ASSERT_FATAL (Serializers_t7_view_d2 (&v7, &d) && d == -2.5);
+      CU_ASSERT_FATAL (Serializers_t7_view_n_y (&v7, &sh) && sh == 7);
+      CU_ASSERT_FATAL (Serializers_t7_view_p (&v7, &o) && o == 11);
+      l = 0;
+      CU_ASSERT_FATAL (Serializers_t7_view_ol (&v7, &l) == !opt);
+      CU_ASSERT_EQUAL_FATAL (l, opt ? 0 : 4);
+      Serializers_t7_view_fini (&v7);
+      ddsi_serdata_unref (sd7);
+    }
+
+    /* members before the first string are at a fixed offset, the others are
+       located on the first access to one of them */
+    Serializers_t1 s1 = { .id = 1, .c = 'x', .b = true, .d = 1.5, .name = "name", .e = Serializers_E_2,
+      .em = Serializers_EM_3, .bstr = "abc", .sh = -3, .ek = Serializers_ES_2 };
+    struct ddsi_serdata *sd1 = views_write_take (D(t1), reprs[r], &s1);
+    Serializers_t1_view v1;
+    ret = Serializers_t1_view_init (&v1, sd1);
+    CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+    CU_ASSERT_FATAL (!v1.v.resolved);
+    CU_ASSERT_FATAL (Serializers_t1_view_id (&v1, &l) && l == 1);
+    CU_ASSERT_FATAL (Serializers_t1_view_c (&v1, &c) && c == 'x');
+    CU_ASSERT_FATAL (Serializers_t1_view_b (&v1, &b) && b);
+    CU_ASSERT_FATAL (Serializers_t1_view_d (&v1, &d) && d == 1.5);
+    CU_ASSERT_FATAL (Serializers_t1_view_name (&v1, &str) && strcmp (str, "name") == 0);
+    CU_ASSERT_FATAL (!v1.v.resolved);
+    CU_ASSERT_FATAL (Serializers_t1_view_e (&v1, &e) && e == Serializers_E_2);
+    CU_ASSERT_FATAL (v1.v.resolved);
+    CU_ASSERT_FATAL (Serializers_t1_view_em (&v1, &em) && em == Serializers_EM_3);
+    CU_ASSERT_FATAL (Serializers_t1_view_bstr (&v1, &str) && strcmp (str, "abc") == 0);
+    CU_ASSERT_FATAL (Serializers_t1_view_sh (&v1, &sh) && sh == -3);
+    CU_ASSERT_FATAL (Serializers_t1_view_ek (&v1, &es) && es == Serializers_ES_2);
+    Serializers_t1_view_fini (&v1);
+    ddsi_serdata_unref (sd1);
+
+    /* appendable type */
+    Serializers_t4 s4 = { .l = 12 };
+    struct ddsi_serdata *sd4 = views_write_take (D(t4), reprs[r], &s4);
+    Serializers_t4_view v4;
+    ret = Serializers_t4_view_init (&v4, sd4);
+    CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+    CU_ASSERT_FATAL (Serializers_t4_view_l (&v4, &l) && l == 12);
+    Serializers_t4_view_fini (&v4);
+    ddsi_serdata_unref (sd4);
+
+    /* mutable type, members are found by member id */
+    double od = 13.5;
+    Serializers_t8 s8 = { .a = 14, .s = "mutable", .n = { 15, 16 }, .od = &od, .e = Serializers_E_3 };
+    struct ddsi_serdata *sd8 = views_write_take (D(t8), reprs[r], &s8);
+    Serializers_t8_view v8;
+    ret = Serializers_t8_view_init (&v8, sd8);
+    CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+    CU_ASSERT_FATAL (Serializers_t8_view_e (&v8, &e) && e == Serializers_E_3);
+    CU_ASSERT_FATAL (Serializers_t8_view_a (&v8, &l) && l == 14);
+    CU_ASSERT_FATAL (Serializers_t8_view_s (&v8, &str) && strcmp (str, "mutable") == 0);
+    CU_ASSERT_FATAL (Serializers_t8_view_n_x (&v8, &sh) && sh == 15);
+    CU_ASSERT_FATAL (Serializers_t8_view_n_y (&v8, &sh) && sh == 16);
+    CU_ASSERT_FATAL (Serializers_t8_view_od (&v8, &d) && d == 13.5);
+    Serializers_t8_view_fini (&v8);
+    ddsi_serdata_unref (sd8);
+  }
+}
+
+#undef S
+#undef D
+
+static void simd_fill_random (uint8_t *buf, uint32_t sz)
+{
+  for (uint32_t i = 0; i < sz; i++)
+    buf[i] = (uint8_t) ddsrt_random ();
+}
+
+static void simd_fill_max (uint8_t *buf, uint32_t size, uint32_t num, uint32_t max, bool bswap)
+{
+  /* random values <= max, stored in the byte order the kernel expects as input */
+  for (uint32_t i = 0; i < num; i++)
+  {
+    uint32_t x = max ? ddsrt_random () % max + (ddsrt_random () % 2) : 0;
+    switch (size)
+    {
+      case 1: buf[i] = (uint8_t) x; break;
+      case 2: { uint16_t y = (uint16_t) x; if (bswap) y = ddsrt_bswap2u (y); memcpy (buf + 2 * i, &y, 2); break; }
+      case 4: { uint32_t y = x; if (bswap) y = ddsrt_bswap4u (y); memcpy (buf + 4 * i, &y, 4); break; }
+    }
+  }
+}
+
+CU_Test (ddsc_cdrstream, simd_kernels)
+{
+  static const enum dds_stream_simd_level levels[] = { DDS_STREAM_SIMD_SSE2, DDS_STREAM_SIMD_AVX2, DDS_STREAM_SIMD_NEON };
+  static const uint32_t nums[] = { 0, 1, 3, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 1000 };
+  const struct dds_stream_simd_ops *scalar = dds_stream_simd_get_ops (DDS_STREAM_SIMD_SCALAR);
+  CU_ASSERT_FATAL (scalar != NULL);
+  CU_ASSERT_FATAL (dds_stream_simd () != NULL);
+
+  const uint32_t bufsz = 8 * 1000 + 8;
+  uint8_t *src = ddsrt_malloc (bufsz), *ref = ddsrt_malloc (bufsz), *res = ddsrt_malloc (bufsz);
+  for (size_t l = 0; l < sizeof (levels) / sizeof (levels[0]); l++)
+  {
+    const struct dds_stream_simd_ops *ops = dds_stream_simd_get_ops (levels[l]);
+    if (ops == NULL)
+      continue;
+    printf ("testing simd level %d\n", (int) ops->level);
+    for (size_t k = 0; k < sizeof (nums) / sizeof (nums[0]); k++)
+    {
+      const uint32_t num = nums[k];
+      /* unaligned start, for 8-byte values in XCDR2 and for arbitrary buffers */
+      for (uint32_t misalign = 0; misalign < 8; misalign++)
+      {
+        for (uint32_t size = 1; size <= 8; size *= 2)
+        {
+          simd_fill_random (src, bufsz);
+
+          /* in-place swap */
+          memcpy (ref, src, bufsz);
+          memcpy (res, src, bufsz);
+          scalar->swap (ref + misalign, size, num);
+          ops->swap (res + misalign, size, num);
+          CU_ASSERT_FATAL (memcmp (ref, res, bufsz) == 0);
+
+          /* swap to a different buffer, which must leave the rest untouched */
+          memset (ref, 0xee, bufsz);
+          memset (res, 0xee, bufsz);
+          scalar->swap_copy (ref + misalign, src, size, num);
+          ops->swap_copy (res + misalign, src, size, num);
+          CU_ASSERT_FATAL (memcmp (ref, res, bufsz) == 0);
+
+          /* checking range, including swapping, for all sizes used for enums */
+          if (size == 8)
+            continue;
+          const uint32_t maxs[] = { 0, 1, 2, 100, (size == 1) ? UINT8_MAX : (size == 2) ? UINT16_MAX : INT32_MAX, UINT32_MAX };
+          for (size_t m = 0; m < sizeof (maxs) / sizeof (maxs[0]); m++)
+          {
+            for (int bswap = 0; bswap <= (size > 1); bswap++)
+            {
+              const uint32_t max = maxs[m];
+              const uint32_t max_in_range = (size == 4 || max < (1u << (8 * size))) ? max : (1u << (8 * size)) - 1;
+              simd_fill_max (src + misalign, size, num, max_in_range, bswap);
+              memcpy (ref, src, bufsz);
+              memcpy (res, src, bufsz);
+              CU_ASSERT_FATAL (scalar->check_max (ref + misalign, size, num, max, bswap));
+              CU_ASSERT_FATAL (ops->check_max (res + misalign, size, num, max, bswap));
+              CU_ASSERT_FATAL (memcmp (ref, res, bufsz) == 0);
+
+              /* a single out-of-range element anywhere is detected */
+              if (max_in_range == max && (size == 4 ? max < UINT32_MAX : max < (1u << (8 * size)) - 1) && num > 0)
+              {
+                const uint32_t idx = ddsrt_random () % num;
+                const uint32_t bad = max + 1 + (size == 4 ? ddsrt_random () % (UINT32_MAX - max) : 0);
+                memcpy (res, src, bufsz);
+                switch (size)
+                {
+                  case 1: res[misalign + idx] = (uint8_t) bad; break;
+                  case 2: { uint16_t y = (uint16_t) bad; if (bswap) y = ddsrt_bswap2u (y); memcpy (res + misalign + 2 * idx, &y, 2); break; }
+                  case 4: { uint32_t y = bad; if (bswap) y = ddsrt_bswap4u (y); memcpy (res + misalign + 4 * idx, &y, 4); break; }
+                }
+                memcpy (ref, res, bufsz);
+                CU_ASSERT_FATAL (!scalar->check_max (ref + misalign, size, num, max, bswap));
+                CU_ASSERT_FATAL (!ops->check_max (res + misalign, size, num, max, bswap));
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  ddsrt_free (src);
+  ddsrt_free (ref);
+  ddsrt_free (res);
+}
+
 #undef XCDR1
 #undef XCDR2
@@ -0,0 +1,190 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include <assert.h>
+#include <string.h>
+
+#include "dds/dds.h"
+#include "dds/ddsrt/environ.h"
+#include "dds/ddsrt/heap.h"
+#include "dds/ddsrt/random.h"
+#include "dds/ddsi/ddsi_entity_index.h"
+#include "dds/ddsi/ddsi_endpoint.h"
+#include "dds/ddsi/ddsi_serdata.h"
+#include "ddsi__compress.h"
+#include "ddsi__whc.h"
+#include "dds__entity.h"
+
+#include "test_common.h"
+#include "RoundTrip.h"
+
+#define COMPRESSION_CONFIG(extra) \
+  "${CYCLONEDDS_URI}${CYCLONEDDS_URI:+,}<Discovery><ExternalDomainId>0</ExternalDomainId></Discovery>" \
+  "<Internal>" extra "</Internal>"
+
+static void fill_payload (RoundTripModule_DataType *s, uint32_t size, bool compressible)
+{
+  s->payload._length = s->payload._maximum = size;
+  s->payload._buffer = dds_alloc (size);
+  s->payload._release = true;
+  for (uint32_t i = 0; i < size; i++)
+    s->payload._buffer[i] = compressible ? (uint8_t) ((i % 16) < 4 ? (i / 16) : (i % 5)) : (uint8_t) ddsrt_random ();
+}
+
+static bool wire_serdata_is_compressed (dds_entity_t writer, const RoundTripModule_DataType *s)
+{
+  struct dds_entity *wr_entity;
+  bool compressed;
+  CU_ASSERT_EQUAL_FATAL (dds_entity_pin (writer, &wr_entity), 0);
+  ddsi_thread_state_awake (ddsi_lookup_thread_state (), &wr_entity->m_domain->gv);
+  struct ddsi_writer *wr = ddsi_entidx_lookup_writer_guid (wr_entity->m_domain->gv.entity_index, &wr_entity->m_guid);
+  CU_ASSERT_FATAL (wr != NULL);
+  assert (wr != NULL); /* for Clang's static analyzer */
+  struct ddsi_serdata *sd = ddsi_serdata_from_sample (wr->type, SDK_DATA, s);
+  CU_ASSERT_FATAL (sd != NULL);
+  ddsrt_mutex_lock (&wr->e.lock);
+  struct ddsi_serdata *wsd = ddsi_writer_wire_serdata (wr, sd);
+  ddsrt_mutex_unlock (&wr->e.lock);
+  compressed = ddsi_serdata_is_compressed (wsd);
+  if (compressed)
+    CU_ASSERT (ddsi_serdata_size (wsd) < ddsi_serdata_size (sd));
+  ddsi_serdata_unref (wsd);
+  ddsi_serdata_unref (sd);
+  ddsi_thread_state_asleep (ddsi_lookup_thread_state ());
+  dds_entity_unpin (wr_entity);
+  return compressed;
+}
+
+CU_Test (ddsc_compression, large_samples, .timeout = 30)
+{
+  char *conf_pub = ddsrt_expand_envvars (COMPRESSION_CONFIG ("<Compression><Topics>ddsc_compression*</Topics><Threshold>1kB</Threshold></Compression>"), 1);
+  char *conf_sub = ddsrt_expand_envvars (COMPRESSION_CONFIG (""), 0);
+  const dds_entity_t pub_dom = dds_create_domain (1, conf_pub);
+  CU_ASSERT_FATAL (pub_dom > 0);
+  const dds_entity_t sub_dom = dds_create_domain (0, conf_sub);
+  CU_ASSERT_FATAL (sub_dom > 0);
+  dds_free (conf_pub);
+  dds_free (conf_sub);
+
+  const dds_entity_t pub_pp = dds_create_participant (1, NULL, NULL);
+  CU_ASSERT_FATAL (pub_pp > 0);
+  const dds_entity_t sub_pp = dds_create_participant (0, NULL, NULL);
+  CU_ASSERT_FATAL (sub_pp > 0);
+
+  char name[100];
+  create_unique_topic_name ("ddsc_compression", name, sizeof name);
+  dds_qos_t *qos = dds_create_qos ();
+  dds_qset_reliability (qos, DDS_RELIABILITY_RELIABLE, DDS_INFINITY);
+  dds_qset_history (qos, DDS_HISTORY_KEEP_ALL, 0);
+  const dds_entity_t pub_tp = dds_create_topic (pub_pp, &RoundTripModule_DataType_desc, name, qos, NULL);
+  CU_ASSERT_FATAL (pub_tp > 0);
+  const dds_entity_t sub_tp = dds_create_topic (sub_pp, &RoundTripModule_DataType_desc, name, qos, NULL);
+  CU_ASSERT_FATAL (sub_tp > 0);
+  const dds_entity_t writer = dds_create_writer (pub_pp, pub_tp, qos, NULL);
+  CU_ASSERT_FATAL (writer > 0);
+  const dds_entity_t reader = dds_create_reader (sub_pp, sub_tp, qos, NULL);
+  CU_ASSERT_FATAL (reader > 0);
+  dds_delete_qos (qos);
+  sync_reader_writer (sub_pp, reader, pub_pp, writer);
+
+  /* small, large and compressible (fragmented), and large but incompressible */
+  static const struct { uint32_t size; bool compressible; bool expect_compressed; } cases[] = {
+    { 100, true, false },
+    { 200000, true, true },
+    { 20000, false, false },
+    { 5000, true, true }
+  };
+  RoundTripModule_DataType samples[sizeof (cases) / sizeof (cases[0])];
+  for (size_t i = 0; i < sizeof (cases) / sizeof (cases[0]); i++)
+  {
+    fill_payload (&samples[i], cases[i].size, cases[i].compressible);
+    CU_ASSERT (wire_serdata_is_compressed (writer, &samples[i]) == cases[i].expect_compressed);
+    dds_return_t ret = dds_write (writer, &samples[i]);
+    CU_ASSERT_FATAL (ret == DDS_RETCODE_OK);
+  }
+
+  size_t nrecv = 0;
+  const dds_time_t tend = dds_time () + DDS_SECS (10);
+  while (nrecv < sizeof (cases) / sizeof (cases[0]) && dds_time () < tend)
+  {
+    void *raw = NULL;
+    dds_sample_info_t si;
+    if (dds_take (reader, &raw, &si, 1, 1) != 1)
+      dds_sleepfor (DDS_MSECS (10));
+    else
+    {
+      const RoundTripModule_DataType *s = raw;
+      CU_ASSERT_FATAL (si.valid_data);
+      CU_ASSERT_EQUAL_FATAL (s->payload._length, samples[nrecv].payload._length);
+      CU_ASSERT (memcmp (s->payload._buffer, samples[nrecv].payload._buffer, s->payload._length) == 0);
+      dds_return_loan (reader, &raw, 1);
+      nrecv++;
+    }
+  }
+  CU_ASSERT_EQUAL_FATAL (nrecv, sizeof (cases) / sizeof (cases[0]));
+
+  for (size_t i = 0; i < sizeof (cases) / sizeof (cases[0]); i++)
+    RoundTripModule_DataType_free (&samples[i], DDS_FREE_CONTENTS);
+  dds_delete (pub_dom);
+  dds_delete (sub_dom);
+}
+
+CU_Test (ddsc_compression, whc_retains_wire_form, .timeout = 30)
+{
+  char *conf = ddsrt_expand_envvars (COMPRESSION_CONFIG ("<Compression><Topics>ddsc_compression*</Topics><Threshold>1kB</Threshold></Compression>"), 1);
+  const dds_entity_t dom = dds_create_domain (1, conf);
+  CU_ASSERT_FATAL (dom > 0);
+  dds_free (conf);
+  const dds_entity_t pp = dds_create_participant (1, NULL, NULL);
+  CU_ASSERT_FATAL (pp > 0);
+
+  char name[100];
+  create_unique_topic_name ("ddsc_compression", name, sizeof name);
+  dds_qos_t *qos = dds_create_qos ();
+  dds_qset_reliability (qos, DDS_RELIABILITY_RELIABLE, DDS_INFINITY);
+  dds_qset_durability (qos, DDS_DURABILITY_TRANSIENT_LOCAL);
+  const dds_entity_t tp = dds_create_topic (pp, &RoundTripModule_DataType_desc, name, qos, NULL);
+  CU_ASSERT_FATAL (tp > 0);
+  const dds_entity_t writer = dds_create_writer (pp, tp, qos, NULL);
+  CU_ASSERT_FATAL (writer > 0);
+  dds_delete_qos (qos);
+
+  RoundTripModule_DataType sample;
+  fill_payload (&sample, 5000, true);
+  dds_return_t ret = dds_write (writer, &sample);
+  CU_ASSERT_FATAL (ret == DDS_RETCODE_OK);
+  RoundTripModule_DataType_free (&sample, DDS_FREE_CONTENTS);
+
+  /* the compressed form is decided on when writing and retransmits use that same form */
+  struct dds_entity *wr_entity;
+  CU_ASSERT_EQUAL_FATAL (dds_entity_pin (writer, &wr_entity), 0);
+  ddsi_thread_state_awake (ddsi_lookup_thread_state (), &wr_entity->m_domain->gv);
+  struct ddsi_writer *wr = ddsi_entidx_lookup_writer_guid (wr_entity->m_domain->gv.entity_index, &wr_entity->m_guid);
+  CU_ASSERT_FATAL (wr != NULL);
+  assert (wr != NULL); /* for Clang's static analyzer */
+  struct ddsi_serdata *wire_serdata = NULL;
+  ddsrt_mutex_lock (&wr->e.lock);
+  for (int i = 0; i < 2; i++)
+  {
+    struct ddsi_whc_borrowed_sample bs;
+    CU_ASSERT_FATAL (ddsi_whc_borrow_sample (wr->whc, 1, &bs));
+    CU_ASSERT (!ddsi_serdata_is_compressed (bs.serdata));
+    CU_ASSERT (ddsi_serdata_is_compressed (bs.wire_serdata));
+    CU_ASSERT (ddsi_writer_rexmit_serdata (&bs, NULL) == bs.wire_serdata);
+    CU_ASSERT (wire_serdata == NULL || wire_serdata == bs.wire_serdata);
+    wire_serdata = bs.wire_serdata;
+    ddsi_whc_return_sample (wr->whc, &bs, false);
+  }
+  ddsrt_mutex_unlock (&wr->e.lock);
+  ddsi_thread_state_asleep (ddsi_lookup_thread_state ());
+  dds_entity_unpin (wr_entity);
+  dds_delete (dom);
+}
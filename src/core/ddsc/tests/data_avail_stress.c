@@ -19,6 +19,7 @@
 #include "dds/ddsrt/environ.h"
 
 #include "dds/dds.h"
+#include "dds/ddsc/dds_internal_api.h"
 #include "test_common.h"
 
 struct writethread_arg {
@@ -234,3 +235,149 @@ CU_Test(ddsc_data_avail_stress, remote, .timeout = 15)
 {
   stress_data_avail_delete_reader (true, 9);
 }
+
+#define STAGED_NWRITES 100000
+#define STAGED_NKEYS 4
+
+static uint32_t staged_writethread (void *varg)
+{
+  const dds_entity_t * const wrp = varg;
+  for (int32_t i = 0; i < STAGED_NWRITES; i++)
+  {
+    Space_Type1 data = { i % STAGED_NKEYS, 0, i };
+    if (dds_write (*wrp, &data) != 0)
+      return 1;
+  }
+  return 0;
+}
+
+CU_Test(ddsc_data_avail_stress, staged_delivery, .timeout = 30)
+{
+  // Taking large batches while a writer delivers locally at full speed makes it likely
+  // the delivery finds the RHC locked and stages the sample.  Everything must arrive,
+  // per instance in order, and the read condition must trigger for staged samples.
+  const char *config = "${CYCLONEDDS_URI}${CYCLONEDDS_URI:+,}<Internal><StagedDelivery>true</StagedDelivery></Internal>";
+  char *conf = ddsrt_expand_envvars (config, 0);
+  const dds_entity_t dom = dds_create_domain (0, conf);
+  CU_ASSERT_FATAL (dom > 0);
+  ddsrt_free (conf);
+  const dds_entity_t pp = dds_create_participant (0, NULL, NULL);
+  CU_ASSERT_FATAL (pp > 0);
+  char tpname[100];
+  create_unique_topic_name ("ddsc_data_avail_stress_staged_delivery", tpname, sizeof (tpname));
+  dds_qos_t * const qos = dds_create_qos ();
+  CU_ASSERT_FATAL (qos != NULL);
+  dds_qset_reliability (qos, DDS_RELIABILITY_RELIABLE, DDS_SECS (1));
+  dds_qset_history (qos, DDS_HISTORY_KEEP_ALL, 0);
+  const dds_entity_t tp = dds_create_topic (pp, &Space_Type1_desc, tpname, qos, NULL);
+  CU_ASSERT_FATAL (tp > 0);
+  const dds_entity_t rd = dds_create_reader (pp, tp, qos, NULL);
+  CU_ASSERT_FATAL (rd > 0);
+  dds_entity_t stwr = dds_create_writer (pp, tp, qos, NULL);
+  CU_ASSERT_FATAL (stwr > 0);
+  dds_delete_qos (qos);
+  const dds_entity_t rdcond = dds_create_readcondition (rd, DDS_ANY_STATE);
+  CU_ASSERT_FATAL (rdcond > 0);
+  const dds_entity_t ws = dds_create_waitset (pp);
+  CU_ASSERT_FATAL (ws > 0);
+  dds_return_t rc = dds_waitset_attach (ws, rdcond, 0);
+  CU_ASSERT_FATAL (rc == 0);
+
+  ddsrt_thread_t tid;
+  ddsrt_threadattr_t tattr;
+  ddsrt_threadattr_init (&tattr);
+  rc = ddsrt_thread_create (&tid, "writer", &tattr, staged_writethread, &stwr);
+  CU_ASSERT_FATAL (rc == 0);
+
+#define BATCH 256
+  static Space_Type1 samples[BATCH];
+  void *ptrs[BATCH];
+  dds_sample_info_t si[BATCH];
+  for (int i = 0; i < BATCH; i++)
+    ptrs[i] = &samples[i];
+  int32_t next[STAGED_NKEYS];
+  for (int32_t k = 0; k < STAGED_NKEYS; k++)
+    next[k] = k;
+  int32_t ntaken = 0;
+  while (ntaken < STAGED_NWRITES)
+  {
+    rc = dds_take (rd, ptrs, si, BATCH, BATCH);
+    CU_ASSERT_FATAL (rc >= 0);
+    for (int32_t i = 0; i < rc; i++)
+    {
+      CU_ASSERT_FATAL (si[i].valid_data);
+      CU_ASSERT_FATAL (samples[i].long_1 >= 0 && samples[i].long_1 < STAGED_NKEYS);
+      CU_ASSERT_FATAL (samples[i].long_3 == next[samples[i].long_1]);
+      next[samples[i].long_1] += STAGED_NKEYS;
+    }
+    ntaken += rc;
+    if (rc == 0)
+    {
+      // a stranded staged sample would not trigger the read condition
+      rc = dds_waitset_wait (ws, NULL, 0, DDS_SECS (5));
+      CU_ASSERT_FATAL (rc > 0);
+    }
+  }
+#undef BATCH
+  uint32_t wrres;
+  rc = ddsrt_thread_join (tid, &wrres);
+  CU_ASSERT_FATAL (rc == 0);
+  CU_ASSERT_FATAL (wrres == 0);
+  rc = dds_delete (dom);
+  CU_ASSERT_FATAL (rc == 0);
+}
+
+CU_Test(ddsc_data_avail_stress, staged_delivery_locked)
+{
+  // Writing while the same thread holds the RHC lock would deadlock without staging,
+  // with it the samples are queued and folded in by the take that follows.
+  const char *config = "${CYCLONEDDS_URI}${CYCLONEDDS_URI:+,}<Internal><StagedDelivery>true</StagedDelivery></Internal>";
+  char *conf = ddsrt_expand_envvars (config, 0);
+  const dds_entity_t dom = dds_create_domain (0, conf);
+  CU_ASSERT_FATAL (dom > 0);
+  ddsrt_free (conf);
+  const dds_entity_t pp = dds_create_participant (0, NULL, NULL);
+  CU_ASSERT_FATAL (pp > 0);
+  char tpname[100];
+  create_unique_topic_name ("ddsc_data_avail_stress_staged_delivery", tpname, sizeof (tpname));
+  dds_qos_t * const qos = dds_create_qos ();
+  CU_ASSERT_FATAL (qos != NULL);
+  dds_qset_reliability (qos, DDS_RELIABILITY_RELIABLE, DDS_SECS (1));
+  dds_qset_history (qos, DDS_HISTORY_KEEP_ALL, 0);
+  const dds_entity_t tp = dds_create_topic (pp, &Space_Type1_desc, tpname, qos, NULL);
+  CU_ASSERT_FATAL (tp > 0);
+  const dds_entity_t rd = dds_create_reader (pp, tp, qos, NULL);
+  CU_ASSERT_FATAL (rd > 0);
+  const dds_entity_t stwr = dds_create_writer (pp, tp, qos, NULL);
+  CU_ASSERT_FATAL (stwr > 0);
+  dds_delete_qos (qos);
+
+  dds_return_t rc = dds_write (stwr, &(Space_Type1){ 0, 0, 0 });
+  CU_ASSERT_FATAL (rc == 0);
+  const uint32_t nlocked = dds_reader_lock_samples (rd);
+  CU_ASSERT_FATAL (nlocked == 1);
+  for (int32_t i = 1; i < STAGED_NKEYS; i++)
+  {
+    rc = dds_write (stwr, &(Space_Type1){ 0, 0, i });
+    CU_ASSERT_FATAL (rc == 0);
+  }
+  uint32_t status;
+  rc = dds_get_status_changes (rd, &status);
+  CU_ASSERT_FATAL (rc == 0);
+  CU_ASSERT (status & DDS_DATA_AVAILABLE_STATUS);
+
+  Space_Type1 samples[STAGED_NKEYS];
+  void *ptrs[STAGED_NKEYS];
+  dds_sample_info_t si[STAGED_NKEYS];
+  for (int i = 0; i < STAGED_NKEYS; i++)
+    ptrs[i] = &samples[i];
+  rc = dds_take (rd, ptrs, si, STAGED_NKEYS, DDS_READ_WITHOUT_LOCK);
+  CU_ASSERT_FATAL (rc == STAGED_NKEYS);
+  for (int32_t i = 0; i < STAGED_NKEYS; i++)
+    CU_ASSERT (samples[i].long_3 == i);
+  rc = dds_delete (dom);
+  CU_ASSERT_FATAL (rc == 0);
+}
+
+#undef STAGED_NKEYS
+#undef STAGED_NWRITES
@@ -0,0 +1,413 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include <string.h>
+#include "dds/dds.h"
+#include "dds/ddsrt/endian.h"
+#include "dds/ddsrt/heap.h"
+#include "dds/ddsrt/environ.h"
+#include "dds/cdr/dds_cdrstream.h"
+#include "dds/ddsi/ddsi_entity_index.h"
+#include "dds/ddsi/ddsi_proxy_endpoint.h"
+#include "ddsi__endpoint_match.h"
+#include "ddsi__thread.h"
+#include "dds__entity.h"
+#include "dds__topic.h"
+#include "dds__serdata_default.h"
+#include "dds__filter_expr.h"
+#include "test_common.h"
+#include "FilterExprTypes.h"
+
+#define MAXSAMPLES 20
+
+static dds_entity_t g_participant = 0;
+
+static void filter_expr_init (void)
+{
+  g_participant = dds_create_participant (DDS_DOMAIN_DEFAULT, NULL, NULL);
+  CU_ASSERT_FATAL (g_participant > 0);
+}
+
+static void filter_expr_fini (void)
+{
+  dds_return_t ret = dds_delete (g_participant);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+}
+
+static dds_entity_t create_topic (const dds_topic_descriptor_t *desc)
+{
+  char name[100];
+  const dds_entity_t tp = dds_create_topic (g_participant, desc, create_unique_topic_name ("ddsc_filter_expr", name, sizeof name), NULL, NULL);
+  CU_ASSERT_FATAL (tp > 0);
+  return tp;
+}
+
+/* Evaluates the expression on the sample serialized in native, little- and big-endian
+   byte order and checks that all of them give the expected result */
+static void check_eval (dds_entity_t topic, const char *expression, uint32_t nparams, const char * const *params, const void *sample, uint32_t xcdr_version, bool expected)
+{
+  struct dds_topic *tp;
+  struct dds_filter_expr *expr;
+  dds_return_t ret = dds_topic_pin (topic, &tp);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  ret = dds_filter_expr_compile (&expr, tp->m_stype, expression, nparams, params);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  const struct dds_cdrstream_desc *desc = &((const struct dds_sertype_default *) tp->m_stype)->type;
+
+  for (int bo = 0; bo < 3; bo++)
+  {
+    dds_ostream_t os;
+    bool bswap;
+    switch (bo)
+    {
+      case 0:
+        dds_ostream_init (&os, 0, xcdr_version);
+        CU_ASSERT_FATAL (dds_stream_write_sample (&os, sample, desc));
+        bswap = false;
+        break;
+      case 1:
+        dds_ostreamLE_init ((dds_ostreamLE_t *) &os, 0, xcdr_version);
+        CU_ASSERT_FATAL (dds_stream_write_sampleLE ((dds_ostreamLE_t *) &os, sample, desc));
+        bswap = (DDSRT_ENDIAN != DDSRT_LITTLE_ENDIAN);
+        break;
+      default:
+        dds_ostreamBE_init ((dds_ostreamBE_t *) &os, 0, xcdr_version);
+        CU_ASSERT_FATAL (dds_stream_write_sampleBE ((dds_ostreamBE_t *) &os, sample, desc));
+        bswap = (DDSRT_ENDIAN != DDSRT_BIG_ENDIAN);
+        break;
+    }
+    const bool result = dds_filter_expr_eval_cdr (expr, os.m_buffer, os.m_index, xcdr_version, bswap);
+    if (result != expected)
+      printf ("%s: xcdr%"PRIu32" byte order %d: %d, expected %d\n", expression, xcdr_version, bo, (int) result, (int) expected);
+    CU_ASSERT (result == expected);
+    dds_ostream_fini (&os);
+  }
+
+  dds_filter_expr_free (expr);
+  dds_topic_unpin (tp);
+}
+
+CU_Test(ddsc_filter_expr, syntax, .init = filter_expr_init, .fini = filter_expr_fini)
+{
+  static const struct { const char *expr; dds_return_t ret; } tests[] = {
+    { "id = 1", DDS_RETCODE_OK },
+    { "id = 1 AND (c = 'RED' OR NOT level < -3)", DDS_RETCODE_OK },
+    { "pos.x BETWEEN 1.5 AND 2e3 or flag = 'x'", DDS_RETCODE_OK },
+    { "id <> %0 AND count >= %1", DDS_RETCODE_OK },
+    { "2 < id", DDS_RETCODE_OK },
+    { "id = level", DDS_RETCODE_OK },
+    { "", DDS_RETCODE_BAD_PARAMETER },
+    { "id", DDS_RETCODE_BAD_PARAMETER },
+    { "id = ", DDS_RETCODE_BAD_PARAMETER },
+    { "id == 1", DDS_RETCODE_BAD_PARAMETER },
+    { "(id = 1", DDS_RETCODE_BAD_PARAMETER },
+    { "id = 1)", DDS_RETCODE_BAD_PARAMETER },
+    { "id = 1 AND", DDS_RETCODE_BAD_PARAMETER },
+    { "1 = 1", DDS_RETCODE_BAD_PARAMETER },
+    { "nosuchfield = 1", DDS_RETCODE_BAD_PARAMETER },
+    { "pos.z = 1", DDS_RETCODE_BAD_PARAMETER },
+    { "id = 'abc'", DDS_RETCODE_BAD_PARAMETER },
+    { "c = 'PURPLE'", DDS_RETCODE_BAD_PARAMETER },
+    { "id LIKE 'a%'", DDS_RETCODE_BAD_PARAMETER },
+    { "id = %2", DDS_RETCODE_BAD_PARAMETER },
+    { "pos = 1", DDS_RETCODE_UNSUPPORTED }
+  };
+  const char *params[] = { "3", "4" };
+  const dds_entity_t tp = create_topic (&FilterExprTypes_fixed_type_desc);
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+  {
+    dds_return_t ret = dds_set_topic_filter_expression (tp, tests[i].expr, 2, params);
+    if (ret != tests[i].ret)
+      printf ("%s: %"PRId32", expected %"PRId32"\n", tests[i].expr, ret, tests[i].ret);
+    CU_ASSERT_EQUAL (ret, tests[i].ret);
+  }
+  dds_return_t ret = dds_set_topic_filter_expression (tp, NULL, 0, NULL);
+  CU_ASSERT_EQUAL (ret, DDS_RETCODE_OK);
+}
+
+CU_Test(ddsc_filter_expr, fixed, .init = filter_expr_init, .fini = filter_expr_fini)
+{
+  static const struct { const char *expr; bool result; } tests[] = {
+    { "id = 7", true },
+    { "id <> 7", false },
+    { "id = 0x7", true },
+    { "id > -1", true },
+    { "7 >= id", true },
+    { "c = 'GREEN'", true },
+    { "c <> 'GREEN' OR id = 3", false },
+    { "pos.x = 1.5", true },
+    { "pos.y < pos.x", true },
+    { "pos.y BETWEEN -3 AND -2", true },
+    { "pos.y NOT BETWEEN -3 AND -2", false },
+    { "level = -2 AND level < id", true },
+    { "count = 18446744073709551615", true },
+    { "count > -1", true },
+    { "flag = 'q'", true },
+    { "on = TRUE", true },
+    { "ratio > 0.24 AND ratio < 0.26", true },
+    { "NOT (id = 7 AND NOT c = 'RED')", false },
+    { "id = 1 OR id = 2 OR id = 7", true },
+    { "id = 7 AND (level = 0 OR on = false)", false }
+  };
+  const dds_entity_t tp = create_topic (&FilterExprTypes_fixed_type_desc);
+  const FilterExprTypes_fixed_type sample = {
+    .id = 7, .c = FilterExprTypes_GREEN, .pos = { 1.5, -2.5 }, .level = -2,
+    .count = UINT64_MAX, .flag = 'q', .on = true, .ratio = 0.25f
+  };
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+  {
+    check_eval (tp, tests[i].expr, 0, NULL, &sample, DDSI_RTPS_CDR_ENC_VERSION_1, tests[i].result);
+    check_eval (tp, tests[i].expr, 0, NULL, &sample, DDSI_RTPS_CDR_ENC_VERSION_2, tests[i].result);
+  }
+}
+
+CU_Test(ddsc_filter_expr, variable, .init = filter_expr_init, .fini = filter_expr_fini)
+{
+  static const struct { const char *expr; bool result; } tests[] = {
+    { "name = 'hello world'", true },
+    { "name > 'hello'", true },
+    { "name LIKE 'hello%'", true },
+    { "name LIKE '%o_w%'", true },
+    { "name LIKE 'h_llo'", false },
+    { "name LIKE '%'", true },
+    { "opt = 3", false },
+    { "opt <> 3", false },
+    { "c = 'BLUE' AND pos.y = 4", true },
+    { "id = %0 AND name = %1", true },
+    { "id = %0 AND name = %2", false }
+  };
+  const char *params[] = { "5", "'hello world'", "bye" };
+  int32_t values[] = { 1, 2, 3 };
+  const dds_entity_t tp = create_topic (&FilterExprTypes_variable_type_desc);
+  FilterExprTypes_variable_type sample = {
+    .id = 5, .name = "hello world", .values = { ._length = 3, ._maximum = 3, ._buffer = values },
+    .opt = NULL, .c = FilterExprTypes_BLUE, .pos = { 3, 4 }
+  };
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+    check_eval (tp, tests[i].expr, 3, params, &sample, DDSI_RTPS_CDR_ENC_VERSION_2, tests[i].result);
+
+  int32_t opt = 3;
+  sample.opt = &opt;
+  check_eval (tp, "opt = 3 AND c = 'BLUE'", 0, NULL, &sample, DDSI_RTPS_CDR_ENC_VERSION_2, true);
+}
+
+CU_Test(ddsc_filter_expr, strings, .init = filter_expr_init, .fini = filter_expr_fini)
+{
+  static const struct { const char *expr; bool result; } tests[] = {
+    { "name = 'abcdefg' AND after = 3", true },
+    { "label = '' AND after > 2", true },
+    { "label < name", true },
+    { "after = id", false }
+  };
+  int32_t values[] = { 1, 2, 3, 4, 5 };
+  const dds_entity_t tp = create_topic (&FilterExprTypes_strings_type_desc);
+  FilterExprTypes_strings_type sample = {
+    .id = 1, .name = "abcdefg", .values = { ._length = 5, ._maximum = 5, ._buffer = values }, .label = "", .after = 3
+  };
+  for (size_t i = 0; i < sizeof (tests) / sizeof (tests[0]); i++)
+  {
+    check_eval (tp, tests[i].expr, 0, NULL, &sample, DDSI_RTPS_CDR_ENC_VERSION_1, tests[i].result);
+    check_eval (tp, tests[i].expr, 0, NULL, &sample, DDSI_RTPS_CDR_ENC_VERSION_2, tests[i].result);
+  }
+}
+
+CU_Test(ddsc_filter_expr, mutable, .init = filter_expr_init, .fini = filter_expr_fini)
+{
+  uint8_t blob[] = { 1, 2, 3, 4, 5 };
+  int64_t big = -((int64_t) 1 << 40);
+  const dds_entity_t tp = create_topic (&FilterExprTypes_mutable_type_desc);
+  FilterExprTypes_mutable_type sample = {
+    .id = 9, .blob = { ._length = 5, ._maximum = 5, ._buffer = blob }, .name = "abc", .big = NULL
+  };
+  check_eval (tp, "name = 'abc' AND id = 9", 0, NULL, &sample, DDSI_RTPS_CDR_ENC_VERSION_2, true);
+  check_eval (tp, "big < 0", 0, NULL, &sample, DDSI_RTPS_CDR_ENC_VERSION_2, false);
+  sample.big = &big;
+  check_eval (tp, "big < 0 AND name <> 'abd'", 0, NULL, &sample, DDSI_RTPS_CDR_ENC_VERSION_2, true);
+  check_eval (tp, "big = -1099511627776", 0, NULL, &sample, DDSI_RTPS_CDR_ENC_VERSION_2, true);
+}
+
+CU_Test(ddsc_filter_expr, reader, .init = filter_expr_init, .fini = filter_expr_fini)
+{
+  void *ptrs[MAXSAMPLES] = { NULL };
+  dds_sample_info_t si[MAXSAMPLES];
+  dds_return_t ret;
+  const dds_entity_t tp = create_topic (&FilterExprTypes_variable_type_desc);
+  const dds_entity_t wr = dds_create_writer (g_participant, tp, NULL, NULL);
+  CU_ASSERT_FATAL (wr > 0);
+  const dds_entity_t rd = dds_create_reader (g_participant, tp, NULL, NULL);
+  CU_ASSERT_FATAL (rd > 0);
+
+  const char *params[] = { "'a%'", "BLUE" };
+  ret = dds_set_topic_filter_expression (tp, "name LIKE %0 AND c <> %1", 2, params);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+
+  static const char *names[] = { "abc", "bcd", "a", "xyz" };
+  for (int32_t i = 0; i < 8; i++)
+  {
+    ret = dds_write (wr, &(FilterExprTypes_variable_type){ .id = i, .name = (char *) names[i % 4], .c = (i < 4) ? FilterExprTypes_RED : FilterExprTypes_BLUE });
+    CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  }
+
+  int32_t n = dds_take (rd, ptrs, si, MAXSAMPLES, MAXSAMPLES);
+  CU_ASSERT_EQUAL_FATAL (n, 2);
+  const FilterExprTypes_variable_type *s0 = ptrs[0], *s1 = ptrs[1];
+  CU_ASSERT ((s0->id == 0 && s1->id == 2) || (s0->id == 2 && s1->id == 0));
+  ret = dds_return_loan (rd, ptrs, n);
+  CU_ASSERT_EQUAL (ret, DDS_RETCODE_OK);
+
+  /* removing the expression lets everything through again */
+  ret = dds_set_topic_filter_expression (tp, NULL, 0, NULL);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  ret = dds_write (wr, &(FilterExprTypes_variable_type){ .id = 1, .name = "bcd", .c = FilterExprTypes_BLUE });
+  ptrs[0] = NULL;
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  n = dds_take (rd, ptrs, si, MAXSAMPLES, MAXSAMPLES);
+  CU_ASSERT_EQUAL (n, 1);
+  ret = dds_return_loan (rd, ptrs, n);
+  CU_ASSERT_EQUAL (ret, DDS_RETCODE_OK);
+}
+
+#define WRITER_FILTER_CONFIG \
+  "${CYCLONEDDS_URI}${CYCLONEDDS_URI:+,}<Discovery><ExternalDomainId>0</ExternalDomainId></Discovery>"
+
+static bool writer_filter_matches (dds_entity_t writer, const char *expression, const char *param)
+{
+  /* true iff the writer has a single matched proxy reader, and it has a content filter
+     with the specified expression and parameter that the writer uses */
+  struct dds_entity *wr_entity;
+  bool result = false;
+  CU_ASSERT_EQUAL_FATAL (dds_entity_pin (writer, &wr_entity), 0);
+  struct ddsi_domaingv * const gv = &wr_entity->m_domain->gv;
+  ddsi_thread_state_awake (ddsi_lookup_thread_state (), gv);
+  struct ddsi_writer *wr = ddsi_entidx_lookup_writer_guid (gv->entity_index, &wr_entity->m_guid);
+  CU_ASSERT_FATAL (wr != NULL);
+  ddsi_guid_t prd_guid;
+  bool have_prd = false, filtered = false;
+  ddsrt_mutex_lock (&wr->e.lock);
+  const struct ddsi_wr_prd_match *m = ddsrt_avl_find_min (&ddsi_wr_readers_treedef, &wr->readers);
+  if (wr->num_readers == 1 && m != NULL)
+  {
+    prd_guid = m->prd_guid;
+    have_prd = true;
+    filtered = (m->content_filter != NULL);
+    CU_ASSERT_EQUAL (wr->num_readers_filtered, filtered ? 1u : 0u);
+  }
+  ddsrt_mutex_unlock (&wr->e.lock);
+  struct ddsi_proxy_reader *prd;
+  if (have_prd && (prd = ddsi_entidx_lookup_proxy_reader_guid (gv->entity_index, &prd_guid)) != NULL)
+  {
+    ddsrt_mutex_lock (&prd->e.lock);
+    const ddsi_content_filter_property_t *cfp = prd->content_filter;
+    if (expression == NULL)
+      result = (cfp == NULL && !filtered);
+    else if (cfp != NULL && filtered)
+      result = (strcmp (cfp->filter_expression, expression) == 0 && cfp->expression_parameters.n == 1 &&
+                strcmp (cfp->expression_parameters.strs[0], param) == 0);
+    ddsrt_mutex_unlock (&prd->e.lock);
+  }
+  ddsi_thread_state_asleep (ddsi_lookup_thread_state ());
+  dds_entity_unpin (wr_entity);
+  return result;
+}
+
+static void wait_for_writer_filter (dds_entity_t writer, const char *expression, const char *param)
+{
+  const dds_time_t tend = dds_time () + DDS_SECS (10);
+  while (!writer_filter_matches (writer, expression, param) && dds_time () < tend)
+    dds_sleepfor (DDS_MSECS (10));
+  CU_ASSERT_FATAL (writer_filter_matches (writer, expression, param));
+}
+
+static void write_and_check_ids (dds_entity_t writer, dds_entity_t reader, int32_t nwrite, uint32_t nexpected, int32_t expected_id)
+{
+  /* expected_id < 0: all */
+  dds_return_t ret;
+  for (int32_t i = 0; i < nwrite; i++)
+  {
+    ret = dds_write (writer, &(FilterExprTypes_fixed_type){ .id = i % 10, .level = (int16_t) i });
+    CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  }
+  /* readers that don't get a sample must be sent a GAP for it, else this times out */
+  ret = dds_wait_for_acks (writer, DDS_SECS (10));
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+
+  uint32_t nrecv = 0;
+  const dds_time_t tend = dds_time () + DDS_SECS (2);
+  while (dds_time () < tend)
+  {
+    FilterExprTypes_fixed_type s;
+    void *raw = &s;
+    dds_sample_info_t si;
+    if (dds_take (reader, &raw, &si, 1, 1) != 1)
+      dds_sleepfor (DDS_MSECS (10));
+    else
+    {
+      CU_ASSERT_FATAL (si.valid_data);
+      CU_ASSERT (expected_id < 0 || s.id == expected_id);
+      nrecv++;
+    }
+  }
+  CU_ASSERT_EQUAL (nrecv, nexpected);
+}
+
+CU_Test(ddsc_filter_expr, writer_side, .timeout = 60)
+{
+  char *conf = ddsrt_expand_envvars (WRITER_FILTER_CONFIG, 0);
+  const dds_entity_t pub_dom = dds_create_domain (1, conf);
+  CU_ASSERT_FATAL (pub_dom > 0);
+  const dds_entity_t sub_dom = dds_create_domain (0, conf);
+  CU_ASSERT_FATAL (sub_dom > 0);
+  ddsrt_free (conf);
+  const dds_entity_t pub_pp = dds_create_participant (1, NULL, NULL);
+  CU_ASSERT_FATAL (pub_pp > 0);
+  const dds_entity_t sub_pp = dds_create_participant (0, NULL, NULL);
+  CU_ASSERT_FATAL (sub_pp > 0);
+
+  char name[100];
+  create_unique_topic_name ("ddsc_filter_expr", name, sizeof name);
+  dds_qos_t *qos = dds_create_qos ();
+  dds_qset_reliability (qos, DDS_RELIABILITY_RELIABLE, DDS_INFINITY);
+  dds_qset_history (qos, DDS_HISTORY_KEEP_ALL, 0);
+  const dds_entity_t pub_tp = dds_create_topic (pub_pp, &FilterExprTypes_fixed_type_desc, name, qos, NULL);
+  CU_ASSERT_FATAL (pub_tp > 0);
+  const dds_entity_t sub_tp = dds_create_topic (sub_pp, &FilterExprTypes_fixed_type_desc, name, qos, NULL);
+  CU_ASSERT_FATAL (sub_tp > 0);
+
+  /* the filter is part of the reader's discovery data from the start */
+  dds_return_t ret = dds_set_topic_filter_expression (sub_tp, "id = %0", 1, (const char *[]) { "3" });
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  const dds_entity_t writer = dds_create_writer (pub_pp, pub_tp, qos, NULL);
+  CU_ASSERT_FATAL (writer > 0);
+  const dds_entity_t reader = dds_create_reader (sub_pp, sub_tp, qos, NULL);
+  CU_ASSERT_FATAL (reader > 0);
+  dds_delete_qos (qos);
+  sync_reader_writer (sub_pp, reader, pub_pp, writer);
+  wait_for_writer_filter (writer, "id = %0", "3");
+  write_and_check_ids (writer, reader, 20, 2, 3);
+
+  /* changing the parameter updates the writer */
+  ret = dds_set_topic_filter_expression (sub_tp, "id = %0", 1, (const char *[]) { "4" });
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  wait_for_writer_filter (writer, "id = %0", "4");
+  write_and_check_ids (writer, reader, 10, 1, 4);
+
+  /* and removing the filter makes the writer send everything again */
+  ret = dds_set_topic_filter_expression (sub_tp, NULL, 0, NULL);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  wait_for_writer_filter (writer, NULL, NULL);
+  write_and_check_ids (writer, reader, 10, 10, -1);
+
+  dds_delete (pub_dom);
+  dds_delete (sub_dom);
+}
+
+#undef WRITER_FILTER_CONFIG
+#undef MAXSAMPLES
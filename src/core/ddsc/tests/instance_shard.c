@@ -0,0 +1,249 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include "dds/dds.h"
+#include "dds/ddsrt/heap.h"
+#include "dds/ddsrt/environ.h"
+#include "dds/ddsi/ddsi_entity_index.h"
+#include "ddsi__endpoint_match.h"
+#include "ddsi__thread.h"
+#include "dds__entity.h"
+#include "test_common.h"
+
+#define NSHARDS 3
+#define NINST 30
+
+CU_Test(ddsc_instance_shard, qos)
+{
+  dds_qos_t *qos = dds_create_qos ();
+  uint32_t index, count;
+  CU_ASSERT (!dds_qget_instance_shard (qos, &index, &count));
+  dds_qset_instance_shard (qos, 1, 4);
+  CU_ASSERT_FATAL (dds_qget_instance_shard (qos, &index, &count));
+  CU_ASSERT_EQUAL (index, 1);
+  CU_ASSERT_EQUAL (count, 4);
+  CU_ASSERT (dds_qget_instance_shard (qos, NULL, NULL));
+
+  char name[100];
+  const dds_entity_t pp = dds_create_participant (DDS_DOMAIN_DEFAULT, NULL, NULL);
+  CU_ASSERT_FATAL (pp > 0);
+  const dds_entity_t tp = dds_create_topic (pp, &Space_Type1_desc, create_unique_topic_name ("ddsc_instance_shard", name, sizeof name), NULL, NULL);
+  CU_ASSERT_FATAL (tp > 0);
+  const dds_entity_t rd = dds_create_reader (pp, tp, qos, NULL);
+  CU_ASSERT_FATAL (rd > 0);
+
+  /* a writer QoS doesn't include it, like any other reader-only policy */
+  const dds_entity_t wr = dds_create_writer (pp, tp, qos, NULL);
+  CU_ASSERT_FATAL (wr > 0);
+  dds_qos_t *wrqos = dds_create_qos ();
+  CU_ASSERT_EQUAL_FATAL (dds_get_qos (wr, wrqos), DDS_RETCODE_OK);
+  CU_ASSERT (!dds_qget_instance_shard (wrqos, NULL, NULL));
+  dds_delete_qos (wrqos);
+
+  /* the index must be one of the shards */
+  dds_qset_instance_shard (qos, 4, 4);
+  CU_ASSERT_EQUAL (dds_create_reader (pp, tp, qos, NULL), DDS_RETCODE_BAD_PARAMETER);
+  dds_qset_instance_shard (qos, 0, 0);
+  CU_ASSERT_EQUAL (dds_create_reader (pp, tp, qos, NULL), DDS_RETCODE_BAD_PARAMETER);
+
+  /* nor can it be changed */
+  dds_qset_instance_shard (qos, 2, 4);
+  CU_ASSERT_EQUAL (dds_set_qos (rd, qos), DDS_RETCODE_IMMUTABLE_POLICY);
+  dds_delete_qos (qos);
+  dds_delete (pp);
+}
+
+static void take_keys (dds_entity_t reader, int32_t *shard_of_key, int32_t shard, uint32_t *ndata, uint32_t *ndisposed)
+{
+  Space_Type1 samples[NINST];
+  void *ptrs[NINST];
+  dds_sample_info_t si[NINST];
+  for (int i = 0; i < NINST; i++)
+    ptrs[i] = &samples[i];
+  dds_return_t n;
+  while ((n = dds_take (reader, ptrs, si, NINST, NINST)) > 0)
+  {
+    for (int32_t i = 0; i < n; i++)
+    {
+      const int32_t key = samples[i].long_1;
+      CU_ASSERT_FATAL (key >= 0 && key < NINST);
+      /* every instance goes to exactly one shard, and always to the same one */
+      CU_ASSERT (shard_of_key[key] == -1 || shard_of_key[key] == shard);
+      shard_of_key[key] = shard;
+      if (si[i].valid_data)
+        (*ndata)++;
+      if (si[i].instance_state == DDS_IST_NOT_ALIVE_DISPOSED)
+        (*ndisposed)++;
+    }
+  }
+  CU_ASSERT_FATAL (n == 0);
+}
+
+CU_Test(ddsc_instance_shard, local)
+{
+  char name[100];
+  const dds_entity_t pp = dds_create_participant (DDS_DOMAIN_DEFAULT, NULL, NULL);
+  CU_ASSERT_FATAL (pp > 0);
+  dds_qos_t *qos = dds_create_qos ();
+  dds_qset_reliability (qos, DDS_RELIABILITY_RELIABLE, DDS_INFINITY);
+  dds_qset_history (qos, DDS_HISTORY_KEEP_ALL, 0);
+  const dds_entity_t tp = dds_create_topic (pp, &Space_Type1_desc, create_unique_topic_name ("ddsc_instance_shard", name, sizeof name), qos, NULL);
+  CU_ASSERT_FATAL (tp > 0);
+  const dds_entity_t wr = dds_create_writer (pp, tp, qos, NULL);
+  CU_ASSERT_FATAL (wr > 0);
+  dds_entity_t rds[NSHARDS];
+  for (uint32_t i = 0; i < NSHARDS; i++)
+  {
+    dds_qset_instance_shard (qos, i, NSHARDS);
+    rds[i] = dds_create_reader (pp, tp, qos, NULL);
+    CU_ASSERT_FATAL (rds[i] > 0);
+  }
+  dds_delete_qos (qos);
+
+  int32_t shard_of_key[NINST];
+  for (int i = 0; i < NINST; i++)
+    shard_of_key[i] = -1;
+  for (int32_t i = 0; i < NINST; i++)
+  {
+    dds_return_t ret = dds_write (wr, &(Space_Type1){ .long_1 = i, .long_2 = 0, .long_3 = 0 });
+    CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  }
+  uint32_t ndata = 0, ndisposed = 0;
+  for (int32_t s = 0; s < NSHARDS; s++)
+  {
+    const uint32_t ndata_before = ndata;
+    take_keys (rds[s], shard_of_key, s, &ndata, &ndisposed);
+    /* 30 instances divided over 3 shards: none of them should be empty */
+    CU_ASSERT (ndata > ndata_before);
+  }
+  CU_ASSERT_EQUAL (ndata, NINST);
+  for (int i = 0; i < NINST; i++)
+    CU_ASSERT (shard_of_key[i] >= 0);
+
+  /* updates and disposes follow the same mapping */
+  for (int32_t i = 0; i < NINST; i++)
+  {
+    dds_return_t ret = dds_write (wr, &(Space_Type1){ .long_1 = i, .long_2 = 1, .long_3 = 0 });
+    CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+    ret = dds_dispose (wr, &(Space_Type1){ .long_1 = i, .long_2 = 1, .long_3 = 0 });
+    CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  }
+  ndata = ndisposed = 0;
+  for (int32_t s = 0; s < NSHARDS; s++)
+    take_keys (rds[s], shard_of_key, s, &ndata, &ndisposed);
+  CU_ASSERT_EQUAL (ndata, NINST);
+  CU_ASSERT_EQUAL (ndisposed, NINST);
+  dds_delete (pp);
+}
+
+#define SHARD_CONFIG \
+  "${CYCLONEDDS_URI}${CYCLONEDDS_URI:+,}<Discovery><ExternalDomainId>0</ExternalDomainId></Discovery>"
+
+static bool writer_knows_shards (dds_entity_t writer, uint32_t nshards)
+{
+  /* true iff the writer has nshards matched proxy readers, each with an instance shard */
+  struct dds_entity *wr_entity;
+  CU_ASSERT_EQUAL_FATAL (dds_entity_pin (writer, &wr_entity), 0);
+  struct ddsi_domaingv * const gv = &wr_entity->m_domain->gv;
+  ddsi_thread_state_awake (ddsi_lookup_thread_state (), gv);
+  struct ddsi_writer *wr = ddsi_entidx_lookup_writer_guid (gv->entity_index, &wr_entity->m_guid);
+  CU_ASSERT_FATAL (wr != NULL);
+  uint32_t seen = 0;
+  ddsrt_mutex_lock (&wr->e.lock);
+  ddsrt_avl_iter_t it;
+  for (const struct ddsi_wr_prd_match *m = ddsrt_avl_iter_first (&ddsi_wr_readers_treedef, &wr->readers, &it); m; m = ddsrt_avl_iter_next (&it))
+  {
+    if (m->instance_shard.count == nshards && m->instance_shard.index < nshards)
+      seen |= 1u << m->instance_shard.index;
+  }
+  const bool result = (wr->num_readers == nshards && wr->num_readers_filtered == nshards && seen == (1u << nshards) - 1);
+  ddsrt_mutex_unlock (&wr->e.lock);
+  ddsi_thread_state_asleep (ddsi_lookup_thread_state ());
+  dds_entity_unpin (wr_entity);
+  return result;
+}
+
+CU_Test(ddsc_instance_shard, remote, .timeout = 60)
+{
+  char *conf = ddsrt_expand_envvars (SHARD_CONFIG, 0);
+  const dds_entity_t pub_dom = dds_create_domain (1, conf);
+  CU_ASSERT_FATAL (pub_dom > 0);
+  const dds_entity_t sub_dom = dds_create_domain (0, conf);
+  CU_ASSERT_FATAL (sub_dom > 0);
+  ddsrt_free (conf);
+  const dds_entity_t pub_pp = dds_create_participant (1, NULL, NULL);
+  CU_ASSERT_FATAL (pub_pp > 0);
+  const dds_entity_t sub_pp = dds_create_participant (0, NULL, NULL);
+  CU_ASSERT_FATAL (sub_pp > 0);
+
+  char name[100];
+  create_unique_topic_name ("ddsc_instance_shard", name, sizeof name);
+  dds_qos_t *qos = dds_create_qos ();
+  dds_qset_reliability (qos, DDS_RELIABILITY_RELIABLE, DDS_INFINITY);
+  dds_qset_history (qos, DDS_HISTORY_KEEP_ALL, 0);
+  const dds_entity_t pub_tp = dds_create_topic (pub_pp, &Space_Type1_desc, name, qos, NULL);
+  CU_ASSERT_FATAL (pub_tp > 0);
+  const dds_entity_t sub_tp = dds_create_topic (sub_pp, &Space_Type1_desc, name, qos, NULL);
+  CU_ASSERT_FATAL (sub_tp > 0);
+  const dds_entity_t writer = dds_create_writer (pub_pp, pub_tp, qos, NULL);
+  CU_ASSERT_FATAL (writer > 0);
+  dds_entity_t rds[NSHARDS];
+  for (uint32_t i = 0; i < NSHARDS; i++)
+  {
+    dds_qset_instance_shard (qos, i, NSHARDS);
+    rds[i] = dds_create_reader (sub_pp, sub_tp, qos, NULL);
+    CU_ASSERT_FATAL (rds[i] > 0);
+    sync_reader_writer (sub_pp, rds[i], pub_pp, writer);
+  }
+  dds_delete_qos (qos);
+
+  const dds_time_t tdisc = dds_time () + DDS_SECS (10);
+  while (!writer_knows_shards (writer, NSHARDS) && dds_time () < tdisc)
+    dds_sleepfor (DDS_MSECS (10));
+  CU_ASSERT_FATAL (writer_knows_shards (writer, NSHARDS));
+
+  /* The first round goes to all readers because the writer only sends directed data
+     once the readers have acknowledged, the second round is only sent to the reader of
+     the instance's shard and the others get GAPs */
+  int32_t shard_of_key[NINST];
+  for (int i = 0; i < NINST; i++)
+    shard_of_key[i] = -1;
+  for (int32_t round = 0; round < 2; round++)
+  {
+    for (int32_t i = 0; i < NINST; i++)
+    {
+      dds_return_t ret = dds_write (writer, &(Space_Type1){ .long_1 = i, .long_2 = round, .long_3 = 0 });
+      CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+    }
+    /* readers that don't get a sample must be sent a GAP for it, else this times out */
+    dds_return_t ret = dds_wait_for_acks (writer, DDS_SECS (10));
+    CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+
+    uint32_t ndata = 0, ndisposed = 0;
+    const dds_time_t tend = dds_time () + DDS_SECS (10);
+    while (ndata < NINST && dds_time () < tend)
+    {
+      for (int32_t s = 0; s < NSHARDS; s++)
+        take_keys (rds[s], shard_of_key, s, &ndata, &ndisposed);
+      dds_sleepfor (DDS_MSECS (10));
+    }
+    CU_ASSERT_EQUAL (ndata, NINST);
+    for (int i = 0; i < NINST; i++)
+      CU_ASSERT (shard_of_key[i] >= 0);
+  }
+
+  dds_delete (pub_dom);
+  dds_delete (sub_dom);
+}
+
+#undef SHARD_CONFIG
+#undef NINST
+#undef NSHARDS
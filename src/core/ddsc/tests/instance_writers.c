@@ -0,0 +1,159 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include "dds/dds.h"
+#include "dds/ddsc/dds_rhc.h"
+#include "dds__entity.h"
+#include "test_common.h"
+#include "test_oneliner.h"
+
+// Use no_shm variant because the use of shared memory may result in asynchronous delivery
+// of data published by a local reader/writer and these tests are written on the assumption
+// that it is always synchronous
+#define dotest(ops) CU_ASSERT_FATAL (test_oneliner_no_shm (ops) > 0)
+
+#define MAXSAMPLES 10
+
+CU_Test (ddsc_instance_writers, lost_writer)
+{
+  // Losing a writer must only affect the instances it registered, and of those only the
+  // ones without another live writer become not-alive-no-writers.  Losing each of the
+  // writers in turn checks the writer count of every instance.
+  dotest ("w(ad=n) x(ad=n) y(ad=n) r"
+          "  wr w 1 wr w 2 wr w 3 wr x 2 wr x 3 wr y 3"
+          "  -w read{fun(1,0,0)w,fan(2,0,0)w,fan(2,0,0)x,fan(3,0,0)w,fan(3,0,0)x,fan(3,0,0)y} r"
+          "  -x read{suo(1,0,0)w,suo(2,0,0)w,suo(2,0,0)x,fuo2x,sao(3,0,0)w,sao(3,0,0)x,sao(3,0,0)y} r"
+          "  -y read{suo(1,0,0)w,suo(2,0,0)w,suo(2,0,0)x,suo2x,suo(3,0,0)w,suo(3,0,0)x,suo(3,0,0)y,fuo3y} r");
+  // Same with a writer registering the instance again after having unregistered it
+  dotest ("w(ad=n) x(ad=n) r"
+          "  wr w 1 unreg w 1 wr w 1 wr x 1 wr w 2"
+          "  -x read{fan(1,0,0)w,fan(1,0,0)w,fan(1,0,0)x,fan(2,0,0)w} r"
+          "  -w read{suo(1,0,0)w,suo(1,0,0)w,suo(1,0,0)x,fuo1x,suo(2,0,0)w,fuo2w} r");
+}
+
+CU_Test (ddsc_instance_writers, lost_writer_autodispose)
+{
+  // Auto-disposing on writer loss only disposes the instances of that writer without
+  // another live writer
+  dotest ("w(ad=y) x(ad=y) r"
+          "  wr w 1 wr w 2 wr x 2"
+          "  -w read{fdn(1,0,0)w,fan(2,0,0)w,fan(2,0,0)x} r"
+          "  -x read{sdo(1,0,0)w,sdo(2,0,0)w,sdo(2,0,0)x,fdo2x} r");
+}
+
+static void write_keys (dds_entity_t wr, int32_t nkeys, int32_t x)
+{
+  for (int32_t k = 0; k < nkeys; k++)
+  {
+    dds_return_t ret = dds_write (wr, &(Space_Type1){ k, x, 0 });
+    CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  }
+}
+
+static int32_t take_all (dds_entity_t rd, Space_Type1 *samples, dds_sample_info_t *si)
+{
+  void *ptrs[MAXSAMPLES];
+  for (int i = 0; i < MAXSAMPLES; i++)
+    ptrs[i] = &samples[i];
+  const dds_return_t n = dds_take (rd, ptrs, si, MAXSAMPLES, MAXSAMPLES);
+  CU_ASSERT_FATAL (n >= 0);
+  return n;
+}
+
+CU_Test (ddsc_instance_writers, relinquish_ownership)
+{
+  Space_Type1 samples[MAXSAMPLES];
+  dds_sample_info_t si[MAXSAMPLES];
+  dds_return_t ret;
+  int32_t n;
+  char name[100];
+
+  const dds_entity_t pp = dds_create_participant (DDS_DOMAIN_DEFAULT, NULL, NULL);
+  CU_ASSERT_FATAL (pp > 0);
+  dds_qos_t *qos = dds_create_qos ();
+  CU_ASSERT_PTR_NOT_NULL_FATAL (qos);
+  dds_qset_reliability (qos, DDS_RELIABILITY_RELIABLE, DDS_INFINITY);
+  dds_qset_ownership (qos, DDS_OWNERSHIP_EXCLUSIVE);
+  dds_qset_writer_data_lifecycle (qos, false);
+  const dds_entity_t tp = dds_create_topic (pp, &Space_Type1_desc, create_unique_topic_name ("ddsc_instance_writers", name, sizeof name), qos, NULL);
+  CU_ASSERT_FATAL (tp > 0);
+  const dds_entity_t rd = dds_create_reader (pp, tp, qos, NULL);
+  CU_ASSERT_FATAL (rd > 0);
+  dds_qset_ownership_strength (qos, 10);
+  const dds_entity_t strong = dds_create_writer (pp, tp, qos, NULL);
+  CU_ASSERT_FATAL (strong > 0);
+  dds_qset_ownership_strength (qos, 1);
+  const dds_entity_t weak = dds_create_writer (pp, tp, qos, NULL);
+  CU_ASSERT_FATAL (weak > 0);
+  dds_delete_qos (qos);
+  dds_instance_handle_t strong_ih, weak_ih;
+  ret = dds_get_instance_handle (strong, &strong_ih);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  ret = dds_get_instance_handle (weak, &weak_ih);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+
+  /* strong writer owns all three instances, weak writer's updates are rejected */
+  write_keys (strong, 3, 1);
+  write_keys (weak, 2, 2);
+  n = take_all (rd, samples, si);
+  CU_ASSERT_EQUAL_FATAL (n, 3);
+  for (int32_t i = 0; i < n; i++)
+    CU_ASSERT (samples[i].long_2 == 1 && si[i].publication_handle == strong_ih);
+
+  /* once the strong writer relinquishes ownership, the weak one takes over the instances
+     it writes, the strong writer remains registered for all of them */
+  struct dds_entity *x;
+  ret = dds_entity_pin (rd, &x);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  dds_rhc_relinquish_ownership (((struct dds_reader *) x)->m_rhc, strong_ih);
+  dds_entity_unpin (x);
+  write_keys (weak, 2, 3);
+  n = take_all (rd, samples, si);
+  CU_ASSERT_EQUAL_FATAL (n, 2);
+  for (int32_t i = 0; i < n; i++)
+  {
+    CU_ASSERT (samples[i].long_2 == 3 && si[i].publication_handle == weak_ih);
+    CU_ASSERT (si[i].instance_state == DDS_ALIVE_INSTANCE_STATE);
+  }
+
+  /* relinquishing doesn't lower the strength, so the strong writer can take it back */
+  write_keys (strong, 1, 4);
+  write_keys (weak, 1, 5);
+  n = take_all (rd, samples, si);
+  CU_ASSERT_EQUAL_FATAL (n, 1);
+  CU_ASSERT (samples[0].long_2 == 4 && si[0].publication_handle == strong_ih);
+
+  /* losing the strong writer leaves the instances also registered by the weak one alive,
+     the one that only the strong writer registered has no writers left */
+  ret = dds_delete (strong);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  n = take_all (rd, samples, si);
+  CU_ASSERT_EQUAL_FATAL (n, 1);
+  CU_ASSERT (samples[0].long_1 == 2 && !si[0].valid_data);
+  CU_ASSERT (si[0].instance_state == DDS_NOT_ALIVE_NO_WRITERS_INSTANCE_STATE);
+  write_keys (weak, 2, 6);
+  n = take_all (rd, samples, si);
+  CU_ASSERT_EQUAL_FATAL (n, 2);
+  for (int32_t i = 0; i < n; i++)
+    CU_ASSERT (samples[i].long_2 == 6 && si[i].instance_state == DDS_ALIVE_INSTANCE_STATE);
+
+  ret = dds_delete (weak);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  n = take_all (rd, samples, si);
+  CU_ASSERT_EQUAL_FATAL (n, 2);
+  for (int32_t i = 0; i < n; i++)
+    CU_ASSERT (!si[i].valid_data && si[i].instance_state == DDS_NOT_ALIVE_NO_WRITERS_INSTANCE_STATE);
+
+  ret = dds_delete (pp);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+}
+
+#undef MAXSAMPLES
@@ -319,3 +319,90 @@ CU_Test (ddsc_loan, read_cleanup, .init = create_entities, .fini = delete_entiti
   result = dds_return_loan (reader, ptrs, n);
   CU_ASSERT_FATAL (result == DDS_RETCODE_OK);
 }
+
+CU_Test (ddsc_loan, pool_qos, .init = create_entities, .fini = delete_entities)
+{
+  dds_qos_t *qos = dds_create_qos ();
+  uint32_t depth;
+  CU_ASSERT (!dds_qget_reader_loan_pool (qos, &depth));
+  dds_qset_reader_loan_pool (qos, 3);
+  CU_ASSERT_FATAL (dds_qget_reader_loan_pool (qos, &depth));
+  CU_ASSERT (depth == 3);
+
+  const dds_entity_t rd = dds_create_reader (participant, topic, qos, NULL);
+  CU_ASSERT_FATAL (rd > 0);
+  dds_qos_t *rdqos = dds_create_qos ();
+  CU_ASSERT_FATAL (dds_get_qos (rd, rdqos) == DDS_RETCODE_OK);
+  CU_ASSERT (dds_qget_reader_loan_pool (rdqos, &depth) && depth == 3);
+  dds_delete_qos (rdqos);
+
+  dds_qset_reader_loan_pool (qos, 0);
+  CU_ASSERT (dds_create_reader (participant, topic, qos, NULL) == DDS_RETCODE_BAD_PARAMETER);
+  dds_qset_reader_loan_pool (qos, DDS_READER_LOAN_POOL_MAX_DEPTH + 1);
+  CU_ASSERT (dds_create_reader (participant, topic, qos, NULL) == DDS_RETCODE_BAD_PARAMETER);
+  dds_qset_reader_loan_pool (qos, UINT32_MAX);
+  CU_ASSERT (dds_create_reader (participant, topic, qos, NULL) == DDS_RETCODE_BAD_PARAMETER);
+  dds_qset_reader_loan_pool (qos, 2);
+  CU_ASSERT (dds_set_qos (rd, qos) == DDS_RETCODE_IMMUTABLE_POLICY);
+  dds_delete_qos (qos);
+}
+
+CU_Test (ddsc_loan, pool, .init = create_entities, .fini = delete_entities)
+{
+  const RoundTripModule_DataType s = {
+    .payload = {
+      ._length = 1,
+      ._buffer = (uint8_t[]) { 'a' }
+    }
+  };
+  dds_return_t result;
+  dds_qos_t *qos = dds_create_qos ();
+  dds_qset_reader_loan_pool (qos, 2);
+  const dds_entity_t rd = dds_create_reader (participant, topic, qos, NULL);
+  CU_ASSERT_FATAL (rd > 0);
+  dds_delete_qos (qos);
+
+  /* rely on things like address sanitizer, valgrind for detecting double frees and leaks */
+  void *ptrs[3][2] = { { NULL } };
+  int32_t n[3];
+  dds_sample_info_t si[2];
+  for (int i = 0; i < 6; i++)
+  {
+    result = dds_write (writer, &s);
+    CU_ASSERT_FATAL (result == 0);
+  }
+
+  /* two batches can be out at the same time, each in its own loan */
+  n[0] = dds_take (rd, ptrs[0], si, 2, 2);
+  CU_ASSERT_FATAL (n[0] == 2);
+  n[1] = dds_take (rd, ptrs[1], si, 2, 2);
+  CU_ASSERT_FATAL (n[1] == 2);
+  CU_ASSERT_FATAL (ptrs[0][0] != NULL && ptrs[1][0] != NULL && ptrs[0][0] != ptrs[1][0]);
+  void * const loan0 = ptrs[0][0], * const loan1 = ptrs[1][0];
+
+  /* with the pool exhausted, it falls back to allocating */
+  n[2] = dds_take (rd, ptrs[2], si, 2, 2);
+  CU_ASSERT_FATAL (n[2] == 2);
+  CU_ASSERT_FATAL (ptrs[2][0] != loan0 && ptrs[2][0] != loan1);
+  result = dds_return_loan (rd, ptrs[2], n[2]);
+  CU_ASSERT_FATAL (result == DDS_RETCODE_OK);
+
+  /* returning the first makes it available again, while the second stays out */
+  result = dds_return_loan (rd, ptrs[0], n[0]);
+  CU_ASSERT_FATAL (result == DDS_RETCODE_OK);
+  result = dds_write (writer, &s);
+  CU_ASSERT_FATAL (result == 0);
+  n[0] = dds_take (rd, ptrs[0], si, 2, 2);
+  CU_ASSERT_FATAL (n[0] == 1);
+  CU_ASSERT_FATAL (ptrs[0][0] == loan0);
+  CU_ASSERT_FATAL (((const RoundTripModule_DataType *) ptrs[1][0])->payload._buffer[0] == 'a');
+
+  /* returning a loan twice is still an error */
+  void *again[2] = { loan1, NULL };
+  result = dds_return_loan (rd, ptrs[1], n[1]);
+  CU_ASSERT_FATAL (result == DDS_RETCODE_OK);
+  result = dds_return_loan (rd, again, n[1]);
+  CU_ASSERT (result == DDS_RETCODE_PRECONDITION_NOT_MET);
+  result = dds_return_loan (rd, ptrs[0], n[0]);
+  CU_ASSERT_FATAL (result == DDS_RETCODE_OK);
+}
@@ -1549,3 +1549,51 @@ CU_Test(ddsc_querycondition_take, some_from_instance, .init=querycondition_init_
     CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
 }
 /*************************************************************************************************/
+
+/*************************************************************************************************/
+CU_Test(ddsc_querycondition_take, shared_filter, .init=querycondition_init, .fini=querycondition_fini)
+{
+    /* conditions with the same filter share the evaluation, but must still track their own states */
+    dds_entity_t cond_any, cond_notread;
+    dds_return_t ret;
+
+    cond_any = dds_create_querycondition(g_reader, DDS_ANY_STATE, filter_mod2);
+    CU_ASSERT_FATAL(cond_any > 0);
+    cond_notread = dds_create_querycondition(g_reader, DDS_NOT_READ_SAMPLE_STATE | DDS_ANY_VIEW_STATE | DDS_ANY_INSTANCE_STATE, filter_mod2);
+    CU_ASSERT_FATAL(cond_notread > 0);
+
+    /* even long_1: 0, 2 read, 4, 6 not read */
+    ret = dds_read(cond_notread, g_samples, g_info, MAX_SAMPLES, MAX_SAMPLES);
+    CU_ASSERT_EQUAL_FATAL(ret, 2);
+    CU_ASSERT_EQUAL(dds_triggered(cond_notread), 0);
+    CU_ASSERT_EQUAL(dds_triggered(cond_any), 1);
+    ret = dds_take(cond_any, g_samples, g_info, MAX_SAMPLES, MAX_SAMPLES);
+    CU_ASSERT_EQUAL_FATAL(ret, 4);
+    CU_ASSERT_EQUAL(dds_triggered(cond_any), 0);
+
+    /* a new sample matching the filter triggers both, one that doesn't match neither */
+    ret = dds_write(g_writer, &(Space_Type1){ 9, 0, 0 });
+    CU_ASSERT_EQUAL_FATAL(ret, DDS_RETCODE_OK);
+    CU_ASSERT_EQUAL(dds_triggered(cond_any), 0);
+    CU_ASSERT_EQUAL(dds_triggered(cond_notread), 0);
+    ret = dds_write(g_writer, &(Space_Type1){ 8, 0, 0 });
+    CU_ASSERT_EQUAL_FATAL(ret, DDS_RETCODE_OK);
+    CU_ASSERT_EQUAL(dds_triggered(cond_any), 1);
+    CU_ASSERT_EQUAL(dds_triggered(cond_notread), 1);
+
+    /* deleting one leaves the other intact */
+    ret = dds_delete(cond_any);
+    CU_ASSERT_EQUAL_FATAL(ret, DDS_RETCODE_OK);
+    ret = dds_write(g_writer, &(Space_Type1){ 10, 0, 0 });
+    CU_ASSERT_EQUAL_FATAL(ret, DDS_RETCODE_OK);
+    ret = dds_take(cond_notread, g_samples, g_info, MAX_SAMPLES, MAX_SAMPLES);
+    CU_ASSERT_EQUAL_FATAL(ret, 2);
+    for (int i = 0; i < ret; i++) {
+        CU_ASSERT(g_data[i].long_1 == 8 || g_data[i].long_1 == 10);
+    }
+    CU_ASSERT_EQUAL(dds_triggered(cond_notread), 0);
+
+    ret = dds_delete(cond_notread);
+    CU_ASSERT_EQUAL_FATAL(ret, DDS_RETCODE_OK);
+}
+/*************************************************************************************************/
@@ -0,0 +1,135 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include "dds/dds.h"
+#include "dds/ddsc/dds_statistics.h"
+#include "dds/ddsc/dds_rhc.h"
+#include "dds__entity.h"
+#include "dds__topic.h"
+#include "dds__rhc_default.h"
+#include "test_common.h"
+
+#define MAX_INSTANCES 100
+#define MAX_SAMPLES 1000
+
+static uint32_t get_u32 (struct dds_statistics *stat, const char *name)
+{
+  dds_return_t ret = dds_refresh_statistics (stat);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  const struct dds_stat_keyvalue *kv = dds_lookup_statistic (stat, name);
+  CU_ASSERT_PTR_NOT_NULL_FATAL (kv);
+  CU_ASSERT_EQUAL_FATAL (kv->kind, DDS_STAT_KIND_UINT32);
+  return kv->u.u32;
+}
+
+CU_Test(ddsc_statistics, reader_pools)
+{
+  char name[100];
+  dds_return_t ret;
+  const dds_entity_t pp = dds_create_participant (DDS_DOMAIN_DEFAULT, NULL, NULL);
+  CU_ASSERT_FATAL (pp > 0);
+  dds_qos_t *qos = dds_create_qos ();
+  CU_ASSERT_PTR_NOT_NULL_FATAL (qos);
+  dds_qset_history (qos, DDS_HISTORY_KEEP_ALL, DDS_LENGTH_UNLIMITED);
+  dds_qset_reliability (qos, DDS_RELIABILITY_RELIABLE, DDS_INFINITY);
+  dds_qset_resource_limits (qos, MAX_SAMPLES, MAX_INSTANCES, DDS_LENGTH_UNLIMITED);
+  const dds_entity_t tp = dds_create_topic (pp, &Space_Type1_desc, create_unique_topic_name ("ddsc_statistics", name, sizeof name), qos, NULL);
+  CU_ASSERT_FATAL (tp > 0);
+  const dds_entity_t wr = dds_create_writer (pp, tp, qos, NULL);
+  CU_ASSERT_FATAL (wr > 0);
+  const dds_entity_t rd = dds_create_reader (pp, tp, qos, NULL);
+  CU_ASSERT_FATAL (rd > 0);
+  dds_delete_qos (qos);
+
+  struct dds_statistics *stat = dds_create_statistics (rd);
+  CU_ASSERT_PTR_NOT_NULL_FATAL (stat);
+
+  /* pools are filled according to the resource limits when the reader is created */
+  const uint32_t instance_pool_size = get_u32 (stat, "rhc_instance_pool_size");
+  const uint32_t sample_pool_size = get_u32 (stat, "rhc_sample_pool_size");
+  CU_ASSERT (instance_pool_size >= MAX_INSTANCES);
+  CU_ASSERT (sample_pool_size >= MAX_SAMPLES);
+  CU_ASSERT_EQUAL (get_u32 (stat, "rhc_instance_pool_used"), 0);
+  CU_ASSERT_EQUAL (get_u32 (stat, "rhc_sample_pool_used"), 0);
+
+  for (int32_t i = 0; i < MAX_SAMPLES; i++)
+  {
+    ret = dds_write (wr, &(Space_Type1){ i % MAX_INSTANCES, 0, i });
+    CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  }
+  CU_ASSERT_EQUAL (get_u32 (stat, "rhc_instance_pool_used"), MAX_INSTANCES);
+  CU_ASSERT (get_u32 (stat, "rhc_sample_pool_used") > 0);
+
+  /* and don't grow or shrink in the steady state */
+  for (int round = 0; round < 3; round++)
+  {
+    Space_Type1 sample;
+    void *raw[1] = { &sample };
+    dds_sample_info_t si;
+    int32_t n;
+    while ((n = dds_take (rd, raw, &si, 1, 1)) > 0)
+      ;
+    CU_ASSERT_EQUAL_FATAL (n, 0);
+    CU_ASSERT_EQUAL (get_u32 (stat, "rhc_sample_pool_used"), 0);
+    for (int32_t i = 0; i < MAX_SAMPLES; i++)
+    {
+      ret = dds_write (wr, &(Space_Type1){ i % MAX_INSTANCES, 0, i });
+      CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+    }
+  }
+  CU_ASSERT_EQUAL (get_u32 (stat, "rhc_instance_pool_size"), instance_pool_size);
+  CU_ASSERT_EQUAL (get_u32 (stat, "rhc_sample_pool_size"), sample_pool_size);
+
+  dds_delete_statistics (stat);
+  ret = dds_delete (pp);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+}
+
+static struct dds_rhc_ops rhc_ops_without_stats;
+
+CU_Test(ddsc_statistics, reader_custom_rhc)
+{
+  /* get_stats is optional for an RHC provided by the application, it then reports 0 */
+  char name[100];
+  dds_return_t ret;
+  const dds_entity_t pp = dds_create_participant (DDS_DOMAIN_DEFAULT, NULL, NULL);
+  CU_ASSERT_FATAL (pp > 0);
+  const dds_entity_t tp = dds_create_topic (pp, &Space_Type1_desc, create_unique_topic_name ("ddsc_statistics", name, sizeof name), NULL, NULL);
+  CU_ASSERT_FATAL (tp > 0);
+  struct dds_topic *x;
+  ret = dds_topic_pin (tp, &x);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  struct dds_rhc *rhc = dds_rhc_default_new_xchecks (NULL, &x->m_entity.m_domain->gv, x->m_stype, false);
+  dds_topic_unpin (x);
+  rhc_ops_without_stats = *rhc->common.ops;
+  rhc_ops_without_stats.get_stats = 0;
+  rhc->common.ops = &rhc_ops_without_stats;
+  const dds_entity_t rd = dds_create_reader_rhc (pp, tp, NULL, NULL, rhc);
+  CU_ASSERT_FATAL (rd > 0);
+  const dds_entity_t wr = dds_create_writer (pp, tp, NULL, NULL);
+  CU_ASSERT_FATAL (wr > 0);
+  ret = dds_write (wr, &(Space_Type1){ 1, 0, 0 });
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+
+  struct dds_statistics *stat = dds_create_statistics (rd);
+  CU_ASSERT_PTR_NOT_NULL_FATAL (stat);
+  CU_ASSERT_EQUAL (get_u32 (stat, "rhc_instance_pool_size"), 0);
+  CU_ASSERT_EQUAL (get_u32 (stat, "rhc_instance_pool_used"), 0);
+  CU_ASSERT_EQUAL (get_u32 (stat, "rhc_sample_pool_size"), 0);
+  CU_ASSERT_EQUAL (get_u32 (stat, "rhc_sample_pool_used"), 0);
+  dds_delete_statistics (stat);
+
+  ret = dds_delete (pp);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+}
+
+#undef MAX_SAMPLES
+#undef MAX_INSTANCES
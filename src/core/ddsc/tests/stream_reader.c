@@ -0,0 +1,257 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "dds/dds.h"
+#include "dds/ddsrt/threads.h"
+#include "dds/ddsi/ddsi_serdata.h"
+#include "test_common.h"
+
+#define CAPACITY 100
+#define BATCH 30
+
+static dds_entity_t g_participant = 0;
+static dds_entity_t g_topic = 0;
+static dds_entity_t g_reader = 0;
+static dds_entity_t g_writer = 0;
+
+static dds_entity_t create_stream_reader (dds_reliability_kind_t reliability, uint32_t capacity)
+{
+  dds_qos_t *qos = dds_create_qos ();
+  dds_qset_reliability (qos, reliability, DDS_INFINITY);
+  dds_qset_history (qos, DDS_HISTORY_KEEP_ALL, 0);
+  dds_qset_reader_stream (qos, capacity);
+  const dds_entity_t rd = dds_create_reader (g_participant, g_topic, qos, NULL);
+  dds_delete_qos (qos);
+  return rd;
+}
+
+static void stream_reader_init (void)
+{
+  char name[100];
+  g_participant = dds_create_participant (DDS_DOMAIN_DEFAULT, NULL, NULL);
+  CU_ASSERT_FATAL (g_participant > 0);
+  g_topic = dds_create_topic (g_participant, &Space_Type3_desc, create_unique_topic_name ("ddsc_stream_reader", name, sizeof name), NULL, NULL);
+  CU_ASSERT_FATAL (g_topic > 0);
+  g_reader = create_stream_reader (DDS_RELIABILITY_RELIABLE, CAPACITY);
+  CU_ASSERT_FATAL (g_reader > 0);
+  dds_qos_t *qos = dds_create_qos ();
+  dds_qset_reliability (qos, DDS_RELIABILITY_RELIABLE, DDS_INFINITY);
+  dds_qset_history (qos, DDS_HISTORY_KEEP_ALL, 0);
+  g_writer = dds_create_writer (g_participant, g_topic, qos, NULL);
+  CU_ASSERT_FATAL (g_writer > 0);
+  dds_delete_qos (qos);
+}
+
+static void stream_reader_fini (void)
+{
+  dds_delete (g_participant);
+}
+
+static void write_samples (dds_entity_t wr, int32_t from, int32_t n)
+{
+  for (int32_t i = from; i < from + n; i++)
+  {
+    Space_Type3 sample = { i, 2 * i, 3 * i };
+    CU_ASSERT_EQUAL_FATAL (dds_write (wr, &sample), DDS_RETCODE_OK);
+  }
+}
+
+CU_Test(ddsc_stream_reader, take, .init = stream_reader_init, .fini = stream_reader_fini)
+{
+  Space_Type3 samples[BATCH];
+  void *buf[BATCH];
+  for (int i = 0; i < BATCH; i++)
+    buf[i] = &samples[i];
+
+  write_samples (g_writer, 0, CAPACITY);
+  int32_t next = 0;
+  dds_return_t n;
+  while ((n = dds_take_stream (g_reader, buf, BATCH)) > 0)
+  {
+    CU_ASSERT_FATAL (n <= BATCH);
+    for (int32_t i = 0; i < n; i++, next++)
+      CU_ASSERT (samples[i].long_1 == next && samples[i].long_2 == 2 * next && samples[i].long_3 == 3 * next);
+  }
+  CU_ASSERT_EQUAL (n, 0);
+  CU_ASSERT_EQUAL (next, CAPACITY);
+
+  /* serialized samples */
+  struct ddsi_serdata *sds[BATCH];
+  write_samples (g_writer, 0, 10);
+  CU_ASSERT_EQUAL_FATAL (dds_takecdr_stream (g_reader, sds, BATCH), 10);
+  for (int32_t i = 0; i < 10; i++)
+  {
+    Space_Type3 s;
+    CU_ASSERT_FATAL (ddsi_serdata_to_sample (sds[i], &s, NULL, NULL));
+    CU_ASSERT (s.long_1 == i);
+    ddsi_serdata_unref (sds[i]);
+  }
+
+  /* the regular take operations work, too, with a minimal sample info */
+  dds_sample_info_t si[BATCH];
+  dds_instance_handle_t wrih;
+  CU_ASSERT_EQUAL_FATAL (dds_get_instance_handle (g_writer, &wrih), DDS_RETCODE_OK);
+  write_samples (g_writer, 0, 10);
+  CU_ASSERT_EQUAL (dds_take_mask (g_reader, buf, si, BATCH, BATCH, DDS_READ_SAMPLE_STATE), 0);
+  CU_ASSERT_EQUAL_FATAL (dds_take (g_reader, buf, si, BATCH, BATCH), 10);
+  for (int32_t i = 0; i < 10; i++)
+  {
+    CU_ASSERT (samples[i].long_1 == i);
+    CU_ASSERT (si[i].valid_data && si[i].sample_state == DDS_SST_NOT_READ && si[i].instance_state == DDS_IST_ALIVE);
+    CU_ASSERT (si[i].instance_handle != 0 && si[i].publication_handle == wrih);
+  }
+
+  /* taking with a loan */
+  void *lbuf[BATCH] = { NULL };
+  write_samples (g_writer, 0, 5);
+  CU_ASSERT_EQUAL_FATAL (dds_take (g_reader, lbuf, si, BATCH, BATCH), 5);
+  CU_ASSERT (((Space_Type3 *) lbuf[4])->long_1 == 4);
+  CU_ASSERT_EQUAL (dds_return_loan (g_reader, lbuf, 5), DDS_RETCODE_OK);
+}
+
+CU_Test(ddsc_stream_reader, unsupported, .init = stream_reader_init, .fini = stream_reader_fini)
+{
+  Space_Type3 sample;
+  void *buf[1] = { &sample };
+  dds_sample_info_t si[1];
+  struct ddsi_serdata *sd;
+
+  write_samples (g_writer, 0, 1);
+  CU_ASSERT_EQUAL (dds_read (g_reader, buf, si, 1, 1), DDS_RETCODE_ILLEGAL_OPERATION);
+  CU_ASSERT_EQUAL (dds_readcdr (g_reader, &sd, 1, si, 0), DDS_RETCODE_ILLEGAL_OPERATION);
+  CU_ASSERT_EQUAL (dds_take_instance (g_reader, buf, si, 1, 1, 1), DDS_RETCODE_ILLEGAL_OPERATION);
+  CU_ASSERT_EQUAL (dds_create_readcondition (g_reader, DDS_ANY_STATE), DDS_RETCODE_ILLEGAL_OPERATION);
+  CU_ASSERT_EQUAL (dds_create_querycondition (g_reader, DDS_ANY_STATE, 0), DDS_RETCODE_ILLEGAL_OPERATION);
+  CU_ASSERT_EQUAL (dds_take_stream (g_reader, buf, 1), 1);
+
+  CU_ASSERT_EQUAL (dds_take_stream (g_reader, NULL, 1), DDS_RETCODE_BAD_PARAMETER);
+  CU_ASSERT_EQUAL (dds_take_stream (g_reader, buf, 0), DDS_RETCODE_BAD_PARAMETER);
+  CU_ASSERT_EQUAL (dds_takecdr_stream (g_reader, NULL, 1), DDS_RETCODE_BAD_PARAMETER);
+  CU_ASSERT_EQUAL (dds_take_stream (g_writer, buf, 1), DDS_RETCODE_ILLEGAL_OPERATION);
+  CU_ASSERT_EQUAL (dds_takecdr_stream (g_writer, &sd, 1), DDS_RETCODE_ILLEGAL_OPERATION);
+  const dds_entity_t rd = dds_create_reader (g_participant, g_topic, NULL, NULL);
+  CU_ASSERT_FATAL (rd > 0);
+  CU_ASSERT_EQUAL (dds_take_stream (rd, buf, 1), DDS_RETCODE_ILLEGAL_OPERATION);
+}
+
+CU_Test(ddsc_stream_reader, qos, .init = stream_reader_init, .fini = stream_reader_fini)
+{
+  char name[100];
+  uint32_t capacity;
+  dds_qos_t *qos = dds_create_qos ();
+  CU_ASSERT (!dds_qget_reader_stream (qos, &capacity));
+  dds_qset_reader_stream (qos, 3);
+  CU_ASSERT_FATAL (dds_qget_reader_stream (qos, &capacity));
+  CU_ASSERT_EQUAL (capacity, 3);
+  dds_delete_qos (qos);
+
+  CU_ASSERT_FATAL ((qos = dds_create_qos ()) != NULL);
+  CU_ASSERT_EQUAL_FATAL (dds_get_qos (g_reader, qos), DDS_RETCODE_OK);
+  CU_ASSERT_FATAL (dds_qget_reader_stream (qos, &capacity));
+  CU_ASSERT_EQUAL (capacity, CAPACITY);
+  dds_qset_reader_stream (qos, 2 * CAPACITY);
+  CU_ASSERT_EQUAL (dds_set_qos (g_reader, qos), DDS_RETCODE_IMMUTABLE_POLICY);
+  dds_delete_qos (qos);
+
+  CU_ASSERT_EQUAL (create_stream_reader (DDS_RELIABILITY_RELIABLE, 0), DDS_RETCODE_BAD_PARAMETER);
+  CU_ASSERT_EQUAL (create_stream_reader (DDS_RELIABILITY_RELIABLE, DDS_READER_STREAM_MAX_CAPACITY + 1), DDS_RETCODE_BAD_PARAMETER);
+  CU_ASSERT_EQUAL (create_stream_reader (DDS_RELIABILITY_RELIABLE, UINT32_MAX), DDS_RETCODE_BAD_PARAMETER);
+
+  /* requires KEEP_ALL */
+  qos = dds_create_qos ();
+  dds_qset_reader_stream (qos, CAPACITY);
+  CU_ASSERT_EQUAL (dds_create_reader (g_participant, g_topic, qos, NULL), DDS_RETCODE_INCONSISTENT_POLICY);
+
+  /* requires a keyless topic */
+  dds_qset_history (qos, DDS_HISTORY_KEEP_ALL, 0);
+  const dds_entity_t tp = dds_create_topic (g_participant, &Space_Type1_desc, create_unique_topic_name ("ddsc_stream_reader", name, sizeof name), NULL, NULL);
+  CU_ASSERT_FATAL (tp > 0);
+  CU_ASSERT_EQUAL (dds_create_reader (g_participant, tp, qos, NULL), DDS_RETCODE_INCONSISTENT_POLICY);
+  dds_delete_qos (qos);
+}
+
+CU_Test(ddsc_stream_reader, best_effort_full, .init = stream_reader_init, .fini = stream_reader_fini)
+{
+  /* capacity gets rounded up to 4, anything beyond that is rejected */
+  const dds_entity_t rd = create_stream_reader (DDS_RELIABILITY_BEST_EFFORT, 3);
+  CU_ASSERT_FATAL (rd > 0);
+  write_samples (g_writer, 0, 10);
+
+  Space_Type3 samples[10];
+  void *buf[10];
+  for (int i = 0; i < 10; i++)
+    buf[i] = &samples[i];
+  CU_ASSERT_EQUAL_FATAL (dds_take_stream (rd, buf, 10), 4);
+  for (int32_t i = 0; i < 4; i++)
+    CU_ASSERT (samples[i].long_1 == i);
+  dds_sample_rejected_status_t st;
+  CU_ASSERT_EQUAL_FATAL (dds_get_sample_rejected_status (rd, &st), DDS_RETCODE_OK);
+  CU_ASSERT_EQUAL (st.total_count, 6);
+  CU_ASSERT_EQUAL (st.last_reason, DDS_REJECTED_BY_SAMPLES_LIMIT);
+
+  /* the reliable one still has all of them */
+  CU_ASSERT_EQUAL (dds_take_stream (g_reader, buf, 10), 10);
+}
+
+CU_Test(ddsc_stream_reader, data_available, .init = stream_reader_init, .fini = stream_reader_fini)
+{
+  const dds_entity_t ws = dds_create_waitset (g_participant);
+  CU_ASSERT_FATAL (ws > 0);
+  CU_ASSERT_EQUAL_FATAL (dds_set_status_mask (g_reader, DDS_DATA_AVAILABLE_STATUS), DDS_RETCODE_OK);
+  CU_ASSERT_EQUAL_FATAL (dds_waitset_attach (ws, g_reader, 0), DDS_RETCODE_OK);
+  CU_ASSERT_EQUAL (dds_waitset_wait (ws, NULL, 0, 0), 0);
+  write_samples (g_writer, 0, 1);
+  CU_ASSERT_EQUAL (dds_waitset_wait (ws, NULL, 0, 0), 1);
+
+  Space_Type3 sample;
+  void *buf[1] = { &sample };
+  CU_ASSERT_EQUAL (dds_take_stream (g_reader, buf, 1), 1);
+  CU_ASSERT_EQUAL (dds_waitset_wait (ws, NULL, 0, 0), 0);
+}
+
+#define NSTREAM 20000
+
+static uint32_t writer_thread (void *varg)
+{
+  const dds_entity_t *wr = varg;
+  write_samples (*wr, 0, NSTREAM);
+  return 0;
+}
+
+CU_Test(ddsc_stream_reader, concurrent, .init = stream_reader_init, .fini = stream_reader_fini)
+{
+  /* a reliable writer blocks while the ring is full, so all samples arrive in order even
+     though the ring is much smaller than the number of samples */
+  ddsrt_threadattr_t tattr;
+  ddsrt_thread_t tid;
+  ddsrt_threadattr_init (&tattr);
+  CU_ASSERT_EQUAL_FATAL (ddsrt_thread_create (&tid, "stream_writer", &tattr, writer_thread, &g_writer), DDS_RETCODE_OK);
+
+  Space_Type3 samples[BATCH];
+  void *buf[BATCH];
+  for (int i = 0; i < BATCH; i++)
+    buf[i] = &samples[i];
+  int32_t next = 0;
+  while (next < NSTREAM)
+  {
+    const dds_return_t n = dds_take_stream (g_reader, buf, BATCH);
+    CU_ASSERT_FATAL (n >= 0);
+    for (int32_t i = 0; i < n; i++, next++)
+      CU_ASSERT_FATAL (samples[i].long_1 == next && samples[i].long_3 == 3 * next);
+    if (n == 0)
+      dds_sleepfor (DDS_USECS (100));
+  }
+  CU_ASSERT_EQUAL (ddsrt_thread_join (tid, NULL), DDS_RETCODE_OK);
+  CU_ASSERT_EQUAL (dds_take_stream (g_reader, buf, BATCH), 0);
+}
@@ -0,0 +1,240 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "dds/dds.h"
+#include "test_common.h"
+
+#define NSAMPLES 100
+#define BATCH 30
+#define NSTRINGS 5
+
+static dds_entity_t g_participant = 0;
+static dds_entity_t g_topic = 0;
+static dds_entity_t g_reader = 0;
+static dds_entity_t g_writer = 0;
+
+static void take_arena_init (void)
+{
+  char name[100];
+  g_participant = dds_create_participant (DDS_DOMAIN_DEFAULT, NULL, NULL);
+  CU_ASSERT_FATAL (g_participant > 0);
+  g_topic = dds_create_topic (g_participant, &Space_arenatype_desc, create_unique_topic_name ("ddsc_take_arena", name, sizeof name), NULL, NULL);
+  CU_ASSERT_FATAL (g_topic > 0);
+  dds_qos_t *qos = dds_create_qos ();
+  dds_qset_reliability (qos, DDS_RELIABILITY_RELIABLE, DDS_INFINITY);
+  dds_qset_history (qos, DDS_HISTORY_KEEP_ALL, 0);
+  dds_qset_writer_data_lifecycle (qos, false);
+  g_reader = dds_create_reader (g_participant, g_topic, qos, NULL);
+  CU_ASSERT_FATAL (g_reader > 0);
+  g_writer = dds_create_writer (g_participant, g_topic, qos, NULL);
+  CU_ASSERT_FATAL (g_writer > 0);
+  dds_delete_qos (qos);
+}
+
+static void take_arena_fini (void)
+{
+  dds_delete (g_participant);
+}
+
+static void write_sample (int i, size_t slen)
+{
+  char key[20], *strs[NSTRINGS];
+  int32_t longs[NSTRINGS];
+  char *s = dds_alloc (slen + 1);
+  (void) snprintf (key, sizeof (key), "k%d", i);
+  memset (s, 'a' + (i % 26), slen);
+  s[slen] = 0;
+  for (int j = 0; j < NSTRINGS; j++)
+  {
+    strs[j] = dds_alloc (12);
+    (void) snprintf (strs[j], 12, "%d.%d", i, j);
+    longs[j] = i * NSTRINGS + j;
+  }
+  Space_arenatype sample = {
+    .k = key, .s = s,
+    .ss = { ._length = NSTRINGS, ._maximum = NSTRINGS, ._buffer = strs },
+    .sl = { ._length = NSTRINGS, ._maximum = NSTRINGS, ._buffer = longs }
+  };
+  CU_ASSERT_EQUAL_FATAL (dds_write (g_writer, &sample), DDS_RETCODE_OK);
+  for (int j = 0; j < NSTRINGS; j++)
+    dds_free (strs[j]);
+  dds_free (s);
+}
+
+static void check_sample (const Space_arenatype *sample, size_t slen)
+{
+  int i;
+  CU_ASSERT_FATAL (sscanf (sample->k, "k%d", &i) == 1);
+  CU_ASSERT_FATAL (strlen (sample->s) == slen);
+  CU_ASSERT (slen == 0 || sample->s[0] == 'a' + (i % 26));
+  CU_ASSERT_FATAL (sample->ss._length == NSTRINGS && sample->sl._length == NSTRINGS);
+  /* memory belongs to the arena */
+  CU_ASSERT (!sample->ss._release && !sample->sl._release);
+  for (int j = 0; j < NSTRINGS; j++)
+  {
+    char exp[12];
+    (void) snprintf (exp, sizeof (exp), "%d.%d", i, j);
+    CU_ASSERT_STRING_EQUAL (sample->ss._buffer[j], exp);
+    CU_ASSERT_EQUAL (sample->sl._buffer[j], i * NSTRINGS + j);
+  }
+}
+
+CU_Test(ddsc_take_arena, batches, .init = take_arena_init, .fini = take_arena_fini)
+{
+  void *buf[BATCH];
+  dds_sample_info_t si[BATCH];
+  bool seen[NSAMPLES] = { false };
+  dds_sample_arena_t *arena = dds_create_sample_arena (0);
+
+  for (int i = 0; i < NSAMPLES; i++)
+    write_sample (i, 10);
+
+  /* several batches accumulate in the arena, all remain valid until it is reset */
+  Space_arenatype *first = NULL;
+  int ntaken = 0;
+  dds_return_t n;
+  while ((n = dds_take_arena (g_reader, buf, si, BATCH, DDS_ANY_STATE, arena)) > 0)
+  {
+    for (int32_t i = 0; i < n; i++)
+    {
+      const Space_arenatype *sample = buf[i];
+      int k;
+      CU_ASSERT_FATAL (si[i].valid_data);
+      check_sample (sample, 10);
+      CU_ASSERT_FATAL (sscanf (sample->k, "k%d", &k) == 1 && k >= 0 && k < NSAMPLES);
+      CU_ASSERT (!seen[k]);
+      seen[k] = true;
+    }
+    if (first == NULL)
+      first = buf[0];
+    ntaken += n;
+  }
+  CU_ASSERT_EQUAL (n, 0);
+  CU_ASSERT_EQUAL (ntaken, NSAMPLES);
+  check_sample (first, 10);
+  dds_reset_sample_arena (arena);
+
+  /* disposing a taken instance results in an invalid sample, with the key still taken
+     from the arena */
+  write_sample (0, 10);
+  CU_ASSERT_EQUAL_FATAL (dds_take_arena (g_reader, buf, si, BATCH, DDS_ANY_STATE, arena), 1);
+  const Space_arenatype *valid = buf[0];
+  Space_arenatype key = { .k = "k0" };
+  CU_ASSERT_EQUAL_FATAL (dds_dispose (g_writer, &key), DDS_RETCODE_OK);
+  CU_ASSERT_EQUAL_FATAL (dds_take_arena (g_reader, buf, si, BATCH, DDS_ANY_STATE, arena), 1);
+  CU_ASSERT_FATAL (!si[0].valid_data);
+  const Space_arenatype *inv = buf[0];
+  CU_ASSERT_STRING_EQUAL (inv->k, "k0");
+  CU_ASSERT (inv->s == NULL && inv->ss._length == 0 && inv->sl._length == 0);
+  check_sample (valid, 10);
+  dds_delete_sample_arena (arena);
+}
+
+CU_Test(ddsc_take_arena, large_samples, .init = take_arena_init, .fini = take_arena_fini)
+{
+  /* samples much larger than a chunk force allocating larger ones, and small samples
+     that don't fit in the remainder of a chunk a new one */
+  const size_t slens[] = { 10, 1000, 5, 20000, 200, 3 };
+  const int nslens = (int) (sizeof (slens) / sizeof (slens[0]));
+  void *buf[1];
+  dds_sample_info_t si[1];
+  dds_sample_arena_t *arena = dds_create_sample_arena (256);
+  for (int round = 0; round < 2; round++)
+  {
+    for (int i = 0; i < nslens; i++)
+      write_sample (i, slens[i]);
+    for (int i = 0; i < nslens; i++)
+    {
+      CU_ASSERT_EQUAL_FATAL (dds_take_arena (g_reader, buf, si, 1, DDS_ANY_STATE, arena), 1);
+      const Space_arenatype *sample = buf[0];
+      int k;
+      CU_ASSERT_FATAL (sscanf (sample->k, "k%d", &k) == 1 && k >= 0 && k < nslens);
+      check_sample (sample, slens[k]);
+    }
+    dds_reset_sample_arena (arena);
+  }
+  dds_delete_sample_arena (arena);
+}
+
+CU_Test(ddsc_take_arena, expanding_type, .init = take_arena_init, .fini = take_arena_fini)
+{
+  /* bounded strings take their full size in memory, but only their actual length in CDR,
+     so these samples are many times larger in memory than on the wire and larger than the
+     default chunk size */
+  enum { NBSTRS = 300, NKEYS = 3 };
+  char name[100];
+  const dds_entity_t tp = dds_create_topic (g_participant, &Space_arenaexpand_desc, create_unique_topic_name ("ddsc_take_arena", name, sizeof name), NULL, NULL);
+  CU_ASSERT_FATAL (tp > 0);
+  dds_qos_t *qos = dds_create_qos ();
+  dds_qset_reliability (qos, DDS_RELIABILITY_RELIABLE, DDS_INFINITY);
+  dds_qset_history (qos, DDS_HISTORY_KEEP_ALL, 0);
+  const dds_entity_t rd = dds_create_reader (g_participant, tp, qos, NULL);
+  CU_ASSERT_FATAL (rd > 0);
+  const dds_entity_t wr = dds_create_writer (g_participant, tp, qos, NULL);
+  CU_ASSERT_FATAL (wr > 0);
+  dds_delete_qos (qos);
+
+  Space_arenabstr *bs = dds_alloc (NBSTRS * sizeof (*bs));
+  for (int32_t k = 0; k < NKEYS; k++)
+  {
+    for (int j = 0; j < NBSTRS; j++)
+      (void) snprintf (bs[j].s, sizeof (bs[j].s), (j % 100 == 0) ? "%"PRId32".%d" : "", k, j);
+    Space_arenaexpand sample = { .k = k, .bs = { ._length = NBSTRS, ._maximum = NBSTRS, ._buffer = bs } };
+    CU_ASSERT_EQUAL_FATAL (dds_write (wr, &sample), DDS_RETCODE_OK);
+  }
+  dds_free (bs);
+
+  void *buf[NKEYS];
+  dds_sample_info_t si[NKEYS];
+  dds_sample_arena_t *arena = dds_create_sample_arena (0);
+  CU_ASSERT_EQUAL_FATAL (dds_take_arena (rd, buf, si, NKEYS, DDS_ANY_STATE, arena), NKEYS);
+  for (int i = 0; i < NKEYS; i++)
+  {
+    const Space_arenaexpand *sample = buf[i];
+    CU_ASSERT_FATAL (sample != NULL && si[i].valid_data);
+    CU_ASSERT_FATAL (sample->bs._length == NBSTRS && !sample->bs._release);
+    for (int j = 0; j < NBSTRS; j++)
+    {
+      char exp[sizeof (sample->bs._buffer[j].s)];
+      (void) snprintf (exp, sizeof (exp), (j % 100 == 0) ? "%"PRId32".%d" : "", sample->k, j);
+      CU_ASSERT_STRING_EQUAL (sample->bs._buffer[j].s, exp);
+    }
+  }
+  dds_delete_sample_arena (arena);
+}
+
+CU_Test(ddsc_take_arena, invalid, .init = take_arena_init, .fini = take_arena_fini)
+{
+  void *buf[1];
+  dds_sample_info_t si[1];
+  dds_sample_arena_t *arena = dds_create_sample_arena (0);
+
+  CU_ASSERT_EQUAL (dds_take_arena (g_reader, NULL, si, 1, DDS_ANY_STATE, arena), DDS_RETCODE_BAD_PARAMETER);
+  CU_ASSERT_EQUAL (dds_take_arena (g_reader, buf, NULL, 1, DDS_ANY_STATE, arena), DDS_RETCODE_BAD_PARAMETER);
+  CU_ASSERT_EQUAL (dds_take_arena (g_reader, buf, si, 0, DDS_ANY_STATE, arena), DDS_RETCODE_BAD_PARAMETER);
+  CU_ASSERT_EQUAL (dds_take_arena (g_reader, buf, si, 1, DDS_ANY_STATE, NULL), DDS_RETCODE_BAD_PARAMETER);
+  CU_ASSERT_EQUAL (dds_take_arena (g_writer, buf, si, 1, DDS_ANY_STATE, arena), DDS_RETCODE_ILLEGAL_OPERATION);
+  const dds_entity_t rdcond = dds_create_readcondition (g_reader, DDS_ANY_STATE);
+  CU_ASSERT_FATAL (rdcond > 0);
+  CU_ASSERT_EQUAL (dds_take_arena (rdcond, buf, si, 1, DDS_ANY_STATE, arena), DDS_RETCODE_ILLEGAL_OPERATION);
+
+  /* builtin topics have their own sample representation */
+  const dds_entity_t bird = dds_create_reader (g_participant, DDS_BUILTIN_TOPIC_DCPSPARTICIPANT, NULL, NULL);
+  CU_ASSERT_FATAL (bird > 0);
+  CU_ASSERT_EQUAL (dds_take_arena (bird, buf, si, 1, DDS_ANY_STATE, arena), DDS_RETCODE_UNSUPPORTED);
+
+  dds_delete_sample_arena (arena);
+  dds_reset_sample_arena (NULL);
+  dds_delete_sample_arena (NULL);
+}
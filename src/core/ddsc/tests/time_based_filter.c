@@ -0,0 +1,221 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include "dds/dds.h"
+#include "test_common.h"
+
+#define MINSEP DDS_MSECS (200)
+#define MAXSAMPLES 20
+
+static dds_entity_t g_participant = 0;
+static dds_entity_t g_topic = 0;
+static dds_entity_t g_reader = 0;
+static dds_entity_t g_writer = 0;
+
+static void time_based_filter_init (void)
+{
+  char name[100];
+  dds_qos_t *qos = dds_create_qos ();
+  CU_ASSERT_PTR_NOT_NULL_FATAL (qos);
+  g_participant = dds_create_participant (DDS_DOMAIN_DEFAULT, NULL, NULL);
+  CU_ASSERT_FATAL (g_participant > 0);
+  dds_qset_history (qos, DDS_HISTORY_KEEP_ALL, DDS_LENGTH_UNLIMITED);
+  dds_qset_reliability (qos, DDS_RELIABILITY_RELIABLE, DDS_INFINITY);
+  g_topic = dds_create_topic (g_participant, &Space_Type1_desc, create_unique_topic_name ("ddsc_time_based_filter", name, sizeof name), qos, NULL);
+  CU_ASSERT_FATAL (g_topic > 0);
+  dds_qset_writer_data_lifecycle (qos, false);
+  g_writer = dds_create_writer (g_participant, g_topic, qos, NULL);
+  CU_ASSERT_FATAL (g_writer > 0);
+  dds_qset_time_based_filter (qos, MINSEP);
+  g_reader = dds_create_reader (g_participant, g_topic, qos, NULL);
+  CU_ASSERT_FATAL (g_reader > 0);
+  dds_delete_qos (qos);
+}
+
+static void time_based_filter_fini (void)
+{
+  dds_return_t ret = dds_delete (g_participant);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+}
+
+static int32_t take_all (Space_Type1 *samples, dds_sample_info_t *si)
+{
+  void *ptrs[MAXSAMPLES];
+  for (int i = 0; i < MAXSAMPLES; i++)
+    ptrs[i] = &samples[i];
+  const dds_return_t n = dds_take (g_reader, ptrs, si, MAXSAMPLES, MAXSAMPLES);
+  CU_ASSERT_FATAL (n >= 0);
+  return n;
+}
+
+CU_Test(ddsc_time_based_filter, latest_deferred, .init = time_based_filter_init, .fini = time_based_filter_fini)
+{
+  Space_Type1 samples[MAXSAMPLES];
+  dds_sample_info_t si[MAXSAMPLES];
+  dds_return_t ret;
+  int32_t n;
+
+  /* the first one is stored immediately, the rest arrives within the minimum separation
+     and only the latest of those gets stored once the separation has elapsed */
+  for (int32_t i = 0; i < 10; i++)
+  {
+    ret = dds_write (g_writer, &(Space_Type1){ 1, 0, i });
+    CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  }
+  n = take_all (samples, si);
+  CU_ASSERT_EQUAL_FATAL (n, 1);
+  CU_ASSERT_EQUAL (samples[0].long_3, 0);
+
+  dds_sleepfor (2 * MINSEP);
+  n = take_all (samples, si);
+  CU_ASSERT_EQUAL_FATAL (n, 1);
+  CU_ASSERT_EQUAL (samples[0].long_3, 9);
+
+  /* instances are filtered independently */
+  dds_sleepfor (2 * MINSEP);
+  ret = dds_write (g_writer, &(Space_Type1){ 1, 0, 10 });
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  ret = dds_write (g_writer, &(Space_Type1){ 2, 0, 11 });
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  n = take_all (samples, si);
+  CU_ASSERT_EQUAL_FATAL (n, 2);
+}
+
+CU_Test(ddsc_time_based_filter, dispose_flushes, .init = time_based_filter_init, .fini = time_based_filter_fini)
+{
+  Space_Type1 samples[MAXSAMPLES];
+  dds_sample_info_t si[MAXSAMPLES];
+  dds_return_t ret;
+  int32_t n;
+
+  /* a dispose is never filtered and doesn't overtake the deferred write */
+  ret = dds_write (g_writer, &(Space_Type1){ 1, 0, 0 });
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  ret = dds_write (g_writer, &(Space_Type1){ 1, 0, 1 });
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  ret = dds_dispose (g_writer, &(Space_Type1){ 1, 0, 0 });
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  n = take_all (samples, si);
+  CU_ASSERT_EQUAL_FATAL (n, 2);
+  CU_ASSERT (si[0].valid_data && samples[0].long_3 == 0);
+  CU_ASSERT (si[1].valid_data && samples[1].long_3 == 1);
+  CU_ASSERT_EQUAL (si[1].instance_state, DDS_NOT_ALIVE_DISPOSED_INSTANCE_STATE);
+
+  /* nothing is left to be delivered later */
+  dds_sleepfor (2 * MINSEP);
+  n = take_all (samples, si);
+  CU_ASSERT_EQUAL (n, 0);
+}
+
+CU_Test(ddsc_time_based_filter, change_qos, .init = time_based_filter_init, .fini = time_based_filter_fini)
+{
+  Space_Type1 samples[MAXSAMPLES];
+  dds_sample_info_t si[MAXSAMPLES];
+  dds_return_t ret;
+  int32_t n;
+
+  dds_qos_t *qos = dds_create_qos ();
+  CU_ASSERT_PTR_NOT_NULL_FATAL (qos);
+  dds_qset_time_based_filter (qos, 0);
+  ret = dds_set_qos (g_reader, qos);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  dds_delete_qos (qos);
+
+  for (int32_t i = 0; i < 10; i++)
+  {
+    ret = dds_write (g_writer, &(Space_Type1){ 1, 0, i });
+    CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  }
+  n = take_all (samples, si);
+  CU_ASSERT_EQUAL (n, 10);
+}
+
+CU_Test(ddsc_time_based_filter, lower_while_deferred, .init = time_based_filter_init, .fini = time_based_filter_fini)
+{
+  Space_Type1 samples[MAXSAMPLES];
+  dds_sample_info_t si[MAXSAMPLES];
+  dds_return_t ret;
+  int32_t n;
+
+  ret = dds_write (g_writer, &(Space_Type1){ 1, 0, 0 });
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  ret = dds_write (g_writer, &(Space_Type1){ 1, 0, 1 });
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  n = take_all (samples, si);
+  CU_ASSERT_EQUAL_FATAL (n, 1);
+
+  /* disabling the filter releases the deferred sample without waiting for the separation
+     that applied when it arrived to elapse */
+  dds_qos_t *qos = dds_create_qos ();
+  CU_ASSERT_PTR_NOT_NULL_FATAL (qos);
+  dds_qset_time_based_filter (qos, 0);
+  ret = dds_set_qos (g_reader, qos);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  dds_sleepfor (MINSEP / 4);
+  n = take_all (samples, si);
+  CU_ASSERT_EQUAL_FATAL (n, 1);
+  CU_ASSERT_EQUAL (samples[0].long_3, 1);
+
+  /* a sample deferred before lowering the separation to 0 is either stored before a newer
+     one or superseded by it, but never stored after it */
+  dds_qset_time_based_filter (qos, MINSEP);
+  ret = dds_set_qos (g_reader, qos);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  dds_sleepfor (2 * MINSEP);
+  ret = dds_write (g_writer, &(Space_Type1){ 1, 0, 2 });
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  ret = dds_write (g_writer, &(Space_Type1){ 1, 0, 3 });
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  dds_qset_time_based_filter (qos, 0);
+  ret = dds_set_qos (g_reader, qos);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  dds_delete_qos (qos);
+  ret = dds_write (g_writer, &(Space_Type1){ 1, 0, 4 });
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  dds_sleepfor (2 * MINSEP);
+  n = take_all (samples, si);
+  CU_ASSERT_FATAL (n == 2 || n == 3);
+  CU_ASSERT_EQUAL (samples[0].long_3, 2);
+  CU_ASSERT_EQUAL (samples[n - 1].long_3, 4);
+  if (n == 3)
+    CU_ASSERT_EQUAL (samples[1].long_3, 3);
+}
+
+CU_Test(ddsc_time_based_filter, lost_writer, .init = time_based_filter_init, .fini = time_based_filter_fini)
+{
+  Space_Type1 samples[MAXSAMPLES];
+  dds_sample_info_t si[MAXSAMPLES];
+  dds_return_t ret;
+  int32_t n;
+
+  /* a deferred sample of a writer that has gone must not bring the instance back to life */
+  dds_qos_t *qos = dds_create_qos ();
+  CU_ASSERT_PTR_NOT_NULL_FATAL (qos);
+  dds_qset_writer_data_lifecycle (qos, false);
+  const dds_entity_t wr = dds_create_writer (g_participant, g_topic, qos, NULL);
+  CU_ASSERT_FATAL (wr > 0);
+  dds_delete_qos (qos);
+  ret = dds_write (wr, &(Space_Type1){ 1, 0, 0 });
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  ret = dds_write (wr, &(Space_Type1){ 1, 0, 1 });
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  ret = dds_delete (wr);
+  CU_ASSERT_EQUAL_FATAL (ret, DDS_RETCODE_OK);
+  dds_sleepfor (2 * MINSEP);
+  n = take_all (samples, si);
+  CU_ASSERT_FATAL (n >= 1);
+  CU_ASSERT_EQUAL (samples[0].long_3, 0);
+  CU_ASSERT_EQUAL (si[n - 1].instance_state, DDS_NOT_ALIVE_NO_WRITERS_INSTANCE_STATE);
+  CU_ASSERT_EQUAL (si[n - 1].publication_handle, si[0].publication_handle);
+}
+
+#undef MAXSAMPLES
+#undef MINSEP
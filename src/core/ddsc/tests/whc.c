@@ -11,6 +11,7 @@
  */
 #include <assert.h>
 #include <limits.h>
+#include <string.h>
 
 #include "dds/dds.h"
 #include "dds/ddsrt/process.h"
@@ -18,8 +19,10 @@
 #include "dds/ddsrt/environ.h"
 #include "dds/ddsi/ddsi_entity_index.h"
 #include "dds/ddsi/ddsi_entity.h"
+#include "dds/ddsi/ddsi_serdata.h"
 #include "ddsi__whc.h"
 #include "dds__entity.h"
+#include "dds__whc.h"
 
 #include "test_common.h"
 
@@ -302,3 +305,466 @@ CU_Test(ddsc_whc, check_end_state, .init=whc_init, .fini=whc_fini, .timeout=30)
 #undef BE
 #undef KA
 #undef KL
+
+#define NACK_ONLY_SAMPLE_COUNT 100
+CU_Test(ddsc_whc, nack_only_retention, .timeout=30)
+{
+  /* NACK-only writer with a lossy transmit path: the remote reader must still
+     receive everything (repairs are NACK-driven), while the WHC must drain
+     because of the retention time even though the reader never ACKs the tail */
+#define NACK_ONLY_CONFIG(extra) \
+    "${CYCLONEDDS_URI}${CYCLONEDDS_URI:+,}<Discovery><ExternalDomainId>0</ExternalDomainId></Discovery>" \
+    "<Internal><NackOnlyReliability><Enable>true</Enable><RetentionTime>2s</RetentionTime></NackOnlyReliability>" extra "</Internal>"
+  char *conf_pub = ddsrt_expand_envvars (NACK_ONLY_CONFIG ("<Test><XmitLossiness>100</XmitLossiness></Test>"), 1);
+  char *conf_sub = ddsrt_expand_envvars (NACK_ONLY_CONFIG (""), 0);
+#undef NACK_ONLY_CONFIG
+  const dds_entity_t pub_dom = dds_create_domain (1, conf_pub);
+  CU_ASSERT_FATAL (pub_dom > 0);
+  const dds_entity_t sub_dom = dds_create_domain (0, conf_sub);
+  CU_ASSERT_FATAL (sub_dom > 0);
+  dds_free (conf_pub);
+  dds_free (conf_sub);
+
+  const dds_entity_t pub_pp = dds_create_participant (1, NULL, NULL);
+  CU_ASSERT_FATAL (pub_pp > 0);
+  const dds_entity_t sub_pp = dds_create_participant (0, NULL, NULL);
+  CU_ASSERT_FATAL (sub_pp > 0);
+
+  char name[100];
+  create_unique_topic_name ("ddsc_whc_nack_only", name, sizeof name);
+  dds_qos_t *qos = dds_create_qos ();
+  dds_qset_reliability (qos, DDS_RELIABILITY_RELIABLE, DDS_INFINITY);
+  dds_qset_history (qos, DDS_HISTORY_KEEP_ALL, 0);
+  const dds_entity_t pub_tp = dds_create_topic (pub_pp, &Space_Type1_desc, name, qos, NULL);
+  CU_ASSERT_FATAL (pub_tp > 0);
+  const dds_entity_t sub_tp = dds_create_topic (sub_pp, &Space_Type1_desc, name, qos, NULL);
+  CU_ASSERT_FATAL (sub_tp > 0);
+  const dds_entity_t writer = dds_create_writer (pub_pp, pub_tp, qos, NULL);
+  CU_ASSERT_FATAL (writer > 0);
+  dds_delete_qos (qos);
+  const dds_entity_t reader = create_and_sync_reader (sub_pp, sub_tp, NULL, writer);
+
+  for (int32_t i = 0; i < NACK_ONLY_SAMPLE_COUNT; i++)
+  {
+    Space_Type1 sample = { i, 0, 0 };
+    dds_return_t ret = dds_write (writer, &sample);
+    CU_ASSERT_FATAL (ret == DDS_RETCODE_OK);
+  }
+
+  int32_t nrecv = 0;
+  const dds_time_t tend = dds_time () + DDS_SECS (20);
+  while (nrecv < NACK_ONLY_SAMPLE_COUNT && dds_time () < tend)
+  {
+    Space_Type1 sample;
+    void *raw = &sample;
+    dds_sample_info_t si;
+    if (dds_take (reader, &raw, &si, 1, 1) == 1)
+      nrecv++;
+    else
+      dds_sleepfor (DDS_MSECS (10));
+  }
+  CU_ASSERT_EQUAL_FATAL (nrecv, NACK_ONLY_SAMPLE_COUNT);
+
+  struct ddsi_whc_state whcst;
+  get_writer_whc_state (writer, &whcst);
+  while (whcst.unacked_bytes > 0 && dds_time () < tend)
+  {
+    dds_sleepfor (DDS_MSECS (10));
+    get_writer_whc_state (writer, &whcst);
+  }
+  CU_ASSERT_EQUAL_FATAL (whcst.unacked_bytes, 0);
+
+  struct dds_entity *wr_entity;
+  CU_ASSERT_EQUAL_FATAL (dds_entity_pin (writer, &wr_entity), 0);
+  ddsi_thread_state_awake (ddsi_lookup_thread_state (), &wr_entity->m_domain->gv);
+  struct ddsi_writer *wr = ddsi_entidx_lookup_writer_guid (wr_entity->m_domain->gv.entity_index, &wr_entity->m_guid);
+  CU_ASSERT_FATAL (wr != NULL);
+  assert (wr != NULL); /* for Clang's static analyzer */
+  ddsrt_mutex_lock (&wr->e.lock);
+  CU_ASSERT (wr->nack_only);
+  CU_ASSERT (wr->nack_only_drop_seq > 0);
+  ddsrt_mutex_unlock (&wr->e.lock);
+  ddsi_thread_state_asleep (ddsi_lookup_thread_state ());
+  dds_entity_unpin (wr_entity);
+
+  dds_delete (pub_dom);
+  dds_delete (sub_dom);
+}
+#undef NACK_ONLY_SAMPLE_COUNT
+
+static void check_ring_state (struct ddsi_whc *whc, ddsi_seqno_t exp_min, ddsi_seqno_t exp_max)
+{
+  struct ddsi_whc_state whcst;
+  ddsi_whc_get_state (whc, &whcst);
+  CU_ASSERT_EQUAL_FATAL (whcst.min_seq, exp_min);
+  CU_ASSERT_EQUAL_FATAL (whcst.max_seq, exp_max);
+}
+
+static uint32_t ring_remove_acked (struct ddsi_whc *whc, ddsi_seqno_t max_drop_seq)
+{
+  struct ddsi_whc_state whcst;
+  struct ddsi_whc_node *deferred_free_list;
+  const uint32_t n = ddsi_whc_remove_acked_messages (whc, max_drop_seq, &whcst, &deferred_free_list);
+  ddsi_whc_free_deferred_free_list (whc, deferred_free_list);
+  return n;
+}
+
+CU_Test(ddsc_whc, ring, .timeout=30)
+{
+  const dds_entity_t pp = dds_create_participant (DDS_DOMAIN_DEFAULT, NULL, NULL);
+  CU_ASSERT_FATAL (pp > 0);
+  char name[100];
+  create_unique_topic_name ("ddsc_whc_ring", name, sizeof name);
+  const dds_entity_t tp = dds_create_topic (pp, &Space_Type3_desc, name, NULL, NULL);
+  CU_ASSERT_FATAL (tp > 0);
+  dds_qos_t *qos = dds_create_qos ();
+  dds_qset_durability (qos, DDS_DURABILITY_VOLATILE);
+  dds_qset_history (qos, DDS_HISTORY_KEEP_LAST, 3);
+  const dds_entity_t writer = dds_create_writer (pp, tp, qos, NULL);
+  CU_ASSERT_FATAL (writer > 0);
+  dds_delete_qos (qos);
+
+  struct dds_entity *x;
+  CU_ASSERT_EQUAL_FATAL (dds_entity_pin (writer, &x), 0);
+  struct dds_writer * const wr = (struct dds_writer *) x;
+  struct whc_writer_info *wrinfo = dds_whc_make_wrinfo (wr, wr->m_entity.m_qos);
+  CU_ASSERT_FATAL (dds_whc_ring_applicable (wrinfo));
+  CU_ASSERT_EQUAL_FATAL (wrinfo->hdepth, 3);
+
+  const Space_Type3 sample = { 1, 2, 3 };
+  struct ddsi_serdata *sd = ddsi_serdata_from_sample (wr->m_topic->m_stype, SDK_DATA, &sample);
+  struct ddsi_serdata *sd_unreg = ddsi_serdata_from_sample (wr->m_topic->m_stype, SDK_KEY, &sample);
+  sd_unreg->statusinfo = DDSI_STATUSINFO_UNREGISTER;
+  struct ddsi_whc_borrowed_sample bs;
+  ddsi_seqno_t seq;
+
+  /* KEEP_LAST 3: unacknowledged samples get pushed out of the history */
+  struct ddsi_whc *whc = dds_whc_ring_new (&x->m_domain->gv, wrinfo);
+  for (seq = 1; seq <= 5; seq++)
+    ddsi_whc_insert (whc, 0, seq, DDSRT_MTIME_NEVER, sd, sd, NULL);
+  check_ring_state (whc, 3, 5);
+  CU_ASSERT (!ddsi_whc_borrow_sample (whc, 2, &bs));
+  CU_ASSERT_FATAL (ddsi_whc_borrow_sample (whc, 4, &bs));
+  CU_ASSERT (bs.seq == 4 && bs.serdata == sd && bs.unacked);
+  ddsi_whc_return_sample (whc, &bs, false);
+  CU_ASSERT_EQUAL (ddsi_whc_next_seq (whc, 1), 3);
+  CU_ASSERT_EQUAL (ddsi_whc_next_seq (whc, 3), 4);
+  CU_ASSERT_EQUAL (ddsi_whc_next_seq (whc, 5), DDSI_MAX_SEQ_NUMBER);
+  CU_ASSERT_EQUAL (ring_remove_acked (whc, 4), 2);
+  check_ring_state (whc, 5, 5);
+  /* no acks for a while: ring wraps many times over, only the last 3 remain */
+  for (seq = 6; seq <= 1000; seq++)
+    ddsi_whc_insert (whc, 4, seq, DDSRT_MTIME_NEVER, sd, sd, NULL);
+  check_ring_state (whc, 998, 1000);
+  CU_ASSERT_FATAL (ddsi_whc_borrow_sample_key (whc, sd, &bs));
+  CU_ASSERT_EQUAL (bs.seq, 1000);
+  ddsi_whc_return_sample (whc, &bs, false);
+  /* acknowledged samples disappear with the instance, unacknowledged ones stay */
+  CU_ASSERT_EQUAL (ring_remove_acked (whc, 998), 1);
+  ddsi_whc_insert (whc, 998, 1001, DDSRT_MTIME_NEVER, sd_unreg, sd_unreg, NULL);
+  check_ring_state (whc, 999, 1001);
+  CU_ASSERT (!ddsi_whc_borrow_sample_key (whc, sd, &bs));
+  CU_ASSERT_EQUAL (ring_remove_acked (whc, 1001), 3);
+  check_ring_state (whc, 0, 0);
+  ddsi_whc_free (whc);
+
+  /* KEEP_ALL: ring has to grow while the readers lag behind */
+  wrinfo->hdepth = wrinfo->idxdepth = 0;
+  whc = dds_whc_ring_new (&x->m_domain->gv, wrinfo);
+  for (seq = 1; seq <= 1000; seq++)
+    ddsi_whc_insert (whc, 0, seq, DDSRT_MTIME_NEVER, sd, sd, NULL);
+  check_ring_state (whc, 1, 1000);
+  uint32_t count = 0;
+  struct ddsi_whc_sample_iter it;
+  ddsi_whc_sample_iter_init (whc, &it);
+  while (ddsi_whc_sample_iter_borrow_next (&it, &bs))
+  {
+    CU_ASSERT_EQUAL (bs.seq, count + 1);
+    count++;
+  }
+  CU_ASSERT_EQUAL (count, 1000);
+  /* dropping a borrowed sample: returning it releases the serdata */
+  CU_ASSERT_FATAL (ddsi_whc_borrow_sample (whc, 500, &bs));
+  CU_ASSERT_EQUAL (ring_remove_acked (whc, 999), 999);
+  ddsi_whc_return_sample (whc, &bs, false);
+  check_ring_state (whc, 1000, 1000);
+  ddsi_whc_insert (whc, 999, 1002, DDSRT_MTIME_NEVER, sd, sd, NULL);
+  check_ring_state (whc, 1000, 1002);
+  CU_ASSERT_EQUAL (ddsi_whc_next_seq (whc, 1000), 1002);
+  CU_ASSERT_EQUAL (ring_remove_acked (whc, 1002), 2);
+  check_ring_state (whc, 0, 0);
+  ddsi_whc_free (whc);
+
+  ddsi_serdata_unref (sd_unreg);
+  ddsi_serdata_unref (sd);
+  dds_whc_free_wrinfo (wrinfo);
+  dds_entity_unpin (x);
+  dds_delete (pp);
+}
+
+#define SPILL_SAMPLE_COUNT 50
+#define SPILL_SAMPLE_SIZE 10000
+
+static void spill_fill_payload (RoundTripModule_DataType *s, int32_t k)
+{
+  s->payload._length = s->payload._maximum = SPILL_SAMPLE_SIZE;
+  s->payload._buffer = dds_alloc (SPILL_SAMPLE_SIZE);
+  s->payload._release = true;
+  for (uint32_t i = 0; i < SPILL_SAMPLE_SIZE; i++)
+    s->payload._buffer[i] = (uint8_t) (i + (uint32_t) k);
+}
+
+static void spill_late_joiner (dds_history_kind_t history_kind, int32_t depth)
+{
+#define SPILL_CONFIG(extra) \
+    "${CYCLONEDDS_URI}${CYCLONEDDS_URI:+,}<Discovery><ExternalDomainId>0</ExternalDomainId></Discovery>" \
+    "<Internal>" extra "</Internal>"
+  char *conf_pub = ddsrt_expand_envvars (SPILL_CONFIG ("<WhcSpill><WriterLimit>64kB</WriterLimit></WhcSpill>"), 1);
+  char *conf_sub = ddsrt_expand_envvars (SPILL_CONFIG (""), 0);
+#undef SPILL_CONFIG
+  const dds_entity_t pub_dom = dds_create_domain (1, conf_pub);
+  CU_ASSERT_FATAL (pub_dom > 0);
+  const dds_entity_t sub_dom = dds_create_domain (0, conf_sub);
+  CU_ASSERT_FATAL (sub_dom > 0);
+  dds_free (conf_pub);
+  dds_free (conf_sub);
+
+  const dds_entity_t pub_pp = dds_create_participant (1, NULL, NULL);
+  CU_ASSERT_FATAL (pub_pp > 0);
+  const dds_entity_t sub_pp = dds_create_participant (0, NULL, NULL);
+  CU_ASSERT_FATAL (sub_pp > 0);
+
+  char name[100];
+  create_unique_topic_name ("ddsc_whc_spill", name, sizeof name);
+  dds_qos_t *qos = dds_create_qos ();
+  dds_qset_reliability (qos, DDS_RELIABILITY_RELIABLE, DDS_INFINITY);
+  dds_qset_durability (qos, DDS_DURABILITY_TRANSIENT_LOCAL);
+  dds_qset_history (qos, history_kind, depth);
+  dds_qset_durability_service (qos, 0, history_kind, depth, DDS_LENGTH_UNLIMITED, DDS_LENGTH_UNLIMITED, DDS_LENGTH_UNLIMITED);
+  const dds_entity_t pub_tp = dds_create_topic (pub_pp, &RoundTripModule_DataType_desc, name, qos, NULL);
+  CU_ASSERT_FATAL (pub_tp > 0);
+  const dds_entity_t sub_tp = dds_create_topic (sub_pp, &RoundTripModule_DataType_desc, name, qos, NULL);
+  CU_ASSERT_FATAL (sub_tp > 0);
+  const dds_entity_t writer = dds_create_writer (pub_pp, pub_tp, qos, NULL);
+  CU_ASSERT_FATAL (writer > 0);
+
+  /* no readers, so everything is acknowledged immediately and only retained because
+     of transient-local durability: all but the most recent 64kB gets spilled */
+  for (int32_t k = 0; k < SPILL_SAMPLE_COUNT; k++)
+  {
+    RoundTripModule_DataType s;
+    spill_fill_payload (&s, k);
+    dds_return_t ret = dds_write (writer, &s);
+    CU_ASSERT_FATAL (ret == DDS_RETCODE_OK);
+    RoundTripModule_DataType_free (&s, DDS_FREE_CONTENTS);
+  }
+
+  /* spilling is done in the background by the event thread */
+  struct dds_entity *wr_entity;
+  CU_ASSERT_EQUAL_FATAL (dds_entity_pin (writer, &wr_entity), 0);
+  const dds_time_t tspill = dds_time () + DDS_SECS (5);
+  while (ddsrt_atomic_ld64 (&wr_entity->m_domain->whc_resident_bytes) > 65536 && dds_time () < tspill)
+    dds_sleepfor (DDS_MSECS (10));
+  CU_ASSERT (ddsrt_atomic_ld64 (&wr_entity->m_domain->whc_resident_bytes) <= 65536);
+  dds_entity_unpin (wr_entity);
+
+  /* late-joining reader gets the history read back from the spill file */
+  const dds_entity_t reader = dds_create_reader (sub_pp, sub_tp, qos, NULL);
+  CU_ASSERT_FATAL (reader > 0);
+  dds_delete_qos (qos);
+
+  const int32_t first = (history_kind == DDS_HISTORY_KEEP_ALL) ? 0 : SPILL_SAMPLE_COUNT - depth;
+  int32_t k = first;
+  const dds_time_t tend = dds_time () + DDS_SECS (10);
+  while (k < SPILL_SAMPLE_COUNT && dds_time () < tend)
+  {
+    void *raw = NULL;
+    dds_sample_info_t si;
+    if (dds_take (reader, &raw, &si, 1, 1) != 1)
+      dds_sleepfor (DDS_MSECS (10));
+    else
+    {
+      const RoundTripModule_DataType *s = raw;
+      RoundTripModule_DataType exp;
+      spill_fill_payload (&exp, k);
+      CU_ASSERT_FATAL (si.valid_data);
+      CU_ASSERT_EQUAL_FATAL (s->payload._length, exp.payload._length);
+      CU_ASSERT (memcmp (s->payload._buffer, exp.payload._buffer, s->payload._length) == 0);
+      RoundTripModule_DataType_free (&exp, DDS_FREE_CONTENTS);
+      dds_return_loan (reader, &raw, 1);
+      k++;
+    }
+  }
+  CU_ASSERT_EQUAL_FATAL (k, SPILL_SAMPLE_COUNT);
+
+  dds_delete (pub_dom);
+  dds_delete (sub_dom);
+}
+
+CU_Test(ddsc_whc, spill_keep_all, .timeout=30)
+{
+  spill_late_joiner (DDS_HISTORY_KEEP_ALL, 0);
+}
+
+CU_Test(ddsc_whc, spill_keep_last, .timeout=30)
+{
+  spill_late_joiner (DDS_HISTORY_KEEP_LAST, 20);
+}
+
+#undef SPILL_SAMPLE_SIZE
+#undef SPILL_SAMPLE_COUNT
+
+static dds_entity_t persistent_writer (dds_entity_t pp, const char *name, const dds_qos_t *qos)
+{
+  const dds_entity_t tp = dds_create_topic (pp, &Space_Type1_desc, name, qos, NULL);
+  CU_ASSERT_FATAL (tp > 0);
+  const dds_entity_t wr = dds_create_writer (pp, tp, qos, NULL);
+  CU_ASSERT_FATAL (wr > 0);
+  return wr;
+}
+
+CU_Test(ddsc_whc, persistent_restart, .timeout=30)
+{
+  /* small segments, so that the log gets rolled over and compacted several times */
+#define PERSISTENT_CONFIG(extra) \
+    "${CYCLONEDDS_URI}${CYCLONEDDS_URI:+,}<Discovery><ExternalDomainId>0</ExternalDomainId></Discovery>" \
+    "<Internal>" extra "</Internal>"
+  char *conf_pub = ddsrt_expand_envvars (PERSISTENT_CONFIG ("<PersistentStore><Directory>.</Directory><SegmentSize>1kB</SegmentSize><Fsync>always</Fsync></PersistentStore>"), 1);
+  char *conf_sub = ddsrt_expand_envvars (PERSISTENT_CONFIG (""), 0);
+#undef PERSISTENT_CONFIG
+  char name[100];
+  create_unique_topic_name ("ddsc_whc_persistent", name, sizeof name);
+  dds_qos_t *qos = dds_create_qos ();
+  dds_qset_reliability (qos, DDS_RELIABILITY_RELIABLE, DDS_INFINITY);
+  dds_qset_durability (qos, DDS_DURABILITY_PERSISTENT);
+  dds_qset_history (qos, DDS_HISTORY_KEEP_LAST, 3);
+  dds_qset_durability_service (qos, 0, DDS_HISTORY_KEEP_LAST, 3, DDS_LENGTH_UNLIMITED, DDS_LENGTH_UNLIMITED, DDS_LENGTH_UNLIMITED);
+
+  /* first incarnation writes 10 samples for each of 4 instances, then unregisters the
+     last instance and goes away */
+  dds_entity_t pub_dom = dds_create_domain (1, conf_pub);
+  CU_ASSERT_FATAL (pub_dom > 0);
+  dds_entity_t pub_pp = dds_create_participant (1, NULL, NULL);
+  CU_ASSERT_FATAL (pub_pp > 0);
+  dds_entity_t writer = persistent_writer (pub_pp, name, qos);
+  for (int32_t j = 0; j < 10; j++)
+  {
+    for (int32_t i = 0; i < 4; i++)
+    {
+      dds_return_t ret = dds_write (writer, &(Space_Type1){ i, j, 0 });
+      CU_ASSERT_FATAL (ret == DDS_RETCODE_OK);
+    }
+  }
+  dds_return_t ret = dds_unregister_instance (writer, &(Space_Type1){ 3, 0, 0 });
+  CU_ASSERT_FATAL (ret == DDS_RETCODE_OK);
+  dds_delete (pub_dom);
+
+  /* second incarnation republishes what is left to a late-joining reader */
+  pub_dom = dds_create_domain (1, conf_pub);
+  CU_ASSERT_FATAL (pub_dom > 0);
+  pub_pp = dds_create_participant (1, NULL, NULL);
+  CU_ASSERT_FATAL (pub_pp > 0);
+  writer = persistent_writer (pub_pp, name, qos);
+
+  const dds_entity_t sub_dom = dds_create_domain (0, conf_sub);
+  CU_ASSERT_FATAL (sub_dom > 0);
+  const dds_entity_t sub_pp = dds_create_participant (0, NULL, NULL);
+  CU_ASSERT_FATAL (sub_pp > 0);
+  const dds_entity_t sub_tp = dds_create_topic (sub_pp, &Space_Type1_desc, name, qos, NULL);
+  CU_ASSERT_FATAL (sub_tp > 0);
+  dds_qset_durability (qos, DDS_DURABILITY_TRANSIENT_LOCAL);
+  dds_qset_history (qos, DDS_HISTORY_KEEP_ALL, 0);
+  const dds_entity_t reader = dds_create_reader (sub_pp, sub_tp, qos, NULL);
+  CU_ASSERT_FATAL (reader > 0);
+  dds_delete_qos (qos);
+  dds_free (conf_pub);
+  dds_free (conf_sub);
+
+  int32_t next[4] = { 7, 7, 7, 10 };
+  int32_t n = 0;
+  const dds_time_t tend = dds_time () + DDS_SECS (10);
+  while (n < 9 && dds_time () < tend)
+  {
+    Space_Type1 s;
+    void *raw = &s;
+    dds_sample_info_t si;
+    if (dds_take (reader, &raw, &si, 1, 1) != 1)
+      dds_sleepfor (DDS_MSECS (10));
+    else
+    {
+      CU_ASSERT_FATAL (si.valid_data);
+      CU_ASSERT_FATAL (s.long_1 >= 0 && s.long_1 < 3);
+      CU_ASSERT_EQUAL_FATAL (s.long_2, next[s.long_1]);
+      next[s.long_1]++;
+      n++;
+    }
+  }
+  CU_ASSERT_EQUAL_FATAL (n, 9);
+  dds_sleepfor (DDS_MSECS (100));
+  CU_ASSERT_EQUAL (dds_take (reader, &(void *){ NULL }, &(dds_sample_info_t){ 0 }, 1, 1), 0);
+
+  /* unregistering everything empties the log, so no files are left behind */
+  for (int32_t i = 0; i < 3; i++)
+  {
+    ret = dds_unregister_instance (writer, &(Space_Type1){ i, 0, 0 });
+    CU_ASSERT_FATAL (ret == DDS_RETCODE_OK);
+  }
+  dds_delete (pub_dom);
+  dds_delete (sub_dom);
+}
+
+CU_Test(ddsc_whc, reclaim_on_delete, .timeout=30)
+{
+  /* acknowledged samples are freed by the GC thread, deleting the writer (and the domain)
+     while some of that is still pending must neither lose nor double-free anything */
+  char *conf_pub = ddsrt_expand_envvars (DDS_CONFIG_NO_PORT_GAIN, 1);
+  char *conf_sub = ddsrt_expand_envvars (DDS_CONFIG_NO_PORT_GAIN, 0);
+  const dds_entity_t pub_dom = dds_create_domain (1, conf_pub);
+  CU_ASSERT_FATAL (pub_dom > 0);
+  const dds_entity_t sub_dom = dds_create_domain (0, conf_sub);
+  CU_ASSERT_FATAL (sub_dom > 0);
+  dds_free (conf_pub);
+  dds_free (conf_sub);
+
+  const dds_entity_t pub_pp = dds_create_participant (1, NULL, NULL);
+  CU_ASSERT_FATAL (pub_pp > 0);
+  const dds_entity_t sub_pp = dds_create_participant (0, NULL, NULL);
+  CU_ASSERT_FATAL (sub_pp > 0);
+  char name[100];
+  create_unique_topic_name ("ddsc_whc_reclaim", name, sizeof name);
+  dds_qos_t *qos = dds_create_qos ();
+  dds_qset_reliability (qos, DDS_RELIABILITY_RELIABLE, DDS_INFINITY);
+  dds_qset_history (qos, DDS_HISTORY_KEEP_LAST, 1);
+  const dds_entity_t pub_tp = dds_create_topic (pub_pp, &Space_Type1_desc, name, qos, NULL);
+  CU_ASSERT_FATAL (pub_tp > 0);
+  const dds_entity_t sub_tp = dds_create_topic (sub_pp, &Space_Type1_desc, name, qos, NULL);
+  CU_ASSERT_FATAL (sub_tp > 0);
+  const dds_entity_t writer = dds_create_writer (pub_pp, pub_tp, qos, NULL);
+  CU_ASSERT_FATAL (writer > 0);
+  const dds_entity_t reader = create_and_sync_reader (sub_pp, sub_tp, qos, writer);
+  CU_ASSERT_FATAL (reader > 0);
+  dds_delete_qos (qos);
+
+  for (int32_t round = 0; round < 10; round++)
+  {
+    for (int32_t i = 0; i < 100; i++)
+    {
+      dds_return_t ret = dds_write (writer, &(Space_Type1){ i, round, 0 });
+      CU_ASSERT_FATAL (ret == DDS_RETCODE_OK);
+    }
+    dds_return_t ret = dds_wait_for_acks (writer, DDS_SECS (5));
+    CU_ASSERT_FATAL (ret == DDS_RETCODE_OK);
+  }
+  struct ddsi_whc_state whcst;
+  get_writer_whc_state (writer, &whcst);
+  CU_ASSERT_EQUAL (whcst.unacked_bytes, 0);
+
+  for (int32_t i = 0; i < 100; i++)
+  {
+    dds_return_t ret = dds_write (writer, &(Space_Type1){ i, 10, 0 });
+    CU_ASSERT_FATAL (ret == DDS_RETCODE_OK);
+  }
+  dds_delete (writer);
+  dds_delete (pub_dom);
+  dds_delete (sub_dom);
+}
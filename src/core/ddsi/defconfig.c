@@ -81,6 +81,19 @@ void ddsi_config_init_default (struct ddsi_config *cfg)
   cfg->whc_init_highwater_mark.isdefault = 0;
   cfg->whc_init_highwater_mark.value = UINT32_C (30720);
   cfg->whc_adaptive = INT32_C (1);
+  cfg->nack_only_retention_time = INT64_C (1000000000);
+  cfg->nack_only_retention_size = UINT32_C (262144);
+  cfg->nack_only_suppression_delay = INT64_C (10000000);
+  cfg->adaptive_timing_min_nack_delay = INT64_C (500000);
+  cfg->adaptive_timing_max_nack_delay = INT64_C (1000000000);
+  cfg->compression_topics = "";
+  cfg->compression_threshold = UINT32_C (4096);
+  cfg->whc_spill_directory = "";
+  cfg->persistent_store_directory = "";
+  cfg->persistent_store_segment_size = UINT32_C (16777216);
+  cfg->persistent_store_compaction_threshold = INT32_C (50);
+  cfg->persistent_store_fsync = INT32_C (1);
+  cfg->persistent_store_fsync_interval = INT64_C (1000000000);
   cfg->max_rexmit_burst_size = UINT32_C (1048576);
   cfg->init_transmit_extra_pct = UINT32_C (4294967295);
   cfg->tcp_nodelay = INT32_C (1);
@@ -103,14 +116,14 @@ void ddsi_config_init_default (struct ddsi_config *cfg)
   cfg->shm_log_lvl = INT32_C (4);
 #endif /* DDS_HAS_SHM */
 }
-/* generated from ddsi_config.h[caefb1fc403977b0a33941156683b686290988a9] */
+/* generated from ddsi_config.h[2e65029447ea1a56a95ee8ca73d7b3782154f5b6] */
 /* generated from ddsi__cfgunits.h[be1b976c6e9466472b0c331487c05180ec1052d4] */
-/* generated from ddsi__cfgelems.h[bcd0c270d1ce8ec381ac5388056502d990cc4129] */
-/* generated from ddsi_config.c[4d8a28fd8d4388d80e375f617f21fb3c2e1a8e49] */
-/* generated from _confgen.h[f2d235d5551cbf920a8a2962831dddeabd2856ac] */
+/* generated from ddsi__cfgelems.h[d2905ee4deae2c0e477ad7a80ec2750da0dd1311] */
+/* generated from ddsi_config.c[7809c04aba881650c06079976a0805af1ac94646] */
+/* generated from _confgen.h[1fe643b44efd2a46e7ee415447a672b2f666ed7e] */
 /* generated from _confgen.c[d74e4fd06e485c5d299dbcc7741cbdb95c5ec706] */
 /* generated from generate_rnc.c[a2ec6e48d33ac14a320c8ec3f320028a737920e0] */
 /* generated from generate_md.c[37efe4fa9caf56e2647bafc9a7f009f72ff5d2e0] */
 /* generated from generate_rst.c[50739f627792ef056e2b4feeb20fda4edfcef079] */
 /* generated from generate_xsd.c[45064e8869b3c00573057d7c8f02d20f04b40e16] */
-/* generated from generate_defconfig.c[ddf5057ceb5fb512b47f7028da2d75837a349830] */
+/* generated from generate_defconfig.c[8fd648a7f6e2752b1a6a6f2aa1afa589b3fc65b1] */
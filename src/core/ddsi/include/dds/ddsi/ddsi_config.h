@@ -49,6 +49,12 @@ enum ddsi_retransmit_merging {
   DDSI_REXMIT_MERGE_ALWAYS
 };
 
+enum ddsi_fsync_policy {
+  DDSI_FSYNC_NEVER,
+  DDSI_FSYNC_INTERVAL,
+  DDSI_FSYNC_ALWAYS
+};
+
 enum ddsi_boolean_default {
   DDSI_BOOLDEF_DEFAULT,
   DDSI_BOOLDEF_FALSE,
@@ -375,6 +381,7 @@ struct ddsi_config
   int unicast_response_to_spdp_messages;
   int synchronous_delivery_priority_threshold;
   int64_t synchronous_delivery_latency_bound;
+  int rhc_staging;
 
   /* Write cache */
 
@@ -384,9 +391,37 @@ struct ddsi_config
   struct ddsi_config_maybe_uint32 whc_init_highwater_mark;
   int whc_adaptive;
 
+  /* NACK-only reliability */
+  int nack_only_enable;
+  int64_t nack_only_retention_time;
+  uint32_t nack_only_retention_size;
+  int64_t nack_only_suppression_delay;
+
+  /* RTT-adaptive heartbeat and NACK timing */
+  int adaptive_timing_enable;
+  int64_t adaptive_timing_min_nack_delay;
+  int64_t adaptive_timing_max_nack_delay;
+
+  /* Payload compression */
+  char *compression_topics;
+  uint32_t compression_threshold;
+
+  /* Spilling transient-local history to disk */
+  uint32_t whc_spill_writer_limit;
+  uint32_t whc_spill_domain_limit;
+  char *whc_spill_directory;
+
+  /* Store for the history of writers with PERSISTENT durability */
+  char *persistent_store_directory;
+  uint32_t persistent_store_segment_size;
+  int persistent_store_compaction_threshold;
+  enum ddsi_fsync_policy persistent_store_fsync;
+  int64_t persistent_store_fsync_interval;
+
   unsigned defrag_unreliable_maxsamples;
   unsigned defrag_reliable_maxsamples;
   unsigned accelerate_rexmit_block_size;
+  uint32_t fec_group_size;
   int64_t responsiveness_timeout;
   uint32_t max_participants;
   int64_t writer_linger_duration;
@@ -0,0 +1,66 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#ifndef DDSI_CONTENT_FILTER_IF_H
+#define DDSI_CONTENT_FILTER_IF_H
+
+#include <stdbool.h>
+#include "dds/ddsi/ddsi_plist.h"
+
+#if defined (__cplusplus)
+extern "C" {
+#endif
+
+struct ddsi_reader;
+struct ddsi_sertype;
+struct ddsi_serdata;
+
+/* Content filters are interpreted by the layer above DDSI: it tells which filter a local
+   reader advertises in discovery and it compiles the filters advertised by remote readers
+   for use by the local writers they match, so that samples can be filtered before they
+   are sent. */
+struct ddsi_content_filter_interface {
+  void *arg;
+
+  /* fills in the filter property of a local reader, returns false if it has none; the
+     strings are aliased (as in a plist) and only valid while the calling thread is awake */
+  bool (*content_filter_reader_property) (const struct ddsi_reader *rd, ddsi_content_filter_property_t *cfp, void *arg);
+  /* returns NULL if the filter can't be evaluated for the type */
+  void * (*content_filter_compile) (const struct ddsi_sertype *type, const ddsi_content_filter_property_t *cfp, void *arg);
+  bool (*content_filter_eval) (const void *filter, const struct ddsi_serdata *serdata, void *arg);
+  void (*content_filter_free) (void *filter, void *arg);
+};
+
+/** @component content_filter_if */
+inline bool ddsi_content_filter_reader_property (const struct ddsi_content_filter_interface *cfif, const struct ddsi_reader *rd, ddsi_content_filter_property_t *cfp) {
+  return cfif ? cfif->content_filter_reader_property (rd, cfp, cfif->arg) : false;
+}
+
+/** @component content_filter_if */
+inline void *ddsi_content_filter_compile (const struct ddsi_content_filter_interface *cfif, const struct ddsi_sertype *type, const ddsi_content_filter_property_t *cfp) {
+  return cfif ? cfif->content_filter_compile (type, cfp, cfif->arg) : NULL;
+}
+
+/** @component content_filter_if */
+inline bool ddsi_content_filter_eval (const struct ddsi_content_filter_interface *cfif, const void *filter, const struct ddsi_serdata *serdata) {
+  return cfif->content_filter_eval (filter, serdata, cfif->arg);
+}
+
+/** @component content_filter_if */
+inline void ddsi_content_filter_free (const struct ddsi_content_filter_interface *cfif, void *filter) {
+  if (filter) cfif->content_filter_free (filter, cfif->arg);
+}
+
+#if defined (__cplusplus)
+}
+#endif
+
+#endif
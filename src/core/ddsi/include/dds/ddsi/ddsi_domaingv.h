@@ -312,6 +312,7 @@ struct ddsi_domaingv {
   ddsrt_mutex_t pcap_lock;
 
   struct ddsi_builtin_topic_interface *builtin_topic_interface;
+  struct ddsi_content_filter_interface *content_filter_interface;
 
   struct ddsi_mcgroup_membership *mship;
 
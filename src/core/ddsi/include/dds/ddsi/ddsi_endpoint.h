@@ -16,6 +16,7 @@
 #include "dds/features.h"
 
 #include "dds/ddsrt/fibheap.h"
+#include "dds/ddsc/dds_public_qosdefs.h"
 #include "dds/ddsi/ddsi_entity.h"
 #include "dds/ddsi/ddsi_hbcontrol.h"
 
@@ -30,6 +31,8 @@ struct ddsi_entity_common;
 struct ddsi_endpoint_common;
 struct ddsi_ldur_fhnode;
 struct ddsi_entity_index;
+struct ddsi_tkmap_instance;
+struct ddsi_serdata;
 struct dds_qos;
 
 /* Liveliness changed is more complicated than just add/remove. Encode the event
@@ -70,6 +73,7 @@ struct ddsi_writer
   ddsi_seqno_t seq; /* last sequence number (transmitted seqs are 1 ... seq, 0 when nothing published yet) */
   seq_xmit_t seq_xmit; /* last sequence number actually transmitted */
   ddsi_seqno_t min_local_readers_reject_seq; /* mimum of local_readers->last_deliv_seq */
+  ddsi_seqno_t nack_only_drop_seq; /* NACK-only writers: highest sequence number dropped because of retention limits */
   ddsi_count_t hbcount; /* last hb seq number */
   ddsi_count_t hbfragcount; /* last hb frag seq number */
   int throttling; /* non-zero when some thread is waiting for the WHC to shrink */
@@ -85,6 +89,8 @@ struct ddsi_writer
   unsigned test_suppress_retransmit : 1; /* iff 1, the writer does not respond to retransmit requests */
   unsigned test_suppress_heartbeat : 1; /* iff 1, the writer suppresses all periodic heartbeats */
   unsigned test_drop_outgoing_data : 1; /* iff 1, the writer drops outgoing data, forcing the readers to request a retransmit */
+  unsigned nack_only : 1; /* iff 1, the writer never requests ACKs and drops data from the WHC based on retention time/size */
+  unsigned compress : 1; /* iff 1, the writer compresses large samples if all readers can handle it */
 #ifdef DDS_HAS_SHM
   unsigned has_iceoryx : 1;
 #endif
@@ -107,6 +113,8 @@ struct ddsi_writer
   uint32_t num_readers; /* total number of matching PROXY readers */
   uint32_t num_reliable_readers; /* number of matching reliable PROXY readers */
   uint32_t num_readers_requesting_keyhash; /* also +1 for protected keys and config override for generating keyhash */
+  uint32_t num_readers_filtered; /* number of matched proxy readers with a content filter this writer can evaluate or an instance shard */
+  uint32_t num_readers_foreign_vendor; /* number of matching PROXY readers of other vendors, these can't decompress payloads */
   ddsrt_avl_tree_t readers; /* all matching PROXY readers, see struct ddsi_wr_prd_match */
   ddsrt_avl_tree_t local_readers; /* all matching LOCAL readers, see struct ddsi_wr_rd_match */
 #ifdef DDS_HAS_NETWORK_PARTITIONS
@@ -172,6 +180,19 @@ DDS_EXPORT extern const ddsrt_avl_treedef_t ddsi_rd_local_writers_treedef;
 /** @component ddsi_endpoint */
 int ddsi_is_builtin_endpoint (ddsi_entityid_t id, ddsi_vendorid_t vendorid);
 
+/**
+ * @component ddsi_endpoint
+ * @brief Whether an endpoint of the given durability handles historical data like a transient-local one
+ *
+ * There is no durability service, so TRANSIENT and PERSISTENT writers only serve their own
+ * history if the persistent store is enabled. Without it, they behave as they always have.
+ *
+ * @param[in] gv    domain
+ * @param[in] kind  durability kind of the endpoint
+ * @returns true iff historical data is to be handled as for a transient-local endpoint
+ */
+bool ddsi_durability_served_by_writer (const struct ddsi_domaingv *gv, dds_durability_kind_t kind);
+
 
 // writer
 
@@ -214,6 +235,24 @@ dds_return_t ddsi_new_reader (struct ddsi_reader **rd_out, struct ddsi_guid *rdg
 /** @component ddsi_endpoint */
 void ddsi_update_reader_qos (struct ddsi_reader *rd, const struct dds_qos *xqos);
 
+/** @component ddsi_endpoint */
+void ddsi_update_reader_content_filter (struct ddsi_reader *rd);
+
+/**
+ * @component ddsi_endpoint
+ * @brief Whether the instance falls in the reader's shard
+ *
+ * Readers without an instance shard QoS accept all instances; sharded readers only those
+ * that map to their shard and these are to be dropped before storing them in the reader
+ * history cache.
+ *
+ * @param[in] rd      reader
+ * @param[in] tk      instance of the sample
+ * @param[in] sample  sample, of the reader's type
+ * @returns true iff the sample must be delivered to the reader
+ */
+bool ddsi_reader_accepts_instance (const struct ddsi_reader *rd, struct ddsi_tkmap_instance *tk, const struct ddsi_serdata *sample);
+
 /** @component ddsi_endpoint */
 dds_return_t ddsi_delete_reader (struct ddsi_domaingv *gv, const struct ddsi_guid *guid);
 
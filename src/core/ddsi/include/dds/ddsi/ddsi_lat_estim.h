@@ -24,6 +24,7 @@ struct ddsi_lat_estim {
   /* median filtering with a small window in an attempt to remove the
      worst outliers */
   int index;
+  int nsamples;
   float window[DDSI_LAT_ESTIM_MEDIAN_WINSZ];
   /* simple alpha filtering for smoothing */
   float smoothed;
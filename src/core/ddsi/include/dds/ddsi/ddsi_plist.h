@@ -153,6 +153,18 @@ typedef struct ddsi_adlink_participant_version_info
   char *internals;
 } ddsi_adlink_participant_version_info_t;
 
+/* Content filter advertised by a reader (DDSI 9.6.3.1); the only filter class interpreted
+   is the DDS SQL subset ("DDSSQL"), others are passed through but ignored */
+typedef struct ddsi_content_filter_property {
+  char *content_filtered_topic_name;
+  char *related_topic_name;
+  char *filter_class_name;
+  char *filter_expression;
+  ddsi_stringseq_t expression_parameters;
+} ddsi_content_filter_property_t;
+
+#define DDSI_CONTENT_FILTER_CLASS_SQL "DDSSQL"
+
 typedef struct ddsi_plist {
   uint64_t present;
   uint64_t aliased;
@@ -171,7 +183,7 @@ typedef struct ddsi_plist {
   unsigned char expects_inline_qos;
   ddsi_count_t participant_manual_liveliness_count;
   uint32_t participant_builtin_endpoints;
-  /* ddsi_content_filter_property_t content_filter_property; */
+  ddsi_content_filter_property_t content_filter_property;
   ddsi_guid_t participant_guid;
   ddsi_guid_t endpoint_guid;
   ddsi_guid_t group_guid;
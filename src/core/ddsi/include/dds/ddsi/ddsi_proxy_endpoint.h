@@ -104,6 +104,7 @@ struct ddsi_proxy_reader {
   ddsrt_avl_tree_t writers; /* matching LOCAL writers */
   uint32_t receive_buffer_size; /* assumed receive buffer size inherited from proxypp */
   ddsi_filter_fn_t filter;
+  ddsi_content_filter_property_t *content_filter; /* advertised SQL content filter, or NULL */
 };
 
 #if defined (__cplusplus)
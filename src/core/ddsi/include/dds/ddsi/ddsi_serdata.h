@@ -120,7 +120,10 @@ typedef void (*ddsi_serdata_to_ser_unref_t) (struct ddsi_serdata *d, const ddsrt
    If (bufptr != 0), then *bufptr .. buflim is space to be used from *bufptr up (with minimal
    padding) for any data in the sample that needs to be allocated (e.g., strings, sequences);
    otherwise malloc() is to be used for those.  (This allows read/take to be given a block of memory
-   by the caller.) */
+   by the caller.)  On success *bufptr is advanced past the memory used; if the space is insufficient,
+   it returns false and advances *bufptr to where the memory used would have ended had there been
+   enough, so the caller can retry with a large enough block.  Implementations that do not support
+   this abort. */
 typedef bool (*ddsi_serdata_to_sample_t) (const struct ddsi_serdata *d, void *sample, void **bufptr, void *buflim);
 
 /* Create a sample from a untyped serdata, as returned by serdata_to_untyped.  This sample
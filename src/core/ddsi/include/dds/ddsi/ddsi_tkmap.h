@@ -13,6 +13,7 @@
 #define _DDS_TKMAP_H_
 
 #include "dds/ddsrt/atomics.h"
+#include "dds/ddsi/ddsi_xqos.h"
 
 #if defined (__cplusplus)
 extern "C" {
@@ -28,6 +29,7 @@ struct ddsi_tkmap_instance
   struct ddsi_serdata *m_sample;
   uint64_t m_iid;
   ddsrt_atomic_uint32_t m_refc;
+  ddsrt_atomic_uint32_t m_shard_hash; /* hash of the keyhash for instance sharding, 0 if not yet computed */
 };
 
 /** @component key_instance_map */
@@ -54,6 +56,21 @@ struct ddsi_tkmap_instance * ddsi_tkmap_lookup_instance_ref (struct ddsi_tkmap *
 /** @component key_instance_map */
 void ddsi_tkmap_instance_unref (struct ddsi_tkmap *map, struct ddsi_tkmap_instance *tk);
 
+/**
+ * @component key_instance_map
+ * @brief Whether an instance belongs to a shard
+ *
+ * The shard of an instance is determined by hashing its DDSI keyhash, which makes it
+ * the same in all processes.  The hash is computed from the sample the first time it is
+ * needed and then cached in the instance.
+ *
+ * @param[in] tk     instance
+ * @param[in] sd     sample of this instance, of a type that has the key fields
+ * @param[in] shard  shard index and number of shards
+ * @returns true iff the instance maps to shard `shard->index`
+ */
+bool ddsi_tkmap_instance_in_shard (struct ddsi_tkmap_instance *tk, const struct ddsi_serdata *sd, const dds_instance_shard_qospolicy_t *shard);
+
 #if defined (__cplusplus)
 }
 #endif
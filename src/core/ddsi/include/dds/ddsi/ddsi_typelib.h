@@ -85,6 +85,37 @@ DDS_EXPORT void ddsi_typemap_fini (ddsi_typemap_t *typemap);
 /** @component type_system */
 DDS_EXPORT bool ddsi_typemap_equal (const ddsi_typemap_t *a, const ddsi_typemap_t *b);
 
+/**
+ * @component type_system
+ * @brief Resolves a member of a struct type from its (dot-separated) name
+ *
+ * For each level of nesting, the index of the member in the declaration order of its
+ * struct and its member id are returned. Structs with a base type are not supported.
+ *
+ * @param[in] typemap type map containing the complete type objects
+ * @param[in] type_id complete type identifier of the struct type
+ * @param[in] name member name, e.g. "a.b" for member b of the struct-typed member a
+ * @param[in] max_depth size of the index and member_id arrays
+ * @param[out] depth number of levels in the path
+ * @param[out] index member index in the struct for each level
+ * @param[out] member_id member id for each level
+ * @returns DDS_RETCODE_OK, DDS_RETCODE_BAD_PARAMETER if the name doesn't identify a member, or DDS_RETCODE_UNSUPPORTED
+ */
+DDS_EXPORT dds_return_t ddsi_typemap_resolve_member (const ddsi_typemap_t *typemap, const ddsi_typeid_t *type_id, const char *name, uint32_t max_depth, uint32_t *depth, uint32_t *index, uint32_t *member_id);
+
+/**
+ * @component type_system
+ * @brief Looks up the value of a literal of the enumerated type of a struct member
+ *
+ * @param[in] typemap type map containing the complete type objects
+ * @param[in] type_id complete type identifier of the struct type
+ * @param[in] name member name as for @ref ddsi_typemap_resolve_member
+ * @param[in] literal name of the enumerator
+ * @param[out] value value of the enumerator
+ * @returns DDS_RETCODE_OK, DDS_RETCODE_BAD_PARAMETER if the member is not an enum or has no such literal, or DDS_RETCODE_UNSUPPORTED
+ */
+DDS_EXPORT dds_return_t ddsi_typemap_resolve_enum_literal (const ddsi_typemap_t *typemap, const ddsi_typeid_t *type_id, const char *name, const char *literal, int32_t *value);
+
 /** @component type_system */
 dds_return_t ddsi_type_ref_local (struct ddsi_domaingv *gv, struct ddsi_type **type, const struct ddsi_sertype *sertype, ddsi_typeid_kind_t kind);
 
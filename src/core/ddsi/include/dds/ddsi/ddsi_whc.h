@@ -34,6 +34,7 @@ struct ddsi_whc_node {
 struct ddsi_whc_borrowed_sample {
   ddsi_seqno_t seq;
   struct ddsi_serdata *serdata;
+  struct ddsi_serdata *wire_serdata; /* form in which it goes out on the wire, may be serdata */
   bool unacked;
   ddsrt_mtime_t last_rexmit_ts;
   unsigned rexmit_count;
@@ -78,7 +79,9 @@ typedef void (*whc_free_t)(struct ddsi_whc *whc);
    reliable readers that have not acknowledged all data */
 /* max_drop_seq must go soon, it's way too ugly. */
 /* plist may be NULL or ddsrt_malloc'd, WHC takes ownership of plist */
-typedef int (*ddsi_whc_insert_t)(struct ddsi_whc *whc, ddsi_seqno_t max_drop_seq, ddsi_seqno_t seq, ddsrt_mtime_t exp, struct ddsi_serdata *serdata, struct ddsi_tkmap_instance *tk);
+/* wire_serdata is what gets transmitted, either serdata itself or a (compressed) serdata
+   derived from it, it is retained for retransmits so these always use the same form */
+typedef int (*ddsi_whc_insert_t)(struct ddsi_whc *whc, ddsi_seqno_t max_drop_seq, ddsi_seqno_t seq, ddsrt_mtime_t exp, struct ddsi_serdata *serdata, struct ddsi_serdata *wire_serdata, struct ddsi_tkmap_instance *tk);
 typedef uint32_t (*ddsi_whc_remove_acked_messages_t)(struct ddsi_whc *whc, ddsi_seqno_t max_drop_seq, struct ddsi_whc_state *whcst, struct ddsi_whc_node **deferred_free_list);
 typedef void (*ddsi_whc_free_deferred_free_list_t)(struct ddsi_whc *whc, struct ddsi_whc_node *deferred_free_list);
 
@@ -173,6 +173,25 @@ typedef struct dds_ignorelocal_qospolicy {
   dds_ignorelocal_kind_t value;
 } dds_ignorelocal_qospolicy_t;
 
+typedef struct dds_instance_shard_qospolicy {
+  uint32_t index;
+  uint32_t count;
+} dds_instance_shard_qospolicy_t;
+
+/** Maximum number of loans a reader can have outstanding, each one costs memory up front */
+#define DDS_READER_LOAN_POOL_MAX_DEPTH 256u
+
+typedef struct dds_reader_loan_pool_qospolicy {
+  uint32_t depth;
+} dds_reader_loan_pool_qospolicy_t;
+
+/** Maximum capacity of a reader stream, the ring is allocated up front */
+#define DDS_READER_STREAM_MAX_CAPACITY (UINT32_C (1) << 20)
+
+typedef struct dds_reader_stream_qospolicy {
+  uint32_t capacity;
+} dds_reader_stream_qospolicy_t;
+
 typedef struct dds_type_consistency_enforcement_qospolicy {
   dds_type_consistency_kind_t kind;
   bool ignore_sequence_bounds;
@@ -221,8 +240,10 @@ typedef struct dds_data_representation_qospolicy {
 #define DDSI_QP_ADLINK_WRITER_DATA_LIFECYCLE      ((uint64_t)1 << 21)
 #define DDSI_QP_ADLINK_READER_DATA_LIFECYCLE      ((uint64_t)1 << 22)
 #define DDSI_QP_ADLINK_READER_LIFESPAN            ((uint64_t)1 << 24)
-//available: ((uint64_t)1 << 25)
+#define DDSI_QP_CYCLONE_INSTANCE_SHARD            ((uint64_t)1 << 25)
+#define DDSI_QP_CYCLONE_READER_LOAN_POOL          ((uint64_t)1 << 26)
 #define DDSI_QP_ADLINK_ENTITY_FACTORY             ((uint64_t)1 << 27)
+#define DDSI_QP_CYCLONE_READER_STREAM             ((uint64_t)1 << 28)
 #define DDSI_QP_CYCLONE_IGNORELOCAL               ((uint64_t)1 << 30)
 #define DDSI_QP_PROPERTY_LIST                     ((uint64_t)1 << 31)
 #define DDSI_QP_TYPE_CONSISTENCY_ENFORCEMENT      ((uint64_t)1 << 32)
@@ -285,6 +306,9 @@ struct dds_qos {
   /*x xR*/dds_reader_data_lifecycle_qospolicy_t reader_data_lifecycle;
   /*x xR*/dds_reader_lifespan_qospolicy_t reader_lifespan;
   /* x  */dds_ignorelocal_qospolicy_t ignorelocal;
+  /*xxxR*/dds_instance_shard_qospolicy_t instance_shard;
+  /*x  R*/dds_reader_loan_pool_qospolicy_t reader_loan_pool;
+  /*x  R*/dds_reader_stream_qospolicy_t reader_stream;
   /*xxx */dds_property_qospolicy_t property;
   /*xxxR*/dds_type_consistency_enforcement_qospolicy_t type_consistency;
   /*xxxX*/dds_locator_mask_t ignore_locator_type;
@@ -1030,6 +1030,190 @@ static struct cfgelem internal_watermarks_cfgelems[] = {
   END_MARKER
 };
 
+static struct cfgelem internal_nackonly_cfgelems[] = {
+  BOOL("Enable", NULL, 1, "false",
+    MEMBER(nack_only_enable),
+    FUNCTIONS(0, uf_boolean, 0, pf_boolean),
+    DESCRIPTION(
+      "<p>This element enables NACK-only reliability for application "
+      "writers and readers. In this mode heartbeats never request an "
+      "acknowledgement, readers only send NACKs for missing data after a "
+      "random delay and writers drop data from the WHC once it exceeds the "
+      "retention time or size instead of waiting for all readers to "
+      "acknowledge it. This trades strict reliability for scaling to very "
+      "large numbers of readers and should be enabled consistently across "
+      "the system.</p>"
+    )),
+  STRING("RetentionTime", NULL, 1, "1 s",
+    MEMBER(nack_only_retention_time),
+    FUNCTIONS(0, uf_duration_ms_1hr, 0, pf_duration),
+    DESCRIPTION(
+      "<p>This element sets how long a NACK-only writer retains a sample "
+      "for retransmission.</p>"),
+    UNIT("duration")),
+  STRING("RetentionSize", NULL, 1, "256 kB",
+    MEMBER(nack_only_retention_size),
+    FUNCTIONS(0, uf_memsize, 0, pf_memsize),
+    DESCRIPTION(
+      "<p>This element sets the maximum amount of data, expressed in bytes, "
+      "a NACK-only writer retains for retransmission. It should be less "
+      "than Internal/Watermarks/WhcHigh to avoid throttling the writer.</p>"),
+    UNIT("memsize")),
+  STRING("NackSuppressionDelay", NULL, 1, "10 ms",
+    MEMBER(nack_only_suppression_delay),
+    FUNCTIONS(0, uf_duration_us_1s, 0, pf_duration),
+    DESCRIPTION(
+      "<p>This element sets the upper bound of the random delay between "
+      "a reader detecting missing data and sending a NACK. Multicast "
+      "retransmits requested by other readers in the meantime suppress the "
+      "NACK.</p>"),
+    UNIT("duration")),
+  END_MARKER
+};
+
+static struct cfgelem internal_adaptivetiming_cfgelems[] = {
+  BOOL("Enable", NULL, 1, "false",
+    MEMBER(adaptive_timing_enable),
+    FUNCTIONS(0, uf_boolean, 0, pf_boolean),
+    DESCRIPTION(
+      "<p>This element enables deriving heartbeat and NACK timing from "
+      "round-trip times measured per matched remote endpoint. Writers "
+      "measure the time from a heartbeat requesting an acknowledgement to "
+      "the ACKNACK of each reader and use 4 times the largest of these as "
+      "the base heartbeat interval, bounded by the min and max attributes "
+      "of Internal/HeartbeatInterval. Readers measure the time from an "
+      "ACKNACK to the heartbeat the writer sends in response and use twice "
+      "that as the delay before repeating a NACK, instead of "
+      "Internal/NackDelay.</p>\n"
+      "<p>If Internal/MeasureHbToAckLatency is enabled, writers use the "
+      "timestamps echoed by the readers instead.</p>"
+    )),
+  STRING("MinNackDelay", NULL, 1, "500 us",
+    MEMBER(adaptive_timing_min_nack_delay),
+    FUNCTIONS(0, uf_duration_us_1s, 0, pf_duration),
+    DESCRIPTION(
+      "<p>This element sets the lower bound for the RTT-derived delay before "
+      "repeating a NACK.</p>"),
+    UNIT("duration")),
+  STRING("MaxNackDelay", NULL, 1, "1 s",
+    MEMBER(adaptive_timing_max_nack_delay),
+    FUNCTIONS(0, uf_duration_ms_1hr, 0, pf_duration),
+    DESCRIPTION(
+      "<p>This element sets the upper bound for the RTT-derived delay before "
+      "repeating a NACK.</p>"),
+    UNIT("duration")),
+  END_MARKER
+};
+
+static struct cfgelem internal_compression_cfgelems[] = {
+  STRING("Topics", NULL, 1, "",
+    MEMBER(compression_topics),
+    FUNCTIONS(0, uf_string, ff_free, pf_string),
+    DESCRIPTION(
+      "<p>This element specifies a comma-separated list of topic names, "
+      "possibly containing the usual ? and * wildcards, of which the writers "
+      "compress the serialised payload of samples of at least "
+      "Internal/Compression/Threshold bytes using a built-in LZ-style codec. "
+      "The empty string disables compression.</p>\n"
+      "<p>Compressed samples are marked with the non-standard payload flag "
+      "and are only understood by Cyclone DDS readers that support "
+      "compression. Writers never compress while a reader of another vendor "
+      "is matched, but older versions of Cyclone DDS will fail to interpret "
+      "the data.</p>")),
+  STRING("Threshold", NULL, 1, "4 kB",
+    MEMBER(compression_threshold),
+    FUNCTIONS(0, uf_memsize, 0, pf_memsize),
+    DESCRIPTION(
+      "<p>This element sets the minimum size of the serialised payload of a "
+      "sample for it to be compressed. Compressed payloads are only sent if "
+      "they are smaller than the original.</p>"),
+    UNIT("memsize")),
+  END_MARKER
+};
+
+static struct cfgelem internal_whcspill_cfgelems[] = {
+  STRING("WriterLimit", NULL, 1, "0 B",
+    MEMBER(whc_spill_writer_limit),
+    FUNCTIONS(0, uf_memsize, 0, pf_memsize),
+    DESCRIPTION(
+      "<p>This element sets the maximum amount of serialised data, expressed "
+      "in bytes, a transient-local writer keeps in memory. Once exceeded, "
+      "acknowledged samples retained only for late-joining readers are moved "
+      "to a spill file and read back when they need to be sent again. "
+      "0 means unlimited.</p>"),
+    UNIT("memsize")),
+  STRING("DomainLimit", NULL, 1, "0 B",
+    MEMBER(whc_spill_domain_limit),
+    FUNCTIONS(0, uf_memsize, 0, pf_memsize),
+    DESCRIPTION(
+      "<p>This element sets the maximum amount of serialised data, expressed "
+      "in bytes, all transient-local writers in the domain together keep in "
+      "memory before spilling acknowledged samples to disk. 0 means "
+      "unlimited.</p>"),
+    UNIT("memsize")),
+  STRING("Directory", NULL, 1, "",
+    MEMBER(whc_spill_directory),
+    FUNCTIONS(0, uf_string, ff_free, pf_string),
+    DESCRIPTION(
+      "<p>This element specifies the directory in which the spill files are "
+      "created. The empty string means an anonymous temporary file is used. "
+      "Spill files are removed when the writer is deleted.</p>")),
+  END_MARKER
+};
+
+static struct cfgelem internal_persistentstore_cfgelems[] = {
+  STRING("Directory", NULL, 1, "",
+    MEMBER(persistent_store_directory),
+    FUNCTIONS(0, uf_string, ff_free, pf_string),
+    DESCRIPTION(
+      "<p>This element specifies the directory in which writers with "
+      "PERSISTENT durability store their history, so that it can be "
+      "republished to late-joining readers after the application restarts. "
+      "The empty string disables the store, in which case such writers "
+      "retain their history in memory only, like TRANSIENT writers.</p>\n"
+      "<p>The history of a writer is stored in a log consisting of segment "
+      "files named after the topic. Only one writer in a process can use "
+      "the log of a topic at the same time, and the directory must not be "
+      "shared between processes.</p>")),
+  STRING("SegmentSize", NULL, 1, "16 MiB",
+    MEMBER(persistent_store_segment_size),
+    FUNCTIONS(0, uf_memsize, 0, pf_memsize),
+    DESCRIPTION(
+      "<p>This element sets the size at which a new segment file of the "
+      "log is started.</p>"),
+    UNIT("memsize")),
+  INT("CompactionThreshold", NULL, 1, "50",
+    MEMBER(persistent_store_compaction_threshold),
+    FUNCTIONS(0, uf_natint_100, 0, pf_int),
+    DESCRIPTION(
+      "<p>This element sets the percentage of a segment that must be "
+      "occupied by samples that are no longer part of the history before "
+      "the remaining samples are copied to the newest segment and the "
+      "segment is removed. Segments containing no live data are always "
+      "removed.</p>"),
+    RANGE("0;100")),
+  ENUM("Fsync", NULL, 1, "interval",
+    MEMBER(persistent_store_fsync),
+    FUNCTIONS(0, uf_fsync_policy, 0, pf_fsync_policy),
+    DESCRIPTION(
+      "<p>This element controls when the log is synchronised to disk:</p>\n"
+      "<ul><li><i>never</i>: leave it to the operating system;</li>\n"
+      "<li><i>interval</i>: when updating the log at least "
+      "Internal/PersistentStore/FsyncInterval after the previous "
+      "synchronisation, and when closing a segment;</li>\n"
+      "<li><i>always</i>: after every update.</li></ul>"),
+    VALUES("never","interval","always")),
+  STRING("FsyncInterval", NULL, 1, "1 s",
+    MEMBER(persistent_store_fsync_interval),
+    FUNCTIONS(0, uf_duration_ms_1hr, 0, pf_duration),
+    DESCRIPTION(
+      "<p>This element sets the minimum interval between synchronisations "
+      "of the log to disk if Internal/PersistentStore/Fsync is set to "
+      "<i>interval</i>.</p>"),
+    UNIT("duration")),
+  END_MARKER
+};
+
 static struct cfgelem internal_burstsize_cfgelems[] = {
   STRING("MaxRexmit", NULL, 1, "1 MiB",
     MEMBER(max_rexmit_burst_size),
@@ -1269,8 +1453,8 @@ static struct cfgelem internal_cfgelems[] = {
       "<p>This element enables heartbeat-to-ack latency among Cyclone DDS "
       "services by prepending timestamps to Heartbeat and AckNack messages "
       "and calculating round trip times. This is non-standard behaviour. The "
-      "measured latencies are quite noisy and are currently not used "
-      "anywhere.</p>")),
+      "measured latencies are quite noisy and are only used if "
+      "Internal/AdaptiveTiming is enabled.</p>")),
   BOOL("UnicastResponseToSPDPMessages", NULL, 1, "true",
     MEMBER(unicast_response_to_spdp_messages),
     FUNCTIONS(0, uf_boolean, 0, pf_boolean),
@@ -1300,6 +1484,17 @@ static struct cfgelem internal_cfgelems[] = {
       "asynchronously through delivery queues. This reduces latency at the "
       "expense of aggregate bandwidth.</p>"),
     UNIT("duration_inf")),
+  BOOL("StagedDelivery", NULL, 1, "false",
+    MEMBER(rhc_staging),
+    FUNCTIONS(0, uf_boolean, 0, pf_boolean),
+    DESCRIPTION(
+      "<p>This element controls whether delivering a sample to a reader "
+      "that is being read from or taken from at the same time queues the "
+      "sample instead of waiting for the application to finish. The queued "
+      "samples are added to the reader history by the next operation on it. "
+      "This only applies to readers with destination order by reception "
+      "timestamp, shared ownership, unlimited resource limits and no content "
+      "filter, and only to writes, not to disposes or unregisters.</p>")),
   INT("MaxParticipants", NULL, 1, "0",
     MEMBER(max_participants),
     FUNCTIONS(0, uf_natint, 0, pf_int),
@@ -1315,6 +1510,17 @@ static struct cfgelem internal_cfgelems[] = {
       "data get this many samples retransmitted when they NACK something, "
       "even if some of these samples have sequence numbers outside the set "
       "covered by the NACK.</p>")),
+  INT("FecGroupSize", NULL, 1, "0",
+    MEMBER(fec_group_size),
+    FUNCTIONS(0, uf_uint, 0, pf_uint),
+    DESCRIPTION(
+      "<p>This element enables forward error correction for fragmented "
+      "samples: after every this many DATA_FRAG submessages of a sample, "
+      "writers send a vendor-specific XOR parity submessage from which "
+      "Cyclone DDS readers can reconstruct a single lost DATA_FRAG "
+      "submessage of that group without a NACKFRAG round trip. The first "
+      "DATA_FRAG of a sample carries the inline QoS and cannot be "
+      "reconstructed. Values less than 2 disable it.</p>")),
   ENUM("RetransmitMerging", NULL, 1, "never",
     MEMBER(retransmit_merging),
     FUNCTIONS(0, uf_retransmit_merging, 0, pf_retransmit_merging),
@@ -1603,6 +1809,35 @@ static struct cfgelem internal_cfgelems[] = {
     NOMEMBER,
     NOFUNCTIONS,
     DESCRIPTION("<p>Watermarks for flow-control.</p>")),
+  GROUP("NackOnlyReliability", internal_nackonly_cfgelems, NULL, 1,
+    NOMEMBER,
+    NOFUNCTIONS,
+    DESCRIPTION(
+      "<p>Settings for the NACK-only reliability mode for very large "
+      "numbers of readers.</p>")),
+  GROUP("AdaptiveTiming", internal_adaptivetiming_cfgelems, NULL, 1,
+    NOMEMBER,
+    NOFUNCTIONS,
+    DESCRIPTION(
+      "<p>Settings for adapting heartbeat and NACK timing to measured "
+      "round-trip times.</p>")),
+  GROUP("Compression", internal_compression_cfgelems, NULL, 1,
+    NOMEMBER,
+    NOFUNCTIONS,
+    DESCRIPTION(
+      "<p>Settings for compressing the payload of large samples.</p>")),
+  GROUP("WhcSpill", internal_whcspill_cfgelems, NULL, 1,
+    NOMEMBER,
+    NOFUNCTIONS,
+    DESCRIPTION(
+      "<p>Settings for bounding the memory used by the history of "
+      "transient-local writers by spilling it to disk.</p>")),
+  GROUP("PersistentStore", internal_persistentstore_cfgelems, NULL, 1,
+    NOMEMBER,
+    NOFUNCTIONS,
+    DESCRIPTION(
+      "<p>Settings for storing the history of writers with PERSISTENT "
+      "durability on disk.</p>")),
   GROUP("BurstSize", internal_burstsize_cfgelems, NULL, 1,
     NOMEMBER,
     NOFUNCTIONS,
@@ -0,0 +1,131 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#ifndef DDSI__COMPRESS_H
+#define DDSI__COMPRESS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "dds/ddsi/ddsi_serdata.h"
+
+#if defined (__cplusplus)
+extern "C" {
+#endif
+
+struct ddsi_domaingv;
+struct ddsi_writer;
+struct ddsi_proxy_reader;
+struct ddsi_whc_borrowed_sample;
+struct ddsi_rdata;
+
+/* Compressed payloads are sent with the non-standard payload flag set in the DATA or
+   DATA_FRAG submessage and consist of the 4-byte encapsulation header of the original
+   payload, the size of the remainder of the original payload as a big-endian 32-bit
+   unsigned integer, followed by the compressed remainder. */
+#define DDSI_COMPRESS_HEADER_SIZE 8u
+
+/**
+ * @brief Compresses a buffer using a simple LZ77-style codec
+ * @component payload_compression
+ *
+ * The encoding is deterministic: compressing the same input twice gives the same output.
+ *
+ * @param[out] dst      destination buffer
+ * @param[in]  dstsize  size of destination buffer
+ * @param[in]  src      data to be compressed
+ * @param[in]  srcsize  size of data to be compressed
+ * @returns size of the compressed data, or 0 if it doesn't fit in dstsize bytes
+ */
+size_t ddsi_lz_compress (void *dst, size_t dstsize, const void *src, size_t srcsize);
+
+/**
+ * @brief Decompresses the output of @ref ddsi_lz_compress
+ * @component payload_compression
+ *
+ * Trailing bytes in the source buffer following the compressed data are ignored.
+ *
+ * @param[out] dst      destination buffer
+ * @param[in]  dstsize  exact size of the decompressed data
+ * @param[in]  src      compressed data
+ * @param[in]  srcsize  size of compressed data
+ * @returns true iff decompressing yielded exactly dstsize bytes without reading past
+ * the end of src
+ */
+bool ddsi_lz_decompress (void *dst, size_t dstsize, const void *src, size_t srcsize);
+
+/** @component payload_compression */
+bool ddsi_compression_topic_matches (const struct ddsi_domaingv *gv, const char *topic_name);
+
+/**
+ * @brief Compresses a sample published by a writer
+ * @component payload_compression
+ *
+ * If the writer compresses its data and the sample is at least the configured threshold,
+ * this returns a new serdata wrapping the compressed serialised representation of the
+ * sample (provided that is smaller).  Otherwise it returns a new reference to the
+ * original.  The result has the same kind, type, keyhash, timestamps and status info as
+ * the original.
+ *
+ * Whether the compressed form may be used depends on the matching readers, that is up to
+ * the caller.
+ *
+ * @param[in] wr       writer, lock need not be held
+ * @param[in] serdata  sample
+ * @returns a new reference to the (possibly compressed) serdata
+ */
+struct ddsi_serdata *ddsi_writer_compress_serdata (const struct ddsi_writer *wr, struct ddsi_serdata *serdata);
+
+/**
+ * @brief Returns the serdata to put on the wire for a sample published by a writer
+ * @component payload_compression
+ *
+ * Same as @ref ddsi_writer_compress_serdata, but only compresses if all matching remote
+ * readers can decompress it.  This is decided once, when the sample is written: the WHC
+ * retains the result for retransmits, see @ref ddsi_writer_rexmit_serdata.
+ *
+ * @param[in] wr       writer, lock must be held
+ * @param[in] serdata  sample
+ * @returns a new reference to the serdata to be transmitted
+ */
+struct ddsi_serdata *ddsi_writer_wire_serdata (const struct ddsi_writer *wr, struct ddsi_serdata *serdata);
+
+/**
+ * @brief Returns the serdata to retransmit for a sample borrowed from the WHC
+ * @component payload_compression
+ *
+ * @param[in] sample  borrowed sample
+ * @param[in] prd     proxy reader the retransmit is for, or NULL if for all
+ * @returns the serdata to transmit, borrowed from the sample
+ */
+struct ddsi_serdata *ddsi_writer_rexmit_serdata (const struct ddsi_whc_borrowed_sample *sample, const struct ddsi_proxy_reader *prd);
+
+/** @component payload_compression */
+bool ddsi_serdata_is_compressed (const struct ddsi_serdata *serdata);
+
+/**
+ * @brief Constructs a serdata from a compressed payload received in a fragment chain
+ * @component payload_compression
+ *
+ * @param[in] gv         domain, for the maximum sample size
+ * @param[in] type       sertype
+ * @param[in] kind       serdata kind
+ * @param[in] fragchain  fragment chain containing the compressed payload
+ * @param[in] size       size of the compressed payload
+ * @returns new serdata or NULL if the payload is malformed
+ */
+struct ddsi_serdata *ddsi_serdata_from_compressed_ser (const struct ddsi_domaingv *gv, const struct ddsi_sertype *type, enum ddsi_serdata_kind kind, const struct ddsi_rdata *fragchain, size_t size);
+
+#if defined (__cplusplus)
+}
+#endif
+
+#endif /* DDSI__COMPRESS_H */
@@ -80,6 +80,9 @@ ddsi_seqno_t ddsi_writer_max_drop_seq (const struct ddsi_writer *wr);
 /** @component ddsi_endpoint */
 int ddsi_writer_must_have_hb_scheduled (const struct ddsi_writer *wr, const struct ddsi_whc_state *whcst);
 
+/** @component ddsi_endpoint */
+unsigned ddsi_writer_nack_only_expire (struct ddsi_writer *wr, ddsrt_mtime_t tnow, struct ddsi_whc_state *whcst, struct ddsi_whc_node **deferred_free_list);
+
 /** @component ddsi_endpoint */
 void ddsi_writer_set_retransmitting (struct ddsi_writer *wr);
 
@@ -32,6 +32,8 @@ struct ddsi_proxy_writer;
 struct ddsi_proxy_reader;
 struct ddsi_alive_state;
 struct ddsi_generic_proxy_endpoint;
+struct ddsi_serdata;
+struct ddsi_tkmap_instance;
 
 struct ddsi_bestab {
   unsigned besflag;
@@ -92,6 +94,7 @@ struct ddsi_wr_prd_match {
   unsigned has_replied_to_hb: 1; /* we must keep sending HBs until all readers have this set */
   unsigned all_have_replied_to_hb: 1; /* true iff 'has_replied_to_hb' for all readers in subtree */
   unsigned is_reliable: 1; /* true iff reliable proxy reader */
+  unsigned accepts_sample: 1; /* scratch: whether sample being written passes the reader's filters */
   ddsi_seqno_t min_seq; /* smallest ack'd seq nr in subtree */
   ddsi_seqno_t max_seq; /* sort-of highest ack'd seq nr in subtree (see augment function) */
   ddsi_seqno_t seq; /* highest acknowledged seq nr */
@@ -104,8 +107,13 @@ struct ddsi_wr_prd_match {
   ddsrt_etime_t t_nackfrag_accepted; /* (local) time a nackfrag was last accepted */
   struct ddsi_lat_estim hb_to_ack_latency;
   ddsrt_wctime_t hb_to_ack_latency_tlastlog;
+  ddsrt_mtime_t t_last_ackhb; /* ACK-requesting heartbeat used for the most recent RTT sample */
+  int64_t rtt; /* round-trip time estimate in ns, 0 if unknown (only with adaptive timing) */
+  int64_t max_rtt; /* largest rtt in subtree */
   uint32_t non_responsive_count;
   uint32_t rexmit_requests;
+  void *content_filter; /* proxy reader's content filter compiled for the writer's type, or NULL */
+  dds_instance_shard_qospolicy_t instance_shard; /* proxy reader's instance shard, count = 0 if it has none */
 #ifdef DDS_HAS_SECURITY
   int64_t crypto_handle;
 #endif
@@ -129,6 +137,9 @@ struct ddsi_pwr_rd_match {
   ddsrt_etime_t t_heartbeat_accepted; /* (local) time a heartbeat was last accepted */
   ddsrt_mtime_t t_last_nack; /* (local) time we last sent a NACK */
   ddsrt_mtime_t t_last_ack; /* (local) time we last sent any ACKNACK */
+  ddsrt_mtime_t t_rtt_probe; /* (local) time of last ACKNACK not yet answered by a directed heartbeat, 0 if none */
+  struct ddsi_lat_estim ack_to_hb_latency;
+  int64_t nack_delay; /* delay before repeating a NACK: NackDelay, or derived from the RTT with adaptive timing */
   ddsi_seqno_t last_seq; /* last known sequence number from this writer */
   struct ddsi_last_nack_summary last_nack;
   struct ddsi_xevent *acknack_xevent; /* entry in xevent queue for sending acknacks */
@@ -177,6 +188,21 @@ void ddsi_match_proxy_reader_with_writers (struct ddsi_proxy_reader *prd, ddsrt_
 /** @component endpoint_matching */
 void ddsi_free_wr_prd_match (const struct ddsi_domaingv *gv, const ddsi_guid_t *wr_guid, struct ddsi_wr_prd_match *m);
 
+/** @component endpoint_matching */
+bool ddsi_wr_prd_match_is_filtered (const struct ddsi_wr_prd_match *m);
+
+/**
+ * @component endpoint_matching
+ * @brief Whether a sample passes the content filter and instance shard of a proxy reader
+ *
+ * @param[in] gv       domain
+ * @param[in] m        writer's match with the proxy reader
+ * @param[in] serdata  sample
+ * @param[in] tk       instance of the sample, or NULL to look it up when needed
+ * @returns false iff the reader is known to be uninterested in the sample
+ */
+bool ddsi_wr_prd_match_accepts_sample (struct ddsi_domaingv *gv, const struct ddsi_wr_prd_match *m, struct ddsi_serdata *serdata, struct ddsi_tkmap_instance *tk);
+
 /** @component endpoint_matching */
 void ddsi_free_rd_pwr_match (struct ddsi_domaingv *gv, const ddsi_guid_t *rd_guid, struct ddsi_rd_pwr_match *m);
 
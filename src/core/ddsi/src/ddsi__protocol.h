@@ -142,6 +142,7 @@ typedef struct ddsi_rtps_data {
 #define DDSI_DATA_FLAG_INLINE_QOS 0x02u
 #define DDSI_DATA_FLAG_DATAFLAG 0x04u
 #define DDSI_DATA_FLAG_KEYFLAG 0x08u
+#define DDSI_DATA_FLAG_NONSTANDARD 0x10u
 
 typedef struct ddsi_rtps_datafrag {
   ddsi_rtps_data_datafrag_common_t x;
@@ -152,6 +153,7 @@ typedef struct ddsi_rtps_datafrag {
 } ddsi_rtps_datafrag_t;
 #define DDSI_DATAFRAG_FLAG_INLINE_QOS 0x02u
 #define DDSI_DATAFRAG_FLAG_KEYFLAG 0x04u
+#define DDSI_DATAFRAG_FLAG_NONSTANDARD 0x08u
 
 DDSRT_WARNING_MSVC_OFF(4200)
 typedef struct ddsi_rtps_acknack {
@@ -220,6 +222,25 @@ DDSRT_WARNING_MSVC_ON(4200)
 #define DDSI_NACKFRAG_SIZE(numbits) (offsetof (ddsi_rtps_nackfrag_t, bits) + DDSI_FRAGMENT_NUMBER_SET_BITS_SIZE (numbits) + 4)
 #define DDSI_NACKFRAG_SIZE_MAX DDSI_NACKFRAG_SIZE (DDSI_FRAGMENT_NUMBER_SET_MAX_BITS)
 
+/* Vendor-specific forward error correction for a fragmented sample: the
+   payload is the XOR of numBlocks consecutive blocks of fragmentsPerBlock
+   fragments each, starting at fragmentStartingNum (1-based, like in
+   DATA_FRAG), where the block that is cut short by the end of the sample
+   is zero-padded.  Each block corresponds to one DATA_FRAG submessage of
+   the initial transmission, so a reader can reconstruct any single lost
+   DATA_FRAG of the group except the one carrying fragment 1. */
+typedef struct ddsi_rtps_adlink_fec {
+  ddsi_rtps_submessage_header_t smhdr;
+  ddsi_entityid_t readerId;
+  ddsi_entityid_t writerId;
+  ddsi_sequence_number_t writerSN;
+  ddsi_fragment_number_t fragmentStartingNum;
+  uint16_t fragmentsPerBlock;
+  uint16_t fragmentSize;
+  uint32_t sampleSize;
+  uint32_t numBlocks;
+} ddsi_rtps_adlink_fec_t;
+
 typedef union ddsi_rtps_submessage {
   ddsi_rtps_submessage_header_t smhdr;
   ddsi_rtps_acknack_t acknack;
@@ -232,6 +253,7 @@ typedef union ddsi_rtps_submessage {
   ddsi_rtps_heartbeatfrag_t heartbeatfrag;
   ddsi_rtps_gap_t gap;
   ddsi_rtps_nackfrag_t nackfrag;
+  ddsi_rtps_adlink_fec_t fec;
 } ddsi_rtps_submessage_t;
 
 
@@ -370,6 +392,7 @@ typedef union ddsi_rtps_submessage {
 #define DDSI_PID_CYCLONE_TOPIC_GUID                  (DDSI_PID_VENDORSPECIFIC_FLAG | 0x1bu)
 #define DDSI_PID_CYCLONE_REQUESTS_KEYHASH            (DDSI_PID_VENDORSPECIFIC_FLAG | 0x1cu)
 #define DDSI_PID_CYCLONE_REDUNDANT_NETWORKING        (DDSI_PID_VENDORSPECIFIC_FLAG | 0x1du)
+#define DDSI_PID_CYCLONE_INSTANCE_SHARD              (DDSI_PID_VENDORSPECIFIC_FLAG | 0x1eu)
 
 
 #if defined (__cplusplus)
@@ -174,6 +174,9 @@ enum ddsi_defrag_nackmap_result ddsi_defrag_nackmap (struct ddsi_defrag *defrag,
 /** @component receive_buffers */
 void ddsi_defrag_prune (struct ddsi_defrag *defrag, ddsi_guid_prefix_t *dst, ddsi_seqno_t min);
 
+/** @component receive_buffers */
+bool ddsi_defrag_fec_reconstruct (struct ddsi_defrag *defrag, ddsi_seqno_t seq, uint32_t size, uint32_t fragsize, uint32_t group_min, uint32_t blocksize, uint32_t nblocks, unsigned char *parity, uint32_t *min, uint32_t *maxp1);
+
 /** @component receive_buffers */
 struct ddsi_reorder *ddsi_reorder_new (const struct ddsrt_log_cfg *logcfg, enum ddsi_reorder_mode mode, uint32_t max_samples, bool late_ack_mode);
 
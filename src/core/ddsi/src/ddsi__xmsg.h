@@ -231,6 +231,26 @@ void ddsi_xmsg_submsg_init (struct ddsi_xmsg *msg, struct ddsi_xmsg_marker marke
 /** @component rtps_submsg */
 void ddsi_xmsg_add_timestamp (struct ddsi_xmsg *m, ddsrt_wctime_t t);
 
+/**
+ * @brief Appends an INFO_TS and the fixed part of a DATA submessage
+ * @component rtps_submsg
+ *
+ * Both submessages are copied from a pre-encoded template with only the timestamp,
+ * the flags, the entity ids and the sequence number patched in, which is cheaper than
+ * constructing them one submessage at a time.  The DATA submessage still needs to be
+ * completed by the caller using @ref ddsi_xmsg_submsg_setnext.
+ *
+ * @param[in] m          message to append to
+ * @param[out] sm_marker marker for the DATA submessage
+ * @param[in] t          source timestamp
+ * @param[in] flags      DATA submessage flags in addition to the endianness flag
+ * @param[in] readerId   reader entity id
+ * @param[in] writerId   writer entity id
+ * @param[in] seq        sequence number
+ * @returns pointer to the DATA submessage, valid until the message is next extended
+ */
+ddsi_rtps_data_t *ddsi_xmsg_append_timestamp_data (struct ddsi_xmsg *m, struct ddsi_xmsg_marker *sm_marker, ddsrt_wctime_t t, unsigned char flags, ddsi_entityid_t readerId, ddsi_entityid_t writerId, ddsi_seqno_t seq);
+
 /** @component rtps_submsg */
 void ddsi_xmsg_add_entityid (struct ddsi_xmsg * m);
 
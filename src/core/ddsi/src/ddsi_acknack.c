@@ -11,6 +11,7 @@
  */
 
 #include "dds/ddsrt/static_assert.h"
+#include "dds/ddsrt/random.h"
 #include "dds/ddsi/ddsi_protocol.h"
 #include "dds/ddsi/ddsi_log.h"
 #include "dds/ddsi/ddsi_domaingv.h"
@@ -19,6 +20,7 @@
 #include "ddsi__xmsg.h"
 #include "ddsi__bitset.h"
 #include "ddsi__acknack.h"
+#include "ddsi__entity.h"
 #include "ddsi__entity_index.h"
 #include "ddsi__endpoint_match.h"
 #include "ddsi__security_omg.h"
@@ -356,7 +358,7 @@ void ddsi_sched_acknack_if_needed (struct ddsi_xevent *ev, struct ddsi_proxy_wri
 
   struct ddsi_domaingv * const gv = pwr->e.gv;
   const bool ackdelay_passed = (tnow.v >= ddsrt_mtime_add_duration (rwn->t_last_ack, gv->config.ack_delay).v);
-  const bool nackdelay_passed = (tnow.v >= ddsrt_mtime_add_duration (rwn->t_last_nack, gv->config.nack_delay).v);
+  const bool nackdelay_passed = (tnow.v >= ddsrt_mtime_add_duration (rwn->t_last_nack, rwn->nack_delay).v);
   struct ddsi_add_acknack_info info;
   struct ddsi_last_nack_summary nack_summary;
   const enum ddsi_add_acknack_result aanr =
@@ -364,7 +366,16 @@ void ddsi_sched_acknack_if_needed (struct ddsi_xevent *ev, struct ddsi_proxy_wri
   if (aanr == AANR_SUPPRESSED_ACK)
     ; // nothing to be done now
   else if (avoid_suppressed_nack && aanr == AANR_SUPPRESSED_NACK)
-    (void) ddsi_resched_xevent_if_earlier (ev, ddsrt_mtime_add_duration (rwn->t_last_nack, gv->config.nack_delay));
+    (void) ddsi_resched_xevent_if_earlier (ev, ddsrt_mtime_add_duration (rwn->t_last_nack, rwn->nack_delay));
+  else if (aanr != AANR_ACK && !rwn->ack_requested && !rwn->directed_heartbeat && gv->config.nack_only_enable &&
+           gv->config.nack_only_suppression_delay > 0 && !ddsi_is_builtin_entityid (pwr->e.guid.entityid, pwr->c.vendor))
+  {
+    // NACK-only mode: delay the NACK by a random amount so that a multicast retransmit
+    // requested by another reader can arrive first and make it unnecessary; the event
+    // handler re-evaluates the state when it fires.
+    const uint32_t jitter = ddsrt_random () % ((uint32_t) gv->config.nack_only_suppression_delay + 1);
+    (void) ddsi_resched_xevent_if_earlier (ev, ddsrt_mtime_add_duration (tnow, (int64_t) jitter));
+  }
   else
     (void) ddsi_resched_xevent_if_earlier (ev, tnow);
 }
@@ -379,13 +390,13 @@ struct ddsi_xmsg *ddsi_make_and_resched_acknack (struct ddsi_xevent *ev, struct
   const enum ddsi_add_acknack_result aanr =
     get_acknack_info (pwr, rwn, &nack_summary, &info,
                       tnow.v >= ddsrt_mtime_add_duration (rwn->t_last_ack, gv->config.ack_delay).v,
-                      tnow.v >= ddsrt_mtime_add_duration (rwn->t_last_nack, gv->config.nack_delay).v);
+                      tnow.v >= ddsrt_mtime_add_duration (rwn->t_last_nack, rwn->nack_delay).v);
 
   if (aanr == AANR_SUPPRESSED_ACK)
     return NULL;
   else if (avoid_suppressed_nack && aanr == AANR_SUPPRESSED_NACK)
   {
-    (void) ddsi_resched_xevent_if_earlier (ev, ddsrt_mtime_add_duration (rwn->t_last_nack, gv->config.nack_delay));
+    (void) ddsi_resched_xevent_if_earlier (ev, ddsrt_mtime_add_duration (rwn->t_last_nack, rwn->nack_delay));
     return NULL;
   }
   else if (!(rwn->heartbeat_since_ack || rwn->heartbeatfrag_since_ack))
@@ -464,6 +475,8 @@ struct ddsi_xmsg *ddsi_make_and_resched_acknack (struct ddsi_xevent *ev, struct
   }
 
   rwn->count++;
+  if (gv->config.adaptive_timing_enable)
+    rwn->t_rtt_probe = tnow;
   switch (aanr)
   {
     case AANR_SUPPRESSED_ACK:
@@ -497,7 +510,7 @@ struct ddsi_xmsg *ddsi_make_and_resched_acknack (struct ddsi_xevent *ev, struct
       rwn->ack_requested = 0;
       rwn->t_last_ack = tnow;
       rwn->last_nack.seq_base = nack_summary.seq_base;
-      (void) ddsi_resched_xevent_if_earlier (ev, ddsrt_mtime_add_duration (rwn->t_last_nack, gv->config.nack_delay));
+      (void) ddsi_resched_xevent_if_earlier (ev, ddsrt_mtime_add_duration (rwn->t_last_nack, rwn->nack_delay));
       break;
   }
   GVTRACE ("send acknack(rd "PGUIDFMT" -> pwr "PGUIDFMT")\n", PGUID (rwn->rd_guid), PGUID (pwr->e.guid));
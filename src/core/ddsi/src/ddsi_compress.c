@@ -0,0 +1,412 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include <assert.h>
+#include <string.h>
+
+#include "dds/ddsrt/heap.h"
+#include "dds/ddsrt/string.h"
+#include "dds/ddsi/ddsi_domaingv.h"
+#include "dds/ddsi/ddsi_endpoint.h"
+#include "dds/ddsi/ddsi_proxy_endpoint.h"
+#include "dds/ddsi/ddsi_whc.h"
+#include "ddsi__compress.h"
+#include "ddsi__misc.h"
+#include "ddsi__radmin.h"
+#include "ddsi__vendor.h"
+
+/* The codec is a straightforward LZ77 variant using the well-known LZ4 sequence layout:
+   a token byte with the number of literals in the high nibble and the match length minus
+   4 in the low nibble, either of which can be extended by bytes of 255 terminated by a
+   byte < 255, followed by the literals, and a 2-byte little-endian match offset.  The
+   final sequence has no match and ends when the output is complete. */
+
+#define LZ_MINMATCH 4u
+#define LZ_MAXOFFSET 65535u
+#define LZ_HASHLOG 12u
+
+static uint32_t lz_read32 (const unsigned char *p)
+{
+  uint32_t v;
+  memcpy (&v, p, sizeof (v));
+  return v;
+}
+
+static uint32_t lz_hash (uint32_t v)
+{
+  return (v * 2654435761u) >> (32 - LZ_HASHLOG);
+}
+
+static bool lz_put_length (unsigned char **op, const unsigned char *oend, size_t len)
+{
+  /* only the part beyond the 15 that fits in the token */
+  while (len >= 255)
+  {
+    if (*op == oend)
+      return false;
+    *(*op)++ = 255;
+    len -= 255;
+  }
+  if (*op == oend)
+    return false;
+  *(*op)++ = (unsigned char) len;
+  return true;
+}
+
+static bool lz_put_sequence (unsigned char **op, const unsigned char *oend, const unsigned char *lit, size_t nlit, uint32_t offset, size_t mlen)
+{
+  const size_t mcode = (mlen > 0) ? mlen - LZ_MINMATCH : 0;
+  if (*op == oend)
+    return false;
+  *(*op)++ = (unsigned char) (((nlit < 15 ? nlit : 15) << 4) | (mcode < 15 ? mcode : 15));
+  if (nlit >= 15 && !lz_put_length (op, oend, nlit - 15))
+    return false;
+  if ((size_t) (oend - *op) < nlit)
+    return false;
+  memcpy (*op, lit, nlit);
+  *op += nlit;
+  if (mlen == 0)
+    return true;
+  if (oend - *op < 2)
+    return false;
+  *(*op)++ = (unsigned char) (offset & 0xff);
+  *(*op)++ = (unsigned char) (offset >> 8);
+  if (mcode >= 15 && !lz_put_length (op, oend, mcode - 15))
+    return false;
+  return true;
+}
+
+size_t ddsi_lz_compress (void *dst, size_t dstsize, const void *src, size_t srcsize)
+{
+  /* table holds position + 1 of the last occurrence of a hash, 0 meaning no entry */
+  uint32_t table[1u << LZ_HASHLOG];
+  const unsigned char * const in = src;
+  unsigned char *op = dst;
+  const unsigned char * const oend = op + dstsize;
+  size_t ip = 0, anchor = 0;
+
+  if (srcsize >= UINT32_MAX)
+    return 0;
+  memset (table, 0, sizeof (table));
+  while (ip + LZ_MINMATCH <= srcsize)
+  {
+    const uint32_t v = lz_read32 (in + ip);
+    const uint32_t h = lz_hash (v);
+    const size_t ref = table[h];
+    table[h] = (uint32_t) ip + 1;
+    if (ref == 0 || ip - (ref - 1) > LZ_MAXOFFSET || lz_read32 (in + ref - 1) != v)
+      ip++;
+    else
+    {
+      const size_t mpos = ref - 1;
+      size_t mlen = LZ_MINMATCH;
+      while (ip + mlen < srcsize && in[mpos + mlen] == in[ip + mlen])
+        mlen++;
+      if (!lz_put_sequence (&op, oend, in + anchor, ip - anchor, (uint32_t) (ip - mpos), mlen))
+        return 0;
+      ip += mlen;
+      anchor = ip;
+    }
+  }
+  if (!lz_put_sequence (&op, oend, in + anchor, srcsize - anchor, 0, 0))
+    return 0;
+  return (size_t) (op - (unsigned char *) dst);
+}
+
+static bool lz_get_length (const unsigned char **ip, const unsigned char *iend, size_t *len)
+{
+  unsigned char b;
+  do {
+    if (*ip == iend)
+      return false;
+    b = *(*ip)++;
+    *len += b;
+  } while (b == 255);
+  return true;
+}
+
+bool ddsi_lz_decompress (void *dst, size_t dstsize, const void *src, size_t srcsize)
+{
+  const unsigned char *ip = src;
+  const unsigned char * const iend = ip + srcsize;
+  unsigned char * const out = dst;
+  size_t op = 0;
+
+  while (true)
+  {
+    size_t nlit, mlen, offset;
+    unsigned char token;
+    if (ip == iend)
+      return false;
+    token = *ip++;
+    if ((nlit = (size_t) (token >> 4)) == 15 && !lz_get_length (&ip, iend, &nlit))
+      return false;
+    if (nlit > (size_t) (iend - ip) || nlit > dstsize - op)
+      return false;
+    memcpy (out + op, ip, nlit);
+    ip += nlit;
+    op += nlit;
+    if (op == dstsize)
+      return true;
+    if (iend - ip < 2)
+      return false;
+    offset = (size_t) ip[0] | ((size_t) ip[1] << 8);
+    ip += 2;
+    if (offset == 0 || offset > op)
+      return false;
+    if ((mlen = (size_t) (token & 0xf)) == 15 && !lz_get_length (&ip, iend, &mlen))
+      return false;
+    mlen += LZ_MINMATCH;
+    if (mlen > dstsize - op)
+      return false;
+    /* the match may overlap with the output being produced */
+    for (size_t k = 0; k < mlen; k++)
+      out[op + k] = out[op - offset + k];
+    op += mlen;
+  }
+}
+
+bool ddsi_compression_topic_matches (const struct ddsi_domaingv *gv, const char *topic_name)
+{
+  const char *patterns = gv->config.compression_topics;
+  char *copy, *cursor, *tok;
+  bool match = false;
+  if (patterns == NULL || *patterns == 0 || topic_name == NULL)
+    return false;
+  cursor = copy = ddsrt_strdup (patterns);
+  while (!match && (tok = ddsrt_strsep (&cursor, ",")) != NULL)
+  {
+    if (*tok && ddsi_patmatch (tok, topic_name))
+      match = true;
+  }
+  ddsrt_free (copy);
+  return match;
+}
+
+struct ddsi_serdata_compressed {
+  struct ddsi_serdata c;
+  struct ddsi_serdata *orig;
+  uint32_t size;
+  unsigned char data[];
+};
+
+static const struct ddsi_serdata *serdata_compressed_orig (const struct ddsi_serdata *d)
+{
+  return ddsi_serdata_is_compressed (d) ? ((const struct ddsi_serdata_compressed *) d)->orig : d;
+}
+
+static bool serdata_compressed_eqkey (const struct ddsi_serdata *a, const struct ddsi_serdata *b)
+{
+  const struct ddsi_serdata *oa = serdata_compressed_orig (a), *ob = serdata_compressed_orig (b);
+  return oa->ops->eqkey (oa, ob);
+}
+
+static uint32_t serdata_compressed_get_size (const struct ddsi_serdata *dcmn)
+{
+  const struct ddsi_serdata_compressed *d = (const struct ddsi_serdata_compressed *) dcmn;
+  return d->size;
+}
+
+static void serdata_compressed_free (struct ddsi_serdata *dcmn)
+{
+  struct ddsi_serdata_compressed *d = (struct ddsi_serdata_compressed *) dcmn;
+  ddsi_serdata_unref (d->orig);
+  ddsrt_free (d);
+}
+
+static void serdata_compressed_to_ser (const struct ddsi_serdata *dcmn, size_t off, size_t sz, void *buf)
+{
+  const struct ddsi_serdata_compressed *d = (const struct ddsi_serdata_compressed *) dcmn;
+  assert (off + sz <= ((d->size + 3u) & ~3u));
+  memcpy (buf, d->data + off, sz);
+}
+
+static struct ddsi_serdata *serdata_compressed_to_ser_ref (const struct ddsi_serdata *dcmn, size_t off, size_t sz, ddsrt_iovec_t *ref)
+{
+  const struct ddsi_serdata_compressed *d = (const struct ddsi_serdata_compressed *) dcmn;
+  assert (off + sz <= ((d->size + 3u) & ~3u));
+  ref->iov_base = (void *) (d->data + off);
+  ref->iov_len = (ddsrt_iov_len_t) sz;
+  return ddsi_serdata_ref (dcmn);
+}
+
+static void serdata_compressed_to_ser_unref (struct ddsi_serdata *dcmn, const ddsrt_iovec_t *ref)
+{
+  (void) ref;
+  ddsi_serdata_unref (dcmn);
+}
+
+static bool serdata_compressed_to_sample (const struct ddsi_serdata *dcmn, void *sample, void **bufptr, void *buflim)
+{
+  const struct ddsi_serdata_compressed *d = (const struct ddsi_serdata_compressed *) dcmn;
+  return ddsi_serdata_to_sample (d->orig, sample, bufptr, buflim);
+}
+
+static struct ddsi_serdata *serdata_compressed_to_untyped (const struct ddsi_serdata *dcmn)
+{
+  const struct ddsi_serdata_compressed *d = (const struct ddsi_serdata_compressed *) dcmn;
+  return ddsi_serdata_to_untyped (d->orig);
+}
+
+static size_t serdata_compressed_print (const struct ddsi_sertype *type, const struct ddsi_serdata *dcmn, char *buf, size_t size)
+{
+  const struct ddsi_serdata_compressed *d = (const struct ddsi_serdata_compressed *) dcmn;
+  return d->orig->ops->print (type, d->orig, buf, size);
+}
+
+static void serdata_compressed_get_keyhash (const struct ddsi_serdata *dcmn, struct ddsi_keyhash *buf, bool force_md5)
+{
+  const struct ddsi_serdata_compressed *d = (const struct ddsi_serdata_compressed *) dcmn;
+  ddsi_serdata_get_keyhash (d->orig, buf, force_md5);
+}
+
+/* Only used for transmitting, so none of the constructors are needed: these are always
+   invoked through the ops of the sertype, never through those of a serdata */
+static const struct ddsi_serdata_ops ddsi_serdata_ops_compressed = {
+  .eqkey = serdata_compressed_eqkey,
+  .get_size = serdata_compressed_get_size,
+  .from_ser = 0,
+  .from_ser_iov = 0,
+  .from_keyhash = 0,
+  .from_sample = 0,
+  .to_ser = serdata_compressed_to_ser,
+  .to_ser_ref = serdata_compressed_to_ser_ref,
+  .to_ser_unref = serdata_compressed_to_ser_unref,
+  .to_sample = serdata_compressed_to_sample,
+  .to_untyped = serdata_compressed_to_untyped,
+  .untyped_to_sample = 0,
+  .free = serdata_compressed_free,
+  .print = serdata_compressed_print,
+  .get_keyhash = serdata_compressed_get_keyhash
+};
+
+bool ddsi_serdata_is_compressed (const struct ddsi_serdata *serdata)
+{
+  return serdata->ops == &ddsi_serdata_ops_compressed;
+}
+
+static struct ddsi_serdata *serdata_compressed_new (struct ddsi_serdata *serdata, uint32_t size, const unsigned char *ser)
+{
+  /* Only worth it if it gets smaller; capacity is rounded up because to_ser[_ref] may be
+     asked to provide the padding bytes up to a multiple of 4 */
+  const size_t cap = ((size_t) size + 3u) & ~(size_t) 3u;
+  struct ddsi_serdata_compressed *d;
+  size_t csize;
+  if ((d = ddsrt_malloc (sizeof (*d) + cap)) == NULL)
+    return NULL;
+  if ((csize = ddsi_lz_compress (d->data + DDSI_COMPRESS_HEADER_SIZE, size - DDSI_COMPRESS_HEADER_SIZE - 1, ser + 4, size - 4)) == 0)
+  {
+    ddsrt_free (d);
+    return NULL;
+  }
+  memcpy (d->data, ser, 4);
+  d->data[4] = (unsigned char) ((size - 4) >> 24);
+  d->data[5] = (unsigned char) ((size - 4) >> 16);
+  d->data[6] = (unsigned char) ((size - 4) >> 8);
+  d->data[7] = (unsigned char) (size - 4);
+  d->size = (uint32_t) csize + DDSI_COMPRESS_HEADER_SIZE;
+  memset (d->data + d->size, 0, cap - d->size);
+
+  ddsi_serdata_init (&d->c, serdata->type, serdata->kind);
+  d->c.ops = &ddsi_serdata_ops_compressed;
+  d->c.hash = serdata->hash;
+  d->c.statusinfo = serdata->statusinfo;
+  d->c.timestamp = serdata->timestamp;
+  d->c.twrite = serdata->twrite;
+  d->orig = ddsi_serdata_ref (serdata);
+  return &d->c;
+}
+
+struct ddsi_serdata *ddsi_writer_compress_serdata (const struct ddsi_writer *wr, struct ddsi_serdata *serdata)
+{
+  struct ddsi_domaingv const * const gv = wr->e.gv;
+  struct ddsi_serdata *compressed;
+  ddsrt_iovec_t iov;
+  uint32_t size;
+
+  if (!wr->compress || serdata->kind != SDK_DATA)
+    return ddsi_serdata_ref (serdata);
+  if ((size = ddsi_serdata_size (serdata)) < gv->config.compression_threshold || size <= DDSI_COMPRESS_HEADER_SIZE + 1)
+    return ddsi_serdata_ref (serdata);
+
+  struct ddsi_serdata * const ref = ddsi_serdata_to_ser_ref (serdata, 0, size, &iov);
+  if (iov.iov_len >= size)
+    compressed = serdata_compressed_new (serdata, size, iov.iov_base);
+  else
+  {
+    unsigned char *buf = ddsrt_malloc (size);
+    ddsi_serdata_to_ser (serdata, 0, size, buf);
+    compressed = serdata_compressed_new (serdata, size, buf);
+    ddsrt_free (buf);
+  }
+  ddsi_serdata_to_ser_unref (ref, &iov);
+  return compressed ? compressed : ddsi_serdata_ref (serdata);
+}
+
+struct ddsi_serdata *ddsi_writer_wire_serdata (const struct ddsi_writer *wr, struct ddsi_serdata *serdata)
+{
+  if (wr->num_readers_foreign_vendor > 0)
+    return ddsi_serdata_ref (serdata);
+  return ddsi_writer_compress_serdata (wr, serdata);
+}
+
+struct ddsi_serdata *ddsi_writer_rexmit_serdata (const struct ddsi_whc_borrowed_sample *sample, const struct ddsi_proxy_reader *prd)
+{
+  /* a reader of another vendor that matched after the sample was written can't handle
+     the compressed form, it never received any of it, so the original is fine */
+  if (prd != NULL && !ddsi_vendor_is_eclipse (prd->c.vendor))
+    return sample->serdata;
+  return sample->wire_serdata;
+}
+
+struct ddsi_serdata *ddsi_serdata_from_compressed_ser (const struct ddsi_domaingv *gv, const struct ddsi_sertype *type, enum ddsi_serdata_kind kind, const struct ddsi_rdata *fragchain, size_t size)
+{
+  struct ddsi_serdata *sd = NULL;
+  unsigned char *cbuf, *ubuf;
+  uint32_t usize, off = 0;
+  ddsrt_iovec_t iov;
+
+  if (size <= DDSI_COMPRESS_HEADER_SIZE)
+    return NULL;
+  if ((cbuf = ddsrt_malloc (size)) == NULL)
+    return NULL;
+  assert (fragchain->min == 0);
+  while (fragchain)
+  {
+    assert (fragchain->min <= off);
+    assert (fragchain->maxp1 <= size);
+    if (fragchain->maxp1 > off)
+    {
+      const unsigned char *payload = DDSI_RMSG_PAYLOADOFF (fragchain->rmsg, DDSI_RDATA_PAYLOAD_OFF (fragchain));
+      memcpy (cbuf + off, payload + off - fragchain->min, fragchain->maxp1 - off);
+      off = fragchain->maxp1;
+    }
+    fragchain = fragchain->nextfrag;
+  }
+  assert (off == size);
+
+  usize = ((uint32_t) cbuf[4] << 24) | ((uint32_t) cbuf[5] << 16) | ((uint32_t) cbuf[6] << 8) | (uint32_t) cbuf[7];
+  if (usize > gv->config.max_sample_size || (ubuf = ddsrt_malloc ((size_t) usize + 4)) == NULL)
+  {
+    ddsrt_free (cbuf);
+    return NULL;
+  }
+  memcpy (ubuf, cbuf, 4);
+  if (ddsi_lz_decompress (ubuf + 4, usize, cbuf + DDSI_COMPRESS_HEADER_SIZE, size - DDSI_COMPRESS_HEADER_SIZE))
+  {
+    iov.iov_base = ubuf;
+    iov.iov_len = (ddsrt_iov_len_t) usize + 4;
+    sd = ddsi_serdata_from_ser_iov (type, kind, 1, &iov, (size_t) usize + 4);
+  }
+  ddsrt_free (ubuf);
+  ddsrt_free (cbuf);
+  return sd;
+}
@@ -160,6 +160,7 @@ DUPF(uint32);
 #endif
 DU(natint);
 DU(natint_255);
+DU(natint_100);
 DUPF(participantIndex);
 DU(dyn_port);
 DUPF(memsize);
@@ -173,6 +174,7 @@ PF(duration);
 DUPF(standards_conformance);
 DUPF(besmode);
 DUPF(retransmit_merging);
+DUPF(fsync_policy);
 DUPF(sched_class);
 DUPF(random_seed);
 DUPF(entity_naming_mode);
@@ -971,6 +973,10 @@ static const char *en_retransmit_merging_vs[] = { "never", "adaptive", "always",
 static const enum ddsi_retransmit_merging en_retransmit_merging_ms[] = { DDSI_REXMIT_MERGE_NEVER, DDSI_REXMIT_MERGE_ADAPTIVE, DDSI_REXMIT_MERGE_ALWAYS, 0 };
 GENERIC_ENUM_CTYPE (retransmit_merging, enum ddsi_retransmit_merging)
 
+static const char *en_fsync_policy_vs[] = { "never", "interval", "always", NULL };
+static const enum ddsi_fsync_policy en_fsync_policy_ms[] = { DDSI_FSYNC_NEVER, DDSI_FSYNC_INTERVAL, DDSI_FSYNC_ALWAYS, 0 };
+GENERIC_ENUM_CTYPE (fsync_policy, enum ddsi_fsync_policy)
+
 static const char *en_sched_class_vs[] = { "realtime", "timeshare", "default", NULL };
 static const ddsrt_sched_t en_sched_class_ms[] = { DDSRT_SCHED_REALTIME, DDSRT_SCHED_TIMESHARE, DDSRT_SCHED_DEFAULT, 0 };
 GENERIC_ENUM_CTYPE (sched_class, ddsrt_sched_t)
@@ -1441,6 +1447,11 @@ static enum update_result uf_natint_255(struct ddsi_cfgst *cfgst, void *parent,
   return uf_int_min_max(cfgst, parent, cfgelem, first, value, 0, 255);
 }
 
+static enum update_result uf_natint_100(struct ddsi_cfgst *cfgst, void *parent, struct cfgelem const * const cfgelem, int first, const char *value)
+{
+  return uf_int_min_max(cfgst, parent, cfgelem, first, value, 0, 100);
+}
+
 static enum update_result uf_uint (struct ddsi_cfgst *cfgst, void *parent, struct cfgelem const * const cfgelem, UNUSED_ARG (int first), const char *value)
 {
   uint32_t * const elem = cfg_address (cfgst, parent, cfgelem);
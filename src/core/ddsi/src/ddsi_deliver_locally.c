@@ -144,6 +144,11 @@ dds_return_t ddsi_deliver_locally_one (struct ddsi_domaingv *gv, struct ddsi_ent
   if ((payload = ops->makesample (&tk, gv, rd->type, vsourceinfo)) != NULL)
   {
     EETRACE (source_entity, " =>"PGUIDFMT"\n", PGUID (*rdguid));
+    if (!ddsi_reader_accepts_instance (rd, tk, payload))
+    {
+      free_sample_after_store (gv, payload, tk);
+      return DDS_RETCODE_OK;
+    }
     /* FIXME: why look up rd,pwr again? Their states remains valid while the thread stays
        "awake" (although a delete can be initiated), and blocking like this is a stopgap
        anyway -- quite possibly to abort once either is deleted */
@@ -202,7 +207,7 @@ static dds_return_t deliver_locally_slowpath (struct ddsi_domaingv *gv, struct d
       type_sample_cache_store (&tsc, rd->type, payload, tk);
     }
     /* check payload to allow for deserialisation failures */
-    if (payload)
+    if (payload && ddsi_reader_accepts_instance (rd, tk, payload))
     {
       EETRACE (source_entity, " "PGUIDFMT, PGUID (rd->e.guid));
       (void) ddsi_rhc_store (rd->rhc, wrinfo, payload, tk);
@@ -235,6 +240,8 @@ static dds_return_t deliver_locally_fastpath (struct ddsi_domaingv *gv, struct d
     {
       do {
         dds_return_t rc;
+        if (!ddsi_reader_accepts_instance (rdary[i], tk, payload))
+          continue;
         while (!ddsi_rhc_store (rdary[i]->rhc, wrinfo, payload, tk))
         {
           if ((rc = ops->on_failure_fastpath (source_entity, source_entity_locked, fastpath_rdary, vsourceinfo)) != DDS_RETCODE_OK)
@@ -26,6 +26,7 @@
 #include "dds/ddsi/ddsi_unused.h"
 #include "dds/ddsi/ddsi_domaingv.h"
 #include "dds/ddsi/ddsi_feature_check.h"
+#include "dds/ddsi/ddsi_content_filter_if.h"
 #include "ddsi__protocol.h"
 #include "ddsi__misc.h"
 #include "ddsi__xevent.h"
@@ -1158,6 +1159,12 @@ static int sedp_write_endpoint_impl
         ps.present |= PP_CYCLONE_REQUESTS_KEYHASH;
         ps.cyclone_requests_keyhash = 1u;
       }
+      /* the filter strings are owned by the reader's topic, they can't go away while we're awake */
+      if (ddsi_content_filter_reader_property (gv->content_filter_interface, rd, &ps.content_filter_property))
+      {
+        ps.present |= PP_CONTENT_FILTER_PROPERTY;
+        ps.aliased |= PP_CONTENT_FILTER_PROPERTY;
+      }
     }
 
 #ifdef DDS_HAS_SSM
@@ -1724,7 +1731,7 @@ static void handle_sedp_alive_endpoint (const struct ddsi_receiver_state *rst, d
     else
     {
       if (prd)
-        ddsi_update_proxy_reader (prd, seq, as, xqos, timestamp);
+        ddsi_update_proxy_reader (prd, seq, as, xqos, datap, timestamp);
       else
       {
 #ifdef DDS_HAS_SSM
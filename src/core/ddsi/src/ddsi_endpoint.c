@@ -46,6 +46,7 @@
 #include "ddsi__xqos.h"
 #include "ddsi__hbcontrol.h"
 #include "ddsi__lease.h"
+#include "ddsi__compress.h"
 #include "dds/dds.h"
 
 static dds_return_t delete_writer_nolinger_locked (struct ddsi_writer *wr);
@@ -348,6 +349,22 @@ void ddsi_update_reader_init_acknack_count (const ddsrt_log_cfg_t *logcfg, const
   }
 }
 
+bool ddsi_durability_served_by_writer (const struct ddsi_domaingv *gv, dds_durability_kind_t kind)
+{
+  if (kind == DDS_DURABILITY_TRANSIENT_LOCAL)
+    return true;
+  /* there is no durability service: with the persistent store, TRANSIENT and PERSISTENT
+     writers serve their own history */
+  return kind > DDS_DURABILITY_TRANSIENT_LOCAL && gv->config.persistent_store_directory && *gv->config.persistent_store_directory;
+}
+
+bool ddsi_reader_accepts_instance (const struct ddsi_reader *rd, struct ddsi_tkmap_instance *tk, const struct ddsi_serdata *sample)
+{
+  if (!(rd->xqos->present & DDSI_QP_CYCLONE_INSTANCE_SHARD))
+    return true;
+  return ddsi_tkmap_instance_in_shard (tk, sample, &rd->xqos->instance_shard);
+}
+
 void ddsi_deliver_historical_data (const struct ddsi_writer *wr, const struct ddsi_reader *rd)
 {
   struct ddsi_domaingv * const gv = wr->e.gv;
@@ -369,7 +386,8 @@ void ddsi_deliver_historical_data (const struct ddsi_writer *wr, const struct dd
       struct ddsi_writer_info wrinfo;
       struct ddsi_tkmap_instance *tk = ddsi_tkmap_lookup_instance_ref (tkmap, payload);
       ddsi_make_writer_info (&wrinfo, &wr->e, wr->xqos, payload->statusinfo);
-      (void) ddsi_rhc_store (rd->rhc, &wrinfo, payload, tk);
+      if (ddsi_reader_accepts_instance (rd, tk, payload))
+        (void) ddsi_rhc_store (rd->rhc, &wrinfo, payload, tk);
       ddsi_tkmap_instance_unref (tkmap, tk);
       ddsi_serdata_unref (payload);
     }
@@ -503,6 +521,13 @@ static void augment_wr_prd_match (void *vnode, const void *vleft, const void *vr
   n->max_seq = max_seq;
   n->all_have_replied_to_hb = have_replied ? 1 : 0;
 
+  /* 1b. Compute max RTT, used for adapting the heartbeat rate */
+  n->max_rtt = n->rtt;
+  if (left && left->max_rtt > n->max_rtt)
+    n->max_rtt = left->max_rtt;
+  if (right && right->max_rtt > n->max_rtt)
+    n->max_rtt = right->max_rtt;
+
   /* 2. Compute num_reliable_readers_where_seq_equals_max */
   if (max_seq == 0)
   {
@@ -567,10 +592,14 @@ static void augment_wr_prd_match (void *vnode, const void *vleft, const void *vr
 ddsi_seqno_t ddsi_writer_max_drop_seq (const struct ddsi_writer *wr)
 {
   const struct ddsi_wr_prd_match *n;
+  ddsi_seqno_t min_seq;
   if (ddsrt_avl_is_empty (&wr->readers))
     return wr->seq;
   n = ddsrt_avl_root_non_empty (&ddsi_wr_readers_treedef, &wr->readers);
-  return (n->min_seq == DDSI_MAX_SEQ_NUMBER) ? wr->seq : n->min_seq;
+  min_seq = (n->min_seq == DDSI_MAX_SEQ_NUMBER) ? wr->seq : n->min_seq;
+  /* NACK-only writers don't wait for readers to acknowledge data that has
+     exceeded the retention limits */
+  return (min_seq < wr->nack_only_drop_seq) ? wr->nack_only_drop_seq : min_seq;
 }
 
 int ddsi_writer_must_have_hb_scheduled (const struct ddsi_writer *wr, const struct ddsi_whc_state *whcst)
@@ -586,7 +615,7 @@ int ddsi_writer_must_have_hb_scheduled (const struct ddsi_writer *wr, const stru
        heartbeats in the absence of data. */
     return 0;
   }
-  else if (!((const struct ddsi_wr_prd_match *) ddsrt_avl_root_non_empty (&ddsi_wr_readers_treedef, &wr->readers))->all_have_replied_to_hb)
+  else if (!wr->nack_only && !((const struct ddsi_wr_prd_match *) ddsrt_avl_root_non_empty (&ddsi_wr_readers_treedef, &wr->readers))->all_have_replied_to_hb)
   {
     /* Labouring under the belief that heartbeats must be sent
        regardless of ack state */
@@ -641,6 +670,47 @@ unsigned ddsi_remove_acked_messages (struct ddsi_writer *wr, struct ddsi_whc_sta
   return n;
 }
 
+unsigned ddsi_writer_nack_only_expire (struct ddsi_writer *wr, ddsrt_mtime_t tnow, struct ddsi_whc_state *whcst, struct ddsi_whc_node **deferred_free_list)
+{
+  struct ddsi_domaingv const * const gv = wr->e.gv;
+  ddsi_seqno_t drop_seq, seq, next_seq;
+  size_t bytes;
+  ASSERT_MUTEX_HELD (&wr->e.lock);
+  assert (wr->nack_only);
+  ddsi_whc_get_state (wr->whc, whcst);
+  if (ddsrt_avl_is_empty (&wr->readers))
+    return 0;
+
+  /* Walk the unacknowledged samples from oldest to newest and advance the
+     drop sequence number past those that are older than the retention time
+     or that cause the retained data to exceed the retention size */
+  drop_seq = seq = ddsi_writer_max_drop_seq (wr);
+  bytes = whcst->unacked_bytes;
+  while ((next_seq = ddsi_whc_next_seq (wr->whc, seq)) <= whcst->max_seq)
+  {
+    struct ddsi_whc_borrowed_sample sample;
+    bool expired;
+    if (!ddsi_whc_borrow_sample (wr->whc, next_seq, &sample))
+      break;
+    expired = (bytes > gv->config.nack_only_retention_size ||
+               tnow.v >= ddsrt_mtime_add_duration (sample.serdata->twrite, gv->config.nack_only_retention_time).v);
+    if (expired && sample.unacked)
+    {
+      const uint32_t sz = ddsi_serdata_size (sample.serdata);
+      bytes = (bytes > sz) ? bytes - sz : 0;
+    }
+    ddsi_whc_return_sample (wr->whc, &sample, false);
+    if (!expired)
+      break;
+    seq = next_seq;
+  }
+  if (seq == drop_seq)
+    return 0;
+  ETRACE (wr, "writer "PGUIDFMT" nack-only expire up to %"PRIu64"\n", PGUID (wr->e.guid), seq);
+  wr->nack_only_drop_seq = seq;
+  return ddsi_remove_acked_messages (wr, whcst, deferred_free_list);
+}
+
 static void writer_notify_liveliness_change_may_unlock (struct ddsi_writer *wr)
 {
   struct ddsi_alive_state alive_state;
@@ -730,6 +800,7 @@ static void ddsi_new_writer_guid_common_init (struct ddsi_writer *wr, const char
 {
   ddsrt_cond_init (&wr->throttle_cond);
   wr->seq = 0;
+  wr->nack_only_drop_seq = 0;
   ddsrt_atomic_st64 (&wr->seq_xmit, (uint64_t) 0);
   wr->hbcount = 1;
   wr->state = WRST_OPERATIONAL;
@@ -743,6 +814,8 @@ static void ddsi_new_writer_guid_common_init (struct ddsi_writer *wr, const char
   wr->num_readers = 0;
   wr->num_reliable_readers = 0;
   wr->num_readers_requesting_keyhash = 0;
+  wr->num_readers_filtered = 0;
+  wr->num_readers_foreign_vendor = 0;
   wr->num_acks_received = 0;
   wr->num_nacks_received = 0;
   wr->throttle_count = 0;
@@ -785,6 +858,10 @@ static void ddsi_new_writer_guid_common_init (struct ddsi_writer *wr, const char
 
   assert (wr->xqos->present & DDSI_QP_RELIABILITY);
   wr->reliable = (wr->xqos->reliability.kind != DDS_RELIABILITY_BEST_EFFORT);
+  wr->nack_only = (wr->reliable && wr->e.gv->config.nack_only_enable && !ddsi_is_builtin_entityid (wr->e.guid.entityid, DDSI_VENDORID_ECLIPSE));
+  wr->compress = (!ddsi_is_builtin_entityid (wr->e.guid.entityid, DDSI_VENDORID_ECLIPSE) &&
+                  (wr->xqos->present & DDSI_QP_TOPIC_NAME) &&
+                  ddsi_compression_topic_matches (wr->e.gv, wr->xqos->topic_name));
   assert (wr->xqos->present & DDSI_QP_DURABILITY);
 #ifdef DDS_HAS_TYPE_DISCOVERY
   if (ddsi_is_builtin_entityid (wr->e.guid.entityid, DDSI_VENDORID_ECLIPSE) &&
@@ -800,7 +877,7 @@ static void ddsi_new_writer_guid_common_init (struct ddsi_writer *wr, const char
     assert ((wr->xqos->durability.kind == DDS_DURABILITY_TRANSIENT_LOCAL) ||
             (wr->e.guid.entityid.u == DDSI_ENTITYID_P2P_BUILTIN_PARTICIPANT_STATELESS_MESSAGE_WRITER));
   }
-  wr->handle_as_transient_local = (wr->xqos->durability.kind == DDS_DURABILITY_TRANSIENT_LOCAL);
+  wr->handle_as_transient_local = ddsi_durability_served_by_writer (wr->e.gv, wr->xqos->durability.kind);
   wr->num_readers_requesting_keyhash +=
     wr->e.gv->config.generate_keyhash &&
     ((wr->e.guid.entityid.u & DDSI_ENTITYID_KIND_MASK) == DDSI_ENTITYID_KIND_WRITER_WITH_KEY);
@@ -1459,7 +1536,7 @@ dds_return_t ddsi_new_reader_guid (struct ddsi_reader **rd_out, const struct dds
    * used for this reader and reader specific out-of-order list must be used which is
    * used for handling transient local data.
    */
-  rd->handle_as_transient_local = (rd->xqos->durability.kind == DDS_DURABILITY_TRANSIENT_LOCAL) ||
+  rd->handle_as_transient_local = ddsi_durability_served_by_writer (rd->e.gv, rd->xqos->durability.kind) ||
                                   (rd->e.guid.entityid.u == DDSI_ENTITYID_P2P_BUILTIN_PARTICIPANT_VOLATILE_SECURE_READER);
   rd->type = ddsi_sertype_ref (type);
   rd->request_keyhash = rd->type->request_keyhash;
@@ -1601,6 +1678,13 @@ void ddsi_update_reader_qos (struct ddsi_reader *rd, const dds_qos_t *xqos)
   ddsrt_mutex_unlock (&rd->e.lock);
 }
 
+void ddsi_update_reader_content_filter (struct ddsi_reader *rd)
+{
+  ddsrt_mutex_lock (&rd->e.lock);
+  ddsi_sedp_write_reader (rd);
+  ddsrt_mutex_unlock (&rd->e.lock);
+}
+
 struct ddsi_reader *ddsi_writer_first_in_sync_reader (struct ddsi_entity_index *entity_index, struct ddsi_entity_common *wrcmn, ddsrt_avl_iter_t *it)
 {
   assert (wrcmn->kind == DDSI_EK_WRITER);
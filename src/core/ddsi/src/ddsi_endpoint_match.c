@@ -16,6 +16,9 @@
 #include "dds/ddsrt/heap.h"
 #include "dds/ddsi/ddsi_proxy_participant.h"
 #include "dds/ddsi/ddsi_qosmatch.h"
+#include "dds/ddsi/ddsi_content_filter_if.h"
+#include "dds/ddsi/ddsi_tkmap.h"
+#include "dds/ddsi/ddsi_serdata.h"
 #include "ddsi__entity.h"
 #include "ddsi__participant.h"
 #include "ddsi__security_omg.h"
@@ -604,14 +607,42 @@ void ddsi_free_wr_prd_match (const struct ddsi_domaingv *gv, const ddsi_guid_t *
 #ifdef DDS_HAS_SECURITY
     ddsi_omg_security_deregister_remote_reader_match (gv, wr_guid, m);
 #else
-    (void) gv;
     (void) wr_guid;
 #endif
+    ddsi_content_filter_free (gv->content_filter_interface, m->content_filter);
     ddsi_lat_estim_fini (&m->hb_to_ack_latency);
     ddsrt_free (m);
   }
 }
 
+bool ddsi_wr_prd_match_is_filtered (const struct ddsi_wr_prd_match *m)
+{
+  return m->content_filter != NULL || m->instance_shard.count > 0;
+}
+
+bool ddsi_wr_prd_match_accepts_sample (struct ddsi_domaingv *gv, const struct ddsi_wr_prd_match *m, struct ddsi_serdata *serdata, struct ddsi_tkmap_instance *tk)
+{
+  if (m->instance_shard.count > 0)
+  {
+    bool in_shard;
+    if (tk != NULL)
+      in_shard = ddsi_tkmap_instance_in_shard (tk, serdata, &m->instance_shard);
+    else
+    {
+      tk = ddsi_tkmap_lookup_instance_ref (gv->m_tkmap, serdata);
+      in_shard = (tk == NULL) || ddsi_tkmap_instance_in_shard (tk, serdata, &m->instance_shard);
+      if (tk)
+        ddsi_tkmap_instance_unref (gv->m_tkmap, tk);
+    }
+    if (!in_shard)
+      return false;
+  }
+  /* content filters are only defined on the data, so invalid samples always pass */
+  if (m->content_filter == NULL || serdata->kind != SDK_DATA || serdata->statusinfo != 0)
+    return true;
+  return ddsi_content_filter_eval (gv->content_filter_interface, m->content_filter, serdata);
+}
+
 void ddsi_free_rd_pwr_match (struct ddsi_domaingv *gv, const ddsi_guid_t *rd_guid, struct ddsi_rd_pwr_match *m)
 {
   if (m)
@@ -644,6 +675,7 @@ void ddsi_free_pwr_rd_match (struct ddsi_pwr_rd_match *m)
     if (m->acknack_xevent)
       ddsi_delete_xevent (m->acknack_xevent);
     ddsi_reorder_free (m->u.not_in_sync.reorder);
+    ddsi_lat_estim_fini (&m->ack_to_hb_latency);
     ddsrt_free (m);
   }
 }
@@ -682,6 +714,11 @@ void ddsi_writer_add_connection (struct ddsi_writer *wr, struct ddsi_proxy_reade
   m->all_have_replied_to_hb = 0;
   m->non_responsive_count = 0;
   m->rexmit_requests = 0;
+  m->accepts_sample = 1;
+  if (prd->c.xqos->present & DDSI_QP_CYCLONE_INSTANCE_SHARD)
+    m->instance_shard = prd->c.xqos->instance_shard;
+  else
+    m->instance_shard = (dds_instance_shard_qospolicy_t) { .index = 0, .count = 0 };
 #ifdef DDS_HAS_SECURITY
   m->crypto_handle = crypto_handle;
 #else
@@ -689,6 +726,10 @@ void ddsi_writer_add_connection (struct ddsi_writer *wr, struct ddsi_proxy_reade
 #endif
   /* m->demoted: see below */
   ddsrt_mutex_lock (&prd->e.lock);
+  if (prd->content_filter)
+    m->content_filter = ddsi_content_filter_compile (wr->e.gv->content_filter_interface, wr->type, prd->content_filter);
+  else
+    m->content_filter = NULL;
   if (prd->deleting)
   {
     ELOGDISC (wr, "  ddsi_writer_add_connection(wr "PGUIDFMT" prd "PGUIDFMT") - prd is being deleted\n",
@@ -710,6 +751,8 @@ void ddsi_writer_add_connection (struct ddsi_writer *wr, struct ddsi_proxy_reade
   m->prev_nackfrag = 0;
   ddsi_lat_estim_init (&m->hb_to_ack_latency);
   m->hb_to_ack_latency_tlastlog = ddsrt_time_wallclock ();
+  m->rtt = 0;
+  m->max_rtt = 0;
   m->t_acknack_accepted.v = 0;
   m->t_nackfrag_accepted.v = 0;
 
@@ -723,11 +766,14 @@ void ddsi_writer_add_connection (struct ddsi_writer *wr, struct ddsi_proxy_reade
   else
     m->seq = wr->seq;
   m->last_seq = m->seq;
+  /* only heartbeats sent after matching are useful for measuring the RTT */
+  m->t_last_ackhb = wr->hbcontrol.t_of_last_ackhb;
   if (ddsrt_avl_lookup_ipath (&ddsi_wr_readers_treedef, &wr->readers, &prd->e.guid, &path))
   {
     ELOGDISC (wr, "  ddsi_writer_add_connection(wr "PGUIDFMT" prd "PGUIDFMT") - already connected\n",
               PGUID (wr->e.guid), PGUID (prd->e.guid));
     ddsrt_mutex_unlock (&wr->e.lock);
+    ddsi_content_filter_free (wr->e.gv->content_filter_interface, m->content_filter);
     ddsi_lat_estim_fini (&m->hb_to_ack_latency);
     ddsrt_free (m);
   }
@@ -739,6 +785,8 @@ void ddsi_writer_add_connection (struct ddsi_writer *wr, struct ddsi_proxy_reade
     wr->num_readers++;
     wr->num_reliable_readers += m->is_reliable;
     wr->num_readers_requesting_keyhash += prd->requests_keyhash ? 1 : 0;
+    wr->num_readers_filtered += ddsi_wr_prd_match_is_filtered (m) ? 1 : 0;
+    wr->num_readers_foreign_vendor += ddsi_vendor_is_eclipse (prd->c.vendor) ? 0 : 1;
     ddsi_rebuild_writer_addrset (wr);
     ddsrt_mutex_unlock (&wr->e.lock);
 
@@ -982,6 +1030,9 @@ void ddsi_proxy_writer_add_connection (struct ddsi_proxy_writer *pwr, struct dds
   m->t_heartbeat_accepted.v = 0;
   m->t_last_nack.v = 0;
   m->t_last_ack.v = 0;
+  m->t_rtt_probe.v = 0;
+  ddsi_lat_estim_init (&m->ack_to_hb_latency);
+  m->nack_delay = pwr->e.gv->config.nack_delay;
   m->last_nack.seq_end_p1 = 0;
   m->last_nack.seq_base = 0;
   m->last_nack.frag_end_p1 = 0;
@@ -1152,6 +1203,8 @@ void ddsi_writer_drop_connection (const struct ddsi_guid *wr_guid, const struct
       wr->num_readers--;
       wr->num_reliable_readers -= m->is_reliable;
       wr->num_readers_requesting_keyhash -= prd->requests_keyhash ? 1 : 0;
+      wr->num_readers_filtered -= ddsi_wr_prd_match_is_filtered (m) ? 1 : 0;
+      wr->num_readers_foreign_vendor -= ddsi_vendor_is_eclipse (prd->c.vendor) ? 0 : 1;
       ddsi_rebuild_writer_addrset (wr);
       ddsi_remove_acked_messages (wr, &whcst, &deferred_free_list);
     }
@@ -17,6 +17,7 @@
 #include "dds/ddsrt/string.h"
 #include "dds/ddsi/ddsi_proxy_participant.h"
 #include "dds/ddsi/ddsi_builtin_topic_if.h"
+#include "dds/ddsi/ddsi_content_filter_if.h"
 #include "dds/ddsi/ddsi_domaingv.h"
 #include "dds/ddsi/ddsi_tkmap.h"
 #include "dds/ddsi/ddsi_iid.h"
@@ -34,6 +35,11 @@ extern inline struct ddsi_tkmap_instance *ddsi_builtintopic_get_tkmap_entry (con
 extern inline void ddsi_builtintopic_write_endpoint (const struct ddsi_builtin_topic_interface *btif, const struct ddsi_entity_common *e, ddsrt_wctime_t timestamp, bool alive);
 extern inline void ddsi_builtintopic_write_topic (const struct ddsi_builtin_topic_interface *btif, const struct ddsi_topic_definition *tpd, ddsrt_wctime_t timestamp, bool alive);
 
+extern inline bool ddsi_content_filter_reader_property (const struct ddsi_content_filter_interface *cfif, const struct ddsi_reader *rd, ddsi_content_filter_property_t *cfp);
+extern inline void *ddsi_content_filter_compile (const struct ddsi_content_filter_interface *cfif, const struct ddsi_sertype *type, const ddsi_content_filter_property_t *cfp);
+extern inline bool ddsi_content_filter_eval (const struct ddsi_content_filter_interface *cfif, const void *filter, const struct ddsi_serdata *serdata);
+extern inline void ddsi_content_filter_free (const struct ddsi_content_filter_interface *cfif, void *filter);
+
 extern inline ddsi_seqno_t ddsi_writer_read_seq_xmit (const struct ddsi_writer *wr);
 extern inline void ddsi_writer_update_seq_xmit (struct ddsi_writer *wr, ddsi_seqno_t nv);
 
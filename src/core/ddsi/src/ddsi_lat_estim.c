@@ -22,6 +22,7 @@ void ddsi_lat_estim_init (struct ddsi_lat_estim *le)
 {
   int i;
   le->index = 0;
+  le->nsamples = 0;
   for (i = 0; i < DDSI_LAT_ESTIM_MEDIAN_WINSZ; i++)
     le->window[i] = 0;
   le->smoothed = 0;
@@ -38,7 +39,7 @@ static int cmpfloat (const float *a, const float *b)
 
 void ddsi_lat_estim_update (struct ddsi_lat_estim *le, int64_t est)
 {
-  const float alpha = 0.01f;
+  const float alpha = 0.1f;
   float fest, med;
   float tmp[DDSI_LAT_ESTIM_MEDIAN_WINSZ];
   if (est <= 0)
@@ -47,12 +48,15 @@ void ddsi_lat_estim_update (struct ddsi_lat_estim *le, int64_t est)
   le->window[le->index] = fest;
   if (++le->index == DDSI_LAT_ESTIM_MEDIAN_WINSZ)
     le->index = 0;
-  memcpy (tmp, le->window, sizeof (tmp));
-  qsort (tmp, DDSI_LAT_ESTIM_MEDIAN_WINSZ, sizeof (tmp[0]), (int (*) (const void *, const void *)) cmpfloat);
-  med = tmp[DDSI_LAT_ESTIM_MEDIAN_WINSZ / 2];
-  if (le->smoothed == 0 && le->index == 0)
+  /* until the window has filled up, the samples are in window[0 .. nsamples-1] */
+  if (le->nsamples < DDSI_LAT_ESTIM_MEDIAN_WINSZ)
+    le->nsamples++;
+  memcpy (tmp, le->window, (size_t) le->nsamples * sizeof (tmp[0]));
+  qsort (tmp, (size_t) le->nsamples, sizeof (tmp[0]), (int (*) (const void *, const void *)) cmpfloat);
+  med = tmp[le->nsamples / 2];
+  if (le->smoothed == 0)
     le->smoothed = med;
-  else if (le->smoothed != 0)
+  else
     le->smoothed = (1.0f - alpha) * le->smoothed + alpha * med;
 }
 
@@ -64,21 +68,21 @@ int ddsi_lat_estim_log (uint32_t logcat, const struct ddsrt_log_cfg *logcfg, con
   {
     float tmp[DDSI_LAT_ESTIM_MEDIAN_WINSZ];
     int i;
-    memcpy (tmp, le->window, sizeof (tmp));
-    qsort (tmp, DDSI_LAT_ESTIM_MEDIAN_WINSZ, sizeof (tmp[0]), (int (*) (const void *, const void *)) cmpfloat);
+    memcpy (tmp, le->window, (size_t) le->nsamples * sizeof (tmp[0]));
+    qsort (tmp, (size_t) le->nsamples, sizeof (tmp[0]), (int (*) (const void *, const void *)) cmpfloat);
     if (tag)
       DDS_CLOG (logcat, logcfg, " LAT(%s: %e {", tag, le->smoothed);
     else
       DDS_CLOG (logcat, logcfg, " LAT(%e {", le->smoothed);
-    for (i = 0; i < DDSI_LAT_ESTIM_MEDIAN_WINSZ; i++)
+    for (i = 0; i < le->nsamples; i++)
       DDS_CLOG (logcat, logcfg, "%s%e", (i > 0) ? "," : "", tmp[i]);
     DDS_CLOG (logcat, logcfg, "})");
     return 1;
   }
 }
 
-#if 0 /* not implemented yet */
 double ddsi_lat_estim_current (const struct ddsi_lat_estim *le)
 {
+  /* in microseconds, 0 if no estimate available yet */
+  return (double) le->smoothed;
 }
-#endif
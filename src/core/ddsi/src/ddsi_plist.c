@@ -2028,6 +2028,7 @@ static const struct piddesc piddesc_omg[] = {
   PP  (BUILTIN_ENDPOINT_SET,                builtin_endpoint_set, Xu),
   PP  (KEYHASH,                             keyhash, XK),
   PPV (ENDPOINT_GUID,                       endpoint_guid, XG),
+  PP  (CONTENT_FILTER_PROPERTY,             content_filter_property, XS, XS, XS, XS, XQ, XS, XSTOP),
 #ifdef DDS_HAS_SSM
   PPV (READER_FAVOURS_SSM,                  reader_favours_ssm, Xu),
 #endif
@@ -2089,6 +2090,13 @@ static const struct piddesc piddesc_eclipse[] = {
   { DDSI_PID_PAD, PDF_QOS, DDSI_QP_LOCATOR_MASK, "CYCLONE_LOCATOR_MASK",
     offsetof(struct ddsi_plist, qos.ignore_locator_type), membersize(struct ddsi_plist, qos.ignore_locator_type),
     {.desc = { Xu, XSTOP } }, 0 },
+  QP  (CYCLONE_INSTANCE_SHARD,           instance_shard, Xux2),
+  { DDSI_PID_PAD, PDF_QOS, DDSI_QP_CYCLONE_READER_LOAN_POOL, "CYCLONE_READER_LOAN_POOL",
+    offsetof (struct ddsi_plist, qos.reader_loan_pool), membersize (struct ddsi_plist, qos.reader_loan_pool),
+    { .desc = { Xu, XSTOP } }, 0 },
+  { DDSI_PID_PAD, PDF_QOS, DDSI_QP_CYCLONE_READER_STREAM, "CYCLONE_READER_STREAM",
+    offsetof (struct ddsi_plist, qos.reader_stream), membersize (struct ddsi_plist, qos.reader_stream),
+    { .desc = { Xu, XSTOP } }, 0 },
 #ifdef DDS_HAS_TOPIC_DISCOVERY
   PP  (CYCLONE_TOPIC_GUID,               topic_guid, XG),
 #endif
@@ -2168,7 +2176,7 @@ struct piddesc_index {
 #endif
 
 static const struct piddesc *piddesc_omg_index[DEFAULT_OMG_PIDS_ARRAY_SIZE + SECURITY_OMG_PIDS_ARRAY_SIZE];
-static const struct piddesc *piddesc_eclipse_index[30];
+static const struct piddesc *piddesc_eclipse_index[31];
 static const struct piddesc *piddesc_adlink_index[17];
 
 #define INDEX_ANY(vendorid_, tab_) [vendorid_] = { \
@@ -2194,11 +2202,11 @@ static const struct piddesc_index piddesc_vendor_index[] = {
    initialized by ddsi_plist_init_tables; will assert when
    table too small or too large */
 #ifdef DDS_HAS_TYPE_DISCOVERY
+static const struct piddesc *piddesc_unalias[19 + SECURITY_PROC_ARRAY_SIZE];
+static const struct piddesc *piddesc_fini[19 + SECURITY_PROC_ARRAY_SIZE];
+#else
 static const struct piddesc *piddesc_unalias[18 + SECURITY_PROC_ARRAY_SIZE];
 static const struct piddesc *piddesc_fini[18 + SECURITY_PROC_ARRAY_SIZE];
-#else
-static const struct piddesc *piddesc_unalias[17 + SECURITY_PROC_ARRAY_SIZE];
-static const struct piddesc *piddesc_fini[17 + SECURITY_PROC_ARRAY_SIZE];
 #endif
 static uint64_t plist_fini_mask, qos_fini_mask;
 static ddsrt_once_t table_init_control = DDSRT_ONCE_INIT;
@@ -3220,6 +3228,27 @@ static dds_return_t final_validation_qos (const dds_qos_t *dest, ddsi_protocol_v
       return DDS_RETCODE_INCONSISTENT_POLICY;
   }
 
+  /* Shard index must be one of the shards */
+  if (dest->present & DDSI_QP_CYCLONE_INSTANCE_SHARD)
+  {
+    if (dest->instance_shard.count == 0 || dest->instance_shard.index >= dest->instance_shard.count)
+      return DDS_RETCODE_BAD_PARAMETER;
+  }
+
+  /* A reader needs at least one loan, and the pool is allocated up front */
+  if (dest->present & DDSI_QP_CYCLONE_READER_LOAN_POOL)
+  {
+    if (dest->reader_loan_pool.depth == 0 || dest->reader_loan_pool.depth > DDS_READER_LOAN_POOL_MAX_DEPTH)
+      return DDS_RETCODE_BAD_PARAMETER;
+  }
+
+  /* The stream ring is allocated up front, its size rounded up to a power of 2 */
+  if (dest->present & DDSI_QP_CYCLONE_READER_STREAM)
+  {
+    if (dest->reader_stream.capacity == 0 || dest->reader_stream.capacity > DDS_READER_STREAM_MAX_CAPACITY)
+      return DDS_RETCODE_BAD_PARAMETER;
+  }
+
   /* Durability service is sort-of accepted if all zeros, but only
      for some protocol versions and vendors.  We don't handle want
      to deal with that case internally. Now that all QoS have been
@@ -14,8 +14,10 @@
 #include <stddef.h>
 
 #include "dds/ddsrt/heap.h"
+#include "dds/ddsrt/string.h"
 #include "dds/ddsi/ddsi_domaingv.h"
 #include "dds/ddsi/ddsi_builtin_topic_if.h"
+#include "dds/ddsi/ddsi_content_filter_if.h"
 #include "ddsi__entity.h"
 #include "ddsi__endpoint_match.h"
 #include "ddsi__entity_index.h"
@@ -529,6 +531,94 @@ int ddsi_proxy_writer_set_notalive (struct ddsi_proxy_writer *pwr, bool notify)
 
 /* PROXY-READER ----------------------------------------------------- */
 
+static const ddsi_content_filter_property_t *sql_content_filter_property (const ddsi_plist_t *plist)
+{
+  /* other filter classes are vendor-specific, a reader using one gets all data */
+  if (!(plist->present & PP_CONTENT_FILTER_PROPERTY))
+    return NULL;
+  else if (strcmp (plist->content_filter_property.filter_class_name, DDSI_CONTENT_FILTER_CLASS_SQL) != 0)
+    return NULL;
+  else
+    return &plist->content_filter_property;
+}
+
+static ddsi_content_filter_property_t *content_filter_property_dup (const ddsi_content_filter_property_t *src)
+{
+  if (src == NULL)
+    return NULL;
+  ddsi_content_filter_property_t *dst = ddsrt_malloc (sizeof (*dst));
+  dst->content_filtered_topic_name = ddsrt_strdup (src->content_filtered_topic_name);
+  dst->related_topic_name = ddsrt_strdup (src->related_topic_name);
+  dst->filter_class_name = ddsrt_strdup (src->filter_class_name);
+  dst->filter_expression = ddsrt_strdup (src->filter_expression);
+  dst->expression_parameters.n = src->expression_parameters.n;
+  dst->expression_parameters.strs = ddsrt_malloc ((src->expression_parameters.n > 0 ? src->expression_parameters.n : 1) * sizeof (*dst->expression_parameters.strs));
+  for (uint32_t i = 0; i < src->expression_parameters.n; i++)
+    dst->expression_parameters.strs[i] = ddsrt_strdup (src->expression_parameters.strs[i]);
+  return dst;
+}
+
+static void content_filter_property_free (ddsi_content_filter_property_t *cfp)
+{
+  if (cfp == NULL)
+    return;
+  for (uint32_t i = 0; i < cfp->expression_parameters.n; i++)
+    ddsrt_free (cfp->expression_parameters.strs[i]);
+  ddsrt_free (cfp->expression_parameters.strs);
+  ddsrt_free (cfp->filter_expression);
+  ddsrt_free (cfp->filter_class_name);
+  ddsrt_free (cfp->related_topic_name);
+  ddsrt_free (cfp->content_filtered_topic_name);
+  ddsrt_free (cfp);
+}
+
+static bool content_filter_property_equal (const ddsi_content_filter_property_t *a, const ddsi_content_filter_property_t *b)
+{
+  if (a == NULL || b == NULL)
+    return a == b;
+  if (strcmp (a->filter_expression, b->filter_expression) != 0 || a->expression_parameters.n != b->expression_parameters.n)
+    return false;
+  for (uint32_t i = 0; i < a->expression_parameters.n; i++)
+    if (strcmp (a->expression_parameters.strs[i], b->expression_parameters.strs[i]) != 0)
+      return false;
+  return true;
+}
+
+static void proxy_reader_update_content_filter_matches (struct ddsi_proxy_reader *prd)
+{
+  /* recompiles the filter for all matched writers, the filter in the writer's match is
+     replaced with the writer locked because that's how it is used */
+  struct ddsi_domaingv * const gv = prd->e.gv;
+  struct ddsi_prd_wr_match *m;
+  ddsi_guid_t wrguid;
+  memset (&wrguid, 0, sizeof (wrguid));
+  ddsrt_mutex_lock (&prd->e.lock);
+  while ((m = ddsrt_avl_lookup_succ (&ddsi_prd_writers_treedef, &prd->writers, &wrguid)) != NULL)
+  {
+    struct ddsi_writer *wr;
+    wrguid = m->wr_guid;
+    if ((wr = ddsi_entidx_lookup_writer_guid (gv->entity_index, &wrguid)) == NULL)
+      continue;
+    void *filter = prd->content_filter ? ddsi_content_filter_compile (gv->content_filter_interface, wr->type, prd->content_filter) : NULL;
+    ddsrt_mutex_unlock (&prd->e.lock);
+
+    struct ddsi_wr_prd_match *m_wr;
+    ddsrt_mutex_lock (&wr->e.lock);
+    if ((m_wr = ddsrt_avl_lookup (&ddsi_wr_readers_treedef, &wr->readers, &prd->e.guid)) != NULL)
+    {
+      void * const old = m_wr->content_filter;
+      wr->num_readers_filtered -= ddsi_wr_prd_match_is_filtered (m_wr) ? 1 : 0;
+      m_wr->content_filter = filter;
+      wr->num_readers_filtered += ddsi_wr_prd_match_is_filtered (m_wr) ? 1 : 0;
+      filter = old;
+    }
+    ddsrt_mutex_unlock (&wr->e.lock);
+    ddsi_content_filter_free (gv->content_filter_interface, filter);
+    ddsrt_mutex_lock (&prd->e.lock);
+  }
+  ddsrt_mutex_unlock (&prd->e.lock);
+}
+
 int ddsi_new_proxy_reader (struct ddsi_domaingv *gv, const struct ddsi_guid *ppguid, const struct ddsi_guid *guid, struct ddsi_addrset *as, const ddsi_plist_t *plist, ddsrt_wctime_t timestamp, ddsi_seqno_t seq
 #ifdef DDS_HAS_SSM
 , int favours_ssm
@@ -581,6 +671,7 @@ int ddsi_new_proxy_reader (struct ddsi_domaingv *gv, const struct ddsi_guid *ppg
 #else
   prd->filter = NULL;
 #endif
+  prd->content_filter = content_filter_property_dup (sql_content_filter_property (plist));
 
   /* locking the entity prevents matching while the built-in topic hasn't been published yet */
   ddsrt_mutex_lock (&prd->e.lock);
@@ -592,10 +683,11 @@ int ddsi_new_proxy_reader (struct ddsi_domaingv *gv, const struct ddsi_guid *ppg
   return DDS_RETCODE_OK;
 }
 
-void ddsi_update_proxy_reader (struct ddsi_proxy_reader *prd, ddsi_seqno_t seq, struct ddsi_addrset *as, const struct dds_qos *xqos, ddsrt_wctime_t timestamp)
+void ddsi_update_proxy_reader (struct ddsi_proxy_reader *prd, ddsi_seqno_t seq, struct ddsi_addrset *as, const struct dds_qos *xqos, const ddsi_plist_t *plist, ddsrt_wctime_t timestamp)
 {
   struct ddsi_prd_wr_match * m;
   ddsi_guid_t wrguid;
+  bool content_filter_changed = false;
 
   memset (&wrguid, 0, sizeof (wrguid));
 
@@ -646,8 +738,18 @@ void ddsi_update_proxy_reader (struct ddsi_proxy_reader *prd, ddsi_seqno_t seq,
     }
 
     (void) ddsi_update_qos_locked (&prd->e, prd->c.xqos, xqos, timestamp);
+
+    const ddsi_content_filter_property_t *cfp = sql_content_filter_property (plist);
+    if (!content_filter_property_equal (prd->content_filter, cfp))
+    {
+      content_filter_property_free (prd->content_filter);
+      prd->content_filter = content_filter_property_dup (cfp);
+      content_filter_changed = true;
+    }
   }
   ddsrt_mutex_unlock (&prd->e.lock);
+  if (content_filter_changed)
+    proxy_reader_update_content_filter_matches (prd);
 }
 
 static void proxy_reader_set_delete_and_ack_all_messages (struct ddsi_proxy_reader *prd)
@@ -723,6 +825,7 @@ static void gc_delete_proxy_reader (struct ddsi_gcreq *gcreq)
 #ifdef DDS_HAS_SECURITY
   ddsi_omg_security_deregister_remote_reader (prd);
 #endif
+  content_filter_property_free (prd->content_filter);
   proxy_endpoint_common_fini (&prd->e, &prd->c);
   ddsrt_free (prd);
 }
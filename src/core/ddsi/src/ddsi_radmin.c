@@ -1553,6 +1553,94 @@ enum ddsi_defrag_nackmap_result ddsi_defrag_nackmap (struct ddsi_defrag *defrag,
   return DDSI_DEFRAG_NACKMAP_FRAGMENTS_MISSING;
 }
 
+static void fec_xor_range (unsigned char *parity, const unsigned char *src, uint32_t min, uint32_t maxp1, uint32_t group_min, uint32_t blocksize, uint32_t skip_min, uint32_t skip_maxp1)
+{
+  /* XOR bytes [min,maxp1) of the sample located at SRC into the parity
+     block, leaving out the block [skip_min,skip_maxp1) that is to be
+     reconstructed */
+  for (uint32_t off = min; off < maxp1; off++)
+  {
+    if (off >= skip_min && off < skip_maxp1)
+      continue;
+    parity[(off - group_min) % blocksize] ^= src[off - min];
+  }
+}
+
+bool ddsi_defrag_fec_reconstruct (struct ddsi_defrag *defrag, ddsi_seqno_t seq, uint32_t size, uint32_t fragsize, uint32_t group_min, uint32_t blocksize, uint32_t nblocks, unsigned char *parity, uint32_t *min, uint32_t *maxp1)
+{
+  /* PARITY is the XOR of the NBLOCKS blocks of BLOCKSIZE bytes starting
+     at GROUP_MIN (zero-padded at the end of the sample).  If exactly one
+     of those blocks is (partially) missing, XOR'ing the others into it
+     turns it into that missing block, and [*min,*maxp1) is set to its
+     range.  The block containing the first byte can't be recovered this
+     way because the DATA_FRAG containing it also provides the flags and
+     inline QoS of the sample. */
+  struct ddsi_rsample *s;
+  struct ddsi_defrag_iv *iv;
+  uint32_t group_maxp1, pos, skip_min = UINT32_MAX;
+
+  if ((s = ddsrt_avl_lookup (&defrag_sampletree_treedef, &defrag->sampletree, &seq)) == NULL)
+    return false;
+  if (s->u.defrag.sampleinfo->size != size || s->u.defrag.sampleinfo->fragsize != fragsize)
+    return false;
+  if (blocksize == 0 || nblocks < 2 || group_min >= size || nblocks > (size - group_min + blocksize - 1) / blocksize)
+    return false;
+  group_maxp1 = (size - group_min < nblocks * blocksize) ? size : group_min + nblocks * blocksize;
+
+  /* Locate the holes in [group_min,group_maxp1) and require them all to
+     be in a single block */
+  pos = group_min;
+  iv = ddsrt_avl_find_min (&rsample_defrag_fragtree_treedef, &s->u.defrag.fragtree);
+  while (pos < group_maxp1)
+  {
+    while (iv && iv->maxp1 <= pos)
+      iv = ddsrt_avl_find_succ (&rsample_defrag_fragtree_treedef, &s->u.defrag.fragtree, iv);
+    if (iv && iv->min <= pos)
+      pos = iv->maxp1;
+    else
+    {
+      const uint32_t hole_maxp1 = (iv && iv->min < group_maxp1) ? iv->min : group_maxp1;
+      const uint32_t bmin = group_min + ((pos - group_min) / blocksize) * blocksize;
+      if (skip_min != UINT32_MAX && skip_min != bmin)
+        return false;
+      if (hole_maxp1 > bmin + blocksize)
+        return false;
+      skip_min = bmin;
+      pos = hole_maxp1;
+    }
+  }
+  if (skip_min == UINT32_MAX || skip_min == 0)
+    return false;
+  *min = skip_min;
+  *maxp1 = (skip_min + blocksize > size) ? size : skip_min + blocksize;
+
+  /* Remove all other blocks from the parity; the fragments chains of the
+     intervals may overlap, so track how far we got the same way it is
+     done when converting a fragment chain to a serdata */
+  for (iv = ddsrt_avl_find_min (&rsample_defrag_fragtree_treedef, &s->u.defrag.fragtree); iv; iv = ddsrt_avl_find_succ (&rsample_defrag_fragtree_treedef, &s->u.defrag.fragtree, iv))
+  {
+    if (iv->maxp1 <= group_min)
+      continue;
+    else if (iv->min >= group_maxp1)
+      break;
+    pos = iv->min;
+    for (struct ddsi_rdata *rd = iv->first; rd; rd = rd->nextfrag)
+    {
+      if (rd->maxp1 > pos)
+      {
+        const unsigned char *src = (const unsigned char *) DDSI_RMSG_PAYLOADOFF (rd->rmsg, DDSI_RDATA_PAYLOAD_OFF (rd));
+        const uint32_t xmin0 = (pos > rd->min) ? pos : rd->min;
+        const uint32_t xmin = (xmin0 > group_min) ? xmin0 : group_min;
+        const uint32_t xmaxp1 = (rd->maxp1 < group_maxp1) ? rd->maxp1 : group_maxp1;
+        if (xmin < xmaxp1)
+          fec_xor_range (parity, src + (xmin - rd->min), xmin, xmaxp1, group_min, blocksize, *min, *maxp1);
+        pos = rd->maxp1;
+      }
+    }
+  }
+  return true;
+}
+
 /* There is only one defrag per proxy writer. However for the Volatile Secure writer a filter
  * is applied to filter on the destination participant. Note that there will be one
  * builtin Volatile Secure reader for each local participant. When this local participant
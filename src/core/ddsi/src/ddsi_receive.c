@@ -59,6 +59,7 @@
 #include "ddsi__vendor.h"
 #include "ddsi__hbcontrol.h"
 #include "ddsi__sockwaitset.h"
+#include "ddsi__compress.h"
 
 #include "dds/cdr/dds_cdrstream.h"
 #include "dds__whc.h"
@@ -328,6 +329,31 @@ static enum validation_result validate_NackFrag (ddsi_rtps_nackfrag_t *msg, size
   return validate_writer_and_reader_entityid (msg->writerId, msg->readerId);
 }
 
+static enum validation_result validate_Fec (ddsi_rtps_adlink_fec_t *msg, size_t size, int byteswap)
+{
+  if (size < sizeof (*msg))
+    return VR_MALFORMED;
+  if (byteswap)
+  {
+    ddsi_bswap_sequence_number (&msg->writerSN);
+    msg->fragmentStartingNum = ddsrt_bswap4u (msg->fragmentStartingNum);
+    msg->fragmentsPerBlock = ddsrt_bswap2u (msg->fragmentsPerBlock);
+    msg->fragmentSize = ddsrt_bswap2u (msg->fragmentSize);
+    msg->sampleSize = ddsrt_bswap4u (msg->sampleSize);
+    msg->numBlocks = ddsrt_bswap4u (msg->numBlocks);
+  }
+  msg->readerId = ddsi_ntoh_entityid (msg->readerId);
+  msg->writerId = ddsi_ntoh_entityid (msg->writerId);
+  if (ddsi_from_seqno (msg->writerSN) <= 0 || msg->fragmentStartingNum == 0 || msg->fragmentsPerBlock == 0 || msg->fragmentSize == 0 || msg->numBlocks < 2)
+    return VR_MALFORMED;
+  // parity block must be present in its entirety and the group must be within the sample
+  if ((uint64_t) msg->fragmentsPerBlock * msg->fragmentSize > size - sizeof (*msg))
+    return VR_MALFORMED;
+  if ((uint64_t) (msg->fragmentStartingNum - 1) * msg->fragmentSize + (uint64_t) (msg->numBlocks - 1) * msg->fragmentsPerBlock * msg->fragmentSize >= msg->sampleSize)
+    return VR_MALFORMED;
+  return validate_writer_and_reader_or_null_entityid (msg->writerId, msg->readerId);
+}
+
 static void set_sampleinfo_proxy_writer (struct ddsi_rsample_info *sampleinfo, ddsi_guid_t *pwr_guid)
 {
   struct ddsi_proxy_writer * pwr = ddsi_entidx_lookup_proxy_writer_guid (sampleinfo->rst->gv->entity_index, pwr_guid);
@@ -876,6 +902,26 @@ static int handle_AckNack (struct ddsi_receiver_state *rst, ddsrt_etime_t tnow,
       rn->hb_to_ack_latency_tlastlog = tstamp_now;
     }
   }
+  else if (rst->gv->config.adaptive_timing_enable && wr->hbcontrol.t_of_last_ackhb.v > rn->t_last_ackhb.v)
+  {
+    /* Without timestamps, the first ACKNACK after a heartbeat requesting
+       one gives an estimate of the RTT.  It need not be the response to
+       that heartbeat, but the median filter deals with the worst of it. */
+    const ddsrt_mtime_t tnow_mt = ddsrt_time_monotonic ();
+    if (tnow_mt.v - wr->hbcontrol.t_of_last_ackhb.v < rst->gv->config.const_hb_intv_sched_max)
+      ddsi_lat_estim_update (&rn->hb_to_ack_latency, tnow_mt.v - wr->hbcontrol.t_of_last_ackhb.v);
+    rn->t_last_ackhb = wr->hbcontrol.t_of_last_ackhb;
+  }
+  if (rst->gv->config.adaptive_timing_enable)
+  {
+    const int64_t rtt = (int64_t) (ddsi_lat_estim_current (&rn->hb_to_ack_latency) * 1e3);
+    if (rtt != rn->rtt)
+    {
+      RSTTRACE (" rtt %"PRId64"us", rtt / 1000);
+      rn->rtt = rtt;
+      ddsrt_avl_augment_update (&ddsi_wr_readers_treedef, rn);
+    }
+  }
 
   /* First, the ACK part: if the AckNack advances the highest sequence
      number ack'd by the remote reader, update state & try dropping
@@ -1019,14 +1065,17 @@ static int handle_AckNack (struct ddsi_receiver_state *rst, ddsrt_etime_t tnow,
         if (!wr->retransmitting && sample.unacked)
           ddsi_writer_set_retransmitting (wr);
 
-        if (rst->gv->config.retransmit_merging != DDSI_REXMIT_MERGE_NEVER && rn->assumed_in_sync && !prd->filter)
+        /* NACK-only writers always multicast retransmits: that is what allows
+           readers to suppress their own NACKs for the same samples */
+        if ((wr->nack_only || (rst->gv->config.retransmit_merging != DDSI_REXMIT_MERGE_NEVER && rn->assumed_in_sync)) && !prd->filter && !ddsi_wr_prd_match_is_filtered (rn))
         {
           /* send retransmit to all receivers, but skip if recently done */
           ddsrt_mtime_t tstamp = ddsrt_time_monotonic ();
           if (tstamp.v > sample.last_rexmit_ts.v + rst->gv->config.retransmit_merging_period)
           {
             RSTTRACE (" RX%"PRIu64, seqbase + i);
-            enqueued = (ddsi_enqueue_sample_wrlock_held (wr, seq, sample.serdata, NULL, 0) >= 0);
+            struct ddsi_serdata * const wire_serdata = ddsi_writer_rexmit_serdata (&sample, NULL);
+            enqueued = (ddsi_enqueue_sample_wrlock_held (wr, seq, wire_serdata, NULL, 0) >= 0);
             if (enqueued)
             {
               max_seq_in_reply = seqbase + i;
@@ -1035,7 +1084,7 @@ static int handle_AckNack (struct ddsi_receiver_state *rst, ddsrt_etime_t tnow,
               // FIXME: now ddsi_enqueue_sample_wrlock_held limits retransmit requests of a large sample to 1 fragment
               // thus we can easily figure out how much was sent, but we shouldn't have that knowledge here:
               // it should return how much it queued instead
-              uint32_t sent = ddsi_serdata_size (sample.serdata);
+              uint32_t sent = ddsi_serdata_size (wire_serdata);
               if (sent > wr->e.gv->config.fragment_size)
                 sent = wr->e.gv->config.fragment_size;
               wr->rexmit_bytes += sent;
@@ -1049,15 +1098,18 @@ static int handle_AckNack (struct ddsi_receiver_state *rst, ddsrt_etime_t tnow,
         }
         else
         {
-          /* Is this a volatile reader with a filter?
+          /* Is this a volatile reader with a filter or a reader with a content filter or shard?
            * If so, call the filter to see if we should re-arrange the sequence gap when needed. */
           if (prd->filter && !prd->filter (wr, prd, sample.serdata))
             ddsi_gap_info_update (rst->gv, &gi, seqbase + i);
+          else if (ddsi_wr_prd_match_is_filtered (rn) && !ddsi_wr_prd_match_accepts_sample (rst->gv, rn, sample.serdata, NULL))
+            ddsi_gap_info_update (rst->gv, &gi, seqbase + i);
           else
           {
             /* no merging, send directed retransmit */
             RSTTRACE (" RX%"PRIu64"", seqbase + i);
-            enqueued = (ddsi_enqueue_sample_wrlock_held (wr, seq, sample.serdata, prd, 0) >= 0);
+            struct ddsi_serdata * const wire_serdata = ddsi_writer_rexmit_serdata (&sample, prd);
+            enqueued = (ddsi_enqueue_sample_wrlock_held (wr, seq, wire_serdata, prd, 0) >= 0);
             if (enqueued)
             {
               max_seq_in_reply = seqbase + i;
@@ -1066,7 +1118,7 @@ static int handle_AckNack (struct ddsi_receiver_state *rst, ddsrt_etime_t tnow,
               // FIXME: now ddsi_enqueue_sample_wrlock_held limits retransmit requests of a large sample to 1 fragment
               // thus we can easily figure out how much was sent, but we shouldn't have that knowledge here:
               // it should return how much it queued instead
-              uint32_t sent = ddsi_serdata_size (sample.serdata);
+              uint32_t sent = ddsi_serdata_size (wire_serdata);
               if (sent > wr->e.gv->config.fragment_size)
                 sent = wr->e.gv->config.fragment_size;
               wr->rexmit_bytes += sent;
@@ -1111,7 +1163,8 @@ static int handle_AckNack (struct ddsi_receiver_state *rst, ddsrt_etime_t tnow,
   {
     RSTTRACE (" rexmit#%"PRIu32" maxseq:%"PRIu64"<%"PRIu64"<=%"PRIu64"", msgs_sent, max_seq_in_reply, seq_xmit, wr->seq);
 
-    defer_heartbeat_to_peer (wr, &whcst, prd, 1, defer_hb_state);
+    /* NACK-only writers don't want an ACK, a reader still missing data will NACK anyway */
+    defer_heartbeat_to_peer (wr, &whcst, prd, !wr->nack_only, defer_hb_state);
     hb_sent_in_response = 1;
 
     /* The primary purpose of hbcontrol_note_asyncwrite is to ensure
@@ -1226,7 +1279,23 @@ static void handle_Heartbeat_helper (struct ddsi_pwr_rd_match * const wn, struct
   if (!(msg->smhdr.flags & DDSI_HEARTBEAT_FLAG_FINAL))
     wn->ack_requested = 1;
   if (arg->directed_heartbeat)
+  {
     wn->directed_heartbeat = 1;
+    /* Cyclone writers only send directed heartbeats in response to an ACKNACK,
+       which gives the reader an RTT estimate */
+    if (rst->gv->config.adaptive_timing_enable && wn->t_rtt_probe.v != 0)
+    {
+      ddsi_lat_estim_update (&wn->ack_to_hb_latency, arg->tnow_mt.v - wn->t_rtt_probe.v);
+      wn->t_rtt_probe.v = 0;
+      wn->nack_delay = 2 * (int64_t) (ddsi_lat_estim_current (&wn->ack_to_hb_latency) * 1e3);
+      if (wn->nack_delay < rst->gv->config.adaptive_timing_min_nack_delay)
+        wn->nack_delay = rst->gv->config.adaptive_timing_min_nack_delay;
+      else if (wn->nack_delay > rst->gv->config.adaptive_timing_max_nack_delay)
+        wn->nack_delay = rst->gv->config.adaptive_timing_max_nack_delay;
+    }
+  }
+  if (rst->gv->config.meas_hb_to_ack_latency && arg->timestamp.v != DDSRT_WCTIME_INVALID.v)
+    wn->hb_timestamp = arg->timestamp;
 
   ddsi_sched_acknack_if_needed (wn->acknack_xevent, pwr, wn, arg->tnow_mt, true);
 }
@@ -1568,7 +1637,7 @@ static int handle_HeartbeatFrag (struct ddsi_receiver_state *rst, UNUSED_ARG(dds
       if (seq == last_seq && ddsi_defrag_nackmap (pwr->defrag, seq, fragnum, &nackfrag.set, nackfrag.bits, DDSI_FRAGMENT_NUMBER_SET_MAX_BITS) == DDSI_DEFRAG_NACKMAP_FRAGMENTS_MISSING)
       {
         // don't rush it ...
-        ddsi_resched_xevent_if_earlier (m->acknack_xevent, ddsrt_mtime_add_duration (ddsrt_time_monotonic (), pwr->e.gv->config.nack_delay));
+        ddsi_resched_xevent_if_earlier (m->acknack_xevent, ddsrt_mtime_add_duration (ddsrt_time_monotonic (), m->nack_delay));
       }
     }
   }
@@ -1657,13 +1726,15 @@ static int handle_NackFrag (struct ddsi_receiver_state *rst, ddsrt_etime_t tnow,
     assert (wr->rexmit_burst_size_limit <= UINT32_MAX - UINT16_MAX);
     uint32_t nfrags_lim = (wr->rexmit_burst_size_limit + wr->e.gv->config.fragment_size - 1) / wr->e.gv->config.fragment_size;
     bool sent = false;
+    /* fragment numbers refer to the payload as it was sent, the WHC retains that form */
+    struct ddsi_serdata * const wire_serdata = ddsi_writer_rexmit_serdata (&sample, prd);
     RSTTRACE (" scheduling requested frags ...\n");
     for (uint32_t i = 0; i < msg->fragmentNumberState.numbits && nfrags_lim > 0; i++)
     {
       if (ddsi_bitset_isset (msg->fragmentNumberState.numbits, msg->bits, i))
       {
         struct ddsi_xmsg *reply;
-        if (ddsi_create_fragment_message (wr, seq, sample.serdata, base + i, 1, prd, &reply, 0, 0) < 0)
+        if (ddsi_create_fragment_message (wr, seq, wire_serdata, base + i, 1, prd, &reply, 0, 0) < 0)
           nfrags_lim = 0;
         else if (ddsi_qxev_msg_rexmit_wrlock_held (wr->evq, reply, 0) == DDSI_QXEV_MSG_REXMIT_DROPPED)
           nfrags_lim = 0;
@@ -1700,7 +1771,7 @@ static int handle_NackFrag (struct ddsi_receiver_state *rst, ddsrt_etime_t tnow,
        hearbeats will go out at a reasonably high rate for a while */
     struct ddsi_whc_state whcst;
     ddsi_whc_get_state(wr->whc, &whcst);
-    defer_heartbeat_to_peer (wr, &whcst, prd, 1, defer_hb_state);
+    defer_heartbeat_to_peer (wr, &whcst, prd, !wr->nack_only, defer_hb_state);
     ddsi_writer_hbcontrol_note_asyncwrite (wr, ddsrt_time_monotonic ());
   }
 
@@ -1970,9 +2041,10 @@ static int handle_Gap (struct ddsi_receiver_state *rst, ddsrt_etime_t tnow, stru
   return 1;
 }
 
-static struct ddsi_serdata *get_serdata (struct ddsi_sertype const * const type, const struct ddsi_rdata *fragchain, uint32_t sz, int justkey, unsigned statusinfo, ddsrt_wctime_t tstamp)
+static struct ddsi_serdata *get_serdata (struct ddsi_domaingv *gv, struct ddsi_sertype const * const type, const struct ddsi_rdata *fragchain, uint32_t sz, int justkey, bool compressed, unsigned statusinfo, ddsrt_wctime_t tstamp)
 {
-  struct ddsi_serdata *sd = ddsi_serdata_from_ser (type, justkey ? SDK_KEY : SDK_DATA, fragchain, sz);
+  const enum ddsi_serdata_kind kind = justkey ? SDK_KEY : SDK_DATA;
+  struct ddsi_serdata *sd = compressed ? ddsi_serdata_from_compressed_ser (gv, type, kind, fragchain, sz) : ddsi_serdata_from_ser (type, kind, fragchain, sz);
   if (sd)
   {
     sd->statusinfo = statusinfo;
@@ -2003,6 +2075,8 @@ static struct ddsi_serdata *remote_make_sample (struct ddsi_tkmap_instance **tk,
   const ddsi_plist_t * __restrict qos = si->qos;
   const char *failmsg = NULL;
   struct ddsi_serdata *sample = NULL;
+  /* the non-standard payload flag only means "compressed" when it comes from Cyclone */
+  const bool compressed = (data_smhdr_flags & DDSI_DATA_FLAG_NONSTANDARD) && ddsi_vendor_is_eclipse (sampleinfo->rst->vendor);
 
   if (si->statusinfo == 0)
   {
@@ -2021,7 +2095,7 @@ static struct ddsi_serdata *remote_make_sample (struct ddsi_tkmap_instance **tk,
                   si->data_smhdr_flags, sampleinfo->size);
       return NULL;
     }
-    sample = get_serdata (type, fragchain, sampleinfo->size, 0, statusinfo, tstamp);
+    sample = get_serdata (gv, type, fragchain, sampleinfo->size, 0, compressed, statusinfo, tstamp);
   }
   else if (sampleinfo->size)
   {
@@ -2030,12 +2104,12 @@ static struct ddsi_serdata *remote_make_sample (struct ddsi_tkmap_instance **tk,
        as one would expect to receive */
     if (data_smhdr_flags & DDSI_DATA_FLAG_KEYFLAG)
     {
-      sample = get_serdata (type, fragchain, sampleinfo->size, 1, statusinfo, tstamp);
+      sample = get_serdata (gv, type, fragchain, sampleinfo->size, 1, compressed, statusinfo, tstamp);
     }
     else
     {
       assert (data_smhdr_flags & DDSI_DATA_FLAG_DATAFLAG);
-      sample = get_serdata (type, fragchain, sampleinfo->size, 0, statusinfo, tstamp);
+      sample = get_serdata (gv, type, fragchain, sampleinfo->size, 0, compressed, statusinfo, tstamp);
     }
   }
   else if (data_smhdr_flags & DDSI_DATA_FLAG_INLINE_QOS)
@@ -2114,6 +2188,8 @@ unsigned char ddsi_normalize_data_datafrag_flags (const ddsi_rtps_submessage_hea
       {
         unsigned char common = smhdr->flags & DDSI_DATA_FLAG_INLINE_QOS;
         DDSRT_STATIC_ASSERT_CODE (DDSI_DATA_FLAG_INLINE_QOS == DDSI_DATAFRAG_FLAG_INLINE_QOS);
+        if (smhdr->flags & DDSI_DATAFRAG_FLAG_NONSTANDARD)
+          common |= DDSI_DATA_FLAG_NONSTANDARD;
         if (smhdr->flags & DDSI_DATAFRAG_FLAG_KEYFLAG)
           return common | DDSI_DATA_FLAG_KEYFLAG;
         else
@@ -2761,6 +2837,80 @@ static int handle_DataFrag (struct ddsi_receiver_state *rst, ddsrt_etime_t tnow,
   return 1;
 }
 
+static int handle_Fec (struct ddsi_receiver_state *rst, ddsrt_etime_t tnow, struct ddsi_rmsg *rmsg, ddsi_rtps_adlink_fec_t *msg, ddsrt_wctime_t timestamp, ddsrt_wctime_t reception_timestamp, struct ddsi_dqueue **deferred_wakeup, ddsi_rtps_submessage_kind_t prev_smid)
+{
+  /* Reconstruct at most one missing DATA_FRAG submessage of the group of blocks
+     covered by this FEC submessage, then process it as if it were received
+     normally.  The parity data is XOR'd in place with the blocks already received. */
+  struct ddsi_proxy_writer *pwr;
+  struct ddsi_rsample_info sampleinfo;
+  ddsi_rtps_data_datafrag_common_t ddcmn;
+  ddsi_guid_t pwr_guid;
+  uint32_t min, maxp1;
+  bool reconstructed;
+
+  RSTTRACE ("FEC("PGUIDFMT" -> "PGUIDFMT" #%"PRIu64"/%"PRIu32"+%"PRIu32"*%"PRIu32,
+            PGUIDPREFIX (rst->src_guid_prefix), msg->writerId.u,
+            PGUIDPREFIX (rst->dst_guid_prefix), msg->readerId.u,
+            ddsi_from_seqno (msg->writerSN), msg->fragmentStartingNum, msg->numBlocks, (uint32_t) msg->fragmentsPerBlock);
+  if (!rst->forme)
+  {
+    RSTTRACE (" not-for-me)");
+    return 1;
+  }
+  if (msg->sampleSize > rst->gv->config.max_sample_size)
+  {
+    RSTTRACE (" oversize)");
+    return 1;
+  }
+
+  pwr_guid.prefix = rst->src_guid_prefix;
+  pwr_guid.entityid = msg->writerId;
+  if ((pwr = ddsi_entidx_lookup_proxy_writer_guid (rst->gv->entity_index, &pwr_guid)) == NULL)
+  {
+    RSTTRACE (" "PGUIDFMT"?)", PGUID (pwr_guid));
+    return 1;
+  }
+  if (!ddsi_security_validate_msg_decoding (&pwr->e, &pwr->c, pwr->c.proxypp, rst, prev_smid))
+  {
+    RSTTRACE (" clear submsg from protected src "PGUIDFMT")", PGUID (pwr->e.guid));
+    return 1;
+  }
+
+  const uint32_t blocksize = (uint32_t) msg->fragmentsPerBlock * msg->fragmentSize;
+  const uint32_t group_min = (msg->fragmentStartingNum - 1) * msg->fragmentSize;
+  unsigned char * const parity = (unsigned char *) (msg + 1);
+  ddsrt_mutex_lock (&pwr->e.lock);
+  reconstructed = ddsi_defrag_fec_reconstruct (pwr->defrag, ddsi_from_seqno (msg->writerSN), msg->sampleSize, msg->fragmentSize, group_min, blocksize, msg->numBlocks, parity, &min, &maxp1);
+  ddsrt_mutex_unlock (&pwr->e.lock);
+  if (!reconstructed)
+  {
+    RSTTRACE (" nothing to do)");
+    return 1;
+  }
+  RSTTRACE (" reconstructed [%"PRIu32"..%"PRIu32")", min, maxp1);
+
+  /* Only the first fragment carries the flags, inline QoS and encoding, so the
+     sample info needs nothing beyond the sequence number and sizes */
+  memset (&sampleinfo, 0, sizeof (sampleinfo));
+  sampleinfo.seq = ddsi_from_seqno (msg->writerSN);
+  sampleinfo.rst = rst;
+  sampleinfo.pwr = pwr;
+  sampleinfo.size = msg->sampleSize;
+  sampleinfo.fragsize = msg->fragmentSize;
+  sampleinfo.timestamp = timestamp;
+  sampleinfo.reception_timestamp = reception_timestamp;
+  ddcmn.readerId = msg->readerId;
+  ddcmn.writerId = msg->writerId;
+
+  const unsigned submsg_offset = (unsigned) ((unsigned char *) msg - DDSI_RMSG_PAYLOAD (rmsg));
+  const unsigned payload_offset = (unsigned) (parity - DDSI_RMSG_PAYLOAD (rmsg));
+  struct ddsi_rdata *rdata = ddsi_rdata_new (rmsg, min, maxp1, submsg_offset, payload_offset, 0);
+  handle_regular (rst, tnow, rmsg, &ddcmn, &sampleinfo, (maxp1 - 1) / msg->fragmentSize, rdata, deferred_wakeup, true);
+  RSTTRACE (")");
+  return 1;
+}
+
 struct submsg_name {
   char x[32];
 };
@@ -2784,6 +2934,7 @@ static const char *submsg_name (ddsi_rtps_submessage_kind_t id, struct submsg_na
     case DDSI_RTPS_SMID_DATA: return "DATA";
     case DDSI_RTPS_SMID_ADLINK_MSG_LEN: return "ADLINK_MSG_LEN";
     case DDSI_RTPS_SMID_ADLINK_ENTITY_ID: return "ADLINK_ENTITY_ID";
+    case DDSI_RTPS_SMID_ADLINK_FEC: return "ADLINK_FEC";
     case DDSI_RTPS_SMID_SEC_PREFIX: return "SEC_PREFIX";
     case DDSI_RTPS_SMID_SEC_BODY: return "SEC_BODY";
     case DDSI_RTPS_SMID_SEC_POSTFIX: return "SEC_POSTFIX";
@@ -2896,6 +3047,14 @@ static void malformed_packet_received (const struct ddsi_domaingv *gv, const uns
                            x->fragmentStartingNum, x->fragmentsInSubmessage, x->fragmentSize, x->sampleSize);
         }
         break;
+      case DDSI_RTPS_SMID_ADLINK_FEC:
+        if (smsize >= sizeof (ddsi_rtps_adlink_fec_t)) {
+          const ddsi_rtps_adlink_fec_t *x = (const ddsi_rtps_adlink_fec_t *) submsg;
+          (void) snprintf (tmp + pos, sizeof (tmp) - pos, " rid 0x%"PRIx32" wid 0x%"PRIx32" seq %"PRIu64" frag %"PRIu32" fragsperblock %"PRIu16" fragsize %"PRIu16" samplesize %"PRIu32" numblocks %"PRIu32,
+                           x->readerId.u, x->writerId.u, ddsi_from_seqno (x->writerSN),
+                           x->fragmentStartingNum, x->fragmentsPerBlock, x->fragmentSize, x->sampleSize, x->numBlocks);
+        }
+        break;
       default:
         break;
     }
@@ -3129,6 +3288,17 @@ static int handle_submsg_sequence
         ts_for_latmeas = 0;
         break;
       }
+      case DDSI_RTPS_SMID_ADLINK_FEC: {
+        // vendor-specific submessage ids are only meaningful when coming from Cyclone
+        if (!ddsi_vendor_is_eclipse (rst->vendor)) {
+          GVTRACE ("UNDEFINED(%x)", sm->smhdr.submessageId);
+        } else if ((vr = validate_Fec (&sm->fec, submsg_size, byteswap)) == VR_ACCEPT) {
+          handle_Fec (rst, tnowE, rmsg, &sm->fec, timestamp, tnowWC, &deferred_wakeup, prev_smid);
+          rst_live = 1;
+        }
+        ts_for_latmeas = 0;
+        break;
+      }
       case DDSI_RTPS_SMID_SEC_PREFIX: {
         GVTRACE ("SEC_PREFIX ");
         if (!ddsi_security_decode_sec_prefix(rst, submsg, submsg_size, end, &rst->src_guid_prefix, &rst->dst_guid_prefix, byteswap))
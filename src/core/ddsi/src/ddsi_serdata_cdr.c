@@ -207,6 +207,7 @@ static void istream_from_serdata_cdr (dds_istream_t * __restrict s, const struct
   assert (!DDSI_RTPS_CDR_ENC_LE (d->hdr.identifier));
 #endif
   s->m_xcdr_version = ddsi_sertype_enc_id_xcdr_version (d->hdr.identifier);
+  s->m_allocator = NULL;
 }
 
 static void ostream_from_serdata_cdr (dds_ostream_t * __restrict s, const struct ddsi_serdata_cdr * __restrict d)
@@ -69,6 +69,7 @@ static void sertype_cdr_free (struct ddsi_sertype *tpcmn)
 {
   struct ddsi_sertype_cdr *tp = (struct ddsi_sertype_cdr *) tpcmn;
   ddsrt_free (tp->type.ops.ops);
+  dds_stream_free_copy_plan (tp->type.copy_plan);
   ddsi_sertype_fini (&tp->c);
   ddsrt_free (tp);
 }
@@ -168,6 +169,8 @@ dds_return_t ddsi_sertype_cdr_init (const struct ddsi_domaingv *gv, struct ddsi_
   st->type.flagset = desc->m_flagset;
   st->type.ops.nops = dds_stream_countops (desc->m_ops, 0, NULL);
   st->type.ops.ops = ddsrt_memdup (desc->m_ops, st->type.ops.nops * sizeof (*st->type.ops.ops));
+  st->type.serializers = NULL;
+  st->type.copy_plan = NULL;
 
   if (dds_stream_type_nesting_depth (desc->m_ops) > DDS_CDRSTREAM_MAX_NESTING_DEPTH)
   {
@@ -179,6 +182,8 @@ dds_return_t ddsi_sertype_cdr_init (const struct ddsi_domaingv *gv, struct ddsi_
   st->type.opt_size_xcdr2 = dds_stream_check_optimize (&st->type, DDSI_RTPS_CDR_ENC_VERSION_2);
   if (st->type.opt_size_xcdr2 > 0)
     GVTRACE ("Marshalling XCDR2 for type: %s is %soptimised\n", st->c.type_name, st->type.opt_size_xcdr2 ? "" : "not ");
+  else if ((st->type.copy_plan = dds_stream_compile_copy_plan (&st->type)) != NULL)
+    GVTRACE ("Marshalling XCDR2 for type: %s uses a copy plan with %"PRIu32" steps\n", st->c.type_name, st->type.copy_plan->nsteps);
 
   return DDS_RETCODE_OK;
 }
@@ -16,6 +16,7 @@
 #include "dds/ddsrt/log.h"
 #include "dds/ddsrt/sync.h"
 #include "dds/ddsrt/hopscotch.h"
+#include "dds/ddsrt/mh3.h"
 #include "dds/ddsi/ddsi_unused.h"
 #include "dds/ddsi/ddsi_domaingv.h"
 #include "dds/ddsi/ddsi_iid.h"
@@ -188,6 +189,7 @@ retry:
 
     tk->m_sample = ddsi_serdata_to_untyped (sd);
     ddsrt_atomic_st32 (&tk->m_refc, 1);
+    ddsrt_atomic_st32 (&tk->m_shard_hash, 0);
     tk->m_iid = ddsi_iid_gen ();
     if (!ddsrt_chh_add (map->m_hh, tk))
     {
@@ -241,3 +243,21 @@ void ddsi_tkmap_instance_unref (struct ddsi_tkmap *map, struct ddsi_tkmap_instan
     gc_tkmap_instance(tk, map->gv->gcreq_queue);
   }
 }
+
+bool ddsi_tkmap_instance_in_shard (struct ddsi_tkmap_instance *tk, const struct ddsi_serdata *sd, const dds_instance_shard_qospolicy_t *shard)
+{
+  /* The hash is a pure function of the key, so racing threads all store the same value.
+     Zero is reserved for "not computed yet", which makes hash 1 slightly more likely than
+     any other value, and that really doesn't matter. */
+  uint32_t h;
+  if ((h = ddsrt_atomic_ld32 (&tk->m_shard_hash)) == 0)
+  {
+    ddsi_keyhash_t kh;
+    ddsi_serdata_get_keyhash (sd, &kh, false);
+    if ((h = ddsrt_mh3 (kh.value, sizeof (kh.value), 0)) == 0)
+      h = 1;
+    ddsrt_atomic_st32 (&tk->m_shard_hash, h);
+  }
+  assert (shard->count > 0);
+  return (h % shard->count) == shard->index;
+}
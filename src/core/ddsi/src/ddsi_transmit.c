@@ -40,6 +40,7 @@
 #include "ddsi__endpoint_match.h"
 #include "ddsi__protocol.h"
 #include "ddsi__vendor.h"
+#include "ddsi__compress.h"
 #include "dds__whc.h"
 
 static const struct ddsi_wr_prd_match *root_rdmatch (const struct ddsi_writer *wr)
@@ -55,6 +56,23 @@ static int have_reliable_subs (const struct ddsi_writer *wr)
     return 1;
 }
 
+static int64_t writer_hbcontrol_base_intv (const struct ddsi_writer *wr)
+{
+  /* With adaptive timing the base interval follows the reader with the
+     largest RTT: heartbeats are usually multicast, and there's no point
+     in asking for ACKs faster than the slowest reader can respond */
+  struct ddsi_domaingv const * const gv = wr->e.gv;
+  int64_t intv;
+  if (!gv->config.adaptive_timing_enable || ddsrt_avl_is_empty (&wr->readers) || root_rdmatch (wr)->max_rtt == 0)
+    return gv->config.const_hb_intv_sched;
+  intv = 4 * root_rdmatch (wr)->max_rtt;
+  if (intv < gv->config.const_hb_intv_sched_min)
+    intv = gv->config.const_hb_intv_sched_min;
+  else if (intv > gv->config.const_hb_intv_sched_max)
+    intv = gv->config.const_hb_intv_sched_max;
+  return intv;
+}
+
 void ddsi_writer_hbcontrol_init (struct ddsi_hbcontrol *hbc)
 {
   hbc->t_of_last_write.v = 0;
@@ -83,7 +101,7 @@ int64_t ddsi_writer_hbcontrol_intv (const struct ddsi_writer *wr, const struct d
 {
   struct ddsi_domaingv const * const gv = wr->e.gv;
   struct ddsi_hbcontrol const * const hbc = &wr->hbcontrol;
-  int64_t ret = gv->config.const_hb_intv_sched;
+  int64_t ret = writer_hbcontrol_base_intv (wr);
   size_t n_unacked;
 
   if (hbc->hbs_since_last_write > 5)
@@ -100,6 +118,9 @@ int64_t ddsi_writer_hbcontrol_intv (const struct ddsi_writer *wr, const struct d
     ret /= 2;
   if (wr->throttling)
     ret /= 2;
+  /* NACK-only writers expire data from the WHC when handling heartbeat events */
+  if (wr->nack_only && ret > gv->config.nack_only_retention_time)
+    ret = gv->config.nack_only_retention_time;
   if (ret < gv->config.const_hb_intv_sched_min)
     ret = gv->config.const_hb_intv_sched_min;
   return ret;
@@ -107,7 +128,6 @@ int64_t ddsi_writer_hbcontrol_intv (const struct ddsi_writer *wr, const struct d
 
 void ddsi_writer_hbcontrol_note_asyncwrite (struct ddsi_writer *wr, ddsrt_mtime_t tnow)
 {
-  struct ddsi_domaingv const * const gv = wr->e.gv;
   struct ddsi_hbcontrol * const hbc = &wr->hbcontrol;
   ddsrt_mtime_t tnext;
 
@@ -117,7 +137,7 @@ void ddsi_writer_hbcontrol_note_asyncwrite (struct ddsi_writer *wr, ddsrt_mtime_
 
   /* We know this is new data, so we want a heartbeat event after one
      base interval */
-  tnext.v = tnow.v + gv->config.const_hb_intv_sched;
+  tnext.v = tnow.v + writer_hbcontrol_base_intv (wr);
   if (tnext.v < hbc->tsched.v)
   {
     /* Insertion of a message with WHC locked => must now have at
@@ -144,6 +164,12 @@ struct ddsi_xmsg *ddsi_writer_hbcontrol_create_heartbeat (struct ddsi_writer *wr
   assert (wr->reliable);
   assert (hbansreq >= 0);
 
+  /* NACK-only writers never ask for an acknowledgement: with many readers
+     the ACKs would swamp the writer, readers only respond when they are
+     missing data */
+  if (wr->nack_only)
+    hbansreq = 0;
+
   if ((msg = ddsi_xmsg_new (gv->xmsgpool, &wr->e.guid, wr->c.pp, sizeof (ddsi_rtps_info_ts_t) + sizeof (ddsi_rtps_heartbeat_t), DDSI_XMSG_KIND_CONTROL)) == NULL)
     /* out of memory at worst slows down traffic */
     return NULL;
@@ -236,7 +262,7 @@ static int writer_hbcontrol_ack_required_generic (const struct ddsi_writer *wr,
 {
   struct ddsi_domaingv const * const gv = wr->e.gv;
   struct ddsi_hbcontrol const * const hbc = &wr->hbcontrol;
-  const int64_t hb_intv_ack = gv->config.const_hb_intv_sched;
+  const int64_t hb_intv_ack = writer_hbcontrol_base_intv (wr);
   assert(wr->heartbeat_xevent != NULL && whcst != NULL);
 
   if (piggyback)
@@ -475,6 +501,8 @@ static dds_return_t ddsi_create_fragment_message_simple (struct ddsi_writer *wr,
       break;
     case SDK_DATA:
       contentflag = DDSI_DATA_FLAG_DATAFLAG;
+      if (ddsi_serdata_is_compressed (serdata))
+        contentflag |= DDSI_DATA_FLAG_NONSTANDARD;
       break;
   }
 
@@ -486,16 +514,7 @@ static dds_return_t ddsi_create_fragment_message_simple (struct ddsi_writer *wr,
 
   ddsi_xmsg_setdst_addrset (*pmsg, wr->as);
   ddsi_xmsg_setmaxdelay (*pmsg, wr->xqos->latency_budget.duration);
-  ddsi_xmsg_add_timestamp (*pmsg, serdata->timestamp);
-  data = ddsi_xmsg_append (*pmsg, &sm_marker, sizeof (ddsi_rtps_data_t));
-
-  ddsi_xmsg_submsg_init (*pmsg, sm_marker, DDSI_RTPS_SMID_DATA);
-  data->x.smhdr.flags = (unsigned char) (data->x.smhdr.flags | contentflag);
-  data->x.extraFlags = 0;
-  data->x.readerId = ddsi_to_entityid (DDSI_ENTITYID_UNKNOWN);
-  data->x.writerId = ddsi_hton_entityid (wr->e.guid.entityid);
-  data->x.writerSN = ddsi_to_seqno (seq);
-  data->x.octetsToInlineQos = (unsigned short) ((char*) (data+1) - ((char*) &data->x.octetsToInlineQos + 2));
+  (void) ddsi_xmsg_append_timestamp_data (*pmsg, &sm_marker, serdata->timestamp, contentflag, ddsi_to_entityid (DDSI_ENTITYID_UNKNOWN), wr->e.guid.entityid, seq);
 
   if (wr->reliable)
     ddsi_xmsg_setwriterseq (*pmsg, &wr->e.guid, seq);
@@ -594,6 +613,8 @@ dds_return_t ddsi_create_fragment_message (struct ddsi_writer *wr, ddsi_seqno_t
       case SDK_KEY:   contentflag = DDSI_DATA_FLAG_KEYFLAG; break;
       case SDK_DATA:  contentflag = DDSI_DATA_FLAG_DATAFLAG; break;
     }
+    if (ddsi_serdata_is_compressed (serdata))
+      contentflag |= DDSI_DATA_FLAG_NONSTANDARD;
     ddsi_xmsg_submsg_init (*pmsg, sm_marker, DDSI_RTPS_SMID_DATA);
     ddcmn->smhdr.flags = (unsigned char) (ddcmn->smhdr.flags | contentflag);
 
@@ -606,7 +627,9 @@ dds_return_t ddsi_create_fragment_message (struct ddsi_writer *wr, ddsi_seqno_t
   }
   else
   {
-    const unsigned char contentflag = (serdata->kind == SDK_KEY ? DDSI_DATAFRAG_FLAG_KEYFLAG : 0);
+    unsigned char contentflag = (serdata->kind == SDK_KEY ? DDSI_DATAFRAG_FLAG_KEYFLAG : 0);
+    if (ddsi_serdata_is_compressed (serdata))
+      contentflag |= DDSI_DATAFRAG_FLAG_NONSTANDARD;
     ddsi_rtps_datafrag_t *frag = sm;
     /* empty means size = 0, which means it never needs fragmenting */
     assert (serdata->kind != SDK_EMPTY);
@@ -718,6 +741,63 @@ static void create_HeartbeatFrag (struct ddsi_writer *wr, ddsi_seqno_t seq, unsi
   }
 }
 
+static void create_fec_parity (struct ddsi_writer *wr, ddsi_seqno_t seq, struct ddsi_serdata *serdata, uint32_t fragnum, uint32_t nfrags_per_block, uint32_t nblocks, struct ddsi_xmsg **pmsg)
+{
+  /* Parity for blocks [fragnum, fragnum + nblocks * nfrags_per_block) (fragments, 0-based),
+     the last block of which may be cut short by the end of the sample.  Only the first
+     block needs to be full-sized, and because there are at least two of those, that is
+     guaranteed to be the case. */
+  struct ddsi_domaingv const * const gv = wr->e.gv;
+  const uint32_t size = ddsi_serdata_size (serdata);
+  const uint32_t blocksize = nfrags_per_block * (uint32_t) gv->config.fragment_size;
+  const uint32_t paddedsize = (blocksize + 3u) & ~(uint32_t) 3;
+  const uint32_t start = fragnum * (uint32_t) gv->config.fragment_size;
+  struct ddsi_xmsg_marker sm_marker;
+  ddsi_rtps_adlink_fec_t *fec;
+  unsigned char *parity;
+  ASSERT_MUTEX_HELD (&wr->e.lock);
+  assert (nblocks >= 2);
+  assert (start + blocksize < size);
+  *pmsg = NULL;
+  if (sizeof (ddsi_rtps_adlink_fec_t) + paddedsize > UINT16_MAX)
+    return;
+  if ((*pmsg = ddsi_xmsg_new (gv->xmsgpool, &wr->e.guid, wr->c.pp, sizeof (ddsi_rtps_adlink_fec_t) + paddedsize, DDSI_XMSG_KIND_CONTROL)) == NULL)
+    return; /* ignore out-of-memory: it is only an optimisation */
+  ddsi_xmsg_setdst_addrset (*pmsg, wr->as);
+  fec = ddsi_xmsg_append (*pmsg, &sm_marker, sizeof (ddsi_rtps_adlink_fec_t) + paddedsize);
+  ddsi_xmsg_submsg_init (*pmsg, sm_marker, DDSI_RTPS_SMID_ADLINK_FEC);
+  fec->readerId = ddsi_hton_entityid (ddsi_to_entityid (DDSI_ENTITYID_UNKNOWN));
+  fec->writerId = ddsi_hton_entityid (wr->e.guid.entityid);
+  fec->writerSN = ddsi_to_seqno (seq);
+  fec->fragmentStartingNum = fragnum + 1; /* network format is 1 based */
+  fec->fragmentsPerBlock = (uint16_t) nfrags_per_block;
+  fec->fragmentSize = gv->config.fragment_size;
+  fec->sampleSize = size;
+  fec->numBlocks = nblocks;
+
+  parity = (unsigned char *) (fec + 1);
+  memset (parity, 0, paddedsize);
+  for (uint32_t b = 0, off = start; b < nblocks && off < size; b++, off += blocksize)
+  {
+    const uint32_t len = (off + blocksize > size) ? size - off : blocksize;
+    uint32_t pos = 0;
+    while (pos < len)
+    {
+      ddsrt_iovec_t iov;
+      struct ddsi_serdata *ref = ddsi_serdata_to_ser_ref (serdata, off + pos, len - pos, &iov);
+      const unsigned char *src = iov.iov_base;
+      const uint32_t n = ((uint32_t) iov.iov_len < len - pos) ? (uint32_t) iov.iov_len : len - pos;
+      for (uint32_t k = 0; k < n; k++)
+        parity[pos + k] ^= src[k];
+      ddsi_serdata_to_ser_unref (ref, &iov);
+      if (n == 0)
+        break;
+      pos += n;
+    }
+  }
+  ddsi_xmsg_submsg_setnext (*pmsg, sm_marker);
+}
+
 dds_return_t ddsi_write_hb_liveliness (struct ddsi_domaingv * const gv, struct ddsi_guid *wr_guid, struct ddsi_xpack *xp)
 {
   struct ddsi_xmsg *msg = NULL;
@@ -786,10 +866,20 @@ static void transmit_sample_lgmsg_unlocks_wr (struct ddsi_xpack *xp, struct ddsi
     nf_in_submsg = 1;
   else if (nf_in_submsg > UINT16_MAX)
     nf_in_submsg = UINT16_MAX;
+  /* Forward error correction: one parity submessage per FecGroupSize DATA_FRAGs of the
+     initial multicast of a sample.  Readers can use it to reconstruct one lost DATA_FRAG
+     without a NACKFRAG/retransmit round trip.  Security plugins transform the payload or
+     the submessage, which rules out the simple XOR. */
+  const uint32_t fec_group_size = wr->e.gv->config.fec_group_size;
+  const uint32_t nf_per_block = nf_in_submsg;
+  const bool use_fec = (fec_group_size > 1 && isnew && prd == NULL && nf_per_block < nfrags &&
+                        !ddsi_omg_writer_is_submessage_protected (wr) && !ddsi_omg_writer_is_payload_protected (wr));
+  uint32_t fec_group_start = 0;
   for (uint32_t i = 0; i < nfrags_lim; i += nf_in_submsg)
   {
     struct ddsi_xmsg *fmsg = NULL;
     struct ddsi_xmsg *hmsg = NULL;
+    struct ddsi_xmsg *pmsg = NULL;
     int ret;
 #if 0
     if (must_skip_frag (frags_to_skip, i))
@@ -809,9 +899,23 @@ static void transmit_sample_lgmsg_unlocks_wr (struct ddsi_xpack *xp, struct ddsi
       // more fragment messages to come
       create_HeartbeatFrag (wr, seq, i + nf_in_submsg - 1, prd, &hmsg);
     }
+    if (use_fec)
+    {
+      /* only full-sized blocks, except the one at the end of the sample, because that is
+         what the FEC submessage describes */
+      const uint32_t end = i + nf_in_submsg;
+      const uint32_t nblocks = (end - fec_group_start + nf_per_block - 1) / nf_per_block;
+      if (end == nfrags || (nblocks == fec_group_size && end - fec_group_start == nblocks * nf_per_block))
+      {
+        if (nblocks >= 2)
+          create_fec_parity (wr, seq, serdata, fec_group_start, nf_per_block, nblocks, &pmsg);
+        fec_group_start = end;
+      }
+    }
     ddsrt_mutex_unlock (&wr->e.lock);
 
     if(fmsg) ddsi_xpack_addmsg (xp, fmsg, 0);
+    if(pmsg) ddsi_xpack_addmsg (xp, pmsg, 0);
     if(hmsg) ddsi_xpack_addmsg (xp, hmsg, 0);
 
     ddsrt_mutex_lock (&wr->e.lock);
@@ -868,12 +972,15 @@ void ddsi_enqueue_spdp_sample_wrlock_held (struct ddsi_writer *wr, ddsi_seqno_t
     ddsi_qxev_msg (wr->evq, msg);
 }
 
-int ddsi_enqueue_sample_wrlock_held (struct ddsi_writer *wr, ddsi_seqno_t seq, struct ddsi_serdata *serdata, struct ddsi_proxy_reader *prd, int isnew)
+static int enqueue_sample_wrlock_held (struct ddsi_writer *wr, ddsi_seqno_t seq, struct ddsi_serdata *serdata, struct ddsi_proxy_reader *prd, int isnew, bool *incomplete)
 {
+  /* *incomplete is set if some of the messages couldn't be created, which doesn't affect
+     the result: that only reports whether the retransmit queue dropped it */
   struct ddsi_domaingv const * const gv = wr->e.gv;
   uint32_t i, sz, nfrags;
   enum ddsi_qxev_msg_rexmit_result enqueued = DDSI_QXEV_MSG_REXMIT_QUEUED;
 
+  *incomplete = false;
   ASSERT_MUTEX_HELD (&wr->e.lock);
 
   sz = ddsi_serdata_size (serdata);
@@ -898,6 +1005,10 @@ int ddsi_enqueue_sample_wrlock_held (struct ddsi_writer *wr, ddsi_seqno_t seq, s
       if (nfrags > 1 && i + 1 < nfrags)
         create_HeartbeatFrag (wr, seq, i, prd, &hmsg);
     }
+    else
+    {
+      *incomplete = true;
+    }
     if (isnew)
     {
       if(fmsg) ddsi_qxev_msg (wr->evq, fmsg);
@@ -931,7 +1042,13 @@ int ddsi_enqueue_sample_wrlock_held (struct ddsi_writer *wr, ddsi_seqno_t seq, s
   return (enqueued != DDSI_QXEV_MSG_REXMIT_DROPPED) ? 0 : -1;
 }
 
-static int insert_sample_in_whc (struct ddsi_writer *wr, ddsi_seqno_t seq, struct ddsi_serdata *serdata, struct ddsi_tkmap_instance *tk)
+int ddsi_enqueue_sample_wrlock_held (struct ddsi_writer *wr, ddsi_seqno_t seq, struct ddsi_serdata *serdata, struct ddsi_proxy_reader *prd, int isnew)
+{
+  bool incomplete;
+  return enqueue_sample_wrlock_held (wr, seq, serdata, prd, isnew, &incomplete);
+}
+
+static int insert_sample_in_whc (struct ddsi_writer *wr, ddsi_seqno_t seq, struct ddsi_serdata *serdata, struct ddsi_serdata *wire_serdata, struct ddsi_tkmap_instance *tk)
 {
   /* returns: < 0 on error, 0 if no need to insert in whc, > 0 if inserted */
   int insres, res = 0;
@@ -970,7 +1087,7 @@ static int insert_sample_in_whc (struct ddsi_writer *wr, ddsi_seqno_t seq, struc
     if (wr->xqos->lifespan.duration != DDS_INFINITY && (serdata->statusinfo & (DDSI_STATUSINFO_UNREGISTER | DDSI_STATUSINFO_DISPOSE)) == 0)
       exp = ddsrt_mtime_add_duration(serdata->twrite, wr->xqos->lifespan.duration);
 #endif
-    res = ((insres = ddsi_whc_insert (wr->whc, ddsi_writer_max_drop_seq (wr), seq, exp, serdata, tk)) < 0) ? insres : 1;
+    res = ((insres = ddsi_whc_insert (wr->whc, ddsi_writer_max_drop_seq (wr), seq, exp, serdata, wire_serdata, tk)) < 0) ? insres : 1;
 
 #ifdef DDS_HAS_DEADLINE_MISSED
     if (!(wr->reliable && have_reliable_subs (wr)) && !wr->handle_as_transient_local)
@@ -1139,6 +1256,7 @@ int ddsi_write_sample_p2p_wrlock_held(struct ddsi_writer *wr, ddsi_seqno_t seq,
   struct ddsi_wr_prd_match *wprd = NULL;
   ddsi_seqno_t gseq;
   struct ddsi_xmsg *gap = NULL;
+  struct ddsi_serdata *wire_serdata;
 
   tnow = ddsrt_time_monotonic ();
   serdata->twrite = tnow;
@@ -1179,9 +1297,10 @@ int ddsi_write_sample_p2p_wrlock_held(struct ddsi_writer *wr, ddsi_seqno_t seq,
     }
   }
 
-  if ((r = insert_sample_in_whc (wr, seq, serdata, tk)) >= 0)
+  wire_serdata = ddsi_writer_wire_serdata (wr, serdata);
+  if ((r = insert_sample_in_whc (wr, seq, serdata, wire_serdata, tk)) >= 0)
   {
-    ddsi_enqueue_sample_wrlock_held (wr, seq, serdata, prd, 1);
+    ddsi_enqueue_sample_wrlock_held (wr, seq, wire_serdata, prd, 1);
 
     if (gap)
       ddsi_qxev_msg (wr->evq, gap);
@@ -1193,11 +1312,68 @@ int ddsi_write_sample_p2p_wrlock_held(struct ddsi_writer *wr, ddsi_seqno_t seq,
   {
     ddsi_xmsg_free (gap);
   }
+  ddsi_serdata_unref (wire_serdata);
 
 prd_is_deleting:
   return r;
 }
 
+static bool transmit_filtered_sample_wrlock_held (struct ddsi_writer *wr, ddsi_seqno_t seq, struct ddsi_serdata *serdata, struct ddsi_serdata *wire_serdata, struct ddsi_tkmap_instance *tk)
+{
+  /* Evaluates the content filters and instance shards of the matched proxy readers and,
+     if at most half of the readers accept the sample, sends it only to those.  Reliable
+     readers that reject it get a GAP right away rather than having to ask for it after
+     the next heartbeat.  Returns false if the sample should be sent in the usual way
+     (readers filter on receipt anyway), which is also what happens until all readers have
+     responded to a heartbeat, because a reader that has yet to synchronise with the writer
+     drops the data and may subsequently skip it. */
+  struct ddsi_domaingv * const gv = wr->e.gv;
+  ASSERT_MUTEX_HELD (&wr->e.lock);
+  if (wr->num_readers_filtered == 0)
+    return false;
+
+  uint32_t naccept = 0;
+  ddsrt_avl_iter_t it;
+  for (struct ddsi_wr_prd_match *m = ddsrt_avl_iter_first (&ddsi_wr_readers_treedef, &wr->readers, &it); m; m = ddsrt_avl_iter_next (&it))
+  {
+    if (!m->has_replied_to_hb)
+      return false;
+    m->accepts_sample = ddsi_wr_prd_match_accepts_sample (gv, m, serdata, tk);
+    naccept += m->accepts_sample;
+  }
+  if (naccept > wr->num_readers / 2)
+    return false;
+
+  /* If a directed message can't be queued, the usual path sends it to all of them: the
+     readers that already got it drop the duplicate, and this way no reader is left with
+     a GAP for a sample it accepts */
+  for (const struct ddsi_wr_prd_match *m = ddsrt_avl_iter_first (&ddsi_wr_readers_treedef, &wr->readers, &it); m; m = ddsrt_avl_iter_next (&it))
+  {
+    struct ddsi_proxy_reader *prd;
+    if (m->accepts_sample && (prd = ddsi_entidx_lookup_proxy_reader_guid (gv->entity_index, &m->prd_guid)) != NULL)
+    {
+      bool incomplete;
+      if (enqueue_sample_wrlock_held (wr, seq, wire_serdata, prd, 1, &incomplete) < 0 || incomplete)
+        return false;
+    }
+  }
+  for (const struct ddsi_wr_prd_match *m = ddsrt_avl_iter_first (&ddsi_wr_readers_treedef, &wr->readers, &it); m; m = ddsrt_avl_iter_next (&it))
+  {
+    struct ddsi_proxy_reader *prd;
+    if (!m->accepts_sample && m->is_reliable && (prd = ddsi_entidx_lookup_proxy_reader_guid (gv->entity_index, &m->prd_guid)) != NULL)
+    {
+      struct ddsi_gap_info gi;
+      struct ddsi_xmsg *gap;
+      ddsi_gap_info_init (&gi);
+      ddsi_gap_info_update (gv, &gi, seq);
+      if ((gap = ddsi_gap_info_create_gap (wr, prd, &gi)) != NULL)
+        ddsi_qxev_msg (wr->evq, gap);
+    }
+  }
+  ddsi_writer_update_seq_xmit (wr, seq);
+  return true;
+}
+
 static int write_sample (struct ddsi_thread_state * const thrst, struct ddsi_xpack *xp, struct ddsi_writer *wr, struct ddsi_serdata *serdata, struct ddsi_tkmap_instance *tk, int gc_allowed)
 {
   struct ddsi_domaingv const * const gv = wr->e.gv;
@@ -1205,6 +1381,8 @@ static int write_sample (struct ddsi_thread_state * const thrst, struct ddsi_xpa
   ddsi_seqno_t seq;
   ddsrt_mtime_t tnow;
   struct ddsi_lease *lease;
+  struct ddsi_serdata *wire_serdata = NULL;
+  struct ddsi_whc_node *deferred_free_list = NULL;
 
   /* If GC not allowed, we must be sure to never block when writing.  That is only the case for (true, aggressive) KEEP_LAST writers, and also only if there is no limit to how much unacknowledged data the WHC may contain. */
   assert (gc_allowed || (wr->xqos->history.kind == DDS_HISTORY_KEEP_LAST && wr->whc_low == INT32_MAX));
@@ -1229,6 +1407,11 @@ static int write_sample (struct ddsi_thread_state * const thrst, struct ddsi_xpa
   else if (wr->xqos->liveliness.kind == DDS_LIVELINESS_MANUAL_BY_TOPIC && wr->lease != NULL)
     ddsi_lease_renew (wr->lease, ddsrt_time_elapsed());
 
+  /* Compressing is the expensive part, so it is done before taking the lock.  Whether the
+     compressed form is used depends on the readers and is decided once: the WHC retains
+     it, so retransmits are always identical to the original transmission */
+  wire_serdata = ddsi_writer_compress_serdata (wr, serdata);
+
   ddsrt_mutex_lock (&wr->e.lock);
 
   if (!wr->alive)
@@ -1237,7 +1420,13 @@ static int write_sample (struct ddsi_thread_state * const thrst, struct ddsi_xpa
   /* If WHC overfull, block. */
   {
     struct ddsi_whc_state whcst;
-    ddsi_whc_get_state(wr->whc, &whcst);
+    if (!wr->nack_only)
+      ddsi_whc_get_state(wr->whc, &whcst);
+    else
+    {
+      /* expired samples are freed once the writer lock has been released */
+      (void) ddsi_writer_nack_only_expire (wr, ddsrt_time_monotonic (), &whcst, &deferred_free_list);
+    }
     if (whcst.unacked_bytes > wr->whc_high)
     {
       dds_return_t ores;
@@ -1271,9 +1460,15 @@ static int write_sample (struct ddsi_thread_state * const thrst, struct ddsi_xpa
   /* Always use the current monotonic time */
   tnow = ddsrt_time_monotonic ();
   serdata->twrite = tnow;
+  if (wire_serdata != serdata && wr->num_readers_foreign_vendor > 0)
+  {
+    ddsi_serdata_unref (wire_serdata);
+    wire_serdata = ddsi_serdata_ref (serdata);
+  }
+  wire_serdata->twrite = tnow;
 
   seq = ++wr->seq;
-  if ((r = insert_sample_in_whc (wr, seq, serdata, tk)) < 0)
+  if ((r = insert_sample_in_whc (wr, seq, serdata, wire_serdata, tk)) < 0)
   {
     /* Failure of some kind */
     ddsrt_mutex_unlock (&wr->e.lock);
@@ -1295,6 +1490,12 @@ static int write_sample (struct ddsi_thread_state * const thrst, struct ddsi_xpa
     ddsi_writer_update_seq_xmit (wr, seq);
     ddsrt_mutex_unlock (&wr->e.lock);
   }
+  else if (transmit_filtered_sample_wrlock_held (wr, seq, serdata, wire_serdata, tk))
+  {
+    if (wr->heartbeat_xevent)
+      ddsi_writer_hbcontrol_note_asyncwrite (wr, tnow);
+    ddsrt_mutex_unlock (&wr->e.lock);
+  }
   else
   {
     /* Note the subtlety of enqueueing with the lock held but
@@ -1310,7 +1511,7 @@ static int write_sample (struct ddsi_thread_state * const thrst, struct ddsi_xpa
         ddsi_whc_get_state(wr->whc, &whcst);
         whcstptr = &whcst;
       }
-      transmit_sample_unlocks_wr (xp, wr, whcstptr, seq, serdata, NULL, 1);
+      transmit_sample_unlocks_wr (xp, wr, whcstptr, seq, wire_serdata, NULL, 1);
     }
     else
     {
@@ -1319,13 +1520,17 @@ static int write_sample (struct ddsi_thread_state * const thrst, struct ddsi_xpa
       if (wr->e.guid.entityid.u == DDSI_ENTITYID_SPDP_BUILTIN_PARTICIPANT_WRITER)
         ddsi_enqueue_spdp_sample_wrlock_held(wr, seq, serdata, NULL);
       else
-        ddsi_enqueue_sample_wrlock_held (wr, seq, serdata, NULL, 1);
+        ddsi_enqueue_sample_wrlock_held (wr, seq, wire_serdata, NULL, 1);
       ddsrt_mutex_unlock (&wr->e.lock);
     }
   }
 
 drop:
+  if (deferred_free_list)
+    ddsi_whc_free_deferred_free_list (wr->whc, deferred_free_list);
   /* FIXME: shouldn't I move the ddsi_serdata_unref call to the callers? */
+  if (wire_serdata)
+    ddsi_serdata_unref (wire_serdata);
   ddsi_serdata_unref (serdata);
   return r;
 }
@@ -239,6 +239,81 @@ void ddsi_typemap_fini (ddsi_typemap_t *typemap)
   dds_stream_free_sample (typemap, DDS_XTypes_TypeMapping_desc.m_ops);
 }
 
+static const struct DDS_XTypes_CompleteTypeObject *typemap_complete_typeobj (const ddsi_typemap_t *typemap, const struct DDS_XTypes_TypeIdentifier *type_id)
+{
+  const struct DDS_XTypes_TypeObject *tobj;
+  while ((tobj = ddsi_typemap_typeobj (typemap, type_id)) != NULL && tobj->_d == DDS_XTypes_EK_COMPLETE)
+  {
+    if (tobj->_u.complete._d != DDS_XTypes_TK_ALIAS)
+      return &tobj->_u.complete;
+    type_id = &tobj->_u.complete._u.alias_type.body.common.related_type;
+  }
+  return NULL;
+}
+
+static dds_return_t typemap_resolve_member (const ddsi_typemap_t *typemap, const struct DDS_XTypes_TypeIdentifier *type_id, const char *name, uint32_t max_depth, uint32_t *depth, uint32_t *index, uint32_t *member_id, const struct DDS_XTypes_TypeIdentifier **member_type_id)
+{
+  *depth = 0;
+  while (true)
+  {
+    const struct DDS_XTypes_CompleteTypeObject *tobj = typemap_complete_typeobj (typemap, type_id);
+    if (tobj == NULL || tobj->_d != DDS_XTypes_TK_STRUCTURE || *depth == max_depth)
+      return DDS_RETCODE_BAD_PARAMETER;
+    const DDS_XTypes_CompleteStructType *st = &tobj->_u.struct_type;
+    if (!ddsi_typeid_is_none_impl (&st->header.base_type))
+      return DDS_RETCODE_UNSUPPORTED;
+    const char *sep = strchr (name, '.');
+    const size_t len = sep ? (size_t) (sep - name) : strlen (name);
+    uint32_t i;
+    for (i = 0; i < st->member_seq._length; i++)
+    {
+      const DDS_XTypes_CompleteStructMember *m = &st->member_seq._buffer[i];
+      if (strncmp (m->detail.name, name, len) == 0 && m->detail.name[len] == 0)
+        break;
+    }
+    if (i == st->member_seq._length)
+      return DDS_RETCODE_BAD_PARAMETER;
+    index[*depth] = i;
+    member_id[*depth] = st->member_seq._buffer[i].common.member_id;
+    type_id = &st->member_seq._buffer[i].common.member_type_id;
+    (*depth)++;
+    if (sep == NULL)
+    {
+      *member_type_id = type_id;
+      return DDS_RETCODE_OK;
+    }
+    name = sep + 1;
+  }
+}
+
+dds_return_t ddsi_typemap_resolve_member (const ddsi_typemap_t *typemap, const ddsi_typeid_t *type_id, const char *name, uint32_t max_depth, uint32_t *depth, uint32_t *index, uint32_t *member_id)
+{
+  const struct DDS_XTypes_TypeIdentifier *member_type_id;
+  return typemap_resolve_member (typemap, &type_id->x, name, max_depth, depth, index, member_id, &member_type_id);
+}
+
+dds_return_t ddsi_typemap_resolve_enum_literal (const ddsi_typemap_t *typemap, const ddsi_typeid_t *type_id, const char *name, const char *literal, int32_t *value)
+{
+  const struct DDS_XTypes_TypeIdentifier *member_type_id;
+  uint32_t depth, index[DDS_CDRSTREAM_MAX_NESTING_DEPTH], member_id[DDS_CDRSTREAM_MAX_NESTING_DEPTH];
+  dds_return_t ret;
+  if ((ret = typemap_resolve_member (typemap, &type_id->x, name, DDS_CDRSTREAM_MAX_NESTING_DEPTH, &depth, index, member_id, &member_type_id)) != DDS_RETCODE_OK)
+    return ret;
+  const struct DDS_XTypes_CompleteTypeObject *tobj = typemap_complete_typeobj (typemap, member_type_id);
+  if (tobj == NULL || tobj->_d != DDS_XTypes_TK_ENUM)
+    return DDS_RETCODE_BAD_PARAMETER;
+  const DDS_XTypes_CompleteEnumeratedLiteralSeq *lits = &tobj->_u.enumerated_type.literal_seq;
+  for (uint32_t i = 0; i < lits->_length; i++)
+  {
+    if (strcmp (lits->_buffer[i].detail.name, literal) == 0)
+    {
+      *value = lits->_buffer[i].common.value;
+      return DDS_RETCODE_OK;
+    }
+  }
+  return DDS_RETCODE_BAD_PARAMETER;
+}
+
 static bool ti_to_pairs_equal (const dds_sequence_DDS_XTypes_TypeIdentifierTypeObjectPair *a, const dds_sequence_DDS_XTypes_TypeIdentifierTypeObjectPair *b)
 {
   if (a->_length != b->_length)
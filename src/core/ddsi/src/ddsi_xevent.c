@@ -726,6 +726,7 @@ static void handle_xevk_heartbeat (struct ddsi_xpack *xp, struct ddsi_xevent *ev
   ddsrt_mtime_t t_next;
   int hbansreq = 0;
   struct ddsi_whc_state whcst;
+  struct ddsi_whc_node *deferred_free_list = NULL;
 
   if ((wr = ddsi_entidx_lookup_writer_guid (gv->entity_index, &ev->u.heartbeat.wr_guid)) == NULL)
   {
@@ -743,7 +744,10 @@ static void handle_xevk_heartbeat (struct ddsi_xpack *xp, struct ddsi_xevent *ev
 
   ddsrt_mutex_lock (&wr->e.lock);
   assert (wr->reliable);
-  ddsi_whc_get_state(wr->whc, &whcst);
+  if (!wr->nack_only)
+    ddsi_whc_get_state(wr->whc, &whcst);
+  else
+    (void) ddsi_writer_nack_only_expire (wr, tnow, &whcst, &deferred_free_list);
   if (!ddsi_writer_must_have_hb_scheduled (wr, &whcst))
   {
     hbansreq = 1; /* just for trace */
@@ -786,6 +790,8 @@ static void handle_xevk_heartbeat (struct ddsi_xpack *xp, struct ddsi_xevent *ev
   (void) ddsi_resched_xevent_if_earlier (ev, t_next);
   wr->hbcontrol.tsched = t_next;
   ddsrt_mutex_unlock (&wr->e.lock);
+  if (deferred_free_list)
+    ddsi_whc_free_deferred_free_list (wr->whc, deferred_free_list);
 
   /* Can't transmit synchronously with writer lock held: trying to add
      the heartbeat to the xp may cause xp to be sent out, which may
@@ -863,6 +869,8 @@ static struct ddsi_xmsg *make_preemptive_acknack (struct ddsi_xevent *ev, struct
   ddsi_security_encode_datareader_submsg (msg, sm_marker, pwr, &rwn->rd_guid);
 
   rwn->t_last_ack = tnow;
+  if (gv->config.adaptive_timing_enable)
+    rwn->t_rtt_probe = tnow;
   const dds_duration_t new_intv = preemptive_acknack_interval (rwn);
   (void) ddsi_resched_xevent_if_earlier (ev, ddsrt_mtime_add_duration (rwn->t_last_ack, new_intv));
 
@@ -371,6 +371,7 @@ static int submsg_is_compatible (const struct ddsi_xmsg *msg, ddsi_rtps_submessa
         case DDSI_RTPS_SMID_HEARTBEAT_FRAG:
         case DDSI_RTPS_SMID_ADLINK_MSG_LEN:
         case DDSI_RTPS_SMID_ADLINK_ENTITY_ID:
+        case DDSI_RTPS_SMID_ADLINK_FEC:
           /* normal control stuff is ok */
           return 1;
         case DDSI_RTPS_SMID_DATA: case DDSI_RTPS_SMID_DATA_FRAG:
@@ -419,6 +420,7 @@ static int submsg_is_compatible (const struct ddsi_xmsg *msg, ddsi_rtps_submessa
         case DDSI_RTPS_SMID_HEARTBEAT_FRAG:
         case DDSI_RTPS_SMID_ADLINK_MSG_LEN:
         case DDSI_RTPS_SMID_ADLINK_ENTITY_ID:
+        case DDSI_RTPS_SMID_ADLINK_FEC:
           /* anything else is strictly verboten */
           return 0;
       }
@@ -634,15 +636,58 @@ void ddsi_xmsg_shrink (struct ddsi_xmsg *m, struct ddsi_xmsg_marker marker, size
   m->sz = marker.offset + sz;
 }
 
+/* Pre-encoded INFO_TS and DATA submessage headers.  The RTPS header, INFO_SRC and
+   INFO_DST are initialised once in the xpack and xmsg and only have their GUID prefixes
+   patched; for a small sample these two are the only other fixed-size parts of the
+   message, so starting from a template leaves only a handful of fields to fill in. */
+struct ddsi_xmsg_ts_data {
+  ddsi_rtps_info_ts_t ts;
+  ddsi_rtps_data_t data;
+};
+
+static const struct ddsi_xmsg_ts_data ts_data_template = {
+  .ts = {
+    .smhdr = { DDSI_RTPS_SMID_INFO_TS, (DDSRT_ENDIAN == DDSRT_LITTLE_ENDIAN ? DDSI_RTPS_SUBMESSAGE_FLAG_ENDIANNESS : 0), sizeof (ddsi_time_t) },
+    .time = { 0, 0 }
+  },
+  .data = { .x = {
+    .smhdr = { DDSI_RTPS_SMID_DATA, (DDSRT_ENDIAN == DDSRT_LITTLE_ENDIAN ? DDSI_RTPS_SUBMESSAGE_FLAG_ENDIANNESS : 0), 0 },
+    .extraFlags = 0,
+    .octetsToInlineQos = sizeof (ddsi_rtps_data_t) - offsetof (ddsi_rtps_data_datafrag_common_t, readerId),
+    .readerId = { 0 },
+    .writerId = { 0 },
+    .writerSN = { 0, 0 }
+  } }
+};
+
 void ddsi_xmsg_add_timestamp (struct ddsi_xmsg *m, ddsrt_wctime_t t)
 {
   ddsi_rtps_info_ts_t * ts;
   struct ddsi_xmsg_marker sm;
 
+  assert (submsg_is_compatible (m, DDSI_RTPS_SMID_INFO_TS));
   ts = (ddsi_rtps_info_ts_t*) ddsi_xmsg_append (m, &sm, sizeof (ddsi_rtps_info_ts_t));
-  ddsi_xmsg_submsg_init (m, sm, DDSI_RTPS_SMID_INFO_TS);
+  *ts = ts_data_template.ts;
   ts->time = ddsi_wctime_to_ddsi_time (t);
-  ddsi_xmsg_submsg_setnext (m, sm);
+}
+
+ddsi_rtps_data_t *ddsi_xmsg_append_timestamp_data (struct ddsi_xmsg *m, struct ddsi_xmsg_marker *sm_marker, ddsrt_wctime_t t, unsigned char flags, ddsi_entityid_t readerId, ddsi_entityid_t writerId, ddsi_seqno_t seq)
+{
+  struct ddsi_xmsg_ts_data *tsd;
+  struct ddsi_xmsg_marker sm;
+
+  DDSRT_STATIC_ASSERT (sizeof (struct ddsi_xmsg_ts_data) == sizeof (ddsi_rtps_info_ts_t) + sizeof (ddsi_rtps_data_t));
+  assert (submsg_is_compatible (m, DDSI_RTPS_SMID_INFO_TS));
+  assert (submsg_is_compatible (m, DDSI_RTPS_SMID_DATA));
+  tsd = ddsi_xmsg_append (m, &sm, sizeof (*tsd));
+  *tsd = ts_data_template;
+  tsd->ts.time = ddsi_wctime_to_ddsi_time (t);
+  tsd->data.x.smhdr.flags = (unsigned char) (tsd->data.x.smhdr.flags | flags);
+  tsd->data.x.readerId = ddsi_hton_entityid (readerId);
+  tsd->data.x.writerId = ddsi_hton_entityid (writerId);
+  tsd->data.x.writerSN = ddsi_to_seqno (seq);
+  sm_marker->offset = sm.offset + offsetof (struct ddsi_xmsg_ts_data, data);
+  return &tsd->data;
 }
 
 void ddsi_xmsg_add_entityid (struct ddsi_xmsg * m)
@@ -1563,23 +1608,26 @@ int ddsi_xpack_addmsg (struct ddsi_xpack *xp, struct ddsi_xmsg *m, const uint32_
      But do make sure we can't run out of iovecs. */
   assert (niov + DDSI_XMSG_MAX_SUBMESSAGE_IOVECS <= DDSI_XMSG_MAX_MESSAGE_IOVECS);
 
-  GVTRACE ("xpack_addmsg %p %p %"PRIu32"(", (void *) xp, (void *) m, flags);
-  switch (m->kind)
+  if (gv->logconfig.c.mask & DDS_LC_TRACE)
   {
-    case DDSI_XMSG_KIND_CONTROL:
-      GVTRACE ("control");
-      break;
-    case DDSI_XMSG_KIND_DATA:
-    case DDSI_XMSG_KIND_DATA_REXMIT:
-    case DDSI_XMSG_KIND_DATA_REXMIT_NOMERGE:
-      GVTRACE ("%s("PGUIDFMT":#%"PRId64"/%"PRIu32")",
-               (m->kind == DDSI_XMSG_KIND_DATA) ? "data" : "rexmit",
-               PGUID (m->kindspecific.data.wrguid),
-               m->kindspecific.data.wrseq,
-               m->kindspecific.data.wrfragid + 1);
-      break;
+    GVTRACE ("xpack_addmsg %p %p %"PRIu32"(", (void *) xp, (void *) m, flags);
+    switch (m->kind)
+    {
+      case DDSI_XMSG_KIND_CONTROL:
+        GVTRACE ("control");
+        break;
+      case DDSI_XMSG_KIND_DATA:
+      case DDSI_XMSG_KIND_DATA_REXMIT:
+      case DDSI_XMSG_KIND_DATA_REXMIT_NOMERGE:
+        GVTRACE ("%s("PGUIDFMT":#%"PRId64"/%"PRIu32")",
+                 (m->kind == DDSI_XMSG_KIND_DATA) ? "data" : "rexmit",
+                 PGUID (m->kindspecific.data.wrguid),
+                 m->kindspecific.data.wrseq,
+                 m->kindspecific.data.wrfragid + 1);
+        break;
+    }
+    GVTRACE ("): niov %d sz %"PRIuSIZE, (int) niov, sz);
   }
-  GVTRACE ("): niov %d sz %"PRIuSIZE, (int) niov, sz);
 
   /* If a fresh xp has been provided, add an RTPS header */
 
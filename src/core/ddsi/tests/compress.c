@@ -0,0 +1,89 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include <string.h>
+
+#include "CUnit/Theory.h"
+#include "dds/ddsrt/heap.h"
+#include "dds/ddsrt/random.h"
+#include "ddsi__compress.h"
+
+static void roundtrip (const unsigned char *src, size_t srcsize, bool expect_smaller)
+{
+  const size_t dstsize = srcsize + srcsize / 255 + 16;
+  unsigned char *dst = ddsrt_malloc (dstsize);
+  unsigned char *chk = ddsrt_malloc (srcsize + 1);
+  const size_t csize = ddsi_lz_compress (dst, dstsize, src, srcsize);
+  CU_ASSERT_FATAL (csize > 0);
+  if (expect_smaller)
+    CU_ASSERT (csize < srcsize);
+  CU_ASSERT_FATAL (ddsi_lz_decompress (chk, srcsize, dst, csize));
+  CU_ASSERT (memcmp (chk, src, srcsize) == 0);
+  // compressing is deterministic
+  unsigned char *dst2 = ddsrt_malloc (dstsize);
+  CU_ASSERT_FATAL (ddsi_lz_compress (dst2, dstsize, src, srcsize) == csize);
+  CU_ASSERT (memcmp (dst, dst2, csize) == 0);
+  // trailing padding is ignored, truncation and a wrong size are detected
+  memset (dst2, 0, dstsize);
+  memcpy (dst2, dst, csize);
+  CU_ASSERT (ddsi_lz_decompress (chk, srcsize, dst2, csize + 3));
+  CU_ASSERT (!ddsi_lz_decompress (chk, srcsize, dst, csize - 1));
+  CU_ASSERT (!ddsi_lz_decompress (chk, srcsize + 1, dst, csize));
+  // output buffer too small for the compressed data
+  CU_ASSERT (ddsi_lz_compress (dst2, csize - 1, src, srcsize) == 0);
+  ddsrt_free (dst2);
+  ddsrt_free (chk);
+  ddsrt_free (dst);
+}
+
+CU_Test (ddsi_compress, roundtrip)
+{
+  const size_t size = 100000;
+  unsigned char *buf = ddsrt_malloc (size);
+
+  // runs of a single byte: overlapping matches and long match lengths
+  memset (buf, 'a', size);
+  roundtrip (buf, size, true);
+
+  // a short repeating pattern with some structure, like an array of structs
+  for (size_t i = 0; i < size; i++)
+    buf[i] = (unsigned char) ((i % 12) < 4 ? (i / 12) : (i % 7));
+  roundtrip (buf, size, true);
+
+  // random data: no matches, long literal runs
+  for (size_t i = 0; i < size; i++)
+    buf[i] = (unsigned char) ddsrt_random ();
+  roundtrip (buf, size, false);
+
+  // tiny inputs, all literals
+  roundtrip (buf, 1, false);
+  roundtrip (buf, 5, false);
+  ddsrt_free (buf);
+}
+
+CU_Test (ddsi_compress, malformed)
+{
+  unsigned char out[16];
+  // match offset pointing before the start of the output
+  const unsigned char bad_offset[] = { 0x10, 'x', 0x02, 0x00 };
+  CU_ASSERT (!ddsi_lz_decompress (out, sizeof (out), bad_offset, sizeof (bad_offset)));
+  // zero offset
+  const unsigned char zero_offset[] = { 0x10, 'x', 0x00, 0x00 };
+  CU_ASSERT (!ddsi_lz_decompress (out, sizeof (out), zero_offset, sizeof (zero_offset)));
+  // literals extending past the end of the input
+  const unsigned char short_literals[] = { 0x40, 'x', 'y' };
+  CU_ASSERT (!ddsi_lz_decompress (out, 4, short_literals, sizeof (short_literals)));
+  // match extending past the end of the output
+  const unsigned char long_match[] = { 0x1f, 'x', 0x01, 0x00, 0x00 };
+  CU_ASSERT (!ddsi_lz_decompress (out, sizeof (out), long_match, sizeof (long_match)));
+  // empty input
+  CU_ASSERT (!ddsi_lz_decompress (out, sizeof (out), long_match, 0));
+}
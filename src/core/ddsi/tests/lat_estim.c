@@ -0,0 +1,45 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include "CUnit/Theory.h"
+#include "dds/ddsrt/time.h"
+#include "ddsi__lat_estim.h"
+
+CU_Test (ddsi_lat_estim, initial)
+{
+  struct ddsi_lat_estim le;
+  ddsi_lat_estim_init (&le);
+  CU_ASSERT (ddsi_lat_estim_current (&le) == 0.0);
+  // non-positive samples are ignored
+  ddsi_lat_estim_update (&le, 0);
+  ddsi_lat_estim_update (&le, -1);
+  CU_ASSERT (ddsi_lat_estim_current (&le) == 0.0);
+  // first sample gives an estimate immediately (in microseconds)
+  ddsi_lat_estim_update (&le, DDS_USECS (250));
+  CU_ASSERT (ddsi_lat_estim_current (&le) > 249.0 && ddsi_lat_estim_current (&le) < 251.0);
+  ddsi_lat_estim_fini (&le);
+}
+
+CU_Test (ddsi_lat_estim, outliers_and_convergence)
+{
+  struct ddsi_lat_estim le;
+  ddsi_lat_estim_init (&le);
+  for (int i = 0; i < 20; i++)
+    ddsi_lat_estim_update (&le, DDS_USECS (100));
+  // a single outlier is removed by the median filter
+  ddsi_lat_estim_update (&le, DDS_SECS (1));
+  CU_ASSERT (ddsi_lat_estim_current (&le) > 99.0 && ddsi_lat_estim_current (&le) < 101.0);
+  // a persistent change is tracked
+  for (int i = 0; i < 100; i++)
+    ddsi_lat_estim_update (&le, DDS_MSECS (10));
+  CU_ASSERT (ddsi_lat_estim_current (&le) > 9900.0 && ddsi_lat_estim_current (&le) < 10100.0);
+  ddsi_lat_estim_fini (&le);
+}
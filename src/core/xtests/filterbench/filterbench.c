@@ -0,0 +1,127 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "dds/dds.h"
+#include "dds/ddsrt/heap.h"
+#include "dds/ddsrt/random.h"
+#include "dds/ddsi/ddsi_serdata.h"
+#include "dds/ddsi/ddsi_sertype.h"
+#include "dds__entity.h"
+#include "dds__topic.h"
+#include "dds__filter_expr.h"
+
+#include "FilterBenchTypes.h"
+
+/* Compares the cost of evaluating a content filter the way the reader history cache
+   does for a filter function (deserialize into a freshly allocated sample, call the
+   function, free the sample) with that of evaluating the equivalent filter expression
+   on the serialized data.  Both have to agree on every sample. */
+
+#define NSAMPLES 64
+#define PAYLOAD_SIZE 1024
+
+static const char *symbols[] = { "ACME", "INITECH", "GLOBEX", "UMBRELLA", "HOOLI", "WAYNE" };
+
+static bool filter_fn (const void *vsample, void *arg)
+{
+  const FilterBenchTypes_Quote *q = vsample;
+  (void) arg;
+  return q->side == FilterBenchTypes_ASK && strchr (q->symbol, 'O') != NULL && q->price >= 50.0 && q->price <= 250.0;
+}
+
+static const char *filter_expression = "side = 'ASK' AND symbol LIKE '%O%' AND price BETWEEN %0 AND %1";
+static const char *filter_params[] = { "50", "250" };
+
+int main (int argc, char **argv)
+{
+  uint32_t iterations = 100000;
+  if (argc > 1)
+    iterations = (uint32_t) atoi (argv[1]);
+
+  const dds_entity_t pp = dds_create_participant (DDS_DOMAIN_DEFAULT, NULL, NULL);
+  if (pp < 0)
+    return 1;
+  const dds_entity_t topic = dds_create_topic (pp, &FilterBenchTypes_Quote_desc, "FilterBenchTypes_Quote", NULL, NULL);
+  if (topic < 0)
+    return 1;
+  struct dds_topic *tp;
+  if (dds_topic_pin (topic, &tp) != DDS_RETCODE_OK)
+    return 1;
+  struct ddsi_sertype * const type = tp->m_stype;
+
+  struct dds_filter_expr *expr;
+  dds_return_t rc;
+  if ((rc = dds_filter_expr_compile (&expr, type, filter_expression, 2, filter_params)) != DDS_RETCODE_OK)
+  {
+    fprintf (stderr, "compiling filter expression failed: %s\n", dds_strretcode (rc));
+    return 1;
+  }
+
+  ddsrt_prng_t prng;
+  ddsrt_prng_init_simple (&prng, 314159265);
+  struct ddsi_serdata *sds[NSAMPLES];
+  uint8_t *payload = ddsrt_calloc (1, PAYLOAD_SIZE);
+  uint32_t naccept = 0;
+  for (uint32_t i = 0; i < NSAMPLES; i++)
+  {
+    FilterBenchTypes_Quote q = {
+      .id = (int32_t) i,
+      .symbol = (char *) symbols[ddsrt_prng_random (&prng) % (sizeof (symbols) / sizeof (symbols[0]))],
+      .side = (ddsrt_prng_random (&prng) % 2) ? FilterBenchTypes_ASK : FilterBenchTypes_BID,
+      .price = (double) (ddsrt_prng_random (&prng) % 30000) / 100.0,
+      .volume = (int32_t) (ddsrt_prng_random (&prng) % 1000),
+      .payload = { ._length = PAYLOAD_SIZE, ._maximum = PAYLOAD_SIZE, ._buffer = payload }
+    };
+    sds[i] = ddsi_serdata_from_sample (type, SDK_DATA, &q);
+    const bool fn_accepts = filter_fn (&q, NULL);
+    if (fn_accepts != dds_filter_expr_eval_serdata (expr, sds[i]))
+    {
+      fprintf (stderr, "filter function and expression disagree on sample %"PRIu32"\n", i);
+      return 1;
+    }
+    naccept += fn_accepts;
+  }
+  ddsrt_free (payload);
+
+  uint32_t n = 0;
+  dds_time_t t0 = dds_time ();
+  for (uint32_t it = 0; it < iterations; it++)
+  {
+    struct ddsi_serdata * const sd = sds[it % NSAMPLES];
+    void *tmp = ddsi_sertype_alloc_sample (type);
+    ddsi_serdata_to_sample (sd, tmp, NULL, NULL);
+    n += filter_fn (tmp, NULL);
+    ddsi_sertype_free_sample (type, tmp, DDS_FREE_ALL);
+  }
+  dds_time_t t1 = dds_time ();
+  for (uint32_t it = 0; it < iterations; it++)
+    n += dds_filter_expr_eval_serdata (expr, sds[it % NSAMPLES]);
+  dds_time_t t2 = dds_time ();
+
+  printf ("%"PRIu32" iterations, %"PRIu32"/%d samples accepted (%"PRIu32")\n", iterations, naccept, NSAMPLES, n);
+  if (iterations > 0)
+  {
+    printf ("filter function:   %.1f ns/sample\n", (double) (t1 - t0) / iterations);
+    printf ("filter expression: %.1f ns/sample\n", (double) (t2 - t1) / iterations);
+  }
+
+  for (uint32_t i = 0; i < NSAMPLES; i++)
+    ddsi_serdata_unref (sds[i]);
+  dds_filter_expr_free (expr);
+  dds_topic_unpin (tp);
+  dds_delete (pp);
+  return 0;
+}
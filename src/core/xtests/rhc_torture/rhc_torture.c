@@ -14,6 +14,7 @@
 #include <assert.h>
 #include <string.h>
 #include <inttypes.h>
+#include <limits.h>
 
 #include "dds/ddsrt/heap.h"
 #include "dds/ddsrt/process.h"
@@ -930,6 +931,51 @@ static uint32_t stacktracethread (void *varg)
   return 0;
 }
 
+static void bench_take (struct ddsi_domaingv *gv, int count)
+{
+  /* Many instances with a few samples each, all taken in batches: the cost is dominated
+     by walking the instances and their samples */
+  const int32_t ninst = 10000, depth = MAX_HIST_DEPTH;
+  const uint32_t batch = (uint32_t) (sizeof (rres_iseq) / sizeof (rres_iseq[0]));
+  struct ddsi_tkmap *tkmap = gv->m_tkmap;
+  struct ddsi_proxy_writer *wr = mkwr (0);
+  dds_qos_t rqos;
+  ddsi_xqos_init_empty (&rqos);
+  rqos.present |= DDSI_QP_HISTORY;
+  rqos.history.kind = DDS_HISTORY_KEEP_LAST;
+  rqos.history.depth = depth;
+  ddsi_xqos_mergein_missing (&rqos, &ddsi_default_qos_reader, ~(uint64_t)0);
+  ddsi_thread_state_awake_domain_ok (ddsi_lookup_thread_state ());
+  struct dds_rhc *rhc = dds_rhc_default_new_xchecks (NULL, gv, mdtype, false);
+  dds_rhc_set_qos (rhc, &rqos);
+  ddsi_thread_state_asleep (ddsi_lookup_thread_state ());
+  ddsi_xqos_fini (&rqos);
+
+  dds_duration_t tstore = 0, ttake = 0;
+  int64_t nsamples = 0;
+  for (int round = 0; round < count; round++)
+  {
+    dds_time_t t0 = dds_time ();
+    for (int32_t i = 0; i < depth; i++)
+      for (int32_t k = 0; k < ninst; k++)
+        (void) store (tkmap, rhc, wr, mksample (k, 0), false, false);
+    dds_time_t t1 = dds_time ();
+    int32_t n;
+    ddsi_thread_state_awake_domain_ok (ddsi_lookup_thread_state ());
+    while ((n = dds_rhc_take (rhc, true, rres_ptrs, rres_iseq, batch, DDS_ANY_STATE, 0, NULL)) > 0)
+      nsamples += n;
+    ddsi_thread_state_asleep (ddsi_lookup_thread_state ());
+    dds_time_t t2 = dds_time ();
+    tstore += t1 - t0;
+    ttake += t2 - t1;
+  }
+  if (nsamples > 0)
+    printf ("%"PRId64" bench: %"PRId64" samples in %"PRId32" instances, store %.1f ns/sample, take %.1f ns/sample\n",
+            dds_time (), nsamples, ninst, (double) tstore / (double) nsamples, (double) ttake / (double) nsamples);
+  frhc (rhc);
+  fwr (wr);
+}
+
 int main (int argc, char **argv)
 {
   ddsrt_init ();
@@ -998,6 +1044,14 @@ int main (int argc, char **argv)
     dds_topic_unpin (x);
   }
 
+  if (first < 0)
+  {
+    /* a negative "first" runs only the benchmark, for "count" rounds */
+    printf ("%"PRId64" ************* bench *************\n", dds_time ());
+    bench_take (get_gv (pp), count);
+    first = INT_MAX;
+  }
+
   if (0 >= first)
   {
     struct ddsi_domaingv *gv = get_gv (pp);
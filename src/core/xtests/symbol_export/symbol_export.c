@@ -63,10 +63,12 @@
 #include "dds/ddsc/dds_data_allocator.h"
 #include "dds/ddsc/dds_internal_api.h"
 #include "dds/ddsc/dds_loan_api.h"
+#include "dds/ddsc/dds_view.h"
 #include "dds/ddsc/dds_rhc.h"
 #include "dds/ddsc/dds_statistics.h"
 
 #include "dds/cdr/dds_cdrstream.h"
+#include "dds/cdr/dds_cdrstream_gen.h"
 
 #ifdef DDS_HAS_SHM
 #include "dds/ddsi/ddsi_shm_transport.h"
@@ -147,6 +149,7 @@ int main (int argc, char **argv)
   dds_set_topic_filter_extended (1, ptr);
   dds_get_topic_filter_and_arg (1, ptr, ptr);
   dds_get_topic_filter_extended (1, ptr);
+  dds_set_topic_filter_expression (1, ptr, 0, ptr);
   dds_create_subscriber (1, ptr, ptr);
   dds_create_publisher (1, ptr, ptr);
   dds_suspend (1);
@@ -201,6 +204,12 @@ int main (int argc, char **argv)
   dds_readcdr_instance (1, ptr, 0, ptr, 1, 0);
   dds_takecdr (1, ptr, 0, ptr, 0);
   dds_takecdr_instance (1, ptr, 0, ptr, 1, 0);
+  dds_take_arena (1, ptr, ptr, 0, 0, ptr);
+  dds_take_stream (1, ptr, 0);
+  dds_takecdr_stream (1, ptr, 0);
+  dds_create_sample_arena (0);
+  dds_reset_sample_arena (ptr);
+  dds_delete_sample_arena (ptr);
   dds_take_instance (1, ptr, ptr, 0, 0, 1);
   dds_take_instance_wl (1, ptr, ptr, 0, 1);
   dds_take_instance_mask (1, ptr, ptr, 0, 0, 1, 0);
@@ -250,6 +259,12 @@ int main (int argc, char **argv)
   dds_loan_shared_memory_buffer (1, 0, ptr);
   dds_loan_sample (1, ptr);
 
+  // dds_view.h
+  dds_view_init (ptr, ptr, ptr, ptr);
+  dds_view_fini (ptr);
+  dds_view_member (ptr, 0, 0);
+  dds_view_string (ptr, 0);
+
   // dds_public_alloc.h
   dds_alloc (0);
   dds_realloc (ptr, 0);
@@ -352,6 +367,9 @@ int main (int argc, char **argv)
   dds_qset_reader_data_lifecycle (ptr, 0, 0);
   dds_qset_durability_service (ptr, 0, 0, 0, 0, 0, 0);
   dds_qset_ignorelocal (ptr, 0);
+  dds_qset_instance_shard (ptr, 0, 0);
+  dds_qset_reader_loan_pool (ptr, 0);
+  dds_qset_reader_stream (ptr, 0);
   dds_qset_prop (ptr, ptr2, ptr3);
   dds_qunset_prop (ptr, ptr2);
   dds_qset_bprop (ptr, ptr2, ptr3, 0);
@@ -381,6 +399,9 @@ int main (int argc, char **argv)
   dds_qget_reader_data_lifecycle (ptr, ptr, ptr);
   dds_qget_durability_service (ptr, ptr, 0, ptr, ptr, ptr, ptr);
   dds_qget_ignorelocal (ptr, 0);
+  dds_qget_instance_shard (ptr, ptr, ptr);
+  dds_qget_reader_loan_pool (ptr, ptr);
+  dds_qget_reader_stream (ptr, ptr);
   dds_qget_propnames (ptr, ptr, ptr);
   dds_qget_prop (ptr, ptr, ptr);
   dds_qget_bpropnames (ptr, ptr, ptr);
@@ -447,6 +468,9 @@ int main (int argc, char **argv)
   dds_stream_write_sample (ptr, ptr2, ptr3);
   dds_stream_write_sampleLE (ptr, ptr2, ptr3);
   dds_stream_write_sampleBE (ptr, ptr2, ptr3);
+  dds_stream_member_ref_init (ptr, ptr2, 0, ptr3, NULL);
+  dds_stream_member_fixed_offset (ptr, ptr2, 0, ptr3);
+  dds_stream_locate_members (ptr, 0, ptr2, 0, ptr3, NULL);
 
   dds_stream_read (ptr, ptr2, ptr3);
   dds_stream_read_key (ptr, ptr2, ptr3);
@@ -454,6 +478,8 @@ int main (int argc, char **argv)
   dds_stream_read_sample (ptr, ptr2, ptr3);
   dds_stream_free_sample (ptr, ptr2);
   dds_stream_countops (ptr, 0, ptr2);
+  dds_stream_compile_copy_plan (ptr);
+  dds_stream_free_copy_plan (ptr);
   dds_stream_print_key (ptr, ptr2, ptr3, 0);
   dds_stream_print_sample (ptr, ptr2, ptr3, 0);
 
@@ -464,6 +490,20 @@ int main (int argc, char **argv)
   dds_cdrstream_desc_from_topic_desc (ptr, ptr2);
   dds_cdrstream_desc_fini (ptr);
 
+  // dds_cdrstream_gen.h
+  dds_stream_gen_grow (ptr, 0);
+  dds_stream_gen_read_string (ptr, ptr2);
+  dds_stream_gen_read_bstring (ptr, ptr2, 0);
+  dds_stream_gen_skip_string (ptr);
+  dds_stream_gen_realloc_sequence (ptr, ptr2, 0, 0, 0);
+  ret_cdrs = dds_stream_gen_normalize_uint32 (ptr, ptr2, ptr3, 0, 0);
+  ret_cdrs = dds_stream_gen_normalize_dheader (ptr, ptr2, ptr3, 0, 0);
+  ret_cdrs = dds_stream_gen_normalize_string (ptr, ptr2, 0, 0, 0);
+  ret_cdrs = dds_stream_gen_normalize_primarray (ptr, ptr2, 0, 0, 0, 0, 0);
+  ret_cdrs = dds_stream_gen_normalize_enumarray (ptr, ptr2, 0, 0, 0, 0, 0);
+  (void) ret_cdrs;
+  dds_stream_gen_normalize_error ();
+
 #ifdef DDS_HAS_SECURITY
   // dds_security_timed_cb.h
   dds_security_timed_dispatcher_new (ptr);
@@ -642,6 +682,8 @@ int main (int argc, char **argv)
   ddsi_typemap_deser (ptr, 0);
   ddsi_typemap_fini (ptr);
   ddsi_typemap_equal (ptr, ptr);
+  ddsi_typemap_resolve_member (ptr, ptr, ptr, 0, ptr, ptr, ptr);
+  ddsi_typemap_resolve_enum_literal (ptr, ptr, ptr, ptr, ptr);
   ddsi_type_lookup (ptr, ptr);
   ddsi_type_compare (ptr, ptr);
 
@@ -190,6 +190,9 @@ void gendef_pf_standards_conformance (FILE *out, void *parent, struct cfgelem co
 void gendef_pf_shm_loglevel (FILE *out, void *parent, struct cfgelem const * const cfgelem) {
   gendef_pf_int (out, parent, cfgelem);
 }
+void gendef_pf_fsync_policy (FILE *out, void *parent, struct cfgelem const * const cfgelem) {
+  gendef_pf_int (out, parent, cfgelem);
+}
 
 static void gen_defaults (FILE *out, void *parent, struct cfgelem const * const cfgelem)
 {
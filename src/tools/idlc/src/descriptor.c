@@ -29,6 +29,7 @@
 #include "descriptor.h"
 #include "hashid.h"
 #include "descriptor_type_meta.h"
+#include "descriptor_serializers.h"
 #include "dds/ddsc/dds_opcodes.h"
 
 #define TYPE (16)
@@ -2311,6 +2312,8 @@ static int print_flags(FILE *fp, struct descriptor *descriptor, bool type_info)
     vec[len++] = "DDS_TOPIC_FIXED_KEY_XCDR2";
   if (descriptor->flags & DDS_TOPIC_RESTRICT_DATA_REPRESENTATION)
     vec[len++] = "DDS_TOPIC_RESTRICT_DATA_REPRESENTATION";
+  if (descriptor->flags & DDS_TOPIC_SERIALIZERS)
+    vec[len++] = "DDS_TOPIC_SERIALIZERS";
 
   bool fixed_size = true;
   for (struct constructed_type *ctype = descriptor->constructed_types; ctype && fixed_size; ctype = ctype->next) {
@@ -2416,6 +2419,11 @@ static int print_descriptor(FILE *fp, struct descriptor *descriptor, bool type_i
     }
   }
 
+  if (descriptor->flags & DDS_TOPIC_SERIALIZERS) {
+    if (idl_fprintf(fp, ",\n  .serializers = &%s_serializers", type) < 0)
+      return -1;
+  }
+
   if (idl_fprintf(fp, "\n};\n\n") < 0)
     return -1;
 
@@ -2471,10 +2479,15 @@ static int print_cdrstream_descriptor(FILE *fp, struct descriptor *descriptor, u
   // a problem for our purpose and avoids making the output dependent on
   // platform-specific details (such as alignment)
   fmt = "  .opt_size_xcdr1 = 0,\n"
-        "  .opt_size_xcdr2 = 0\n"
-        "};\n\n";
+        "  .opt_size_xcdr2 = 0";
   if (idl_fprintf(fp, "%s", fmt) < 0)
     return -1;
+  if (descriptor->flags & DDS_TOPIC_SERIALIZERS) {
+    if (idl_fprintf(fp, ",\n  .serializers = &%s_serializers", type) < 0)
+      return -1;
+  }
+  if (idl_fprintf(fp, "\n};\n\n") < 0)
+    return -1;
   return 0;
 }
 
@@ -2664,6 +2677,8 @@ generate_descriptor(
     { ret = IDL_RETCODE_NO_MEMORY; goto err_print; }
   if (print_keys(generator->source.handle, &descriptor, inst_count) < 0)
     { ret = IDL_RETCODE_NO_MEMORY; goto err_print; }
+  if (generator->config.generate_serializers && (ret = print_serializers(generator->source.handle, &descriptor)) < 0)
+    goto err_print;
 #ifdef DDS_HAS_TYPE_DISCOVERY
   if (generator->config.c.generate_type_info && print_type_meta_ser(generator->source.handle, pstate, node) < 0)
     { ret = IDL_RETCODE_NO_MEMORY; goto err_print; }
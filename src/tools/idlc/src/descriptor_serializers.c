@@ -0,0 +1,822 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include <assert.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "idl/heap.h"
+#include "idl/print.h"
+#include "idl/processor.h"
+#include "idl/stream.h"
+#include "idl/string.h"
+
+#include "generator.h"
+#include "descriptor.h"
+#include "descriptor_serializers.h"
+#include "dds/ddsc/dds_opcodes.h"
+
+/* The generated serializers follow the serializer instructions for final
+   types exactly, so that the output is byte-for-byte identical to that of the
+   interpreter in dds_cdrstream.c. Only a subset of the type system is
+   supported: final structs without inheritance, optional and external
+   members, containing primitives, enums, strings, nested structs and arrays
+   and sequences of those. Everything else (unions, bitmasks, appendable and
+   mutable types, nested collections) makes the topic use the interpreter. */
+
+enum ser_kind {
+  SER_BOOL,
+  SER_PRIM,
+  SER_ENUM,
+  SER_STRING,
+  SER_BSTRING,
+  SER_STRUCT
+};
+
+struct ser_member {
+  const char *name; /**< C member name */
+  enum ser_kind kind;
+  uint32_t size; /**< primitive size, enum size in CDR or bounded string buffer size */
+  uint32_t max; /**< max enum value */
+  uint32_t dims; /**< number of array elements, 0 if not an array */
+  bool seq;
+  uint32_t bound; /**< sequence bound, 0 if unbounded */
+  size_t type; /**< index of the struct type for SER_STRUCT */
+};
+
+struct ser_type {
+  const idl_node_t *node;
+  char *name;
+  bool skip; /**< needs a function for skipping it in the input */
+  size_t n_members;
+  struct ser_member *members;
+};
+
+struct ser_ctx {
+  FILE *fp;
+  bool failed;
+  char *prefix;
+  size_t n_types;
+  struct ser_type *types;
+};
+
+static void out(struct ser_ctx *ctx, const char *fmt, ...) idl_attribute_format_printf(2, 3);
+
+static void out(struct ser_ctx *ctx, const char *fmt, ...)
+{
+  va_list ap;
+  if (ctx->failed)
+    return;
+  va_start(ap, fmt);
+  if (idl_vfprintf(ctx->fp, fmt, ap) < 0)
+    ctx->failed = true;
+  va_end(ap);
+}
+
+static idl_retcode_t add_struct(struct ser_ctx *ctx, const idl_node_t *node, size_t *index);
+
+static idl_retcode_t get_element(struct ser_ctx *ctx, const idl_type_spec_t *type_spec, struct ser_member *m)
+{
+  if (idl_is_string(type_spec)) {
+    if (idl_type(type_spec) != IDL_STRING)
+      return IDL_RETCODE_UNSUPPORTED;
+    if (idl_is_bounded(type_spec)) {
+      m->kind = SER_BSTRING;
+      m->size = idl_bound(type_spec) + 1;
+    } else {
+      m->kind = SER_STRING;
+    }
+    return IDL_RETCODE_OK;
+  } else if (idl_is_enum(type_spec)) {
+    const uint32_t bit_bound = idl_bound(type_spec);
+    m->kind = SER_ENUM;
+    m->size = (bit_bound > 16) ? 4 : (bit_bound > 8) ? 2 : 1;
+    m->max = idl_enum_max_value(type_spec);
+    return IDL_RETCODE_OK;
+  } else if (idl_is_struct(type_spec)) {
+    m->kind = SER_STRUCT;
+    return add_struct(ctx, type_spec, &m->type);
+  } else if (idl_is_base_type(type_spec)) {
+    m->kind = SER_PRIM;
+    switch (idl_type(type_spec)) {
+      case IDL_BOOL:
+        m->kind = SER_BOOL;
+        m->size = 1;
+        break;
+      case IDL_CHAR: case IDL_INT8: case IDL_OCTET: case IDL_UINT8:
+        m->size = 1;
+        break;
+      case IDL_SHORT: case IDL_INT16: case IDL_USHORT: case IDL_UINT16:
+        m->size = 2;
+        break;
+      case IDL_LONG: case IDL_INT32: case IDL_ULONG: case IDL_UINT32: case IDL_FLOAT:
+        m->size = 4;
+        break;
+      case IDL_LLONG: case IDL_INT64: case IDL_ULLONG: case IDL_UINT64: case IDL_DOUBLE:
+        m->size = 8;
+        break;
+      default:
+        return IDL_RETCODE_UNSUPPORTED;
+    }
+    return IDL_RETCODE_OK;
+  }
+  return IDL_RETCODE_UNSUPPORTED;
+}
+
+static idl_retcode_t get_member(struct ser_ctx *ctx, const idl_declarator_t *declarator, struct ser_member *m)
+{
+  const idl_type_spec_t *type_spec;
+
+  memset(m, 0, sizeof(*m));
+  m->name = idl_identifier(declarator);
+  m->dims = idl_array_size(declarator);
+
+  /* array dimensions of aliases add up to a single flat array */
+  type_spec = idl_strip(idl_type_spec(declarator), IDL_STRIP_FORWARD);
+  while (idl_is_alias(type_spec)) {
+    if (idl_is_array(type_spec))
+      m->dims = (m->dims ? m->dims : 1) * idl_array_size(type_spec);
+    type_spec = idl_strip(idl_type_spec(type_spec), IDL_STRIP_FORWARD);
+  }
+
+  if (idl_is_sequence(type_spec)) {
+    if (m->dims)
+      return IDL_RETCODE_UNSUPPORTED;
+    m->seq = true;
+    m->bound = idl_bound(type_spec);
+    type_spec = idl_strip(idl_type_spec(type_spec), IDL_STRIP_FORWARD);
+    while (idl_is_alias(type_spec)) {
+      if (idl_is_array(type_spec))
+        return IDL_RETCODE_UNSUPPORTED;
+      type_spec = idl_strip(idl_type_spec(type_spec), IDL_STRIP_FORWARD);
+    }
+    if (idl_is_sequence(type_spec))
+      return IDL_RETCODE_UNSUPPORTED;
+  }
+
+  return get_element(ctx, type_spec, m);
+}
+
+static idl_retcode_t add_struct(struct ser_ctx *ctx, const idl_node_t *node, size_t *index)
+{
+  idl_retcode_t ret;
+  const idl_struct_t *_struct = (const idl_struct_t *)node;
+  const idl_member_t *member;
+  const idl_declarator_t *declarator;
+  struct ser_type *types, *type;
+
+  for (size_t i = 0; i < ctx->n_types; i++) {
+    if (ctx->types[i].node == node) {
+      *index = i;
+      return IDL_RETCODE_OK;
+    }
+  }
+
+  if (!idl_is_extensible(node, IDL_FINAL) || _struct->inherit_spec || idl_is_empty(node))
+    return IDL_RETCODE_UNSUPPORTED;
+
+  /* add the type before its members, so that recursive types terminate */
+  if (!(types = idl_realloc(ctx->types, (ctx->n_types + 1) * sizeof(*types))))
+    return IDL_RETCODE_NO_MEMORY;
+  ctx->types = types;
+  *index = ctx->n_types++;
+  type = &ctx->types[*index];
+  memset(type, 0, sizeof(*type));
+  type->node = node;
+  if (IDL_PRINT(&type->name, print_type, node) < 0)
+    return IDL_RETCODE_NO_MEMORY;
+
+  IDL_FOREACH(member, _struct->members) {
+    if (idl_is_optional(&member->node) || idl_is_external(&member->node))
+      return IDL_RETCODE_UNSUPPORTED;
+    IDL_FOREACH(declarator, member->declarators) {
+      struct ser_member m, *members;
+      if ((ret = get_member(ctx, declarator, &m)) != IDL_RETCODE_OK)
+        return ret;
+      /* ctx->types may have moved while adding nested types */
+      type = &ctx->types[*index];
+      if (!(members = idl_realloc(type->members, (type->n_members + 1) * sizeof(*members))))
+        return IDL_RETCODE_NO_MEMORY;
+      type->members = members;
+      type->members[type->n_members++] = m;
+    }
+  }
+  return IDL_RETCODE_OK;
+}
+
+static void mark_skip(struct ser_ctx *ctx, size_t index)
+{
+  if (ctx->types[index].skip)
+    return;
+  ctx->types[index].skip = true;
+  for (size_t i = 0; i < ctx->types[index].n_members; i++) {
+    if (ctx->types[index].members[i].kind == SER_STRUCT)
+      mark_skip(ctx, ctx->types[index].members[i].type);
+  }
+}
+
+static bool needs_dheader(const struct ser_member *m)
+{
+  return m->kind != SER_BOOL && m->kind != SER_PRIM;
+}
+
+/* size of an element in memory */
+static char *elem_size(const struct ser_ctx *ctx, const struct ser_member *m)
+{
+  char *str = NULL;
+  switch (m->kind) {
+    case SER_BOOL: case SER_PRIM: case SER_BSTRING:
+      (void)idl_asprintf(&str, "%"PRIu32, m->size);
+      break;
+    case SER_ENUM:
+      (void)idl_asprintf(&str, "sizeof (uint32_t)");
+      break;
+    case SER_STRING:
+      (void)idl_asprintf(&str, "sizeof (char *)");
+      break;
+    case SER_STRUCT:
+      (void)idl_asprintf(&str, "sizeof (%s)", ctx->types[m->type].name);
+      break;
+  }
+  return str;
+}
+
+/* alignment of a primitive in the stream */
+static const char *prim_align(const struct ser_member *m, const char *stream)
+{
+  static char buf[64];
+  if (m->size > 4)
+    (void)snprintf(buf, sizeof(buf), "dds_stream_gen_align (%s->m_xcdr_version, 8)", stream);
+  else
+    (void)snprintf(buf, sizeof(buf), "%"PRIu32, m->size);
+  return buf;
+}
+
+static void write_elem(struct ser_ctx *ctx, const char *ind, const struct ser_member *m, const char *addr, bool key)
+{
+  switch (m->kind) {
+    case SER_BOOL:
+      if (!key)
+        out(ctx, "%sif (*(const uint8_t *) (%s) > 1)\n%s  return false;\n", ind, addr, ind);
+      out(ctx, "%sdds_stream_gen_put1 (os, *(const uint8_t *) (%s));\n", ind, addr);
+      break;
+    case SER_PRIM:
+      out(ctx, "%sdds_stream_gen_put_bytes (os, %s, %s, %"PRIu32");\n", ind, addr, prim_align(m, "os"), m->size);
+      break;
+    case SER_ENUM: {
+      static const char *put[] = { "", "dds_stream_gen_put1 (os, (uint8_t) ", "dds_stream_gen_put2 (os, (uint16_t) ", "", "dds_stream_gen_put4 (os, " };
+      if (key) {
+        out(ctx, "%sif (*(const uint32_t *) (%s) <= %"PRIu32")\n", ind, addr, m->max);
+        out(ctx, "%s  %s*(const uint32_t *) (%s));\n", ind, put[m->size], addr);
+      } else {
+        out(ctx, "%sif (*(const uint32_t *) (%s) > %"PRIu32")\n%s  return false;\n", ind, addr, m->max, ind);
+        out(ctx, "%s%s*(const uint32_t *) (%s));\n", ind, put[m->size], addr);
+      }
+      break;
+    }
+    case SER_STRING:
+      out(ctx, "%sdds_stream_gen_put_string (os, *(const char * const *) (%s));\n", ind, addr);
+      break;
+    case SER_BSTRING:
+      out(ctx, "%sdds_stream_gen_put_string (os, (const char *) (%s));\n", ind, addr);
+      break;
+    case SER_STRUCT:
+      out(ctx, "%sif (!%s_cdr_write_%s (os, %s))\n%s  return false;\n", ind, ctx->prefix, ctx->types[m->type].name, addr, ind);
+      break;
+  }
+}
+
+static void read_elem(struct ser_ctx *ctx, const char *ind, const struct ser_member *m, const char *addr)
+{
+  switch (m->kind) {
+    case SER_BOOL: case SER_PRIM:
+      out(ctx, "%sdds_stream_gen_get_bytes (is, %s, %s, %"PRIu32");\n", ind, addr, prim_align(m, "is"), m->size);
+      break;
+    case SER_ENUM:
+      out(ctx, "%s*(uint32_t *) (%s) = dds_stream_gen_get%"PRIu32" (is);\n", ind, addr, m->size);
+      break;
+    case SER_STRING:
+      out(ctx, "%s*(char **) (%s) = dds_stream_gen_read_string (is, *(char **) (%s));\n", ind, addr, addr);
+      break;
+    case SER_BSTRING:
+      out(ctx, "%sdds_stream_gen_read_bstring (is, %s, %"PRIu32");\n", ind, addr, m->size);
+      break;
+    case SER_STRUCT:
+      out(ctx, "%s%s_cdr_read_%s (is, %s);\n", ind, ctx->prefix, ctx->types[m->type].name, addr);
+      break;
+  }
+}
+
+static void normalize_elem(struct ser_ctx *ctx, const char *ind, const struct ser_member *m, const char *size)
+{
+  out(ctx, "%sif (!", ind);
+  switch (m->kind) {
+    case SER_BOOL:
+      out(ctx, "dds_stream_gen_normalize_enumarray (data, off, %s, bswap, 1, 1, 1)", size);
+      break;
+    case SER_PRIM:
+      out(ctx, "dds_stream_gen_normalize_prim (data, off, %s, bswap, %"PRIu32", xcdr_version)", size, m->size);
+      break;
+    case SER_ENUM:
+      out(ctx, "dds_stream_gen_normalize_enumarray (data, off, %s, bswap, %"PRIu32", 1, %"PRIu32")", size, m->size, m->max);
+      break;
+    case SER_STRING:
+      out(ctx, "dds_stream_gen_normalize_string (data, off, %s, bswap, SIZE_MAX)", size);
+      break;
+    case SER_BSTRING:
+      out(ctx, "dds_stream_gen_normalize_string (data, off, %s, bswap, %"PRIu32")", size, m->size);
+      break;
+    case SER_STRUCT:
+      out(ctx, "%s_cdr_normalize_%s (data, off, %s, bswap, xcdr_version)", ctx->prefix, ctx->types[m->type].name, size);
+      break;
+  }
+  out(ctx, ")\n%s  return false;\n", ind);
+}
+
+static void skip_elem(struct ser_ctx *ctx, const char *ind, const struct ser_member *m)
+{
+  switch (m->kind) {
+    case SER_BOOL: case SER_PRIM:
+      out(ctx, "%sdds_stream_gen_skip (is, %s, %"PRIu32");\n", ind, prim_align(m, "is"), m->size);
+      break;
+    case SER_ENUM:
+      out(ctx, "%sdds_stream_gen_skip (is, %"PRIu32", %"PRIu32");\n", ind, m->size, m->size);
+      break;
+    case SER_STRING: case SER_BSTRING:
+      out(ctx, "%sdds_stream_gen_skip_string (is);\n", ind);
+      break;
+    case SER_STRUCT:
+      out(ctx, "%s%s_cdr_skip_%s (is);\n", ind, ctx->prefix, ctx->types[m->type].name);
+      break;
+  }
+}
+
+static idl_retcode_t print_write_member(struct ser_ctx *ctx, const struct ser_type *type, const struct ser_member *m)
+{
+  char *addr = NULL, *esize = NULL;
+  idl_retcode_t ret = IDL_RETCODE_NO_MEMORY;
+
+  if (idl_asprintf(&addr, "data + offsetof (%s, %s)", type->name, m->name) < 0)
+    goto err;
+  if (!m->dims && !m->seq) {
+    write_elem(ctx, "  ", m, addr, false);
+    ret = IDL_RETCODE_OK;
+    goto err;
+  }
+  if (!(esize = elem_size(ctx, m)))
+    goto err;
+
+  if (m->dims) {
+    if (m->kind == SER_PRIM) {
+      out(ctx, "  dds_stream_gen_put_bytes (os, %s, %s, %"PRIu32");\n", addr, prim_align(m, "os"), m->dims * m->size);
+    } else if (m->kind == SER_BOOL) {
+      out(ctx, "  for (uint32_t i = 0; i < %"PRIu32"; i++)\n", m->dims);
+      out(ctx, "    if (((const uint8_t *) (%s))[i] > 1)\n      return false;\n", addr);
+      out(ctx, "  dds_stream_gen_put_bytes (os, %s, 1, %"PRIu32");\n", addr, m->dims);
+    } else {
+      out(ctx, "  {\n    const char *a = %s;\n", addr);
+      out(ctx, "    const uint32_t dh = (os->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2) ? dds_stream_gen_reserve_dheader (os) : 0;\n");
+      out(ctx, "    for (uint32_t i = 0; i < %"PRIu32"; i++)\n    {\n", m->dims);
+      idl_free(addr);
+      if (idl_asprintf(&addr, "a + i * %s", esize) < 0)
+        { addr = NULL; goto err; }
+      write_elem(ctx, "      ", m, addr, false);
+      out(ctx, "    }\n    if (dh > 0)\n      dds_stream_gen_patch_dheader (os, dh);\n  }\n");
+    }
+  } else {
+    out(ctx, "  {\n    const dds_sequence_t *seq = (const dds_sequence_t *) (%s);\n", addr);
+    if (m->bound)
+      out(ctx, "    if (seq->_length > %"PRIu32")\n      return false;\n", m->bound);
+    if (needs_dheader(m))
+      out(ctx, "    const uint32_t dh = (os->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2) ? dds_stream_gen_reserve_dheader (os) : 0;\n");
+    out(ctx, "    dds_stream_gen_put4 (os, seq->_length);\n");
+    if (m->kind == SER_PRIM) {
+      out(ctx, "    if (seq->_length > 0)\n");
+      out(ctx, "      dds_stream_gen_put_bytes (os, seq->_buffer, %s, seq->_length * %"PRIu32");\n", prim_align(m, "os"), m->size);
+    } else if (m->kind == SER_BOOL) {
+      out(ctx, "    for (uint32_t i = 0; i < seq->_length; i++)\n");
+      out(ctx, "      if (seq->_buffer[i] > 1)\n        return false;\n");
+      out(ctx, "    if (seq->_length > 0)\n");
+      out(ctx, "      dds_stream_gen_put_bytes (os, seq->_buffer, 1, seq->_length);\n");
+    } else {
+      out(ctx, "    for (uint32_t i = 0; i < seq->_length; i++)\n    {\n");
+      idl_free(addr);
+      if (idl_asprintf(&addr, "(const char *) seq->_buffer + i * %s", esize) < 0)
+        { addr = NULL; goto err; }
+      write_elem(ctx, "      ", m, addr, false);
+      out(ctx, "    }\n");
+    }
+    if (needs_dheader(m))
+      out(ctx, "    if (dh > 0)\n      dds_stream_gen_patch_dheader (os, dh);\n");
+    out(ctx, "  }\n");
+  }
+  ret = IDL_RETCODE_OK;
+err:
+  idl_free(addr);
+  idl_free(esize);
+  return ret;
+}
+
+static idl_retcode_t print_read_member(struct ser_ctx *ctx, const struct ser_type *type, const struct ser_member *m)
+{
+  char *addr = NULL, *esize = NULL;
+  idl_retcode_t ret = IDL_RETCODE_NO_MEMORY;
+
+  if (idl_asprintf(&addr, "data + offsetof (%s, %s)", type->name, m->name) < 0)
+    goto err;
+  if (!m->dims && !m->seq) {
+    read_elem(ctx, "  ", m, addr);
+    ret = IDL_RETCODE_OK;
+    goto err;
+  }
+  if (!(esize = elem_size(ctx, m)))
+    goto err;
+
+  if (m->dims) {
+    if (m->kind == SER_PRIM || m->kind == SER_BOOL) {
+      out(ctx, "  dds_stream_gen_get_bytes (is, %s, %s, %"PRIu32");\n", addr, prim_align(m, "is"), m->dims * m->size);
+    } else {
+      out(ctx, "  {\n    char *a = %s;\n", addr);
+      out(ctx, "    if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)\n      dds_stream_gen_skip (is, 4, 4);\n");
+      out(ctx, "    for (uint32_t i = 0; i < %"PRIu32"; i++)\n", m->dims);
+      idl_free(addr);
+      if (idl_asprintf(&addr, "a + i * %s", esize) < 0)
+        { addr = NULL; goto err; }
+      read_elem(ctx, "      ", m, addr);
+      out(ctx, "  }\n");
+    }
+  } else {
+    out(ctx, "  {\n    dds_sequence_t *seq = (dds_sequence_t *) (%s);\n", addr);
+    if (needs_dheader(m))
+      out(ctx, "    if (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)\n      dds_stream_gen_skip (is, 4, 4);\n");
+    out(ctx, "    const uint32_t num = dds_stream_gen_get4 (is);\n");
+    out(ctx, "    if (num == 0)\n      seq->_length = 0;\n    else\n    {\n");
+    out(ctx, "      dds_stream_gen_realloc_sequence (is, seq, num, %s, %s);\n", esize, (m->kind == SER_STRING || m->kind == SER_STRUCT) ? "true" : "false");
+    if (m->kind == SER_PRIM || m->kind == SER_BOOL) {
+      out(ctx, "      dds_stream_gen_get_bytes (is, seq->_buffer, %s, seq->_length * %"PRIu32");\n", prim_align(m, "is"), m->size);
+    } else {
+      out(ctx, "      for (uint32_t i = 0; i < seq->_length; i++)\n");
+      idl_free(addr);
+      if (idl_asprintf(&addr, "(char *) seq->_buffer + i * %s", esize) < 0)
+        { addr = NULL; goto err; }
+      read_elem(ctx, "        ", m, addr);
+    }
+    if (m->kind == SER_PRIM || m->kind == SER_BOOL || m->kind == SER_ENUM) {
+      out(ctx, "      if (seq->_length < num)\n");
+      out(ctx, "        dds_stream_gen_skip (is, 1, (num - seq->_length) * %"PRIu32");\n", m->size);
+    } else {
+      out(ctx, "      for (uint32_t i = seq->_length; i < num; i++)\n");
+      skip_elem(ctx, "        ", m);
+    }
+    out(ctx, "    }\n  }\n");
+  }
+  ret = IDL_RETCODE_OK;
+err:
+  idl_free(addr);
+  idl_free(esize);
+  return ret;
+}
+
+static void print_normalize_member(struct ser_ctx *ctx, const struct ser_member *m)
+{
+  const char *size = needs_dheader(m) ? "size1" : "size";
+
+  if (!m->dims && !m->seq) {
+    normalize_elem(ctx, "  ", m, "size");
+    return;
+  }
+
+  out(ctx, "  {\n");
+  if (needs_dheader(m)) {
+    out(ctx, "    uint32_t size1 = size;\n");
+    out(ctx, "    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && !dds_stream_gen_normalize_dheader (&size1, data, off, size, bswap))\n      return false;\n");
+  }
+  if (m->dims) {
+    out(ctx, "    const uint32_t num = %"PRIu32";\n", m->dims);
+  } else {
+    out(ctx, "    uint32_t num;\n");
+    out(ctx, "    if (!dds_stream_gen_normalize_uint32 (&num, data, off, %s, bswap))\n      return false;\n", size);
+    if (m->bound)
+      out(ctx, "    if (num > %"PRIu32")\n      return dds_stream_gen_normalize_error ();\n", m->bound);
+  }
+  switch (m->kind) {
+    case SER_BOOL:
+      out(ctx, "    if (num > 0 && !dds_stream_gen_normalize_enumarray (data, off, %s, bswap, 1, num, 1))\n      return false;\n", size);
+      break;
+    case SER_PRIM:
+      out(ctx, "    if (num > 0 && !dds_stream_gen_normalize_primarray (data, off, %s, bswap, num, %"PRIu32", xcdr_version))\n      return false;\n", size, m->size);
+      break;
+    case SER_ENUM:
+      out(ctx, "    if (num > 0 && !dds_stream_gen_normalize_enumarray (data, off, %s, bswap, %"PRIu32", num, %"PRIu32"))\n      return false;\n", size, m->size, m->max);
+      break;
+    case SER_STRING: case SER_BSTRING: case SER_STRUCT:
+      out(ctx, "    for (uint32_t i = 0; i < num; i++)\n");
+      normalize_elem(ctx, "      ", m, size);
+      break;
+  }
+  if (needs_dheader(m))
+    out(ctx, "    if (xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2 && *off != size1)\n      return dds_stream_gen_normalize_error ();\n");
+  out(ctx, "  }\n");
+}
+
+static void print_skip_member(struct ser_ctx *ctx, const char *ind, const struct ser_member *m)
+{
+  if (!m->dims && !m->seq) {
+    skip_elem(ctx, ind, m);
+    return;
+  }
+
+  if (needs_dheader(m)) {
+    out(ctx, "%sif (is->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)\n", ind);
+    out(ctx, "%s  dds_stream_gen_skip (is, 1, dds_stream_gen_get4 (is));\n", ind);
+    out(ctx, "%selse\n", ind);
+  }
+  out(ctx, "%s{\n", ind);
+  if (m->dims)
+    out(ctx, "%s  const uint32_t num = %"PRIu32";\n", ind, m->dims);
+  else
+    out(ctx, "%s  const uint32_t num = dds_stream_gen_get4 (is);\n", ind);
+  switch (m->kind) {
+    case SER_BOOL: case SER_PRIM:
+      out(ctx, "%s  if (num > 0)\n", ind);
+      out(ctx, "%s    dds_stream_gen_skip (is, %s, num * %"PRIu32");\n", ind, prim_align(m, "is"), m->size);
+      break;
+    case SER_ENUM:
+      out(ctx, "%s  if (num > 0)\n", ind);
+      out(ctx, "%s    dds_stream_gen_skip (is, %"PRIu32", num * %"PRIu32");\n", ind, m->size, m->size);
+      break;
+    case SER_STRING: case SER_BSTRING: case SER_STRUCT: {
+      char *ind1 = NULL;
+      out(ctx, "%s  for (uint32_t i = 0; i < num; i++)\n", ind);
+      if (idl_asprintf(&ind1, "%s    ", ind) < 0)
+        ctx->failed = true;
+      else
+        skip_elem(ctx, ind1, m);
+      idl_free(ind1);
+      break;
+    }
+  }
+  out(ctx, "%s}\n", ind);
+}
+
+static bool uses_xcdr_version(const struct ser_type *type)
+{
+  for (size_t i = 0; i < type->n_members; i++) {
+    const struct ser_member *m = &type->members[i];
+    if (m->dims || m->seq || m->kind == SER_PRIM || m->kind == SER_STRUCT)
+      return true;
+  }
+  return false;
+}
+
+static void print_prototypes(struct ser_ctx *ctx, const struct ser_type *type)
+{
+  const char *p = ctx->prefix, *t = type->name;
+  out(ctx, "static bool %s_cdr_write_%s (dds_ostream_t *os, const void *sample);\n", p, t);
+  out(ctx, "static void %s_cdr_read_%s (dds_istream_t *is, void *sample);\n", p, t);
+  out(ctx, "static bool %s_cdr_normalize_%s (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version);\n", p, t);
+  if (type->skip)
+    out(ctx, "static void %s_cdr_skip_%s (dds_istream_t *is);\n", p, t);
+}
+
+static idl_retcode_t print_functions(struct ser_ctx *ctx, const struct ser_type *type)
+{
+  idl_retcode_t ret;
+  const char *p = ctx->prefix, *t = type->name;
+
+  out(ctx, "static bool %s_cdr_write_%s (dds_ostream_t *os, const void *sample)\n{\n", p, t);
+  out(ctx, "  const char *data = sample;\n");
+  for (size_t i = 0; i < type->n_members; i++) {
+    if ((ret = print_write_member(ctx, type, &type->members[i])) != IDL_RETCODE_OK)
+      return ret;
+  }
+  out(ctx, "  return true;\n}\n\n");
+
+  out(ctx, "static void %s_cdr_read_%s (dds_istream_t *is, void *sample)\n{\n", p, t);
+  out(ctx, "  char *data = sample;\n");
+  for (size_t i = 0; i < type->n_members; i++) {
+    if ((ret = print_read_member(ctx, type, &type->members[i])) != IDL_RETCODE_OK)
+      return ret;
+  }
+  out(ctx, "}\n\n");
+
+  out(ctx, "static bool %s_cdr_normalize_%s (char *data, uint32_t *off, uint32_t size, bool bswap, uint32_t xcdr_version)\n{\n", p, t);
+  if (!uses_xcdr_version(type))
+    out(ctx, "  (void) xcdr_version;\n");
+  for (size_t i = 0; i < type->n_members; i++)
+    print_normalize_member(ctx, &type->members[i]);
+  out(ctx, "  return true;\n}\n\n");
+
+  if (type->skip) {
+    out(ctx, "static void %s_cdr_skip_%s (dds_istream_t *is)\n{\n", p, t);
+    for (size_t i = 0; i < type->n_members; i++)
+      print_skip_member(ctx, "  ", &type->members[i]);
+    out(ctx, "}\n\n");
+  }
+  return IDL_RETCODE_OK;
+}
+
+/* key members of the topic type, in definition (and CDR) order */
+struct ser_key {
+  const struct ser_member *member;
+  uint32_t key_idx;
+};
+
+static bool get_keys(struct ser_ctx *ctx, const struct descriptor *descriptor, struct ser_key *keys, size_t *last)
+{
+  const struct ser_type *type = &ctx->types[0];
+  uint32_t n = 0;
+
+  for (uint32_t k = 0; k < descriptor->n_keys; k++) {
+    if (strchr(descriptor->keys[k].name, '.') != NULL)
+      return false;
+  }
+  for (size_t i = 0; i < type->n_members; i++) {
+    const struct ser_member *m = &type->members[i];
+    uint32_t k;
+    for (k = 0; k < descriptor->n_keys; k++) {
+      if (strcmp(descriptor->keys[k].name, m->name) == 0)
+        break;
+    }
+    if (k == descriptor->n_keys)
+      continue;
+    if (m->dims || m->seq || m->kind == SER_STRUCT)
+      return false;
+    assert(n < descriptor->n_keys);
+    keys[n].member = m;
+    keys[n].key_idx = n;
+    n++;
+    *last = i;
+  }
+  return n == descriptor->n_keys;
+}
+
+static void copy_key(struct ser_ctx *ctx, const char *ind, const struct ser_member *m, uint32_t idx)
+{
+  out(ctx, "%sis->m_index = k[%"PRIu32"];\n", ind, idx);
+  switch (m->kind) {
+    case SER_BOOL: case SER_PRIM: case SER_ENUM:
+      out(ctx, "%s{\n%s  uint64_t v;\n", ind, ind);
+      if (m->kind == SER_PRIM) {
+        out(ctx, "%s  dds_stream_gen_get_bytes (is, &v, %s, %"PRIu32");\n", ind, prim_align(m, "is"), m->size);
+        out(ctx, "%s  dds_stream_gen_put_bytes (os, &v, %s, %"PRIu32");\n", ind, prim_align(m, "os"), m->size);
+      } else {
+        out(ctx, "%s  dds_stream_gen_get_bytes (is, &v, %"PRIu32", %"PRIu32");\n", ind, m->size, m->size);
+        out(ctx, "%s  dds_stream_gen_put_bytes (os, &v, %"PRIu32", %"PRIu32");\n", ind, m->size, m->size);
+      }
+      out(ctx, "%s}\n", ind);
+      break;
+    case SER_STRING: case SER_BSTRING:
+      out(ctx, "%s{\n%s  const uint32_t sz = dds_stream_gen_get4 (is);\n", ind, ind);
+      out(ctx, "%s  dds_stream_gen_put4 (os, sz);\n", ind);
+      out(ctx, "%s  dds_stream_gen_put_bytes (os, is->m_buffer + is->m_index, 1, sz);\n", ind);
+      out(ctx, "%s  is->m_index += sz;\n%s}\n", ind, ind);
+      break;
+    case SER_STRUCT:
+      assert(0);
+      break;
+  }
+}
+
+static idl_retcode_t print_key_functions(struct ser_ctx *ctx, const struct descriptor *descriptor, const struct ser_key *keys, size_t last)
+{
+  const struct ser_type *type = &ctx->types[0];
+  const char *p = ctx->prefix;
+  bool same_order = true;
+
+  out(ctx, "static void %s_cdr_write_key (dds_ostream_t *os, const void *sample)\n{\n", p);
+  out(ctx, "  const char *data = sample;\n");
+  for (uint32_t k = 0; k < descriptor->n_keys; k++) {
+    char *addr = NULL;
+    const struct ser_member *m = keys[descriptor->keys[k].key_idx].member;
+    assert(strcmp(m->name, descriptor->keys[k].name) == 0);
+    if (idl_asprintf(&addr, "data + offsetof (%s, %s)", type->name, m->name) < 0)
+      return IDL_RETCODE_NO_MEMORY;
+    write_elem(ctx, "  ", m, addr, true);
+    idl_free(addr);
+    if (descriptor->keys[k].key_idx != k)
+      same_order = false;
+  }
+  out(ctx, "}\n\n");
+
+  /* the input is a normalized sample: determine the offsets of the key
+     members, then copy them in the order required by the key encoding */
+  out(ctx, "static bool %s_cdr_extract_key (dds_istream_t *is, dds_ostream_t *os)\n{\n", p);
+  out(ctx, "  uint32_t k[%"PRIu32"];\n", descriptor->n_keys);
+  for (size_t i = 0, n = 0; i <= last; i++) {
+    const struct ser_member *m = &type->members[i];
+    if (n < descriptor->n_keys && keys[n].member == m)
+      out(ctx, "  k[%zu] = is->m_index;\n", n++);
+    if (i < last)
+      print_skip_member(ctx, "  ", m);
+  }
+  if (!same_order) {
+    out(ctx, "  if (os->m_xcdr_version == DDSI_RTPS_CDR_ENC_VERSION_2)\n  {\n");
+    for (uint32_t k = 0; k < descriptor->n_keys; k++)
+      copy_key(ctx, "    ", keys[descriptor->keys[k].key_idx].member, descriptor->keys[k].key_idx);
+    out(ctx, "    return true;\n  }\n");
+  }
+  for (uint32_t n = 0; n < descriptor->n_keys; n++)
+    copy_key(ctx, "  ", keys[n].member, n);
+  out(ctx, "  return true;\n}\n\n");
+  return IDL_RETCODE_OK;
+}
+
+static void fini_ctx(struct ser_ctx *ctx)
+{
+  for (size_t i = 0; i < ctx->n_types; i++) {
+    idl_free(ctx->types[i].name);
+    idl_free(ctx->types[i].members);
+  }
+  idl_free(ctx->types);
+  idl_free(ctx->prefix);
+}
+
+idl_retcode_t
+print_serializers(
+  FILE *fp,
+  struct descriptor *descriptor)
+{
+  idl_retcode_t ret;
+  struct ser_ctx ctx;
+  struct ser_key *keys = NULL;
+  size_t index, last = 0;
+  bool key_functions = false;
+
+  memset(&ctx, 0, sizeof(ctx));
+  ctx.fp = fp;
+  if (!idl_is_struct(descriptor->topic))
+    return IDL_RETCODE_OK;
+  if (IDL_PRINT(&ctx.prefix, print_type, descriptor->topic) < 0)
+    return IDL_RETCODE_NO_MEMORY;
+  if ((ret = add_struct(&ctx, descriptor->topic, &index)) != IDL_RETCODE_OK) {
+    /* unsupported types are not an error, the topic falls back to the ops */
+    fini_ctx(&ctx);
+    return (ret == IDL_RETCODE_UNSUPPORTED) ? IDL_RETCODE_OK : ret;
+  }
+  assert(index == 0);
+
+  /* sequences of structs are truncated by skipping the surplus elements */
+  for (size_t i = 0; i < ctx.n_types; i++) {
+    for (size_t j = 0; j < ctx.types[i].n_members; j++) {
+      const struct ser_member *m = &ctx.types[i].members[j];
+      if (m->seq && m->kind == SER_STRUCT)
+        mark_skip(&ctx, m->type);
+    }
+  }
+
+  if (descriptor->n_keys > 0) {
+    if (!(keys = idl_calloc(descriptor->n_keys, sizeof(*keys))))
+      { ret = IDL_RETCODE_NO_MEMORY; goto err; }
+    if ((key_functions = get_keys(&ctx, descriptor, keys, &last))) {
+      for (size_t i = 0; i < last; i++) {
+        if (ctx.types[0].members[i].kind == SER_STRUCT)
+          mark_skip(&ctx, ctx.types[0].members[i].type);
+      }
+    }
+  }
+
+  for (size_t i = 0; i < ctx.n_types; i++)
+    print_prototypes(&ctx, &ctx.types[i]);
+  out(&ctx, "\n");
+  for (size_t i = 0; i < ctx.n_types; i++) {
+    if ((ret = print_functions(&ctx, &ctx.types[i])) != IDL_RETCODE_OK)
+      goto err;
+  }
+  if (key_functions && (ret = print_key_functions(&ctx, descriptor, keys, last)) != IDL_RETCODE_OK)
+    goto err;
+
+  out(&ctx, "static const dds_topic_serializers_t %s_serializers =\n{\n", ctx.prefix);
+  out(&ctx, "  .write = %1$s_cdr_write_%1$s,\n", ctx.prefix);
+  out(&ctx, "  .read = %1$s_cdr_read_%1$s,\n", ctx.prefix);
+  out(&ctx, "  .normalize = %1$s_cdr_normalize_%1$s,\n", ctx.prefix);
+  if (key_functions) {
+    out(&ctx, "  .write_key = %s_cdr_write_key,\n", ctx.prefix);
+    out(&ctx, "  .extract_key_from_data = %s_cdr_extract_key\n", ctx.prefix);
+  } else {
+    out(&ctx, "  .write_key = NULL,\n");
+    out(&ctx, "  .extract_key_from_data = NULL\n");
+  }
+  out(&ctx, "};\n\n");
+
+  if (ctx.failed)
+    ret = IDL_RETCODE_NO_MEMORY;
+  else
+    descriptor->flags |= DDS_TOPIC_SERIALIZERS;
+err:
+  idl_free(keys);
+  fini_ctx(&ctx);
+  return ret;
+}
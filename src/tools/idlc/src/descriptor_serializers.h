@@ -0,0 +1,27 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#ifndef DESCRIPTOR_SERIALIZERS_H
+#define DESCRIPTOR_SERIALIZERS_H
+
+#include <stdio.h>
+#include "idl/processor.h"
+#include "descriptor.h"
+
+/* Prints type-specific serialization functions for the topic if all types it
+   uses are supported, and then sets DDS_TOPIC_SERIALIZERS in the descriptor
+   flags. Unsupported topics are left alone and use the serializer ops. */
+idl_retcode_t
+print_serializers(
+  FILE *fp,
+  struct descriptor *descriptor);
+
+#endif /* DESCRIPTOR_SERIALIZERS_H */
@@ -31,6 +31,8 @@
 const char *export_macro = NULL;
 const char *header_guard_prefix = "DDSC_";
 int generate_cdrstream_desc = 0;
+int generate_serializers = 0;
+int generate_views = 0;
 
 static int print_base_type(
   char *str, size_t size, const void *node, void *user_data)
@@ -327,6 +329,8 @@ generate_nosetup(const idl_pstate_t *pstate, struct generator *generator)
     return IDL_RETCODE_NO_MEMORY;
   if (generator->config.generate_cdrstream_desc && fputs("#include \"dds/cdr/dds_cdrstream.h\"\n", generator->header.handle) < 0)
     return IDL_RETCODE_NO_MEMORY;
+  if (generator->config.generate_views && fputs("#include \"dds/ddsc/dds_view.h\"\n", generator->header.handle) < 0)
+    return IDL_RETCODE_NO_MEMORY;
   if (fputs("\n", generator->header.handle) < 0)
     return IDL_RETCODE_NO_MEMORY;
   if (fputs("#ifdef __cplusplus\nextern \"C\" {\n#endif\n\n", generator->header.handle) < 0)
@@ -338,7 +342,13 @@ generate_nosetup(const idl_pstate_t *pstate, struct generator *generator)
   for (const char *ptr = sep; *ptr; ptr++)
     if (idl_isseparator((unsigned char)*ptr))
       sep = ptr+1;
-  if (idl_fprintf(generator->source.handle, "#include \"%s\"\n\n", sep) < 0)
+  if (idl_fprintf(generator->source.handle, "#include \"%s\"\n", sep) < 0)
+    return IDL_RETCODE_NO_MEMORY;
+  if (generator->config.generate_serializers && fputs("#include \"dds/cdr/dds_cdrstream_gen.h\"\n", generator->source.handle) < 0)
+    return IDL_RETCODE_NO_MEMORY;
+  if (generator->config.generate_views && fputs("#include <string.h>\n", generator->source.handle) < 0)
+    return IDL_RETCODE_NO_MEMORY;
+  if (fputs("\n", generator->source.handle) < 0)
     return IDL_RETCODE_NO_MEMORY;
   if ((ret = generate_types(pstate, generator)))
     return ret;
@@ -357,6 +367,15 @@ static const idlc_option_t *opts[] = {
   &(idlc_option_t){
     IDLC_FLAG, { .flag = &generate_cdrstream_desc }, 'f', "cdrstream-desc", "",
     "Generate CDR descriptor in addition to regular topic descriptor." },
+  &(idlc_option_t){
+    IDLC_FLAG, { .flag = &generate_serializers }, 'f', "serializers", "",
+    "Generate type-specific serialization functions for topics that only use "
+    "final types without unions, optionals and external members. Other topics "
+    "use the serialization instructions in the topic descriptor." },
+  &(idlc_option_t){
+    IDLC_FLAG, { .flag = &generate_views }, 'f', "views", "",
+    "Generate views for accessing members of primitive, enumerated and string "
+    "type of topics directly in the serialized data." },
   &(idlc_option_t){
     IDLC_STRING, { .string = &header_guard_prefix },
     'f', "header-guard-prefix", "<header guard prefix>",
@@ -399,6 +418,8 @@ idlc_generate(const idl_pstate_t *pstate, const idlc_generator_config_t *config)
     generator.config.export_macro = NULL;
   }
   generator.config.generate_cdrstream_desc = (generate_cdrstream_desc != 0);
+  generator.config.generate_serializers = (generate_serializers != 0);
+  generator.config.generate_views = (generate_views != 0);
   ret = generate_nosetup(pstate, &generator);
 
 err_options:
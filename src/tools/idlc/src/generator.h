@@ -34,6 +34,8 @@ struct generator {
     struct idlc_generator_config c;
     char *export_macro;
     bool generate_cdrstream_desc;
+    bool generate_serializers;
+    bool generate_views;
   } config;
 };
 
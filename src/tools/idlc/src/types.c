@@ -24,6 +24,7 @@
 
 #include "generator.h"
 #include "descriptor.h"
+#include "views.h"
 
 static const char *
 get_type_prefix(const idl_type_spec_t *type_spec)
@@ -256,6 +257,8 @@ emit_struct(
       }
       if ((ret = generate_descriptor(pstate, gen, node)))
         return ret;
+      if (gen->config.generate_views && (ret = print_views(pstate, gen, node)))
+        return ret;
     }
     if (empty)
       if (idl_fprintf(gen->header.handle, "#endif /* empty struct */\n\n") < 0)
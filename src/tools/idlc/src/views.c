@@ -0,0 +1,321 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#include <assert.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "idl/heap.h"
+#include "idl/print.h"
+#include "idl/processor.h"
+#include "idl/stream.h"
+#include "idl/string.h"
+
+#include "generator.h"
+#include "views.h"
+
+/* A view exposes the members of primitive, enumerated and string type of the
+   topic struct, and those of its nested (non-optional) struct members. This is
+   what dds_view_init can locate in the serialized data. Members of a base type
+   cannot be addressed and are left out, as are collections and unions. */
+
+/* must not exceed DDS_CDRSTREAM_MAX_NESTING_DEPTH */
+#define MAX_VIEW_DEPTH 32
+
+enum view_kind {
+  VIEW_BOOL,
+  VIEW_PRIM,
+  VIEW_ENUM,
+  VIEW_STRING
+};
+
+struct view_member {
+  char *name; /**< accessor name, the path with '_' as separator */
+  char *type; /**< C type of the value */
+  enum view_kind kind;
+  uint32_t size; /**< size in CDR */
+  uint32_t depth;
+  uint32_t index[MAX_VIEW_DEPTH];
+  uint32_t member_id[MAX_VIEW_DEPTH];
+};
+
+struct view_ctx {
+  FILE *fp;
+  bool failed;
+  char *prefix;
+  size_t n_members;
+  struct view_member *members;
+};
+
+static void out(struct view_ctx *ctx, const char *fmt, ...) idl_attribute_format_printf(2, 3);
+
+static void out(struct view_ctx *ctx, const char *fmt, ...)
+{
+  va_list ap;
+  if (ctx->failed)
+    return;
+  va_start(ap, fmt);
+  if (idl_vfprintf(ctx->fp, fmt, ap) < 0)
+    ctx->failed = true;
+  va_end(ap);
+}
+
+static bool get_kind(const idl_type_spec_t *type_spec, enum view_kind *kind, uint32_t *size)
+{
+  if (idl_is_string(type_spec)) {
+    *kind = VIEW_STRING;
+    *size = 4;
+    return idl_type(type_spec) == IDL_STRING;
+  } else if (idl_is_enum(type_spec)) {
+    const uint32_t bit_bound = idl_bound(type_spec);
+    *kind = VIEW_ENUM;
+    *size = (bit_bound > 16) ? 4 : (bit_bound > 8) ? 2 : 1;
+    return true;
+  } else if (idl_is_base_type(type_spec)) {
+    *kind = VIEW_PRIM;
+    switch (idl_type(type_spec)) {
+      case IDL_BOOL:
+        *kind = VIEW_BOOL;
+        *size = 1;
+        return true;
+      case IDL_CHAR: case IDL_INT8: case IDL_OCTET: case IDL_UINT8:
+        *size = 1;
+        return true;
+      case IDL_SHORT: case IDL_INT16: case IDL_USHORT: case IDL_UINT16:
+        *size = 2;
+        return true;
+      case IDL_LONG: case IDL_INT32: case IDL_ULONG: case IDL_UINT32: case IDL_FLOAT:
+        *size = 4;
+        return true;
+      case IDL_LLONG: case IDL_INT64: case IDL_ULLONG: case IDL_UINT64: case IDL_DOUBLE:
+        *size = 8;
+        return true;
+      default:
+        return false;
+    }
+  }
+  return false;
+}
+
+static idl_retcode_t
+add_members(
+  struct view_ctx *ctx,
+  const idl_struct_t *_struct,
+  const char *path,
+  uint32_t depth,
+  const uint32_t *index,
+  const uint32_t *member_id)
+{
+  idl_retcode_t ret;
+  const idl_member_t *member;
+  const idl_declarator_t *declarator;
+  uint32_t n = 0;
+
+  IDL_FOREACH(member, _struct->members) {
+    IDL_FOREACH(declarator, member->declarators) {
+      const idl_type_spec_t *type_spec = idl_strip(idl_type_spec(declarator), IDL_STRIP_FORWARD);
+      bool array = idl_array_size(declarator) > 0;
+      uint32_t idx[MAX_VIEW_DEPTH], mid[MAX_VIEW_DEPTH];
+      enum view_kind kind;
+      uint32_t size;
+      char *name;
+
+      memcpy(idx, index, depth * sizeof(*idx));
+      memcpy(mid, member_id, depth * sizeof(*mid));
+      idx[depth] = n++;
+      mid[depth] = declarator->id.value;
+
+      while (idl_is_alias(type_spec)) {
+        array = array || idl_is_array(type_spec);
+        type_spec = idl_strip(idl_type_spec(type_spec), IDL_STRIP_FORWARD);
+      }
+      if (array)
+        continue;
+
+      if (idl_asprintf(&name, "%s%s%s", path, *path ? "_" : "", idl_identifier(declarator)) < 0)
+        return IDL_RETCODE_NO_MEMORY;
+      if (idl_is_struct(type_spec)) {
+        /* the path to a member can only go through struct members that are
+           always present in the data */
+        ret = IDL_RETCODE_OK;
+        if (depth + 1 < MAX_VIEW_DEPTH && !idl_is_optional(&member->node) && !idl_is_external(&member->node))
+          ret = add_members(ctx, (const idl_struct_t *)type_spec, name, depth + 1, idx, mid);
+        idl_free(name);
+        if (ret != IDL_RETCODE_OK)
+          return ret;
+      } else if (get_kind(type_spec, &kind, &size)) {
+        struct view_member *members, *m;
+        if (!(members = idl_realloc(ctx->members, (ctx->n_members + 1) * sizeof(*members)))) {
+          idl_free(name);
+          return IDL_RETCODE_NO_MEMORY;
+        }
+        ctx->members = members;
+        m = &ctx->members[ctx->n_members++];
+        memset(m, 0, sizeof(*m));
+        m->name = name;
+        m->kind = kind;
+        m->size = size;
+        m->depth = depth + 1;
+        memcpy(m->index, idx, m->depth * sizeof(*idx));
+        memcpy(m->member_id, mid, m->depth * sizeof(*mid));
+        if (kind == VIEW_STRING)
+          m->type = idl_strdup("const char *");
+        else if (IDL_PRINT(&m->type, print_type, type_spec) < 0)
+          m->type = NULL;
+        if (m->type == NULL)
+          return IDL_RETCODE_NO_MEMORY;
+      } else {
+        idl_free(name);
+      }
+    }
+  }
+  return IDL_RETCODE_OK;
+}
+
+static void fini_ctx(struct view_ctx *ctx)
+{
+  for (size_t i = 0; i < ctx->n_members; i++) {
+    idl_free(ctx->members[i].name);
+    idl_free(ctx->members[i].type);
+  }
+  idl_free(ctx->members);
+  idl_free(ctx->prefix);
+}
+
+/* "const char *" is followed by "*value" without a space */
+static const char *value_sep(const char *type)
+{
+  return type[strlen(type) - 1] == '*' ? "" : " ";
+}
+
+static void print_declarations(struct view_ctx *ctx, const char *export_macro)
+{
+  const char *export = export_macro ? export_macro : "";
+  const char *sep = export_macro ? " " : "";
+  out(ctx, "typedef struct %s_view\n{\n", ctx->prefix);
+  out(ctx, "  dds_view_t v;\n");
+  out(ctx, "  uint32_t offs[%zu];\n", ctx->n_members);
+  out(ctx, "} %s_view;\n\n", ctx->prefix);
+  out(ctx, "%s%sdds_return_t %s_view_init (%s_view *view, struct ddsi_serdata *serdata);\n", export, sep, ctx->prefix, ctx->prefix);
+  out(ctx, "%s%svoid %s_view_fini (%s_view *view);\n", export, sep, ctx->prefix, ctx->prefix);
+  for (size_t i = 0; i < ctx->n_members; i++) {
+    const struct view_member *m = &ctx->members[i];
+    out(ctx, "%s%sbool %s_view_%s (%s_view *view, %s%s*value);\n", export, sep, ctx->prefix, m->name, ctx->prefix, m->type, value_sep(m->type));
+  }
+  out(ctx, "\n");
+}
+
+static void print_desc(struct view_ctx *ctx)
+{
+  const char *sep;
+
+  sep = "";
+  out(ctx, "static const uint32_t %s_view_index[] = { ", ctx->prefix);
+  for (size_t i = 0; i < ctx->n_members; i++) {
+    for (uint32_t d = 0; d < ctx->members[i].depth; d++, sep = ", ")
+      out(ctx, "%s%"PRIu32, sep, ctx->members[i].index[d]);
+  }
+  out(ctx, " };\n");
+  sep = "";
+  out(ctx, "static const uint32_t %s_view_member_id[] = { ", ctx->prefix);
+  for (size_t i = 0; i < ctx->n_members; i++) {
+    for (uint32_t d = 0; d < ctx->members[i].depth; d++, sep = ", ")
+      out(ctx, "%s%"PRIu32, sep, ctx->members[i].member_id[d]);
+  }
+  out(ctx, " };\n");
+
+  out(ctx, "static const dds_view_member_t %s_view_members[] =\n{\n", ctx->prefix);
+  uint32_t pos = 0;
+  for (size_t i = 0; i < ctx->n_members; i++) {
+    const struct view_member *m = &ctx->members[i];
+    out(ctx, "  { %1$"PRIu32", &%2$s_view_index[%3$"PRIu32"], &%2$s_view_member_id[%3$"PRIu32"] }%4$s\n",
+      m->depth, ctx->prefix, pos, (i + 1 < ctx->n_members) ? "," : "");
+    pos += m->depth;
+  }
+  out(ctx, "};\n\n");
+  out(ctx, "static dds_view_desc_t %1$s_view_desc = { &%1$s_desc, %2$zu, %1$s_view_members, DDSRT_ATOMIC_VOIDP_INIT (NULL) };\n\n", ctx->prefix, ctx->n_members);
+}
+
+static void print_functions(struct view_ctx *ctx)
+{
+  out(ctx, "dds_return_t %1$s_view_init (%1$s_view *view, struct ddsi_serdata *serdata)\n{\n", ctx->prefix);
+  out(ctx, "  return dds_view_init (&view->v, &%s_view_desc, view->offs, serdata);\n}\n\n", ctx->prefix);
+  out(ctx, "void %1$s_view_fini (%1$s_view *view)\n{\n", ctx->prefix);
+  out(ctx, "  dds_view_fini (&view->v);\n}\n\n");
+
+  for (size_t i = 0; i < ctx->n_members; i++) {
+    const struct view_member *m = &ctx->members[i];
+    out(ctx, "bool %1$s_view_%2$s (%1$s_view *view, %3$s%4$s*value)\n{\n", ctx->prefix, m->name, m->type, value_sep(m->type));
+    switch (m->kind) {
+      case VIEW_STRING:
+        out(ctx, "  return (*value = dds_view_string (&view->v, %zu)) != NULL;\n", i);
+        break;
+      case VIEW_BOOL:
+        out(ctx, "  const unsigned char *p = dds_view_member (&view->v, %zu, 1);\n", i);
+        out(ctx, "  if (p == NULL)\n    return false;\n");
+        out(ctx, "  *value = (*p != 0);\n");
+        out(ctx, "  return true;\n");
+        break;
+      case VIEW_ENUM:
+        out(ctx, "  const void *p = dds_view_member (&view->v, %zu, %"PRIu32");\n", i, m->size);
+        out(ctx, "  uint%"PRIu32"_t x;\n", 8 * m->size);
+        out(ctx, "  if (p == NULL)\n    return false;\n");
+        out(ctx, "  memcpy (&x, p, sizeof (x));\n");
+        out(ctx, "  *value = (%s) x;\n", m->type);
+        out(ctx, "  return true;\n");
+        break;
+      case VIEW_PRIM:
+        out(ctx, "  const void *p = dds_view_member (&view->v, %zu, %"PRIu32");\n", i, m->size);
+        out(ctx, "  if (p == NULL)\n    return false;\n");
+        out(ctx, "  memcpy (value, p, sizeof (*value));\n");
+        out(ctx, "  return true;\n");
+        break;
+    }
+    out(ctx, "}\n\n");
+  }
+}
+
+idl_retcode_t
+print_views(
+  const idl_pstate_t *pstate,
+  struct generator *generator,
+  const idl_node_t *node)
+{
+  idl_retcode_t ret;
+  struct view_ctx ctx;
+  const uint32_t none[1] = { 0 };
+
+  (void)pstate;
+  if (!idl_is_struct(node))
+    return IDL_RETCODE_OK;
+  memset(&ctx, 0, sizeof(ctx));
+  if (IDL_PRINT(&ctx.prefix, print_type, node) < 0)
+    return IDL_RETCODE_NO_MEMORY;
+  if ((ret = add_members(&ctx, (const idl_struct_t *)node, "", 0, none, none)) != IDL_RETCODE_OK)
+    goto err;
+  if (ctx.n_members == 0)
+    goto err;
+
+  ctx.fp = generator->header.handle;
+  print_declarations(&ctx, generator->config.export_macro);
+  ctx.fp = generator->source.handle;
+  print_desc(&ctx);
+  print_functions(&ctx);
+  if (ctx.failed)
+    ret = IDL_RETCODE_NO_MEMORY;
+err:
+  fini_ctx(&ctx);
+  return ret;
+}
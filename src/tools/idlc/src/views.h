@@ -0,0 +1,27 @@
+/*
+ * Copyright(c) 2023 ZettaScale Technology and others
+ *
+ * This program and the accompanying materials are made available under the
+ * terms of the Eclipse Public License v. 2.0 which is available at
+ * http://www.eclipse.org/legal/epl-2.0, or the Eclipse Distribution License
+ * v. 1.0 which is available at
+ * http://www.eclipse.org/org/documents/edl-v10.php.
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR BSD-3-Clause
+ */
+#ifndef VIEWS_H
+#define VIEWS_H
+
+#include "idl/processor.h"
+#include "generator.h"
+
+/* Prints the view type and its accessors for a topic struct: the declarations
+   go to the header, the view description and accessor functions to the source.
+   Topics without members that can be accessed through a view get nothing. */
+idl_retcode_t
+print_views(
+  const idl_pstate_t *pstate,
+  struct generator *generator,
+  const idl_node_t *node);
+
+#endif /* VIEWS_H */